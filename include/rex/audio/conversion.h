@@ -16,27 +16,57 @@
 #include <rex/platform.h>
 #include <rex/types.h>
 
+#if REX_ARCH_ARM64
+#include <arm_neon.h>
+#endif
+
 namespace rex::audio::conversion {
 
 #if REX_ARCH_AMD64
 inline void sequential_6_BE_to_interleaved_6_LE(float* output, const float* input,
                                                 size_t ch_sample_count) {
-  const uint32_t* in = reinterpret_cast<const uint32_t*>(input);
-  uint32_t* out = reinterpret_cast<uint32_t*>(output);
   const __m128i byte_swap_shuffle =
       _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
-  for (size_t sample = 0; sample < ch_sample_count; sample++) {
-    __m128i sample0 =
-        _mm_set_epi32(in[3 * ch_sample_count + sample], in[2 * ch_sample_count + sample],
-                      in[1 * ch_sample_count + sample], in[0 * ch_sample_count + sample]);
-    uint32_t sample1 = in[4 * ch_sample_count + sample];
-    uint32_t sample2 = in[5 * ch_sample_count + sample];
-    sample0 = _mm_shuffle_epi8(sample0, byte_swap_shuffle);
-    _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[sample * 6]), sample0);
-    sample1 = rex::byte_swap(sample1);
-    out[sample * 6 + 4] = sample1;
-    sample2 = rex::byte_swap(sample2);
-    out[sample * 6 + 5] = sample2;
+  size_t sample = 0;
+  // Four samples per iteration: vector loads from each channel plane, a 4x4
+  // transpose for the first four channels and an interleave for the last two,
+  // instead of a scalar gather per sample.
+  for (; sample + 4 <= ch_sample_count; sample += 4) {
+    __m128 c0 = _mm_loadu_ps(&input[0 * ch_sample_count + sample]);
+    __m128 c1 = _mm_loadu_ps(&input[1 * ch_sample_count + sample]);
+    __m128 c2 = _mm_loadu_ps(&input[2 * ch_sample_count + sample]);
+    __m128 c3 = _mm_loadu_ps(&input[3 * ch_sample_count + sample]);
+    __m128 c4 = _mm_loadu_ps(&input[4 * ch_sample_count + sample]);
+    __m128 c5 = _mm_loadu_ps(&input[5 * ch_sample_count + sample]);
+    c0 = _mm_castsi128_ps(_mm_shuffle_epi8(_mm_castps_si128(c0), byte_swap_shuffle));
+    c1 = _mm_castsi128_ps(_mm_shuffle_epi8(_mm_castps_si128(c1), byte_swap_shuffle));
+    c2 = _mm_castsi128_ps(_mm_shuffle_epi8(_mm_castps_si128(c2), byte_swap_shuffle));
+    c3 = _mm_castsi128_ps(_mm_shuffle_epi8(_mm_castps_si128(c3), byte_swap_shuffle));
+    c4 = _mm_castsi128_ps(_mm_shuffle_epi8(_mm_castps_si128(c4), byte_swap_shuffle));
+    c5 = _mm_castsi128_ps(_mm_shuffle_epi8(_mm_castps_si128(c5), byte_swap_shuffle));
+    __m128 t0 = _mm_unpacklo_ps(c0, c1);  // c0[0] c1[0] c0[1] c1[1]
+    __m128 t1 = _mm_unpackhi_ps(c0, c1);  // c0[2] c1[2] c0[3] c1[3]
+    __m128 t2 = _mm_unpacklo_ps(c2, c3);
+    __m128 t3 = _mm_unpackhi_ps(c2, c3);
+    __m128 r0 = _mm_movelh_ps(t0, t2);  // channels 0-3 of sample 0
+    __m128 r1 = _mm_movehl_ps(t2, t0);  // channels 0-3 of sample 1
+    __m128 r2 = _mm_movelh_ps(t1, t3);
+    __m128 r3 = _mm_movehl_ps(t3, t1);
+    __m128 p01 = _mm_unpacklo_ps(c4, c5);  // c4[0] c5[0] c4[1] c5[1]
+    __m128 p23 = _mm_unpackhi_ps(c4, c5);
+    _mm_storeu_ps(&output[(sample + 0) * 6 + 0], r0);
+    _mm_storel_pi(reinterpret_cast<__m64*>(&output[(sample + 0) * 6 + 4]), p01);
+    _mm_storeu_ps(&output[(sample + 1) * 6 + 0], r1);
+    _mm_storeh_pi(reinterpret_cast<__m64*>(&output[(sample + 1) * 6 + 4]), p01);
+    _mm_storeu_ps(&output[(sample + 2) * 6 + 0], r2);
+    _mm_storel_pi(reinterpret_cast<__m64*>(&output[(sample + 2) * 6 + 4]), p23);
+    _mm_storeu_ps(&output[(sample + 3) * 6 + 0], r3);
+    _mm_storeh_pi(reinterpret_cast<__m64*>(&output[(sample + 3) * 6 + 4]), p23);
+  }
+  for (; sample < ch_sample_count; sample++) {
+    for (size_t channel = 0; channel < 6; channel++) {
+      output[sample * 6 + channel] = rex::byte_swap(input[channel * ch_sample_count + sample]);
+    }
   }
 }
 
@@ -73,6 +103,75 @@ inline void sequential_6_BE_to_interleaved_2_LE(float* output, const float* inpu
     _mm_storeu_ps(&output[(sample + 2) * 2], _mm_unpackhi_ps(left, right));
   }
 }
+#elif REX_ARCH_ARM64
+inline void sequential_6_BE_to_interleaved_6_LE(float* output, const float* input,
+                                                size_t ch_sample_count) {
+  auto load_swapped = [&](size_t channel, size_t sample) {
+    uint8x16_t raw =
+        vld1q_u8(reinterpret_cast<const uint8_t*>(&input[channel * ch_sample_count + sample]));
+    return vreinterpretq_f32_u8(vrev32q_u8(raw));
+  };
+  size_t sample = 0;
+  // Four samples per iteration, mirroring the SSE path: transpose the first
+  // four channel planes and zip the last two.
+  for (; sample + 4 <= ch_sample_count; sample += 4) {
+    float32x4_t c0 = load_swapped(0, sample);
+    float32x4_t c1 = load_swapped(1, sample);
+    float32x4_t c2 = load_swapped(2, sample);
+    float32x4_t c3 = load_swapped(3, sample);
+    float32x4_t c4 = load_swapped(4, sample);
+    float32x4_t c5 = load_swapped(5, sample);
+    float32x4x2_t t01 = vtrnq_f32(c0, c1);  // val[0]: c0[0] c1[0] c0[2] c1[2]
+    float32x4x2_t t23 = vtrnq_f32(c2, c3);
+    float32x4_t r0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+    float32x4_t r1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+    float32x4_t r2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+    float32x4_t r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+    float32x4x2_t c45 = vzipq_f32(c4, c5);  // val[0]: c4[0] c5[0] c4[1] c5[1]
+    vst1q_f32(&output[(sample + 0) * 6 + 0], r0);
+    vst1_f32(&output[(sample + 0) * 6 + 4], vget_low_f32(c45.val[0]));
+    vst1q_f32(&output[(sample + 1) * 6 + 0], r1);
+    vst1_f32(&output[(sample + 1) * 6 + 4], vget_high_f32(c45.val[0]));
+    vst1q_f32(&output[(sample + 2) * 6 + 0], r2);
+    vst1_f32(&output[(sample + 2) * 6 + 4], vget_low_f32(c45.val[1]));
+    vst1q_f32(&output[(sample + 3) * 6 + 0], r3);
+    vst1_f32(&output[(sample + 3) * 6 + 4], vget_high_f32(c45.val[1]));
+  }
+  for (; sample < ch_sample_count; sample++) {
+    for (size_t channel = 0; channel < 6; channel++) {
+      output[sample * 6 + channel] = rex::byte_swap(input[channel * ch_sample_count + sample]);
+    }
+  }
+}
+
+inline void sequential_6_BE_to_interleaved_2_LE(float* output, const float* input,
+                                                size_t ch_sample_count) {
+  assert_true(ch_sample_count % 4 == 0);
+
+  auto load_swapped = [&](size_t channel, size_t sample) {
+    uint8x16_t raw =
+        vld1q_u8(reinterpret_cast<const uint8_t*>(&input[channel * ch_sample_count + sample]));
+    return vreinterpretq_f32_u8(vrev32q_u8(raw));
+  };
+  const float32x4_t half = vdupq_n_f32(0.5f);
+  const float32x4_t two_fifths = vdupq_n_f32(1.0f / 2.5f);
+
+  // put center on left and right, discard low frequency
+  for (size_t sample = 0; sample < ch_sample_count; sample += 4) {
+    float32x4_t fl = load_swapped(0, sample);
+    float32x4_t fr = load_swapped(1, sample);
+    float32x4_t fc = load_swapped(2, sample);
+    float32x4_t bl = load_swapped(4, sample);
+    float32x4_t br = load_swapped(5, sample);
+
+    float32x4_t center_halved = vmulq_f32(fc, half);
+    float32x4_t left = vmulq_f32(vaddq_f32(vaddq_f32(fl, bl), center_halved), two_fifths);
+    float32x4_t right = vmulq_f32(vaddq_f32(vaddq_f32(fr, br), center_halved), two_fifths);
+    float32x4x2_t lr = vzipq_f32(left, right);
+    vst1q_f32(&output[sample * 2], lr.val[0]);
+    vst1q_f32(&output[(sample + 2) * 2], lr.val[1]);
+  }
+}
 #else
 inline void sequential_6_BE_to_interleaved_6_LE(float* output, const float* input,
                                                 size_t ch_sample_count) {
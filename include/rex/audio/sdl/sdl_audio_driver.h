@@ -11,9 +11,8 @@
 
 #pragma once
 
-#include <mutex>
-#include <queue>
-#include <stack>
+#include <atomic>
+#include <memory>
 
 #include <rex/audio/audio_driver.h>
 #include <rex/thread.h>
@@ -45,9 +44,18 @@ class SDLAudioDriver : public AudioDriver {
   static const uint32_t channel_samples_ = 256;
   static const uint32_t frame_samples_ = frame_channels_ * channel_samples_;
   static const uint32_t frame_size_ = sizeof(float) * frame_samples_;
-  std::queue<float*> frames_queued_ = {};
-  std::stack<float*> frames_unused_ = {};
-  std::mutex frames_mutex_ = {};
+
+  // Single-producer/single-consumer frame ring between the guest submit path
+  // and the SDL render callback. The producer owns frame_write_index_, the
+  // consumer owns frame_read_index_; both only ever grow and are published
+  // with release/acquire ordering, so neither side takes a lock and the
+  // render thread can never stall the guest audio thread. Capacity matches
+  // the submission credits handed out through the client semaphore
+  // (audio_maxqframes), so the ring cannot overflow in normal operation.
+  std::unique_ptr<float[]> frame_ring_;
+  uint32_t frame_ring_capacity_ = 0;
+  std::atomic<uint32_t> frame_write_index_ = {0};
+  std::atomic<uint32_t> frame_read_index_ = {0};
 };
 
 }  // namespace rex::audio::sdl
@@ -15,7 +15,8 @@
 #include <atomic>
 #include <mutex>
 #include <queue>
-// #include <vector>
+#include <unordered_map>
+#include <vector>
 
 #include <rex/kernel.h>
 #include <rex/memory.h>
@@ -223,6 +224,12 @@ class XmaContext {
   // conversion buffer for 2 channel frame
   std::array<uint8_t, kBytesPerFrameChannel * 2> raw_frame_;
   // std::vector<uint8_t> current_frame_ = std::vector<uint8_t>(0);
+
+  // Converted PCM keyed by a chained frame-content hash, replayed on loop
+  // passes so steady-state looping streams skip the codec entirely. Bounded
+  // by the xma_loop_frame_cache_kb cvar and cleared with the context.
+  std::unordered_map<uint64_t, std::vector<uint8_t>> loop_frame_cache_;
+  uint64_t prev_frame_hash_ = 0;
 };
 
 }  // namespace rex::audio
@@ -12,8 +12,10 @@
 #pragma once
 
 #include <atomic>
+#include <memory>
 #include <mutex>
 #include <queue>
+#include <vector>
 
 #include <rex/audio/xma/context.h>
 #include <rex/audio/xma/register_file.h>
@@ -57,7 +59,7 @@ class XmaDecoder {
   int GetContextId(uint32_t guest_ptr);
 
  private:
-  void WorkerThreadMain();
+  void WorkerThreadMain(uint32_t worker_index);
 
   static uint32_t MMIOReadRegisterThunk(void* ppc_context, XmaDecoder* as, uint32_t addr) {
     return as->ReadRegister(addr);
@@ -72,12 +74,19 @@ class XmaDecoder {
   runtime::Processor* processor_ = nullptr;
 
   std::atomic<bool> worker_running_ = {false};
-  system::object_ref<system::XHostThread> worker_thread_;
-  std::unique_ptr<rex::thread::Event> work_event_ = nullptr;
+  // Contexts are sharded across the workers by id (context i belongs to
+  // worker i % worker_count_), so consecutively allocated voices spread out.
+  uint32_t worker_count_ = 1;
+  std::vector<system::object_ref<system::XHostThread>> worker_threads_;
+  std::vector<std::unique_ptr<rex::thread::Event>> work_events_;
 
   bool paused_ = false;
-  rex::thread::Fence pause_fence_;   // Signaled when worker paused.
-  rex::thread::Fence resume_fence_;  // Signaled when resume requested.
+  // One pause fence per worker: each must report in before Pause() returns.
+  std::vector<std::unique_ptr<rex::thread::Fence>> pause_fences_;
+  // One resume fence per worker too: Fence::Wait is last-waiter-out, so a
+  // single shared fence could have its signal consumed by the workers that
+  // were already parked while a late arrival parks forever.
+  std::vector<std::unique_ptr<rex::thread::Fence>> resume_fences_;
 
   XmaRegisterFile register_file_;
 
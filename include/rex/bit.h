@@ -48,6 +48,21 @@ class BitMap {
   // (threadsafe) Releases an entry by an index.
   void Release(size_t index);
 
+  // Returns the index of the first set (free) entry at or after first, or -1
+  // if there is none. Empty 4096-entry spans are skipped through the summary
+  // words, so sparse maps with millions of entries scan in a handful of loads.
+  size_t FindFirstSet(size_t first = 0) const;
+
+  // Returns <first, length> of the next run of set entries at or after first,
+  // with length == 0 if there is none.
+  std::pair<size_t, size_t> NextSetRange(size_t first = 0) const;
+
+  // (not threadsafe) Sets/clears length entries starting at first. Bulk
+  // bookkeeping (dirty page ranges and the like) should batch whole uploads
+  // through these rather than releasing/acquiring per entry.
+  void SetRange(size_t first, size_t length);
+  void ClearRange(size_t first, size_t length);
+
   // Resize the bitmap. Size is the number of entries, must be a multiple of 64.
   void Resize(size_t new_size_bits);
 
@@ -60,7 +75,16 @@ class BitMap {
  private:
   const static size_t kDataSize = 8;
   const static size_t kDataSizeBits = kDataSize * 8;
+
+  // Rebuilds summary_ from data_ after wholesale changes.
+  void RebuildSummary();
+
   std::vector<uint64_t> data_;
+  // Second level: one bit per data word (so one summary word per 4096
+  // entries), set when the word may contain set bits. Conservatively stale
+  // bits are tolerated - scans recheck the word - but a clear summary bit
+  // always means the word is empty.
+  std::vector<uint64_t> summary_;
 };
 
 //=============================================================================
@@ -11,14 +11,22 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 
 #include <rex/cvar.h>
 #include <rex/platform.h>
 
+#if REX_ARCH_AMD64
+#include <x86intrin.h>
+#endif
+
 REXCVAR_DECLARE(bool, clock_no_scaling);
 REXCVAR_DECLARE(bool, clock_source_raw);
+REXCVAR_DECLARE(bool, clock_fast_timebase);
+REXCVAR_DECLARE(bool, clock_virtual_tick);
+REXCVAR_DECLARE(uint64_t, clock_virtual_ticks_per_query);
 
 #if REX_ARCH_AMD64
 // Raw clock source requires platform-specific implementation
@@ -28,6 +36,20 @@ REXCVAR_DECLARE(bool, clock_source_raw);
 
 namespace rex::chrono {
 
+namespace detail {
+// Parameters for the TSC-based guest timebase fast path. Published with a
+// release store by the clock after calibration or a ratio change; readers
+// acquire-load and never take a lock. Retired parameter blocks are kept
+// alive for the life of the process since a reader may still hold one.
+struct GuestTimebaseParams {
+  uint64_t tsc_base;
+  uint64_t guest_tick_base;
+  // Guest ticks per TSC tick in 32.32 fixed point.
+  uint64_t ticks_per_tsc_fp32;
+};
+extern std::atomic<const GuestTimebaseParams*> guest_timebase_params_;
+}  // namespace detail
+
 class Clock {
  public:
   // Host ticks-per-second. Generally QueryHostTickFrequency should be used.
@@ -71,6 +93,11 @@ class Clock {
   // Queries the current guest tick count, accounting for frequency adjustment
   // and scaling.
   static uint64_t QueryGuestTickCount();
+  // Same, but reads the invariant TSC and scales it inline when that is
+  // available - a handful of instructions with no syscall. Falls back to
+  // QueryGuestTickCount() otherwise. This is the mftb path; game loops can
+  // hit it millions of times per second.
+  static uint64_t QueryGuestTickCountFast();
   // Queries the guest time, in FILETIME format, accounting for scaling.
   static uint64_t QueryGuestSystemTime();
   // Queries the milliseconds since the guest began, accounting for scaling.
@@ -79,12 +106,38 @@ class Clock {
   // Sets the system time of the guest.
   static void SetGuestSystemTime(uint64_t system_time);
 
+  // True when the guest clock is fully decoupled from host time
+  // (clock_virtual_tick): guest ticks advance only by queries and explicit
+  // AdvanceVirtualTicks calls, and guest wait durations collapse to zero.
+  // Latched on first use so the mode cannot flip mid-run.
+  static bool virtual_tick_enabled();
+  // Advances the virtual guest timebase by the given number of guest ticks.
+  // No-op when virtual tick mode is off.
+  static void AdvanceVirtualTicks(uint64_t guest_ticks);
+
   // Scales a time duration in milliseconds, from guest time.
   static uint32_t ScaleGuestDurationMillis(uint32_t guest_ms);
+  // Scales a time duration in microseconds, from guest time.
+  static uint64_t ScaleGuestDurationMicros(uint64_t guest_us);
   // Scales a time duration in 100ns ticks like FILETIME, from guest time.
   static int64_t ScaleGuestDurationFileTime(int64_t guest_file_time);
   // Scales a time duration represented as a timeval, from guest time.
   static void ScaleGuestDurationTimeval(int32_t* tv_sec, int32_t* tv_usec);
 };
 
+inline uint64_t Clock::QueryGuestTickCountFast() {
+#if REX_ARCH_AMD64
+  const detail::GuestTimebaseParams* params =
+      detail::guest_timebase_params_.load(std::memory_order_acquire);
+  if (params) {
+    uint64_t tsc_delta = __rdtsc() - params->tsc_base;
+    return params->guest_tick_base +
+           static_cast<uint64_t>((static_cast<unsigned __int128>(tsc_delta) *
+                                  params->ticks_per_tsc_fp32) >>
+                                 32);
+  }
+#endif
+  return QueryGuestTickCount();
+}
+
 }  // namespace rex::chrono
@@ -33,4 +33,10 @@ namespace rex::codegen {
  */
 Result<void> Analyze(CodegenContext& ctx);
 
+/**
+ * Hash of all executable section bytes (XXH3).
+ * Used to validate cached analysis results against the binary they came from.
+ */
+uint64_t executableSectionHash(const BinaryView& binary);
+
 }  // namespace rex::codegen
@@ -11,12 +11,16 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <memory>
 #include <span>
 #include <string>
 #include <string_view>
 #include <vector>
 
+#include <rex/memory/mapped_memory.h>
+
 namespace rex::runtime {
 class Module;
 }
@@ -51,16 +55,30 @@ struct ImportSymbol {
 /// Self-contained binary view that owns all section data
 class BinaryView {
  public:
-  /// Factory - copies all data from Module
-  static BinaryView fromModule(const runtime::Module& module);
-
-  // Move-only (owns large buffers)
-  BinaryView(BinaryView&&) noexcept = default;
-  BinaryView& operator=(BinaryView&&) noexcept = default;
+  /// Controls whether fromModule() copies section bytes or references the
+  /// module's host memory directly. Borrowing requires the module (and the
+  /// Runtime that owns it) to outlive this view.
+  enum class DataPolicy {
+    kCopy,    ///< Copy section bytes into owned buffers
+    kBorrow,  ///< Zero-copy: point at the module's host memory
+  };
+
+  /// Factory - builds a view over the Module's sections.
+  /// With DataPolicy::kBorrow no section bytes are copied; pages are faulted
+  /// in on demand from whatever backs the module (heap or file mapping).
+  static BinaryView fromModule(const runtime::Module& module,
+                               DataPolicy policy = DataPolicy::kCopy);
+
+  // Move-only (owns large buffers); moves are hand-written because the MRU
+  // cache slot is an atomic
+  BinaryView(BinaryView&&) noexcept;
+  BinaryView& operator=(BinaryView&&) noexcept;
   BinaryView(const BinaryView&) = delete;
   BinaryView& operator=(const BinaryView&) = delete;
 
-  // Section access
+  // Section access. Lookups are a one-entry MRU check followed by a binary
+  // search over section start addresses; analysis does millions of these.
+  // Returned pointers are stable for the lifetime of the view.
   const uint8_t* translate(uint32_t addr) const;
   bool isExecutable(uint32_t addr) const;
   const SectionView* findSection(uint32_t addr) const;
@@ -89,15 +107,37 @@ class BinaryView {
   /// Import symbols (thunk addresses + names)
   std::span<const ImportSymbol> importSymbols() const { return importSymbols_; }
 
+  /// Take ownership of a file mapping that backs borrowed section pointers.
+  /// Keeps the mapping alive for the lifetime of this view.
+  void attachMapping(std::unique_ptr<memory::MappedMemory> mapping) {
+    mapping_ = std::move(mapping);
+  }
+
  public:
   BinaryView() = default;
 
  private:
-  // Owned section data
+  /// Rebuild the sorted lookup index after sections_ changes
+  void buildSectionIndex();
+
+  // Owned section data (empty per-section buffers when borrowing)
   std::vector<SectionView> sections_;
   std::vector<std::string> sectionNames_;
   std::vector<std::vector<uint8_t>> sectionData_;
 
+  // Address lookup acceleration: section indices ordered by start address,
+  // with the matching starts in a flat array the search can walk without
+  // touching SectionView. The MRU slot short-circuits the common case of
+  // thousands of consecutive queries landing in .text; relaxed atomics keep
+  // it safe to update from parallel emission workers (a stale value only
+  // costs the binary search).
+  std::vector<uint32_t> sectionStarts_;
+  std::vector<uint32_t> sectionOrder_;
+  mutable std::atomic<uint32_t> mruSection_{0};
+
+  // Optional file mapping backing borrowed section pointers
+  std::unique_ptr<memory::MappedMemory> mapping_;
+
   // Metadata
   uint32_t baseAddress_ = 0;
   uint32_t imageSize_ = 0;
@@ -11,8 +11,12 @@
 
 #pragma once
 
+#include <filesystem>
+#include <fstream>
+#include <memory>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include <fmt/core.h>
 
@@ -156,4 +160,54 @@ class StringEmitter : public CodeEmitter {
   int indentWidth_ = 4;
 };
 
+/**
+ * @brief CodeEmitter that streams through a buffered file.
+ *
+ * Used by streaming output mode: text is written straight to disk through a
+ * large stream buffer instead of accumulating in memory, so only one
+ * function's worth of text is ever resident per output file.
+ */
+class FileEmitter : public CodeEmitter {
+ public:
+  explicit FileEmitter(const std::filesystem::path& path, int indentWidth = 4)
+      : buffer_(kStreamBufferSize), indentWidth_(indentWidth) {
+    stream_.rdbuf()->pubsetbuf(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+    stream_.open(path, std::ios::binary);
+  }
+
+  /// True if the file opened and no write has failed
+  bool ok() const { return stream_.good(); }
+
+  /// Flush and close the underlying file
+  void close() { stream_.close(); }
+
+  void indent() override {
+    indentLevel_++;
+    updateIndentString();
+  }
+
+  void dedent() override {
+    if (indentLevel_ > 0)
+      indentLevel_--;
+    updateIndentString();
+  }
+
+  std::string_view indentString() const override { return indentStr_; }
+
+  void raw(std::string_view text) override {
+    stream_.write(text.data(), static_cast<std::streamsize>(text.size()));
+  }
+
+ private:
+  static constexpr size_t kStreamBufferSize = 256 * 1024;
+
+  void updateIndentString() { indentStr_ = std::string(indentLevel_ * indentWidth_, ' '); }
+
+  std::vector<char> buffer_;
+  std::ofstream stream_;
+  std::string indentStr_;
+  int indentLevel_ = 0;
+  int indentWidth_ = 4;
+};
+
 }  // namespace rex::codegen
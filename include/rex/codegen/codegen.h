@@ -58,6 +58,19 @@ class CodegenPipeline {
    */
   Result<void> Run(bool force = false);
 
+  /**
+   * Adopt the jump-table analysis cache from a previous pipeline run.
+   *
+   * Used by batch codegen: when several configs target the same binary
+   * image (base + DLC outputs), the expensive jump-table analysis from the
+   * first run carries over in memory instead of round-tripping through the
+   * sidecar file. The cache is only adopted when the executable-section
+   * hashes match; otherwise this is a no-op.
+   *
+   * Call after Create() and before Run().
+   */
+  void AdoptAnalysisCache(CodegenPipeline& previous);
+
   /// Access context for CLI needs (output path, project name, etc.)
   CodegenContext& context() { return *ctx_; }
   const CodegenContext& context() const { return *ctx_; }
@@ -21,6 +21,7 @@
 #include <rex/codegen/code_region.h>
 #include <rex/codegen/config.h>
 #include <rex/codegen/function_graph.h>
+#include <rex/codegen/phase_timing.h>
 #include <rex/result.h>
 
 namespace rex {
@@ -35,6 +36,7 @@ namespace rex::codegen {
 
 // Forward declarations
 class DecodedBinary;
+class JumpTableCache;
 struct SectionInfo;
 struct FunctionEntry;
 struct FunctionConfig;
@@ -70,6 +72,10 @@ struct AnalysisState {
   std::unordered_map<uint32_t, uint32_t> invalidInstructions;  ///< addr -> size
   std::unordered_set<uint32_t> knownIndirectCalls;             ///< bctr addresses
   std::vector<uint32_t> exceptionHandlerFuncs;                 ///< Handler addresses
+
+  /// Ranges quarantined by this or a previous run: analysis failed inside
+  /// them, so they are treated as data and calls into them emit fatal thunks
+  std::vector<CodeRegion> quarantinedRegions;
 };
 
 /**
@@ -122,6 +128,7 @@ class CodegenContext {
   // === OWNED DATA (single source of truth) ===
   FunctionGraph graph;    ///< All functions (including imports)
   AnalysisErrors errors;  ///< Accumulated errors
+  PhaseTimings timings;   ///< Wall-clock accounting per pipeline phase
 
   /// Scan phase artifacts (passed to Discover for scanner setup)
   struct {
@@ -154,6 +161,13 @@ class CodegenContext {
 
   const std::filesystem::path& configDir() const { return configDir_; }
 
+  /// Jump-table memoization cache (null until analysis installs one)
+  JumpTableCache* jumpTableCache() const { return jumpTableCache_.get(); }
+  void setJumpTableCache(std::unique_ptr<JumpTableCache> cache);
+
+  /// Release the jump-table cache (batch codegen hands it to the next context)
+  std::unique_ptr<JumpTableCache> takeJumpTableCache();
+
  private:
   CodegenContext() = default;
 
@@ -161,6 +175,7 @@ class CodegenContext {
   RecompilerConfig config_;                 ///< User configuration (owned)
   AnalysisState analysisState_;             ///< Analysis state (populated during analysis)
   std::unique_ptr<DecodedBinary> decoded_;  ///< Decoded instructions (created via initDecoded())
+  std::unique_ptr<JumpTableCache> jumpTableCache_;  ///< Jump-table memoization (see discovery.h)
   runtime::ExportResolver* resolver_ = nullptr;  ///< For runtime resolution (borrowed)
   std::filesystem::path configDir_;  ///< Directory containing config file (for relative paths)
 };
@@ -88,11 +88,31 @@ struct RecompilerConfig {
   bool nonArgumentRegistersAsLocalVariables = false;
   bool nonVolatileRegistersAsLocalVariables = false;
   bool generateExceptionHandlers = false;  ///< Generate SEH exception handler wrappers
+  bool foldImmediatePairs = true;  ///< Collapse lis+addi / lis+ori pairs into one assignment
+  bool foldLoadStoreCopies = true;  ///< Emit raw moves for load/store pairs (swap elimination)
+  bool fuseCompareBranches = true;  ///< Fuse compare+branch pairs when the CR field has no other consumers
+  bool devirtualizeVTableCalls = true;  ///< Direct-call bctr/bctrl sites with provably constant ctr
+  bool skipLrForLeafCalls = true;  ///< Skip the ctx.lr store when calling a known leaf function
+  bool emitTailCalls = true;  ///< Emit PPC_MUSTTAIL returns for b-to-function tail calls
+  uint32_t inlineInstructionBudget = 0;  ///< Inline leaf callees up to this many instructions long (0 = off; inlined sites bypass PPC_WEAK_FUNC overrides)
+  uint32_t computedGotoMinEntries = 32;  ///< Emit label-address dispatch for local jump tables with at least this many entries (0 = always use switch; GCC/Clang only, MSVC builds keep the switch)
+  bool volatileMemoryAccess = false;  ///< Force volatile on plain guest loads/stores
+  bool emitFunctionCounters = false;  ///< Emit a relaxed per-function call counter (rex_fn_counters section) in every prologue; the runtime dumps counts in profile_path format
+  bool fastFloatEstimates = false;  ///< Lower fres/frsqrte to hardware rcp/rsqrt estimates plus one Newton-Raphson step instead of the precise software paths
+  bool branchHints = true;  ///< Emit [[likely]]/[[unlikely]] on generated conditionals: backward local branches (loop back-edges) are likely, fatal arms and never-profiled conditional tail calls are unlikely
+
+  // === Profile-guided optimization (optional) ===
+  std::string profilePath;  ///< Profile file with "<hex address> <call count>" lines
+  std::unordered_map<uint32_t, uint64_t> profile;  ///< Parsed profile (address -> call count)
+  uint64_t profileHotThreshold = 1;  ///< Minimum call count for a function to count as hot
 
   // === Analysis tuning (optional) ===
   uint32_t maxJumpExtension = 65536;  ///< Max bytes to extend function for jump table targets
   uint32_t dataRegionThreshold = 16;  ///< Consecutive invalid instructions to mark as data region
   uint32_t largeFunctionThreshold = 1048576;  ///< 1MB - warn if function exceeds this size
+  uint32_t largeEmissionThreshold = 1048576;  ///< Warn when one function emits more C++ bytes than this (0 = off)
+  uint32_t isolateFunctionThreshold = 0;  ///< Give functions with at least this many guest code bytes their own TU (0 = off)
+  bool quarantineAnalysisErrors = false;  ///< Quarantine regions that fail validation as data and finish the run instead of aborting
 
   // === Manual overrides ===
   std::unordered_map<uint32_t, FunctionConfig> functions;  ///< Function/chunk configuration
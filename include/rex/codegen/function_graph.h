@@ -25,6 +25,8 @@
 #include <variant>
 #include <vector>
 
+#include <rex/codegen/string_interner.h>
+#include <rex/memory/arena.h>
 #include <rex/types.h>
 
 namespace rex::codegen::ppc {
@@ -296,7 +298,7 @@ class FunctionNode {
   uint32_t base() const { return base_; }
   uint32_t size() const { return size_; }
   uint32_t end() const { return base_ + size_; }
-  const std::string& name() const { return name_; }
+  std::string_view name() const { return name_; }
 
   // Code access - cached pointer to instruction bytes
   const uint8_t* code() const { return code_; }
@@ -396,6 +398,20 @@ class FunctionNode {
   // Validation
   bool hasExceptionHandler() const { return hasExceptionHandler_; }
 
+  // Leaf status: no calls, no tail calls, never reads lr. Call sites
+  // targeting a leaf can skip the ctx.lr store (see markLeafFunctions)
+  bool isLeaf() const { return leaf_; }
+
+  // CR fields whose compare+branch pairs may fuse without materializing the
+  // field: every reader of the field was proven adjacent to its own
+  // full-field producer (see analyzeCrFieldConsumption)
+  bool crFieldFusible(unsigned field) const { return (fusibleCrFields_ >> field) & 1; }
+
+  // Inlinable status: a single-block leaf within the configured instruction
+  // budget, ending in an unconditional blr with no other branches, hooks or
+  // traps. Call sites may expand the body in place (see markInlinableFunctions)
+  bool isInlinable() const { return inlinable_; }
+
   // Exception info (SEH or C++ EH)
   const std::optional<ExceptionInfo>& exceptionInfo() const { return exceptionInfo_; }
   bool hasExceptionInfo() const { return exceptionInfo_.has_value() && exceptionInfo_->hasInfo(); }
@@ -405,9 +421,13 @@ class FunctionNode {
   // Mutation methods - only FunctionGraph can call these
   //=========================================================================
 
-  void setName(std::string name) { name_ = std::move(name); }
+  // name must be interned (or otherwise outlive the node) - we only store a view
+  void setName(std::string_view name) { name_ = name; }
   void setCode(const uint8_t* ptr) { code_ = ptr; }
   void setHasExceptionHandler(bool val) { hasExceptionHandler_ = val; }
+  void setLeaf(bool val) { leaf_ = val; }
+  void setFusibleCrFields(uint8_t mask) { fusibleCrFields_ = mask; }
+  void setInlinable(bool val) { inlinable_ = val; }
   void setExceptionInfo(ExceptionInfo info) { exceptionInfo_ = std::move(info); }
 
   // Block/label management
@@ -422,7 +442,7 @@ class FunctionNode {
 
   // Resolution (reactive - called by graph on events)
   bool tryResolveAgainst(FunctionNode* newFunction);
-  bool tryResolveAgainstImport(uint32_t importAddr, const std::string& importName);
+  bool tryResolveAgainstImport(uint32_t importAddr, std::string_view importName);
   bool tryResolveAsInternalLabel(uint32_t target);
 
   // Expansion
@@ -437,11 +457,14 @@ class FunctionNode {
  private:
   uint32_t base_;
   uint32_t size_;
-  std::string name_;
+  std::string_view name_;  // view into the graph's interner (stable storage)
   const uint8_t* code_ = nullptr;  // Cached pointer to instruction bytes
   FunctionAuthority authority_;
   FunctionState state_ = FunctionState::kRegistered;
   bool hasExceptionHandler_ = false;
+  bool leaf_ = false;
+  uint8_t fusibleCrFields_ = 0;  // Bit N set = crN compare+branch pairs may fuse
+  bool inlinable_ = false;
 
   // Populated at discover()
   std::vector<Block> blocks_;
@@ -477,6 +500,15 @@ class FunctionGraph {
  public:
   using MemoryReader = std::function<std::optional<uint32_t>(uint32_t addr)>;
 
+  FunctionGraph();
+  ~FunctionGraph();
+
+  // Nodes live in the arena - the graph can be moved but not copied
+  FunctionGraph(const FunctionGraph&) = delete;
+  FunctionGraph& operator=(const FunctionGraph&) = delete;
+  FunctionGraph(FunctionGraph&&) noexcept = default;
+  FunctionGraph& operator=(FunctionGraph&& other) noexcept;
+
   //=========================================================================
   // Code Buffer Management
   //=========================================================================
@@ -530,9 +562,7 @@ class FunctionGraph {
   bool isImport(uint32_t addr) const;
 
   // Iterate all functions (includes imports with IMPORT authority)
-  const std::unordered_map<uint32_t, std::unique_ptr<FunctionNode>>& functions() const {
-    return functions_;
-  }
+  const std::unordered_map<uint32_t, FunctionNode*>& functions() const { return functions_; }
 
   // Get all PENDING functions
   std::vector<FunctionNode*> getPendingFunctions();
@@ -549,8 +579,8 @@ class FunctionGraph {
   // Function Setup (called during Discover phase)
   //=========================================================================
 
-  // Set function name
-  void setFunctionName(uint32_t entry, std::string name);
+  // Set function name (interned - the graph keeps the only copy)
+  void setFunctionName(uint32_t entry, std::string_view name);
 
   // Set exception handler flag
   void setFunctionHasExceptionHandler(uint32_t entry, bool val);
@@ -558,6 +588,15 @@ class FunctionGraph {
   // Set parsed exception info (SEH or C++ EH)
   void setFunctionExceptionInfo(uint32_t entry, ExceptionInfo info);
 
+  // Mark a function as a leaf (no calls, never reads lr)
+  void setFunctionLeaf(uint32_t entry, bool val);
+
+  // Set the CR fields whose compare+branch pairs may fuse
+  void setFunctionFusibleCrFields(uint32_t entry, uint8_t mask);
+
+  // Mark a function as inlinable at call sites
+  void setFunctionInlinable(uint32_t entry, bool val);
+
   // Add a block to a function
   void addBlockToFunction(uint32_t entry, Block block);
 
@@ -633,7 +672,14 @@ class FunctionGraph {
 
  private:
   std::vector<CodeBuffer> codeBuffers_;
-  std::unordered_map<uint32_t, std::unique_ptr<FunctionNode>> functions_;
+  // Canonical storage for all function/symbol names; nodes hold views into it,
+  // so a name is built once and equal names share a data pointer. Declared
+  // before the node arena so it outlives the nodes that reference it.
+  StringInterner names_;
+  // Nodes are placement-new'd into the arena and torn down in ~FunctionGraph,
+  // so analysis of a big image never pays per-node malloc/free traffic
+  std::unique_ptr<rex::memory::Arena> nodeArena_;
+  std::unordered_map<uint32_t, FunctionNode*> functions_;
   std::map<uint32_t, FunctionNode*>
       functionsByBase_;  // sorted by base for O(log f) interval lookup
   std::unordered_map<uint32_t, bool> functionHasXrefs_;  // entry -> hasXrefs
@@ -642,6 +688,9 @@ class FunctionGraph {
 
   // Notify all PENDING functions that a new function was added
   void notifyFunctionAdded(FunctionNode* newFunction);
+
+  // Run destructors of all arena-resident nodes
+  void destroyNodes();
 };
 
 }  // namespace rex::codegen
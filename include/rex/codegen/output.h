@@ -13,9 +13,12 @@
 
 #include <filesystem>
 #include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include <rex/codegen/code_emitter.h>
 #include <rex/codegen/recompiled_function.h>
 #include <rex/types.h>
 
@@ -39,6 +42,23 @@ struct OutputConfig {
   std::string project_name = "rex";
   bool emit_comments = true;
   bool emit_cmake = true;
+
+  /// Target number of ppc_recomp.N.cpp translation units. Functions are
+  /// bin-packed by emitted byte count so the units compile in roughly equal
+  /// time. 0 derives the count from the functions_per_file cvar.
+  size_t num_units = 0;
+
+  /// When above 1, the generated CMakeLists enables CMake unity builds with
+  /// this many translation units combined per host compiler invocation,
+  /// cutting repeated header parsing in consumer full builds. 0 or 1 keeps
+  /// one invocation per unit.
+  size_t unity_batch_size = 0;
+
+  /// Optional runtime profile (function address -> call count). When set,
+  /// functions with at least hot_min_count calls are packed into dedicated
+  /// "hot" units compiled -O3 while the rest get -O1 (see write_cmake).
+  const std::unordered_map<uint32_t, uint64_t>* profile = nullptr;
+  uint64_t hot_min_count = 1;
 };
 
 //=============================================================================
@@ -126,6 +146,32 @@ class RecompilerOutput {
    */
   bool write_all(const std::filesystem::path& output_dir);
 
+  //=========================================================================
+  // Streaming mode
+  //=========================================================================
+  // Alternative to add_function()+write_all(): bodies are written straight
+  // to the current chunk file as functions complete, so only one function's
+  // text is in memory at a time. Addresses and names are still recorded for
+  // the declaration/init files emitted by finish_streaming().
+
+  /**
+   * Begin streaming emission into output_dir.
+   * @return true on success (directory created, config header written)
+   */
+  bool begin_streaming(const std::filesystem::path& output_dir);
+
+  /**
+   * Stream one function's generated code to the current chunk file.
+   * Rotates to a new ppc_recomp.N.cpp every functions_per_file functions.
+   */
+  bool stream_function(guest_addr_t address, const std::string& name,
+                       const std::string& cpp_code);
+
+  /**
+   * Close the last chunk and write the declaration/init/cmake files.
+   */
+  bool finish_streaming();
+
   /**
    * Get list of generated file names (after write_all)
    */
@@ -136,6 +182,20 @@ class RecompilerOutput {
   std::map<guest_addr_t, CompiledFunction> functions_;  // Sorted by address
   const FunctionGraph* graph_ = nullptr;                // For imports (IMPORT authority nodes)
   std::vector<std::string> generated_files_;
+  std::vector<std::string> hot_files_;   // Profile-hot units (compiled -O3)
+  std::vector<std::string> cold_files_;  // Profile-cold units (compiled -O1)
+
+  // Streaming state (active between begin_streaming/finish_streaming)
+  struct StreamState {
+    std::filesystem::path output_dir;
+    std::unique_ptr<FileEmitter> emitter;
+    size_t file_index = 0;
+    size_t functions_in_file = 0;
+  };
+  std::unique_ptr<StreamState> stream_;
+
+  /// Open the next ppc_recomp.N.cpp chunk for streaming
+  bool open_stream_chunk();
 
   // File generators
   bool write_config_h(const std::filesystem::path& dir);
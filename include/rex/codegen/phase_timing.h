@@ -0,0 +1,124 @@
+/**
+ * @file        rex/codegen/phase_timing.h
+ * @brief       Wall-clock accounting for codegen pipeline phases
+ *
+ * @copyright   Copyright (c) 2026 Tom Clay <tomc@tctechstuff.com>
+ *              All rights reserved.
+ *
+ * @license     BSD 3-Clause License
+ *              See LICENSE file in the project root for full license text.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace rex::codegen {
+
+/**
+ * Timing data for one codegen run: one entry per pipeline phase plus the
+ * slowest individually recompiled functions. Filled by Analyze/Recompile,
+ * printed (or dumped as JSON) by the codegen command so regressions can be
+ * pinned to a phase instead of "it got slower".
+ *
+ * recordFunction() is safe to call from parallel emission workers.
+ */
+class PhaseTimings {
+ public:
+  struct Phase {
+    std::string name;
+    double ms = 0.0;
+  };
+
+  struct FunctionTime {
+    uint32_t address = 0;
+    double ms = 0.0;
+    size_t emittedBytes = 0;  ///< Generated C++ bytes; proxy for host compile time
+    uint32_t guestBytes = 0;  ///< Guest code bytes, for the expansion ratio
+  };
+
+  PhaseTimings() = default;
+
+  // Movable so CodegenContext stays movable; the mutex is not moved
+  PhaseTimings(PhaseTimings&& other) noexcept;
+  PhaseTimings& operator=(PhaseTimings&& other) noexcept;
+
+  /// Record a completed phase (phases are reported in recording order)
+  void recordPhase(std::string_view name, double ms);
+
+  /// Record one recompiled function (thread-safe)
+  void recordFunction(uint32_t address, double ms, size_t emittedBytes = 0,
+                      uint32_t guestBytes = 0);
+
+  /// Overall run counters shown in the report header
+  void setCounters(size_t functionCount, size_t instructionCount);
+
+  /// Recorded phases in recording order (for external aggregation)
+  const std::vector<Phase>& phases() const { return phases_; }
+  size_t functionCount() const { return functionCount_; }
+  size_t instructionCount() const { return instructionCount_; }
+
+  /**
+   * Human-readable multi-line report: per-phase table with percentages and
+   * the worst per-function offenders, ranked by recompile time and - when
+   * emission recorded sizes - by emitted C++ bytes.
+   * @param worstFunctionCount How many worst functions to list per ranking
+   */
+  std::string report(size_t worstFunctionCount = 10) const;
+
+  /**
+   * Dump the full dataset (all phases and all function times) as JSON.
+   * @param path Output file path
+   * @return true on success
+   */
+  bool writeJson(const std::filesystem::path& path) const;
+
+  /**
+   * Peak resident set size of this process in KiB, 0 where unavailable.
+   * Monotonic, so querying at report time covers the whole run; included in
+   * both report() and writeJson() so memory regressions are tracked next to
+   * time regressions.
+   */
+  static size_t QueryPeakRssKb();
+
+ private:
+  std::vector<Phase> phases_;
+  std::vector<FunctionTime> functions_;
+  size_t functionCount_ = 0;
+  size_t instructionCount_ = 0;
+  mutable std::mutex mutex_;  // guards functions_ during parallel emission
+};
+
+/**
+ * RAII scope timer: records elapsed wall time into a PhaseTimings entry
+ * when the scope ends.
+ *
+ * Usage:
+ *   { PhaseTimer timer(ctx.timings, "discover"); discoverAllFunctions(ctx); }
+ */
+class PhaseTimer {
+ public:
+  PhaseTimer(PhaseTimings& timings, std::string_view name)
+      : timings_(timings), name_(name), start_(std::chrono::steady_clock::now()) {}
+
+  ~PhaseTimer() {
+    auto elapsed = std::chrono::steady_clock::now() - start_;
+    timings_.recordPhase(name_, std::chrono::duration<double, std::milli>(elapsed).count());
+  }
+
+  PhaseTimer(const PhaseTimer&) = delete;
+  PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+ private:
+  PhaseTimings& timings_;
+  std::string name_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace rex::codegen
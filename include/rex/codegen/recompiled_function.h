@@ -27,6 +27,11 @@ namespace rex::codegen {
 // Forward declarations
 struct CodeRegion;
 class BinaryView;
+class DecodedBinary;
+
+namespace ppc {
+struct Instruction;
+}
 
 // FunctionAuthority is defined in function_graph.h
 
@@ -105,6 +110,13 @@ class FunctionScanner {
   template <typename T>
   const T* translate_address(rex::guest_addr_t guest_addr) const;
 
+  // Attach the pre-decoded binary so scans reuse cached decodes (optional)
+  void setDecodedBinary(const DecodedBinary* decoded) { decoded_ = decoded; }
+
+  // Decode the instruction at an address: O(1) cache lookup when a
+  // DecodedBinary is attached, fresh decode otherwise
+  ppc::Instruction decode_at(rex::guest_addr_t address, rex::u32 code) const;
+
   // Check if address is in an executable section
   bool isExecutableSection(rex::guest_addr_t address) const;
 
@@ -192,6 +204,7 @@ class FunctionScanner {
 
  private:
   const BinaryView* binary_ = nullptr;
+  const DecodedBinary* decoded_ = nullptr;  // Optional decode cache (not owned)
   std::unordered_set<uint32_t> known_switch_tables_;
   std::unordered_map<uint32_t, FunctionConfig> chunks_;
   std::unordered_set<uint32_t> bl_targets_;
@@ -14,6 +14,9 @@
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <fmt/core.h>
@@ -64,6 +67,57 @@ struct RecompilerLocalVariables {
 
 enum class CSRState { Unknown, FPU, VMX };
 
+/**
+ * Per-function record of the CSR states flowing into labels.
+ *
+ * A label normally resets the tracked flush mode to Unknown because anything
+ * could jump there. When every incoming edge is a forward branch whose
+ * emission recorded the same state, the label can keep that state instead and
+ * the FP/VMX instructions after it skip the redundant mode check. Backward
+ * branches, jump tables and mid-asm hook jumps land with arbitrary state, so
+ * their targets are marked unsafe during the label scan and always reset.
+ */
+struct CSRLabelStates {
+  /// Labels that must reset to Unknown: backward-branch targets, jump-table
+  /// entries, mid-asm hook jumps and PIC-style bl landing sites.
+  std::unordered_set<size_t> unsafe;
+
+  /// Forward branches to each label, counted during the label scan.
+  std::unordered_map<size_t, uint32_t> expectedEdges;
+
+  /// Meet of the states recorded at emitted branches to each label, paired
+  /// with how many branches recorded one.
+  std::unordered_map<size_t, std::pair<CSRState, uint32_t>> recorded;
+
+  /// Record the state a branch to target was emitted with.
+  void recordEdge(size_t target, CSRState state) {
+    auto [it, inserted] = recorded.try_emplace(target, state, 0u);
+    if (!inserted && it->second.first != state)
+      it->second.first = CSRState::Unknown;
+    ++it->second.second;
+  }
+
+  /**
+   * State the label can assume when it is emitted. Known only when the label
+   * is safe, every counted edge was already emitted with an agreeing state,
+   * and the fall-through path agrees too; Unknown otherwise. The edge count
+   * check also catches counted branches that were emitted as calls instead of
+   * gotos, or skipped entirely with their block.
+   */
+  CSRState stateAtLabel(size_t label, CSRState fallthrough) const {
+    if (unsafe.contains(label))
+      return CSRState::Unknown;
+
+    auto expected = expectedEdges.find(label);
+    auto seen = recorded.find(label);
+    if (expected == expectedEdges.end() || seen == recorded.end() ||
+        seen->second.second != expected->second || seen->second.first != fallthrough)
+      return CSRState::Unknown;
+
+    return seen->second.first;
+  }
+};
+
 struct Recompiler {
   // Enforce In-order Execution of I/O constant for quick comparison
   // TODO: this shouldn't be here... find a new place for this EIEIO constant
@@ -80,6 +134,11 @@ struct Recompiler {
   // Track if validation failed during Analyze()
   bool validationFailed_ = false;
 
+  // Worker override for config().switchTables. Parallel emission gives each
+  // worker a private copy so late jump-table detection never mutates shared
+  // state mid-run; null means operate directly on the config map.
+  std::unordered_map<uint32_t, JumpTable>* activeSwitchTables_ = nullptr;
+
   Recompiler();
   ~Recompiler();
 
@@ -99,7 +158,49 @@ struct Recompiler {
   /// Recompile a single instruction (internal).
   bool recompile(const FunctionNode& fn, uint32_t base, const ppc_insn& insn, const uint32_t* data,
                  std::unordered_map<uint32_t, JumpTable>::iterator& switchTable,
-                 RecompilerLocalVariables& localVariables, CSRState& csrState);
+                 RecompilerLocalVariables& localVariables, CSRState& csrState,
+                 CSRLabelStates& csrLabels);
+
+  /**
+   * Try to fold a lis+addi / lis+ori constant materialization pair into a
+   * single emitted assignment. Only fires when the second instruction cannot
+   * be entered on its own (no label, mid-asm hook, or block boundary there).
+   * @return true if the pair was folded and the caller should skip both
+   *         instructions
+   */
+  bool tryFoldImmediatePair(uint32_t base, uint32_t end, const ppc_insn& lis, const uint32_t* data,
+                            const std::unordered_set<size_t>& labels,
+                            RecompilerLocalVariables& localVariables);
+
+  /**
+   * Try to fold a load/store pair that moves a value through guest memory
+   * untouched into a raw PPC_COPY_* move, skipping the swap/unswap round
+   * trip. Only fires when the following instruction overwrites the loaded
+   * register, so its architectural (byte-swapped) value is never observed.
+   * @return true if the pair was folded and the caller should skip both
+   *         instructions
+   */
+  bool tryFoldLoadStoreCopy(uint32_t base, uint32_t end, const ppc_insn& load,
+                            const uint32_t* data, const std::unordered_set<size_t>& labels,
+                            RecompilerLocalVariables& localVariables);
+
+  /**
+   * Try to fuse an integer compare with the conditional branch that follows
+   * it into a single host compare-and-jump, skipping the four CR field bit
+   * assignments. Only fires when analysis proved every reader of the field
+   * sits directly after its own producer (see analyzeCrFieldConsumption) and
+   * the branch cannot be entered on its own.
+   * @return true if the pair was fused and the caller should skip both
+   *         instructions
+   */
+  bool tryFoldCompareBranch(const FunctionNode& fn, uint32_t base, uint32_t end,
+                            const ppc_insn& cmp, const uint32_t* data,
+                            const std::unordered_set<size_t>& labels,
+                            RecompilerLocalVariables& localVariables, CSRState& csrState,
+                            CSRLabelStates& csrLabels);
+
+  /// Format a GPR reference, honoring the registers-as-locals options.
+  std::string gprName(size_t index, RecompilerLocalVariables& localVariables);
 
   /// Recompile an entire function (internal).
   bool recompile(const FunctionNode& fn);
@@ -130,6 +231,23 @@ struct Recompiler {
   const RecompilerConfig& config() const { return ctx_->Config(); }
   AnalysisState& analysisState() { return ctx_->analysisState(); }
   const AnalysisState& analysisState() const { return ctx_->analysisState(); }
+  std::unordered_map<uint32_t, JumpTable>& switchTables() {
+    return activeSwitchTables_ ? *activeSwitchTables_ : config().switchTables;
+  }
+
+  /// Emit one size-balanced chunk of functions into `out` (worker entry point).
+  void recompileChunk(const std::vector<const FunctionNode*>& functions, size_t first, size_t last);
+
+  /// Hash of every codegen option that influences emitted function bodies.
+  uint64_t emissionConfigHash() const;
+
+  /// Hash of the raw PPC bytes of a chunk's functions, seeded with the config hash.
+  uint64_t chunkInputHash(const std::vector<const FunctionNode*>& functions, size_t first,
+                          size_t last, uint64_t configHash) const;
+
+  /// Load/store the per-chunk hash manifest used by incremental recompilation.
+  std::unordered_map<size_t, uint64_t> LoadChunkManifest() const;
+  void SaveChunkManifest(const std::unordered_map<size_t, uint64_t>& hashes) const;
 };
 
 }  // namespace codegen
@@ -0,0 +1,65 @@
+/**
+ * @file        rex/codegen/string_interner.h
+ * @brief       Arena-backed string interner handing out stable string_views
+ *
+ * @copyright   Copyright (c) 2026 Tom Clay <tomc@tctechstuff.com>
+ *              All rights reserved.
+ *
+ * @license     BSD 3-Clause License
+ *              See LICENSE file in the project root for full license text.
+ */
+
+#pragma once
+
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <unordered_set>
+
+#include <rex/memory/arena.h>
+
+namespace rex::codegen {
+
+//=============================================================================
+// String Interner
+//=============================================================================
+// Deduplicating store for symbol names. Each distinct string is copied into
+// the arena exactly once; all later interns of equal content return the same
+// string_view, so names can be compared by data pointer and held by nodes
+// without per-node std::string allocations. Views stay valid for the lifetime
+// of the interner (the arena only grows, never relocates).
+
+class StringInterner {
+ public:
+  StringInterner() : arena_(std::make_unique<rex::memory::Arena>(64 * 1024)) {}
+
+  // Movable but not copyable - handed-out views stay valid across moves
+  // because the arena's chunks live on the heap and move with it
+  StringInterner(StringInterner&&) = default;
+  StringInterner& operator=(StringInterner&&) = default;
+  StringInterner(const StringInterner&) = delete;
+  StringInterner& operator=(const StringInterner&) = delete;
+
+  // Return the canonical copy of str, copying it into the arena on first use.
+  // Equal inputs always return views with identical data pointers.
+  std::string_view intern(std::string_view str) {
+    if (str.empty())
+      return {};
+    auto it = interned_.find(str);
+    if (it != interned_.end())
+      return *it;
+    char* storage = reinterpret_cast<char*>(arena_->Alloc(str.size(), 1));
+    std::memcpy(storage, str.data(), str.size());
+    std::string_view canonical(storage, str.size());
+    interned_.insert(canonical);
+    return canonical;
+  }
+
+  size_t size() const { return interned_.size(); }
+
+ private:
+  std::unique_ptr<rex::memory::Arena> arena_;
+  std::unordered_set<std::string_view> interned_;
+};
+
+}  // namespace rex::codegen
@@ -15,4 +15,12 @@ namespace rex::crypto {
 std::string sha256(std::string_view data);
 std::string sha256_file(const std::filesystem::path& path);
 
+// Whether the hardware SHA-256 block function below is available (x86 SHA-NI
+// or the ARMv8 SHA-2 extensions, reported by the CPU at runtime).
+bool sha256_hardware_supported();
+// Runs `block_count` whole 64-byte message blocks through the hardware
+// compression function. `state` is the 8 working variables in host order. May
+// be called only when sha256_hardware_supported() returns true.
+void sha256_process_blocks(uint32_t state[8], const uint8_t* data, size_t block_count);
+
 }  // namespace rex::crypto
@@ -175,6 +175,11 @@ void RegisterChangeCallback(std::string_view name, ChangeCallback callback);
 /// Unregister all callbacks for a specific CVAR
 void UnregisterChangeCallbacks(std::string_view name);
 
+/// Monotonic counter bumped on every successful cvar modification. Consumers
+/// that derive cached state from cvar values (config snapshots, UI models)
+/// can compare epochs to skip rebuilding when nothing has changed.
+uint64_t ModificationEpoch();
+
 struct FlagRegistrar {
   FlagEntry* entry_ptr = nullptr;
 
@@ -531,4 +531,33 @@ class ExceptionHandler {
   static void Uninstall(Handler fn, void* data);
 };
 
+//=============================================================================
+// Dispatch Cache (internal)
+//=============================================================================
+
+// Faulting-PC-keyed direct-dispatch cache shared by the platform exception
+// handler backends. Repeat faults overwhelmingly come from the same few host
+// instructions (MMIO loads/stores, write-watched stores), so the backends
+// probe this cache and try the handler that resolved the PC last time before
+// walking the full handler chain.
+//
+// Entries are single-word relaxed atomics: a stale or colliding entry just
+// makes the wrong handler decline once before the chain walk corrects it, so
+// no ordering is needed and the cache is safe to touch from the handler
+// itself. Backends must invalidate it whenever the handler table changes so a
+// cached slot can never dispatch into a removed handler.
+
+// Returned by LookupHandlerCache when no handler is cached for the PC.
+constexpr size_t kHandlerCacheMiss = ~size_t(0);
+
+// Returns the handler slot index cached for the faulting PC, or
+// kHandlerCacheMiss.
+size_t LookupHandlerCache(uint64_t pc);
+
+// Records that the handler in slot handler_index handled a fault at pc.
+void UpdateHandlerCache(uint64_t pc, size_t handler_index);
+
+// Drops all cached entries. Call when installing or uninstalling a handler.
+void InvalidateHandlerCache();
+
 }  // namespace rex::arch
@@ -11,14 +11,17 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <rex/filesystem.h>
 #include <rex/filesystem/wildcard.h>
 #include <rex/memory/mapped_memory.h>
 #include <rex/string/buffer.h>
+#include <rex/string/key.h>
 #include <rex/system/xtypes.h>
 #include <rex/thread/mutex.h>
 
@@ -106,6 +109,29 @@ class Entry {
   bool Delete();
   void Touch();
 
+  // Refreshes the cached file information (size, timestamps) through update()
+  // only if a mutation has been observed since the last refresh, so repeated
+  // NtQueryInformationFile-style queries on an unchanged file are plain
+  // member reads instead of host stat calls.
+  void RefreshInfo();
+  // Marks the cached file information stale. Write paths call this since
+  // guest writes can extend a file behind the entry's back.
+  void MarkInfoDirty() { info_dirty_.store(true, std::memory_order_release); }
+
+  // File-info cache effectiveness across all entries - lets us show titles
+  // how often they re-query files nothing has touched.
+  static uint64_t info_cache_hits() { return info_cache_hits_.load(std::memory_order_relaxed); }
+  static uint64_t info_cache_misses() {
+    return info_cache_misses_.load(std::memory_order_relaxed);
+  }
+
+  // Incremented on every structural mutation of any entry tree (create or
+  // delete). Lets callers caching resolved entries detect staleness without
+  // walking the tree.
+  static uint64_t tree_generation() {
+    return tree_generation_.load(std::memory_order_relaxed);
+  }
+
   // If successful, out_file points to a new file. When finished, call
   // file->Destroy()
   virtual X_STATUS Open(uint32_t desired_access, File** out_file) = 0;
@@ -147,6 +173,25 @@ class Entry {
   uint64_t access_timestamp_;
   uint64_t write_timestamp_;
   std::vector<std::unique_ptr<Entry>> children_;
+
+ private:
+  // Rebuilds child_index_ from children_. Call with the global lock held.
+  void RebuildChildIndex();
+
+  static std::atomic<uint64_t> tree_generation_;
+  static std::atomic<uint64_t> info_cache_hits_;
+  static std::atomic<uint64_t> info_cache_misses_;
+
+  // Starts dirty so the first RefreshInfo after mounting pulls fresh values.
+  std::atomic<bool> info_dirty_{true};
+
+  // Case-insensitive name -> child index backing GetChild. Devices push into
+  // children_ directly while mounting, so the index is rebuilt lazily
+  // whenever the list size no longer matches child_index_size_ (the size the
+  // index was last built at, or SIZE_MAX when explicitly invalidated). Keys
+  // are views into the child name strings, which are immutable.
+  std::unordered_map<rex::string::string_key_case, Entry*> child_index_;
+  size_t child_index_size_;
 };
 
 }  // namespace rex::filesystem
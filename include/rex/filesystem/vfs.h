@@ -11,14 +11,19 @@
 
 #pragma once
 
+#include <atomic>
+#include <filesystem>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
 #include <rex/filesystem/device.h>
 #include <rex/filesystem/entry.h>
 #include <rex/filesystem/file.h>
+#include <rex/string/key.h>
 #include <rex/thread/mutex.h>
 
 namespace rex::filesystem {
@@ -45,11 +50,41 @@ class VirtualFileSystem {
                     bool is_directory, bool is_non_directory, File** out_file,
                     FileAction* out_action);
 
+  // Guest file-access tracing (vfs_access_trace cvar). While enabled, reads
+  // issued by the guest are recorded as (path, offset, length) and written to
+  // trace_file when tracing stops; if trace_file already holds a previous
+  // run's records, a background thread replays them as readahead hints to
+  // warm the host page cache ahead of the guest.
+  void StartAccessTrace(const std::filesystem::path& trace_file);
+  void StopAccessTrace();
+  void RecordAccess(const std::string_view path, uint64_t offset, uint32_t length);
+
  private:
   rex::thread::global_critical_region global_critical_region_;
   std::vector<std::unique_ptr<Device>> devices_;
   std::unordered_map<std::string, std::string> symlinks_;
 
+  // Caches successful full-path resolutions (as requested, pre-normalization)
+  // so the repeated lookups issued by guest I/O skip the symlink and tree
+  // walks. Dropped wholesale when the entry tree generation moves or when the
+  // device/symlink tables change.
+  std::unordered_map<rex::string::string_key_case, Entry*> resolved_path_cache_;
+  uint64_t resolved_path_cache_generation_ = 0;
+
+  struct AccessRecord {
+    std::string path;
+    uint64_t offset;
+    uint32_t length;
+  };
+  static std::vector<AccessRecord> LoadAccessTrace(const std::filesystem::path& trace_file);
+  void ReplayAccessTrace(std::stop_token stop, std::vector<AccessRecord> records);
+
+  std::atomic<bool> access_trace_enabled_{false};
+  std::mutex access_trace_mutex_;
+  std::filesystem::path access_trace_file_;
+  std::vector<AccessRecord> access_trace_;
+  std::jthread prefetch_thread_;
+
   bool ResolveSymbolicLink(const std::string_view path, std::string& result);
 };
 
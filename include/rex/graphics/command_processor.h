@@ -127,6 +127,22 @@ class CommandProcessor {
 
   void ExecutePacket(uint32_t ptr, uint32_t count);
 
+  // Milliseconds spent in each phase on the command processor thread between
+  // two swaps (gpu_frame_phase_stats). Not GPU execution time - the host
+  // command list is built and submitted on this thread, so this is where the
+  // emulator itself spends the frame.
+  struct FramePhaseTiming {
+    float draw_ms;
+    float resolve_ms;
+    float swap_ms;
+    // Remaining PM4 processing - register writes, constant uploads, fetches.
+    float other_ms;
+  };
+  static constexpr size_t kFramePhaseHistorySize = 120;
+  // Returns up to kFramePhaseHistorySize most recently completed frames,
+  // oldest first. Thread-safe, may be called from the UI thread.
+  std::vector<FramePhaseTiming> GetFramePhaseTimings() const;
+
   bool is_paused() const { return paused_; }
   void Pause();
   void Resume();
@@ -148,6 +164,19 @@ class CommandProcessor {
   virtual void ShutdownContext() = 0;
 
   virtual void WriteRegister(uint32_t index, uint32_t value);
+  // Writes a contiguous range of registers from a host-endian array. Ranges
+  // containing no registers with side effects on write are applied with a
+  // single memcpy, and the backends are notified about the whole range at once
+  // via OnRegisterRangeWritten instead of once per register.
+  void WriteRegisterRange(uint32_t first_index, const uint32_t* values, uint32_t count);
+  // Reads count big-endian values from the ring buffer and writes them as a
+  // register range starting at first_index.
+  void WriteRegisterRangeFromRing(memory::RingBuffer* reader, uint32_t first_index,
+                                  uint32_t count);
+  // Called for ranges applied by WriteRegisterRange without per-register
+  // WriteRegister calls, so the backends can invalidate derived state (such as
+  // constant buffer bindings) with range granularity.
+  virtual void OnRegisterRangeWritten(uint32_t first_index, uint32_t count) {}
 
   const reg::DC_LUT_30_COLOR* gamma_ramp_256_entry_table() const {
     return gamma_ramp_256_entry_table_;
@@ -160,10 +189,23 @@ class CommandProcessor {
   virtual void PrepareForWait();
   virtual void ReturnFromWait();
 
+  // A PM4 packet header scanned ahead of execution. Packet boundaries only
+  // depend on the header, so a whole ring segment can be decoded into a flat
+  // array before any packet runs.
+  struct DecodedPacket {
+    uint32_t packet;  // Raw (swapped) header dword.
+    uint32_t type;    // packet >> 30.
+    uint32_t opcode;  // Type-3 opcode; 0 for other types.
+    uint32_t count;   // Payload dwords following the header.
+  };
+
   uint32_t ExecutePrimaryBuffer(uint32_t start_index, uint32_t end_index);
   virtual void OnPrimaryBufferEnd() {}
   void ExecuteIndirectBuffer(uint32_t ptr, uint32_t length);
-  bool ExecutePacket(memory::RingBuffer* reader);
+  bool ExecutePacketBatch(memory::RingBuffer* reader);
+  void DecodePacketBatch(memory::RingBuffer reader, std::vector<DecodedPacket>* decoded);
+  bool ExecutePacket(memory::RingBuffer* reader, const DecodedPacket& decoded);
+  void LogPacketStats();
   bool ExecutePacketType0(memory::RingBuffer* reader, uint32_t packet);
   bool ExecutePacketType1(memory::RingBuffer* reader, uint32_t packet);
   bool ExecutePacketType2(memory::RingBuffer* reader, uint32_t packet);
@@ -232,6 +274,9 @@ class CommandProcessor {
   TraceState trace_state_ = TraceState::kDisabled;
   std::filesystem::path trace_stream_path_;
   std::filesystem::path trace_frame_path_;
+  // Frames written to a streamed trace since the last full state snapshot,
+  // for periodic keyframe emission.
+  uint32_t trace_stream_frames_since_keyframe_ = 0;
 
   std::atomic<bool> worker_running_;
   system::object_ref<system::XHostThread> worker_thread_;
@@ -252,6 +297,9 @@ class CommandProcessor {
 
   std::unique_ptr<rex::thread::Event> write_ptr_index_event_;
   std::atomic<uint32_t> write_ptr_index_;
+  // True only while the worker is parked on write_ptr_index_event_;
+  // UpdateWritePointer skips the event entirely otherwise.
+  std::atomic<bool> write_ptr_index_parked_{false};
 
   uint64_t bin_select_ = 0xFFFFFFFFull;
   uint64_t bin_mask_ = 0xFFFFFFFFull;
@@ -259,6 +307,42 @@ class CommandProcessor {
   Shader* active_vertex_shader_ = nullptr;
   Shader* active_pixel_shader_ = nullptr;
 
+  // One decode buffer per indirect-buffer nesting level, so a nested batch
+  // does not clobber the segment that dispatched it. Capacity is reused
+  // across segments.
+  std::vector<std::vector<DecodedPacket>> decode_buffers_;
+  size_t batch_depth_ = 0;
+
+  // Scratch for swapping register bursts out of the ring or guest memory
+  // before a range write (persistently allocated).
+  std::vector<uint32_t> burst_registers_;
+
+  // Per-packet-type cycle accounting (gpu_packet_stats). Types 0-2 are
+  // indexed by type, type-3 opcodes at [4 + opcode]; index 3 is unused.
+  struct PacketStat {
+    uint64_t packets = 0;
+    uint64_t ticks = 0;
+  };
+  PacketStat packet_stats_[4 + 0x80] = {};
+  uint32_t packet_stats_last_counter_ = 0;
+
+  // Converts the phase tick accumulators of the frame that just ended into a
+  // FramePhaseTiming history entry and resets them for the next frame.
+  void CompleteFramePhaseTiming();
+
+  // Phase accumulators for the frame currently being recorded, in host ticks
+  // (gpu_frame_phase_stats). Written only on the worker thread; the completed
+  // frame history is protected with frame_phase_mutex_ as the UI thread reads
+  // it through GetFramePhaseTimings.
+  uint64_t frame_phase_draw_ticks_ = 0;
+  uint64_t frame_phase_resolve_ticks_ = 0;
+  uint64_t frame_phase_swap_ticks_ = 0;
+  uint64_t frame_phase_busy_ticks_ = 0;
+  FramePhaseTiming frame_phase_history_[kFramePhaseHistorySize] = {};
+  size_t frame_phase_history_next_ = 0;
+  size_t frame_phase_history_count_ = 0;
+  mutable std::mutex frame_phase_mutex_;
+
   bool paused_ = false;
 
   // By default (such as for tools), post-processing is disabled.
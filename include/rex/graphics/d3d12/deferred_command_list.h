@@ -528,8 +528,12 @@ class DeferredCommandList {
 
   const D3D12CommandProcessor& command_processor_;
 
-  // uintmax_t to ensure uint64_t and pointer alignment of all structures.
+  // uintmax_t to ensure uint64_t and pointer alignment of all structures. The
+  // vector is kept at its high-water size across Reset, with
+  // command_stream_used_ tracking how much of it the current recording has
+  // actually written.
   std::vector<uintmax_t> command_stream_;
+  size_t command_stream_used_ = 0;
 };
 
 }  // namespace rex::graphics::d3d12
@@ -41,6 +41,12 @@ class D3D12SharedMemory : public SharedMemory {
 
   void CompletedSubmissionUpdated();
   void BeginSubmission();
+  // Issues all tile mappings queued by AllocateSparseHostGpuMemoryRange in
+  // one burst. Must be called before ExecuteCommandLists of any submission
+  // that may touch the newly allocated ranges - tile mapping updates and
+  // command list execution are ordered on the same queue, so flushing at
+  // submission end is sufficient.
+  void FlushPendingTileMappings();
 
   // RequestRange may transition the buffer to copy destination - call it before
   // UseForReading or UseForWriting.
@@ -95,6 +101,16 @@ class D3D12SharedMemory : public SharedMemory {
   ID3D12Resource* buffer_ = nullptr;
   D3D12_GPU_VIRTUAL_ADDRESS buffer_gpu_address_ = 0;
   std::vector<ID3D12Heap*> buffer_tiled_heaps_;
+  // Heaps created by AllocateSparseHostGpuMemoryRange whose tile mappings are
+  // not on the queue yet - streaming used to produce one UpdateTileMappings
+  // call per touched range mid-recording; these are batched and issued
+  // together by FlushPendingTileMappings at submission end instead.
+  struct PendingTileMapping {
+    uint32_t offset_bytes;
+    uint32_t length_bytes;
+    ID3D12Heap* heap;
+  };
+  std::vector<PendingTileMapping> buffer_pending_tile_mappings_;
   D3D12_RESOURCE_STATES buffer_state_ = D3D12_RESOURCE_STATE_COPY_DEST;
   bool buffer_uav_writes_commit_needed_ = false;
   void CommitUAVWritesAndTransitionBuffer(D3D12_RESOURCE_STATES new_state);
@@ -109,8 +109,13 @@ class D3D12TextureCache final : public TextureCache {
   void WriteActiveTextureSRVKeys(TextureSRVKey* keys,
                                  const D3D12Shader::TextureBinding* host_shader_bindings,
                                  size_t host_shader_binding_count) const;
-  void WriteActiveTextureBindfulSRV(const D3D12Shader::TextureBinding& host_shader_binding,
-                                    D3D12_CPU_DESCRIPTOR_HANDLE handle);
+  // Writes the SRVs for host_shader_binding_count bindings to consecutive
+  // slots starting at handle_start with a single CopyDescriptors call rather
+  // than one copy per binding - descriptor copies into the shader-visible heap
+  // are a major CPU cost of bindful drawing.
+  void WriteActiveTextureBindfulSRVs(const D3D12Shader::TextureBinding* host_shader_bindings,
+                                     size_t host_shader_binding_count,
+                                     D3D12_CPU_DESCRIPTOR_HANDLE handle_start);
   uint32_t GetActiveTextureBindlessSRVIndex(const D3D12Shader::TextureBinding& host_shader_binding);
 
   SamplerParameters GetSamplerParameters(const D3D12Shader::SamplerBinding& binding) const;
@@ -459,6 +464,10 @@ class D3D12TextureCache final : public TextureCache {
   Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> null_srv_descriptor_heap_;
   D3D12_CPU_DESCRIPTOR_HANDLE null_srv_descriptor_heap_start_;
 
+  // Temporary storage for WriteActiveTextureBindfulSRVs, persistently
+  // allocated.
+  std::vector<D3D12_CPU_DESCRIPTOR_HANDLE> bindful_srv_copy_source_handles_;
+
   std::array<D3D12TextureBinding, xenos::kTextureFetchConstantCount> d3d12_texture_bindings_;
 
   // Unsupported texture formats used during this frame (for research and
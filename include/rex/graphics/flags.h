@@ -21,6 +21,7 @@ REXCVAR_DECLARE(int32_t, draw_resolution_scale_x);
 REXCVAR_DECLARE(int32_t, draw_resolution_scale_y);
 REXCVAR_DECLARE(bool, resolve_resolution_scale_fill_half_pixel_offset);
 REXCVAR_DECLARE(bool, draw_resolution_scaled_texture_offsets);
+REXCVAR_DECLARE(int32_t, gpu_max_queued_frames);
 
 // GPU Depth
 REXCVAR_DECLARE(bool, depth_float24_round);
@@ -74,6 +74,9 @@ class GraphicsSystem : public system::IGraphicsSystem {
 
   virtual void SetInterruptCallback(uint32_t callback, uint32_t user_data);
   void DispatchInterruptCallback(uint32_t source, uint32_t cpu);
+  // Delivers the interrupt to every CPU set in cpu_mask under one batched
+  // context transition (see Processor::InterruptBatch).
+  void DispatchInterruptCallbackBatch(uint32_t source, uint32_t cpu_mask);
 
   virtual void ClearCaches();
 
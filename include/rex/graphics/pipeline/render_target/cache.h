@@ -618,7 +618,7 @@ class RenderTargetCache {
         // or by a depth render target of a different format.
         return false;
       }
-      if (host_depth_encoding_different && !key.is_depth &&
+      if (host_depth_encoding_different &&
           GetHostDepthRenderTarget(key.GetDepthFormat()) != key) {
         // Depth encoding is the same, but different addressing is needed.
         return false;
@@ -653,7 +653,12 @@ class RenderTargetCache {
                                             uint32_t start_tiles_base_relative,
                                             uint32_t length_tiles) const;
   // Updates ownership_ranges_, adds the transfers needed for the ownership
-  // change to transfers_append_out if it's not null.
+  // change to transfers_append_out if it's not null. resolve_clear_cutout is
+  // the clear-tracking part of resolve clears: transfers that would only
+  // restore tile contents entirely within the rectangle about to be cleared
+  // are dropped (and partially covered ones are split around it in
+  // Transfer::GetRangeRectangles), so a cleared region never pays for loading
+  // data that the backend's fast clear path is about to overwrite anyway.
   void ChangeOwnership(RenderTargetKey dest, uint32_t start_tiles_base_relative,
                        uint32_t length_tiles, std::vector<Transfer>* transfers_append_out,
                        const Transfer::Rectangle* resolve_clear_cutout = nullptr);
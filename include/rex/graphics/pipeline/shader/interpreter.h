@@ -131,6 +131,11 @@ class ShaderInterpreter {
   xenos::ShaderType shader_type_ = xenos::ShaderType::kVertex;
   const uint32_t* ucode_ = nullptr;
 
+  // Float constant window of the current shader type, decoded from
+  // SQ_VS_CONST / SQ_PS_CONST once per Execute.
+  uint32_t float_constant_base_ = 0;
+  uint32_t float_constant_size_minus_1_ = 0;
+
   // For both inputs and locals.
   float temp_registers_[xenos::kMaxShaderTempRegisters][4];
 
@@ -758,6 +758,53 @@ class Shader {
     uint8_t eM_potentially_written_by_exec = 0;
   };
 
+  // Reference to one control flow instruction parsed during the ucode
+  // analysis, so translations can be done without decoding the microcode
+  // again. One entry per control flow instruction slot, in execution listing
+  // order (2 * cf_pair_index_bound()).
+  struct ParsedControlFlowRef {
+    enum class Kind : uint8_t {
+      // cnop - reported to the backend, but carries no operands.
+      kNop,
+      // exec and all of its conditional/predicated/ending variants.
+      kExec,
+      kLoopStart,
+      kLoopEnd,
+      kCall,
+      kReturn,
+      kJump,
+      kAlloc,
+      // Nothing for the backend to translate (kMarkVsFetchDone).
+      kNone,
+    };
+    Kind kind = Kind::kNone;
+    // Index into the parsed instruction vector for the kind (parsed_execs()
+    // for kExec, parsed_loop_starts() for kLoopStart, and so on). Unused for
+    // kNop and kNone.
+    uint32_t index = 0;
+  };
+
+  // Reference to one ALU or fetch instruction within an exec sequence body.
+  struct ParsedExecBodyRef {
+    enum class Kind : uint8_t {
+      kAlu,
+      kVertexFetch,
+      kTextureFetch,
+    };
+    Kind kind = Kind::kAlu;
+    // Index into parsed_alu_instructions(), parsed_vertex_fetch_instructions()
+    // or parsed_texture_fetch_instructions() depending on the kind.
+    uint32_t index = 0;
+  };
+
+  // An exec control flow instruction along with the range of its ALU/fetch
+  // instruction references in parsed_exec_body().
+  struct ParsedExecBlock {
+    ParsedExecInstruction instr;
+    uint32_t body_first = 0;
+    uint32_t body_count = 0;
+  };
+
   class Translation {
    public:
     virtual ~Translation() {}
@@ -878,6 +925,37 @@ class Shader {
   // (each corresponds to 3 dwords).
   uint32_t cf_pair_index_bound() const { return cf_pair_index_bound_; }
 
+  // Instructions parsed during the ucode analysis, for translating the shader
+  // (possibly multiple times, by multiple backends) without decoding the
+  // microcode again. parsed_cf_instructions() is the control flow program in
+  // execution listing order, with each entry referencing the per-kind vectors
+  // below, and exec entries additionally referencing a range of ALU/fetch
+  // instructions in parsed_exec_body().
+  const std::vector<ParsedControlFlowRef>& parsed_cf_instructions() const {
+    return parsed_cf_instructions_;
+  }
+  const std::vector<ParsedExecBlock>& parsed_execs() const { return parsed_execs_; }
+  const std::vector<ParsedLoopStartInstruction>& parsed_loop_starts() const {
+    return parsed_loop_starts_;
+  }
+  const std::vector<ParsedLoopEndInstruction>& parsed_loop_ends() const {
+    return parsed_loop_ends_;
+  }
+  const std::vector<ParsedCallInstruction>& parsed_calls() const { return parsed_calls_; }
+  const std::vector<ParsedReturnInstruction>& parsed_returns() const { return parsed_returns_; }
+  const std::vector<ParsedJumpInstruction>& parsed_jumps() const { return parsed_jumps_; }
+  const std::vector<ParsedAllocInstruction>& parsed_allocs() const { return parsed_allocs_; }
+  const std::vector<ParsedExecBodyRef>& parsed_exec_body() const { return parsed_exec_body_; }
+  const std::vector<ParsedAluInstruction>& parsed_alu_instructions() const {
+    return parsed_alu_instructions_;
+  }
+  const std::vector<ParsedVertexFetchInstruction>& parsed_vertex_fetch_instructions() const {
+    return parsed_vertex_fetch_instructions_;
+  }
+  const std::vector<ParsedTextureFetchInstruction>& parsed_texture_fetch_instructions() const {
+    return parsed_texture_fetch_instructions_;
+  }
+
   // Upper bound of temporary registers addressed statically by the shader -
   // highest static register address + 1, or 0 if no registers referenced this
   // way. SQ_PROGRAM_CNTL is not always reliable - some draws (like single point
@@ -1008,6 +1086,20 @@ class Shader {
   ConstantRegisterMap constant_register_map_ = {0};
   std::set<uint32_t> label_addresses_;
   uint32_t cf_pair_index_bound_ = 0;
+
+  // Instruction stream parsed by AnalyzeUcode for replaying by the translator.
+  std::vector<ParsedControlFlowRef> parsed_cf_instructions_;
+  std::vector<ParsedExecBlock> parsed_execs_;
+  std::vector<ParsedLoopStartInstruction> parsed_loop_starts_;
+  std::vector<ParsedLoopEndInstruction> parsed_loop_ends_;
+  std::vector<ParsedCallInstruction> parsed_calls_;
+  std::vector<ParsedReturnInstruction> parsed_returns_;
+  std::vector<ParsedJumpInstruction> parsed_jumps_;
+  std::vector<ParsedAllocInstruction> parsed_allocs_;
+  std::vector<ParsedExecBodyRef> parsed_exec_body_;
+  std::vector<ParsedAluInstruction> parsed_alu_instructions_;
+  std::vector<ParsedVertexFetchInstruction> parsed_vertex_fetch_instructions_;
+  std::vector<ParsedTextureFetchInstruction> parsed_texture_fetch_instructions_;
   uint32_t register_static_address_bound_ = 0;
   uint32_t writes_interpolators_ = 0;
   uint32_t writes_point_size_edge_flag_kill_vertex_ = 0;
@@ -82,10 +82,6 @@ class ShaderTranslator {
     translation.host_disassembly_ = std::move(value);
   }
 
-  // Pre-process a control-flow instruction before anything else.
-  virtual void PreProcessControlFlowInstructions(
-      std::vector<ucode::ControlFlowInstruction> instrs) {}
-
   // Handles translation for control flow label addresses.
   // This is triggered once for each label required (due to control flow
   // operations) before any of the instructions within the target exec.
@@ -131,8 +127,8 @@ class ShaderTranslator {
                                      uint8_t memexport_eM_potentially_written_before) {}
 
  private:
-  void TranslateControlFlowInstruction(const ucode::ControlFlowInstruction& cf);
-  void TranslateExecInstructions(const ParsedExecInstruction& instr);
+  void TranslateControlFlowInstruction(const Shader::ParsedControlFlowRef& cf);
+  void TranslateExecInstructions(const Shader::ParsedExecBlock& block);
 
   // Current shader and modification being translated.
   Shader::Translation* translation_ = nullptr;
@@ -145,9 +141,6 @@ class ShaderTranslator {
 
   // Current control flow dword index.
   uint32_t cf_index_ = 0;
-
-  // Kept for supporting vfetch_mini.
-  ucode::VertexFetchInstruction previous_vfetch_full_;
 };
 
 }  // namespace rex::graphics
@@ -11,7 +11,6 @@
  */
 
 #include <cstring>
-#include <functional>
 #include <memory>
 
 #include <rex/assert.h>
@@ -20,13 +19,22 @@
 
 namespace rex::graphics::texture_conversion {
 
-typedef std::function<void(xenos::Endian, void*, const void*, size_t)> CopyBlockCallback;
+typedef void (*CopyBlockCallback)(xenos::Endian endian, void* output, const void* input,
+                                  size_t length);
 
 void CopySwapBlock(xenos::Endian endian, void* output, const void* input, size_t length);
 void ConvertTexelCTX1ToR8G8(xenos::Endian endian, void* output, const void* input, size_t length);
 void ConvertTexelDXT3AToDXT3(xenos::Endian endian, void* output, const void* input, size_t length);
 
-typedef std::function<void(void*, const void*, size_t)> UntileCopyBlockCallback;
+typedef void (*UntileCopyBlockCallback)(void* output, const void* input, size_t length);
+
+// Return the instantiation of the corresponding conversion routine with the
+// endianness baked in at compile time. Resolving the endianness once per
+// texture rather than once per block keeps the untiling inner loop free of
+// dispatch branches.
+UntileCopyBlockCallback GetCopySwapBlockCallback(xenos::Endian endian);
+UntileCopyBlockCallback GetConvertTexelCTX1ToR8G8Callback(xenos::Endian endian);
+UntileCopyBlockCallback GetConvertTexelDXT3AToDXT3Callback(xenos::Endian endian);
 
 typedef struct UntileInfo {
   uint32_t offset_x;
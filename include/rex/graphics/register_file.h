@@ -36,6 +36,11 @@ class RegisterFile {
   RegisterFile();
 
   static const RegisterInfo* GetRegisterInfo(uint32_t index);
+  // Whether the register is present in register_table.inc. Cheaper than
+  // GetRegisterInfo for the hot access paths that only need to tell known
+  // registers from unknown ones - a flat bitmap lookup instead of the info
+  // switch.
+  static bool IsValidRegister(uint32_t index);
 
   static constexpr size_t kRegisterCount = 0x5003;
   uint32_t values[kRegisterCount];
@@ -12,6 +12,7 @@
 
 #include <cstdint>
 #include <mutex>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -172,6 +173,17 @@ class SharedMemory {
   // persistently allocated vector).
   std::vector<std::pair<uint32_t, uint32_t>> upload_ranges_;
 
+  // Enables invalidation callbacks for a page range unless RequestRange has
+  // already enabled them for the whole request in one batched pass.
+  void EnableRangeCallbacks(uint32_t page_first, uint32_t page_last);
+  // Page span pre-enabled by RequestRange before UploadRanges so that the
+  // per-chunk MakeRangeValid calls skip the heap page table walks. Guarded by
+  // the global critical region: the memory invalidation callback clears the
+  // span when a guest write unprotects pages inside it mid-upload, so those
+  // pages get re-armed per chunk instead of being assumed still watched.
+  uint32_t protect_batch_page_first_ = UINT32_MAX;
+  uint32_t protect_batch_page_last_ = 0;
+
   // GPU-written memory downloading for traces. <Start address, length>.
   std::vector<std::pair<uint32_t, uint32_t>> trace_download_ranges_;
   uint32_t trace_download_page_count_ = 0;
@@ -196,6 +208,23 @@ class SharedMemory {
   // used to quickly extract ranges.
   std::vector<SystemPageFlagsBlock> system_page_flags_;
 
+  // High-churn fast mode (shared_memory_hash_poll_fault_threshold cvar):
+  // pages that keep getting written and re-uploaded stop being write-watched.
+  // Instead, a hash of their contents taken at upload time is compared on the
+  // next RequestRange, trading an access violation plus two protection
+  // changes per round trip for one hash of the page.
+  std::vector<uint8_t> page_fault_counts_;
+  // One bit per page, same block layout as system_page_flags_.
+  std::vector<uint64_t> hash_polled_pages_;
+  std::unordered_map<uint32_t, uint64_t> hash_polled_page_hashes_;
+  // Re-hashes polled pages in the range, invalidating and firing watches for
+  // those whose contents changed. Call in the global critical region.
+  void PollHashedPages(uint32_t page_first, uint32_t page_last);
+  // One bit per SystemPageFlagsBlock, set if every page in the block is valid.
+  // Lets RequestRange skip long fully resident spans with a single bit scan
+  // instead of checking every block while holding the global critical region.
+  std::vector<uint64_t> system_page_flags_valid_summary_;
+
   static std::pair<uint32_t, uint32_t> MemoryInvalidationCallbackThunk(
       void* context_ptr, uint32_t physical_address_start, uint32_t length, bool exact_range);
 
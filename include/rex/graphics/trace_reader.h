@@ -79,6 +79,11 @@ class TraceReader {
 
     const uint8_t* start_ptr = nullptr;
     const uint8_t* end_ptr = nullptr;
+    // Start of the most recent full state snapshot (registers, gamma ramp,
+    // EDRAM and memory) written at or before this frame. Replaying from here
+    // through end_ptr reproduces the frame's input state without replaying
+    // the rest of the trace. Null if the trace contains no snapshot.
+    const uint8_t* keyframe_ptr = nullptr;
     int command_count = 0;
 
     // Flat list of all commands in this frame.
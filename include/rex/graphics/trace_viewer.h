@@ -11,6 +11,7 @@
  */
 
 #include <string_view>
+#include <vector>
 
 #include <rex/graphics/pipeline/shader/shader.h>
 #include <rex/graphics/trace_player.h>
@@ -99,6 +100,7 @@ class TraceViewer : public rex::ui::WindowedApp {
   void DrawUI();
   void DrawControllerUI();
   void DrawPacketDisassemblerUI();
+  void BuildPacketDisassemblerRows(const uint8_t* start_ptr, const uint8_t* end_ptr);
   int RecursiveDrawCommandBufferUI(const TraceReader::Frame* frame,
                                    TraceReader::CommandBuffer* buffer);
   void DrawCommandListUI();
@@ -115,6 +117,22 @@ class TraceViewer : public rex::ui::WindowedApp {
   void DrawVertexFetcher(Shader* shader, const Shader::VertexBinding& vertex_binding,
                          const xenos::xe_gpu_vertex_fetch_t& fetch);
 
+  // One entry per text line of the packet disassembler window for the
+  // currently selected command, built by a pre-scan that only sizes the trace
+  // commands and counts packet actions without retaining any decoded state.
+  // Lines are uniform height, so with the index only the packets actually
+  // scrolled into view have to be disassembled each frame.
+  struct PacketDisassemblerRow {
+    // The trace command the line belongs to (the PacketStartCommand for packet
+    // and action lines).
+    const uint8_t* trace_ptr;
+    // Action within the packet, or -1 for the command / packet line itself.
+    int32_t action_index;
+  };
+  std::vector<PacketDisassemblerRow> packet_disassembler_rows_;
+  const uint8_t* packet_disassembler_rows_start_ptr_ = nullptr;
+  const uint8_t* packet_disassembler_rows_end_ptr_ = nullptr;
+
   TraceViewerWindowListener window_listener_;
 
   std::unique_ptr<rex::ui::Window> window_;
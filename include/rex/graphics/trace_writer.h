@@ -11,13 +11,19 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <cstdio>
+#include <deque>
 #include <filesystem>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <vector>
 
 #include <rex/graphics/registers.h>
 #include <rex/graphics/trace_protocol.h>
+#include <rex/thread.h>
 
 namespace rex::graphics {
 
@@ -51,15 +57,41 @@ class TraceWriter {
                       uint32_t gamma_ramp_rw_component);
 
  private:
+  // Size at which the pending chunk is handed to the write thread. Large
+  // enough to amortize locking and file I/O, small enough to keep the writer
+  // busy while a frame is still being recorded.
+  static constexpr size_t kWriteChunkSize = 1024 * 1024;
+
   void WriteMemoryCommand(TraceCommandType type, uint32_t base_ptr, size_t length,
                           const void* host_ptr = nullptr);
 
+  // Appends record bytes to the pending chunk on the command processor thread,
+  // handing the chunk to the write thread when it's large enough.
+  void AppendBytes(const void* data, size_t length);
+  void WriteThread();
+
   std::set<uint64_t> cached_memory_reads_;
   uint8_t* membase_;
   FILE* file_ = nullptr;
 
   bool compress_output_ = true;
   size_t compression_threshold_ = 1024;
+  // Compressed record payloads are built here before the record header is
+  // written, so the final encoded size is known up front and the output stream
+  // stays purely sequential.
+  std::vector<char> compression_scratch_;
+
+  // Records are accumulated in write_chunk_ on the command processor thread
+  // and written to the file by the write thread, so disk I/O and flushes don't
+  // stall command processing. The queue is protected with write_request_lock_,
+  // and the thread is notified about its change via write_request_cond_.
+  std::vector<uint8_t> write_chunk_;
+  std::deque<std::vector<uint8_t>> write_queue_;
+  std::mutex write_request_lock_;
+  std::condition_variable write_request_cond_;
+  bool write_flush_pending_ = false;
+  bool write_thread_shutdown_ = false;
+  std::unique_ptr<rex::thread::Thread> write_thread_;
 };
 
 }  // namespace rex::graphics
@@ -130,6 +130,9 @@ class VulkanCommandProcessor : public CommandProcessor {
 
   void ClearCaches() override;
 
+  void InitializeShaderStorage(const std::filesystem::path& cache_root, uint32_t title_id,
+                               bool blocking) override;
+
   void TracePlaybackWroteMemory(uint32_t base_ptr, uint32_t length) override;
 
   void RestoreEdramSnapshot(const void* snapshot) override;
@@ -241,6 +244,7 @@ class VulkanCommandProcessor : public CommandProcessor {
   void ShutdownContext() override;
 
   void WriteRegister(uint32_t index, uint32_t value) override;
+  void OnRegisterRangeWritten(uint32_t first_index, uint32_t count) override;
 
   void OnGammaRamp256EntryTableValueWritten() override;
   void OnGammaRampPWLValueWritten() override;
@@ -617,6 +621,18 @@ class VulkanCommandProcessor : public CommandProcessor {
   uint32_t dynamic_stencil_write_mask_back_ = UINT8_MAX;
   uint32_t dynamic_stencil_reference_front_ = 0;
   uint32_t dynamic_stencil_reference_back_ = 0;
+  // VK_EXT_extended_dynamic_state, when the extendedDynamicState device
+  // property is available - the corresponding description fields are excluded
+  // from the pipeline storage key by the pipeline cache. The depth / stencil
+  // state is applicable only to the host render target implementation.
+  VkCullModeFlags dynamic_cull_mode_;
+  VkFrontFace dynamic_front_face_;
+  VkBool32 dynamic_depth_test_enable_;
+  VkBool32 dynamic_depth_write_enable_;
+  VkCompareOp dynamic_depth_compare_op_;
+  VkBool32 dynamic_stencil_test_enable_;
+  VkStencilOpState dynamic_stencil_op_front_;
+  VkStencilOpState dynamic_stencil_op_back_;
   bool dynamic_viewport_update_needed_;
   bool dynamic_scissor_update_needed_;
   bool dynamic_depth_bias_update_needed_;
@@ -627,6 +643,14 @@ class VulkanCommandProcessor : public CommandProcessor {
   bool dynamic_stencil_write_mask_back_update_needed_;
   bool dynamic_stencil_reference_front_update_needed_;
   bool dynamic_stencil_reference_back_update_needed_;
+  bool dynamic_cull_mode_update_needed_;
+  bool dynamic_front_face_update_needed_;
+  bool dynamic_depth_test_enable_update_needed_;
+  bool dynamic_depth_write_enable_update_needed_;
+  bool dynamic_depth_compare_op_update_needed_;
+  bool dynamic_stencil_test_enable_update_needed_;
+  bool dynamic_stencil_op_front_update_needed_;
+  bool dynamic_stencil_op_back_update_needed_;
 
   // Currently used samplers.
   std::vector<std::pair<VulkanTextureCache::SamplerParameters, VkSampler>> current_samplers_vertex_;
@@ -259,6 +259,13 @@ class DeferredCommandBuffer {
     std::memcpy(args.blend_constants, blend_constants, sizeof(float) * 4);
   }
 
+  // Requires the extendedDynamicState device property.
+  void CmdVkSetCullMode(VkCullModeFlags cull_mode) {
+    auto& args = *reinterpret_cast<ArgsVkSetCullMode*>(
+        WriteCommand(Command::kVkSetCullMode, sizeof(ArgsVkSetCullMode)));
+    args.cull_mode = cull_mode;
+  }
+
   void CmdVkSetDepthBias(float depth_bias_constant_factor, float depth_bias_clamp,
                          float depth_bias_slope_factor) {
     auto& args = *reinterpret_cast<ArgsVkSetDepthBias*>(
@@ -268,6 +275,34 @@ class DeferredCommandBuffer {
     args.depth_bias_slope_factor = depth_bias_slope_factor;
   }
 
+  // Requires the extendedDynamicState device property.
+  void CmdVkSetDepthCompareOp(VkCompareOp compare_op) {
+    auto& args = *reinterpret_cast<ArgsVkSetDepthCompareOp*>(
+        WriteCommand(Command::kVkSetDepthCompareOp, sizeof(ArgsVkSetDepthCompareOp)));
+    args.compare_op = compare_op;
+  }
+
+  // Requires the extendedDynamicState device property.
+  void CmdVkSetDepthTestEnable(VkBool32 enable) {
+    auto& args = *reinterpret_cast<ArgsSetEnable*>(
+        WriteCommand(Command::kVkSetDepthTestEnable, sizeof(ArgsSetEnable)));
+    args.enable = enable;
+  }
+
+  // Requires the extendedDynamicState device property.
+  void CmdVkSetDepthWriteEnable(VkBool32 enable) {
+    auto& args = *reinterpret_cast<ArgsSetEnable*>(
+        WriteCommand(Command::kVkSetDepthWriteEnable, sizeof(ArgsSetEnable)));
+    args.enable = enable;
+  }
+
+  // Requires the extendedDynamicState device property.
+  void CmdVkSetFrontFace(VkFrontFace front_face) {
+    auto& args = *reinterpret_cast<ArgsVkSetFrontFace*>(
+        WriteCommand(Command::kVkSetFrontFace, sizeof(ArgsVkSetFrontFace)));
+    args.front_face = front_face;
+  }
+
   void CmdVkSetScissor(uint32_t first_scissor, uint32_t scissor_count, const VkRect2D* scissors) {
     const size_t header_size = rex::align(sizeof(ArgsVkSetScissor), alignof(VkRect2D));
     uint8_t* args_ptr = reinterpret_cast<uint8_t*>(
@@ -285,6 +320,18 @@ class DeferredCommandBuffer {
     args.mask_reference = compare_mask;
   }
 
+  // Requires the extendedDynamicState device property.
+  void CmdVkSetStencilOp(VkStencilFaceFlags face_mask, VkStencilOp fail_op, VkStencilOp pass_op,
+                         VkStencilOp depth_fail_op, VkCompareOp compare_op) {
+    auto& args = *reinterpret_cast<ArgsVkSetStencilOp*>(
+        WriteCommand(Command::kVkSetStencilOp, sizeof(ArgsVkSetStencilOp)));
+    args.face_mask = face_mask;
+    args.fail_op = fail_op;
+    args.pass_op = pass_op;
+    args.depth_fail_op = depth_fail_op;
+    args.compare_op = compare_op;
+  }
+
   void CmdVkSetStencilReference(VkStencilFaceFlags face_mask, uint32_t reference) {
     auto& args = *reinterpret_cast<ArgsSetStencilMaskReference*>(
         WriteCommand(Command::kVkSetStencilReference, sizeof(ArgsSetStencilMaskReference)));
@@ -292,6 +339,13 @@ class DeferredCommandBuffer {
     args.mask_reference = reference;
   }
 
+  // Requires the extendedDynamicState device property.
+  void CmdVkSetStencilTestEnable(VkBool32 enable) {
+    auto& args = *reinterpret_cast<ArgsSetEnable*>(
+        WriteCommand(Command::kVkSetStencilTestEnable, sizeof(ArgsSetEnable)));
+    args.enable = enable;
+  }
+
   void CmdVkSetStencilWriteMask(VkStencilFaceFlags face_mask, uint32_t write_mask) {
     auto& args = *reinterpret_cast<ArgsSetStencilMaskReference*>(
         WriteCommand(Command::kVkSetStencilWriteMask, sizeof(ArgsSetStencilMaskReference)));
@@ -328,10 +382,17 @@ class DeferredCommandBuffer {
     kVkPipelineBarrier,
     kVkPushConstants,
     kVkSetBlendConstants,
+    kVkSetCullMode,
     kVkSetDepthBias,
+    kVkSetDepthCompareOp,
+    kVkSetDepthTestEnable,
+    kVkSetDepthWriteEnable,
+    kVkSetFrontFace,
     kVkSetScissor,
     kVkSetStencilCompareMask,
+    kVkSetStencilOp,
     kVkSetStencilReference,
+    kVkSetStencilTestEnable,
     kVkSetStencilWriteMask,
     kVkSetViewport,
   };
@@ -459,10 +520,18 @@ class DeferredCommandBuffer {
     // Followed by `size` bytes of values.
   };
 
+  struct ArgsSetEnable {
+    VkBool32 enable;
+  };
+
   struct ArgsVkSetBlendConstants {
     float blend_constants[4];
   };
 
+  struct ArgsVkSetCullMode {
+    VkCullModeFlags cull_mode;
+  };
+
   struct ArgsVkSetDepthBias {
     float depth_bias_constant_factor;
     float depth_bias_clamp;
@@ -476,11 +545,27 @@ class DeferredCommandBuffer {
     static_assert(alignof(VkRect2D) <= alignof(uintmax_t));
   };
 
+  struct ArgsVkSetDepthCompareOp {
+    VkCompareOp compare_op;
+  };
+
+  struct ArgsVkSetFrontFace {
+    VkFrontFace front_face;
+  };
+
   struct ArgsSetStencilMaskReference {
     VkStencilFaceFlags face_mask;
     uint32_t mask_reference;
   };
 
+  struct ArgsVkSetStencilOp {
+    VkStencilFaceFlags face_mask;
+    VkStencilOp fail_op;
+    VkStencilOp pass_op;
+    VkStencilOp depth_fail_op;
+    VkCompareOp compare_op;
+  };
+
   struct ArgsVkSetViewport {
     uint32_t first_viewport;
     uint32_t viewport_count;
@@ -492,8 +577,12 @@ class DeferredCommandBuffer {
 
   const VulkanCommandProcessor& command_processor_;
 
-  // uintmax_t to ensure uint64_t and pointer alignment of all structures.
+  // uintmax_t to ensure uint64_t and pointer alignment of all structures. The
+  // vector is kept at its high-water size across Reset, with
+  // command_stream_used_ tracking how much of it the current recording has
+  // actually written.
   std::vector<uintmax_t> command_stream_;
+  size_t command_stream_used_ = 0;
 };
 
 }  // namespace rex::graphics::vulkan
@@ -10,12 +10,18 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <condition_variable>
 #include <cstddef>
+#include <cstdio>
 #include <cstring>
+#include <deque>
+#include <filesystem>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <rex/graphics/pipeline/shader/spirv_translator.h>
 #include <rex/graphics/primitive_processor.h>
@@ -26,6 +32,7 @@
 #include <rex/graphics/xenos.h>
 #include <rex/hash.h>
 #include <rex/platform.h>
+#include <rex/thread.h>
 #include <rex/ui/vulkan/api.h>
 
 namespace rex::graphics::vulkan {
@@ -55,6 +62,15 @@ class VulkanPipelineCache {
   bool Initialize();
   void Shutdown();
 
+  // Opens the title's persistent shader and pipeline description storage,
+  // translating previously encountered shaders on a pool of worker threads so
+  // steady-state gameplay doesn't translate on the command processor thread.
+  void InitializeShaderStorage(const std::filesystem::path& cache_root, uint32_t title_id,
+                               bool blocking);
+  void ShutdownShaderStorage();
+
+  void EndSubmission();
+
   VulkanShader* LoadShader(xenos::ShaderType shader_type, const uint32_t* host_address,
                            uint32_t dword_count);
   // Analyze shader microcode on the translator thread.
@@ -81,6 +97,17 @@ class VulkanPipelineCache {
                          const PipelineLayoutProvider*& pipeline_layout_out);
 
  private:
+  // Same layout as the Direct3D 12 backend's stored shader header - the guest
+  // ucode storage is API-independent and shareable between the backends.
+  REXPACKEDSTRUCT(ShaderStoredHeader, {
+    uint64_t ucode_data_hash;
+
+    uint32_t ucode_dword_count : 31;
+    xenos::ShaderType type : 1;
+
+    static constexpr uint32_t kVersion = 0x20201219;
+  });
+
   enum class PipelineGeometryShader : uint32_t {
     kNone,
     kPointList,
@@ -170,6 +197,8 @@ class VulkanPipelineCache {
     // Filled only for the attachments present in the render pass object.
     PipelineRenderTarget render_targets[xenos::kMaxColorRenderTargets];
 
+    static constexpr uint32_t kVersion = 0x20260830;
+
     // Including all the padding, for a stable hash.
     PipelineDescription() {
       Reset();
@@ -197,6 +226,11 @@ class VulkanPipelineCache {
     };
   });
 
+  REXPACKEDSTRUCT(PipelineStoredDescription, {
+    uint64_t description_hash;
+    PipelineDescription description;
+  });
+
   struct Pipeline {
     VkPipeline pipeline = VK_NULL_HANDLE;
     // The layouts are owned by the VulkanCommandProcessor, and must not be
@@ -239,10 +273,15 @@ class VulkanPipelineCache {
     bool operator!=(const GeometryShaderKey& other_key) const { return !(*this == other_key); }
   };
 
+  VulkanShader* LoadShader(xenos::ShaderType shader_type, const uint32_t* host_address,
+                           uint32_t dword_count, uint64_t data_hash);
+
   // Can be called from multiple threads.
   bool TranslateAnalyzedShader(SpirvShaderTranslator& translator,
                                VulkanShader::VulkanTranslation& translation);
 
+  void StorageWriteThread();
+
   void WritePipelineRenderTargetDescription(reg::RB_BLENDCONTROL blend_control, uint32_t write_mask,
                                             PipelineRenderTarget& render_target_out) const;
   bool GetCurrentStateDescription(
@@ -307,6 +346,34 @@ class VulkanPipelineCache {
 
   // Previously used pipeline, to avoid lookups if the state wasn't changed.
   const std::pair<const PipelineDescription, Pipeline>* last_pipeline_ = nullptr;
+
+  // Currently open shader storage path.
+  std::filesystem::path shader_storage_cache_root_;
+  // Currently open shader storage title ID.
+  uint32_t shader_storage_title_id_ = 0;
+
+  // Shader storage output stream, for preload in the next emulator runs.
+  FILE* shader_storage_file_ = nullptr;
+  bool shader_storage_file_flush_needed_ = false;
+  // Identifier of the shader storage the ucode of the shaders was last written
+  // to, or loaded from, to skip rewriting.
+  uint32_t shader_storage_index_ = 0;
+
+  // Pipeline description storage output stream, for preload in the next
+  // emulator runs.
+  FILE* pipeline_storage_file_ = nullptr;
+  bool pipeline_storage_file_flush_needed_ = false;
+
+  // Thread appending newly encountered shaders and pipeline descriptions to
+  // the storage streams.
+  std::unique_ptr<rex::thread::Thread> storage_write_thread_;
+  std::mutex storage_write_request_lock_;
+  std::condition_variable storage_write_request_cond_;
+  std::deque<const Shader*> storage_write_shader_queue_;
+  std::deque<PipelineStoredDescription> storage_write_pipeline_queue_;
+  bool storage_write_flush_shaders_ = false;
+  bool storage_write_flush_pipelines_ = false;
+  bool storage_write_thread_shutdown_ = false;
 };
 
 }  // namespace rex::graphics::vulkan
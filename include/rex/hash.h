@@ -12,6 +12,8 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <string_view>
 
 // Enable inline implementations and advanced API (XXH3)
 #ifndef XXH_INLINE_ALL
@@ -42,4 +44,27 @@ struct XXHasher {
   }
 };
 
+// FNV-1a over the raw bytes, usable in constant expressions. XXH3 can't be
+// evaluated at compile time, so this is the hash for keys that are string
+// literals (export names, cvar names) - precompute the literal side with this
+// and make sure the runtime side of the lookup uses the same function.
+constexpr uint64_t Fnv1a64(std::string_view data) {
+  uint64_t hash = UINT64_C(0xCBF29CE484222325);
+  for (char c : data) {
+    hash ^= uint8_t(c);
+    hash *= UINT64_C(0x00000100000001B3);
+  }
+  return hash;
+}
+
+// Transparent hasher for unordered containers with std::string keys, so
+// by-name lookups can pass a string_view without allocating a temporary key.
+// Hashes through XXH3 like the byte-buffer hashers above.
+struct TransparentStringHasher {
+  using is_transparent = void;
+  size_t operator()(std::string_view s) const noexcept {
+    return static_cast<size_t>(XXH3_64bits(s.data(), s.size()));
+  }
+};
+
 }  // namespace rex
@@ -10,6 +10,7 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -41,9 +42,25 @@ class InputSystem : public system::IInputSystem {
   X_RESULT GetKeystroke(uint32_t user_index, uint32_t flags, X_INPUT_KEYSTROKE* out_keystroke);
 
  private:
+  // Rhythm games poll GetState at 1 kHz, and between driver updates the
+  // answer doesn't change - so each user's last result is published in a
+  // sequence-locked snapshot that polls read without taking the driver locks.
+  // The first poll past the refresh interval (input_poll_cache_micros)
+  // re-queries the drivers and republishes.
+  static constexpr size_t kMaxUsers = 4;
+  struct StateSnapshot {
+    std::atomic<uint64_t> sequence{0};  // Odd while a writer fills the slot.
+    std::atomic<int64_t> valid_until_ns{0};
+    X_RESULT result;
+    X_INPUT_STATE state;
+  };
+
+  X_RESULT QueryStateFromDrivers(uint32_t user_index, X_INPUT_STATE* out_state);
+
   rex::ui::Window* window_ = nullptr;
 
   std::vector<std::unique_ptr<InputDriver>> drivers_;
+  StateSnapshot state_snapshots_[kMaxUsers];
 };
 
 /// Create a default InputSystem with SDL + NOP drivers.
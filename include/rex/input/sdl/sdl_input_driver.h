@@ -15,6 +15,7 @@
 #include <atomic>
 #include <mutex>
 #include <optional>
+#include <thread>
 
 #include <rex/input/input_driver.h>
 
@@ -80,6 +81,10 @@ class SDLInputDriver final : public InputDriver {
 
   bool sdl_events_initialized_;
   bool sdl_gamecontroller_initialized_;
+  // Pumps SDL at a fixed rate so the controller state stays fresh between
+  // guest reads, which may come as rarely as once per 30 Hz title frame.
+  std::thread poll_thread_;
+  std::atomic<bool> poll_thread_exit_;
   int sdl_events_unflushed_;
   std::atomic<bool> sdl_pumpevents_queued_;
   std::array<ControllerState, HID_SDL_USER_COUNT> controllers_;
@@ -19,6 +19,10 @@ namespace xam {
 
 bool xeXamIsUIActive();
 
+// Stops the XamTask worker pool, waiting for in-flight tasks. Called from
+// ~XamModule before kernel objects go away.
+void xeXamTaskShutdownPool();
+
 rex::runtime::Export* RegisterExport_xam(rex::runtime::Export* export_entry);
 
 // Registration functions, one per file.
@@ -0,0 +1,39 @@
+/**
+ * @file        rex/kernel/xboxkrnl/monitor_telemetry.h
+ * @brief       Lock-free telemetry fan-in for the cert/debug monitor callbacks
+ *
+ * @copyright   Copyright (c) 2026 Tom Clay <tomc@tctechstuff.com>
+ *              All rights reserved.
+ *
+ * @license     BSD 3-Clause License
+ *              See LICENSE file in the project root for full license text.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace rex::kernel::xboxkrnl {
+
+enum class MonitorSource : uint32_t {
+  kDebugMonitor = 0,
+  kCertMonitor = 1,
+};
+
+// Guest threads hammer the monitor callbacks when a title spams DbgPrint-style
+// output; logging each hit synchronously would stall them. Record() instead
+// pushes a fixed-size event into a shared MPSC ring and a lazily started drain
+// thread logs rate-limited per-(source, command) aggregates.
+namespace monitor_telemetry {
+
+// (threadsafe) Queue one callback observation. Never blocks the caller: when
+// the ring is full the event is dropped and the drop is counted instead.
+void Record(MonitorSource source, uint32_t id, uint32_t arg);
+
+// Flush pending aggregates and join the drain thread. Safe to call more than
+// once or when nothing was ever recorded.
+void Shutdown();
+
+}  // namespace monitor_telemetry
+
+}  // namespace rex::kernel::xboxkrnl
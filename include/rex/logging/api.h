@@ -22,6 +22,8 @@ REXCVAR_DECLARE(std::string, log_level);
 REXCVAR_DECLARE(std::string, log_file);
 REXCVAR_DECLARE(bool, log_verbose);
 REXCVAR_DECLARE(bool, enable_console);
+REXCVAR_DECLARE(bool, log_async);
+REXCVAR_DECLARE(int32_t, log_async_queue_size);
 
 namespace rex {
 
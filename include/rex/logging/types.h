@@ -98,6 +98,18 @@ struct LogConfig {
   /** Messages at or above this level trigger an immediate flush. */
   spdlog::level::level_enum flush_level = spdlog::level::warn;
 
+  /**
+   * Route messages through a dedicated writer thread. Producers only push
+   * the message into a preallocated ring; pattern formatting and sink I/O
+   * happen on the writer thread, so an enabled log statement on a hot path
+   * (guest threads, kernel call tracing) stays cheap.
+   */
+  bool async = true;
+
+  /** Capacity of the async message ring, in messages. When the ring is
+      full, producers block until the writer thread catches up. */
+  size_t async_queue_size = 8192;
+
   /**
    * Per-category log level overrides.
    * Key is the category name (e.g. "core", "gpu", "app.network").
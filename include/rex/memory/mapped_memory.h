@@ -51,6 +51,20 @@ class MappedMemory {
   uint8_t* data() const { return reinterpret_cast<uint8_t*>(data_); }
   size_t size() const { return size_; }
 
+  enum class AdviseHint {
+    kWillNeed,    // Range will be accessed soon - start paging it in
+    kSequential,  // Range will be read in ascending order
+    kRandom,      // Range will be accessed in no particular order
+  };
+
+  // Access-pattern hint for a range of the mapping. Purely advisory; a no-op
+  // where the platform offers nothing useful.
+  virtual void Advise(AdviseHint hint, size_t offset, size_t length) {
+    (void)hint;
+    (void)offset;
+    (void)length;
+  }
+
   // Close, and optionally truncate file to size
   virtual void Close(uint64_t truncate_size = 0) { (void)truncate_size; }
   virtual void Flush() {}
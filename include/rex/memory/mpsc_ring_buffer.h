@@ -0,0 +1,118 @@
+/**
+ * @file        memory/mpsc_ring_buffer.h
+ * @brief       Multi-producer single-consumer byte ring with batched reservation
+ *
+ * @copyright   Copyright (c) 2026 Tom Clay <tomc@tctechstuff.com>
+ *              All rights reserved.
+ *
+ * @license     BSD 3-Clause License
+ *              See LICENSE file in the project root for full license text.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace rex::memory {
+
+/**
+ * Byte-granular MPSC ring buffer for trace/log/audio style fan-in.
+ *
+ * Producers claim a contiguous byte span with Reserve, fill it at their own
+ * pace, then publish it with Commit; claims from different threads never
+ * overlap and the consumer only sees records in reservation order, stalling
+ * at the first unpublished one. RingBuffer stays the single-producer
+ * primitive; this is the shared replacement for the ad-hoc multi-writer
+ * handoff the trace writer, logging and audio each built around it.
+ *
+ * Internally every record is prefixed with an 8-byte header carrying the
+ * payload size, and publication rides a dedicated commit cursor that
+ * producers advance strictly in reservation order - Commit briefly spins
+ * until all earlier reservations have published. The consumer never infers
+ * readiness from slot contents (record starts drift across laps whenever the
+ * capacity isn't a multiple of the record stride, so a stale byte pattern
+ * could masquerade as a committed header); everything below the commit
+ * cursor is published, everything above it does not exist yet.
+ */
+class MpscRingBuffer {
+ public:
+  // Capacity is rounded up to a power of two; it bounds the total of payload
+  // bytes plus one 8-byte header per record in flight.
+  explicit MpscRingBuffer(size_t capacity);
+
+  size_t capacity() const { return capacity_; }
+
+  // A claimed span. Payload bytes may wrap, hence the two runs.
+  struct Reservation {
+    uint8_t* first = nullptr;
+    size_t first_length = 0;
+    uint8_t* second = nullptr;
+    size_t second_length = 0;
+
+    // Convenience for producers that just have a flat source buffer.
+    void CopyIn(const void* data, size_t size);
+
+   private:
+    friend class MpscRingBuffer;
+    uint64_t offset = 0;  // Global (unwrapped) offset of the record header.
+    uint32_t size = 0;
+  };
+
+  // (threadsafe) Claims size payload bytes. Returns false when the buffer is
+  // too full; nothing is published until Commit.
+  bool TryReserve(size_t size, Reservation* out_reservation);
+
+  // (threadsafe) Like TryReserve but yields until space frees up.
+  void Reserve(size_t size, Reservation* out_reservation);
+
+  // (threadsafe) Publishes a previously reserved span to the consumer.
+  // Commits land in reservation order: this may briefly spin while producers
+  // holding earlier reservations finish filling theirs.
+  void Commit(const Reservation& reservation);
+
+  // (threadsafe) Reserve + copy + commit in one call. Returns false when the
+  // buffer is too full.
+  bool TryWrite(const void* data, size_t size);
+
+  // (consumer only) Copies the payloads of consecutive published records into
+  // buffer, stopping at the first record that is unpublished or doesn't fit.
+  // When nothing is ready, blocks up to wait (zero polls) for a commit.
+  // Returns the number of payload bytes copied. buffer_size must be at least
+  // as large as the largest record ever reserved, or that record could never
+  // be drained.
+  size_t Drain(uint8_t* buffer, size_t buffer_size,
+               std::chrono::milliseconds wait = std::chrono::milliseconds(0));
+
+ private:
+  static constexpr size_t kHeaderSize = 8;
+
+  uint64_t LoadHeader(uint64_t offset) const;
+  void StoreHeader(uint64_t offset, uint64_t value);
+  size_t CopyReady(uint8_t* buffer, size_t buffer_size);
+
+  std::unique_ptr<uint64_t[]> storage_;
+  uint8_t* buffer_ = nullptr;
+  size_t capacity_ = 0;
+  size_t capacity_mask_ = 0;
+
+  // Producers and the consumer hammer opposite cursors; keep them on
+  // separate cache lines along with the data they share direction with.
+  // Everything below commit_offset_ is published; producers advance it in
+  // reservation order.
+  alignas(64) std::atomic<uint64_t> reserve_offset_{0};
+  alignas(64) std::atomic<uint64_t> commit_offset_{0};
+  alignas(64) std::atomic<uint64_t> read_offset_{0};
+
+  // Only touched when the consumer has caught up and parks in Drain.
+  std::mutex drain_mutex_;
+  std::condition_variable drain_cond_;
+  std::atomic<bool> drain_waiting_{false};
+};
+
+}  // namespace rex::memory
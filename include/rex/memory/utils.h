@@ -114,6 +114,20 @@ bool Protect(void* base_address, size_t length, PageAccess access,
 // the region.
 bool QueryProtect(void* base_address, size_t& length, PageAccess& access_out);
 
+// Asks the OS to back the given mapped range with huge pages (2 MB on
+// x86-64) to cut dTLB pressure on bulk regions. Purely advisory: returns
+// false when the platform can't or won't, and the range keeps base pages.
+// The kernel transparently splits a huge page when a sub-range is later
+// re-protected, so page-granular protection (write watches, demand paging)
+// still works on an advised range - it just loses the huge mapping there.
+bool AdviseHugePages(void* base_address, size_t length);
+
+// Binds the physical backing of the given mapped range to one NUMA node, so
+// pages faulted in through it are allocated there regardless of which node
+// touches them first. Returns false when the platform can't bind an existing
+// mapping; placement is then left to the OS default (first touch).
+bool BindToNumaNode(void* base_address, size_t length, uint32_t node);
+
 // Allocates a block of memory for a type with the given alignment.
 // The memory must be freed with AlignedFree.
 template <typename T>
@@ -178,6 +192,13 @@ void copy_and_swap_64_unaligned(void* dest, const void* src, size_t count);
 void copy_and_swap_16_in_32_aligned(void* dest, const void* src, size_t count);
 void copy_and_swap_16_in_32_unaligned(void* dest, const void* src, size_t count);
 
+// Element-wise equality counting, vectorized like the swap-copies above. The
+// comparisons are position-wise on the raw bytes, so they are endian-agnostic -
+// when matching big-endian guest data against a host value, swap the single
+// reference value instead of swapping every element of the data.
+size_t count_matching_8(const void* a, const void* b, size_t count);
+size_t count_equal_32(const void* src, size_t count, uint32_t value);
+
 template <typename T>
 void copy_and_swap(T* dest, const T* src, size_t count) {
   bool is_aligned =
@@ -270,9 +291,8 @@ inline void store_and_swap(void* mem, const T& value) {
 // String specializations need custom logic
 template <>
 inline void store_and_swap<std::string_view>(void* mem, const std::string_view& value) {
-  for (size_t i = 0; i < value.size(); ++i) {
-    store_and_swap<uint8_t>(reinterpret_cast<uint8_t*>(mem) + i, value[i]);
-  }
+  // Bytes have no endianness; this is a plain copy.
+  std::memcpy(mem, value.data(), value.size());
 }
 template <>
 inline void store_and_swap<std::string>(void* mem, const std::string& value) {
@@ -280,9 +300,7 @@ inline void store_and_swap<std::string>(void* mem, const std::string& value) {
 }
 template <>
 inline void store_and_swap<std::u16string_view>(void* mem, const std::u16string_view& value) {
-  for (size_t i = 0; i < value.size(); ++i) {
-    store_and_swap<uint16_t>(reinterpret_cast<uint16_t*>(mem) + i, value[i]);
-  }
+  copy_and_swap_16_unaligned(mem, value.data(), value.size());
 }
 template <>
 inline void store_and_swap<std::u16string>(void* mem, const std::u16string& value) {
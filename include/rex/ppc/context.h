@@ -24,6 +24,7 @@
 
 #include <rex/chrono/clock.h>  // For mftb timebase access
 #include <rex/logging.h>
+#include <rex/ppc/coverage.h>  // PPC_FUNC_COUNTER for instrumented prologues
 #include <rex/ppc/memory.h>
 #include <rex/ppc/types.h>
 #include <rex/thread/mutex.h>
@@ -99,6 +100,18 @@ using PPCFunc = void(PPCContext& ctx, uint8_t* base);
 #define PPC_CALL_FUNC(x) x(ctx, base)
 #endif
 
+// Genuine tail call for b-to-function patterns: keeps guest call depth off
+// the host stack. Every PPC_FUNC shares one signature, so musttail always
+// applies; compilers without the attribute fall back to call-and-return.
+#if defined(__has_cpp_attribute)
+#if __has_cpp_attribute(clang::musttail)
+#define PPC_MUSTTAIL [[clang::musttail]]
+#endif
+#endif
+#ifndef PPC_MUSTTAIL
+#define PPC_MUSTTAIL
+#endif
+
 //=============================================================================
 // Library Mode Stubs
 //=============================================================================
@@ -110,6 +123,8 @@ using PPCFunc = void(PPCContext& ctx, uint8_t* base);
 
 #define PPC_CALL_INDIRECT_FUNC(x) __builtin_debugtrap()
 
+#define PPC_TAIL_CALL_INDIRECT_FUNC(x) __builtin_debugtrap()
+
 #endif  // !PPC_CONFIG_H_INCLUDED
 
 //=============================================================================
@@ -123,8 +138,39 @@ using PPCFunc = void(PPCContext& ctx, uint8_t* base);
 #define PPC_LOOKUP_FUNC(x, y) \
   (*(PPCFunc**)(x + PPC_IMAGE_BASE + PPC_IMAGE_SIZE + (uint64_t(uint32_t(y) - PPC_CODE_BASE) * 2)))
 
+// Indirect calls carry a direct-mapped inline cache per call site: most bctrl
+// sites are monomorphic (one vtable slot, one target), so the compare against
+// the cached address hits in the site's own cache line instead of chasing a
+// cold slot in the multi-megabyte function table. Caches are thread-local so
+// the two words can never tear across threads; the table is populated once at
+// startup, before guest threads run, so entries cannot go stale.
 #undef PPC_CALL_INDIRECT_FUNC
-#define PPC_CALL_INDIRECT_FUNC(x) PPC_LOOKUP_FUNC(base, x)(ctx, base);
+#define PPC_CALL_INDIRECT_FUNC(x)                          \
+  do {                                                     \
+    static thread_local uint32_t ppc_ic_addr_ = 0;         \
+    static thread_local PPCFunc* ppc_ic_fn_ = nullptr;     \
+    const uint32_t ppc_ic_target_ = (uint32_t)(x);         \
+    if (ppc_ic_addr_ != ppc_ic_target_) {                  \
+      ppc_ic_fn_ = PPC_LOOKUP_FUNC(base, ppc_ic_target_);  \
+      ppc_ic_addr_ = ppc_ic_target_;                       \
+    }                                                      \
+    ppc_ic_fn_(ctx, base);                                 \
+  } while (0)
+
+// Tail-call form for bctr sites: the emitted statement is the final one in
+// the function, so the indirect call can reuse the caller's frame
+#undef PPC_TAIL_CALL_INDIRECT_FUNC
+#define PPC_TAIL_CALL_INDIRECT_FUNC(x)                     \
+  do {                                                     \
+    static thread_local uint32_t ppc_ic_addr_ = 0;         \
+    static thread_local PPCFunc* ppc_ic_fn_ = nullptr;     \
+    const uint32_t ppc_ic_target_ = (uint32_t)(x);         \
+    if (ppc_ic_addr_ != ppc_ic_target_) {                  \
+      ppc_ic_fn_ = PPC_LOOKUP_FUNC(base, ppc_ic_target_);  \
+      ppc_ic_addr_ = ppc_ic_target_;                       \
+    }                                                      \
+    PPC_MUSTTAIL return ppc_ic_fn_(ctx, base);             \
+  } while (0)
 
 #endif  // PPC_CONFIG_H_INCLUDED
 
@@ -141,7 +187,10 @@ using PPCFunc = void(PPCContext& ctx, uint8_t* base);
 // Timebase Access
 //=============================================================================
 
-#define PPC_QUERY_TIMEBASE() rex::chrono::Clock::QueryGuestTickCount()
+// Inline invariant-TSC read when the clock has one calibrated; falls back to
+// the scaled host clock otherwise. mftb is hot enough in some game loops
+// that a clock_gettime per read shows up in profiles.
+#define PPC_QUERY_TIMEBASE() rex::chrono::Clock::QueryGuestTickCountFast()
 
 //=============================================================================
 // Function Mapping
@@ -168,17 +217,15 @@ constexpr float kPack2101010_Max2 = std::bit_cast<float>(0x40400003u);
 //=============================================================================
 
 struct alignas(0x40) PPCContext {
-  // Kernel state pointer for easy access from exports
-  rex::system::KernelState* kernel_state = nullptr;
+  //===========================================================================
+  // Hot block
+  //===========================================================================
+  // Fields touched by nearly every emitted instruction: argument GPRs, stack
+  // and branch/condition state. Kept together at the front so they pack into
+  // the first few cache lines - a recompiled call warms them as a group.
+  // Keep rarely-written state out of here (see the cold tail below).
 
   PPCRegister r3;
-#ifndef PPC_CONFIG_NON_ARGUMENT_AS_LOCAL
-  PPCRegister r0;
-#endif
-  PPCRegister r1;
-#ifndef PPC_CONFIG_NON_ARGUMENT_AS_LOCAL
-  PPCRegister r2;
-#endif
   PPCRegister r4;
   PPCRegister r5;
   PPCRegister r6;
@@ -186,11 +233,46 @@ struct alignas(0x40) PPCContext {
   PPCRegister r8;
   PPCRegister r9;
   PPCRegister r10;
+  PPCRegister r1;
+  PPCRegister r13;
 #ifndef PPC_CONFIG_NON_ARGUMENT_AS_LOCAL
+  PPCRegister r0;
+  PPCRegister r2;
   PPCRegister r11;
   PPCRegister r12;
 #endif
-  PPCRegister r13;
+#ifndef PPC_CONFIG_SKIP_LR
+  uint64_t lr;
+#endif
+#ifndef PPC_CONFIG_CTR_AS_LOCAL
+  PPCRegister ctr;
+#endif
+#ifndef PPC_CONFIG_CR_AS_LOCAL
+  PPCCRRegister cr0;
+  PPCCRRegister cr1;
+  PPCCRRegister cr2;
+  PPCCRRegister cr3;
+  PPCCRRegister cr4;
+  PPCCRRegister cr5;
+  PPCCRRegister cr6;
+  PPCCRRegister cr7;
+#endif
+#ifndef PPC_CONFIG_XER_AS_LOCAL
+  PPCXERRegister xer;
+#endif
+  uint8_t vscr_sat = 0;  // VSCR saturation flag (for vector ops)
+  PPCFPSCRRegister fpscr;
+#ifndef PPC_CONFIG_RESERVED_AS_LOCAL
+  PPCRegister reserved;
+#endif
+  // Kernel state pointer for easy access from exports
+  rex::system::KernelState* kernel_state = nullptr;
+#ifndef PPC_CONFIG_SKIP_MSR
+  uint32_t msr = 0x200A000;
+#endif
+
+  // Non-volatile GPRs: saved/restored around calls, noticeably colder than
+  // the block above
 #ifndef PPC_CONFIG_NON_VOLATILE_AS_LOCAL
   PPCRegister r14;
   PPCRegister r15;
@@ -212,34 +294,6 @@ struct alignas(0x40) PPCContext {
   PPCRegister r31;
 #endif
 
-#ifndef PPC_CONFIG_SKIP_LR
-  uint64_t lr;
-#endif
-#ifndef PPC_CONFIG_CTR_AS_LOCAL
-  PPCRegister ctr;
-#endif
-#ifndef PPC_CONFIG_XER_AS_LOCAL
-  PPCXERRegister xer;
-#endif
-#ifndef PPC_CONFIG_RESERVED_AS_LOCAL
-  PPCRegister reserved;
-#endif
-#ifndef PPC_CONFIG_SKIP_MSR
-  uint32_t msr = 0x200A000;
-#endif
-#ifndef PPC_CONFIG_CR_AS_LOCAL
-  PPCCRRegister cr0;
-  PPCCRRegister cr1;
-  PPCCRRegister cr2;
-  PPCCRRegister cr3;
-  PPCCRRegister cr4;
-  PPCCRRegister cr5;
-  PPCCRRegister cr6;
-  PPCCRRegister cr7;
-#endif
-  PPCFPSCRRegister fpscr;
-  uint8_t vscr_sat = 0;  // VSCR saturation flag (for vector ops)
-
 #ifndef PPC_CONFIG_NON_ARGUMENT_AS_LOCAL
   PPCRegister f0;
 #endif
@@ -311,6 +365,13 @@ struct alignas(0x40) PPCContext {
   PPCVRegister v30;
   PPCVRegister v31;
 #endif
+
+  //===========================================================================
+  // Cold tail
+  //===========================================================================
+  // v32-v127 back the Xenon-specific wide VMX file; most titles touch a
+  // handful of them in isolated media loops, so they stay out of the lines
+  // the integer hot block lives in.
 #ifndef PPC_CONFIG_NON_ARGUMENT_AS_LOCAL
   PPCVRegister v32;
   PPCVRegister v33;
@@ -0,0 +1,43 @@
+/**
+ * @file        ppc/coverage.h
+ * @brief       Per-function call counters for recompiled guest code
+ *
+ * @copyright   Copyright (c) 2026 Tom Clay <tomc@tctechstuff.com>
+ *              All rights reserved.
+ *
+ * @license     BSD 3-Clause License
+ *              See LICENSE file in the project root for full license text.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include <rex/platform.h>
+
+namespace rex {
+
+// One of these per recompiled function when codegen runs with
+// emit_function_counters. They all land in a dedicated data section so the
+// runtime can walk them as an array without any registration at startup;
+// the cost per call is a single relaxed increment.
+struct PPCFuncCounter {
+  uint32_t guest_address;
+  std::atomic<uint64_t> count;
+};
+
+}  // namespace rex
+
+#if REX_PLATFORM_MAC
+#define PPC_FUNC_COUNTER_SECTION __attribute__((section("__DATA,rex_fn_cnt"), used))
+#else
+#define PPC_FUNC_COUNTER_SECTION __attribute__((section("rex_fn_counters"), used))
+#endif
+
+#define PPC_FUNC_COUNTER(addr)                                                 \
+  do {                                                                         \
+    static rex::PPCFuncCounter ppc_func_counter_ PPC_FUNC_COUNTER_SECTION = {  \
+        uint32_t(addr), {0}};                                                  \
+    ppc_func_counter_.count.fetch_add(1, std::memory_order_relaxed);           \
+  } while (0)
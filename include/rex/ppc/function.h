@@ -23,6 +23,7 @@
 #include <rex/logging.h>
 #include <rex/ppc/context.h>
 #include <rex/ppc/types.h>
+#include <rex/system/export_profiler.h>
 #include <rex/system/kernel_state.h>
 #include <rex/system/xmemory.h>
 #include <rex/types.h>
@@ -131,169 +132,141 @@ constexpr uint32_t PhysicalHostOffset([[maybe_unused]] uint32_t guest_addr) noex
 //=============================================================================
 
 struct ArgTranslator {
+  // Argument indices are template parameters so register selection resolves
+  // at compile time: every export trampoline instantiated by PPC_HOOK gets
+  // straight-line loads/stores with no runtime dispatch, even in unoptimized
+  // builds.
+
   // Get integer argument value from register or stack
-  static constexpr uint64_t GetIntegerArgumentValue(const PPCContext& ctx, uint8_t* base,
-                                                    size_t arg) noexcept {
-    if (arg <= 7) {
-      switch (arg) {
-        case 0:
-          return ctx.r3.u32;
-        case 1:
-          return ctx.r4.u32;
-        case 2:
-          return ctx.r5.u32;
-        case 3:
-          return ctx.r6.u32;
-        case 4:
-          return ctx.r7.u32;
-        case 5:
-          return ctx.r8.u32;
-        case 6:
-          return ctx.r9.u32;
-        case 7:
-          return ctx.r10.u32;
-        default:
-          break;
-      }
+  template <size_t Arg>
+  static constexpr uint64_t GetIntegerArgumentValue(const PPCContext& ctx,
+                                                    [[maybe_unused]] uint8_t* base) noexcept {
+    if constexpr (Arg == 0) {
+      return ctx.r3.u32;
+    } else if constexpr (Arg == 1) {
+      return ctx.r4.u32;
+    } else if constexpr (Arg == 2) {
+      return ctx.r5.u32;
+    } else if constexpr (Arg == 3) {
+      return ctx.r6.u32;
+    } else if constexpr (Arg == 4) {
+      return ctx.r7.u32;
+    } else if constexpr (Arg == 5) {
+      return ctx.r8.u32;
+    } else if constexpr (Arg == 6) {
+      return ctx.r9.u32;
+    } else if constexpr (Arg == 7) {
+      return ctx.r10.u32;
+    } else {
+      // Stack arguments at r1 + 0x54 + ((arg - 8) * 8)
+      return __builtin_bswap32(
+          *reinterpret_cast<uint32_t*>(base + ctx.r1.u32 + 0x54 + ((Arg - 8) * 8)));
     }
-    // Stack arguments at r1 + 0x54 + ((arg - 8) * 8)
-    return __builtin_bswap32(
-        *reinterpret_cast<uint32_t*>(base + ctx.r1.u32 + 0x54 + ((arg - 8) * 8)));
   }
 
   // Get float/double argument value from FPR
-  static double GetPrecisionArgumentValue(const PPCContext& ctx, [[maybe_unused]] uint8_t* base,
-                                          size_t arg) noexcept {
-    switch (arg) {
-      case 0:
-        return ctx.f1.f64;
-      case 1:
-        return ctx.f2.f64;
-      case 2:
-        return ctx.f3.f64;
-      case 3:
-        return ctx.f4.f64;
-      case 4:
-        return ctx.f5.f64;
-      case 5:
-        return ctx.f6.f64;
-      case 6:
-        return ctx.f7.f64;
-      case 7:
-        return ctx.f8.f64;
-      case 8:
-        return ctx.f9.f64;
-      case 9:
-        return ctx.f10.f64;
-      case 10:
-        return ctx.f11.f64;
-      case 11:
-        return ctx.f12.f64;
-      case 12:
-        return ctx.f13.f64;
-      [[unlikely]] default:
-        break;
+  template <size_t Arg>
+  static constexpr double GetPrecisionArgumentValue(const PPCContext& ctx) noexcept {
+    if constexpr (Arg == 0) {
+      return ctx.f1.f64;
+    } else if constexpr (Arg == 1) {
+      return ctx.f2.f64;
+    } else if constexpr (Arg == 2) {
+      return ctx.f3.f64;
+    } else if constexpr (Arg == 3) {
+      return ctx.f4.f64;
+    } else if constexpr (Arg == 4) {
+      return ctx.f5.f64;
+    } else if constexpr (Arg == 5) {
+      return ctx.f6.f64;
+    } else if constexpr (Arg == 6) {
+      return ctx.f7.f64;
+    } else if constexpr (Arg == 7) {
+      return ctx.f8.f64;
+    } else if constexpr (Arg == 8) {
+      return ctx.f9.f64;
+    } else if constexpr (Arg == 9) {
+      return ctx.f10.f64;
+    } else if constexpr (Arg == 10) {
+      return ctx.f11.f64;
+    } else if constexpr (Arg == 11) {
+      return ctx.f12.f64;
+    } else if constexpr (Arg == 12) {
+      return ctx.f13.f64;
+    } else {
+      return 0;
     }
-    return 0;
   }
 
   // Set integer argument value
-  static constexpr void SetIntegerArgumentValue(PPCContext& ctx, [[maybe_unused]] uint8_t* base,
-                                                size_t arg, uint64_t value) noexcept {
-    if (arg <= 7) {
-      switch (arg) {
-        case 0:
-          ctx.r3.u64 = value;
-          return;
-        case 1:
-          ctx.r4.u64 = value;
-          return;
-        case 2:
-          ctx.r5.u64 = value;
-          return;
-        case 3:
-          ctx.r6.u64 = value;
-          return;
-        case 4:
-          ctx.r7.u64 = value;
-          return;
-        case 5:
-          ctx.r8.u64 = value;
-          return;
-        case 6:
-          ctx.r9.u64 = value;
-          return;
-        case 7:
-          ctx.r10.u64 = value;
-          return;
-        [[unlikely]] default:
-          break;
-      }
+  template <size_t Arg>
+  static constexpr void SetIntegerArgumentValue(PPCContext& ctx,
+                                                [[maybe_unused]] uint64_t value) noexcept {
+    if constexpr (Arg == 0) {
+      ctx.r3.u64 = value;
+    } else if constexpr (Arg == 1) {
+      ctx.r4.u64 = value;
+    } else if constexpr (Arg == 2) {
+      ctx.r5.u64 = value;
+    } else if constexpr (Arg == 3) {
+      ctx.r6.u64 = value;
+    } else if constexpr (Arg == 4) {
+      ctx.r7.u64 = value;
+    } else if constexpr (Arg == 5) {
+      ctx.r8.u64 = value;
+    } else if constexpr (Arg == 6) {
+      ctx.r9.u64 = value;
+    } else if constexpr (Arg == 7) {
+      ctx.r10.u64 = value;
     }
   }
 
   // Set float/double argument value
-  static void SetPrecisionArgumentValue(PPCContext& ctx, [[maybe_unused]] uint8_t* base, size_t arg,
-                                        double value) noexcept {
-    switch (arg) {
-      case 0:
-        ctx.f1.f64 = value;
-        return;
-      case 1:
-        ctx.f2.f64 = value;
-        return;
-      case 2:
-        ctx.f3.f64 = value;
-        return;
-      case 3:
-        ctx.f4.f64 = value;
-        return;
-      case 4:
-        ctx.f5.f64 = value;
-        return;
-      case 5:
-        ctx.f6.f64 = value;
-        return;
-      case 6:
-        ctx.f7.f64 = value;
-        return;
-      case 7:
-        ctx.f8.f64 = value;
-        return;
-      case 8:
-        ctx.f9.f64 = value;
-        return;
-      case 9:
-        ctx.f10.f64 = value;
-        return;
-      case 10:
-        ctx.f11.f64 = value;
-        return;
-      case 11:
-        ctx.f12.f64 = value;
-        return;
-      case 12:
-        ctx.f13.f64 = value;
-        return;
-      [[unlikely]] default:
-        break;
+  template <size_t Arg>
+  static constexpr void SetPrecisionArgumentValue(PPCContext& ctx,
+                                                  [[maybe_unused]] double value) noexcept {
+    if constexpr (Arg == 0) {
+      ctx.f1.f64 = value;
+    } else if constexpr (Arg == 1) {
+      ctx.f2.f64 = value;
+    } else if constexpr (Arg == 2) {
+      ctx.f3.f64 = value;
+    } else if constexpr (Arg == 3) {
+      ctx.f4.f64 = value;
+    } else if constexpr (Arg == 4) {
+      ctx.f5.f64 = value;
+    } else if constexpr (Arg == 5) {
+      ctx.f6.f64 = value;
+    } else if constexpr (Arg == 6) {
+      ctx.f7.f64 = value;
+    } else if constexpr (Arg == 7) {
+      ctx.f8.f64 = value;
+    } else if constexpr (Arg == 8) {
+      ctx.f9.f64 = value;
+    } else if constexpr (Arg == 9) {
+      ctx.f10.f64 = value;
+    } else if constexpr (Arg == 10) {
+      ctx.f11.f64 = value;
+    } else if constexpr (Arg == 11) {
+      ctx.f12.f64 = value;
+    } else if constexpr (Arg == 12) {
+      ctx.f13.f64 = value;
     }
   }
 
   // Get typed value (be<T> types)
-  template <BigEndianType T>
-  static constexpr T GetValue(PPCContext& ctx, uint8_t* base, size_t idx) noexcept {
+  template <BigEndianType T, size_t Idx>
+  static constexpr T GetValue(PPCContext& ctx, uint8_t* base) noexcept {
     T result;
-    result.value = static_cast<decltype(result.value)>(GetIntegerArgumentValue(ctx, base, idx));
+    result.value = static_cast<decltype(result.value)>(GetIntegerArgumentValue<Idx>(ctx, base));
     return result;
   }
 
   // Get typed value (PPCPointer<T>)
-  template <PPCPointerType T>
-  static T GetValue(PPCContext& ctx, uint8_t* base, size_t idx) noexcept {
+  template <PPCPointerType T, size_t Idx>
+  static T GetValue(PPCContext& ctx, uint8_t* base) noexcept {
     using inner_t = typename ppc_pointer_inner_type<T>::type;
-    const auto v = GetIntegerArgumentValue(ctx, base, idx);
-    g_memory_base = base;
+    const auto v = GetIntegerArgumentValue<Idx>(ctx, base);
     if (!v) {
       return T(nullptr);
     }
@@ -304,31 +277,31 @@ struct ArgTranslator {
   }
 
   // Get typed value (PPCValue<T>)
-  template <PPCValueType T>
-  static constexpr T GetValue(PPCContext& ctx, uint8_t* base, size_t idx) noexcept {
+  template <PPCValueType T, size_t Idx>
+  static constexpr T GetValue(PPCContext& ctx, uint8_t* base) noexcept {
     using inner_t = typename ppc_value_inner_type<T>::type;
     if constexpr (is_precise_v<inner_t>) {
-      return T(static_cast<inner_t>(GetPrecisionArgumentValue(ctx, base, idx)));
+      return T(static_cast<inner_t>(GetPrecisionArgumentValue<Idx>(ctx)));
     } else {
-      return T(static_cast<inner_t>(GetIntegerArgumentValue(ctx, base, idx)));
+      return T(static_cast<inner_t>(GetIntegerArgumentValue<Idx>(ctx, base)));
     }
   }
 
   // Get typed value (non-pointer, non-be<T>, non-PPCPointer, non-PPCValue)
-  template <PlainType T>
-  static constexpr T GetValue(PPCContext& ctx, uint8_t* base, size_t idx) noexcept {
+  template <PlainType T, size_t Idx>
+  static constexpr T GetValue(PPCContext& ctx, uint8_t* base) noexcept {
     if constexpr (is_precise_v<T>) {
-      return static_cast<T>(GetPrecisionArgumentValue(ctx, base, idx));
+      return static_cast<T>(GetPrecisionArgumentValue<Idx>(ctx));
     } else {
-      return static_cast<T>(GetIntegerArgumentValue(ctx, base, idx));
+      return static_cast<T>(GetIntegerArgumentValue<Idx>(ctx, base));
     }
   }
 
   // Get typed value (pointer - translates guest address to host pointer)
-  template <typename T>
+  template <typename T, size_t Idx>
     requires std::is_pointer_v<T>
-  static constexpr T GetValue(PPCContext& ctx, uint8_t* base, size_t idx) noexcept {
-    const auto v = GetIntegerArgumentValue(ctx, base, idx);
+  static constexpr T GetValue(PPCContext& ctx, uint8_t* base) noexcept {
+    const auto v = GetIntegerArgumentValue<Idx>(ctx, base);
     if (!v) {
       return nullptr;
     }
@@ -337,18 +310,18 @@ struct ArgTranslator {
   }
 
   // Set typed value
-  template <typename T>
-  static constexpr void SetValue(PPCContext& ctx, uint8_t* base, size_t idx, T value) noexcept {
+  template <typename T, size_t Idx>
+  static constexpr void SetValue(PPCContext& ctx, uint8_t* base, T value) noexcept {
     if constexpr (is_precise_v<T>) {
-      SetPrecisionArgumentValue(ctx, base, idx, value);
+      SetPrecisionArgumentValue<Idx>(ctx, value);
     } else if constexpr (std::is_null_pointer_v<T>) {
-      SetIntegerArgumentValue(ctx, base, idx, 0);
+      SetIntegerArgumentValue<Idx>(ctx, 0);
     } else if constexpr (std::is_pointer_v<T>) {
-      SetIntegerArgumentValue(ctx, base, idx,
-                              static_cast<uint32_t>(reinterpret_cast<uintptr_t>(value) -
-                                                    reinterpret_cast<uintptr_t>(base)));
+      SetIntegerArgumentValue<Idx>(ctx,
+                                   static_cast<uint32_t>(reinterpret_cast<uintptr_t>(value) -
+                                                         reinterpret_cast<uintptr_t>(base)));
     } else {
-      SetIntegerArgumentValue(ctx, base, idx, value);
+      SetIntegerArgumentValue<Idx>(ctx, value);
     }
   }
 };
@@ -426,7 +399,7 @@ template <auto Func, int I = 0, typename... TArgs>
   requires(I < sizeof...(TArgs))
 void _translate_args_to_host(PPCContext& ctx, uint8_t* base, std::tuple<TArgs...>& tpl) noexcept {
   using T = std::tuple_element_t<I, std::remove_reference_t<decltype(tpl)>>;
-  std::get<I>(tpl) = ArgTranslator::GetValue<T>(ctx, base, arg_ordinal_t<Func, I>::value);
+  std::get<I>(tpl) = ArgTranslator::GetValue<T, arg_ordinal_t<Func, I>::value>(ctx, base);
   _translate_args_to_host<Func, I + 1>(ctx, base, tpl);
 }
 
@@ -439,8 +412,8 @@ template <int I = 0, typename... TArgs>
   requires(I < sizeof...(TArgs))
 void _translate_args_to_guest(PPCContext& ctx, uint8_t* base, std::tuple<TArgs...>& tpl) noexcept {
   using T = std::tuple_element_t<I, std::remove_reference_t<decltype(tpl)>>;
-  ArgTranslator::SetValue<T>(ctx, base, GatherFunctionArgumentsFromTypes<TArgs...>()[I].ordinal,
-                             std::get<I>(tpl));
+  constexpr auto kArguments = GatherFunctionArgumentsFromTypes<TArgs...>();
+  ArgTranslator::SetValue<T, kArguments[I].ordinal>(ctx, base, std::get<I>(tpl));
   _translate_args_to_guest<I + 1>(ctx, base, tpl);
 }
 
@@ -555,9 +528,10 @@ T GuestToHostFunction(const TFunction& func, TArgs&&... argv) {
 //=============================================================================
 
 // Hook a PPC function name to a native C++ function
-#define PPC_HOOK(subroutine, function)             \
-  extern "C" PPC_FUNC(subroutine) {                \
-    rex::HostToGuestFunction<function>(ctx, base); \
+#define PPC_HOOK(subroutine, function)                                       \
+  extern "C" PPC_FUNC(subroutine) {                                          \
+    rex::runtime::ExportCallTimer profiler_timer_(#subroutine, ctx.lr);      \
+    rex::HostToGuestFunction<function>(ctx, base);                           \
   }
 
 // Create a simple stub that does nothing
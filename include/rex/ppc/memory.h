@@ -15,12 +15,14 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <climits>
 #include <cmath>
 #include <cstdint>
 #include <cstring>
 
 #include <simde/x86/avx.h>
+#include <simde/x86/avx2.h>
 #include <simde/x86/sse.h>
 #include <simde/x86/sse4.1.h>
 
@@ -30,44 +32,64 @@
 //=============================================================================
 // Physical Heap Offset (Windows Granularity Workaround)
 //=============================================================================
-// On Windows, allocation granularity is 64KB, so the 0x1000 file offset for
-// the 0xE0 physical heap gets masked away. We compensate by adding 0x1000
-// to host addresses when the guest address is >= 0xE0000000.
-//=============================================================================
-// TODO(tomc): there has to be a better way to handle this than shlittering PPC_PHYS_HOST_OFFSET()
-// everywhere and adding it to every single memory access.
-// Maybe a separate base pointer for the 0xE0 heap?
+// The 0xE0 physical heap aliases the physical pages at a +0x1000 shift. On
+// Linux mmap maps the view at file offset 0x100001000 directly, so host
+// address is always a plain base+offset add and this macro is constant 0.
+// On Windows that view cannot exist: section offsets are 64KB-granular for
+// MapViewOfFileEx and MapViewOfFile3 alike, so a 4KB-shifted alias of the
+// same pages is unmappable and the shift must be applied per access. The
+// expression below is plain shift/mask arithmetic rather than a compare so
+// it never costs a branch (or even flags) in hot guest loads: the +1 carries
+// out of the top 3 address bits only for 0xE0000000 and above.
 //=============================================================================
 #if REX_PLATFORM_WIN32
-#define PPC_PHYS_HOST_OFFSET(addr) (((uint32_t)(addr) >= 0xE0000000u) ? 0x1000u : 0u)
+#define PPC_PHYS_HOST_OFFSET(addr) (((((uint32_t)(addr) >> 29) + 1u) & 8u) << 9)
 #else
-#define PPC_PHYS_HOST_OFFSET(addr) 0u  // Linux has 4KB granularity, file offset works
+#define PPC_PHYS_HOST_OFFSET(addr) 0u  // View mapped at the exact file offset
 #endif
 
 // Raw address calculation with physical offset (for operations that don't use PPC_LOAD/PPC_STORE)
 #define PPC_RAW_ADDR(x) (base + (uint32_t)(x) + PPC_PHYS_HOST_OFFSET(x))
 
+//=============================================================================
+// Plain Memory Access Qualifier
+//=============================================================================
+// Plain guest accesses are non-volatile by default so the host compiler can
+// combine, reorder, and vectorize adjacent loads/stores - volatile here
+// deoptimized every guest loop. MMIO never relied on this qualifier: sites
+// the recompiler identifies as MMIO candidates are emitted against the
+// PPC_MM_* macros below, which always take the volatile/handler path.
+// PPC_CONFIG_VOLATILE_MEMORY (volatile_memory in the project config) restores
+// the old always-volatile behaviour for titles that depend on it, e.g. for
+// cross-thread polling loops the compiler would otherwise hoist.
+
+#ifdef PPC_CONFIG_VOLATILE_MEMORY
+#define PPC_MEM_QUAL volatile
+#else
+#define PPC_MEM_QUAL
+#endif
+
 //=============================================================================
 // Load Macros (Big-Endian to Host)
 //=============================================================================
 
 #ifndef PPC_LOAD_U8
-#define PPC_LOAD_U8(x) (*(volatile uint8_t*)(base + (uint32_t)(x) + PPC_PHYS_HOST_OFFSET(x)))
+#define PPC_LOAD_U8(x) (*(PPC_MEM_QUAL uint8_t*)(base + (uint32_t)(x) + PPC_PHYS_HOST_OFFSET(x)))
 #endif
 
 #ifndef PPC_LOAD_U16
 #define PPC_LOAD_U16(x) \
-  __builtin_bswap16(*(volatile uint16_t*)(base + (uint32_t)(x) + PPC_PHYS_HOST_OFFSET(x)))
+  __builtin_bswap16(*(PPC_MEM_QUAL uint16_t*)(base + (uint32_t)(x) + PPC_PHYS_HOST_OFFSET(x)))
 #endif
 
 #ifndef PPC_LOAD_U32
 #define PPC_LOAD_U32(x) \
-  __builtin_bswap32(*(volatile uint32_t*)(base + (uint32_t)(x) + PPC_PHYS_HOST_OFFSET(x)))
+  __builtin_bswap32(*(PPC_MEM_QUAL uint32_t*)(base + (uint32_t)(x) + PPC_PHYS_HOST_OFFSET(x)))
 #endif
 
 #ifndef PPC_LOAD_U64
 #define PPC_LOAD_U64(x) \
-  __builtin_bswap64(*(volatile uint64_t*)(base + (uint32_t)(x) + PPC_PHYS_HOST_OFFSET(x)))
+  __builtin_bswap64(*(PPC_MEM_QUAL uint64_t*)(base + (uint32_t)(x) + PPC_PHYS_HOST_OFFSET(x)))
 #endif
 
 #ifndef PPC_LOAD_STRING
@@ -82,22 +104,96 @@
 
 #ifndef PPC_STORE_U8
 #define PPC_STORE_U8(x, y) \
-  (*(volatile uint8_t*)(base + (uint32_t)(x) + PPC_PHYS_HOST_OFFSET(x)) = (y))
+  (*(PPC_MEM_QUAL uint8_t*)(base + (uint32_t)(x) + PPC_PHYS_HOST_OFFSET(x)) = (y))
 #endif
 
 #ifndef PPC_STORE_U16
 #define PPC_STORE_U16(x, y) \
-  (*(volatile uint16_t*)(base + (uint32_t)(x) + PPC_PHYS_HOST_OFFSET(x)) = __builtin_bswap16(y))
+  (*(PPC_MEM_QUAL uint16_t*)(base + (uint32_t)(x) + PPC_PHYS_HOST_OFFSET(x)) = __builtin_bswap16(y))
 #endif
 
 #ifndef PPC_STORE_U32
 #define PPC_STORE_U32(x, y) \
-  (*(volatile uint32_t*)(base + (uint32_t)(x) + PPC_PHYS_HOST_OFFSET(x)) = __builtin_bswap32(y))
+  (*(PPC_MEM_QUAL uint32_t*)(base + (uint32_t)(x) + PPC_PHYS_HOST_OFFSET(x)) = __builtin_bswap32(y))
 #endif
 
 #ifndef PPC_STORE_U64
 #define PPC_STORE_U64(x, y) \
-  (*(volatile uint64_t*)(base + (uint32_t)(x) + PPC_PHYS_HOST_OFFSET(x)) = __builtin_bswap64(y))
+  (*(PPC_MEM_QUAL uint64_t*)(base + (uint32_t)(x) + PPC_PHYS_HOST_OFFSET(x)) = __builtin_bswap64(y))
+#endif
+
+//=============================================================================
+// Raw Copy Macros (Guest to Guest, No Byte Swap)
+//=============================================================================
+// A value loaded and stored back to guest memory unchanged keeps its byte
+// order, so the swap/unswap round trip of PPC_LOAD/PPC_STORE is dead work.
+// Codegen emits these for such load/store pairs.
+
+#ifndef PPC_COPY_U16
+#define PPC_COPY_U16(dst, src)                                                    \
+  (*(PPC_MEM_QUAL uint16_t*)(base + (uint32_t)(dst) + PPC_PHYS_HOST_OFFSET(dst)) = \
+       *(PPC_MEM_QUAL uint16_t*)(base + (uint32_t)(src) + PPC_PHYS_HOST_OFFSET(src)))
+#endif
+
+#ifndef PPC_COPY_U32
+#define PPC_COPY_U32(dst, src)                                                    \
+  (*(PPC_MEM_QUAL uint32_t*)(base + (uint32_t)(dst) + PPC_PHYS_HOST_OFFSET(dst)) = \
+       *(PPC_MEM_QUAL uint32_t*)(base + (uint32_t)(src) + PPC_PHYS_HOST_OFFSET(src)))
+#endif
+
+#ifndef PPC_COPY_U64
+#define PPC_COPY_U64(dst, src)                                                    \
+  (*(PPC_MEM_QUAL uint64_t*)(base + (uint32_t)(dst) + PPC_PHYS_HOST_OFFSET(dst)) = \
+       *(PPC_MEM_QUAL uint64_t*)(base + (uint32_t)(src) + PPC_PHYS_HOST_OFFSET(src)))
+#endif
+
+//=============================================================================
+// Reservations (lwarx/ldarx + stwcx./stdcx.)
+//=============================================================================
+// Lock-free reservation tracking. Every 64-byte guest granule hashes to an
+// atomic sequence counter: lwarx snapshots the counter alongside the value,
+// and stwcx. commits with a single compare-exchange only while the counter
+// is unchanged, then bumps it to invalidate every other thread's reservation
+// on that granule. The value compare-exchange on top of the sequence check
+// keeps the store atomic even when a plain store raced into the granule
+// between the two counter reads.
+
+inline std::atomic<uint32_t>& ppc_reservation_granule_(uint32_t ea) {
+  // 64K counters over 64-byte granules. A hash collision can only cause a
+  // spurious stwcx. failure, which the guest retry loop absorbs.
+  static std::atomic<uint32_t> granules[0x10000]{};
+  return granules[((uint32_t)(ea) >> 6) & 0xFFFFu];
+}
+
+// One outstanding reservation per hardware thread, matching the PPC model.
+inline uint32_t& ppc_reservation_seq_() {
+  static thread_local uint32_t seq = 0;
+  return seq;
+}
+
+#ifndef PPC_LOAD_RESERVED
+#define PPC_LOAD_RESERVED(type, x)                                                           \
+  ([&]() -> type {                                                                           \
+    ppc_reservation_seq_() = ppc_reservation_granule_(x).load(std::memory_order_acquire);    \
+    return *reinterpret_cast<volatile type*>(PPC_RAW_ADDR(x));                               \
+  }())
+#endif
+
+#ifndef PPC_STORE_CONDITIONAL
+#define PPC_STORE_CONDITIONAL(type, x, expected, desired)                                    \
+  ([&]() -> uint8_t {                                                                        \
+    auto& granule_ = ppc_reservation_granule_(x);                                            \
+    uint32_t seq_ = ppc_reservation_seq_();                                                  \
+    if (granule_.load(std::memory_order_relaxed) != seq_)                                    \
+      return 0;                                                                              \
+    type expected_ = (type)(expected);                                                       \
+    if (!__atomic_compare_exchange_n(reinterpret_cast<type*>(PPC_RAW_ADDR(x)), &expected_,   \
+                                     (type)(desired), false, __ATOMIC_SEQ_CST,               \
+                                     __ATOMIC_RELAXED))                                      \
+      return 0;                                                                              \
+    granule_.compare_exchange_strong(seq_, seq_ + 1, std::memory_order_release);             \
+    return 1;                                                                                \
+  }())
 #endif
 
 //=============================================================================
@@ -336,6 +432,24 @@ struct FrsqrteLUT {
 
 inline constexpr FrsqrteLUT ppu_frsqrte_lut{};
 
+//=============================================================================
+// Pooled Vector Constants
+//=============================================================================
+// The recompiler emits references to these by symbol instead of repeating the
+// same splat literal in every function. Each set1 literal the host compiler
+// sees becomes a 16-byte .rodata object per translation unit; with tens of
+// thousands of generated functions those copies add up and compete for
+// d-cache lines. One inline definition collapses each mask to a single
+// object shared by every generated unit.
+
+// Sign bit of each 32-bit lane (vnmsubfp negation, unsigned compare bias)
+inline const simde__m128i VectorSignMask32 = simde_mm_set1_epi32(int(0x80000000));
+inline const simde__m128 VectorSignMaskPS = simde_mm_castsi128_ps(VectorSignMask32);
+
+// Low byte of each halfword / low halfword of each word (vpkuhum, vpkuwum)
+inline const simde__m128i VectorByteMask16 = simde_mm_set1_epi16(0xFF);
+inline const simde__m128i VectorHalfMask32 = simde_mm_set1_epi32(0xFFFF);
+
 //=============================================================================
 // SIMD Helper Functions
 //=============================================================================
@@ -457,14 +571,12 @@ inline simde__m128i simde_mm_vsr(simde__m128i a, simde__m128i b) {
 // Vector Shift Left - shift entire 128-bit vector left by bits in low 3 bits of b
 inline simde__m128i simde_mm_vsl(simde__m128i a, simde__m128i b) {
   int shift = simde_mm_extract_epi8(b, 15) & 0x7;  // Get low 3 bits from byte 15 (BE: byte 0)
-  if (shift == 0)
-    return a;
-  // Use runtime shift via uint64 to avoid constexpr requirement on ARM NEON
-  alignas(16) uint64_t src[2], dst[2];
-  simde_mm_store_si128(reinterpret_cast<simde__m128i*>(src), a);
-  dst[0] = (src[0] << shift) | (src[1] >> (64 - shift));
-  dst[1] = src[1] << shift;
-  return simde_mm_load_si128(reinterpret_cast<const simde__m128i*>(dst));
+  // Branchless: both qwords shift left, then the bits that fell between them
+  // get pulled across with a count-register shift. At shift == 0 the carry
+  // count is 64, which the srl by-register form defines as producing zero.
+  simde__m128i carry =
+      simde_mm_srl_epi64(simde_mm_srli_si128(a, 8), simde_mm_cvtsi32_si128(64 - shift));
+  return simde_mm_or_si128(simde_mm_sll_epi64(a, simde_mm_cvtsi32_si128(shift)), carry);
 }
 
 // Vector Shift Left by Octet - shift entire vector left by bytes in bits [121:124] of vB
@@ -473,15 +585,10 @@ inline simde__m128i simde_mm_vsl(simde__m128i a, simde__m128i b) {
 // PPC left shift = shift towards MSB (lower PPC addresses) = shift towards higher x86 addresses
 inline simde__m128i simde_mm_vslo(simde__m128i a, simde__m128i b) {
   int shift_bytes = (simde_mm_extract_epi8(b, 0) >> 3) & 0xF;
-  if (shift_bytes == 0)
-    return a;
-  if (shift_bytes >= 16)
-    return simde_mm_setzero_si128();
-  alignas(16) uint8_t src[16], dst[16];
-  simde_mm_store_si128((simde__m128i*)src, a);
-  memset(dst, 0, sizeof(dst));
-  memcpy(dst + shift_bytes, src, 16 - shift_bytes);
-  return simde_mm_load_si128((simde__m128i*)dst);
+  // dst[i] = src[i - shift] via pshufb; lanes where i < shift wrap to 0xF1..
+  // 0xFF, whose sign bit makes the shuffle zero them.
+  simde__m128i iota = simde_mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  return simde_mm_shuffle_epi8(a, simde_mm_sub_epi8(iota, simde_mm_set1_epi8(int8_t(shift_bytes))));
 }
 
 // Vector Shift Right by Octet - shift entire vector right by bytes in bits [121:124] of vB
@@ -490,15 +597,149 @@ inline simde__m128i simde_mm_vslo(simde__m128i a, simde__m128i b) {
 // PPC right shift = shift towards LSB (higher PPC addresses) = shift towards lower x86 addresses
 inline simde__m128i simde_mm_vsro(simde__m128i a, simde__m128i b) {
   int shift_bytes = (simde_mm_extract_epi8(b, 0) >> 3) & 0xF;
-  if (shift_bytes == 0)
-    return a;
-  if (shift_bytes >= 16)
-    return simde_mm_setzero_si128();
-  alignas(16) uint8_t src[16], dst[16];
-  simde_mm_store_si128((simde__m128i*)src, a);
-  memset(dst, 0, sizeof(dst));
-  memcpy(dst, src + shift_bytes, 16 - shift_bytes);
-  return simde_mm_load_si128((simde__m128i*)dst);
+  // dst[i] = src[i + shift] via pshufb; indices past 15 don't carry the sign
+  // bit on their own, so force it with a compare to zero those lanes.
+  simde__m128i iota = simde_mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  simde__m128i idx = simde_mm_add_epi8(iota, simde_mm_set1_epi8(int8_t(shift_bytes)));
+  idx = simde_mm_or_si128(idx, simde_mm_cmpgt_epi8(idx, simde_mm_set1_epi8(15)));
+  return simde_mm_shuffle_epi8(a, idx);
+}
+
+//=============================================================================
+// Per-Element Variable Shifts and Rotates (vslb/vsrb/vsrab family)
+//=============================================================================
+// The 32-bit forms map straight to AVX2/NEON variable shifts through simde;
+// shift counts are masked to the element width as VMX requires. The byte
+// forms turn the shift into a multiply by a pshufb-looked-up power of two
+// (a << s == a * 2^s; a >> s == (a * 2^(7-s)) >> 7, which fits a 16-bit
+// product), and the halfword forms widen even/odd lanes into the 32-bit
+// variable shifts - no lane loops, no memory round-trips.
+//=============================================================================
+
+// Per-byte power-of-two LUTs for the multiply-based shifts; only indices 0-7
+// are ever selected since byte shift counts are masked to 3 bits.
+inline simde__m128i detail_vec_pow2_lo_() {
+  return simde_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, int8_t(0x80), 1, 2, 4, 8, 16, 32, 64,
+                            int8_t(0x80));
+}
+inline simde__m128i detail_vec_pow2_hi_() {
+  return simde_mm_setr_epi8(int8_t(0x80), 64, 32, 16, 8, 4, 2, 1, int8_t(0x80), 64, 32, 16, 8, 4, 2,
+                            1);
+}
+
+// Per-byte variable shift left (vslb); counts use the low 3 bits of each byte
+inline simde__m128i simde_mm_sllv_epi8_(simde__m128i a, simde__m128i b) {
+  simde__m128i pow = simde_mm_shuffle_epi8(detail_vec_pow2_lo_(),
+                                           simde_mm_and_si128(b, simde_mm_set1_epi8(0x7)));
+  simde__m128i lo_mask = simde_mm_set1_epi16(0x00FF);
+  simde__m128i even = simde_mm_and_si128(
+      simde_mm_mullo_epi16(simde_mm_and_si128(a, lo_mask), simde_mm_and_si128(pow, lo_mask)),
+      lo_mask);
+  simde__m128i odd = simde_mm_slli_epi16(
+      simde_mm_mullo_epi16(simde_mm_srli_epi16(a, 8), simde_mm_srli_epi16(pow, 8)), 8);
+  return simde_mm_or_si128(even, odd);
+}
+
+// Per-byte variable logical shift right (vsrb)
+inline simde__m128i simde_mm_srlv_epi8_(simde__m128i a, simde__m128i b) {
+  simde__m128i pow = simde_mm_shuffle_epi8(detail_vec_pow2_hi_(),
+                                           simde_mm_and_si128(b, simde_mm_set1_epi8(0x7)));
+  simde__m128i lo_mask = simde_mm_set1_epi16(0x00FF);
+  simde__m128i even = simde_mm_srli_epi16(
+      simde_mm_mullo_epi16(simde_mm_and_si128(a, lo_mask), simde_mm_and_si128(pow, lo_mask)), 7);
+  simde__m128i odd = simde_mm_slli_epi16(
+      simde_mm_srli_epi16(
+          simde_mm_mullo_epi16(simde_mm_srli_epi16(a, 8), simde_mm_srli_epi16(pow, 8)), 7),
+      8);
+  return simde_mm_or_si128(even, odd);
+}
+
+// Per-byte variable arithmetic shift right (vsrab); bias to unsigned, shift
+// logically, then subtract the shifted bias (2^(7-s), the hi LUT value)
+inline simde__m128i simde_mm_srav_epi8_(simde__m128i a, simde__m128i b) {
+  simde__m128i biased = simde_mm_srlv_epi8_(simde_mm_xor_si128(a, simde_mm_set1_epi8(char(128))), b);
+  simde__m128i bias = simde_mm_shuffle_epi8(detail_vec_pow2_hi_(),
+                                            simde_mm_and_si128(b, simde_mm_set1_epi8(0x7)));
+  return simde_mm_sub_epi8(biased, bias);
+}
+
+// Per-halfword variable shift left (vslh); counts use the low 4 bits
+inline simde__m128i simde_mm_sllv_epi16_(simde__m128i a, simde__m128i b) {
+  simde__m128i lo_mask = simde_mm_set1_epi32(0x0000FFFF);
+  simde__m128i even =
+      simde_mm_sllv_epi32(simde_mm_and_si128(a, lo_mask),
+                          simde_mm_and_si128(b, simde_mm_set1_epi32(0xF)));
+  simde__m128i odd = simde_mm_sllv_epi32(
+      simde_mm_srli_epi32(a, 16),
+      simde_mm_and_si128(simde_mm_srli_epi32(b, 16), simde_mm_set1_epi32(0xF)));
+  return simde_mm_or_si128(simde_mm_and_si128(even, lo_mask), simde_mm_slli_epi32(odd, 16));
+}
+
+// Per-halfword variable logical shift right (vsrh)
+inline simde__m128i simde_mm_srlv_epi16_(simde__m128i a, simde__m128i b) {
+  simde__m128i lo_mask = simde_mm_set1_epi32(0x0000FFFF);
+  simde__m128i even =
+      simde_mm_srlv_epi32(simde_mm_and_si128(a, lo_mask),
+                          simde_mm_and_si128(b, simde_mm_set1_epi32(0xF)));
+  simde__m128i odd = simde_mm_srlv_epi32(
+      simde_mm_srli_epi32(a, 16),
+      simde_mm_and_si128(simde_mm_srli_epi32(b, 16), simde_mm_set1_epi32(0xF)));
+  return simde_mm_or_si128(even, simde_mm_slli_epi32(odd, 16));
+}
+
+// Per-halfword variable arithmetic shift right (vsrah)
+inline simde__m128i simde_mm_srav_epi16_(simde__m128i a, simde__m128i b) {
+  simde__m128i even =
+      simde_mm_srav_epi32(simde_mm_srai_epi32(simde_mm_slli_epi32(a, 16), 16),
+                          simde_mm_and_si128(b, simde_mm_set1_epi32(0xF)));
+  simde__m128i odd = simde_mm_srav_epi32(
+      simde_mm_srai_epi32(a, 16),
+      simde_mm_and_si128(simde_mm_srli_epi32(b, 16), simde_mm_set1_epi32(0xF)));
+  return simde_mm_or_si128(simde_mm_and_si128(even, simde_mm_set1_epi32(0x0000FFFF)),
+                           simde_mm_slli_epi32(odd, 16));
+}
+
+// Per-halfword variable rotate left (vrlh); duplicate the halfword into a
+// 32-bit lane, then rol(v, s) == (v:v) >> (16 - s), exact at s == 0 too
+inline simde__m128i simde_mm_rolv_epi16_(simde__m128i a, simde__m128i b) {
+  simde__m128i lo_mask = simde_mm_set1_epi32(0x0000FFFF);
+  simde__m128i sixteen = simde_mm_set1_epi32(16);
+  simde__m128i even_v = simde_mm_and_si128(a, lo_mask);
+  simde__m128i even_sh =
+      simde_mm_sub_epi32(sixteen, simde_mm_and_si128(b, simde_mm_set1_epi32(0xF)));
+  simde__m128i even = simde_mm_and_si128(
+      simde_mm_srlv_epi32(simde_mm_or_si128(even_v, simde_mm_slli_epi32(even_v, 16)), even_sh),
+      lo_mask);
+  simde__m128i odd_v = simde_mm_srli_epi32(a, 16);
+  simde__m128i odd_sh = simde_mm_sub_epi32(
+      sixteen, simde_mm_and_si128(simde_mm_srli_epi32(b, 16), simde_mm_set1_epi32(0xF)));
+  simde__m128i odd = simde_mm_and_si128(
+      simde_mm_srlv_epi32(simde_mm_or_si128(odd_v, simde_mm_slli_epi32(odd_v, 16)), odd_sh),
+      lo_mask);
+  return simde_mm_or_si128(even, simde_mm_slli_epi32(odd, 16));
+}
+
+// Per-word variable shift left (vslw); counts use the low 5 bits
+inline simde__m128i simde_mm_sllv_epi32_(simde__m128i a, simde__m128i b) {
+  return simde_mm_sllv_epi32(a, simde_mm_and_si128(b, simde_mm_set1_epi32(0x1F)));
+}
+
+// Per-word variable logical shift right (vsrw)
+inline simde__m128i simde_mm_srlv_epi32_(simde__m128i a, simde__m128i b) {
+  return simde_mm_srlv_epi32(a, simde_mm_and_si128(b, simde_mm_set1_epi32(0x1F)));
+}
+
+// Per-word variable arithmetic shift right (vsraw)
+inline simde__m128i simde_mm_srav_epi32_(simde__m128i a, simde__m128i b) {
+  return simde_mm_srav_epi32(a, simde_mm_and_si128(b, simde_mm_set1_epi32(0x1F)));
+}
+
+// Per-word variable rotate left (vrlw); (32 - sh) & 0x1F keeps sh == 0 exact
+inline simde__m128i simde_mm_rolv_epi32_(simde__m128i a, simde__m128i b) {
+  simde__m128i sh = simde_mm_and_si128(b, simde_mm_set1_epi32(0x1F));
+  simde__m128i shr = simde_mm_and_si128(simde_mm_sub_epi32(simde_mm_set1_epi32(32), sh),
+                                        simde_mm_set1_epi32(0x1F));
+  return simde_mm_or_si128(simde_mm_sllv_epi32(a, sh), simde_mm_srlv_epi32(a, shr));
 }
 
 //=============================================================================
@@ -530,3 +771,7 @@ using rex::VectorMaskL;
 using rex::VectorMaskR;
 using rex::VectorShiftTableL;
 using rex::VectorShiftTableR;
+using rex::VectorByteMask16;
+using rex::VectorHalfMask32;
+using rex::VectorSignMask32;
+using rex::VectorSignMaskPS;
@@ -42,14 +42,28 @@ class BitStream {
   // Note: num_bits MUST be in the range 0-57 (inclusive)
   uint64_t Peek(size_t num_bits);
   uint64_t Read(size_t num_bits);
+  // Reads count fields of the given bit widths in order. Fields totalling 57
+  // bits or less are extracted from a single cached-window load instead of
+  // one per field.
+  void ReadMany(const uint8_t* field_bits, uint64_t* out_values, size_t count);
   bool Write(uint64_t val, size_t num_bits);  // TODO(DrChat): Not tested!
 
   size_t Copy(uint8_t* dest_buffer, size_t num_bits);
 
  private:
+  // Reloads the cached window at the byte containing the current offset.
+  void RefillWindow();
+
   uint8_t* buffer_ = nullptr;
   size_t offset_bits_ = 0;
   size_t size_bits_ = 0;
+
+  // Cached byte-swapped 64-bit load starting at window_base_bits_ (byte
+  // aligned). Consecutive small reads - the XMA frame parser does one per
+  // syllable - share a single load+swap instead of paying one each.
+  uint64_t window_ = 0;
+  size_t window_base_bits_ = 0;
+  bool window_valid_ = false;
 };
 
 //=============================================================================
@@ -65,6 +79,22 @@ class ByteStream {
   void Read(std::span<uint8_t> buf);
   void Write(std::span<const uint8_t> buf);
 
+  // Reads num_bytes as a borrowed view into the underlying buffer, without
+  // copying. The view stays valid for the lifetime of the buffer, not just
+  // the stream position, so large payloads (heap pages, thread stacks) can be
+  // consumed in place.
+  std::span<const uint8_t> ReadView(size_t num_bytes);
+
+  // Reserves num_bytes at the current offset for in-place writing. Fill the
+  // returned span (or a prefix of it) and then Commit() the bytes actually
+  // produced - this lets producers serialize straight into the stream instead
+  // of staging through a temporary buffer.
+  std::span<uint8_t> Reserve(size_t num_bytes);
+  void Commit(size_t num_bytes);
+
+  // Writes multiple buffers back to back with a single bounds check.
+  void WriteVectored(std::span<const std::span<const uint8_t>> bufs);
+
   // Convenience overloads for void* (legacy compatibility)
   void Read(void* buf, size_t len) {
     return Read(std::span<uint8_t>(reinterpret_cast<uint8_t*>(buf), len));
@@ -106,6 +136,8 @@ class ByteStream {
   uint8_t* data_ = nullptr;
   size_t data_length_ = 0;
   size_t offset_ = 0;
+  // Length of the currently open Reserve(), SIZE_MAX when none is open.
+  size_t reserved_length_ = SIZE_MAX;
 };
 
 template <>
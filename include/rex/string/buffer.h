@@ -27,6 +27,9 @@ class StringBuffer {
   explicit StringBuffer(size_t initial_capacity = 0);
   ~StringBuffer();
 
+  StringBuffer(const StringBuffer&) = delete;
+  StringBuffer& operator=(const StringBuffer&) = delete;
+
   char* buffer() const { return buffer_; }
   size_t length() const { return buffer_offset_; }
 
@@ -53,6 +56,11 @@ class StringBuffer {
  private:
   void Grow(size_t additional_length);
 
+  bool is_inline() const { return buffer_ == inline_buffer_; }
+
+  // Most formatted strings are short; they stay in this inline storage and
+  // the heap is only touched once output outgrows it.
+  char inline_buffer_[256];
   char* buffer_ = nullptr;
   size_t buffer_offset_ = 0;
   size_t buffer_capacity_ = 0;
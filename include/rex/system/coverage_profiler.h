@@ -0,0 +1,39 @@
+/**
+ * @file        system/coverage_profiler.h
+ * @brief       Snapshot/report of recompiled-function call counters
+ *
+ * @copyright   Copyright (c) 2026 Tom Clay <tomc@tctechstuff.com>
+ *              All rights reserved.
+ *
+ * @license     BSD 3-Clause License
+ *              See LICENSE file in the project root for full license text.
+ */
+
+#pragma once
+
+namespace rex::runtime {
+
+/**
+ * Reports which recompiled functions ran and how often.
+ *
+ * When codegen runs with emit_function_counters every guest function bumps a
+ * relaxed per-function counter in the rex_fn_counters section; the runtime
+ * walks that section directly, so builds without counters pay nothing and
+ * need no registration. WriteReport() logs the hottest functions (attributed
+ * to map symbols when coverage_map is set) and, when coverage_dump names a
+ * file, writes "<hex address> <call count>" lines - the exact format
+ * codegen's profile_path consumes, closing the loop for profile-guided
+ * hot/cold splitting. The runtime emits it automatically at shutdown.
+ */
+class CoverageProfiler {
+ public:
+  // True when the binary was linked with counter-instrumented guest code.
+  static bool available();
+
+  // Snapshots the counter section, logs the hottest functions and writes the
+  // coverage_dump file if configured. Safe to call with guest threads still
+  // running - counts are read relaxed and may be slightly stale.
+  static void WriteReport();
+};
+
+}  // namespace rex::runtime
@@ -0,0 +1,122 @@
+/**
+ * @file        rex/system/dispatch_task.h
+ * @brief       Coroutine continuations for the kernel dispatch thread
+ *
+ * @copyright   Copyright (c) 2026 Tom Clay <tomc@tctechstuff.com>
+ *              All rights reserved.
+ *
+ * @license     BSD 3-Clause License
+ *              See LICENSE file in the project root for full license text.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+namespace rex {
+namespace system {
+
+class KernelState;
+
+/**
+ * Fire-and-forget coroutine driven by the kernel dispatch thread.
+ *
+ * Long-running HLE operations (dialog waits and other deferred overlapped
+ * completions) used to park the dispatch thread on a fence, serializing every
+ * other deferred completion behind them. A DispatchTask suspends at co_await
+ * points instead and the dispatch thread moves on to the next queued item;
+ * a DispatchContinuation re-queues the coroutine when the awaited event fires.
+ *
+ * The coroutine starts suspended: hand it to KernelState::LaunchDispatchTask
+ * to begin execution on the dispatch thread. Once launched the frame owns
+ * itself and frees when the task runs to completion.
+ */
+class DispatchTask {
+ public:
+  struct promise_type {
+    DispatchTask get_return_object() {
+      return DispatchTask(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    void unhandled_exception() { std::terminate(); }
+  };
+
+  DispatchTask() = default;
+
+  DispatchTask(DispatchTask&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+  DispatchTask& operator=(DispatchTask&& other) noexcept {
+    if (this != &other) {
+      if (handle_) {
+        handle_.destroy();
+      }
+      handle_ = std::exchange(other.handle_, nullptr);
+    }
+    return *this;
+  }
+  DispatchTask(const DispatchTask&) = delete;
+  DispatchTask& operator=(const DispatchTask&) = delete;
+
+  ~DispatchTask() {
+    // Only reached for tasks that were never launched
+    if (handle_) {
+      handle_.destroy();
+    }
+  }
+
+  /// Release the handle to LaunchDispatchTask; the frame then owns itself
+  std::coroutine_handle<> detach() { return std::exchange(handle_, nullptr); }
+
+ private:
+  explicit DispatchTask(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+  std::coroutine_handle<promise_type> handle_;
+};
+
+/**
+ * Single-shot awaitable bridging an external callback (UI thread close
+ * handler, notification, ...) back onto the kernel dispatch thread.
+ *
+ * co_await parks the task until resume() is called; resume() may be called
+ * from any thread and may race the suspension - whichever side arrives second
+ * completes the hand-off, and the coroutine always continues on the dispatch
+ * thread. The awaiter must outlive the callback that calls resume(), which
+ * holds naturally while it lives in the awaiting coroutine's frame.
+ */
+class DispatchContinuation {
+ public:
+  explicit DispatchContinuation(KernelState* kernel_state) : kernel_state_(kernel_state) {}
+
+  DispatchContinuation(const DispatchContinuation&) = delete;
+  DispatchContinuation& operator=(const DispatchContinuation&) = delete;
+
+  bool await_ready() const noexcept { return state_.load(std::memory_order_acquire) == signaled_tag(); }
+
+  bool await_suspend(std::coroutine_handle<> handle) noexcept {
+    void* expected = nullptr;
+    // Park the handle; if resume() already fired, continue without suspending
+    return state_.compare_exchange_strong(expected, handle.address(), std::memory_order_acq_rel);
+  }
+
+  void await_resume() const noexcept {}
+
+  /// Signal completion; queues the parked coroutine on the dispatch thread.
+  /// Implemented in kernel_state.cpp to avoid a circular include.
+  void resume();
+
+ private:
+  static void* signaled_tag() {
+    static char tag;
+    return &tag;
+  }
+
+  KernelState* kernel_state_;
+  std::atomic<void*> state_{nullptr};  // nullptr -> parked handle -> signaled_tag()
+};
+
+}  // namespace system
+}  // namespace rex
@@ -10,11 +10,18 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
+#include <rex/memory/mapped_memory.h>
 #include <rex/system/module.h>
 
+namespace rex::arch {
+class Exception;
+}  // namespace rex::arch
+
 namespace rex::system {
 class KernelState;
 }  // namespace rex::system
@@ -45,6 +52,32 @@ class ElfModule : public Module {
   std::unique_ptr<Function> CreateFunction(uint32_t address) override;
 
  private:
+  // One page-aligned AllocFixed region whose pages are populated on first
+  // touch instead of up front (see elf_lazy_loading).
+  struct LazyRange {
+    uint32_t guest_address = 0;            // Page-aligned region start
+    uint32_t size = 0;                     // Page-aligned region size
+    std::vector<bool> materialized_pages;  // One bit per heap page
+  };
+  // File-backed portion of a PT_LOAD segment, copied page-by-page on fault.
+  struct LazySegment {
+    uint32_t vaddr = 0;        // Guest virtual address of the segment
+    uint32_t filesz = 0;       // Bytes backed by the file (rest is zero-fill)
+    uint32_t file_offset = 0;  // Offset of the segment data within the ELF
+  };
+
+  // Copies/zero-fills the page containing guest_address and makes it
+  // readable+writable. Returns false if the address isn't ours.
+  bool MaterializePage(uint32_t guest_address);
+  // Does the actual unprotect+populate for one page; lazy_mutex_ must be held.
+  void MaterializePageLocked(LazyRange& range, uint32_t page_index);
+  // Populates every page still pending so the image behaves as if it had
+  // been loaded eagerly (used before tearing the fault handler down).
+  void MaterializeAllPages();
+
+  bool ExceptionCallback(arch::Exception* ex);
+  static bool ExceptionCallbackThunk(arch::Exception* ex, void* data);
+
   std::string name_;
   std::string path_;
   rex::system::KernelState* kernel_state_;
@@ -54,6 +87,14 @@ class ElfModule : public Module {
   uint32_t entry_point_ = 0;
   uint32_t base_address_ = 0;
   uint32_t image_size_ = 0;
+
+  // Demand-paged loading state. The mapping keeps the ELF bytes available
+  // for as long as unmaterialized pages remain.
+  std::unique_ptr<memory::MappedMemory> elf_mapping_;
+  std::mutex lazy_mutex_;
+  std::vector<LazyRange> lazy_ranges_;
+  std::vector<LazySegment> lazy_segments_;
+  bool fault_handler_installed_ = false;
 };
 
 }  // namespace rex::runtime
@@ -10,6 +10,9 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -29,7 +32,7 @@ typedef struct Entry_t {
 
   uint32_t address;
   uint32_t end_address;
-  Status status;
+  std::atomic<Status> status;
   Function* function;
 } Entry;
 
@@ -44,9 +47,16 @@ class EntryTable {
   std::vector<Function*> FindWithAddress(uint32_t address);
 
  private:
-  rex::thread::global_critical_region global_critical_region_;
-  // TODO(benvanik): replace with a better data structure.
-  std::unordered_map<uint32_t, Entry*> map_;
+  using Map = std::unordered_map<uint32_t, Entry*>;
+
+  // Readers load the published map with a plain acquire load and never take
+  // a lock; writers rebuild a copy under write_mutex_ and publish it with a
+  // release store. Entries are never removed, so every retired version holds
+  // a subset of the current entries, and retired maps live until the table
+  // dies so a concurrent reader can't be left holding a freed map.
+  rex::thread::mutex write_mutex_;
+  std::atomic<const Map*> map_{nullptr};
+  std::vector<std::unique_ptr<const Map>> retired_;
 };
 
 }  // namespace rex::runtime
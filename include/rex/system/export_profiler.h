@@ -0,0 +1,94 @@
+/**
+ * @file        system/export_profiler.h
+ * @brief       Sampling profiler for HLE kernel export dispatch
+ *
+ * @copyright   Copyright (c) 2026 Tom Clay <tomc@tctechstuff.com>
+ *              All rights reserved.
+ *
+ * @license     BSD 3-Clause License
+ *              See LICENSE file in the project root for full license text.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace rex::runtime {
+
+/**
+ * Records which guest code burns time in which HLE export.
+ *
+ * Every export trampoline carries an ExportCallTimer; when the profiler is
+ * enabled (the export_profiler cvar), one in every export_profiler_sample_interval
+ * calls per thread is timed and pushed into a fixed-size lock-free ring of
+ * samples - export name, caller guest address (lr at dispatch) and duration.
+ * The ring overwrites the oldest samples, so a report always reflects recent
+ * behavior. WriteReport() aggregates the ring by (export, caller), resolves
+ * caller addresses against an nm-style map when export_profiler_map is set,
+ * and logs the hottest pairs; the runtime emits it automatically at shutdown.
+ *
+ * When disabled the per-call cost is a single relaxed atomic load.
+ */
+class ExportProfiler {
+ public:
+  struct Sample {
+    // String literal from the export trampoline; pointer identity keys the
+    // aggregation, no strings are copied on the dispatch path.
+    const char* export_name;
+    // Guest address of the call site (lr when the export was entered).
+    uint32_t caller_address;
+    uint64_t duration_ns;
+  };
+
+  static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+  static void set_enabled(bool enabled);
+
+  // Decides whether this call should be timed, advancing the per-thread
+  // sampling countdown. Only meaningful when enabled.
+  static bool ShouldSample();
+
+  static void RecordSample(const char* export_name, uint32_t caller_address, uint64_t duration_ns);
+
+  // Aggregates the current ring contents and logs the hottest
+  // (export, caller) pairs, attributed to map symbols when available.
+  static void WriteReport();
+
+ private:
+  static std::atomic<bool> enabled_;
+};
+
+// RAII timer placed in every export trampoline by PPC_HOOK. All work is
+// skipped unless the profiler is enabled and this call is sampled.
+class ExportCallTimer {
+ public:
+  ExportCallTimer(const char* export_name, uint64_t caller_lr) {
+    if (!ExportProfiler::enabled() || !ExportProfiler::ShouldSample()) {
+      return;
+    }
+    export_name_ = export_name;
+    caller_address_ = static_cast<uint32_t>(caller_lr);
+    start_ = std::chrono::steady_clock::now();
+  }
+
+  ~ExportCallTimer() {
+    if (!export_name_) {
+      return;
+    }
+    auto duration = std::chrono::steady_clock::now() - start_;
+    ExportProfiler::RecordSample(
+        export_name_, caller_address_,
+        uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()));
+  }
+
+  ExportCallTimer(const ExportCallTimer&) = delete;
+  ExportCallTimer& operator=(const ExportCallTimer&) = delete;
+
+ private:
+  const char* export_name_ = nullptr;
+  uint32_t caller_address_ = 0;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace rex::runtime
@@ -278,6 +278,99 @@ class WideStringFormatData {
   std::u16string output_;
 };
 
+//=============================================================================
+// GuestStringFormatData — narrow format input with direct guest output
+//=============================================================================
+// Writes formatted bytes straight into the guest buffer instead of
+// accumulating a host std::string that the caller copies back afterwards,
+// saving the allocation and second pass on the sprintf-family hot path.
+// Output beyond capacity is counted but not stored, so format_core still
+// returns the full would-be length and the _snprintf-style callers keep
+// their truncation semantics. The terminating NUL is the caller's concern,
+// as with the copy-back variants.
+class GuestStringFormatData {
+ public:
+  GuestStringFormatData(const uint8_t* input, uint8_t* output, int32_t capacity)
+      : input_(input), output_(output), capacity_(capacity) {}
+
+  uint16_t get() {
+    uint16_t result = *input_;
+    if (result) {
+      input_++;
+    }
+    return result;
+  }
+
+  uint16_t peek(int32_t offset) { return input_[offset]; }
+
+  void skip(int32_t count) {
+    while (count-- > 0) {
+      if (!get()) {
+        break;
+      }
+    }
+  }
+
+  bool put(uint16_t c) {
+    if (c >= 0x100) {
+      return false;
+    }
+    if (written_ < capacity_) {
+      output_[written_++] = uint8_t(c);
+    }
+    return true;
+  }
+
+ private:
+  const uint8_t* input_;
+  uint8_t* output_;
+  int32_t capacity_;
+  int32_t written_ = 0;
+};
+
+//=============================================================================
+// GuestWideStringFormatData — wide format input with direct guest output
+//=============================================================================
+// Wide counterpart of GuestStringFormatData: stores each unit byte-swapped
+// as it is produced, replacing the host std::u16string plus copy_and_swap
+// pass of the copy-back path.
+class GuestWideStringFormatData {
+ public:
+  GuestWideStringFormatData(const uint16_t* input, uint16_t* output, int32_t capacity)
+      : input_(input), output_(output), capacity_(capacity) {}
+
+  uint16_t get() {
+    uint16_t result = *input_;
+    if (result) {
+      input_++;
+    }
+    return rex::byte_swap(result);
+  }
+
+  uint16_t peek(int32_t offset) { return rex::byte_swap(input_[offset]); }
+
+  void skip(int32_t count) {
+    while (count-- > 0) {
+      if (!get()) {
+        break;
+      }
+    }
+  }
+
+  bool put(uint16_t c) {
+    if (written_ < capacity_) {
+      output_[written_++] = rex::byte_swap(c);
+    }
+    return true;
+  }
+
+ private:
+  const uint16_t* input_;
+  uint16_t* output_;
+  int32_t capacity_;
+  int32_t written_ = 0;
+};
+
 //=============================================================================
 // WideCountFormatData — counts wide output without storing
 //=============================================================================
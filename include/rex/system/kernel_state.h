@@ -11,17 +11,20 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <vector>
 
 #include <rex/bit.h>
 #include <rex/filesystem/vfs.h>
+#include <rex/system/dispatch_task.h>
 #include <rex/logging.h>
 #include <rex/system/util/native_list.h>
 #include <rex/system/util/object_table.h>
@@ -129,7 +132,7 @@ class KernelState {
   xam::ContentManager* content_manager() const { return content_manager_.get(); }
   xam::UserProfile* user_profile() const { return user_profile_.get(); }
 
-  // Access must be guarded by the global critical region.
+  // Internally synchronized; no external locking required.
   util::ObjectTable* object_table() { return &object_table_; }
 
   uint32_t process_type() const;
@@ -192,6 +195,20 @@ class KernelState {
   void CompleteOverlappedImmediateEx(uint32_t overlapped_ptr, X_RESULT result,
                                      uint32_t extended_error, uint32_t length);
 
+  /// Mark an overlapped as in-flight on the calling guest thread. Pair with
+  /// a later CompleteOverlapped*() call, e.g. from a DispatchTask.
+  void MarkOverlappedPending(uint32_t overlapped_ptr);
+
+  /// Queue arbitrary work on the kernel dispatch thread. Used by deferred
+  /// overlapped completions and by DispatchContinuation to resume tasks.
+  void QueueDispatch(std::move_only_function<void()> fn);
+
+  /// Begin executing a coroutine-based HLE operation on the dispatch thread.
+  /// The task frame owns itself from here on and frees on completion; while
+  /// it is suspended at a co_await the dispatch thread keeps servicing other
+  /// queued items instead of blocking.
+  void LaunchDispatchTask(DispatchTask task);
+
   void CompleteOverlappedDeferred(std::move_only_function<void()> completion_callback,
                                   uint32_t overlapped_ptr, X_RESULT result,
                                   std::move_only_function<void()> pre_callback = nullptr,
@@ -226,15 +243,37 @@ class KernelState {
   std::unique_ptr<xam::ContentManager> content_manager_;
   std::unique_ptr<xam::UserProfile> user_profile_;
 
+  // Only held where threads may be suspended or terminated (TerminateTitle);
+  // everything else uses the per-object locks below so independent guest
+  // threads doing kernel transitions don't contend on one mutex.
   rex::thread::global_critical_region global_critical_region_;
 
-  // Must be guarded by the global critical region.
+  // Internally synchronized.
   util::ObjectTable object_table_;
+
+  // Guarded by thread_mutex_.
+  rex::thread::mutex thread_mutex_;
   std::unordered_map<uint32_t, XThread*> threads_by_id_;
-  std::vector<object_ref<XNotifyListener>> notify_listeners_;
+
+  // Notify listeners, sharded by notification area (XNotificationKey
+  // mask_index) so a broadcast only touches listeners whose mask covers the
+  // event's area. Each shard's mutex guards its vector; listener_mutex_
+  // orders registration and guards has_notified_startup_. Lock order:
+  // listener_mutex_ before any shard mutex.
+  static constexpr size_t kNotifyListenerShards = 64;
+  struct NotifyListenerShard {
+    rex::thread::mutex mutex;
+    std::vector<object_ref<XNotifyListener>> listeners;
+  };
+  rex::thread::mutex listener_mutex_;
+  std::array<NotifyListenerShard, kNotifyListenerShards> notify_listener_shards_;
   bool has_notified_startup_ = false;
 
   uint32_t process_type_ = X_PROCTYPE_USER;
+
+  // Guarded by module_mutex_ (recursive: module load can re-enter the
+  // module list through path resolution).
+  std::recursive_mutex module_mutex_;
   object_ref<UserModule> executable_module_;
   std::vector<object_ref<KernelModule>> kernel_modules_;
   std::vector<object_ref<UserModule>> user_modules_;
@@ -246,6 +285,8 @@ class KernelState {
   object_ref<XHostThread> dispatch_thread_;
   // Must be guarded by the global critical region.
   util::NativeList dpc_list_;
+  // dispatch_mutex_ guards dispatch_queue_ and pairs with dispatch_cond_.
+  rex::thread::mutex dispatch_mutex_;
   std::condition_variable_any dispatch_cond_;
   std::list<std::move_only_function<void()>> dispatch_queue_;
 
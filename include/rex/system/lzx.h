@@ -12,8 +12,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
+#include <mutex>
 
 namespace rex {
 struct xex2_delta_patch;
@@ -22,5 +25,62 @@ struct xex2_delta_patch;
 int lzx_decompress(const void* lzx_data, size_t lzx_len, void* dest, size_t dest_len,
                    uint32_t window_size, void* window_data, size_t window_data_len);
 
+// Hand-off buffer between a producer thread that de-blocks an LZX stream and
+// lzx_decompress_pipelined running on another thread. The producer owns the
+// backing buffer (sized for the whole stream up front), appends bytes to it
+// and makes them visible with Publish; the decompressor blocks until the
+// bytes it needs arrive. Finish marks end of stream - possibly short of the
+// full stream if the producer hit an error, in which case the decompressor
+// unblocks and fails cleanly.
+class lzx_stream_buffer {
+ public:
+  lzx_stream_buffer(const void* buffer, size_t capacity)
+      : buffer_(reinterpret_cast<const uint8_t*>(buffer)), capacity_(capacity) {}
+
+  const uint8_t* data() const { return buffer_; }
+
+  // Producer side: the leading `available` bytes of the buffer are valid.
+  void Publish(size_t available) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      available_ = std::min(available, capacity_);
+    }
+    cv_.notify_one();
+  }
+
+  void Finish() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      finished_ = true;
+    }
+    cv_.notify_one();
+  }
+
+  // Consumer side: blocks until `offset + length` bytes are published or the
+  // stream is finished; returns how many bytes are readable at `offset`.
+  size_t WaitForBytes(size_t offset, size_t length) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [&]() { return finished_ || available_ >= offset + length; });
+    if (offset >= available_) {
+      return 0;
+    }
+    return std::min(length, available_ - offset);
+  }
+
+ private:
+  const uint8_t* buffer_;
+  size_t capacity_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  size_t available_ = 0;
+  bool finished_ = false;
+};
+
+// Like lzx_decompress, but reads from a lzx_stream_buffer that another thread
+// is still filling, so decode overlaps de-blocking of the source stream.
+int lzx_decompress_pipelined(lzx_stream_buffer* source, void* dest, size_t dest_len,
+                             uint32_t window_size);
+
 int lzxdelta_apply_patch(rex::xex2_delta_patch* patch, size_t patch_len, uint32_t window_size,
                          void* dest);
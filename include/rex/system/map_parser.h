@@ -88,4 +88,19 @@ std::expected<std::vector<BinarySymbol>, MapParseError> ParseNmMap(
 std::expected<std::vector<BinarySymbol>, MapParseError> ParseNmMapString(
     std::string_view map_data, const MapParseOptions& options = {});
 
+/**
+ * Like ParseNmMap, but maintains a compiled symbol cache next to the source
+ * file ("<map>.symcache": header + address-sorted records + string pool).
+ * The cache is loaded with two bulk reads instead of line-by-line text
+ * parsing and is regenerated whenever the .map mtime, size, or parse options
+ * change. Falls back to the text parser if the cache is missing or stale.
+ *
+ * @param map_path    Path to the .map file
+ * @param options     Parsing options (part of the cache key)
+ * @return            Vector of parsed symbols (sorted by address when served
+ *                    from the cache) or error
+ */
+std::expected<std::vector<BinarySymbol>, MapParseError> ParseNmMapCached(
+    const std::filesystem::path& map_path, const MapParseOptions& options = {});
+
 }  // namespace rex::runtime
@@ -81,6 +81,19 @@ class MMIOHandler {
 
   std::vector<MMIORange> mapped_ranges_;
 
+  // Flat per-64-KB-page index into mapped_ranges_ so resolving an MMIO access
+  // (CheckLoad / CheckStore on every recompiled MMIO-candidate access, and the
+  // exception fallback) doesn't have to walk the range list. Whether a range
+  // can match an address depends only on the upper 16 bits of the address
+  // since the low mask bits only select within a page, so each page maps to at
+  // most one range in practice - pages claimed by multiple ranges fall back to
+  // the walk.
+  static constexpr uint32_t kPageTablePageSizeLog2 = 16;
+  static constexpr uint32_t kPageTableSize = uint32_t(1) << (32 - kPageTablePageSizeLog2);
+  static constexpr uint16_t kPageTableEntryEmpty = UINT16_MAX;
+  static constexpr uint16_t kPageTableEntryMultiple = UINT16_MAX - 1;
+  std::vector<uint16_t> page_table_;
+
   HostToGuestVirtual host_to_guest_virtual_;
   const void* host_to_guest_virtual_context_;
 
@@ -13,8 +13,8 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #include <rex/memory.h>
@@ -85,6 +85,31 @@ class Processor {
   uint64_t ExecuteInterrupt(ThreadState* thread_state, uint32_t address, uint64_t args[],
                             size_t arg_count);
 
+  // Batches several interrupt deliveries on one guest thread under a single
+  // global-lock acquisition, IRQL raise and TLS transition. Graphics and audio
+  // interrupts arrive at kHz rates, so doing the full context setup once per
+  // batch instead of once per event amortizes the dispatch overhead.
+  // Consecutive same-level deliveries within the batch stay at DISPATCH level;
+  // the previous IRQL is restored when the batch is destroyed.
+  class InterruptBatch {
+   public:
+    InterruptBatch(Processor* processor, ThreadState* thread_state);
+    ~InterruptBatch();
+    InterruptBatch(const InterruptBatch&) = delete;
+    InterruptBatch& operator=(const InterruptBatch&) = delete;
+
+    // Delivers one interrupt within the batch, returning the handler's result.
+    uint64_t Execute(uint32_t address, uint64_t args[], size_t arg_count);
+
+   private:
+    Processor* processor_;
+    ThreadState* thread_state_;
+    std::unique_lock<std::recursive_mutex> global_lock_;
+    uint8_t* pcr_address_ = nullptr;
+    uint32_t old_tls_ptr_ = 0;
+    Irql previous_irql_ = Irql::PASSIVE;
+  };
+
   Irql RaiseIrql(Irql new_value);
   void LowerIrql(Irql old_value);
   Irql current_irql() const { return static_cast<Irql>(irql_.load(std::memory_order_acquire)); }
@@ -102,6 +127,10 @@ class Processor {
   bool InitializeFunctionTable(uint32_t code_base, uint32_t code_size, uint32_t image_base,
                                uint32_t image_size);
   void SetFunction(uint32_t guest_address, ::PPCFunc* func);
+  // Register a whole null-terminated mapping table (as emitted by the
+  // recompiler) in one pass over both dispatch tables. Returns the number
+  // of code-section entries registered.
+  size_t SetFunctions(const ::PPCFuncMapping* mappings);
   ::PPCFunc* GetFunction(uint32_t guest_address);
   bool HasFunctionTable() const { return function_table_initialized_; }
 
@@ -109,14 +138,20 @@ class Processor {
   memory::Memory* memory_ = nullptr;
   ExportResolver* export_resolver_ = nullptr;
 
+  // Held only across interrupt dispatch (ExecuteInterrupt), where "interrupts
+  // disabled" really does mean exclusive access to the whole system.
   rex::thread::global_critical_region global_critical_region_;
   ExecutionState execution_state_ = ExecutionState::kPaused;
+  // Guarded by modules_mutex_.
+  std::mutex modules_mutex_;
   std::vector<std::unique_ptr<Module>> modules_;
 
   std::atomic<uint32_t> irql_{static_cast<uint32_t>(Irql::PASSIVE)};
 
-  // rexglue function table
-  std::unordered_map<uint32_t, ::PPCFunc*> function_table_;
+  // rexglue function table: flat over the code region, one slot per
+  // 4-byte-aligned guest address, mirroring the guest-memory table that
+  // PPC_LOOKUP_FUNC indexes. Indexed by (guest_address - code_base_) / 4.
+  std::vector<::PPCFunc*> function_table_;
   uint32_t code_base_ = 0;
   uint32_t code_size_ = 0;
   uint32_t image_base_ = 0;
@@ -0,0 +1,59 @@
+/**
+ * @file        system/startup_profiler.h
+ * @brief       Wall-clock accounting for runtime startup phases
+ *
+ * @copyright   Copyright (c) 2026 Tom Clay <tomc@tctechstuff.com>
+ *              All rights reserved.
+ *
+ * @license     BSD 3-Clause License
+ *              See LICENSE file in the project root for full license text.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace rex::runtime {
+
+/**
+ * Records how cold start is spent, phase by phase.
+ *
+ * Runtime::Setup, module load and launch wrap their stages in
+ * StartupPhaseTimer scopes. Phases are always recorded (a handful of entries,
+ * negligible cost) and may complete on different threads now that setup
+ * overlaps independent stages. WriteSummary() logs the breakdown and, when
+ * the startup_trace cvar names a file, dumps the phases as a chrome-trace
+ * JSON (load it in chrome://tracing or Perfetto to see the overlap).
+ */
+class StartupProfiler {
+ public:
+  // Thread-safe; timestamps are relative to the first record in the process.
+  static void RecordPhase(const char* name, std::chrono::steady_clock::time_point start,
+                          std::chrono::steady_clock::time_point end);
+
+  // Logs the per-phase breakdown and writes the chrome-trace JSON if
+  // configured. Called at the end of Runtime::Setup and after module launch;
+  // each call rewrites the trace with everything recorded so far.
+  static void WriteSummary();
+};
+
+/// RAII scope timer for one startup phase.
+class StartupPhaseTimer {
+ public:
+  explicit StartupPhaseTimer(const char* name)
+      : name_(name), start_(std::chrono::steady_clock::now()) {}
+
+  ~StartupPhaseTimer() {
+    StartupProfiler::RecordPhase(name_, start_, std::chrono::steady_clock::now());
+  }
+
+  StartupPhaseTimer(const StartupPhaseTimer&) = delete;
+  StartupPhaseTimer& operator=(const StartupPhaseTimer&) = delete;
+
+ private:
+  const char* name_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace rex::runtime
@@ -32,11 +32,20 @@ class ThreadState {
   static ThreadState* Get();
   static uint32_t GetThreadID();
 
+  // Registers the guest stack owned by this thread so a fault in one of its
+  // no-access guard pages is diagnosed as a stack overflow/overrun instead
+  // of dying as an anonymous access violation. guard_size is the size of the
+  // guard region on either side of the stack. Unregistered on destruction.
+  void RegisterGuestStack(uint32_t stack_base, uint32_t stack_limit, uint32_t guard_size);
+
  private:
   memory::Memory* memory_;
 
   uint32_t pcr_address_ = 0;
   uint32_t thread_id_ = 0;
+  uint32_t stack_base_ = 0;
+  uint32_t stack_limit_ = 0;
+  uint32_t stack_guard_size_ = 0;
 
   // NOTE: must be 64b aligned for SSE ops.
   alignas(64)::PPCContext context_storage_;
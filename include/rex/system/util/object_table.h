@@ -10,6 +10,9 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -17,7 +20,6 @@
 #include <rex/string/key.h>
 #include <rex/system/xobject.h>
 #include <rex/system/xtypes.h>
-#include <rex/thread/mutex.h>
 
 namespace rex::stream {
 class ByteStream;
@@ -55,6 +57,59 @@ class ObjectTable {
     return result;
   }
 
+  // Pins an object for a borrowed lookup without touching its refcount.
+  // Claimed under table_mutex_; cleared with a plain release store when the
+  // borrow ends.
+  struct HazardSlot {
+    std::atomic<XObject*> object{nullptr};
+  };
+
+  // Non-owning handle resolution result. While it lives, RemoveHandle defers
+  // the table's release of the object, so the pointer stays valid without the
+  // Retain/Release pair a full LookupObject pays. Intended for kernel dispatch
+  // paths that use the object immediately (NtSetEvent, NtReleaseSemaphore,
+  // ...); don't hold one across a wait - use LookupObject for that.
+  template <typename T>
+  class Borrowed {
+   public:
+    Borrowed() = default;
+    Borrowed(const Borrowed&) = delete;
+    Borrowed& operator=(const Borrowed&) = delete;
+    Borrowed(Borrowed&& other) noexcept : object_(other.object_), slot_(other.slot_) {
+      other.object_ = nullptr;
+      other.slot_ = nullptr;
+    }
+    ~Borrowed() {
+      if (slot_) {
+        slot_->object.store(nullptr, std::memory_order_release);
+      } else if (object_) {
+        // Slot pool was exhausted; the lookup fell back to a retained ref.
+        object_->Release();
+      }
+    }
+
+    T* get() const { return object_; }
+    T* operator->() const { return object_; }
+    explicit operator bool() const { return object_ != nullptr; }
+
+   private:
+    friend class ObjectTable;
+    Borrowed(T* object, HazardSlot* slot) : object_(object), slot_(slot) {}
+
+    T* object_ = nullptr;
+    HazardSlot* slot_ = nullptr;
+  };
+
+  template <typename T>
+  Borrowed<T> LookupObjectBorrowed(X_HANDLE handle) {
+    HazardSlot* slot = nullptr;
+    auto object = LookupObjectBorrowed(handle, &slot);
+    if (object) {
+      assert_true(object->type() == T::kObjectType);
+    }
+    return Borrowed<T>(reinterpret_cast<T*>(object), slot);
+  }
+
   X_STATUS AddNameMapping(const std::string_view name, X_HANDLE handle);
   void RemoveNameMapping(const std::string_view name);
   X_STATUS GetObjectByName(const std::string_view name, X_HANDLE* out_handle);
@@ -83,8 +138,14 @@ class ObjectTable {
 
   ObjectTableEntry* LookupTable(X_HANDLE handle);
   XObject* LookupObject(X_HANDLE handle, bool already_locked);
+  XObject* LookupObjectBorrowed(X_HANDLE handle, HazardSlot** out_slot);
   void GetObjectsByType(XObject::Type type, std::vector<object_ref<XObject>>* results);
 
+  // All called with table_mutex_ held.
+  bool IsHazarded(XObject* object);
+  void ReleaseWhenUnhazarded(XObject* object);
+  void ReleaseRetiredObjects();
+
   X_HANDLE TranslateHandle(X_HANDLE handle);
   static constexpr uint32_t GetHandleSlot(X_HANDLE handle) {
     return (handle - XObject::kHandleBase) >> 2;
@@ -92,15 +153,29 @@ class ObjectTable {
   X_STATUS FindFreeSlot(uint32_t* out_slot);
   bool Resize(uint32_t new_capacity);
 
-  rex::thread::global_critical_region global_critical_region_;
+  // Guards table_/name_table_. The table synchronizes itself so concurrent
+  // handle traffic from independent guest threads doesn't serialize through
+  // the global critical region. Recursive because GetObjectByName looks up
+  // the object while already holding the lock.
+  std::recursive_mutex table_mutex_;
   uint32_t table_capacity_ = 0;
   ObjectTableEntry* table_ = nullptr;
   uint32_t last_free_entry_ = 0;
   std::unordered_map<string::string_key_case, X_HANDLE> name_table_;
+
+  // Hazard slots for borrowed lookups. Bounded so the removal-side scan stays
+  // cheap; LookupObjectBorrowed falls back to a retained ref when all slots
+  // are busy. Objects removed from the table while hazarded park in
+  // retired_objects_ (still holding the table's ref) until the borrow ends.
+  static constexpr size_t kMaxHazardSlots = 64;
+  std::vector<std::unique_ptr<HazardSlot>> hazard_slots_;
+  std::vector<XObject*> retired_objects_;
 };
 
 // Generic lookup
 template <>
 object_ref<XObject> ObjectTable::LookupObject<XObject>(X_HANDLE handle);
+template <>
+ObjectTable::Borrowed<XObject> ObjectTable::LookupObjectBorrowed<XObject>(X_HANDLE handle);
 
 }  // namespace rex::system::util
@@ -11,8 +11,10 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -49,6 +51,8 @@ class App {
 
 class AppManager {
  public:
+  ~AppManager();
+
   void RegisterApp(std::unique_ptr<App> app);
 
   X_HRESULT DispatchMessageSync(uint32_t app_id, uint32_t message, uint32_t buffer_ptr,
@@ -56,9 +60,29 @@ class AppManager {
   X_HRESULT DispatchMessageAsync(uint32_t app_id, uint32_t message, uint32_t buffer_ptr,
                                  uint32_t buffer_length);
 
+  // Log call counts and wall time per (app, message) pair collected while the
+  // xam_dispatch_stats cvar is enabled. Also run on destruction.
+  void DumpDispatchStats();
+
  private:
+  // App ids fit in a byte (XAM registers 0xFA-0xFE), so route straight through
+  // a flat array - the per-message fast path is an index plus a null check.
+  static constexpr size_t kMaxAppId = 256;
+
+  App* LookupApp(uint32_t app_id) const {
+    return app_id < kMaxAppId ? app_index_[app_id] : nullptr;
+  }
+  void RecordDispatch(uint32_t app_id, uint32_t message, uint64_t duration_us);
+
   std::vector<std::unique_ptr<App>> apps_;
-  std::unordered_map<uint32_t, App*> app_lookup_;
+  std::array<App*, kMaxAppId> app_index_ = {};
+
+  struct MessageStats {
+    uint64_t calls = 0;
+    uint64_t total_us = 0;
+  };
+  std::mutex stats_mutex_;
+  std::unordered_map<uint64_t, MessageStats> message_stats_;  // app << 32 | message
 };
 
 }  // namespace xam
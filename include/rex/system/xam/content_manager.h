@@ -11,8 +11,11 @@
 
 #pragma once
 
+#include <filesystem>
+#include <map>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <vector>
 
@@ -163,6 +166,7 @@ class ContentManager {
  private:
   std::filesystem::path ResolvePackageRoot(XContentType content_type, uint32_t title_id = -1);
   std::filesystem::path ResolvePackagePath(const XCONTENT_AGGREGATE_DATA& data);
+  void InvalidateListContentCache(XContentType content_type, uint32_t title_id);
 
   KernelState* kernel_state_;
   std::filesystem::path root_path_;
@@ -170,6 +174,15 @@ class ContentManager {
   // TODO(benvanik): remove use of global lock, it's bad here!
   rex::thread::global_critical_region global_critical_region_;
   std::unordered_map<string::string_key, ContentPackage*> open_packages_;
+
+  // Cached ListContent results keyed by (device_id, content_type, title_id),
+  // validated against the backing directory's write time so the content store
+  // is only rescanned when it actually changed. Guarded by the global lock.
+  struct ListContentCacheEntry {
+    std::filesystem::file_time_type root_write_time;
+    std::vector<XCONTENT_AGGREGATE_DATA> content;
+  };
+  std::map<std::tuple<uint32_t, uint32_t, uint32_t>, ListContentCacheEntry> list_content_cache_;
 };
 
 }  // namespace xam
@@ -12,6 +12,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <functional>
 #include <vector>
 
 #include <rex/system/xobject.h>
@@ -104,4 +105,49 @@ class XStaticEnumerator : public XStaticUntypedEnumerator {
   }
 };
 
+// Enumerator that produces items on demand rather than materializing the whole
+// result set when it is created. The producer writes up to item_capacity items
+// starting at index first_item into out_items and returns how many it
+// produced; producing fewer than requested ends the enumeration. Items are
+// fetched a small readahead window at a time, so an enumerator over a large
+// result set only pays for what the title actually enumerates.
+class XLazyUntypedEnumerator : public XEnumerator {
+ public:
+  using ProduceFn =
+      std::function<size_t(size_t first_item, size_t item_capacity, uint8_t* out_items)>;
+
+  XLazyUntypedEnumerator(KernelState* kernel_state, size_t items_per_enumerate, size_t item_size,
+                         ProduceFn produce_fn)
+      : XEnumerator(kernel_state, items_per_enumerate, item_size),
+        produce_fn_(std::move(produce_fn)) {}
+
+  uint32_t WriteItems(uint32_t buffer_ptr, uint8_t* buffer_data, uint32_t* written_count) override;
+
+ private:
+  // How many enumerate-sized batches to request from the producer per call.
+  static constexpr size_t kReadaheadBatches = 2;
+
+  ProduceFn produce_fn_;
+  // Items fetched from the producer but not yet handed to the guest.
+  std::vector<uint8_t> readahead_;
+  size_t readahead_offset_ = 0;
+  // Index of the next item to request from the producer.
+  size_t next_item_ = 0;
+  bool end_reached_ = false;
+};
+
+template <typename T>
+class XLazyEnumerator : public XLazyUntypedEnumerator {
+ public:
+  using ProduceFn = std::function<size_t(size_t first_item, size_t item_capacity, T* out_items)>;
+
+  XLazyEnumerator(KernelState* kernel_state, size_t items_per_enumerate, ProduceFn produce_fn)
+      : XLazyUntypedEnumerator(kernel_state, items_per_enumerate, sizeof(T),
+                               [produce_fn = std::move(produce_fn)](
+                                   size_t first_item, size_t item_capacity, uint8_t* out_items) {
+                                 return produce_fn(first_item, item_capacity,
+                                                   reinterpret_cast<T*>(out_items));
+                               }) {}
+};
+
 }  // namespace rex::system
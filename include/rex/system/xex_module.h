@@ -10,6 +10,7 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <filesystem>
 #include <string>
 #include <vector>
 
@@ -85,7 +86,10 @@ class XexModule : public Module {
     return total_size;
   }
 
-  const std::vector<ImportLibrary>* import_libraries() const { return &import_libs_; }
+  const std::vector<ImportLibrary>* import_libraries() const {
+    EnsureImportLibraries();
+    return &import_libs_;
+  }
 
   const xex2_opt_execution_info* opt_execution_info() const {
     xex2_opt_execution_info* retval = nullptr;
@@ -150,6 +154,9 @@ class XexModule : public Module {
   std::span<const BinarySection> binary_sections() const override;
   const BinarySection* FindSectionByName(std::string_view name) const override;
   std::span<const BinarySymbol> binary_symbols() const override;
+  const BinarySymbol* FindSymbolByName(std::string_view name) const override;
+  const BinarySymbol* FindSymbolByAddress(uint32_t address) const override;
+  const BinarySymbol* FindSymbolContainingAddress(uint32_t address) const override;
 
   uint32_t GetProcAddress(uint16_t ordinal) const;
   uint32_t GetProcAddress(const std::string_view name) const;
@@ -160,6 +167,17 @@ class XexModule : public Module {
   bool LoadContinue();
   bool Unload();
 
+  // Prelinked module cache: the prepared image (post-decryption, post-LZX,
+  // post-patch, but pre-import-fixup - variable-import slots still hold their
+  // original type<<24|ordinal encodings, since fixup writes runtime guest
+  // addresses that aren't stable across runs) plus the patched XEX headers,
+  // serialized in a versioned file keyed by the basefile digest. Loading from
+  // it replaces Load()+ApplyPatch(); LoadContinue() still runs for the cheap
+  // pointer-walk parts (PE headers, imports, symbols).
+  bool LoadPrelinked(const std::string_view name, const std::string_view path,
+                     const std::filesystem::path& cache_path, uint64_t basefile_digest);
+  bool SavePrelinked(const std::filesystem::path& cache_path, uint64_t basefile_digest) const;
+
   bool ContainsAddress(uint32_t address) override;
 
   const std::string& name() const override { return name_; }
@@ -198,7 +216,23 @@ class XexModule : public Module {
 
   int ReadPEHeaders();
 
-  bool SetupLibraryImports(const std::string_view name, const xex2_import_library* library);
+  // Import libraries found at load time; metadata (ordinal pairing, symbol
+  // names) is built lazily by BuildImportLibraries so startup only pays for
+  // the guest-visible variable patching.
+  struct PendingImportLibrary {
+    std::string name;
+    uint32_t library_offset;  // Offset of the xex2_import_library from the opt header.
+    // (ordinal, value_address) for type-0 records, captured before patching
+    // overwrites the ordinal encoding in guest memory.
+    std::vector<std::pair<uint16_t, uint32_t>> variable_records;
+  };
+
+  bool PatchVariableImports(const std::string_view name, const xex2_import_library* library,
+                            std::vector<std::pair<uint16_t, uint32_t>>* out_variable_records);
+  // Deferred: import metadata is only built when someone asks for it.
+  void EnsureImportLibraries() const { const_cast<XexModule*>(this)->BuildImportLibraries(); }
+  void BuildImportLibraries();
+  bool BuildImportLibrary(const PendingImportLibrary& pending, const xex2_import_library* library);
   bool FindSaveRest();
 
   void PopulateBinaryData();
@@ -209,7 +243,9 @@ class XexModule : public Module {
   std::vector<uint8_t> xex_header_mem_;  // Holds the xex header
   std::vector<uint8_t> xexp_data_mem_;   // Holds XEXP patch data
 
-  std::vector<ImportLibrary> import_libs_;  // pre-loaded import libraries for ease of use
+  std::vector<PendingImportLibrary> pending_import_libs_;
+  bool import_libs_built_ = false;
+  std::vector<ImportLibrary> import_libs_;  // built on demand for ease of use
   std::vector<PESection> pe_sections_;
 
   // XEX_HEADER_ALTERNATE_TITLE_IDS loaded into a safe std::vector
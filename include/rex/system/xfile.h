@@ -97,6 +97,19 @@ class XFile : public XObject {
   X_STATUS Write(uint32_t buffer_guess_address, uint32_t buffer_length, uint64_t byte_offset,
                  uint32_t* out_bytes_written, uint32_t apc_context);
 
+  // Queue the request on the kernel's background I/O workers and return
+  // X_STATUS_PENDING immediately. On completion the worker writes the IO
+  // status block, queues the guest APC on the issuing thread, signals the
+  // given event, and notifies registered completion ports - the same
+  // sequence the synchronous path performs inline. The issuing thread must
+  // be a guest thread (the APC is delivered to it).
+  X_STATUS ReadAsync(uint32_t buffer_guest_address, uint32_t buffer_length, uint64_t byte_offset,
+                     uint32_t apc_context, uint32_t apc_routine, uint32_t io_status_block_address,
+                     object_ref<XEvent> event);
+  X_STATUS WriteAsync(uint32_t buffer_guest_address, uint32_t buffer_length, uint64_t byte_offset,
+                      uint32_t apc_context, uint32_t apc_routine, uint32_t io_status_block_address,
+                      object_ref<XEvent> event);
+
   X_STATUS SetLength(size_t length);
 
   void RegisterIOCompletionPort(uint32_t key, object_ref<XIOCompletion> port);
@@ -10,7 +10,7 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
-#include <queue>
+#include <atomic>
 
 #include <rex/system/xobject.h>
 #include <rex/system/xtypes.h>
@@ -39,9 +39,22 @@ class XIOCompletion : public XObject {
 
  private:
   static const uint32_t kMaxNotifications = 1024;
+  static_assert((kMaxNotifications & (kMaxNotifications - 1)) == 0,
+                "slot indices are masked, capacity must be a power of two");
+
+  // Bounded MPMC slot queue (Vyukov scheme): each slot carries a sequence
+  // number that producers and consumers compare against their claimed
+  // position, so worker pools over NtRemoveIoCompletion never contend on a
+  // queue lock. The semaphore bounds occupancy and wakes exactly one waiter
+  // per queued notification.
+  struct NotificationSlot {
+    std::atomic<uint32_t> sequence;
+    IONotification notification;
+  };
 
-  std::mutex notification_lock_;
-  std::queue<IONotification> notifications_;
+  NotificationSlot notification_slots_[kMaxNotifications];
+  std::atomic<uint32_t> enqueue_pos_{0};
+  std::atomic<uint32_t> dequeue_pos_{0};
   std::unique_ptr<rex::thread::Semaphore> notification_semaphore_ = nullptr;
 };
 
@@ -10,6 +10,7 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -135,6 +136,15 @@ class BaseHeap {
   uint32_t GetTotalPageCount();
   uint32_t GetUnreservedPageCount();
 
+  // Free-space fragmentation snapshot of the heap, for allocation failure
+  // diagnostics and soak-test telemetry. All counts are in heap pages.
+  struct FragmentationStats {
+    uint32_t free_pages = 0;
+    uint32_t free_runs = 0;
+    uint32_t largest_free_run = 0;
+  };
+  FragmentationStats GetFragmentationStats();
+
   // Allocates pages with the given properties and allocation strategy.
   // This can reserve and commit the pages as well as set protection modes.
   // This will fail if not enough contiguous pages can be found.
@@ -166,6 +176,14 @@ class BaseHeap {
   virtual bool Protect(uint32_t address, uint32_t size, uint32_t protect,
                        uint32_t* old_protect = nullptr);
 
+  // Monotonic stamp bumped whenever the page table changes (allocation,
+  // release, decommit, protection change, snapshot restore). Readable without
+  // the global lock, so callers can cache query results and revalidate them
+  // with a single atomic load instead of re-walking the page table.
+  uint64_t allocation_generation() const {
+    return allocation_generation_.load(std::memory_order_acquire);
+  }
+
   // Queries information about the given region of pages.
   bool QueryRegionInfo(uint32_t base_address, HeapAllocationInfo* out_info);
 
@@ -186,6 +204,13 @@ class BaseHeap {
   bool Save(stream::ByteStream* stream);
   bool Restore(stream::ByteStream* stream);
 
+  // Differential snapshot support. Save and SaveDelta both record a content
+  // hash per committed page; SaveDelta then writes only the pages whose
+  // contents changed since the previous Save or SaveDelta. RestoreDelta
+  // applies such a snapshot on top of the memory state it was based on.
+  bool SaveDelta(stream::ByteStream* stream);
+  bool RestoreDelta(stream::ByteStream* stream);
+
   void Reset();
 
  protected:
@@ -194,6 +219,11 @@ class BaseHeap {
   void Initialize(memory::Memory* memory, uint8_t* membase, HeapType heap_type, uint32_t heap_base,
                   uint32_t heap_size, uint32_t page_size, uint32_t host_address_offset = 0);
 
+  // Call (with the global lock held) after any page table mutation.
+  void BumpAllocationGeneration() {
+    allocation_generation_.fetch_add(1, std::memory_order_release);
+  }
+
   memory::Memory* memory_;
   uint8_t* membase_;
   HeapType heap_type_;
@@ -203,6 +233,10 @@ class BaseHeap {
   uint32_t host_address_offset_;
   rex::thread::global_critical_region global_critical_region_;
   std::vector<PageEntry> page_table_;
+  std::atomic<uint64_t> allocation_generation_{0};
+  // XXH3 hash of each committed page's contents as of the last Save or
+  // SaveDelta. Empty until the first snapshot.
+  std::vector<uint64_t> saved_page_hashes_;
 };
 
 // Normal heap allowing allocations from guest virtual address ranges.
@@ -462,6 +496,12 @@ class Memory {
   bool Save(stream::ByteStream* stream);
   bool Restore(stream::ByteStream* stream);
 
+  // Writes only the pages changed since the last Save or SaveDelta, for
+  // rolling background snapshots. A full Save establishes the baseline a
+  // RestoreDelta chain is applied on top of.
+  bool SaveDelta(stream::ByteStream* stream);
+  bool RestoreDelta(stream::ByteStream* stream);
+
   //==========================================================================
   // Recompiled Code Function Table API
   //==========================================================================
@@ -481,6 +521,12 @@ class Memory {
   // to this address via PPC_LOOKUP_FUNC/PPC_CALL_INDIRECT_FUNC.
   void SetFunction(uint32_t guest_address, PPCFunc* host_function);
 
+  // Register every function in a null-terminated mapping table in one pass.
+  // The table base is translated once instead of per entry; entries outside
+  // the code section (IAT imports) are skipped silently. Returns the number
+  // of functions registered.
+  size_t SetFunctions(const PPCFuncMapping* mappings);
+
   // Get the registered host function for a guest address.
   // Returns nullptr if no function is registered.
   PPCFunc* GetFunction(uint32_t guest_address) const;
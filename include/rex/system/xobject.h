@@ -221,8 +221,11 @@ class XObject {
 
   // Stash native pointer into X_DISPATCH_HEADER
   static void StashHandle(X_DISPATCH_HEADER* header, uint32_t handle) {
-    header->wait_list_flink = kXObjSignature;
+    // Handle before signature: GetNativeObject resolves initialized headers
+    // without a lock, so by the time the signature becomes visible the handle
+    // it guards must already be in place.
     header->wait_list_blink = handle;
+    header->wait_list_flink = kXObjSignature;
   }
 
   static uint32_t TimeoutTicksToMs(int64_t timeout_ticks);
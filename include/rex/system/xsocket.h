@@ -12,6 +12,7 @@
 
 #include <cstring>
 #include <queue>
+#include <vector>
 
 #include <rex/math.h>
 #include <rex/system/xobject.h>
@@ -127,6 +128,14 @@ class XSocket : public XObject {
   object_ref<XSocket> Accept(N_XSOCKADDR* name, int* name_len);
   int Shutdown(int how);
 
+  // One entry of a scatter-gather send. Points directly at (translated) guest
+  // memory - the guest heap is a flat host mapping, so no staging copy is
+  // needed between the title's buffer and the OS.
+  struct Buffer {
+    const uint8_t* data;
+    uint32_t len;
+  };
+
   int Recv(uint8_t* buf, uint32_t buf_len, uint32_t flags);
   int Send(const uint8_t* buf, uint32_t buf_len, uint32_t flags);
 
@@ -134,6 +143,12 @@ class XSocket : public XObject {
                uint32_t* from_len);
   int SendTo(uint8_t* buf, uint32_t buf_len, uint32_t flags, N_XSOCKADDR_IN* to, uint32_t to_len);
 
+  // Gather variants for the WSASend/WSASendTo array forms; the buffers are
+  // handed to the OS in a single sendmsg/WSASendTo call.
+  int Send(const Buffer* buffers, uint32_t buffer_count, uint32_t flags);
+  int SendTo(const Buffer* buffers, uint32_t buffer_count, uint32_t flags, N_XSOCKADDR_IN* to,
+             uint32_t to_len);
+
   struct packet {
     // These values are in network byte order.
     rex::be<uint16_t> src_port;
@@ -146,7 +161,29 @@ class XSocket : public XObject {
   // Queue a packet into our internal buffer.
   bool QueuePacket(uint32_t src_ip, uint16_t src_port, const uint8_t* buf, size_t len);
 
+  // Hands any batched datagrams to the OS. Called automatically when the
+  // batch fills, when the flush deadline armed by the first deferred datagram
+  // expires, before receives, and on shutdown/close; safe to call when
+  // nothing is pending.
+  void FlushSendBatch();
+
  private:
+  // One datagram deferred by the Nagle-style send batch. The payload is
+  // copied because the guest may reuse its buffer as soon as sendto returns.
+  struct PendingDatagram {
+    N_XSOCKADDR_IN to;
+    uint32_t to_len;  // 0 for connected-socket sends with no address.
+    uint32_t flags;
+    std::vector<uint8_t> data;
+  };
+
+  // True when this datagram socket's sends should be deferred into a batch.
+  bool ShouldBatchSends() const;
+  // Appends a datagram to the batch, flushing when it fills. Returns false if
+  // the datagram should be sent immediately instead.
+  bool TryBatchSend(const uint8_t* buf, uint32_t buf_len, uint32_t flags, N_XSOCKADDR_IN* to,
+                    uint32_t to_len);
+
   XSocket(KernelState* kernel_state, uint64_t native_handle);
   uint64_t native_handle_ = -1;
 
@@ -163,6 +200,15 @@ class XSocket : public XObject {
   std::unique_ptr<rex::thread::Event> event_;
   std::mutex incoming_packet_mutex_;
   std::queue<uint8_t*> incoming_packets_;
+
+  // Title opted this socket out of send batching (TCP_NODELAY analog).
+  bool send_batching_opt_out_ = false;
+  std::mutex send_batch_mutex_;
+  std::vector<PendingDatagram> send_batch_;
+  // A net_send_batch_flush_ms deadline timer is pending (guarded by
+  // send_batch_mutex_). Not re-armed when an earlier flush already emptied
+  // the batch - the pending timer fires sooner than a fresh deadline would.
+  bool send_batch_timer_armed_ = false;
 };
 
 }  // namespace rex::system
\ No newline at end of file
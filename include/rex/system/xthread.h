@@ -173,6 +173,10 @@ class XThread : public XObject {
   static uint32_t GetLastError();
   static void SetLastError(uint32_t error_code);
 
+  // Frees pooled guest thread resources (stacks/TLS/PCR/scratch) left behind
+  // by exited threads. Called during title termination.
+  static void PurgeResourcePool(memory::Memory* memory);
+
   const CreationParams* creation_params() const { return &creation_params_; }
   uint32_t tls_ptr() const { return tls_static_address_; }
   uint32_t pcr_ptr() const { return pcr_address_; }
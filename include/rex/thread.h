@@ -88,6 +88,22 @@ class Fence {
 // Returns the total number of logical processors in the host system.
 uint32_t logical_processor_count();
 
+// Returns the number of NUMA nodes in the host system. 1 on non-NUMA hosts
+// or when the topology can't be read.
+uint32_t numa_node_count();
+
+// Returns the logical-processor affinity mask covering the given NUMA node,
+// or 0 if the node doesn't exist. Only the first 64 logical processors are
+// representable, matching Thread::set_affinity_mask.
+uint64_t numa_node_affinity_mask(uint32_t node);
+
+// Maps a guest hardware thread index (0-5: the 360's three dual-threaded
+// cores) to a host affinity mask under the active placement policy. With
+// numa_node configured the six guest threads are spread over that node's
+// processors so guest code and the node-bound guest memory stay local;
+// otherwise this is the plain 1 << index mapping.
+uint64_t guest_cpu_affinity_mask(uint32_t guest_cpu_index);
+
 // Enables the current process to set thread affinity.
 // Must be called at startup before attempting to set thread affinity.
 void EnableAffinityConfiguration();
@@ -118,6 +134,18 @@ void Sleep(std::chrono::duration<Rep, Period> duration) {
   Sleep(std::chrono::duration_cast<std::chrono::microseconds>(duration));
 }
 
+// Sleeps the current thread for close to the given duration, trading some CPU
+// for precision: the bulk of the wait is a coarse host sleep that deliberately
+// undershoots, and the tail is a bounded spin on the monotonic clock. For
+// frame-pacing and other short guest delays where the granularity of the plain
+// Sleep (up to ~15 ms on Windows at the default timer resolution) is visible
+// as judder. A non-positive duration just yields.
+void PreciseSleep(std::chrono::microseconds duration);
+template <typename Rep, typename Period>
+void PreciseSleep(std::chrono::duration<Rep, Period> duration) {
+  PreciseSleep(std::chrono::duration_cast<std::chrono::microseconds>(duration));
+}
+
 enum class SleepResult {
   kSuccess,
   kAlerted,
@@ -22,6 +22,7 @@
 namespace rex::thread {
 
 class TimerQueue;
+class TimingWheel;
 
 struct TimerQueueWaitItem {
   using clock = std::chrono::steady_clock;
@@ -45,6 +46,7 @@ struct TimerQueueWaitItem {
   void Disarm();
 
   friend TimerQueue;
+  friend TimingWheel;
 
  private:
   enum class State : uint_least8_t {
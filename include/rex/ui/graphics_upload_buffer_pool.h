@@ -29,6 +29,11 @@ class GraphicsUploadBufferPool {
   // kCpuAllocatorPageSize). Large enough for most cases.
   static constexpr size_t kDefaultPageSize = 2_MiB;
 
+  // Number of completed submissions a reclaimed page may stay unused for
+  // before Reclaim releases it, so allocation spikes (such as texture
+  // streaming bursts) don't permanently grow the pool to their peak size.
+  static constexpr uint64_t kTrimIdleSubmissions = 64;
+
   virtual ~GraphicsUploadBufferPool();
 
   void Reclaim(uint64_t completed_submission_index);
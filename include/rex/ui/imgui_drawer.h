@@ -73,6 +73,10 @@ class ImGuiDrawer : public WindowInputListener, public UIDrawer {
 
   void RenderDrawLists(ImDrawData* data, UIDrawContext& ui_draw_context);
 
+  // Restarts the continuous repaint loop, which pauses while the UI content is
+  // static, so the new input state is processed and drawn.
+  void RequestUIPaintForInput();
+
   void ClearInput();
   void OnKey(KeyEvent& e, bool is_down);
   void UpdateMousePosition(float x, float y);
@@ -115,6 +119,10 @@ class ImGuiDrawer : public WindowInputListener, public UIDrawer {
 
   double frame_time_tick_frequency_;
   uint64_t last_frame_time_ticks_;
+
+  // XXH3 hash of the draw data rendered in the previous frame, for pausing the
+  // continuous repaint loop when the generated UI hasn't changed.
+  uint64_t last_draw_data_hash_ = 0;
 };
 
 }  // namespace ui
@@ -13,6 +13,7 @@
 #include <rex/ui/imgui_dialog.h>
 #include <cstdint>
 #include <functional>
+#include <vector>
 
 namespace rex::ui {
 
@@ -22,11 +23,23 @@ struct FrameStats {
   uint64_t frame_count = 0;
 };
 
+// Command processor time spent on each phase of one guest frame, in
+// milliseconds (see graphics::CommandProcessor::FramePhaseTiming).
+struct GpuPhaseFrame {
+  float draw_ms = 0;
+  float resolve_ms = 0;
+  float swap_ms = 0;
+  float other_ms = 0;
+};
+
 class DebugOverlayDialog : public ImGuiDialog {
  public:
   using FrameStatsProvider = std::function<FrameStats()>;
+  // Returns the per-frame phase timing history, oldest frame first.
+  using GpuPhaseStatsProvider = std::function<std::vector<GpuPhaseFrame>()>;
 
-  explicit DebugOverlayDialog(ImGuiDrawer* imgui_drawer, FrameStatsProvider stats_provider = {});
+  explicit DebugOverlayDialog(ImGuiDrawer* imgui_drawer, FrameStatsProvider stats_provider = {},
+                              GpuPhaseStatsProvider gpu_stats_provider = {});
   ~DebugOverlayDialog();
 
   void ToggleVisible() { visible_ = !visible_; }
@@ -36,8 +49,13 @@ class DebugOverlayDialog : public ImGuiDialog {
   void OnDraw(ImGuiIO& io) override;
 
  private:
+  // Writes the current phase timing history to a JSON file next to the
+  // executable. Returns true on success.
+  bool ExportGpuPhaseStats(const std::vector<GpuPhaseFrame>& frames);
+
   bool visible_ = false;
   FrameStatsProvider stats_provider_;
+  GpuPhaseStatsProvider gpu_stats_provider_;
 };
 
 }  // namespace rex::ui
@@ -909,6 +909,16 @@ class Presenter {
   std::mutex guest_output_mailbox_consumer_mutex_;
 
   std::array<GuestOutputProperties, kGuestOutputMailboxSize> guest_output_properties_;
+  // Host tick count at which each image was published to the mailbox, written
+  // by refreshing before the release of the image (so it's ordered with the
+  // ready index update) and read by consumers for the acquired image, for
+  // measuring the refresh-to-present latency (present_latency_stats).
+  std::array<uint64_t, kGuestOutputMailboxSize> guest_output_refresh_ticks_ = {};
+  // Protected by guest_output_mailbox_consumer_mutex_, as samples are gathered
+  // when a new image is acquired.
+  uint64_t present_latency_total_ticks_ = 0;
+  uint64_t present_latency_max_ticks_ = 0;
+  uint32_t present_latency_sample_count_ = 0;
   // Accessible only by refreshing, whether the last refresh contained an image
   // rather than being blank.
   bool guest_output_active_last_refresh_ = false;
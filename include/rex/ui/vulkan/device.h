@@ -140,6 +140,10 @@ class VulkanDevice {
     bool fragmentShaderSampleInterlock = false;
     bool fragmentShaderPixelInterlock = false;
 
+    // VK_EXT_extended_dynamic_state (#268, promoted to 1.3)
+
+    bool extendedDynamicState = false;
+
     // VK_EXT_shader_demote_to_helper_invocation (#277, promoted to 1.3)
 
     bool shaderDemoteToHelperInvocation = false;
@@ -170,6 +174,9 @@ class VulkanDevice {
     bool ext_1_1_KHR_bind_memory2 = false;              // #158
     bool ext_1_2_KHR_spirv_1_4 = false;                 // #237
     bool ext_EXT_memory_budget = false;                 // #238
+    // The feature itself is exposed via the `extendedDynamicState` device
+    // property.
+    bool ext_1_3_EXT_extended_dynamic_state = false;  // #268
     // Has optional features not implied by this being true.
     bool ext_1_3_KHR_maintenance4 = false;  // #414
   };
@@ -189,6 +196,8 @@ class VulkanDevice {
 #include <rex/ui/vulkan/functions/device_1_1_khr_get_memory_requirements2.inc>
     // VK_KHR_bind_memory2 (#158, promoted to 1.1)
 #include <rex/ui/vulkan/functions/device_1_1_khr_bind_memory2.inc>
+    // VK_EXT_extended_dynamic_state (#268, promoted to 1.3)
+#include <rex/ui/vulkan/functions/device_1_3_ext_extended_dynamic_state.inc>
     // VK_KHR_maintenance4 (#414, promoted to 1.3)
 #include <rex/ui/vulkan/functions/device_1_3_khr_maintenance4.inc>
 #undef XE_UI_VULKAN_FUNCTION_PROMOTED
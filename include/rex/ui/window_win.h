@@ -130,6 +130,10 @@ class Win32Window : public Window {
   // WM_MOUSEMOVE being sent, which would instantly reveal the cursor because of
   // that relative position change).
   POINT cursor_auto_hide_last_screen_pos_ = {LONG_MAX, LONG_MAX};
+  // The client position of the last WM_MOUSEMOVE dispatched to the listeners,
+  // for dropping the moves that don't actually change the position (which are
+  // sent in floods during window management) without waking all the listeners.
+  POINT mouse_move_last_client_pos_ = {LONG_MAX, LONG_MAX};
   // Using a timer queue timer for hiding the cursor rather than WM_TIMER
   // because the latter is a very low-priority message which is never received
   // if WM_PAINT messages are sent continuously (invalidating the window right
@@ -9,6 +9,7 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <algorithm>
 #include <array>
 #include <cstring>
 
@@ -22,15 +23,14 @@
 
 REXCVAR_DEFINE_BOOL(audio_mute, false, "Audio", "Mute audio output");
 
+REXCVAR_DECLARE(int32_t, audio_maxqframes);
+
 namespace rex::audio::sdl {
 
 SDLAudioDriver::SDLAudioDriver(memory::Memory* memory, rex::thread::Semaphore* semaphore)
     : AudioDriver(memory), semaphore_(semaphore) {}
 
-SDLAudioDriver::~SDLAudioDriver() {
-  assert_true(frames_queued_.empty());
-  assert_true(frames_unused_.empty());
-}
+SDLAudioDriver::~SDLAudioDriver() = default;
 
 bool SDLAudioDriver::Initialize() {
   SDL_version ver = {};
@@ -90,6 +90,11 @@ bool SDLAudioDriver::Initialize() {
   }
   sdl_device_channels_ = obtained_spec.channels;
 
+  // Size the frame ring to the submission credit count before the callback
+  // starts running.
+  frame_ring_capacity_ = uint32_t(std::max(1, REXCVAR_GET(audio_maxqframes)));
+  frame_ring_ = std::make_unique<float[]>(size_t(frame_ring_capacity_) * frame_samples_);
+
   SDL_PauseAudioDevice(sdl_device_id_, 0);
 
   return true;
@@ -97,23 +102,19 @@ bool SDLAudioDriver::Initialize() {
 
 void SDLAudioDriver::SubmitFrame(uint32_t frame_ptr) {
   const auto input_frame = memory_->TranslateVirtual<float*>(frame_ptr);
-  float* output_frame;
-  {
-    std::unique_lock<std::mutex> guard(frames_mutex_);
-    if (frames_unused_.empty()) {
-      output_frame = new float[frame_samples_];
-    } else {
-      output_frame = frames_unused_.top();
-      frames_unused_.pop();
-    }
-  }
-
-  std::memcpy(output_frame, input_frame, frame_samples_ * sizeof(float));
 
-  {
-    std::unique_lock<std::mutex> guard(frames_mutex_);
-    frames_queued_.push(output_frame);
+  uint32_t write_index = frame_write_index_.load(std::memory_order_relaxed);
+  uint32_t read_index = frame_read_index_.load(std::memory_order_acquire);
+  if (write_index - read_index >= frame_ring_capacity_) {
+    // The render callback has stalled (device lost or paused). Drop the frame
+    // but hand the submission credit back so the client keeps being pumped.
+    REXAPU_DEBUG("SDL: frame ring full, dropping submitted frame");
+    semaphore_->Release(1, nullptr);
+    return;
   }
+  float* slot = &frame_ring_[size_t(write_index % frame_ring_capacity_) * frame_samples_];
+  std::memcpy(slot, input_frame, frame_size_);
+  frame_write_index_.store(write_index + 1, std::memory_order_release);
 }
 
 void SDLAudioDriver::Shutdown() {
@@ -125,15 +126,10 @@ void SDLAudioDriver::Shutdown() {
     SDL_QuitSubSystem(SDL_INIT_AUDIO);
     sdl_initialized_ = false;
   }
-  std::unique_lock<std::mutex> guard(frames_mutex_);
-  while (!frames_unused_.empty()) {
-    delete[] frames_unused_.top();
-    frames_unused_.pop();
-  }
-  while (!frames_queued_.empty()) {
-    delete[] frames_queued_.front();
-    frames_queued_.pop();
-  }
+  // The callback is stopped at this point; any still-queued frames go with
+  // the ring.
+  frame_ring_.reset();
+  frame_ring_capacity_ = 0;
 }
 
 void SDLAudioDriver::SDLCallback(void* userdata, Uint8* stream, int len) {
@@ -146,12 +142,15 @@ void SDLAudioDriver::SDLCallback(void* userdata, Uint8* stream, int len) {
   assert_true(len ==
               static_cast<int>(sizeof(float) * channel_samples_ * driver->sdl_device_channels_));
 
-  std::unique_lock<std::mutex> guard(driver->frames_mutex_);
-  if (driver->frames_queued_.empty()) {
+  uint32_t read_index = driver->frame_read_index_.load(std::memory_order_relaxed);
+  uint32_t write_index = driver->frame_write_index_.load(std::memory_order_acquire);
+  if (read_index == write_index) {
     std::memset(stream, 0, len);
   } else {
-    auto buffer = driver->frames_queued_.front();
-    driver->frames_queued_.pop();
+    // Convert straight out of the ring slot: the producer can't reuse it
+    // until the read index is advanced below.
+    const float* buffer =
+        &driver->frame_ring_[size_t(read_index % driver->frame_ring_capacity_) * frame_samples_];
     if (REXCVAR_GET(audio_mute)) {
       std::memset(stream, 0, len);
     } else {
@@ -169,7 +168,7 @@ void SDLAudioDriver::SDLCallback(void* userdata, Uint8* stream, int len) {
           break;
       }
     }
-    driver->frames_unused_.push(buffer);
+    driver->frame_read_index_.store(read_index + 1, std::memory_order_release);
 
     auto ret = driver->semaphore_->Release(1, nullptr);
     assert_true(ret);
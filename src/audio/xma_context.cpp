@@ -12,7 +12,10 @@
 #include <algorithm>
 #include <cstring>
 
+#include <xxhash.h>
+
 #include <rex/audio/xma/context.h>
+#include <rex/cvar.h>
 #include <rex/audio/xma/decoder.h>
 #include <rex/audio/xma/helpers.h>
 #include <rex/dbg.h>
@@ -35,6 +38,11 @@ extern "C" {
 // Credits for most of this code goes to:
 // https://github.com/koolkdev/libertyv/blob/master/libav_wrapper/xma2dec.c
 
+REXCVAR_DEFINE_UINT32(xma_loop_frame_cache_kb, 4096, "Audio",
+                      "Per-context cap in KB for the decoded-PCM cache of looping XMA streams; "
+                      "loop passes replay cached frames instead of re-decoding them. 0 disables "
+                      "the cache.");
+
 namespace rex::audio {
 
 using stream::BitStream;
@@ -151,6 +159,9 @@ void XmaContext::Clear() {
   data.output_buffer_write_offset = 0;
 
   data.Store(context_ptr);
+
+  loop_frame_cache_.clear();
+  prev_frame_hash_ = 0;
 }
 
 void XmaContext::Disable() {
@@ -167,6 +178,9 @@ void XmaContext::Release() {
   set_is_allocated(false);
   auto context_ptr = memory()->TranslateVirtual(guest_ptr());
   std::memset(context_ptr, 0, sizeof(XMA_CONTEXT_DATA));  // Zero it.
+
+  loop_frame_cache_.clear();
+  prev_frame_hash_ = 0;
 }
 
 void XmaContext::SwapInputBuffer(XMA_CONTEXT_DATA* data) {
@@ -562,29 +576,47 @@ void XmaContext::Decode(XMA_CONTEXT_DATA* data) {
     split_frame_len_partial_ = 0;
     split_frame_padding_start_ = 0;
 
-    auto ret = avcodec_send_packet(av_context_, av_packet_);
-    if (ret < 0) {
-      REXAPU_ERROR("XmaContext {}: Error sending packet for decoding", id());
-      // TODO bail out
-      assert_always();
-    }
-    ret = avcodec_receive_frame(av_context_, av_frame_);
-    /*
-    if (ret == AVERROR(EAGAIN) || ret == AVERROR_EOF)
-      // TODO AVERROR_EOF???
-      break;
-    else
-    */
-    if (ret < 0) {
-      REXAPU_ERROR("XmaContext {}: Error during decoding", id());
-      assert_always();
-      return;  // TODO bail out
+    // Loop passes feed the codec the exact same frame bits every iteration;
+    // replay the converted PCM from the cache instead of decoding again. The
+    // key chains the previous frame's hash because frames overlap-add across
+    // their neighbours, so identical bits after a different decode history
+    // must not alias.
+    const uint32_t frame_pcm_bytes = kBytesPerFrameChannel << data->is_stereo;
+    const uint64_t cache_cap_bytes = uint64_t(REXCVAR_GET(xma_loop_frame_cache_kb)) * 1024;
+    uint64_t frame_key = 0;
+    bool cached_frame = false;
+    if (cache_cap_bytes) {
+      uint64_t seed =
+          prev_frame_hash_ ^ (uint64_t(data->sample_rate << 1 | data->is_stereo) << 32);
+      frame_key = XXH3_64bits_withSeed(av_packet_->data, av_packet_->size, seed);
+      prev_frame_hash_ = frame_key;
+      auto it = loop_frame_cache_.find(frame_key);
+      if (it != loop_frame_cache_.end()) {
+        std::memcpy(raw_frame_.data(), it->second.data(), frame_pcm_bytes);
+        cached_frame = true;
+      }
     }
-    assert_true(ret == 0);
 
-    {
-      // copy over 1 frame
-      // update input buffer read offset
+    if (!cached_frame) {
+      auto ret = avcodec_send_packet(av_context_, av_packet_);
+      if (ret < 0) {
+        REXAPU_ERROR("XmaContext {}: Error sending packet for decoding", id());
+        // TODO bail out
+        assert_always();
+      }
+      ret = avcodec_receive_frame(av_context_, av_frame_);
+      /*
+      if (ret == AVERROR(EAGAIN) || ret == AVERROR_EOF)
+        // TODO AVERROR_EOF???
+        break;
+      else
+      */
+      if (ret < 0) {
+        REXAPU_ERROR("XmaContext {}: Error during decoding", id());
+        assert_always();
+        return;  // TODO bail out
+      }
+      assert_true(ret == 0);
 
       // assert(decoded_consumed_samples_ + kSamplesPerFrame <=
       //       current_frame_.size());
@@ -595,7 +627,19 @@ void XmaContext::Decode(XMA_CONTEXT_DATA* data) {
       ConvertFrame((const uint8_t**)av_frame_->data, bool(data->is_stereo), raw_frame_.data());
       // decoded_consumed_samples_ += kSamplesPerFrame;
 
-      auto byte_count = kBytesPerFrameChannel << data->is_stereo;
+      // Only looping streams revisit frames, so only they get cached.
+      if (cache_cap_bytes && data->loop_count > 0 &&
+          loop_frame_cache_.size() * frame_pcm_bytes < cache_cap_bytes) {
+        loop_frame_cache_.emplace(
+            frame_key, std::vector<uint8_t>(raw_frame_.data(), raw_frame_.data() + frame_pcm_bytes));
+      }
+    }
+
+    {
+      // copy over 1 frame
+      // update input buffer read offset
+
+      auto byte_count = frame_pcm_bytes;
       assert_true(output_remaining_bytes >= byte_count);
       output_rb.Write(raw_frame_.data(), byte_count);
       output_remaining_bytes -= byte_count;
@@ -27,6 +27,10 @@ extern "C" {
 
 REXCVAR_DEFINE_BOOL(ffmpeg_verbose, false, "Audio", "Verbose FFmpeg output (debug and above)");
 
+REXCVAR_DEFINE_UINT32(xma_decode_threads, 2, "Audio",
+                      "Number of XMA decode workers (1-8); contexts are sharded across them by id")
+    .lifecycle(rex::cvar::Lifecycle::kInitOnly);
+
 // As with normal Microsoft, there are like twelve different ways to access
 // the audio APIs. Early games use XMA*() methods almost exclusively to touch
 // decoders. Later games use XAudio*() and direct memory writes to the XMA
@@ -121,27 +125,36 @@ X_STATUS XmaDecoder::Setup(system::KernelState* kernel_state) {
   register_file_[XmaRegister::NextContextIndex] = 1;
   context_bitmap_.Resize(kContextCount);
 
+  worker_count_ = std::clamp<uint32_t>(REXCVAR_GET(xma_decode_threads), 1, 8);
   worker_running_ = true;
-  work_event_ = rex::thread::Event::CreateAutoResetEvent(false);
-  assert_not_null(work_event_);
-  worker_thread_ = system::object_ref<system::XHostThread>(
-      new system::XHostThread(kernel_state, 128 * 1024, 0, [this]() {
-        WorkerThreadMain();
-        return 0;
-      }));
-  worker_thread_->set_name("XMA Decoder");
-
-  worker_thread_->Create();
+  for (uint32_t i = 0; i < worker_count_; ++i) {
+    auto work_event = rex::thread::Event::CreateAutoResetEvent(false);
+    assert_not_null(work_event);
+    work_events_.push_back(std::move(work_event));
+    pause_fences_.push_back(std::make_unique<rex::thread::Fence>());
+    resume_fences_.push_back(std::make_unique<rex::thread::Fence>());
+  }
+  for (uint32_t i = 0; i < worker_count_; ++i) {
+    auto worker_thread = system::object_ref<system::XHostThread>(
+        new system::XHostThread(kernel_state, 128 * 1024, 0, [this, i]() {
+          WorkerThreadMain(i);
+          return 0;
+        }));
+    worker_thread->set_name(fmt::format("XMA Decoder {}", i));
+    worker_thread->Create();
+    worker_threads_.push_back(std::move(worker_thread));
+  }
 
   return X_STATUS_SUCCESS;
 }
 
-void XmaDecoder::WorkerThreadMain() {
+void XmaDecoder::WorkerThreadMain(uint32_t worker_index) {
   uint32_t idle_loop_count = 0;
   while (worker_running_) {
-    // Okay, let's loop through XMA contexts to find ones we need to decode!
+    // Okay, let's loop through our shard of the XMA contexts to find ones we
+    // need to decode!
     bool did_work = false;
-    for (uint32_t n = 0; n < kContextCount && worker_running_; n++) {
+    for (uint32_t n = worker_index; n < kContextCount && worker_running_; n += worker_count_) {
       XmaContext& context = contexts_[n];
       did_work = context.Work() || did_work;
 
@@ -152,8 +165,8 @@ void XmaDecoder::WorkerThreadMain() {
     }
 
     if (paused_) {
-      pause_fence_.Signal();
-      resume_fence_.Wait();
+      pause_fences_[worker_index]->Signal();
+      resume_fences_[worker_index]->Wait();
     }
 
     if (!did_work) {
@@ -164,7 +177,7 @@ void XmaDecoder::WorkerThreadMain() {
 
     if (idle_loop_count > 500) {
       // Idle for an extended period. Introduce a 20ms wait.
-      rex::thread::Wait(work_event_.get(), false, std::chrono::milliseconds(20));
+      rex::thread::Wait(work_events_[worker_index].get(), false, std::chrono::milliseconds(20));
     }
 
     rex::thread::MaybeYield();
@@ -172,26 +185,29 @@ void XmaDecoder::WorkerThreadMain() {
 }
 
 void XmaDecoder::Shutdown() {
-  if (!worker_thread_) {
+  if (worker_threads_.empty()) {
     return;
   }
 
   worker_running_ = false;
 
-  if (work_event_) {
-    work_event_->Set();
+  for (auto& work_event : work_events_) {
+    work_event->Set();
   }
 
   if (paused_) {
     Resume();
   }
 
-  // Wait up to 2 seconds for worker thread to exit gracefully.
-  auto result = rex::thread::Wait(worker_thread_->thread(), false, std::chrono::milliseconds(2000));
-  if (result == rex::thread::WaitResult::kTimeout) {
-    REXAPU_WARN("XMA: Worker thread did not exit within 2s, abandoning");
+  // Wait up to 2 seconds for each worker thread to exit gracefully.
+  for (auto& worker_thread : worker_threads_) {
+    auto result =
+        rex::thread::Wait(worker_thread->thread(), false, std::chrono::milliseconds(2000));
+    if (result == rex::thread::WaitResult::kTimeout) {
+      REXAPU_WARN("XMA: Worker thread did not exit within 2s, abandoning");
+    }
   }
-  worker_thread_.reset();
+  worker_threads_.clear();
 
   if (context_data_first_ptr_) {
     memory()->SystemHeapFree(context_data_first_ptr_);
@@ -292,15 +308,21 @@ void XmaDecoder::WriteRegister(uint32_t addr, uint32_t value) {
 
     // The context ID is a bit in the range of the entire context array.
     uint32_t base_context_id = (r - XmaRegister::Context0Kick) * 32;
+    uint32_t worker_mask = 0;
     for (int i = 0; value && i < 32; ++i, value >>= 1) {
       if (value & 1) {
         uint32_t context_id = base_context_id + i;
         auto& context = contexts_[context_id];
         context.Enable();
+        worker_mask |= 1u << (context_id % worker_count_);
+      }
+    }
+    // Signal the owning decoder workers to start processing.
+    for (uint32_t i = 0; i < worker_count_; ++i) {
+      if (worker_mask & (1u << i)) {
+        work_events_[i]->Set();
       }
     }
-    // Signal the decoder thread to start processing.
-    work_event_->Set();
   } else if (r >= XmaRegister::Context0Lock && r <= XmaRegister::Context9Lock) {
     // Context lock command.
     // This requests a lock by flagging the context.
@@ -351,7 +373,10 @@ void XmaDecoder::Pause() {
   }
   paused_ = true;
 
-  pause_fence_.Wait();
+  // Every worker must park before the decoder is considered paused.
+  for (auto& pause_fence : pause_fences_) {
+    pause_fence->Wait();
+  }
 }
 
 void XmaDecoder::Resume() {
@@ -360,7 +385,11 @@ void XmaDecoder::Resume() {
   }
   paused_ = false;
 
-  resume_fence_.Signal();
+  // Per-worker fences: the signal is sticky with exactly one waiter, so a
+  // worker that hasn't parked yet still gets released when it arrives.
+  for (auto& resume_fence : resume_fences_) {
+    resume_fence->Signal();
+  }
 }
 
 }  // namespace rex::audio
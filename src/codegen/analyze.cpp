@@ -16,8 +16,13 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <bitset>
+#include <cstdio>
+#include <filesystem>
 #include <map>
+#include <memory>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -35,8 +40,8 @@
 #include <rex/types.h>
 
 #include <ppc.h>
+#include <xxhash.h>
 
-using rex::codegen::ppc::decode_instruction;
 using rex::codegen::ppc::Opcode;
 using rex::memory::load_and_swap;
 
@@ -65,7 +70,20 @@ std::unordered_set<uint32_t> buildKnownFunctions(const FunctionGraph& graph,
   return result;
 }
 
-// Forward declaration (defined later in the file)
+// Forward declarations (defined later in the file)
+
+/// Result of the read-only scan half of function discovery. All graph
+/// mutation is deferred to applyFunctionScan() so scans can run concurrently.
+struct FunctionScanResult {
+  uint32_t funcAddr = 0;
+  bool valid = false;     ///< Scan produced blocks to apply
+  bool isImport = false;  ///< Node is an import thunk (no block scan)
+  BlockDiscoveryResult blocks;
+};
+
+FunctionScanResult scanFunctionBlocks(CodegenContext& ctx, uint32_t funcAddr,
+                                      const std::unordered_set<uint32_t>& knownFunctions);
+void applyFunctionScan(CodegenContext& ctx, FunctionScanResult&& scan);
 void discoverFunction(CodegenContext& ctx, uint32_t funcAddr,
                       const std::unordered_set<uint32_t>& knownFunctions);
 
@@ -79,9 +97,49 @@ size_t discoverPendingFunctions(CodegenContext& ctx,
       pending.push_back(addr);
     }
   }
-  for (uint32_t funcAddr : pending) {
-    discoverFunction(ctx, funcAddr, knownFunctions);
+  std::sort(pending.begin(), pending.end());
+
+  size_t jobCount = REXCVAR_GET(jobs);
+  if (jobCount == 0)
+    jobCount = std::thread::hardware_concurrency();
+
+  // Spinning up workers is only worth it for real batches.
+  constexpr size_t kParallelScanThreshold = 64;
+  if (jobCount <= 1 || pending.size() < kParallelScanThreshold) {
+    for (uint32_t funcAddr : pending) {
+      discoverFunction(ctx, funcAddr, knownFunctions);
+    }
+    return pending.size();
+  }
+
+  // Scan phase: block discovery only reads the graph, the decoded binary and
+  // the scan artifacts, so pending functions can be scanned concurrently.
+  std::vector<FunctionScanResult> results(pending.size());
+  std::atomic<size_t> nextIndex{0};
+
+  jobCount = std::min(jobCount, pending.size());
+  std::vector<std::thread> workers;
+  workers.reserve(jobCount);
+  for (size_t i = 0; i < jobCount; i++) {
+    workers.emplace_back([&]() {
+      for (;;) {
+        const size_t index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+        if (index >= pending.size())
+          break;
+        results[index] = scanFunctionBlocks(ctx, pending[index], knownFunctions);
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  // Merge phase: apply in address order so the graph evolves deterministically
+  // regardless of scan scheduling.
+  for (auto& result : results) {
+    applyFunctionScan(ctx, std::move(result));
   }
+
   return pending.size();
 }
 
@@ -123,21 +181,9 @@ struct PrologInfo {
 
 // Scan function prolog to extract frame size and save helper
 // Only called for functions with ExceptionFlag set
-PrologInfo scanProlog(const BinaryView& binary, uint32_t funcAddr, uint32_t prologLength) {
+PrologInfo scanProlog(const DecodedBinary& binary, uint32_t funcAddr, uint32_t prologLength) {
   PrologInfo info;
 
-  auto* section = binary.findSection(funcAddr);
-  if (!section || !section->data) {
-    return info;
-  }
-
-  uint32_t offset = funcAddr - section->baseAddress;
-  if (offset + prologLength * 4 > section->size) {
-    return info;
-  }
-
-  const uint8_t* code = section->data + offset;
-
   // Use pdata prolog length - if 0, we can't safely scan
   if (prologLength == 0) {
     REXCODEGEN_WARN("SEH function 0x{:08X}: PrologLength=0, cannot determine frame size", funcAddr);
@@ -145,9 +191,12 @@ PrologInfo scanProlog(const BinaryView& binary, uint32_t funcAddr, uint32_t prol
   }
 
   for (uint32_t i = 0; i < prologLength; i++) {
-    uint32_t raw = load_and_swap<uint32_t>(code + i * 4);
     uint32_t addr = funcAddr + i * 4;
-    auto decoded = decode_instruction(addr, raw);
+    const auto* insn = binary.get(addr);
+    if (insn == nullptr) {
+      return info;
+    }
+    const auto& decoded = *insn;
 
     // Check for addi r31, r1, -N (frame pointer setup)
     if (decoded.opcode == Opcode::addi && decoded.D.RT == 31 && decoded.D.RA == 1) {
@@ -463,6 +512,64 @@ void detectSaveRestoreHelpers(const BinaryView& binary, AnalysisState& state) {
   }
 }
 
+//=============================================================================
+// Quarantine bookkeeping for analysis error recovery
+//=============================================================================
+// Regions that failed validation are recorded as data instead of aborting the
+// run, and persisted next to the incremental cache so later runs skip them.
+
+std::filesystem::path quarantinePath(const CodegenContext& ctx) {
+  return ctx.configDir() / ctx.Config().outDirectoryPath /
+         fmt::format("{}_recomp.quarantine", ctx.Config().projectName);
+}
+
+bool isQuarantined(const AnalysisState& state, uint32_t addr) {
+  for (const auto& region : state.quarantinedRegions) {
+    if (region.contains(addr))
+      return true;
+  }
+  return false;
+}
+
+/// Load ranges quarantined by previous runs. They become invalid-instruction
+/// entries so scanning treats them as data, and validation skips targets
+/// inside them instead of re-reporting the same errors every run.
+void loadQuarantinedRegions(CodegenContext& ctx) {
+  auto& state = ctx.analysisState();
+
+  FILE* f = fopen(quarantinePath(ctx).string().c_str(), "r");
+  if (!f)
+    return;
+
+  unsigned long long start = 0;
+  unsigned long long end = 0;
+  while (fscanf(f, "%llx %llx", &start, &end) == 2) {
+    if (end <= start)
+      continue;
+    CodeRegion region{static_cast<uint32_t>(start), static_cast<uint32_t>(end)};
+    state.quarantinedRegions.push_back(region);
+    state.invalidInstructions[region.start] = region.size();
+  }
+  fclose(f);
+
+  if (!state.quarantinedRegions.empty())
+    REXCODEGEN_INFO("Analyze: carrying over {} quarantined regions from previous runs",
+                    state.quarantinedRegions.size());
+}
+
+void saveQuarantinedRegions(const CodegenContext& ctx) {
+  const auto& regions = ctx.analysisState().quarantinedRegions;
+
+  FILE* f = fopen(quarantinePath(ctx).string().c_str(), "w");
+  if (!f) {
+    REXCODEGEN_WARN("Failed to write quarantine file: {}", quarantinePath(ctx).string());
+    return;
+  }
+  for (const auto& region : regions)
+    fprintf(f, "%x %x\n", region.start, region.end);
+  fclose(f);
+}
+
 //=============================================================================
 // Register Phase: imports, helpers, PDATA, config functions
 //=============================================================================
@@ -486,6 +593,10 @@ VoidResult registerEntryPoints(CodegenContext& ctx, std::vector<uint32_t>& ehDis
     state.exceptionHandlerFuncs.push_back(addr);
   }
 
+  // Ranges quarantined by previous runs behave like invalid-instruction hints
+  if (config.quarantineAnalysisErrors)
+    loadQuarantinedRegions(ctx);
+
   // Build chunksByParent from config.functions
   for (const auto& [addr, cfg] : config.functions) {
     if (cfg.isChunk()) {
@@ -654,7 +765,7 @@ VoidResult registerEntryPoints(CodegenContext& ctx, std::vector<uint32_t>& ehDis
     PrologInfo prologInfo;
     if (fn.ExceptionFlag) {
       // Scan prolog to get frame size for SEH unwinding
-      prologInfo = scanProlog(binary, beginAddr, fn.PrologLength);
+      prologInfo = scanProlog(ctx.decoded(), beginAddr, fn.PrologLength);
 
       exInfo = parseExceptionInfo(binary, beginAddr);
       if (exInfo) {
@@ -881,26 +992,29 @@ void scanBinary(CodegenContext& ctx) {
 // Discover Phase: iterative function block discovery
 //=============================================================================
 
-void discoverFunction(CodegenContext& ctx, uint32_t funcAddr,
-                      const std::unordered_set<uint32_t>& knownFunctions) {
+FunctionScanResult scanFunctionBlocks(CodegenContext& ctx, uint32_t funcAddr,
+                                      const std::unordered_set<uint32_t>& knownFunctions) {
+  FunctionScanResult scan;
+  scan.funcAddr = funcAddr;
+
   auto& graph = ctx.graph;
   auto& binary = ctx.binary();
   auto& decoded = ctx.decoded();
 
   auto* node = graph.getFunction(funcAddr);
   if (!node)
-    return;
+    return scan;
 
   // Skip if already discovered
   if (!node->canDiscover()) {
     REXCODEGEN_TRACE("Analyze: function 0x{:08X} already discovered, skipping", funcAddr);
-    return;
+    return scan;
   }
 
   // Imports don't need block discovery
   if (node->isImport()) {
-    node->discoverAsImport();
-    return;
+    scan.isImport = true;
+    return scan;
   }
 
   REXCODEGEN_TRACE("Analyze: discovering function 0x{:08X} ({})", funcAddr, node->name());
@@ -933,43 +1047,20 @@ void discoverFunction(CodegenContext& ctx, uint32_t funcAddr,
   }
   if (!region) {
     REXCODEGEN_WARN("Analyze: function 0x{:08X} not in any code region", funcAddr);
-    return;
+    return scan;
   }
 
   // Pass pdataSize so forward branches within function extent are correctly identified
-  auto result = discoverBlocks(decoded, funcAddr, *region, knownFunctions, pdataSize);
+  auto result =
+      discoverBlocks(decoded, funcAddr, *region, knownFunctions, pdataSize, ctx.jumpTableCache());
 
   if (result.blocks.empty()) {
     REXCODEGEN_WARN("Analyze: no blocks found for function 0x{:08X}", funcAddr);
-    return;
-  }
-
-  // snooper the function with the discovered blocks and instructions
-  node->discover(std::move(result.blocks), std::move(result.instructions),
-                 std::move(result.labels));
-
-  // Add jump tables (targets become labels in the function)
-  for (const auto& jt : result.jumpTables) {
-    graph.addJumpTableToFunction(funcAddr, jt);
+    return scan;
   }
 
-  // Register external call targets as new functions (bl only, not b)
-  for (uint32_t target : result.externalCalls) {
-    if (!graph.isEntryPoint(target) && !graph.isImport(target)) {
-      if (binary.isInImportExportRange(target)) {
-        continue;
-      }
-      graph.addFunction(target, 4, FunctionAuthority::DISCOVERED, true);
-    }
-  }
-
-  // Add unresolved branches for later resolution
-  for (const auto& branch : result.unresolvedBranches) {
-    graph.addUnresolvedJumpToFunction(funcAddr, branch.site, branch.target, branch.isCall,
-                                      branch.isConditional);
-  }
-
-  // Scan exception handler regions for branches not in discovered blocks
+  // Scan exception handler regions for branches not in discovered blocks.
+  // Findings are folded into the discovery result and applied with the rest.
   if (pdataSize > 0) {
     std::unordered_set<uint32_t> discoveredAddrs;
     for (const auto& block : result.blocks) {
@@ -1017,18 +1108,69 @@ void discoverFunction(CodegenContext& ctx, uint32_t funcAddr,
           continue;
         }
 
-        graph.addUnresolvedJumpToFunction(funcAddr, site, target, isCall, false);
+        result.unresolvedBranches.push_back(
+            UnresolvedBranch{.site = site, .target = target, .isCall = isCall,
+                             .isConditional = false});
 
-        // Register call targets as new functions
-        if (isCall && !graph.isEntryPoint(target) && !graph.isImport(target)) {
-          if (binary.isInImportExportRange(target)) {
-            continue;
-          }
-          graph.addFunction(target, 4, FunctionAuthority::DISCOVERED, true);
+        // Call targets become new function candidates (registered at apply)
+        if (isCall) {
+          result.externalCalls.push_back(target);
         }
       }
     }
   }
+
+  scan.blocks = std::move(result);
+  scan.valid = true;
+  return scan;
+}
+
+void applyFunctionScan(CodegenContext& ctx, FunctionScanResult&& scan) {
+  auto& graph = ctx.graph;
+  auto& binary = ctx.binary();
+
+  auto* node = graph.getFunction(scan.funcAddr);
+  if (!node)
+    return;
+
+  if (scan.isImport) {
+    node->discoverAsImport();
+    return;
+  }
+  if (!scan.valid)
+    return;
+
+  auto result = std::move(scan.blocks);
+
+  // snooper the function with the discovered blocks and instructions
+  node->discover(std::move(result.blocks), std::move(result.instructions),
+                 std::move(result.labels));
+
+  // Add jump tables (targets become labels in the function)
+  for (const auto& jt : result.jumpTables) {
+    graph.addJumpTableToFunction(scan.funcAddr, jt);
+  }
+
+  // Register external call targets as new functions (bl only, not b)
+  for (uint32_t target : result.externalCalls) {
+    if (!graph.isEntryPoint(target) && !graph.isImport(target)) {
+      if (binary.isInImportExportRange(target)) {
+        continue;
+      }
+      graph.addFunction(target, 4, FunctionAuthority::DISCOVERED, true);
+    }
+  }
+
+  // Add unresolved branches for later resolution
+  for (const auto& branch : result.unresolvedBranches) {
+    graph.addUnresolvedJumpToFunction(scan.funcAddr, branch.site, branch.target, branch.isCall,
+                                      branch.isConditional);
+  }
+}
+
+void discoverFunction(CodegenContext& ctx, uint32_t funcAddr,
+                      const std::unordered_set<uint32_t>& knownFunctions) {
+  applyFunctionScan(ctx, scanFunctionBlocks(ctx, funcAddr, knownFunctions));
 }
 
 void discoverAllFunctions(CodegenContext& ctx) {
@@ -1243,24 +1385,470 @@ void functionPointerScan(CodegenContext& ctx) {
   REXCODEGEN_INFO("functionPointerScan: found {} new function pointer targets", foundCount);
 }
 
+//=============================================================================
+// Devirtualization: resolve bctr/bctrl sites with provably constant ctr
+//=============================================================================
+
+/// Record direct call edges at indirect call sites where the ctr value is a
+/// compile-time constant. Two sources are accepted:
+///   - lis/addi (or lis/ori) chains materializing a function entry address
+///   - lwz from a constant address landing inside a discovered vtable's slot
+///     array (slots live in read-only data, so the loaded value cannot change)
+/// Unlike functionPointerScan this never registers new functions - the target
+/// must already be a graph entry point - so a missed pattern just keeps the
+/// PPC_CALL_INDIRECT_FUNC fallback and a false positive is impossible as long
+/// as the per-block constant tracking stays conservative.
+void devirtualizeConstantCtrCalls(CodegenContext& ctx) {
+  if (!ctx.hasDecoded()) {
+    REXCODEGEN_WARN("devirtualizeConstantCtrCalls: DecodedBinary not initialized, skipping");
+    return;
+  }
+
+  auto& graph = ctx.graph;
+  auto& decoded = ctx.decoded();
+
+  // Map every vtable slot address to the function address stored in it
+  std::unordered_map<uint32_t, uint32_t> slotValues;
+  {
+    VTableScanner vtScanner(ctx.binary());
+    for (const auto& vt : vtScanner.scan()) {
+      for (size_t i = 0; i < vt.slots.size(); i++) {
+        slotValues.emplace(vt.vtableAddress + static_cast<uint32_t>(i * 4), vt.slots[i]);
+      }
+    }
+  }
+
+  size_t devirtualized = 0;
+
+  for (const auto& [entry, node] : graph.functions()) {
+    for (const auto& block : node->blocks()) {
+      // Per-register constant tracking, reset at block boundaries. Any
+      // instruction we don't model wipes the state, so only straight-line
+      // materialize/load/mtctr sequences survive to the call site.
+      std::array<uint32_t, 32> regValues{};
+      std::bitset<32> regValid;
+      uint32_t ctrValue = 0;
+      bool ctrValid = false;
+
+      for (uint32_t addr = block.base; addr < block.end(); addr += 4) {
+        auto* insn = decoded.get(addr);
+        if (!insn) {
+          regValid.reset();
+          ctrValid = false;
+          continue;
+        }
+
+        if (isLis(*insn)) {
+          regValues[insn->D.RT] = static_cast<uint32_t>(insn->D.SIMM()) << 16;
+          regValid.set(insn->D.RT);
+          continue;
+        }
+
+        if (insn->opcode == Opcode::li) {
+          regValues[insn->D.RT] = static_cast<uint32_t>(insn->D.SIMM());
+          regValid.set(insn->D.RT);
+          continue;
+        }
+
+        if (insn->opcode == Opcode::addi) {
+          if (regValid.test(insn->D.RA)) {
+            regValues[insn->D.RT] = regValues[insn->D.RA] + insn->D.SIMM();
+            regValid.set(insn->D.RT);
+          } else {
+            regValid.reset(insn->D.RT);
+          }
+          continue;
+        }
+
+        if (insn->opcode == Opcode::ori) {
+          // ori rA, rS, UIMM - destination is RA, source is RT
+          if (regValid.test(insn->D.RT)) {
+            regValues[insn->D.RA] = regValues[insn->D.RT] | insn->D.UIMM();
+            regValid.set(insn->D.RA);
+          } else {
+            regValid.reset(insn->D.RA);
+          }
+          continue;
+        }
+
+        if (insn->opcode == Opcode::lwz) {
+          // Only a load from a vtable slot yields a known constant
+          if (insn->D.RA != 0 && regValid.test(insn->D.RA)) {
+            auto it = slotValues.find(regValues[insn->D.RA] + insn->D.SIMM());
+            if (it != slotValues.end()) {
+              regValues[insn->D.RT] = it->second;
+              regValid.set(insn->D.RT);
+              continue;
+            }
+          }
+          regValid.reset(insn->D.RT);
+          continue;
+        }
+
+        if (insn->opcode == Opcode::mtctr ||
+            (insn->opcode == Opcode::mtspr && insn->XFX.spr_num() == 9)) {
+          ctrValid = regValid.test(insn->XFX.RT);
+          ctrValue = regValues[insn->XFX.RT];
+          continue;
+        }
+
+        if (insn->opcode == Opcode::bcctr || insn->opcode == Opcode::bcctrl) {
+          // Only unconditional forms - the builders for conditional ctr
+          // branches always go through the indirect path
+          if (ctrValid && insn->XL.BO == 20) {
+            if (auto* target = graph.getFunction(ctrValue)) {
+              if (insn->opcode == Opcode::bcctrl) {
+                graph.addCallToFunction(entry, addr, CallTarget::function(target));
+              } else {
+                graph.addTailCallToFunction(entry, addr, CallTarget::function(target));
+              }
+              devirtualized++;
+              REXCODEGEN_TRACE("devirtualize: 0x{:08X} {} -> {}", addr,
+                               insn->opcode == Opcode::bcctrl ? "bctrl" : "bctr",
+                               target->name());
+            }
+          }
+          // The call clobbers volatile registers and ctr
+          regValid.reset();
+          ctrValid = false;
+          continue;
+        }
+
+        // Unmodeled instruction - drop everything we thought we knew
+        regValid.reset();
+        ctrValid = false;
+      }
+    }
+  }
+
+  REXCODEGEN_INFO("Analyze: devirtualized {} constant ctr call sites", devirtualized);
+}
+
+//=============================================================================
+// Leaf function detection
+//=============================================================================
+
+/// Mark functions that make no calls (direct, tail or indirect) and never
+/// read lr. Call sites targeting a leaf can skip the ctx.lr store: the
+/// emitted body returns natively, so lr is only observable if the callee
+/// executes mflr - which a leaf by definition never does. Runs after
+/// devirtualization so devirtualized tail-call edges are visible.
+void markLeafFunctions(CodegenContext& ctx) {
+  if (!ctx.hasDecoded()) {
+    REXCODEGEN_WARN("markLeafFunctions: DecodedBinary not initialized, skipping");
+    return;
+  }
+
+  auto& graph = ctx.graph;
+  auto& decoded = ctx.decoded();
+
+  size_t leafCount = 0;
+
+  for (const auto& [entry, node] : graph.functions()) {
+    if (node->isImport() || node->blocks().empty())
+      continue;
+    if (!node->calls().empty() || !node->tailCalls().empty())
+      continue;
+
+    bool leaf = true;
+    for (const auto& block : node->blocks()) {
+      for (uint32_t addr = block.base; leaf && addr < block.end(); addr += 4) {
+        auto* insn = decoded.get(addr);
+        if (!insn)
+          continue;
+
+        // Any call or ctr/lr branch means a callee could observe lr
+        if (isCall(*insn) || insn->opcode == Opcode::bcctr || insn->opcode == Opcode::bclrl) {
+          leaf = false;
+        } else if (insn->opcode == Opcode::mflr ||
+                   (insn->opcode == Opcode::mfspr && insn->XFX.spr_num() == 8)) {
+          leaf = false;
+        }
+      }
+      if (!leaf)
+        break;
+    }
+
+    if (leaf) {
+      graph.setFunctionLeaf(entry, true);
+      leafCount++;
+    }
+  }
+
+  REXCODEGEN_INFO("Analyze: {} leaf functions", leafCount);
+}
+
+//=============================================================================
+// CR field consumption analysis for compare+branch fusion
+//=============================================================================
+
+/// CR field this instruction writes in full, or -1. Record forms count too:
+/// their builders always materialize the field, so a reader adjacent to one
+/// stays correct whether or not compare fusion fires elsewhere.
+int crFieldWritten(const DecodedInsn& insn) {
+  switch (insn.opcode) {
+    case Opcode::cmp:
+    case Opcode::cmpl:
+    case Opcode::fcmpu:
+    case Opcode::fcmpo:
+      return insn.X.RT >> 2;
+    case Opcode::cmpi:
+    case Opcode::cmpli:
+      return insn.D.RT >> 2;
+    default:
+      break;
+  }
+  if (insn.is_record_form()) {
+    if (insn.format == ppc::InstrFormat::kVXR)
+      return 6;  // vcmp*. writes cr6
+    // Floating-point dot forms copy FPSCR exception bits into cr1
+    return ppc::get_opcode_info(insn.opcode).group == ppc::OpcodeGroup::kFloat ? 1 : 0;
+  }
+  return -1;
+}
+
+/// Bitmask of CR fields this instruction may read. Undecoded opcode 19/31
+/// encodings cover the rare CR plumbing the decoder does not know (cr-logical
+/// ops, mcrf, mfocrf, isel, ...) and conservatively read everything.
+uint32_t crFieldsRead(const DecodedInsn& insn) {
+  switch (insn.opcode) {
+    case Opcode::bc:
+    case Opcode::bca:
+    case Opcode::bcl:
+    case Opcode::bcla:
+      return (insn.B.BO & 0x10) ? 0 : (1u << (insn.B.BI >> 2));
+    case Opcode::bclr:
+    case Opcode::bclrl:
+    case Opcode::bcctr:
+    case Opcode::bcctrl:
+      return (insn.XL.BO & 0x10) ? 0 : (1u << (insn.XL.BI >> 2));
+    case Opcode::mfcr:
+    case Opcode::sc:  // HLE kernel handlers receive the whole guest context
+      return 0xFF;
+    case Opcode::kUnknown: {
+      const uint32_t primary = insn.raw >> 26;
+      return (primary == 19 || primary == 31) ? 0xFF : 0;
+    }
+    default:
+      return 0;
+  }
+}
+
+/// Decide, per function, which CR fields never escape their producing
+/// compare: every reader of the field sits directly after a full-field
+/// producer with nothing able to jump in between. Such fields need not be
+/// materialized when a compare+branch pair fuses (see tryFoldCompareBranch).
+/// Only ABI-volatile fields qualify - callers may not rely on cr0/cr1/cr5-cr7
+/// surviving a call, so a fused field is never observed across functions.
+void analyzeCrFieldConsumption(CodegenContext& ctx) {
+  if (!ctx.hasDecoded()) {
+    REXCODEGEN_WARN("analyzeCrFieldConsumption: DecodedBinary not initialized, skipping");
+    return;
+  }
+
+  auto& graph = ctx.graph;
+  auto& decoded = ctx.decoded();
+  const auto& config = ctx.Config();
+
+  constexpr uint32_t kVolatileFields = 0b11100011;  // cr0, cr1, cr5, cr6, cr7
+
+  size_t fusibleCount = 0;
+
+  for (const auto& [entry, node] : graph.functions()) {
+    if (node->isImport() || node->blocks().empty())
+      continue;
+
+    // Mid-asm hooks receive registers by name and exception scopes can enter
+    // mid-function; both could observe a non-materialized field.
+    if (node->hasExceptionInfo())
+      continue;
+    bool hooked = false;
+    for (const auto& [addr, hook] : config.midAsmHooks) {
+      if (addr >= node->base() && addr < node->end()) {
+        hooked = true;
+        break;
+      }
+    }
+    if (hooked)
+      continue;
+
+    // Addresses a branch can land on: a reader there cannot trust the
+    // instruction before it to have executed. Includes the SEH/late-resolved
+    // labels the graph already tracks plus jump-table targets; plain branch
+    // targets are collected in the scan below.
+    std::unordered_set<uint32_t> labels(node->labels().begin(), node->labels().end());
+    for (const auto& jt : node->jumpTables()) {
+      for (auto target : jt.targets)
+        labels.insert(target);
+    }
+    for (const auto& [site, table] : config.switchTables) {
+      if (site >= node->base() && site < node->end()) {
+        for (auto target : table.targets)
+          labels.insert(target);
+      }
+    }
+
+    uint32_t mask = kVolatileFields;
+
+    for (const auto& block : node->blocks()) {
+      for (uint32_t addr = block.base; mask && addr < block.end(); addr += 4) {
+        auto* insn = decoded.get(addr);
+        if (!insn) {
+          mask = 0;
+          break;
+        }
+
+        if (insn->branch_target.has_value() && *insn->branch_target >= node->base() &&
+            *insn->branch_target < node->end()) {
+          labels.insert(*insn->branch_target);
+        }
+
+        // An unconditional bcctr without a known jump table may turn out to
+        // be one during emission (late detection), adding labels this pass
+        // never saw - give up on the whole function.
+        if (insn->opcode == Opcode::bcctr && !insn->is_conditional() &&
+            config.switchTables.find(addr) == config.switchTables.end()) {
+          bool knownTable = false;
+          for (const auto& jt : node->jumpTables())
+            knownTable |= jt.bctrAddress == addr;
+          if (!knownTable) {
+            mask = 0;
+            break;
+          }
+        }
+      }
+      if (!mask)
+        break;
+    }
+
+    if (!mask)
+      continue;
+
+    for (const auto& block : node->blocks()) {
+      for (uint32_t addr = block.base; mask && addr < block.end(); addr += 4) {
+        auto* insn = decoded.get(addr);
+        const uint32_t reads = crFieldsRead(*insn) & mask;
+        if (!reads)
+          continue;
+
+        // A read is satisfied only by a full-field producer immediately
+        // before it, in the same block, with nothing able to jump in between.
+        int produced = -1;
+        if (addr >= block.base + 4 && !labels.contains(addr)) {
+          if (auto* prev = decoded.get(addr - 4))
+            produced = crFieldWritten(*prev);
+        }
+        for (unsigned field = 0; field < 8; ++field) {
+          if (((reads >> field) & 1) && static_cast<int>(field) != produced)
+            mask &= ~(1u << field);
+        }
+      }
+      if (!mask)
+        break;
+    }
+
+    if (mask) {
+      graph.setFunctionFusibleCrFields(entry, static_cast<uint8_t>(mask));
+      fusibleCount++;
+    }
+  }
+
+  REXCODEGEN_INFO("Analyze: compare+branch fusion possible in {} functions", fusibleCount);
+}
+
+//=============================================================================
+// Inlinable leaf detection for call-site expansion
+//=============================================================================
+
+/// Mark single-block leaf functions whose bodies can be expanded at call
+/// sites: within the configured instruction budget, ending in an
+/// unconditional blr and free of branches, traps, system calls, lr writes
+/// and mid-asm hooks. Such a body emits as straight-line code through the
+/// normal builders, so a caller can absorb it with no context handoff
+/// (see BuilderContext::emit_inlined_call).
+void markInlinableFunctions(CodegenContext& ctx) {
+  if (!ctx.hasDecoded()) {
+    REXCODEGEN_WARN("markInlinableFunctions: DecodedBinary not initialized, skipping");
+    return;
+  }
+
+  auto& graph = ctx.graph;
+  auto& decoded = ctx.decoded();
+  const auto& config = ctx.Config();
+  const uint32_t budget = config.inlineInstructionBudget;
+
+  size_t inlinableCount = 0;
+
+  for (const auto& [entry, node] : graph.functions()) {
+    if (node->isImport() || !node->isLeaf() || node->blocks().size() != 1)
+      continue;
+    if (node->hasExceptionInfo() || node->hasExceptionHandler())
+      continue;
+
+    const auto& block = node->blocks().front();
+    if (block.base != node->base() || block.size < 4)
+      continue;
+    if ((block.size / 4) - 1 > budget)  // body size, not counting the blr
+      continue;
+
+    // Mid-asm hooks fire by address and may jump to labels that only exist
+    // in the out-of-line body.
+    bool hooked = false;
+    for (const auto& [addr, hook] : config.midAsmHooks) {
+      if (addr >= node->base() && addr < node->end()) {
+        hooked = true;
+        break;
+      }
+    }
+    if (hooked)
+      continue;
+
+    auto* last = decoded.get(block.end() - 4);
+    if (!last || last->opcode != Opcode::bclr || last->is_conditional())
+      continue;
+
+    bool inlinable = true;
+    for (uint32_t addr = block.base; inlinable && addr + 4 < block.end(); addr += 4) {
+      auto* insn = decoded.get(addr);
+      // Unknown decodes are rejected wholesale: the emitter may well handle
+      // them, but this pass cannot prove they stay straight-line.
+      if (!insn || insn->opcode == Opcode::kUnknown || insn->is_branch() ||
+          ppc::get_opcode_info(insn->opcode).group == ppc::OpcodeGroup::kSystem) {
+        inlinable = false;
+      } else if (insn->opcode == Opcode::mtlr ||
+                 (insn->opcode == Opcode::mtspr && insn->XFX.spr_num() == 8)) {
+        // Leaf marking only proves lr is never read; a write followed by blr
+        // is really an indirect jump and must stay out of line.
+        inlinable = false;
+      }
+    }
+    if (!inlinable)
+      continue;
+
+    graph.setFunctionInlinable(entry, true);
+    inlinableCount++;
+  }
+
+  REXCODEGEN_INFO("Analyze: {} inlinable leaf functions", inlinableCount);
+}
+
 //=============================================================================
 // GapFill to register uncovered code regions
 //=============================================================================
 
 // Split a code region into function segments based on terminators (blr, tail calls).
 std::vector<CodeRegion> splitRegionOnTerminators(
-    const CodeRegion& region, const BinaryView& binary,
+    const CodeRegion& region, const DecodedBinary& binary,
     const std::unordered_set<uint32_t>& knownCallables) {
   std::vector<CodeRegion> segments;
   uint32_t segmentStart = region.start;
 
   for (uint32_t addr = region.start; addr < region.end; addr += 4) {
-    const uint8_t* data = binary.translate(addr);
-    if (!data)
+    const auto* insn = binary.get(addr);
+    if (insn == nullptr)
       break;
 
-    uint32_t raw = load_and_swap<uint32_t>(data);
-    auto decoded = decode_instruction(addr, raw);
+    const auto& decoded = *insn;
     bool shouldSplit = false;
     const char* reason = nullptr;
 
@@ -1349,7 +1937,7 @@ void gapFillCodeRegions(CodegenContext& ctx) {
 
   for (const auto& region : scan.codeRegions) {
     // Split region on terminators (blr, tail calls), then check each segment
-    auto segments = splitRegionOnTerminators(region, binary, knownCallables);
+    auto segments = splitRegionOnTerminators(region, ctx.decoded(), knownCallables);
 
     for (const auto& segment : segments) {
       // Skip if this segment's start is already a registered function entry
@@ -1500,10 +2088,13 @@ VoidResult validateGraph(CodegenContext& ctx) {
   auto& graph = ctx.graph;
   auto& binary = ctx.binary();
   auto& errors = ctx.errors;
+  auto& state = ctx.analysisState();
+  const bool quarantine = ctx.Config().quarantineAnalysisErrors;
 
   size_t functionsChecked = 0;
   size_t callsChecked = 0;
   size_t edgesVerified = 0;
+  size_t quarantinedCalls = 0;
 
   for (const auto& [addr, node] : graph.functions()) {
     functionsChecked++;
@@ -1562,6 +2153,12 @@ VoidResult validateGraph(CodegenContext& ctx) {
           }
 
           if (!targetExists) {
+            // Already-quarantined targets were reported on a previous run;
+            // the call site emits a fatal thunk instead of a resolved call
+            if (quarantine && isQuarantined(state, target)) {
+              quarantinedCalls++;
+              continue;
+            }
             // Target is not in any function - this is an error that must stop the build
             errors.Add(AnalysisErrors::Category::UnresolvedCall, target, site,
                        fmt::format("{} 0x{:08X} from 0x{:08X} - target not in any function",
@@ -1570,12 +2167,16 @@ VoidResult validateGraph(CodegenContext& ctx) {
           }
 
           if (!isInternalJump) {
-            const CallEdge* edge = findCallEdgeAt(node.get(), site);
+            const CallEdge* edge = findCallEdgeAt(node, site);
             if (!edge) {
               // Check if target is inside another function - this is a special case
               // where code branches to another function's internal address
               const FunctionNode* containingFunc = graph.getFunctionContaining(target);
               if (!containingFunc) {
+                if (quarantine && isQuarantined(state, target)) {
+                  quarantinedCalls++;
+                  continue;
+                }
                 // Target is not in any function - this is an error (call the cops)
                 errors.Add(AnalysisErrors::Category::UnresolvedCall, target, site,
                            fmt::format("{} 0x{:08X} from 0x{:08X} in {} - no CallEdge recorded",
@@ -1594,13 +2195,48 @@ VoidResult validateGraph(CodegenContext& ctx) {
 
   REXCODEGEN_INFO("Analyze: checked {} branches in {} functions, verified {} edges", callsChecked,
                   functionsChecked, edgesVerified);
+  if (quarantinedCalls)
+    REXCODEGEN_WARN("Analyze: {} calls into quarantined regions emit fatal thunks",
+                    quarantinedCalls);
 
   if (errors.HasErrors()) {
     REXCODEGEN_ERROR("Analyze: found {} errors", errors.Count());
     errors.PrintReport();
-    return Err(ErrorCategory::Validation,
-               fmt::format("Validation failed: {} unresolved calls",
-                           errors.Count(AnalysisErrors::Category::UnresolvedCall)));
+
+    if (!quarantine)
+      return Err(ErrorCategory::Validation,
+                 fmt::format("Validation failed: {} unresolved calls",
+                             errors.Count(AnalysisErrors::Category::UnresolvedCall)));
+
+    // Quarantine-and-continue: record each offending region as data, persist
+    // the ranges next to the incremental cache so later runs skip straight
+    // past them, and finish the run. Call sites into the regions emit fatal
+    // thunks, so a title only crashes if it actually takes the broken path.
+    const size_t before = state.quarantinedRegions.size();
+    for (const auto& entry : errors.Entries()) {
+      if (entry.category != AnalysisErrors::Category::UnresolvedCall)
+        continue;
+
+      const CodeRegion* region =
+          ctx.hasDecoded() ? ctx.decoded().regionContaining(entry.address) : nullptr;
+      const uint32_t aligned = entry.address & ~3u;
+      CodeRegion quarantined = region ? *region : CodeRegion{aligned, aligned + 4};
+
+      if (isQuarantined(state, quarantined.start))
+        continue;
+
+      state.quarantinedRegions.push_back(quarantined);
+      state.invalidInstructions[quarantined.start] = quarantined.size();
+      REXCODEGEN_WARN(
+          "Analyze: quarantined 0x{:08X}-0x{:08X} as data (unresolved target 0x{:08X} from "
+          "0x{:08X})",
+          quarantined.start, quarantined.end, entry.address, entry.secondaryAddress);
+    }
+    saveQuarantinedRegions(ctx);
+    REXCODEGEN_WARN("Analyze: continuing with {} quarantined regions ({} new)",
+                    state.quarantinedRegions.size(), state.quarantinedRegions.size() - before);
+    errors.Clear();
+    return Ok();
   }
 
   REXCODEGEN_INFO("Analyze: all calls resolve");
@@ -1609,53 +2245,129 @@ VoidResult validateGraph(CodegenContext& ctx) {
 
 }  // anonymous namespace
 
+uint64_t executableSectionHash(const BinaryView& binary) {
+  XXH3_state_t* state = XXH3_createState();
+  XXH3_64bits_reset(state);
+  for (const auto& section : binary.sections()) {
+    if (section.executable)
+      XXH3_64bits_update(state, section.data, section.size);
+  }
+  uint64_t hash = XXH3_64bits_digest(state);
+  XXH3_freeState(state);
+  return hash;
+}
+
 Result<void> Analyze(CodegenContext& ctx) {
   REXCODEGEN_INFO("Analyze: starting analysis...");
 
-  ctx.initDecoded();
+  {
+    PhaseTimer timer(ctx.timings, "decode");
+    ctx.initDecoded();
+  }
   REXCODEGEN_INFO("Analyze: decoded {} instructions across {} code regions",
                   ctx.decoded().instructionCount(), ctx.decoded().codeRegions().size());
 
+  // Jump-table memoization: reruns load recognized descriptors (and proven
+  // non-switch bctr sites) from a sidecar validated by executable-section hash.
+  // Batch mode may pre-seed a cache from a previous in-process run; keep it
+  // when it was built from the same image.
+  std::filesystem::path jtCachePath =
+      ctx.configDir() / fmt::format("{}_jumptables.cache", ctx.Config().projectName);
+  {
+    uint64_t sectionHash = executableSectionHash(ctx.binary());
+    if (ctx.jumpTableCache() != nullptr && ctx.jumpTableCache()->sectionHash() == sectionHash) {
+      REXCODEGEN_INFO("Analyze: reusing in-memory jump-table cache ({} entries)",
+                      ctx.jumpTableCache()->size());
+    } else {
+      auto cache = std::make_unique<JumpTableCache>();
+      cache->load(jtCachePath, sectionHash);
+      ctx.setJumpTableCache(std::move(cache));
+    }
+  }
+
   std::vector<uint32_t> ehDiscoveredFuncs;
 
   // 1. Register entry points (imports, helpers, config, pdata)
-  auto regResult = registerEntryPoints(ctx, ehDiscoveredFuncs);
-  if (!regResult) {
-    return regResult;
+  {
+    PhaseTimer timer(ctx.timings, "register");
+    auto regResult = registerEntryPoints(ctx, ehDiscoveredFuncs);
+    if (!regResult) {
+      return regResult;
+    }
   }
 
   // 2. Scan binary into code/data regions
-  scanBinary(ctx);
+  {
+    PhaseTimer timer(ctx.timings, "scan");
+    scanBinary(ctx);
+  }
 
   // 3. Discover function blocks iteratively (includes vtable scan)
-  discoverAllFunctions(ctx);
+  {
+    PhaseTimer timer(ctx.timings, "discover");
+    discoverAllFunctions(ctx);
+  }
 
   // 3.5. Function pointer scan: find lis/addi pairs loading code addresses
   // TODO(tomc): disabled for now, causes too many false positives
   // functionPointerScan(ctx);
 
   // 4. Gap fill uncovered regions
-  gapFillCodeRegions(ctx);
-
-  // 5. Discover blocks for gap-filled functions
   {
+    PhaseTimer timer(ctx.timings, "gap_fill");
+    gapFillCodeRegions(ctx);
+
+    // 5. Discover blocks for gap-filled functions
     auto knownFunctions = buildKnownFunctions(ctx.graph, /*excludeGapFill=*/true);
     size_t discovered = discoverPendingFunctions(ctx, knownFunctions);
     REXCODEGEN_INFO("Analyze: discovered blocks for {} gap-filled functions", discovered);
-  }
 
-  // 5.5. Remove absorbed GAP_FILL functions
-  cleanupAbsorbedGapFills(ctx);
+    // 5.5. Remove absorbed GAP_FILL functions
+    cleanupAbsorbedGapFills(ctx);
+  }
 
   // 6. Merge: resolve jumps and seal functions
-  mergeAndSeal(ctx);
+  {
+    PhaseTimer timer(ctx.timings, "merge");
+    mergeAndSeal(ctx);
+  }
+
+  // 6.5. Devirtualize indirect calls with provably constant ctr values
+  // (runs after sealing so block layout is final)
+  if (ctx.Config().devirtualizeVTableCalls) {
+    PhaseTimer timer(ctx.timings, "devirtualize");
+    devirtualizeConstantCtrCalls(ctx);
+  }
+
+  // 6.6. Mark leaf functions so call sites can skip the lr store
+  markLeafFunctions(ctx);
+
+  // 6.7. Track CR field consumption so compare+branch pairs can fuse
+  if (ctx.Config().fuseCompareBranches) {
+    PhaseTimer timer(ctx.timings, "cr_fields");
+    analyzeCrFieldConsumption(ctx);
+  }
+
+  // 6.8. Mark small leaf callees whose bodies can expand at call sites
+  if (ctx.Config().inlineInstructionBudget > 0) {
+    PhaseTimer timer(ctx.timings, "inline");
+    markInlinableFunctions(ctx);
+  }
 
   // 7. Validate
-  auto validateResult = validateGraph(ctx);
-  if (!validateResult) {
-    return validateResult;
+  {
+    PhaseTimer timer(ctx.timings, "validate");
+    auto validateResult = validateGraph(ctx);
+    if (!validateResult) {
+      return validateResult;
+    }
   }
 
+  // Persist jump-table analysis results for the next run
+  ctx.jumpTableCache()->save(jtCachePath);
+
+  ctx.timings.setCounters(ctx.graph.functionCount(), ctx.decoded().instructionCount());
+
   REXCODEGEN_INFO("Analyze: complete - {} functions ready for code generation",
                   ctx.graph.functionCount());
 
@@ -8,7 +8,9 @@
  *              See LICENSE file in the project root for full license text.
  */
 
+#include <algorithm>
 #include <limits>
+#include <numeric>
 
 #include <rex/codegen/binary_view.h>
 #include <rex/logging.h>
@@ -19,7 +21,63 @@
 
 namespace rex::codegen {
 
-BinaryView BinaryView::fromModule(const runtime::Module& module) {
+BinaryView::BinaryView(BinaryView&& other) noexcept
+    : sections_(std::move(other.sections_)),
+      sectionNames_(std::move(other.sectionNames_)),
+      sectionData_(std::move(other.sectionData_)),
+      sectionStarts_(std::move(other.sectionStarts_)),
+      sectionOrder_(std::move(other.sectionOrder_)),
+      mruSection_(other.mruSection_.load(std::memory_order_relaxed)),
+      mapping_(std::move(other.mapping_)),
+      baseAddress_(other.baseAddress_),
+      imageSize_(other.imageSize_),
+      entryPoint_(other.entryPoint_),
+      exceptionDirectoryAddr_(other.exceptionDirectoryAddr_),
+      exceptionDirectorySize_(other.exceptionDirectorySize_),
+      exportTableAddr_(other.exportTableAddr_),
+      importThunkTableStart_(other.importThunkTableStart_),
+      importExportRangeEnd_(other.importExportRangeEnd_),
+      importSymbols_(std::move(other.importSymbols_)) {}
+
+BinaryView& BinaryView::operator=(BinaryView&& other) noexcept {
+  if (this != &other) {
+    sections_ = std::move(other.sections_);
+    sectionNames_ = std::move(other.sectionNames_);
+    sectionData_ = std::move(other.sectionData_);
+    sectionStarts_ = std::move(other.sectionStarts_);
+    sectionOrder_ = std::move(other.sectionOrder_);
+    mruSection_.store(other.mruSection_.load(std::memory_order_relaxed),
+                      std::memory_order_relaxed);
+    mapping_ = std::move(other.mapping_);
+    baseAddress_ = other.baseAddress_;
+    imageSize_ = other.imageSize_;
+    entryPoint_ = other.entryPoint_;
+    exceptionDirectoryAddr_ = other.exceptionDirectoryAddr_;
+    exceptionDirectorySize_ = other.exceptionDirectorySize_;
+    exportTableAddr_ = other.exportTableAddr_;
+    importThunkTableStart_ = other.importThunkTableStart_;
+    importExportRangeEnd_ = other.importExportRangeEnd_;
+    importSymbols_ = std::move(other.importSymbols_);
+  }
+  return *this;
+}
+
+void BinaryView::buildSectionIndex() {
+  sectionOrder_.resize(sections_.size());
+  std::iota(sectionOrder_.begin(), sectionOrder_.end(), 0u);
+  std::sort(sectionOrder_.begin(), sectionOrder_.end(), [this](uint32_t a, uint32_t b) {
+    return sections_[a].baseAddress < sections_[b].baseAddress;
+  });
+
+  sectionStarts_.resize(sections_.size());
+  for (size_t i = 0; i < sectionOrder_.size(); i++) {
+    sectionStarts_[i] = sections_[sectionOrder_[i]].baseAddress;
+  }
+
+  mruSection_.store(0, std::memory_order_relaxed);
+}
+
+BinaryView BinaryView::fromModule(const runtime::Module& module, DataPolicy policy) {
   BinaryView view;
 
   // Copy metadata
@@ -84,20 +142,28 @@ BinaryView BinaryView::fromModule(const runtime::Module& module) {
     // Copy name
     view.sectionNames_.push_back(std::string(section.name));
 
-    // Copy bytes
-    view.sectionData_.emplace_back(section.host_data, section.host_data + section.virtual_size);
+    const uint8_t* data;
+    if (policy == DataPolicy::kBorrow) {
+      // Zero-copy: reference the module's host memory directly. Pages are
+      // faulted in on demand instead of doubling peak RSS with a heap copy.
+      data = section.host_data;
+    } else {
+      view.sectionData_.emplace_back(section.host_data, section.host_data + section.virtual_size);
+      data = view.sectionData_.back().data();
+    }
 
-    // Create view pointing into our owned data
     view.sections_.push_back(SectionView{.name = view.sectionNames_.back(),
                                          .baseAddress = section.virtual_address,
                                          .size = section.virtual_size,
-                                         .data = view.sectionData_.back().data(),
+                                         .data = data,
                                          .executable = section.executable});
 
     REXCODEGEN_DEBUG("BinaryView: section '{}' at 0x{:08X} size 0x{:X} exec={}", section.name,
                      section.virtual_address, section.virtual_size, section.executable);
   }
 
+  view.buildSectionIndex();
+
   REXCODEGEN_DEBUG("BinaryView: loaded {} sections, base=0x{:08X}, size=0x{:X}",
                    view.sections_.size(), view.baseAddress_, view.imageSize_);
 
@@ -105,10 +171,8 @@ BinaryView BinaryView::fromModule(const runtime::Module& module) {
 }
 
 const uint8_t* BinaryView::translate(uint32_t addr) const {
-  for (const auto& section : sections_) {
-    if (auto* ptr = section.translate(addr)) {
-      return ptr;
-    }
+  if (const auto* section = findSection(addr)) {
+    return section->data + (addr - section->baseAddress);
   }
   return nullptr;
 }
@@ -121,12 +185,32 @@ bool BinaryView::isExecutable(uint32_t addr) const {
 }
 
 const SectionView* BinaryView::findSection(uint32_t addr) const {
-  for (const auto& section : sections_) {
-    if (section.contains(addr)) {
-      return &section;
-    }
+  // Fast path: repeat hit on the last matched section (analysis streams
+  // through .text, so this covers almost every query)
+  const uint32_t cached = mruSection_.load(std::memory_order_relaxed);
+  if (cached < sections_.size() && sections_[cached].contains(addr)) {
+    return &sections_[cached];
   }
-  return nullptr;
+
+  if (sectionStarts_.empty() || addr < sectionStarts_.front()) {
+    return nullptr;
+  }
+
+  // Branchless binary search for the last section starting at or below addr
+  size_t lo = 0;
+  size_t len = sectionStarts_.size();
+  while (len > 1) {
+    const size_t half = len / 2;
+    lo += (sectionStarts_[lo + half] <= addr) ? half : 0;
+    len -= half;
+  }
+
+  const uint32_t index = sectionOrder_[lo];
+  if (!sections_[index].contains(addr)) {
+    return nullptr;
+  }
+  mruSection_.store(index, std::memory_order_relaxed);
+  return &sections_[index];
 }
 
 const SectionView* BinaryView::findSectionByName(std::string_view name) const {
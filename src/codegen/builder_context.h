@@ -40,6 +40,10 @@ struct RecompilerLocalVariables;
  */
 enum class CSRState;
 
+/// Per-function record of the CSR states flowing into labels - lets a label
+/// keep a known flush mode when every incoming edge agrees (see recompiler.h).
+struct CSRLabelStates;
+
 /**
  * @brief Context passed to instruction builders during code generation.
  */
@@ -65,6 +69,9 @@ struct BuilderContext {
   /// Current CSR state for flush mode (FPU vs VMX)
   CSRState& csrState;
 
+  /// Records the CSR state each emitted branch carries to its target label
+  CSRLabelStates& csrLabels;
+
   /// Iterator to current switch table, or end() if none
   std::unordered_map<uint32_t, JumpTable>::iterator& switchTable;
 
@@ -193,7 +200,19 @@ struct BuilderContext {
    * Falls back to symbol lookup for backward compatibility.
    * Handles special cases like setjmp/longjmp and __restgprlr_N functions.
    */
-  void emit_function_call(uint32_t address);
+  void emit_function_call(uint32_t address, bool tail = false);
+
+  /**
+   * @brief Expand a small leaf callee's body at the call site.
+   * @param callee Function marked inlinable by markInlinableFunctions
+   * @return true if the body was emitted; false rolls the output back so the
+   *         site falls back to a regular call
+   *
+   * Emits every callee instruction up to the final blr through the normal
+   * builders, sharing this site's local variable and CSR state; the return
+   * dissolves into fall-through.
+   */
+  bool emit_inlined_call(const FunctionNode& callee);
 
   /**
    * @brief Emit C++ code for a conditional branch.
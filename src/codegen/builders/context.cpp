@@ -10,6 +10,7 @@
  */
 
 #include "../builder_context.h"
+#include "../ppc/disasm.h"
 #include "helpers.h"
 
 #include <algorithm>
@@ -168,12 +169,74 @@ const CallTarget* BuilderContext::findCallTarget(uint32_t site) const {
   return nullptr;
 }
 
-void BuilderContext::emit_function_call(uint32_t address) {
+bool BuilderContext::emit_inlined_call(const FunctionNode& callee) {
+  const auto& block = callee.blocks().front();
+  const auto* calleeData =
+      reinterpret_cast<const uint32_t*>(recompiler.ctx_->binary().translate(block.base));
+  if (!calleeData)
+    return false;
+
+  // Snapshot so a body the emitter cannot handle rolls back cleanly and the
+  // site falls back to a regular call.
+  const size_t emitted = out().size();
+  const CSRState savedCsrState = csrState;
+
+  println("\t// inline {} (0x{:X})", callee.name(), callee.base());
+
+  // Everything up to the final blr; the return dissolves into fall-through.
+  for (uint32_t addr = block.base; addr + 4 < block.end(); addr += 4) {
+    const uint32_t* word = calleeData + (addr - block.base) / 4;
+    ppc_insn calleeInsn;
+    ppc::Disassemble(word, 4, addr, calleeInsn);
+
+    if (calleeInsn.opcode == nullptr ||
+        !recompiler.recompile(callee, addr, calleeInsn, word, switchTable, locals, csrState,
+                              csrLabels)) {
+      out().resize(emitted);
+      csrState = savedCsrState;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void BuilderContext::emit_function_call(uint32_t address, bool tail) {
   const auto& cfg = config();
 
+  // Calls into quarantined regions get the fatal thunk without the error
+  // noise - analysis already reported the quarantine (see validateGraph)
+  auto callQuarantined = [&]() {
+    for (const auto& region : recompiler.ctx_->analysisState().quarantinedRegions) {
+      if (region.contains(address)) {
+        println("\t// call into quarantined region 0x{:08X}", address);
+        println("\tREX_FATAL(\"Call into quarantined region 0x{:08X} from 0x{:08X}\");", address,
+                base);
+        if (tail)
+          println("\treturn;");
+        return true;
+      }
+    }
+    return false;
+  };
+
+  // Direct call in tail or regular position. musttail is only legal when the
+  // call is the final statement, which SEH-wrapped bodies cannot guarantee.
+  auto callDirect = [&](const std::string& calleeName) {
+    if (tail && cfg.emitTailCalls && !fn.hasExceptionInfo()) {
+      println("\tPPC_MUSTTAIL return {}(ctx, base);", calleeName);
+    } else {
+      println("\t{}(ctx, base);", calleeName);
+      if (tail)
+        println("\treturn;");
+    }
+  };
+
   if (address == cfg.longJmpAddress) {
     // Use custom ppc_longjmp that uses guest address as key (not for storage)
     println("\t::rex::ppc_longjmp({}.u32, {}.s32);", r(3), r(4));
+    if (tail)
+      println("\treturn;");
     return;
   }
 
@@ -185,6 +248,8 @@ void BuilderContext::emit_function_call(uint32_t address) {
     // Restore PPCContext if returning from longjmp
     println("\tif ({}.s64 != 0) ctx = {};", temp(), env());
     println("\t{} = {};", r(3), temp());
+    if (tail)
+      println("\treturn;");
     return;
   }
 
@@ -198,10 +263,21 @@ void BuilderContext::emit_function_call(uint32_t address) {
       if (cfg.nonVolatileRegistersAsLocalVariables &&
           (name.find("__rest") == 0 || name.find("__save") == 0)) {
         // print nothing - these are handled by local variable tracking
+        if (tail)
+          println("\treturn;");
         return;
       }
 
-      println("\t{}(ctx, base);", name);
+      // Speculative inlining: expand small leaf callees in place instead of
+      // a full context handoff. Note the weak-alias override never sees an
+      // inlined site, which is why the budget defaults to off.
+      if (targetFn->isInlinable() && emit_inlined_call(*targetFn)) {
+        if (tail)
+          println("\treturn;");
+        return;
+      }
+
+      callDirect(name);
       return;
     }
 
@@ -233,22 +309,30 @@ void BuilderContext::emit_function_call(uint32_t address) {
         std::replace(func_name.begin(), func_name.end(), '.', '_');
       }
 
-      println("\t{}(ctx, base);", func_name);
+      callDirect(func_name);
       return;
     }
 
     // Unresolved target from graph
+    if (callQuarantined())
+      return;
     REXCODEGEN_ERROR("Unresolved function 0x{:08X} from 0x{:08X}", address, base);
     println("\t// FATAL: unresolved function 0x{:08X}", address);
     println("\tREX_FATAL(\"Unresolved call from 0x{:08X} to 0x{:08X}\");", base, address);
+    if (tail)
+      println("\treturn;");
     return;
   }
 
   // No pre-resolved target found - this is an error
+  if (callQuarantined())
+    return;
   REXCODEGEN_ERROR("Unresolved function 0x{:08X} from 0x{:08X} (no CallTarget in FunctionNode)",
                    address, base);
   println("\t// FATAL: unresolved function 0x{:08X} (no CallTarget in FunctionNode)", address);
   println("\tREX_FATAL(\"Unresolved call from 0x{:08X} to 0x{:08X}\");", base, address);
+  if (tail)
+    println("\treturn;");
 }
 
 void BuilderContext::emit_conditional_branch(bool not_, std::string_view cond) {
@@ -261,17 +345,27 @@ void BuilderContext::emit_conditional_branch(bool not_, std::string_view cond) {
   switch (kind) {
     case TargetKind::InternalLabel:
       // Target is within this function - local goto
-      println("\tif ({}{}.{}) goto loc_{:08X};", not_ ? "!" : "", cr(insn.operands[0]), cond,
-              target);
+      csrLabels.recordEdge(target, csrState);
+      println("\tif ({}{}.{}){} goto loc_{:08X};", not_ ? "!" : "", cr(insn.operands[0]), cond,
+              branchTakenHint(config(), base, target), target);
       break;
 
     case TargetKind::Function:
-    case TargetKind::Import:
+    case TargetKind::Import: {
+      // A conditional tail call whose target never ran in the profiled session
+      // is a cold path (error exits, rare fallbacks) - tell the host compiler.
+      std::string_view hint;
+      if (config().branchHints && !config().profile.empty()) {
+        auto it = config().profile.find(target);
+        if (it == config().profile.end() || it->second == 0)
+          hint = " [[unlikely]]";
+      }
+
       // Conditional tail call to another function - check pre-resolved call target
       if (const auto* callTarget = findCallTarget(base)) {
         if (callTarget->isFunction()) {
           auto* targetFn = callTarget->asFunction();
-          println("\tif ({}{}.{}) {{", not_ ? "!" : "", cr(insn.operands[0]), cond);
+          println("\tif ({}{}.{}){} {{", not_ ? "!" : "", cr(insn.operands[0]), cond, hint);
           println("\t\t{}(ctx, base);", targetFn->name());
           println("\t\treturn;");
           println("\t}}");
@@ -280,7 +374,7 @@ void BuilderContext::emit_conditional_branch(bool not_, std::string_view cond) {
           std::string func_name = "__imp__" + importTarget.name;
           std::replace(func_name.begin(), func_name.end(), '@', '_');
           std::replace(func_name.begin(), func_name.end(), '.', '_');
-          println("\tif ({}{}.{}) {{", not_ ? "!" : "", cr(insn.operands[0]), cond);
+          println("\tif ({}{}.{}){} {{", not_ ? "!" : "", cr(insn.operands[0]), cond, hint);
           println("\t\t{}(ctx, base);", func_name);
           println("\t\treturn;");
           println("\t}}");
@@ -288,16 +382,19 @@ void BuilderContext::emit_conditional_branch(bool not_, std::string_view cond) {
       } else {
         REXCODEGEN_ERROR("Unresolved conditional branch to 0x{:08X} from 0x{:08X} (no CallTarget)",
                          target, base);
-        println("\tif ({}{}.{}) REX_FATAL(\"Unresolved branch from 0x{:08X} to 0x{:08X}\");",
-                not_ ? "!" : "", cr(insn.operands[0]), cond, base, target);
+        println("\tif ({}{}.{}){} REX_FATAL(\"Unresolved branch from 0x{:08X} to 0x{:08X}\");",
+                not_ ? "!" : "", cr(insn.operands[0]), cond,
+                config().branchHints ? " [[unlikely]]" : "", base, target);
       }
       break;
+    }
 
     case TargetKind::Unknown:
       REXCODEGEN_ERROR("Unresolved conditional branch to 0x{:08X} from 0x{:08X}", target, base);
       println("\t// ERROR: conditional branch to unknown address 0x{:08X}", target);
-      println("\tif ({}{}.{}) REX_FATAL(\"Unresolved branch from 0x{:08X} to 0x{:08X}\");",
-              not_ ? "!" : "", cr(insn.operands[0]), cond, base, target);
+      println("\tif ({}{}.{}){} REX_FATAL(\"Unresolved branch from 0x{:08X} to 0x{:08X}\");",
+              not_ ? "!" : "", cr(insn.operands[0]), cond,
+              config().branchHints ? " [[unlikely]]" : "", base, target);
       break;
   }
 }
@@ -34,24 +34,24 @@ bool build_b(BuilderContext& ctx) {
   switch (kind) {
     case TargetKind::InternalLabel:
       // Target is within this function and not another function's entry point
+      ctx.csrLabels.recordEdge(target, ctx.csrState);
       ctx.println("\tgoto loc_{:X};", target);
       break;
 
     case TargetKind::Function:
     case TargetKind::Import:
       // Tail call to another function or import
-      ctx.emit_function_call(target);
-      ctx.println("\treturn;");
+      ctx.emit_function_call(target, /*tail=*/true);
       break;
 
     case TargetKind::Unknown:
       // Unknown target - fall back to range check
       if (target >= ctx.fn.base() && target < ctx.fn.end()) {
+        ctx.csrLabels.recordEdge(target, ctx.csrState);
         ctx.println("\tgoto loc_{:X};", target);
       } else {
         REXCODEGEN_WARN("Unresolved b target 0x{:08X} from 0x{:08X}", target, ctx.base);
-        ctx.emit_function_call(target);
-        ctx.println("\treturn;");
+        ctx.emit_function_call(target, /*tail=*/true);
       }
       break;
   }
@@ -61,8 +61,18 @@ bool build_b(BuilderContext& ctx) {
 bool build_bl(BuilderContext& ctx) {
   uint32_t target = ctx.insn.operands[0];
 
-  // Always set LR (unless skipLr)
-  if (!ctx.config().skipLr)
+  // Leaf callees never read lr and return natively, so the store is dead.
+  // A PIC bl-to-next-instruction never resolves to a leaf (the landing code
+  // executes mflr), so InternalLabel targets keep the store.
+  bool leafCall = false;
+  if (ctx.config().skipLrForLeafCalls) {
+    if (const auto* ct = ctx.findCallTarget(ctx.base); ct != nullptr && ct->isFunction()) {
+      leafCall = ct->asFunction()->isLeaf();
+    }
+  }
+
+  // Always set LR (unless skipLr or the callee provably ignores it)
+  if (!ctx.config().skipLr && !leafCall)
     ctx.println("\tctx.lr = 0x{:X};", ctx.base + 4);
 
   // Use graph to classify the target
@@ -122,67 +132,131 @@ bool build_bctr(BuilderContext& ctx) {
   }
 
   if (jt) {
-    ctx.println("\tswitch ({}.u32) {{", ctx.r(jt->indexRegister));
+    auto emitSwitchDispatch = [&]() {
+      ctx.println("\tswitch ({}.u32) {{", ctx.r(jt->indexRegister));
+
+      for (size_t i = 0; i < jt->targets.size(); i++) {
+        ctx.println("\tcase {}:", i);
+        auto label = jt->targets[i];
+
+        // TODO(tomc): Figure out if this actually is triggered on real hardware and what would
+        // happen?
+        if (label == 0) {
+          ctx.println("\t\t__builtin_trap(); // ERROR - detected jump to null value");
+          continue;
+        }
+
+        auto kind = ctx.graph().classifyTarget(label, ctx.base, false);
+        switch (kind) {
+          case TargetKind::InternalLabel:
+            ctx.println("\t\tgoto loc_{:X};", label);
+            break;
+          case TargetKind::Function:
+          case TargetKind::Import:
+            if (auto* targetFn = ctx.graph().getFunction(label)) {
+              ctx.println("\t\t{}(ctx, base);", targetFn->name());
+            } else {
+              REXCODEGEN_ERROR(
+                  "Jump target 0x{:08X} classified as function but not in graph at bctr 0x{:08X}",
+                  label, ctx.base);
+              ctx.println(
+                  "\t\tREX_FATAL(\"Jump target 0x{:08X} classified as function but not "
+                  "in graph at bctr 0x{:08X}\");",
+                  label, ctx.base);
+            }
+            ctx.println("\t\treturn;");
+            break;
+          default:
+            REXCODEGEN_ERROR("Jump target 0x{:08X} unresolved at bctr 0x{:08X}", label, ctx.base);
+            ctx.println("\t\tREX_FATAL(\"Jump target 0x{:08X} unresolved at bctr 0x{:08X}\");",
+                        label, ctx.base);
+            break;
+        }
+      }
 
-    for (size_t i = 0; i < jt->targets.size(); i++) {
-      ctx.println("\tcase {}:", i);
+      ctx.println("\tdefault:");
+      ctx.println("\t\t__builtin_trap(); // Switch case out of range");
+      ctx.println("\t}}");
+    };
+
+    // Dense tables whose entries all stay inside this function lower to an
+    // indexed goto through a label-address table on GCC/Clang - one load and
+    // one jump, where the switch above sometimes comes back from the host
+    // compiler as a branch cascade. Tables with function or unresolved
+    // targets keep the switch (those arms need a call and return, not a
+    // label), and MSVC keeps it too since it has no address-of-label.
+    const uint32_t minEntries = ctx.config().computedGotoMinEntries;
+    bool computedGoto = minEntries != 0 && jt->targets.size() >= minEntries;
+    bool hasNullEntry = false;
+    for (size_t i = 0; computedGoto && i < jt->targets.size(); i++) {
       auto label = jt->targets[i];
+      if (label == 0)
+        hasNullEntry = true;
+      else if (ctx.graph().classifyTarget(label, ctx.base, false) != TargetKind::InternalLabel)
+        computedGoto = false;
+    }
 
-      // TODO(tomc): Figure out if this actually is triggered on real hardware and what would
-      // happen?
-      if (label == 0) {
-        ctx.println("\t\t__builtin_trap(); // ERROR - detected jump to null value");
-        continue;
-      }
-
-      auto kind = ctx.graph().classifyTarget(label, ctx.base, false);
-      switch (kind) {
-        case TargetKind::InternalLabel:
-          ctx.println("\t\tgoto loc_{:X};", label);
-          break;
-        case TargetKind::Function:
-        case TargetKind::Import:
-          if (auto* targetFn = ctx.graph().getFunction(label)) {
-            ctx.println("\t\t{}(ctx, base);", targetFn->name());
-          } else {
-            REXCODEGEN_ERROR(
-                "Jump target 0x{:08X} classified as function but not in graph at bctr 0x{:08X}",
-                label, ctx.base);
-            ctx.println(
-                "\t\tREX_FATAL(\"Jump target 0x{:08X} classified as function but not "
-                "in graph at bctr 0x{:08X}\");",
-                label, ctx.base);
-          }
-          ctx.println("\t\treturn;");
-          break;
-        default:
-          REXCODEGEN_ERROR("Jump target 0x{:08X} unresolved at bctr 0x{:08X}", label, ctx.base);
-          ctx.println("\t\tREX_FATAL(\"Jump target 0x{:08X} unresolved at bctr 0x{:08X}\");", label,
-                      ctx.base);
-          break;
+    if (computedGoto) {
+      ctx.println("#if defined(__GNUC__) || defined(__clang__)");
+      ctx.println("\t{{");
+      ctx.println("\t\tstatic const void* const jt_{:X}[{}] = {{", ctx.base, jt->targets.size());
+      for (auto label : jt->targets) {
+        if (label == 0)
+          ctx.println("\t\t\t&&jt_{:X}_oob, // null table entry", ctx.base);
+        else
+          ctx.println("\t\t\t&&loc_{:X},", label);
       }
+      ctx.println("\t\t}};");
+      ctx.println("\t\tif ({}.u32 < {}){}", ctx.r(jt->indexRegister), jt->targets.size(),
+                  ctx.config().branchHints ? " [[likely]]" : "");
+      ctx.println("\t\t\tgoto *jt_{:X}[{}.u32];", ctx.base, ctx.r(jt->indexRegister));
+      if (hasNullEntry)
+        ctx.println("\tjt_{:X}_oob:", ctx.base);
+      ctx.println("\t\t__builtin_trap(); // Switch case out of range");
+      ctx.println("\t}}");
+      ctx.println("#else");
+      emitSwitchDispatch();
+      ctx.println("#endif");
+    } else {
+      emitSwitchDispatch();
     }
 
-    ctx.println("\tdefault:");
-    ctx.println("\t\t__builtin_trap(); // Switch case out of range");
-    ctx.println("\t}}");
-
     ctx.reset_switch_table();
+  } else if (const auto* target = ctx.findCallTarget(ctx.base);
+             target != nullptr && target->isFunction()) {
+    // Devirtualized tail call - analysis proved ctr holds this constant
+    ctx.emit_function_call(target->asFunction()->base(), /*tail=*/true);
   } else {
     // No switch table - assume tail call via CTR
     // NOTE(tomc): If this is actually an unresolved switch table, the code after
     // will be unreachable. This is caught during analysis by discover_blocks.
     // The validation phase will report missing switch tables.
-    ctx.println("\tPPC_CALL_INDIRECT_FUNC({}.u32);", ctx.ctr());
-    ctx.println("\treturn;");
+    if (ctx.config().emitTailCalls && !ctx.fn.hasExceptionInfo()) {
+      ctx.println("\tPPC_TAIL_CALL_INDIRECT_FUNC({}.u32);", ctx.ctr());
+    } else {
+      ctx.println("\tPPC_CALL_INDIRECT_FUNC({}.u32);", ctx.ctr());
+      ctx.println("\treturn;");
+    }
   }
   return true;
 }
 
 bool build_bctrl(BuilderContext& ctx) {
-  if (!ctx.config().skipLr)
+  const auto* target = ctx.findCallTarget(ctx.base);
+  bool direct = target != nullptr && target->isFunction();
+
+  // Leaf callees never read lr and return natively, so the store is dead
+  bool leafCall = direct && ctx.config().skipLrForLeafCalls && target->asFunction()->isLeaf();
+  if (!ctx.config().skipLr && !leafCall)
     ctx.println("\tctx.lr = 0x{:X};", ctx.base + 4);
-  ctx.println("\tPPC_CALL_INDIRECT_FUNC({}.u32);", ctx.ctr());
+
+  if (direct) {
+    // Devirtualized call - analysis proved ctr holds this constant (see
+    // devirtualizeConstantCtrCalls)
+    ctx.println("\t{}(ctx, base);", target->asFunction()->name());
+  } else {
+    ctx.println("\tPPC_CALL_INDIRECT_FUNC({}.u32);", ctx.ctr());
+  }
   ctx.csrState = CSRState::Unknown;  // the call could change it
   return true;
 }
@@ -254,16 +254,36 @@ bool build_fnmsubs(BuilderContext& ctx) {
 
 bool build_fres(BuilderContext& ctx) {
   ctx.emit_set_flush_mode(false);
+  if (ctx.config().fastFloatEstimates) {
+    // Hardware rcp estimate refined with one Newton-Raphson step; temp avoids
+    // reading operands[1] after a possibly aliasing destination write.
+    ctx.println("\t{}.f32 = simde_mm_cvtss_f32(simde_mm_rcp_ss(simde_mm_set_ss(float({}.f64))));",
+                ctx.temp(), ctx.f(ctx.insn.operands[1]));
+    ctx.println("\t{}.f32 = {}.f32 * (2.0f - float({}.f64) * {}.f32);", ctx.temp(), ctx.temp(),
+                ctx.f(ctx.insn.operands[1]), ctx.temp());
+    ctx.println("\t{}.f64 = double({}.f32);", ctx.f(ctx.insn.operands[0]), ctx.temp());
+    return true;
+  }
   ctx.println("\t{}.f64 = float(1.0 / {}.f64);", ctx.f(ctx.insn.operands[0]),
               ctx.f(ctx.insn.operands[1]));
   return true;
 }
 
 bool build_frsqrte(BuilderContext& ctx) {
+  ctx.emit_set_flush_mode(false);
+  if (ctx.config().fastFloatEstimates) {
+    // Hardware rsqrt estimate refined with one Newton-Raphson step.
+    ctx.println(
+        "\t{}.f32 = simde_mm_cvtss_f32(simde_mm_rsqrt_ss(simde_mm_set_ss(float({}.f64))));",
+        ctx.temp(), ctx.f(ctx.insn.operands[1]));
+    ctx.println("\t{}.f32 = {}.f32 * (1.5f - 0.5f * float({}.f64) * {}.f32 * {}.f32);", ctx.temp(),
+                ctx.temp(), ctx.f(ctx.insn.operands[1]), ctx.temp(), ctx.temp());
+    ctx.println("\t{}.f64 = double({}.f32);", ctx.f(ctx.insn.operands[0]), ctx.temp());
+    return true;
+  }
   // frsqrte: Floating reciprocal square root estimate
   // Uses lookup table approach from RPCS3
   // Credit: https://github.com/RPCS3/rpcs3/blob/master/rpcs3/Emu/Cell/PPUInterpreter.cpp
-  ctx.emit_set_flush_mode(false);
   ctx.println("\t{}.u64 = uint64_t(rex::ppu_frsqrte_lut.data[{}.u64 >> 49]) << 32;",
               ctx.f(ctx.insn.operands[0]), ctx.f(ctx.insn.operands[1]));
   return true;
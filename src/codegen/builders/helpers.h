@@ -39,6 +39,23 @@ inline uint64_t compute_mask(uint32_t mstart, uint32_t mstop) {
   return mstart <= mstop ? value : ~value;
 }
 
+/**
+ * Static branch-prediction hint for a local conditional branch.
+ *
+ * Backward branches are loop back-edges and almost always taken, so they get
+ * [[likely]]. Forward branches stay unhinted - a blanket [[unlikely]] would
+ * mispredict ordinary if/else diamonds.
+ *
+ * @param config Recompiler configuration (honors branchHints)
+ * @param base Address of the branch instruction
+ * @param target Branch target address
+ * @return " [[likely]]" or "" to splice between the condition and statement
+ */
+inline std::string_view branchTakenHint(const RecompilerConfig& config, uint32_t base,
+                                        uint32_t target) {
+  return config.branchHints && target <= base ? " [[likely]]" : "";
+}
+
 //=============================================================================
 // CR Bit Helpers
 //=============================================================================
@@ -268,7 +285,10 @@ inline const char* getStoreMacro(BuilderContext& ctx, const char* normal_macro,
 /**
  * Emit atomic load-and-reserve instruction (lwarx/ldarx pattern).
  *
- * Pattern: EA = rA + rB; reserved = *(T*)PPC_RAW_ADDR(EA); rD = bswap(reserved)
+ * Pattern: EA = rA + rB; reserved = PPC_LOAD_RESERVED(EA); rD = bswap(reserved)
+ *
+ * PPC_LOAD_RESERVED also snapshots the granule sequence counter that the
+ * matching store-conditional validates against.
  *
  * @param ctx The builder context
  * @param ptr_type The pointer type (e.g., "uint32_t", "uint64_t")
@@ -281,7 +301,7 @@ inline void emitAtomicLoadReserve(BuilderContext& ctx, const char* ptr_type, con
   if (ctx.insn.operands[1] != 0)
     ctx.print("{}.u32 + ", ctx.r(ctx.insn.operands[1]));
   ctx.println("{}.u32;", ctx.r(ctx.insn.operands[2]));
-  ctx.println("\t{}.{} = *({}*)PPC_RAW_ADDR({});", ctx.reserved(), reserved_field, ptr_type,
+  ctx.println("\t{}.{} = PPC_LOAD_RESERVED({}, {});", ctx.reserved(), reserved_field, ptr_type,
               ctx.ea());
   ctx.println("\t{}.u64 = {}({}.{});", ctx.r(ctx.insn.operands[0]), bswap_func, ctx.reserved(),
               reserved_field);
@@ -290,7 +310,11 @@ inline void emitAtomicLoadReserve(BuilderContext& ctx, const char* ptr_type, con
 /**
  * Emit atomic store-conditional instruction (stwcx./stdcx. pattern).
  *
- * Pattern: EA = rA + rB; cr0 = CAS(EA, reserved, bswap(rS))
+ * Pattern: EA = rA + rB; cr0 = PPC_STORE_CONDITIONAL(EA, reserved, bswap(rS))
+ *
+ * The macro validates the granule sequence snapshotted by the matching
+ * lwarx/ldarx, commits via compare-exchange, and bumps the sequence so
+ * every other thread's reservation on the granule fails.
  *
  * @param ctx The builder context
  * @param ptr_type The pointer type (e.g., "uint32_t", "uint64_t")
@@ -305,11 +329,8 @@ inline void emitAtomicStoreConditional(BuilderContext& ctx, const char* ptr_type
   ctx.println("{}.u32;", ctx.r(ctx.insn.operands[2]));
   ctx.println("\t{}.lt = 0;", ctx.cr(0));
   ctx.println("\t{}.gt = 0;", ctx.cr(0));
-  ctx.println(
-      "\t{}.eq = __sync_bool_compare_and_swap(reinterpret_cast<{}*>(PPC_RAW_ADDR({})), "
-      "{}.{}, {}({}.{}));",
-      ctx.cr(0), ptr_type, ctx.ea(), ctx.reserved(), field, bswap_func, ctx.r(ctx.insn.operands[0]),
-      field);
+  ctx.println("\t{}.eq = PPC_STORE_CONDITIONAL({}, {}, {}.{}, {}({}.{}));", ctx.cr(0), ptr_type,
+              ctx.ea(), ctx.reserved(), field, bswap_func, ctx.r(ctx.insn.operands[0]), field);
   ctx.println("\t{}.so = {}.so;", ctx.cr(0), ctx.xer());
 }
 
@@ -393,7 +414,9 @@ inline void emitBranchWithBoundsCheck(BuilderContext& ctx, uint32_t target,
     ctx.println("\tif ({}) {{ /* branch to 0x{:X} outside function */ return; }}", condition,
                 target);
   } else {
-    ctx.println("\tif ({}) goto loc_{:X};", condition, target);
+    ctx.csrLabels.recordEdge(target, ctx.csrState);
+    ctx.println("\tif ({}){} goto loc_{:X};", condition,
+                branchTakenHint(ctx.config(), ctx.base, target), target);
   }
 }
 
@@ -107,7 +107,7 @@ bool build_vnmsubfp(BuilderContext& ctx) {
       "\tsimde_mm_store_ps({}.f32, "
       "simde_mm_xor_ps(simde_mm_sub_ps(simde_mm_mul_ps(simde_mm_load_ps({}.f32), "
       "simde_mm_load_ps({}.f32)), simde_mm_load_ps({}.f32)), "
-      "simde_mm_castsi128_ps(simde_mm_set1_epi32(int(0x80000000)))));",
+      "VectorSignMaskPS));",
       ctx.v(ctx.insn.operands[0]), ctx.v(ctx.insn.operands[1]), ctx.v(ctx.insn.operands[2]),
       ctx.v(ctx.insn.operands[3]));
   return true;
@@ -547,13 +547,13 @@ bool build_vcmpbfp(BuilderContext& ctx) {
   // gt_mask = (vA > vB) & 0x80000000
   ctx.println(
       "\tsimde_mm_store_ps({}.f32, simde_mm_and_ps(simde_mm_cmpgt_ps(simde_mm_load_ps({}.f32), "
-      "simde_mm_load_ps({}.f32)), simde_mm_castsi128_ps(simde_mm_set1_epi32(int(0x80000000)))));",
+      "simde_mm_load_ps({}.f32)), VectorSignMaskPS));",
       ctx.v_temp(), vA, vB);
   // neg_vB stored in vD temporarily, then compute lt_neg_mask = (vA < neg_vB) & 0x40000000
   ctx.println(
       "\tsimde_mm_store_ps({}.f32, simde_mm_and_ps(simde_mm_cmplt_ps(simde_mm_load_ps({}.f32), "
       "simde_mm_xor_ps(simde_mm_load_ps({}.f32), "
-      "simde_mm_castsi128_ps(simde_mm_set1_epi32(int(0x80000000))))), "
+      "VectorSignMaskPS)), "
       "simde_mm_castsi128_ps(simde_mm_set1_epi32(int(0x40000000)))));",
       vD, vA, vB);
   // result = gt_mask | lt_neg_mask
@@ -667,9 +667,9 @@ bool build_vcmpgtuw(BuilderContext& ctx) {
   ctx.println(
       "\tsimde_mm_store_si128((simde__m128i*){}.u32, "
       "simde_mm_cmpgt_epi32(simde_mm_xor_si128(simde_mm_load_si128((simde__m128i*){}.u32), "
-      "simde_mm_set1_epi32((int32_t)0x80000000)), "
+      "VectorSignMask32), "
       "simde_mm_xor_si128(simde_mm_load_si128((simde__m128i*){}.u32), "
-      "simde_mm_set1_epi32((int32_t)0x80000000))));",
+      "VectorSignMask32)));",
       ctx.v(ctx.insn.operands[0]), ctx.v(ctx.insn.operands[1]), ctx.v(ctx.insn.operands[2]));
 
   if (isRecordForm(ctx.insn))
@@ -867,10 +867,11 @@ bool build_vrlimi128(BuilderContext& ctx) {
 //=============================================================================
 
 bool build_vslb(BuilderContext& ctx) {
-  // TODO(tomc): vectorize
-  for (size_t i = 0; i < 16; i++)
-    ctx.println("\t{}.u8[{}] = {}.u8[{}] << ({}.u8[{}] & 0x7);", ctx.v(ctx.insn.operands[0]), i,
-                ctx.v(ctx.insn.operands[1]), i, ctx.v(ctx.insn.operands[2]), i);
+  ctx.println(
+      "\tsimde_mm_store_si128((simde__m128i*){}.u8, "
+      "rex::simde_mm_sllv_epi8_(simde_mm_load_si128((simde__m128i*){}.u8), "
+      "simde_mm_load_si128((simde__m128i*){}.u8)));",
+      ctx.v(ctx.insn.operands[0]), ctx.v(ctx.insn.operands[1]), ctx.v(ctx.insn.operands[2]));
   return true;
 }
 
@@ -885,64 +886,65 @@ bool build_vsldoi(BuilderContext& ctx) {
 }
 
 bool build_vslh(BuilderContext& ctx) {
-  // TODO(tomc): vectorize
-  for (size_t i = 0; i < 8; i++)
-    ctx.println("\t{}.u16[{}] = {}.u16[{}] << ({}.u16[{}] & 0xF);", ctx.v(ctx.insn.operands[0]), i,
-                ctx.v(ctx.insn.operands[1]), i, ctx.v(ctx.insn.operands[2]), i);
+  ctx.println(
+      "\tsimde_mm_store_si128((simde__m128i*){}.u8, "
+      "rex::simde_mm_sllv_epi16_(simde_mm_load_si128((simde__m128i*){}.u8), "
+      "simde_mm_load_si128((simde__m128i*){}.u8)));",
+      ctx.v(ctx.insn.operands[0]), ctx.v(ctx.insn.operands[1]), ctx.v(ctx.insn.operands[2]));
   return true;
 }
 
 bool build_vsrh(BuilderContext& ctx) {
-  // TODO(tomc): vectorize
-  for (size_t i = 0; i < 8; i++)
-    ctx.println("\t{}.u16[{}] = {}.u16[{}] >> ({}.u16[{}] & 0xF);", ctx.v(ctx.insn.operands[0]), i,
-                ctx.v(ctx.insn.operands[1]), i, ctx.v(ctx.insn.operands[2]), i);
+  ctx.println(
+      "\tsimde_mm_store_si128((simde__m128i*){}.u8, "
+      "rex::simde_mm_srlv_epi16_(simde_mm_load_si128((simde__m128i*){}.u8), "
+      "simde_mm_load_si128((simde__m128i*){}.u8)));",
+      ctx.v(ctx.insn.operands[0]), ctx.v(ctx.insn.operands[1]), ctx.v(ctx.insn.operands[2]));
   return true;
 }
 
 bool build_vsrb(BuilderContext& ctx) {
-  // TODO(tomc): vectorize
-  for (size_t i = 0; i < 16; i++)
-    ctx.println("\t{}.u8[{}] = {}.u8[{}] >> ({}.u8[{}] & 0x7);", ctx.v(ctx.insn.operands[0]), i,
-                ctx.v(ctx.insn.operands[1]), i, ctx.v(ctx.insn.operands[2]), i);
+  ctx.println(
+      "\tsimde_mm_store_si128((simde__m128i*){}.u8, "
+      "rex::simde_mm_srlv_epi8_(simde_mm_load_si128((simde__m128i*){}.u8), "
+      "simde_mm_load_si128((simde__m128i*){}.u8)));",
+      ctx.v(ctx.insn.operands[0]), ctx.v(ctx.insn.operands[1]), ctx.v(ctx.insn.operands[2]));
   return true;
 }
 
 bool build_vsrab(BuilderContext& ctx) {
-  // TODO(tomc): vectorize
-  for (size_t i = 0; i < 16; i++)
-    ctx.println("\t{}.s8[{}] = {}.s8[{}] >> ({}.u8[{}] & 0x7);", ctx.v(ctx.insn.operands[0]), i,
-                ctx.v(ctx.insn.operands[1]), i, ctx.v(ctx.insn.operands[2]), i);
+  ctx.println(
+      "\tsimde_mm_store_si128((simde__m128i*){}.u8, "
+      "rex::simde_mm_srav_epi8_(simde_mm_load_si128((simde__m128i*){}.u8), "
+      "simde_mm_load_si128((simde__m128i*){}.u8)));",
+      ctx.v(ctx.insn.operands[0]), ctx.v(ctx.insn.operands[1]), ctx.v(ctx.insn.operands[2]));
   return true;
 }
 
 bool build_vsrah(BuilderContext& ctx) {
-  // TODO(tomc): vectorize
-  for (size_t i = 0; i < 8; i++)
-    ctx.println("\t{}.s16[{}] = {}.s16[{}] >> ({}.u16[{}] & 0xF);", ctx.v(ctx.insn.operands[0]), i,
-                ctx.v(ctx.insn.operands[1]), i, ctx.v(ctx.insn.operands[2]), i);
+  ctx.println(
+      "\tsimde_mm_store_si128((simde__m128i*){}.u8, "
+      "rex::simde_mm_srav_epi16_(simde_mm_load_si128((simde__m128i*){}.u8), "
+      "simde_mm_load_si128((simde__m128i*){}.u8)));",
+      ctx.v(ctx.insn.operands[0]), ctx.v(ctx.insn.operands[1]), ctx.v(ctx.insn.operands[2]));
   return true;
 }
 
 bool build_vrlh(BuilderContext& ctx) {
-  // TODO(tomc): vectorize
-  for (size_t i = 0; i < 8; i++) {
-    ctx.println("\t{{ uint16_t sh = {}.u16[{}] & 0xF;", ctx.v(ctx.insn.operands[2]), i);
-    ctx.println("\t{}.u16[{}] = ({}.u16[{}] << sh) | (sh ? ({}.u16[{}] >> (16 - sh)) : 0); }}",
-                ctx.v(ctx.insn.operands[0]), i, ctx.v(ctx.insn.operands[1]), i,
-                ctx.v(ctx.insn.operands[1]), i);
-  }
+  ctx.println(
+      "\tsimde_mm_store_si128((simde__m128i*){}.u8, "
+      "rex::simde_mm_rolv_epi16_(simde_mm_load_si128((simde__m128i*){}.u8), "
+      "simde_mm_load_si128((simde__m128i*){}.u8)));",
+      ctx.v(ctx.insn.operands[0]), ctx.v(ctx.insn.operands[1]), ctx.v(ctx.insn.operands[2]));
   return true;
 }
 
 bool build_vrlw(BuilderContext& ctx) {
-  // TODO(tomc): vectorize
-  for (size_t i = 0; i < 4; i++) {
-    ctx.println("\t{{ uint32_t sh = {}.u32[{}] & 0x1F;", ctx.v(ctx.insn.operands[2]), i);
-    ctx.println("\t{}.u32[{}] = ({}.u32[{}] << sh) | ({}.u32[{}] >> (32 - sh)); }}",
-                ctx.v(ctx.insn.operands[0]), i, ctx.v(ctx.insn.operands[1]), i,
-                ctx.v(ctx.insn.operands[1]), i);
-  }
+  ctx.println(
+      "\tsimde_mm_store_si128((simde__m128i*){}.u8, "
+      "rex::simde_mm_rolv_epi32_(simde_mm_load_si128((simde__m128i*){}.u8), "
+      "simde_mm_load_si128((simde__m128i*){}.u8)));",
+      ctx.v(ctx.insn.operands[0]), ctx.v(ctx.insn.operands[1]), ctx.v(ctx.insn.operands[2]));
   return true;
 }
 
@@ -978,10 +980,11 @@ bool build_vsro(BuilderContext& ctx) {
 }
 
 bool build_vslw(BuilderContext& ctx) {
-  // TODO(tomc): vectorize
-  for (size_t i = 0; i < 4; i++)
-    ctx.println("\t{}.u32[{}] = {}.u32[{}] << ({}.u8[{}] & 0x1F);", ctx.v(ctx.insn.operands[0]), i,
-                ctx.v(ctx.insn.operands[1]), i, ctx.v(ctx.insn.operands[2]), i * 4);
+  ctx.println(
+      "\tsimde_mm_store_si128((simde__m128i*){}.u8, "
+      "rex::simde_mm_sllv_epi32_(simde_mm_load_si128((simde__m128i*){}.u8), "
+      "simde_mm_load_si128((simde__m128i*){}.u8)));",
+      ctx.v(ctx.insn.operands[0]), ctx.v(ctx.insn.operands[1]), ctx.v(ctx.insn.operands[2]));
   return true;
 }
 
@@ -995,18 +998,20 @@ bool build_vsr(BuilderContext& ctx) {
 }
 
 bool build_vsraw(BuilderContext& ctx) {
-  // TODO(tomc): vectorize
-  for (size_t i = 0; i < 4; i++)
-    ctx.println("\t{}.s32[{}] = {}.s32[{}] >> ({}.u8[{}] & 0x1F);", ctx.v(ctx.insn.operands[0]), i,
-                ctx.v(ctx.insn.operands[1]), i, ctx.v(ctx.insn.operands[2]), i * 4);
+  ctx.println(
+      "\tsimde_mm_store_si128((simde__m128i*){}.u8, "
+      "rex::simde_mm_srav_epi32_(simde_mm_load_si128((simde__m128i*){}.u8), "
+      "simde_mm_load_si128((simde__m128i*){}.u8)));",
+      ctx.v(ctx.insn.operands[0]), ctx.v(ctx.insn.operands[1]), ctx.v(ctx.insn.operands[2]));
   return true;
 }
 
 bool build_vsrw(BuilderContext& ctx) {
-  // TODO(tomc): vectorize
-  for (size_t i = 0; i < 4; i++)
-    ctx.println("\t{}.u32[{}] = {}.u32[{}] >> ({}.u8[{}] & 0x1F);", ctx.v(ctx.insn.operands[0]), i,
-                ctx.v(ctx.insn.operands[1]), i, ctx.v(ctx.insn.operands[2]), i * 4);
+  ctx.println(
+      "\tsimde_mm_store_si128((simde__m128i*){}.u8, "
+      "rex::simde_mm_srlv_epi32_(simde_mm_load_si128((simde__m128i*){}.u8), "
+      "simde_mm_load_si128((simde__m128i*){}.u8)));",
+      ctx.v(ctx.insn.operands[0]), ctx.v(ctx.insn.operands[1]), ctx.v(ctx.insn.operands[2]));
   return true;
 }
 
@@ -1086,8 +1091,8 @@ bool build_vpkuhum(BuilderContext& ctx) {
   ctx.println(
       "\tsimde_mm_store_si128((simde__m128i*){}.u8, "
       "simde_mm_packus_epi16(simde_mm_and_si128(simde_mm_load_si128((simde__m128i*){}.u16), "
-      "simde_mm_set1_epi16(0xFF)), simde_mm_and_si128(simde_mm_load_si128((simde__m128i*){}.u16), "
-      "simde_mm_set1_epi16(0xFF))));",
+      "VectorByteMask16), simde_mm_and_si128(simde_mm_load_si128((simde__m128i*){}.u16), "
+      "VectorByteMask16)));",
       ctx.v(ctx.insn.operands[0]), ctx.v(ctx.insn.operands[2]), ctx.v(ctx.insn.operands[1]));
   return true;
 }
@@ -1113,9 +1118,9 @@ bool build_vpkuwum(BuilderContext& ctx) {
   ctx.println(
       "\tsimde_mm_store_si128((simde__m128i*){}.u16, "
       "simde_mm_packus_epi32(simde_mm_and_si128(simde_mm_load_si128((simde__m128i*){}.u32), "
-      "simde_mm_set1_epi32(0xFFFF)), "
+      "VectorHalfMask32), "
       "simde_mm_and_si128(simde_mm_load_si128((simde__m128i*){}.u32), "
-      "simde_mm_set1_epi32(0xFFFF))));",
+      "VectorHalfMask32)));",
       ctx.v(ctx.insn.operands[0]), ctx.v(ctx.insn.operands[2]), ctx.v(ctx.insn.operands[1]));
   return true;
 }
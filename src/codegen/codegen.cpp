@@ -9,6 +9,8 @@
  *              See LICENSE file in the project root for full license text.
  */
 
+#include "discovery.h"
+
 #include <fmt/format.h>
 
 #include <rex/codegen/analyze.h>
@@ -73,15 +75,37 @@ Result<CodegenPipeline> CodegenPipeline::Create(const std::filesystem::path& con
   return Ok(std::move(pipeline));
 }
 
+void CodegenPipeline::AdoptAnalysisCache(CodegenPipeline& previous) {
+  auto* prevCache = previous.ctx_->jumpTableCache();
+  if (prevCache == nullptr) {
+    return;
+  }
+
+  // Only safe when both pipelines analyzed the exact same executable bytes;
+  // Analyze() re-checks the hash before trusting whatever is installed.
+  if (prevCache->sectionHash() != executableSectionHash(ctx_->binary())) {
+    REXLOG_DEBUG("Batch codegen: binary changed, not sharing jump-table cache");
+    return;
+  }
+
+  REXLOG_INFO("Batch codegen: sharing jump-table cache ({} entries) with previous run",
+              prevCache->size());
+  ctx_->setJumpTableCache(previous.ctx_->takeJumpTableCache());
+}
+
 Result<void> CodegenPipeline::Run(bool force) {
   // Phase 1: Analyze (builds and validates function graph)
-  auto analyzeResult = Analyze(*ctx_);
-  if (!analyzeResult) {
-    REXLOG_ERROR("Analysis failed: {}", analyzeResult.error().message);
-    return analyzeResult;
+  {
+    PhaseTimer timer(ctx_->timings, "analyze");
+    auto analyzeResult = Analyze(*ctx_);
+    if (!analyzeResult) {
+      REXLOG_ERROR("Analysis failed: {}", analyzeResult.error().message);
+      return analyzeResult;
+    }
   }
 
   // Phase 2: Recompile (generates C++ code)
+  PhaseTimer timer(ctx_->timings, "recompile");
   return Recompile(*ctx_, force);
 }
 
@@ -9,6 +9,7 @@
  */
 
 #include "decoded_binary.h"
+#include "discovery.h"
 
 #include <fmt/format.h>
 
@@ -81,7 +82,10 @@ Result<CodegenContext> CodegenContext::Create(const std::filesystem::path& confi
     return Err<CodegenContext>(ErrorCategory::Format, "Failed to get XexModule from UserModule");
   }
 
-  ctx.binary_ = BinaryView::fromModule(*module);
+  // Borrow section data from the module: the Runtime owns the module and
+  // outlives the context (CodegenPipeline destroys ctx_ before runtime_), so
+  // no copy of the image is needed.
+  ctx.binary_ = BinaryView::fromModule(*module, BinaryView::DataPolicy::kBorrow);
   ctx.resolver_ = runtime.export_resolver();
 
   REXCODEGEN_INFO("Loaded XEX: base=0x{:08X}, size=0x{:X}, entry=0x{:08X}",
@@ -104,6 +108,15 @@ CodegenContext CodegenContext::Create(BinaryView binary, RecompilerConfig config
 }
 
 CodegenContext::~CodegenContext() = default;
+
+void CodegenContext::setJumpTableCache(std::unique_ptr<JumpTableCache> cache) {
+  jumpTableCache_ = std::move(cache);
+}
+
+std::unique_ptr<JumpTableCache> CodegenContext::takeJumpTableCache() {
+  return std::move(jumpTableCache_);
+}
+
 CodegenContext::CodegenContext(CodegenContext&&) = default;
 CodegenContext& CodegenContext::operator=(CodegenContext&&) = default;
 
@@ -34,11 +34,36 @@ REXCVAR_DEFINE_UINT32(functions_per_file, 500, "Codegen",
     .lifecycle(rex::cvar::Lifecycle::kInitOnly)
     .range(1, 100000);
 
+REXCVAR_DEFINE_BOOL(incremental, true, "Codegen",
+                    "Skip re-emitting chunks whose function bytes and flags are unchanged")
+    .lifecycle(rex::cvar::Lifecycle::kInitOnly);
+
+REXCVAR_DEFINE_UINT32(jobs, 0, "Codegen",
+                      "Worker threads for parallel recompilation (0 = all hardware threads)")
+    .lifecycle(rex::cvar::Lifecycle::kInitOnly)
+    .range(0, 1024);
+
 REXCVAR_DEFINE_UINT32(progress_log_frequency, 100, "Codegen",
                       "Log progress every N functions")
     .lifecycle(rex::cvar::Lifecycle::kInitOnly)
     .range(1, 100000);
 
+REXCVAR_DEFINE_STRING(timing_json, "", "Codegen",
+                      "Write the codegen timing report as JSON to this path (empty = disabled)");
+
+//=============================================================================
+// Codegen/Benchmark
+//=============================================================================
+
+REXCVAR_DEFINE_UINT32(bench_runs, 0, "Codegen",
+                      "Benchmark mode: rerun the full pipeline N times per config and report "
+                      "per-phase minimum/median wall time plus peak RSS (0 = disabled)")
+    .lifecycle(rex::cvar::Lifecycle::kInitOnly)
+    .range(0, 1000);
+
+REXCVAR_DEFINE_STRING(bench_json, "", "Codegen",
+                      "Write the benchmark summary as JSON to this path (empty = log only)");
+
 //=============================================================================
 // Codegen/Analysis
 //=============================================================================
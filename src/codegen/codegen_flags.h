@@ -19,6 +19,13 @@
 // Codegen/Output
 REXCVAR_DECLARE(uint32_t, functions_per_file);
 REXCVAR_DECLARE(uint32_t, progress_log_frequency);
+REXCVAR_DECLARE(uint32_t, jobs);
+REXCVAR_DECLARE(bool, incremental);
+REXCVAR_DECLARE(std::string, timing_json);
+
+// Codegen/Benchmark
+REXCVAR_DECLARE(uint32_t, bench_runs);
+REXCVAR_DECLARE(std::string, bench_json);
 
 // Codegen/Analysis
 REXCVAR_DECLARE(uint32_t, max_discovery_iterations);
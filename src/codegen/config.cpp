@@ -13,6 +13,8 @@
 // TOML config file loading
 
 #include <algorithm>
+#include <cstdio>
+#include <filesystem>
 #include <map>
 
 #include <fmt/format.h>
@@ -58,6 +60,44 @@ void RecompilerConfig::Load(const std::string_view& configFilePath) {
   crRegistersAsLocalVariables = toml["cr_as_local"].value_or(false);
   nonArgumentRegistersAsLocalVariables = toml["non_argument_as_local"].value_or(false);
   nonVolatileRegistersAsLocalVariables = toml["non_volatile_as_local"].value_or(false);
+  foldImmediatePairs = toml["fold_immediate_pairs"].value_or(true);
+  foldLoadStoreCopies = toml["fold_load_store_copies"].value_or(true);
+  fuseCompareBranches = toml["fuse_compare_branches"].value_or(true);
+  devirtualizeVTableCalls = toml["devirtualize_vtable_calls"].value_or(true);
+  skipLrForLeafCalls = toml["skip_lr_for_leaf_calls"].value_or(true);
+  emitTailCalls = toml["emit_tail_calls"].value_or(true);
+  inlineInstructionBudget = toml["inline_instruction_budget"].value_or(0u);
+  computedGotoMinEntries = toml["computed_goto_min_entries"].value_or(32u);
+  volatileMemoryAccess = toml["volatile_memory"].value_or(false);
+  emitFunctionCounters = toml["emit_function_counters"].value_or(false);
+  fastFloatEstimates = toml["fast_float_estimates"].value_or(false);
+  branchHints = toml["branch_hints"].value_or(true);
+
+  // Optional runtime profile for hot/cold output splitting
+  profilePath = toml["profile_path"].value_or<std::string>("");
+  profileHotThreshold =
+      static_cast<uint64_t>(toml["profile_hot_threshold"].value_or<int64_t>(1));
+  if (!profilePath.empty()) {
+    std::filesystem::path path = profilePath;
+    if (path.is_relative())
+      path = std::filesystem::path(configFilePath).parent_path() / path;
+
+    FILE* file = fopen(path.string().c_str(), "r");
+    if (!file) {
+      REXCODEGEN_WARN("Profile file not found: {}", path.string());
+    } else {
+      char line[128];
+      while (fgets(line, sizeof(line), file)) {
+        if (line[0] == '#' || line[0] == '\n')
+          continue;
+        unsigned long long address = 0, count = 0;
+        if (sscanf(line, "%llx %llu", &address, &count) == 2)
+          profile[static_cast<uint32_t>(address)] = count;
+      }
+      fclose(file);
+      REXCODEGEN_INFO("Loaded {} profile entries from {}", profile.size(), path.string());
+    }
+  }
 
   // Special addresses (user overrides)
   longJmpAddress = toml["longjmp_address"].value_or(0u);
@@ -276,6 +316,9 @@ void RecompilerConfig::Load(const std::string_view& configFilePath) {
     maxJumpExtension = (*analysisTable)["max_jump_extension"].value_or(65536u);
     dataRegionThreshold = (*analysisTable)["data_region_threshold"].value_or(16u);
     largeFunctionThreshold = (*analysisTable)["large_function_threshold"].value_or(1048576u);
+    quarantineAnalysisErrors = (*analysisTable)["quarantine_analysis_errors"].value_or(false);
+    largeEmissionThreshold = (*analysisTable)["large_emission_threshold"].value_or(1048576u);
+    isolateFunctionThreshold = (*analysisTable)["isolate_function_threshold"].value_or(0u);
 
     // Exception handler function addresses for code region segmentation
     if (auto handlers = (*analysisTable)["exception_handler_funcs"].as_array()) {
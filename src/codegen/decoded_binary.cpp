@@ -34,8 +34,9 @@ void DecodedBinary::decode() {
     sec.base = section.baseAddress;
     sec.size = section.size;
 
-    // Copy raw section data (needed for reading jump tables and other data)
-    sec.data.assign(section.data, section.data + section.size);
+    // Reference raw section data in the BinaryView (needed for reading jump
+    // tables and other data); the view outlives this DecodedBinary.
+    sec.data = section.data;
 
     // Only decode instructions for executable sections
     if (section.executable) {
@@ -94,10 +95,10 @@ const uint8_t* DecodedBinary::rawData(uint32_t addr, size_t len) const {
     return nullptr;
 
   uint32_t offset = addr - sec->base;
-  if (offset + len > sec->data.size())
+  if (offset + len > sec->size)
     return nullptr;
 
-  return sec->data.data() + offset;
+  return sec->data + offset;
 }
 
 const CodeRegion* DecodedBinary::regionContaining(uint32_t addr) const {
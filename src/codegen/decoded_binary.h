@@ -128,7 +128,7 @@ class DecodedBinary {
     uint32_t base;
     uint32_t size;
     std::vector<DecodedInsn> instructions;
-    std::vector<uint8_t> data;  // Copy of raw section data
+    const uint8_t* data = nullptr;  // View into BinaryView's section data
 
     bool contains(uint32_t addr) const { return addr >= base && addr < base + size; }
 
@@ -13,6 +13,8 @@
 #include "discovery.h"
 
 #include <algorithm>
+#include <cstdio>
+#include <cstring>
 #include <queue>
 
 #include <rex/logging.h>
@@ -630,7 +632,7 @@ std::optional<JumpTable> detectJumpTable(DecodedBinary& decoded, uint32_t bctrAd
 BlockDiscoveryResult discoverBlocks(DecodedBinary& decoded, uint32_t entryPoint,
                                     const CodeRegion& containingRegion,
                                     const std::unordered_set<uint32_t>& knownFunctions,
-                                    uint32_t pdataSize) {
+                                    uint32_t pdataSize, JumpTableCache* jtCache) {
   BlockDiscoveryResult result;
   std::unordered_set<uint32_t> visited;
   std::unordered_set<uint32_t> blockStarts;
@@ -719,7 +721,12 @@ BlockDiscoveryResult discoverBlocks(DecodedBinary& decoded, uint32_t entryPoint,
           // bctr - try to detect jump table
           REXCODEGEN_TRACE("discoverBlocks: bctr at 0x{:08X} in func 0x{:08X}, funcEnd=0x{:08X}",
                            addr, entryPoint, funcEnd);
-          auto jt = detectJumpTable(decoded, addr, containingRegion, entryPoint, funcEnd);
+          std::optional<JumpTable> jt;
+          if (!jtCache || !jtCache->probe(addr, jt)) {
+            jt = detectJumpTable(decoded, addr, containingRegion, entryPoint, funcEnd);
+            if (jtCache)
+              jtCache->record(addr, jt);
+          }
           if (jt) {
             REXCODEGEN_TRACE("discoverBlocks: detected jump table at bctr 0x{:08X} with {} targets",
                              addr, jt->targets.size());
@@ -826,4 +833,130 @@ BlockDiscoveryResult discoverBlocks(DecodedBinary& decoded, uint32_t entryPoint,
   return result;
 }
 
+//=============================================================================
+// Jump Table Cache
+//=============================================================================
+
+// Sidecar format (text, one record per line):
+//   REXJT1 <sectionHash>
+//   T <bctr> <table> <indexReg> <count> <targets...>
+//   M <bctr>
+static constexpr const char* kJumpTableCacheMagic = "REXJT1";
+
+bool JumpTableCache::load(const std::filesystem::path& path, uint64_t sectionHash) {
+  sectionHash_ = sectionHash;
+
+  FILE* f = fopen(path.string().c_str(), "r");
+  if (!f)
+    return false;
+
+  char magic[16] = {};
+  unsigned long long fileHash = 0;
+  if (fscanf(f, "%15s %llx", magic, &fileHash) != 2 || strcmp(magic, kJumpTableCacheMagic) != 0 ||
+      static_cast<uint64_t>(fileHash) != sectionHash) {
+    REXCODEGEN_DEBUG("JumpTableCache: stale or invalid cache at {}, ignoring", path.string());
+    fclose(f);
+    return false;
+  }
+
+  char kind = 0;
+  while (fscanf(f, " %c", &kind) == 1) {
+    if (kind == 'T') {
+      JumpTable table{};
+      unsigned int bctr = 0, tableAddr = 0, indexReg = 0, count = 0;
+      if (fscanf(f, "%x %x %u %u", &bctr, &tableAddr, &indexReg, &count) != 4)
+        break;
+      table.bctrAddress = bctr;
+      table.tableAddress = tableAddr;
+      table.indexRegister = static_cast<uint8_t>(indexReg);
+      table.targets.reserve(count);
+      bool ok = true;
+      for (unsigned int i = 0; i < count; i++) {
+        unsigned int target = 0;
+        if (fscanf(f, "%x", &target) != 1) {
+          ok = false;
+          break;
+        }
+        table.targets.push_back(target);
+      }
+      if (!ok)
+        break;
+      tables_.emplace(table.bctrAddress, std::move(table));
+    } else if (kind == 'M') {
+      unsigned int bctr = 0;
+      if (fscanf(f, "%x", &bctr) != 1)
+        break;
+      misses_.insert(bctr);
+    } else {
+      break;
+    }
+  }
+  fclose(f);
+
+  REXCODEGEN_INFO("JumpTableCache: loaded {} tables, {} negative entries", tables_.size(),
+                  misses_.size());
+  return true;
+}
+
+void JumpTableCache::save(const std::filesystem::path& path) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  FILE* f = fopen(path.string().c_str(), "w");
+  if (!f) {
+    REXCODEGEN_WARN("JumpTableCache: failed to write {}", path.string());
+    return;
+  }
+
+  fprintf(f, "%s %llx\n", kJumpTableCacheMagic, static_cast<unsigned long long>(sectionHash_));
+
+  // Sorted output so the sidecar diffs cleanly between runs
+  std::vector<uint32_t> addrs;
+  addrs.reserve(tables_.size());
+  for (const auto& [addr, table] : tables_)
+    addrs.push_back(addr);
+  std::sort(addrs.begin(), addrs.end());
+
+  for (uint32_t addr : addrs) {
+    const JumpTable& table = tables_.at(addr);
+    fprintf(f, "T %x %x %u %zu", table.bctrAddress, table.tableAddress,
+            static_cast<unsigned int>(table.indexRegister), table.targets.size());
+    for (uint32_t target : table.targets)
+      fprintf(f, " %x", target);
+    fputc('\n', f);
+  }
+
+  std::vector<uint32_t> misses(misses_.begin(), misses_.end());
+  std::sort(misses.begin(), misses.end());
+  for (uint32_t addr : misses)
+    fprintf(f, "M %x\n", addr);
+
+  fclose(f);
+}
+
+bool JumpTableCache::probe(uint32_t bctrAddr, std::optional<JumpTable>& out) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (auto it = tables_.find(bctrAddr); it != tables_.end()) {
+    out = it->second;
+    return true;
+  }
+  if (misses_.contains(bctrAddr)) {
+    out = std::nullopt;
+    return true;
+  }
+  return false;
+}
+
+void JumpTableCache::record(uint32_t bctrAddr, const std::optional<JumpTable>& table) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (table)
+    tables_.emplace(bctrAddr, *table);
+  else
+    misses_.insert(bctrAddr);
+}
+
+size_t JumpTableCache::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return tables_.size() + misses_.size();
+}
+
 }  // namespace rex::codegen
@@ -14,7 +14,11 @@
 #include "decoded_binary.h"
 
 #include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
 #include <set>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -67,10 +71,51 @@ struct BlockDiscoveryResult {
  * @param knownFunctions Set of known function entry points (to detect tail calls)
  * @return BlockDiscoveryResult containing blocks, branches, and jump tables
  */
+//=============================================================================
+// Jump Table Cache
+//=============================================================================
+
+/**
+ * Memoized jump-table analysis results persisted across codegen runs.
+ *
+ * Both positive results (the descriptor) and negative results (bctr sites
+ * proven not to be switches) are recorded, since the backward dataflow scan
+ * is what dominates analysis time. The cache is validated against a hash of
+ * the executable sections; a stale cache is silently discarded.
+ *
+ * Thread-safe: probe/record may be called from concurrent discovery scans.
+ */
+class JumpTableCache {
+ public:
+  /// Load from disk. Returns false (and stays empty) on missing/stale file.
+  bool load(const std::filesystem::path& path, uint64_t sectionHash);
+
+  /// Write all recorded results to disk.
+  void save(const std::filesystem::path& path) const;
+
+  /// Look up a bctr site. Returns true if a result (hit or proven miss) is
+  /// recorded, with the descriptor in `out` for hits.
+  bool probe(uint32_t bctrAddr, std::optional<JumpTable>& out) const;
+
+  /// Record a detection result (positive or negative) for a bctr site.
+  void record(uint32_t bctrAddr, const std::optional<JumpTable>& table);
+
+  size_t size() const;
+
+  /// Hash of the executable sections this cache was built against
+  uint64_t sectionHash() const { return sectionHash_; }
+
+ private:
+  mutable std::mutex mutex_;
+  uint64_t sectionHash_ = 0;
+  std::unordered_map<uint32_t, JumpTable> tables_;
+  std::unordered_set<uint32_t> misses_;
+};
+
 BlockDiscoveryResult discoverBlocks(DecodedBinary& decoded, uint32_t entryPoint,
                                     const CodeRegion& containingRegion,
                                     const std::unordered_set<uint32_t>& knownFunctions,
-                                    uint32_t pdataSize = 0);
+                                    uint32_t pdataSize = 0, JumpTableCache* jtCache = nullptr);
 
 //=============================================================================
 // Jump Table Detection
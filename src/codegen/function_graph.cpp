@@ -12,6 +12,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <new>
 
 #include <rex/codegen/code_emitter.h>
 #include <rex/codegen/function_graph.h>
@@ -217,7 +218,7 @@ bool FunctionNode::tryResolveAgainst(FunctionNode* newFunction) {
   return anyResolved;
 }
 
-bool FunctionNode::tryResolveAgainstImport(uint32_t importAddr, const std::string& importName) {
+bool FunctionNode::tryResolveAgainstImport(uint32_t importAddr, std::string_view importName) {
   if (isSealed())
     return false;
 
@@ -229,7 +230,7 @@ bool FunctionNode::tryResolveAgainstImport(uint32_t importAddr, const std::strin
                        base_, it->site, it->target, importName);
 
       // Add as tail call to import
-      addTailCall(it->site, CallTarget::import(importAddr, importName));
+      addTailCall(it->site, CallTarget::import(importAddr, std::string(importName)));
 
       it = unresolvedJumps_.erase(it);
       anyResolved = true;
@@ -350,6 +351,35 @@ void FunctionNode::emitCpp(CodeEmitter& emit) const {
   // emit.line("}}");
 }
 
+FunctionGraph::FunctionGraph() : nodeArena_(std::make_unique<rex::memory::Arena>()) {}
+
+FunctionGraph::~FunctionGraph() {
+  destroyNodes();
+}
+
+FunctionGraph& FunctionGraph::operator=(FunctionGraph&& other) noexcept {
+  if (this != &other) {
+    destroyNodes();
+    codeBuffers_ = std::move(other.codeBuffers_);
+    nodeArena_ = std::move(other.nodeArena_);
+    functions_ = std::move(other.functions_);
+    functionsByBase_ = std::move(other.functionsByBase_);
+    functionHasXrefs_ = std::move(other.functionHasXrefs_);
+    chunks_ = std::move(other.chunks_);
+    memoryReader_ = std::move(other.memoryReader_);
+  }
+  return *this;
+}
+
+void FunctionGraph::destroyNodes() {
+  // Nodes are placement-new'd into the arena: run destructors explicitly,
+  // the arena then releases all chunks at once
+  for (auto& [base, node] : functions_) {
+    node->~FunctionNode();
+  }
+  functions_.clear();
+}
+
 void FunctionGraph::addCodeBuffer(uint32_t baseAddress, const uint8_t* data, size_t size) {
   assert_always("FunctionGraph::addCodeBuffer not implemented. Use Recompiler with builders");
   return;
@@ -395,7 +425,7 @@ FunctionNode* FunctionGraph::addFunction(uint32_t base, uint32_t size, FunctionA
   // Check for existing function at this address
   auto it = functions_.find(base);
   if (it != functions_.end()) {
-    FunctionNode* existing = it->second.get();
+    FunctionNode* existing = it->second;
 
     // Higher authority wins
     if (existing->authority() >= authority) {
@@ -410,10 +440,13 @@ FunctionNode* FunctionGraph::addFunction(uint32_t base, uint32_t size, FunctionA
                      AuthorityName(existing->authority()), AuthorityName(authority));
   }
 
-  // Create new node
-  auto node = std::make_unique<FunctionNode>(base, size, authority);
-  FunctionNode* nodePtr = node.get();
-  functions_[base] = std::move(node);
+  // Create new node in the arena (released wholesale when the graph dies)
+  auto* nodePtr = new (nodeArena_->Alloc(sizeof(FunctionNode), alignof(FunctionNode)))
+      FunctionNode(base, size, authority);
+  if (it != functions_.end()) {
+    it->second->~FunctionNode();  // Replaced by higher authority
+  }
+  functions_[base] = nodePtr;
   functionsByBase_[base] = nodePtr;
 
   // Track xrefs for merge eligibility
@@ -429,7 +462,7 @@ FunctionNode* FunctionGraph::addFunction(uint32_t base, uint32_t size, FunctionA
                                          std::string_view name, bool hasXrefs) {
   auto* node = addFunction(base, size, authority, hasXrefs);
   if (node && !name.empty()) {
-    node->setName(std::string(name));
+    node->setName(names_.intern(name));
   }
   return node;
 }
@@ -443,12 +476,12 @@ FunctionNode* FunctionGraph::addImportFunction(uint32_t address, std::string_vie
 
 FunctionNode* FunctionGraph::getFunction(uint32_t entryPoint) {
   auto it = functions_.find(entryPoint);
-  return it != functions_.end() ? it->second.get() : nullptr;
+  return it != functions_.end() ? it->second : nullptr;
 }
 
 const FunctionNode* FunctionGraph::getFunction(uint32_t entryPoint) const {
   auto it = functions_.find(entryPoint);
-  return it != functions_.end() ? it->second.get() : nullptr;
+  return it != functions_.end() ? it->second : nullptr;
 }
 
 bool FunctionGraph::removeFunction(uint32_t entryPoint) {
@@ -499,7 +532,7 @@ std::vector<FunctionNode*> FunctionGraph::getPendingFunctions() {
   std::vector<FunctionNode*> result;
   for (auto& [base, node] : functions_) {
     if (node->isPending()) {
-      result.push_back(node.get());
+      result.push_back(node);
     }
   }
   return result;
@@ -509,7 +542,7 @@ std::vector<FunctionNode*> FunctionGraph::getSealedFunctions() {
   std::vector<FunctionNode*> result;
   for (auto& [base, node] : functions_) {
     if (node->isSealed()) {
-      result.push_back(node.get());
+      result.push_back(node);
     }
   }
   return result;
@@ -537,9 +570,9 @@ size_t FunctionGraph::sealedCount() const {
 // Function Setup (called during Discover phase)
 //=============================================================================
 
-void FunctionGraph::setFunctionName(uint32_t entry, std::string name) {
+void FunctionGraph::setFunctionName(uint32_t entry, std::string_view name) {
   if (auto* node = getFunction(entry)) {
-    node->setName(std::move(name));
+    node->setName(names_.intern(name));
   }
 }
 
@@ -549,6 +582,24 @@ void FunctionGraph::setFunctionHasExceptionHandler(uint32_t entry, bool val) {
   }
 }
 
+void FunctionGraph::setFunctionLeaf(uint32_t entry, bool val) {
+  if (auto* node = getFunction(entry)) {
+    node->setLeaf(val);
+  }
+}
+
+void FunctionGraph::setFunctionFusibleCrFields(uint32_t entry, uint8_t mask) {
+  if (auto* node = getFunction(entry)) {
+    node->setFusibleCrFields(mask);
+  }
+}
+
+void FunctionGraph::setFunctionInlinable(uint32_t entry, bool val) {
+  if (auto* node = getFunction(entry)) {
+    node->setInlinable(val);
+  }
+}
+
 void FunctionGraph::setFunctionExceptionInfo(uint32_t entry, ExceptionInfo info) {
   if (auto* node = getFunction(entry)) {
     node->setExceptionInfo(std::move(info));
@@ -607,11 +658,11 @@ void FunctionGraph::addUnresolvedJumpToFunction(uint32_t entry, uint32_t site, u
   if (isImport(target)) {
     // Target is an import - resolve as call or tail call to import
     auto* importNode = getFunction(target);
-    const std::string& importName = importNode->name();
+    const std::string_view importName = importNode->name();
     if (isCall) {
-      node->addCall(site, CallTarget::import(target, importName));
+      node->addCall(site, CallTarget::import(target, std::string(importName)));
     } else {
-      node->addTailCall(site, CallTarget::import(target, importName));
+      node->addTailCall(site, CallTarget::import(target, std::string(importName)));
     }
     REXCODEGEN_TRACE("FunctionGraph: immediately resolved 0x{:08X}->0x{:08X} as {} to import {}",
                      site, target, isCall ? "call" : "tail call", importName);
@@ -667,13 +718,13 @@ size_t FunctionGraph::tryResolveFunction(uint32_t entry) {
     // Try import
     if (isImport(jump.target)) {
       auto* importNode = getFunction(jump.target);
-      const std::string& importName = importNode->name();
+      const std::string_view importName = importNode->name();
       REXCODEGEN_TRACE("  0x{:08X}->0x{:08X}: resolved as {} to import {}", jump.site, jump.target,
                        jump.isCall ? "call" : "tail call", importName);
       if (jump.isCall) {
-        node->addCall(jump.site, CallTarget::import(jump.target, importName));
+        node->addCall(jump.site, CallTarget::import(jump.target, std::string(importName)));
       } else {
-        node->addTailCall(jump.site, CallTarget::import(jump.target, importName));
+        node->addTailCall(jump.site, CallTarget::import(jump.target, std::string(importName)));
       }
       node->removeUnresolvedJump(jump.site);
       resolved++;
@@ -820,7 +871,7 @@ bool FunctionGraph::isMergeableEntryPoint(uint32_t addr) const {
     return false;  // Not an entry point
   }
 
-  const FunctionNode* node = it->second.get();
+  const FunctionNode* node = it->second;
 
   // Only GAP_FILL authority can be absorbed
   // All other authorities represent immutable entry points
@@ -863,7 +914,7 @@ TargetKind FunctionGraph::classifyTarget(uint32_t target, uint32_t callerAddr,
 
 void FunctionGraph::notifyFunctionAdded(FunctionNode* newFunction) {
   for (auto& [base, node] : functions_) {
-    if (node.get() != newFunction && node->isPending()) {
+    if (node != newFunction && node->isPending()) {
       node->tryResolveAgainst(newFunction);
     }
   }
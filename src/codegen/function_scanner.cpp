@@ -9,6 +9,7 @@
  */
 
 #include "codegen_flags.h"
+#include "decoded_binary.h"
 #include "ppc/instruction.h"
 #include "ppc/opcode.h"
 
@@ -55,6 +56,15 @@ bool FunctionScanner::isExecutableSection(rex::guest_addr_t address) const {
   return binary_->isExecutable(static_cast<uint32_t>(address));
 }
 
+Instruction FunctionScanner::decode_at(rex::guest_addr_t address, rex::u32 code) const {
+  if (decoded_ != nullptr) {
+    if (const auto* insn = decoded_->get(static_cast<uint32_t>(address))) {
+      return *insn;
+    }
+  }
+  return decode_instruction(address, code);
+}
+
 //=============================================================================
 // Helper: Detect function prologue pattern
 //=============================================================================
@@ -65,7 +75,7 @@ bool FunctionScanner::is_prologue_pattern(guest_addr_t address) {
     return false;
 
   u32 code = load_and_swap<u32>(host_ptr);
-  Instruction instr = decode_instruction(address, code);
+  Instruction instr = decode_at(address, code);
 
   // Check for mflr
   if (instr.opcode == Opcode::mflr) {
@@ -96,7 +106,7 @@ bool FunctionScanner::is_epilogue_pattern(guest_addr_t address) {
 
   u32 code = load_and_swap<u32>(host_ptr);
 
-  Instruction instr = decode_instruction(address, code);
+  Instruction instr = decode_at(address, code);
 
   // Check for blr
   if (instr.is_return()) {
@@ -260,7 +270,7 @@ BoundsInfo scan_for_bounds(const FunctionScanner& scanner, guest_addr_t bctr_add
     if (code == 0)
       break;
 
-    Instruction instr = decode_instruction(addr, code);
+    Instruction instr = scanner.decode_at(addr, code);
 
     // Look for conditional branch (bc, bca, bcl, bcla, bclr, bclrl)
     // bgt/ble/bgtlr/blelr are simplified mnemonics for bc with specific BO/BI
@@ -519,7 +529,7 @@ std::optional<JumpTable> FunctionScanner::detect_jump_table(guest_addr_t bctr_ad
     // Read as big-endian (PPC is big-endian)
     u32 code = load_and_swap<u32>(host_ptr);
 
-    Instruction instr = decode_instruction(addr, code);
+    Instruction instr = decode_at(addr, code);
 
     // Stop at function boundaries - but allow continuing past bctr if we're still
     // looking for lis (handles adjacent switch tables sharing setup code)
@@ -955,7 +965,7 @@ FunctionBlocks FunctionScanner::discover_blocks(rex::guest_addr_t entry_point,
     block.end = addr + 4;
     scannedAddrs.insert(addr);  // Mark this address as scanned
 
-    Instruction instr = decode_instruction(addr, code);
+    Instruction instr = decode_at(addr, code);
 
     // Check for blr (return)
     if (instr.is_return()) {
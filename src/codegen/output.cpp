@@ -18,7 +18,9 @@
 
 #include <algorithm>
 #include <fstream>
+#include <queue>
 #include <sstream>
+#include <utility>
 
 #include <fmt/format.h>
 
@@ -95,6 +97,110 @@ bool RecompilerOutput::write_all(const std::filesystem::path& output_dir) {
   return true;
 }
 
+//=============================================================================
+// Streaming mode
+//=============================================================================
+
+bool RecompilerOutput::begin_streaming(const std::filesystem::path& output_dir) {
+  namespace fs = std::filesystem;
+
+  generated_files_.clear();
+
+  std::error_code ec;
+  fs::create_directories(output_dir, ec);
+  if (ec) {
+    REXCODEGEN_ERROR("Failed to create output directory: {}", ec.message());
+    return false;
+  }
+
+  stream_ = std::make_unique<StreamState>();
+  stream_->output_dir = output_dir;
+
+  REXCODEGEN_INFO("Streaming recompiled output to: {}", output_dir.string());
+  return write_config_h(output_dir);
+}
+
+bool RecompilerOutput::open_stream_chunk() {
+  auto filename = fmt::format("{}_recomp.{}.cpp", config_.project_name, stream_->file_index);
+  auto path = stream_->output_dir / filename;
+
+  stream_->emitter = std::make_unique<FileEmitter>(path);
+  if (!stream_->emitter->ok()) {
+    REXCODEGEN_ERROR("Failed to create: {}", path.string());
+    return false;
+  }
+
+  auto& out = *stream_->emitter;
+  out.raw("//=============================================================================\n");
+  out.raw(fmt::format("// ReXGlue Generated - {} Recompiled Functions (Part {})\n",
+                      config_.project_name, stream_->file_index));
+  out.raw("//=============================================================================\n\n");
+  out.raw(fmt::format("#include \"{}_init.h\"\n\n", config_.project_name));
+
+  generated_files_.push_back(filename);
+  return true;
+}
+
+bool RecompilerOutput::stream_function(guest_addr_t address, const std::string& name,
+                                       const std::string& cpp_code) {
+  if (!stream_) {
+    REXCODEGEN_ERROR("stream_function called without begin_streaming");
+    return false;
+  }
+
+  if (!stream_->emitter || stream_->functions_in_file >= REXCVAR_GET(functions_per_file)) {
+    if (stream_->emitter)
+      stream_->emitter->close();
+    if (!open_stream_chunk())
+      return false;
+    stream_->file_index++;
+    stream_->functions_in_file = 0;
+  }
+
+  auto& out = *stream_->emitter;
+  if (config_.emit_comments)
+    out.raw(fmt::format("// Function at 0x{:08X}\n", address));
+  out.raw(cpp_code);
+  out.raw("\n");
+  stream_->functions_in_file++;
+
+  // Record address/name (but not the body) for the declaration and init files
+  CompiledFunction func;
+  func.address = address;
+  func.name = name;
+  functions_[address] = std::move(func);
+
+  return out.ok();
+}
+
+bool RecompilerOutput::finish_streaming() {
+  if (!stream_)
+    return false;
+
+  if (stream_->emitter) {
+    stream_->emitter->close();
+    if (!stream_->emitter->ok()) {
+      REXCODEGEN_ERROR("Write failure while streaming recompiled output");
+      return false;
+    }
+  }
+
+  auto output_dir = stream_->output_dir;
+  REXCODEGEN_INFO("  Streamed {} functions into {} files", functions_.size(),
+                  stream_->file_index);
+  stream_.reset();
+
+  if (!write_shared_h(output_dir))
+    return false;
+  if (!write_init(output_dir))
+    return false;
+  if (config_.emit_cmake && !write_cmake(output_dir))
+    return false;
+
+  REXCODEGEN_INFO("Generated {} files", generated_files_.size());
+  return true;
+}
+
 //=============================================================================
 // {project_name}_config.h
 //=============================================================================
@@ -186,38 +292,113 @@ bool RecompilerOutput::write_recomp_files(const std::filesystem::path& dir) {
   }
 
   // Calculate number of files needed
-  size_t num_files =
-      (func_list.size() + REXCVAR_GET(functions_per_file) - 1) / REXCVAR_GET(functions_per_file);
-
-  for (size_t file_idx = 0; file_idx < num_files; ++file_idx) {
-    auto filename = fmt::format("{}_recomp.{}.cpp", config_.project_name, file_idx);
-    auto path = dir / filename;
-    std::ofstream out(path);
-    if (!out) {
-      REXCODEGEN_ERROR("Failed to create: {}", path.string());
-      return false;
+  size_t num_files = config_.num_units;
+  if (num_files == 0)
+    num_files =
+        (func_list.size() + REXCVAR_GET(functions_per_file) - 1) / REXCVAR_GET(functions_per_file);
+  num_files = std::clamp<size_t>(num_files, 1, func_list.size());
+
+  // Size-balanced sharding: place functions largest-first into the currently
+  // smallest unit so no single TU dominates host compile time. Ties keep
+  // address order (input is sorted), making the layout deterministic.
+  auto pack_units = [](std::vector<const CompiledFunction*> group, size_t unit_count) {
+    std::stable_sort(group.begin(), group.end(), [](const auto* a, const auto* b) {
+      return a->cpp_code.size() > b->cpp_code.size();
+    });
+
+    std::vector<std::vector<const CompiledFunction*>> units(unit_count);
+    using Bin = std::pair<size_t, size_t>;  // (accumulated bytes, unit index)
+    std::priority_queue<Bin, std::vector<Bin>, std::greater<>> smallest;
+    for (size_t i = 0; i < unit_count; ++i)
+      smallest.emplace(0, i);
+
+    for (const auto* func : group) {
+      auto [bytes, unit] = smallest.top();
+      smallest.pop();
+      units[unit].push_back(func);
+      smallest.emplace(bytes + func->cpp_code.size(), unit);
     }
 
-    out << "//=============================================================================\n";
-    out << fmt::format("// ReXGlue Generated - {} Recompiled Functions (Part {})\n",
-                       config_.project_name, file_idx);
-    out << "//=============================================================================\n\n";
-    out << fmt::format("#include \"{}_init.h\"\n\n", config_.project_name);
+    // Keep each unit readable: functions appear in address order within a file
+    for (auto& unit : units) {
+      std::sort(unit.begin(), unit.end(),
+                [](const auto* a, const auto* b) { return a->address < b->address; });
+    }
+    return units;
+  };
+
+  auto write_units = [&](const std::vector<std::vector<const CompiledFunction*>>& units,
+                         const char* name_infix, std::vector<std::string>* file_names) {
+    for (size_t file_idx = 0; file_idx < units.size(); ++file_idx) {
+      auto filename =
+          fmt::format("{}_recomp.{}{}.cpp", config_.project_name, name_infix, file_idx);
+      auto path = dir / filename;
+      std::ofstream out(path);
+      if (!out) {
+        REXCODEGEN_ERROR("Failed to create: {}", path.string());
+        return false;
+      }
 
-    // Write functions for this file
-    size_t start_idx = file_idx * REXCVAR_GET(functions_per_file);
-    size_t end_idx = std::min(start_idx + REXCVAR_GET(functions_per_file), func_list.size());
+      out << "//=============================================================================\n";
+      out << fmt::format("// ReXGlue Generated - {} Recompiled Functions ({}Part {})\n",
+                         config_.project_name, *name_infix ? "Hot " : "", file_idx);
+      out << "//=============================================================================\n\n";
+      out << fmt::format("#include \"{}_init.h\"\n\n", config_.project_name);
 
-    for (size_t i = start_idx; i < end_idx; ++i) {
-      const auto& func = *func_list[i];
-      out << get_function_definition(func);
-      out << "\n";
+      // Write functions for this file
+      for (const auto* func : units[file_idx]) {
+        out << get_function_definition(*func);
+        out << "\n";
+      }
+
+      generated_files_.push_back(filename);
+      if (file_names)
+        file_names->push_back(filename);
     }
+    return true;
+  };
+
+  // Profile-guided splitting: functions at or above the hot call-count
+  // threshold go to dedicated "hot" units so write_cmake can hand the two
+  // groups different optimization levels.
+  std::vector<const CompiledFunction*> hot, cold;
+  if (config_.profile && !config_.profile->empty()) {
+    for (const auto* func : func_list) {
+      auto it = config_.profile->find(static_cast<uint32_t>(func->address));
+      bool is_hot = it != config_.profile->end() && it->second >= config_.hot_min_count;
+      (is_hot ? hot : cold).push_back(func);
+    }
+  }
 
-    generated_files_.push_back(filename);
+  hot_files_.clear();
+  cold_files_.clear();
+
+  if (hot.empty() || cold.empty()) {
+    // No profile (or it covers everything/nothing) - single uniform group
+    if (!write_units(pack_units(std::move(func_list), num_files), "", nullptr))
+      return false;
+    REXCODEGEN_INFO("  Generated {} function files", num_files);
+    return true;
   }
 
-  REXCODEGEN_INFO("  Generated {} function files", num_files);
+  // Split the unit budget by each group's share of emitted bytes
+  size_t total_bytes = 0, hot_bytes = 0;
+  for (const auto* func : func_list)
+    total_bytes += func->cpp_code.size();
+  for (const auto* func : hot)
+    hot_bytes += func->cpp_code.size();
+
+  size_t hot_units = std::clamp<size_t>(num_files * hot_bytes / std::max<size_t>(total_bytes, 1),
+                                        1, hot.size());
+  size_t cold_units = std::clamp<size_t>(num_files - hot_units, 1, cold.size());
+  size_t hot_count = hot.size();
+
+  if (!write_units(pack_units(std::move(hot), hot_units), "hot.", &hot_files_) ||
+      !write_units(pack_units(std::move(cold), cold_units), "", &cold_files_))
+    return false;
+
+  REXCODEGEN_INFO("  Generated {} hot + {} cold function files ({} hot functions)", hot_units,
+                  cold_units, hot_count);
   return true;
 }
 
@@ -294,15 +475,9 @@ bool RecompilerOutput::write_init(const std::filesystem::path& dir) {
   out << "    }\n";
   out << "    auto* processor = runtime->processor();\n\n";
 
-  out << "    // Register ALL functions from unified PPCFuncMappings array\n";
-  out << "    // This includes both recompiled functions and import thunks\n";
-  out << "    for (int i = 0; PPCFuncMappings[i].guest != 0; ++i) {\n";
-  out << "        if (PPCFuncMappings[i].host != nullptr) {\n";
-  out << "            processor->SetFunction(\n";
-  out << "                static_cast<uint32_t>(PPCFuncMappings[i].guest),\n";
-  out << "                PPCFuncMappings[i].host);\n";
-  out << "        }\n";
-  out << "    }\n";
+  out << "    // Register ALL functions from the unified PPCFuncMappings array\n";
+  out << "    // (recompiled functions and import thunks) in one bulk pass\n";
+  out << "    processor->SetFunctions(PPCFuncMappings);\n";
   out << "}\n";
 
   generated_files_.push_back(filename);
@@ -356,6 +531,30 @@ bool RecompilerOutput::write_cmake(const std::filesystem::path& dir) {
   }
   out << ")\n\n";
 
+  // Profile-guided optimization levels: hot units get full optimization,
+  // cold units trade runtime for host compile time
+  if (!hot_files_.empty() && !cold_files_.empty()) {
+    out << "# Profile-guided optimization levels (from codegen profile)\n";
+    out << "set_source_files_properties(\n";
+    for (const auto& file : hot_files_)
+      out << fmt::format("    {}\n", file);
+    out << "    PROPERTIES COMPILE_OPTIONS \"-O3\")\n";
+    out << "set_source_files_properties(\n";
+    for (const auto& file : cold_files_)
+      out << fmt::format("    {}\n", file);
+    out << "    PROPERTIES COMPILE_OPTIONS \"-O1\")\n\n";
+  }
+
+  if (config_.unity_batch_size > 1) {
+    out << "# Unity groups: small generated units share one host compiler invocation,\n";
+    out << "# so the runtime headers are parsed once per batch instead of once per file.\n";
+    out << "# CMake excludes files carrying per-source compile options (the hot/cold\n";
+    out << "# optimization split above) from the groups - those still build alone.\n";
+    out << fmt::format("set_target_properties({} PROPERTIES\n", lib_name);
+    out << "    UNITY_BUILD ON\n";
+    out << fmt::format("    UNITY_BUILD_BATCH_SIZE {})\n\n", config_.unity_batch_size);
+  }
+
   out << fmt::format("target_include_directories({} PUBLIC ${{CMAKE_CURRENT_SOURCE_DIR}})\n\n",
                      lib_name);
 
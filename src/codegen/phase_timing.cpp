@@ -0,0 +1,169 @@
+/**
+ * @file        rexcodegen/phase_timing.cpp
+ *
+ * @copyright   Copyright (c) 2026 Tom Clay <tomc@tctechstuff.com>
+ *              All rights reserved.
+ *
+ * @license     BSD 3-Clause License
+ *              See LICENSE file in the project root for full license text.
+ */
+
+#include <algorithm>
+#include <cstdio>
+
+#include <fmt/format.h>
+
+#include <rex/codegen/phase_timing.h>
+#include <rex/platform.h>
+
+#if REX_PLATFORM_WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace rex::codegen {
+
+PhaseTimings::PhaseTimings(PhaseTimings&& other) noexcept
+    : phases_(std::move(other.phases_)),
+      functions_(std::move(other.functions_)),
+      functionCount_(other.functionCount_),
+      instructionCount_(other.instructionCount_) {}
+
+PhaseTimings& PhaseTimings::operator=(PhaseTimings&& other) noexcept {
+  if (this != &other) {
+    phases_ = std::move(other.phases_);
+    functions_ = std::move(other.functions_);
+    functionCount_ = other.functionCount_;
+    instructionCount_ = other.instructionCount_;
+  }
+  return *this;
+}
+
+void PhaseTimings::recordPhase(std::string_view name, double ms) {
+  phases_.push_back(Phase{std::string(name), ms});
+}
+
+void PhaseTimings::recordFunction(uint32_t address, double ms, size_t emittedBytes,
+                                  uint32_t guestBytes) {
+  std::lock_guard lock(mutex_);
+  functions_.push_back(FunctionTime{address, ms, emittedBytes, guestBytes});
+}
+
+void PhaseTimings::setCounters(size_t functionCount, size_t instructionCount) {
+  functionCount_ = functionCount;
+  instructionCount_ = instructionCount;
+}
+
+size_t PhaseTimings::QueryPeakRssKb() {
+#if REX_PLATFORM_WIN32
+  PROCESS_MEMORY_COUNTERS counters = {};
+  counters.cb = sizeof(counters);
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+    return 0;
+  }
+  return static_cast<size_t>(counters.PeakWorkingSetSize / 1024);
+#else
+  struct rusage usage = {};
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+#if REX_PLATFORM_MAC
+  // ru_maxrss is bytes on macOS, KiB elsewhere.
+  return static_cast<size_t>(usage.ru_maxrss / 1024);
+#else
+  return static_cast<size_t>(usage.ru_maxrss);
+#endif
+#endif
+}
+
+std::string PhaseTimings::report(size_t worstFunctionCount) const {
+  std::lock_guard lock(mutex_);
+
+  double totalMs = 0.0;
+  for (const auto& phase : phases_) {
+    totalMs += phase.ms;
+  }
+
+  std::string out = fmt::format("Codegen timing ({} functions, {} instructions, {:.1f} ms total)\n",
+                                functionCount_, instructionCount_, totalMs);
+  for (const auto& phase : phases_) {
+    double percent = totalMs > 0.0 ? (phase.ms / totalMs) * 100.0 : 0.0;
+    out += fmt::format("  {:<24} {:>10.1f} ms  {:>5.1f}%\n", phase.name, phase.ms, percent);
+  }
+
+  if (size_t peakRssKb = QueryPeakRssKb()) {
+    out += fmt::format("  {:<24} {:>10.1f} MiB\n", "peak RSS", peakRssKb / 1024.0);
+  }
+
+  if (!functions_.empty() && worstFunctionCount > 0) {
+    auto worst = functions_;
+    size_t count = std::min(worstFunctionCount, worst.size());
+    std::partial_sort(worst.begin(), worst.begin() + count, worst.end(),
+                      [](const FunctionTime& a, const FunctionTime& b) { return a.ms > b.ms; });
+
+    out += fmt::format("  Slowest {} of {} recompiled functions:\n", count, worst.size());
+    for (size_t i = 0; i < count; i++) {
+      out += fmt::format("    sub_{:08X} {:>10.2f} ms\n", worst[i].address, worst[i].ms);
+    }
+
+    // Ranked emission sizes: a function emitting megabytes of C++ is the one
+    // that blows up host compile time, whatever its recompile time was
+    const bool haveSizes =
+        std::any_of(worst.begin(), worst.end(),
+                    [](const FunctionTime& f) { return f.emittedBytes != 0; });
+    if (haveSizes) {
+      std::partial_sort(
+          worst.begin(), worst.begin() + count, worst.end(),
+          [](const FunctionTime& a, const FunctionTime& b) { return a.emittedBytes > b.emittedBytes; });
+
+      out += fmt::format("  Largest {} functions by emitted C++:\n", count);
+      for (size_t i = 0; i < count; i++) {
+        const auto& fn = worst[i];
+        const double expansion =
+            fn.guestBytes ? static_cast<double>(fn.emittedBytes) / fn.guestBytes : 0.0;
+        out += fmt::format("    sub_{:08X} {:>9.1f} KiB  (x{:.0f} of {} guest bytes)\n", fn.address,
+                           fn.emittedBytes / 1024.0, expansion, fn.guestBytes);
+      }
+    }
+  }
+
+  return out;
+}
+
+bool PhaseTimings::writeJson(const std::filesystem::path& path) const {
+  std::lock_guard lock(mutex_);
+
+  FILE* f = fopen(path.string().c_str(), "w");
+  if (f == nullptr) {
+    return false;
+  }
+
+  fprintf(f, "{\n");
+  fprintf(f, "  \"functions\": %zu,\n", functionCount_);
+  fprintf(f, "  \"instructions\": %zu,\n", instructionCount_);
+  fprintf(f, "  \"peak_rss_kb\": %zu,\n", QueryPeakRssKb());
+
+  fprintf(f, "  \"phases\": [\n");
+  for (size_t i = 0; i < phases_.size(); i++) {
+    fprintf(f, "    {\"name\": \"%s\", \"ms\": %.3f}%s\n", phases_[i].name.c_str(), phases_[i].ms,
+            i + 1 < phases_.size() ? "," : "");
+  }
+  fprintf(f, "  ],\n");
+
+  fprintf(f, "  \"function_times\": [\n");
+  for (size_t i = 0; i < functions_.size(); i++) {
+    fprintf(f, "    {\"address\": \"0x%08X\", \"ms\": %.3f, \"emitted_bytes\": %zu, "
+            "\"guest_bytes\": %u}%s\n",
+            functions_[i].address, functions_[i].ms, functions_[i].emittedBytes,
+            functions_[i].guestBytes, i + 1 < functions_.size() ? "," : "");
+  }
+  fprintf(f, "  ]\n");
+  fprintf(f, "}\n");
+
+  fclose(f);
+  return true;
+}
+
+}  // namespace rex::codegen
@@ -14,18 +14,24 @@
 #include "builder_context.h"
 #include <rex/platform.h>
 #include "builders.h"
+#include "builders/helpers.h"
 #include "codegen_flags.h"
 #include "ppc/disasm.h"
 
+#include <atomic>
+#include <cctype>
+#include <chrono>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <filesystem>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 
@@ -92,7 +98,8 @@ Recompiler::~Recompiler() = default;
 bool Recompiler::recompile(const FunctionNode& fn, uint32_t base, const ppc_insn& insn,
                            const uint32_t* data,
                            std::unordered_map<uint32_t, JumpTable>::iterator& switchTable,
-                           RecompilerLocalVariables& localVariables, CSRState& csrState) {
+                           RecompilerLocalVariables& localVariables, CSRState& csrState,
+                           CSRLabelStates& csrLabels) {
   println("\t// {} {}", insn.opcode->name, insn.op_str);
 
   // TODO: we could cache these formats in an array
@@ -222,8 +229,9 @@ bool Recompiler::recompile(const FunctionNode& fn, uint32_t base, const ppc_insn
       println("\t\treturn;");
       println("\t}}");
     } else {
-      println("\tif ({}{}.{}) goto loc_{:X};", not_ ? "!" : "", cr(insn.operands[0]), cond,
-              insn.operands[1]);
+      csrLabels.recordEdge(insn.operands[1], csrState);
+      println("\tif ({}{}.{}){} goto loc_{:X};", not_ ? "!" : "", cr(insn.operands[0]), cond,
+              branchTakenHint(config(), base, insn.operands[1]), insn.operands[1]);
     }
   };
 
@@ -326,7 +334,8 @@ bool Recompiler::recompile(const FunctionNode& fn, uint32_t base, const ppc_insn
     id = PPC_INST_VUPKLSH128;
 
   // Create builder context and dispatch to appropriate builder
-  BuilderContext ctx{*this, fn, insn, base, data, localVariables, csrState, switchTable};
+  BuilderContext ctx{*this,          fn,       insn,      base,       data,
+                     localVariables, csrState, csrLabels, switchTable};
 
   if (!DispatchInstruction(id, ctx))
     return false;
@@ -346,6 +355,340 @@ bool Recompiler::recompile(const FunctionNode& fn, uint32_t base, const ppc_insn
   return true;
 }
 
+namespace {
+
+/**
+ * Decide whether a register local needs its value loaded from the context at
+ * function entry. Scans the emitted body for the first whole-word use of
+ * `name`: when that use is a full overwrite that execution cannot branch
+ * around (no label, goto, return or conditional before it), the incoming
+ * value is dead and zero-initialization is enough. Anything ambiguous keeps
+ * the load.
+ */
+bool localNeedsContextLoad(const std::string& body, const std::string& name) {
+  auto isWordChar = [](char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+  };
+
+  // Whole-word search; a '.' before the match means "ctx.rN", not the local.
+  auto findWholeWord = [&](size_t from, size_t to) -> size_t {
+    size_t pos = from;
+    while (pos < to && (pos = body.find(name, pos)) != std::string::npos && pos < to) {
+      char prev = pos > 0 ? body[pos - 1] : '\n';
+      char next = pos + name.size() < body.size() ? body[pos + name.size()] : '\n';
+      if (!isWordChar(prev) && prev != '.' && !isWordChar(next))
+        return pos;
+      pos++;
+    }
+    return std::string::npos;
+  };
+
+  size_t pos = findWholeWord(0, body.size());
+  if (pos == std::string::npos)
+    return false;  // Declared but never referenced in the body
+
+  // The overwrite must dominate the rest of the function: any control
+  // transfer before it could let execution reach a later read first.
+  static constexpr std::string_view kControlFlow[] = {"goto ", "\treturn", "\tif ", "loc_"};
+  for (auto marker : kControlFlow) {
+    size_t at = body.find(marker);
+    if (at != std::string::npos && at < pos)
+      return true;
+  }
+
+  size_t lineEnd = body.find('\n', pos);
+  if (lineEnd == std::string::npos)
+    lineEnd = body.size();
+  size_t lineStart = body.rfind('\n', pos);
+  lineStart = lineStart == std::string::npos ? 0 : lineStart + 1;
+
+  std::string_view line(body.data() + lineStart, lineEnd - lineStart);
+  std::string_view tail(body.data() + pos + name.size(), lineEnd - (pos + name.size()));
+
+  // "\trN.u64 = ..." style whole-register assignments; cr.compare() rewrites
+  // every CR field. Narrower field stores keep the old bits and count as reads.
+  bool fullWrite = pos == lineStart + 1 && body[lineStart] == '\t' &&
+                   (tail.starts_with(".u64 = ") || tail.starts_with(".s64 = ") ||
+                    tail.starts_with(".f64 = ") || tail.starts_with(".compare"));
+
+  // simde_mm_store_xx(vN.f32, ...) overwrites the whole vector register when
+  // the local is the destination (first argument).
+  if (!fullWrite && line.starts_with("\tsimde_mm_store")) {
+    size_t comma = line.find(',');
+    if (comma != std::string_view::npos && pos - lineStart < comma)
+      fullWrite = true;
+  }
+
+  if (!fullWrite)
+    return true;
+
+  // The overwrite must not also read the register ("r4.u64 = r4.u64 + 1").
+  return findWholeWord(pos + name.size(), lineEnd) != std::string::npos;
+}
+
+}  // namespace
+
+bool Recompiler::tryFoldImmediatePair(uint32_t base, uint32_t end, const ppc_insn& lis,
+                                      const uint32_t* data,
+                                      const std::unordered_set<size_t>& labels,
+                                      RecompilerLocalVariables& localVariables) {
+  // The pair must live in the same block and the second instruction must not
+  // be reachable on its own - a label or hook there means something jumps in
+  // between the two halves.
+  if (base + 8 > end)
+    return false;
+  if (labels.find(base + 4) != labels.end())
+    return false;
+  if (config().midAsmHooks.find(base) != config().midAsmHooks.end() ||
+      config().midAsmHooks.find(base + 4) != config().midAsmHooks.end())
+    return false;
+
+  ppc_insn next;
+  Disassemble(data + 1, 4, base + 4, next);
+  if (next.opcode == nullptr)
+    return false;
+
+  size_t dest = lis.operands[0];
+  uint32_t upper = static_cast<uint32_t>(lis.operands[1]);
+  int64_t value;
+
+  if (next.opcode->id == PPC_INST_ADDI && next.operands[0] == dest && next.operands[1] == dest &&
+      dest != 0) {
+    // dest != 0: addi with rA=0 reads the literal zero, not r0, so the lis
+    // result would be discarded rather than combined.
+    value = static_cast<int64_t>(static_cast<int32_t>(upper << 16)) +
+            static_cast<int32_t>(next.operands[2]);
+  } else if (next.opcode->id == PPC_INST_ORI && next.operands[0] == dest &&
+             next.operands[1] == dest) {
+    value = static_cast<int32_t>((upper << 16) | static_cast<uint32_t>(next.operands[2]));
+  } else {
+    return false;
+  }
+
+  println("\t// {} {}", lis.opcode->name, lis.op_str);
+  println("\t// {} {}", next.opcode->name, next.op_str);
+  println("\t{}.s64 = {};", gprName(dest, localVariables), value);
+
+  // lis decides the MMIO base flag; addi/ori on the same register keep it.
+  if (isMMIOUpperBits(upper))
+    localVariables.set_mmio_base(dest);
+  else
+    localVariables.clear_mmio_base(dest);
+
+  return true;
+}
+
+bool Recompiler::tryFoldLoadStoreCopy(uint32_t base, uint32_t end, const ppc_insn& load,
+                                      const uint32_t* data,
+                                      const std::unordered_set<size_t>& labels,
+                                      RecompilerLocalVariables& localVariables) {
+  const char* macro = nullptr;
+  int storeId = 0;
+  switch (load.opcode->id) {
+    case PPC_INST_LHZ:
+      storeId = PPC_INST_STH;
+      macro = "PPC_COPY_U16";
+      break;
+    case PPC_INST_LWZ:
+      storeId = PPC_INST_STW;
+      macro = "PPC_COPY_U32";
+      break;
+    case PPC_INST_LD:
+      storeId = PPC_INST_STD;
+      macro = "PPC_COPY_U64";
+      break;
+    default:
+      return false;
+  }
+
+  // Need the store plus one more instruction that overwrites the register,
+  // with nothing able to enter or hook in between.
+  if (base + 12 > end)
+    return false;
+  if (labels.count(base + 4) || labels.count(base + 8))
+    return false;
+  if (config().midAsmHooks.find(base) != config().midAsmHooks.end() ||
+      config().midAsmHooks.find(base + 4) != config().midAsmHooks.end() ||
+      config().midAsmHooks.find(base + 8) != config().midAsmHooks.end())
+    return false;
+
+  ppc_insn store, next;
+  Disassemble(data + 1, 4, base + 4, store);
+  Disassemble(data + 2, 4, base + 8, next);
+  if (store.opcode == nullptr || next.opcode == nullptr)
+    return false;
+
+  size_t rt = load.operands[0];
+  if (store.opcode->id != storeId || store.operands[0] != rt)
+    return false;
+
+  // The store's EA must not involve rt: hardware computes it from the newly
+  // loaded value, but the fold would read the stale pre-load register.
+  if (store.operands[2] == rt)
+    return false;
+
+  // MMIO base addresses need the dispatching PPC_MM_* macros - leave alone.
+  if (localVariables.is_mmio_base(load.operands[2]) ||
+      localVariables.is_mmio_base(store.operands[2]))
+    return false;
+
+  // The next instruction must fully overwrite rt without reading it, so the
+  // skipped (byte-swapped) register value is never observed.
+  switch (next.opcode->id) {
+    case PPC_INST_LI:
+    case PPC_INST_LIS:
+      if (next.operands[0] != rt)
+        return false;
+      break;
+    case PPC_INST_LBZ:
+    case PPC_INST_LHZ:
+    case PPC_INST_LWZ:
+    case PPC_INST_LD:
+      if (next.operands[0] != rt || next.operands[2] == rt)
+        return false;
+      break;
+    default:
+      return false;
+  }
+
+  // D-form effective address: rA + D, with rA=0 reading the literal zero
+  auto ea = [&](const ppc_insn& insn) {
+    if (insn.operands[2] != 0)
+      return fmt::format("{}.u32 + {}", gprName(insn.operands[2], localVariables),
+                         static_cast<int32_t>(insn.operands[1]));
+    return fmt::format("{}", static_cast<int32_t>(insn.operands[1]));
+  };
+
+  println("\t// {} {}", load.opcode->name, load.op_str);
+  println("\t// {} {}", store.opcode->name, store.op_str);
+  println("\t{}({}, {});", macro, ea(store), ea(load));
+  return true;
+}
+
+bool Recompiler::tryFoldCompareBranch(const FunctionNode& fn, uint32_t base, uint32_t end,
+                                      const ppc_insn& cmp, const uint32_t* data,
+                                      const std::unordered_set<size_t>& labels,
+                                      RecompilerLocalVariables& localVariables, CSRState& csrState,
+                                      CSRLabelStates& csrLabels) {
+  const char* field;
+  bool immediate;
+  bool signedImm = false;
+  switch (cmp.opcode->id) {
+    case PPC_INST_CMPD:
+      field = "s64";
+      immediate = false;
+      break;
+    case PPC_INST_CMPDI:
+      field = "s64";
+      immediate = signedImm = true;
+      break;
+    case PPC_INST_CMPLD:
+      field = "u64";
+      immediate = false;
+      break;
+    case PPC_INST_CMPLDI:
+      field = "u64";
+      immediate = true;
+      break;
+    case PPC_INST_CMPLW:
+      field = "u32";
+      immediate = false;
+      break;
+    case PPC_INST_CMPLWI:
+      field = "u32";
+      immediate = true;
+      break;
+    case PPC_INST_CMPW:
+      field = "s32";
+      immediate = false;
+      break;
+    case PPC_INST_CMPWI:
+      field = "s32";
+      immediate = signedImm = true;
+      break;
+    default:
+      return false;
+  }
+
+  // Analysis must have proven the field has no consumer beyond an adjacent
+  // branch, otherwise the four field bits have to be materialized.
+  size_t crField = cmp.operands[0];
+  if (!fn.crFieldFusible(crField))
+    return false;
+
+  // The pair must live in the same block and the branch must not be
+  // reachable on its own - a label or hook there means something jumps in
+  // between the two halves.
+  if (base + 8 > end)
+    return false;
+  if (labels.find(base + 4) != labels.end())
+    return false;
+  if (config().midAsmHooks.find(base) != config().midAsmHooks.end() ||
+      config().midAsmHooks.find(base + 4) != config().midAsmHooks.end())
+    return false;
+
+  ppc_insn branch;
+  Disassemble(data + 1, 4, base + 4, branch);
+  if (branch.opcode == nullptr || branch.operands[0] != crField)
+    return false;
+
+  const char* op;
+  switch (branch.opcode->id) {
+    case PPC_INST_BEQ:
+      op = "==";
+      break;
+    case PPC_INST_BNE:
+      op = "!=";
+      break;
+    case PPC_INST_BLT:
+      op = "<";
+      break;
+    case PPC_INST_BGE:
+      op = ">=";
+      break;
+    case PPC_INST_BGT:
+      op = ">";
+      break;
+    case PPC_INST_BLE:
+      op = "<=";
+      break;
+    default:
+      return false;
+  }
+
+  // Only plain local jumps fuse; branches that leave the function go through
+  // the regular builder so call classification stays in one place.
+  uint32_t target = branch.operands[1];
+  if (graph().classifyTarget(target, base + 4, false) != TargetKind::InternalLabel)
+    return false;
+
+  std::string lhs = fmt::format("{}.{}", gprName(cmp.operands[1], localVariables), field);
+  std::string rhs;
+  if (immediate) {
+    rhs = signedImm ? fmt::format("{}", static_cast<int32_t>(cmp.operands[2]))
+                    : fmt::format("{}", cmp.operands[2]);
+  } else {
+    rhs = fmt::format("{}.{}", gprName(cmp.operands[2], localVariables), field);
+  }
+
+  println("\t// {} {}", cmp.opcode->name, cmp.op_str);
+  println("\t// {} {}", branch.opcode->name, branch.op_str);
+  csrLabels.recordEdge(target, csrState);
+  println("\tif ({} {} {}){} goto loc_{:X};", lhs, op, rhs,
+          branchTakenHint(config(), base + 4, target), target);
+  return true;
+}
+
+std::string Recompiler::gprName(size_t index, RecompilerLocalVariables& localVariables) {
+  if ((config().nonArgumentRegistersAsLocalVariables &&
+       (index == 0 || index == 2 || index == 11 || index == 12)) ||
+      (config().nonVolatileRegistersAsLocalVariables && index >= 14)) {
+    localVariables.r[index] = true;
+    return fmt::format("r{}", index);
+  }
+  return fmt::format("ctx.r{}", index);
+}
+
 bool Recompiler::recompile(const FunctionNode& fn) {
   // Iterate over discovered blocks, not raw address range
   // This ensures we only process actual code, not PDATA/metadata
@@ -388,6 +731,9 @@ bool Recompiler::recompile(const FunctionNode& fn) {
   std::unordered_set<size_t> labels;
   labels.reserve(64);  // Pre-allocate for typical function
 
+  // Per-label CSR state bookkeeping for the second pass (see CSRLabelStates)
+  CSRLabelStates csrLabels;
+
   // First pass: collect labels from all blocks
   for (const auto& block : fn.blocks()) {
     auto* blockData = reinterpret_cast<const uint32_t*>(binary().translate(block.base));
@@ -399,16 +745,34 @@ bool Recompiler::recompile(const FunctionNode& fn) {
           load_and_swap<uint32_t>((const uint8_t*)blockData + addr - block.base);
       if (!PPC_BL(instruction)) {
         const size_t op = PPC_OP(instruction);
-        if (op == PPC_OP_B)
-          labels.emplace(addr + PPC_BI(instruction));
-        else if (op == PPC_OP_BC)
-          labels.emplace(addr + PPC_BD(instruction));
+        if (op == PPC_OP_B || op == PPC_OP_BC) {
+          const size_t target =
+              op == PPC_OP_B ? addr + PPC_BI(instruction) : addr + PPC_BD(instruction);
+          labels.emplace(target);
+
+          // Count forward branches so the second pass can tell when every
+          // incoming CSR state is known; backward targets (loop heads) always
+          // land with unknown state.
+          if (target > addr)
+            ++csrLabels.expectedEdges[target];
+          else
+            csrLabels.unsafe.insert(target);
+        }
+      } else if (PPC_OP(instruction) == PPC_OP_B) {
+        // A PIC-style bl inside the function becomes a plain goto during
+        // emission without being counted above, so its landing label cannot
+        // keep a tracked CSR state.
+        const size_t target = addr + PPC_BI(instruction);
+        if (target >= fn.base() && target < fn.end())
+          csrLabels.unsafe.insert(target);
       }
 
-      auto switchTable = config().switchTables.find(addr);
-      if (switchTable != config().switchTables.end()) {
-        for (auto label : switchTable->second.targets)
+      auto switchTable = switchTables().find(addr);
+      if (switchTable != switchTables().end()) {
+        for (auto label : switchTable->second.targets) {
           labels.emplace(label);
+          csrLabels.unsafe.insert(label);
+        }
       }
 
       auto midAsmHook = config().midAsmHooks.find(addr);
@@ -457,12 +821,18 @@ bool Recompiler::recompile(const FunctionNode& fn) {
 
         println(");\n");
 
-        if (midAsmHook->second.jumpAddress != 0)
+        if (midAsmHook->second.jumpAddress != 0) {
           labels.emplace(midAsmHook->second.jumpAddress);
-        if (midAsmHook->second.jumpAddressOnTrue != 0)
+          csrLabels.unsafe.insert(midAsmHook->second.jumpAddress);
+        }
+        if (midAsmHook->second.jumpAddressOnTrue != 0) {
           labels.emplace(midAsmHook->second.jumpAddressOnTrue);
-        if (midAsmHook->second.jumpAddressOnFalse != 0)
+          csrLabels.unsafe.insert(midAsmHook->second.jumpAddressOnTrue);
+        }
+        if (midAsmHook->second.jumpAddressOnFalse != 0) {
           labels.emplace(midAsmHook->second.jumpAddressOnFalse);
+          csrLabels.unsafe.insert(midAsmHook->second.jumpAddressOnFalse);
+        }
       }
     }
   }
@@ -471,6 +841,7 @@ bool Recompiler::recompile(const FunctionNode& fn) {
   for (const auto& jt : fn.jumpTables()) {
     for (auto label : jt.targets) {
       labels.emplace(label);
+      csrLabels.unsafe.insert(label);
     }
   }
 
@@ -496,8 +867,11 @@ bool Recompiler::recompile(const FunctionNode& fn) {
 #endif
   println("PPC_FUNC_IMPL(__imp__{}) {{", name);
   println("\tPPC_FUNC_PROLOGUE();");
+  if (config().emitFunctionCounters) {
+    println("\tPPC_FUNC_COUNTER(0x{:X});", fn.base());
+  }
 
-  auto switchTable = config().switchTables.end();
+  auto switchTable = switchTables().end();
   bool allRecompiled = true;
   CSRState csrState = CSRState::Unknown;
 
@@ -525,12 +899,14 @@ bool Recompiler::recompile(const FunctionNode& fn) {
       if (labels.find(base) != labels.end() && emittedLabels.insert(base).second) {
         println("loc_{:X}:", base);
 
-        // Anyone could jump to this label so we wouldn't know what the CSR state would be.
-        csrState = CSRState::Unknown;
+        // Anyone could jump to this label so we wouldn't know what the CSR state
+        // would be - unless every incoming edge is a forward branch that was
+        // emitted with the same state the fall-through path carries here.
+        csrState = csrLabels.stateAtLabel(base, csrState);
       }
 
-      if (switchTable == config().switchTables.end())
-        switchTable = config().switchTables.find(base);
+      if (switchTable == switchTables().end())
+        switchTable = switchTables().find(base);
 
       Disassemble(data, 4, base, insn);
 
@@ -540,8 +916,36 @@ bool Recompiler::recompile(const FunctionNode& fn) {
         if (*data != 0)
           REXCODEGEN_WARN("Unable to decode instruction {:X} at {:X}", *data, base);
       } else {
+        // Constant-propagation peephole: lis+addi / lis+ori pairs become one
+        // assignment with the combined immediate.
+        if (config().foldImmediatePairs && insn.opcode->id == PPC_INST_LIS &&
+            tryFoldImmediatePair(base, end, insn, data, labels, localVariables)) {
+          base += 8;
+          data += 2;
+          continue;
+        }
+
+        // Swap-elimination peephole: a load whose value is stored straight
+        // back to guest memory becomes a raw byte-order-preserving copy.
+        if (config().foldLoadStoreCopies &&
+            tryFoldLoadStoreCopy(base, end, insn, data, labels, localVariables)) {
+          base += 8;
+          data += 2;
+          continue;
+        }
+
+        // Fusion peephole: a compare whose CR field has no consumer beyond
+        // the adjacent branch becomes one host compare-and-jump.
+        if (config().fuseCompareBranches &&
+            tryFoldCompareBranch(fn, base, end, insn, data, labels, localVariables, csrState,
+                                 csrLabels)) {
+          base += 8;
+          data += 2;
+          continue;
+        }
+
         // Check for potential jump table that wasn't detected during analysis
-        if (insn.opcode->id == PPC_INST_BCTR && switchTable == config().switchTables.end() &&
+        if (insn.opcode->id == PPC_INST_BCTR && switchTable == switchTables().end() &&
             ctx_ != nullptr) {
           // Look for mtctr within 3 instructions before bctr
           // mtctr rX = 0x7CXX03A6 (where XX = RS << 5)
@@ -571,14 +975,18 @@ bool Recompiler::recompile(const FunctionNode& fn) {
           if (is_switch_pattern) {
             // Try to detect jump table
             FunctionScanner scanner(binary());
+            if (ctx_->hasDecoded()) {
+              scanner.setDecodedBinary(&ctx_->decoded());
+            }
             auto jt_opt = scanner.detect_jump_table(base);
             if (jt_opt.has_value()) {
               // Add to config and use it
-              config().switchTables.emplace(base, std::move(*jt_opt));
-              switchTable = config().switchTables.find(base);
+              switchTables().emplace(base, std::move(*jt_opt));
+              switchTable = switchTables().find(base);
               // Also add labels for code generation
               for (auto label : switchTable->second.targets) {
                 labels.emplace(label);
+                csrLabels.unsafe.insert(label);
               }
               REXCODEGEN_INFO("Late-detected jump table at 0x{:08X} with {} entries", base,
                               switchTable->second.targets.size());
@@ -587,7 +995,7 @@ bool Recompiler::recompile(const FunctionNode& fn) {
           }
         }
 
-        if (!recompile(fn, base, insn, data, switchTable, localVariables, csrState)) {
+        if (!recompile(fn, base, insn, data, switchTable, localVariables, csrState, csrLabels)) {
           REXCODEGEN_WARN("Unrecognized instruction at 0x{:X}: {}", base, insn.opcode->name);
           allRecompiled = false;
         }
@@ -643,31 +1051,41 @@ bool Recompiler::recompile(const FunctionNode& fn) {
   // Swap back: tempString now has function body, out restored to pre-function state
   // Now write local variable declarations to out, then append the body
   std::swap(out, tempString);
+
+  // Live-in locals load their context value at entry; write-first locals keep
+  // the cheap zero-initialization and skip the context traffic entirely.
+  auto declareLocal = [&](std::string_view type, const std::string& name) {
+    if (localNeedsContextLoad(tempString, name))
+      println("\t{} {} = ctx.{};", type, name, name);
+    else
+      println("\t{} {}{{}};", type, name);
+  };
+
   if (localVariables.ctr)
-    println("\tPPCRegister ctr{{}};");
+    declareLocal("PPCRegister", "ctr");
   if (localVariables.xer)
-    println("\tPPCXERRegister xer{{}};");
+    declareLocal("PPCXERRegister", "xer");
   if (localVariables.reserved)
-    println("\tPPCRegister reserved{{}};");
+    declareLocal("PPCRegister", "reserved");
 
   for (size_t i = 0; i < 8; i++) {
     if (localVariables.cr[i])
-      println("\tPPCCRRegister cr{}{{}};", i);
+      declareLocal("PPCCRRegister", fmt::format("cr{}", i));
   }
 
   for (size_t i = 0; i < 32; i++) {
     if (localVariables.r[i])
-      println("\tPPCRegister r{}{{}};", i);
+      declareLocal("PPCRegister", fmt::format("r{}", i));
   }
 
   for (size_t i = 0; i < 32; i++) {
     if (localVariables.f[i])
-      println("\tPPCRegister f{}{{}};", i);
+      declareLocal("PPCRegister", fmt::format("f{}", i));
   }
 
   for (size_t i = 0; i < 128; i++) {
     if (localVariables.v[i])
-      println("\tPPCVRegister v{}{{}};", i);
+      declareLocal("PPCVRegister", fmt::format("v{}", i));
   }
 
   if (localVariables.env)
@@ -720,7 +1138,7 @@ bool Recompiler::recompile(bool force) {
   std::vector<const FunctionNode*> functions;
   functions.reserve(graph().functionCount());
   for (const auto& [addr, node] : graph().functions()) {
-    functions.push_back(node.get());
+    functions.push_back(node);
   }
   std::sort(functions.begin(), functions.end(),
             [](const auto* a, const auto* b) { return a->base() < b->base(); });
@@ -753,6 +1171,8 @@ bool Recompiler::recompile(bool force) {
       println("#define PPC_CONFIG_NON_ARGUMENT_AS_LOCAL");
     if (config().nonVolatileRegistersAsLocalVariables)
       println("#define PPC_CONFIG_NON_VOLATILE_AS_LOCAL");
+    if (config().volatileMemoryAccess)
+      println("#define PPC_CONFIG_VOLATILE_MEMORY");
 
     println("");
 
@@ -873,18 +1293,153 @@ bool Recompiler::recompile(bool force) {
     return fn->authority() == FunctionAuthority::IMPORT;
   });
 
+  const size_t functionsPerFile = REXCVAR_GET(functions_per_file);
+
+  // Chunk layout: sequential runs of functions_per_file functions, except that
+  // functions past isolateFunctionThreshold guest bytes get a chunk (and thus
+  // a TU) of their own so one pathological function stops serializing the
+  // host build of everything packed next to it.
+  std::vector<std::pair<size_t, size_t>> chunkRanges;
+  {
+    const uint32_t isolateThreshold = config().isolateFunctionThreshold;
+    size_t first = 0;
+    for (size_t i = 0; i < functions.size(); i++) {
+      if (isolateThreshold != 0 && functions[i]->size() >= isolateThreshold) {
+        if (first < i)
+          chunkRanges.emplace_back(first, i);
+        chunkRanges.emplace_back(i, i + 1);
+        first = i + 1;
+      } else if (i + 1 - first == functionsPerFile) {
+        chunkRanges.emplace_back(first, i + 1);
+        first = i + 1;
+      }
+    }
+    if (first < functions.size())
+      chunkRanges.emplace_back(first, functions.size());
+  }
+  const size_t chunkCount = chunkRanges.size();
+
+  size_t jobCount = REXCVAR_GET(jobs);
+  if (jobCount == 0)
+    jobCount = std::thread::hardware_concurrency();
+  jobCount = std::max<size_t>(1, std::min(jobCount, chunkCount));
+
   // TODO: Add fancy single-line progress indicator
-  REXCODEGEN_INFO("Recompiling {} functions...", functions.size());
-  for (size_t i = 0; i < functions.size(); i++) {
-    if ((i % REXCVAR_GET(functions_per_file)) == 0) {
-      SaveCurrentOutData();
+  REXCODEGEN_INFO("Recompiling {} functions ({} chunks, {} jobs)...", functions.size(), chunkCount,
+                  jobCount);
+
+  // Incremental emission: a chunk whose inputs (function bytes + codegen flags)
+  // hash to the same value as last run and whose output file still exists can
+  // be skipped without re-emitting anything.
+  const bool incremental = REXCVAR_GET(incremental);
+  const uint64_t configHash = emissionConfigHash();
+  const std::unordered_map<size_t, uint64_t> previousHashes =
+      incremental ? LoadChunkManifest() : std::unordered_map<size_t, uint64_t>{};
+  std::unordered_map<size_t, uint64_t> currentHashes;
+  currentHashes.reserve(chunkCount);
+  const std::filesystem::path outputPath = ctx_->configDir() / config().outDirectoryPath;
+
+  auto chunkIsCached = [&](size_t chunk, uint64_t hash) {
+    auto it = previousHashes.find(chunk);
+    if (it == previousHashes.end() || it->second != hash)
+      return false;
+    return std::filesystem::exists(outputPath /
+                                   fmt::format("{}_recomp.{}.cpp", projectName, chunk));
+  };
+
+  size_t cachedChunks = 0;
+
+  if (jobCount == 1) {
+    for (size_t chunk = 0; chunk < chunkCount; chunk++) {
+      const auto [first, last] = chunkRanges[chunk];
+
+      const uint64_t hash = chunkInputHash(functions, first, last, configHash);
+      currentHashes.emplace(chunk, hash);
+      if (incremental && chunkIsCached(chunk, hash)) {
+        ++cachedChunks;
+        continue;
+      }
+
       println("#include \"{}_init.h\"\n", projectName);
+      recompileChunk(functions, first, last);
+      SaveCurrentOutData(fmt::format("{}_recomp.{}.cpp", projectName, chunk));
     }
 
-    recompile(*functions[i]);
+    cppFileIndex = chunkCount;
+  } else {
+    // Parallel emission. Function analysis is complete at this point, so every
+    // chunk is independent: workers claim chunks from a shared counter and emit
+    // into their own Recompiler instance, which means shared analysis state is
+    // only ever read. Each worker gets a private copy of the switch tables so
+    // late jump-table detection never mutates the config map mid-run; results
+    // are merged back afterwards. Chunk outputs are collected by index, keeping
+    // the generated files byte-identical to a serial run.
+    std::vector<std::string> chunkOutputs(chunkCount);
+    std::vector<uint8_t> chunkSkipped(chunkCount, 0);
+    std::atomic<size_t> nextChunk{0};
+    std::atomic<size_t> skipCount{0};
+    std::mutex mergeMutex;
+
+    auto workerMain = [&]() {
+      Recompiler worker;
+      worker.ctx_ = ctx_;
+      std::unordered_map<uint32_t, JumpTable> localSwitchTables = config().switchTables;
+      worker.activeSwitchTables_ = &localSwitchTables;
+
+      for (;;) {
+        const size_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+        if (chunk >= chunkCount)
+          break;
+
+        const auto [first, last] = chunkRanges[chunk];
+
+        const uint64_t hash = chunkInputHash(functions, first, last, configHash);
+        {
+          std::lock_guard<std::mutex> lock(mergeMutex);
+          currentHashes.emplace(chunk, hash);
+        }
+        if (incremental && chunkIsCached(chunk, hash)) {
+          chunkSkipped[chunk] = 1;
+          skipCount.fetch_add(1, std::memory_order_relaxed);
+          continue;
+        }
+
+        worker.println("#include \"{}_init.h\"\n", projectName);
+        worker.recompileChunk(functions, first, last);
+
+        chunkOutputs[chunk] = std::move(worker.out);
+        worker.out.clear();
+      }
+
+      // Publish late-detected jump tables so they survive into config dumps.
+      std::lock_guard<std::mutex> lock(mergeMutex);
+      for (auto& [addr, table] : localSwitchTables)
+        config().switchTables.emplace(addr, std::move(table));
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(jobCount);
+    for (size_t i = 0; i < jobCount; i++)
+      workers.emplace_back(workerMain);
+    for (auto& worker : workers)
+      worker.join();
+
+    for (size_t chunk = 0; chunk < chunkCount; chunk++) {
+      if (chunkSkipped[chunk])
+        continue;
+      pendingWrites.emplace_back(fmt::format("{}_recomp.{}.cpp", projectName, chunk),
+                                 std::move(chunkOutputs[chunk]));
+    }
+    cppFileIndex = chunkCount;
+    cachedChunks = skipCount.load(std::memory_order_relaxed);
+  }
+
+  if (incremental) {
+    SaveChunkManifest(currentHashes);
+    if (cachedChunks != 0)
+      REXCODEGEN_INFO("Incremental: reused {} of {} chunks from cache", cachedChunks, chunkCount);
   }
 
-  SaveCurrentOutData();
   REXCODEGEN_INFO("Recompilation complete.");
 
   // Generate sources.cmake for inclusion by parent projects
@@ -912,6 +1467,175 @@ bool Recompiler::recompile(bool force) {
   return true;
 }
 
+void Recompiler::recompileChunk(const std::vector<const FunctionNode*>& functions, size_t first,
+                                size_t last) {
+  for (size_t i = first; i < last; i++) {
+    auto start = std::chrono::steady_clock::now();
+    const size_t emittedBefore = out.size();
+    recompile(*functions[i]);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    const size_t emittedBytes = out.size() - emittedBefore;
+    ctx_->timings.recordFunction(functions[i]->base(),
+                                std::chrono::duration<double, std::milli>(elapsed).count(),
+                                emittedBytes, functions[i]->size());
+    if (config().largeEmissionThreshold != 0 && emittedBytes > config().largeEmissionThreshold) {
+      REXCODEGEN_WARN(
+          "Function {} (0x{:X}) emitted {:.1f} MiB of C++ from {} guest bytes - "
+          "consider isolate_function_threshold to keep it out of shared TUs",
+          functions[i]->name(), functions[i]->base(), emittedBytes / (1024.0 * 1024.0),
+          functions[i]->size());
+    }
+  }
+}
+
+uint64_t Recompiler::emissionConfigHash() const {
+  const auto& cfg = config();
+
+  // Every option that changes emitted bodies must be represented here,
+  // otherwise stale chunks survive a config change.
+  const uint8_t flags[] = {
+      cfg.skipLr,
+      cfg.skipMsr,
+      cfg.ctrAsLocalVariable,
+      cfg.xerAsLocalVariable,
+      cfg.reservedRegisterAsLocalVariable,
+      cfg.crRegistersAsLocalVariables,
+      cfg.nonArgumentRegistersAsLocalVariables,
+      cfg.nonVolatileRegistersAsLocalVariables,
+      cfg.generateExceptionHandlers,
+      cfg.foldImmediatePairs,
+      cfg.foldLoadStoreCopies,
+      cfg.devirtualizeVTableCalls,
+      cfg.skipLrForLeafCalls,
+      cfg.emitTailCalls,
+      cfg.fuseCompareBranches,
+      cfg.emitFunctionCounters,
+      cfg.branchHints,
+      cfg.fastFloatEstimates,
+  };
+  uint64_t hash = XXH3_64bits(flags, sizeof(flags));
+
+  auto mix = [&hash](uint64_t value) {
+    const uint64_t parts[2] = {hash, value};
+    hash = XXH3_64bits(parts, sizeof(parts));
+  };
+
+  mix(cfg.longJmpAddress);
+  mix(cfg.setJmpAddress);
+  mix(cfg.inlineInstructionBudget);
+  mix(cfg.computedGotoMinEntries);
+  mix(cfg.isolateFunctionThreshold);  // changes chunk layout, not bodies
+  mix(REXCVAR_GET(functions_per_file));
+
+  // Bump when the emitter itself changes generated code for an unchanged
+  // config (new peepholes, local variable handling, ...), so cached chunks
+  // from older binaries don't survive an upgrade.
+  constexpr uint64_t kEmitterVersion = 7;
+  mix(kEmitterVersion);
+
+  // Manual overrides change emission per-address; hashing the keys is enough
+  // to invalidate when entries are added or removed.
+  mix(cfg.switchTables.size());
+  for (const auto& [addr, table] : cfg.switchTables)
+    hash ^= XXH3_64bits(&addr, sizeof(addr));
+  mix(cfg.midAsmHooks.size());
+  for (const auto& [addr, hook] : cfg.midAsmHooks)
+    hash ^= XXH3_64bits(&addr, sizeof(addr));
+
+  // Profile contents steer [[unlikely]] placement on conditional tail calls,
+  // so a changed profile must invalidate chunks even with the same flags.
+  mix(cfg.profile.size());
+  for (const auto& [addr, count] : cfg.profile) {
+    const uint64_t parts[2] = {addr, count};
+    hash ^= XXH3_64bits(parts, sizeof(parts));
+  }
+
+  return hash;
+}
+
+uint64_t Recompiler::chunkInputHash(const std::vector<const FunctionNode*>& functions, size_t first,
+                                    size_t last, uint64_t configHash) const {
+  uint64_t hash = configHash;
+
+  auto mix = [&hash](uint64_t value) {
+    const uint64_t parts[2] = {hash, value};
+    hash = XXH3_64bits(parts, sizeof(parts));
+  };
+
+  for (size_t i = first; i < last; i++) {
+    const FunctionNode* fn = functions[i];
+    mix(fn->base());
+    mix(fn->base() == analysisState().entryPoint);
+    hash ^= XXH3_64bits(fn->name().data(), fn->name().size());
+
+    for (const auto& block : fn->blocks()) {
+      const auto* data = binary().translate(block.base);
+      if (!data)
+        continue;
+      mix(block.base);
+      mix(XXH3_64bits(data, block.end() - block.base));
+    }
+
+    // Inlined callee bodies are part of this chunk's output even though
+    // their bytes live in other functions - hash them too so editing a
+    // callee invalidates every caller chunk that absorbed it.
+    if (config().inlineInstructionBudget > 0) {
+      auto mixInlinedCallee = [&](const auto& edge) {
+        if (!edge.target.isFunction())
+          return;
+        const auto* callee = edge.target.asFunction();
+        if (!callee->isInlinable() || callee->blocks().empty())
+          return;
+        const auto& block = callee->blocks().front();
+        if (const auto* data = binary().translate(block.base))
+          mix(XXH3_64bits(data, block.end() - block.base));
+      };
+      for (const auto& edge : fn->calls())
+        mixInlinedCallee(edge);
+      for (const auto& edge : fn->tailCalls())
+        mixInlinedCallee(edge);
+    }
+  }
+
+  return hash;
+}
+
+std::unordered_map<size_t, uint64_t> Recompiler::LoadChunkManifest() const {
+  std::unordered_map<size_t, uint64_t> hashes;
+
+  std::filesystem::path manifestPath = ctx_->configDir() / config().outDirectoryPath /
+                                       fmt::format("{}_recomp.cache", config().projectName);
+  FILE* f = fopen(manifestPath.string().c_str(), "r");
+  if (!f)
+    return hashes;
+
+  size_t chunk = 0;
+  unsigned long long hash = 0;
+  while (fscanf(f, "%zu %llx", &chunk, &hash) == 2)
+    hashes.emplace(chunk, static_cast<uint64_t>(hash));
+  fclose(f);
+
+  REXCODEGEN_TRACE("Loaded incremental manifest with {} chunk hashes", hashes.size());
+  return hashes;
+}
+
+void Recompiler::SaveChunkManifest(const std::unordered_map<size_t, uint64_t>& hashes) const {
+  std::filesystem::path manifestPath = ctx_->configDir() / config().outDirectoryPath /
+                                       fmt::format("{}_recomp.cache", config().projectName);
+  FILE* f = fopen(manifestPath.string().c_str(), "w");
+  if (!f) {
+    REXCODEGEN_WARN("Failed to write incremental manifest: {}", manifestPath.string());
+    return;
+  }
+
+  // Sorted so the manifest diffs cleanly between runs.
+  std::vector<std::pair<size_t, uint64_t>> sorted(hashes.begin(), hashes.end());
+  std::sort(sorted.begin(), sorted.end());
+  for (const auto& [chunk, hash] : sorted)
+    fprintf(f, "%zu %llx\n", chunk, static_cast<unsigned long long>(hash));
+  fclose(f);
+}
+
 void Recompiler::SaveCurrentOutData(const std::string_view& name) {
   if (!out.empty()) {
     std::string filename;
@@ -15,6 +15,11 @@
 #include <rex/memory/utils.h>
 #include <rex/types.h>
 
+#include <bit>
+
+#include <simde/x86/sse2.h>
+
+using rex::byte_swap;
 using rex::memory::load_and_swap;
 
 namespace rex::codegen {
@@ -80,26 +85,57 @@ std::vector<uint32_t> SigScanner::scanRange(uint32_t start, uint32_t end,
   const uint8_t* data = section->host_data;
   uint32_t sectionBase = section->virtual_address;
 
-  // Scan through the range (4-byte aligned for PPC)
-  for (uint32_t addr = start; addr + patternBytes <= scanEnd; addr += 4) {
-    bool matched = true;
+  // Full scalar verification of the whole pattern at one candidate address
+  auto verify = [&](uint32_t addr) {
     uint32_t offset = addr - sectionBase;
-
-    for (size_t i = 0; i < pattern.size() && matched; i++) {
+    for (size_t i = 0; i < pattern.size(); i++) {
       uint32_t dword = load_and_swap<uint32_t>(data + offset + i * 4);
-      uint32_t masked = dword & mask[i];
-      uint32_t expected = pattern[i] & mask[i];
-
-      if (masked != expected) {
-        matched = false;
-      }
+      if ((dword & mask[i]) != (pattern[i] & mask[i]))
+        return false;
     }
-
-    if (matched) {
-      uint32_t entryPoint = addr + static_cast<uint32_t>(entryOffset * 4);
-      matches.push_back(entryPoint);
-      REXCODEGEN_TRACE("SigScanner: pattern match at 0x{:08X}, entry=0x{:08X}", addr, entryPoint);
+    return true;
+  };
+
+  auto emit = [&](uint32_t addr) {
+    uint32_t entryPoint = addr + static_cast<uint32_t>(entryOffset * 4);
+    matches.push_back(entryPoint);
+    REXCODEGEN_TRACE("SigScanner: pattern match at 0x{:08X}, entry=0x{:08X}", addr, entryPoint);
+  };
+
+  // First-word filter: compare raw big-endian memory against the byte-swapped
+  // first pattern word, four candidate dwords per 128-bit load. Only the rare
+  // filter hits pay for full (byte-swapping) verification. simde lowers this
+  // to SSE2/NEON on the respective hosts.
+  const uint32_t firstMaskBe = byte_swap(mask[0]);
+  const uint32_t firstWordBe = byte_swap(pattern[0] & mask[0]);
+  const simde__m128i vMask = simde_mm_set1_epi32(static_cast<int32_t>(firstMaskBe));
+  const simde__m128i vWord = simde_mm_set1_epi32(static_cast<int32_t>(firstWordBe));
+
+  uint32_t addr = start;
+  const uint32_t lastCandidate = scanEnd - static_cast<uint32_t>(patternBytes);
+
+  while (addr + 16 <= lastCandidate + 4) {
+    const simde__m128i chunk =
+        simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(data + (addr - sectionBase)));
+    const simde__m128i masked = simde_mm_and_si128(chunk, vMask);
+    const simde__m128i eq = simde_mm_cmpeq_epi32(masked, vWord);
+    int hits = simde_mm_movemask_ps(simde_mm_castsi128_ps(eq));
+
+    while (hits) {
+      const int lane = std::countr_zero(static_cast<unsigned>(hits));
+      hits &= hits - 1;
+      const uint32_t candidate = addr + static_cast<uint32_t>(lane) * 4;
+      if (candidate <= lastCandidate && verify(candidate))
+        emit(candidate);
     }
+
+    addr += 16;
+  }
+
+  // Scalar tail for the last few words
+  for (; addr <= lastCandidate; addr += 4) {
+    if (verify(addr))
+      emit(addr);
   }
 
   return matches;
@@ -26,35 +26,59 @@ BitMap::BitMap(uint64_t* data, size_t size_bits) {
   assert_true(size_bits % kDataSizeBits == 0);
 
   data_.resize(size_bits / kDataSizeBits);
-  std::memcpy(data_.data(), data, size_bits / kDataSizeBits);
+  std::memcpy(data_.data(), data, (size_bits / kDataSizeBits) * kDataSize);
+  RebuildSummary();
 }
 
 size_t BitMap::Acquire() {
-  for (size_t i = 0; i < data_.size(); i++) {
-    uint64_t entry = 0;
-    uint64_t new_entry = 0;
-    int64_t acquired_idx = -1;
-
-    do {
-      entry = data_[i];
-      uint8_t index = lzcnt(entry);
-      if (index == kDataSizeBits) {
-        // None free.
-        acquired_idx = -1;
-        break;
+  for (size_t s = 0; s < summary_.size(); s++) {
+    uint64_t summary = summary_[s];
+    uint32_t summary_bit;
+    while (rex::bit_scan_forward(summary, &summary_bit)) {
+      summary &= summary - 1;
+      size_t i = (s * kDataSizeBits) + summary_bit;
+
+      uint64_t entry = 0;
+      uint64_t new_entry = 0;
+      int64_t acquired_idx = -1;
+
+      do {
+        entry = data_[i];
+        uint8_t index = lzcnt(entry);
+        if (index == kDataSizeBits) {
+          // None free (stale summary bit); move to the next candidate.
+          acquired_idx = -1;
+          break;
+        }
+
+        // Entry has a free bit. Acquire it.
+        uint64_t bit = 1ull << (kDataSizeBits - index - 1);
+        new_entry = entry & ~bit;
+        assert_not_zero(entry & bit);
+
+        acquired_idx = index;
+      } while (!thread::atomic_cas(entry, new_entry, &data_[i]));
+
+      if (acquired_idx != -1) {
+        if (!new_entry) {
+          // Word drained - drop the summary bit, then recheck in case a
+          // racing Release repopulated the word between the drain and the
+          // drop. A stale set bit is harmless; a wrongly clear one is not.
+          uint64_t summary_mask = 1ull << summary_bit;
+          uint64_t summary_entry = 0;
+          do {
+            summary_entry = summary_[s];
+          } while (!thread::atomic_cas(summary_entry, summary_entry & ~summary_mask, &summary_[s]));
+          if (data_[i]) {
+            do {
+              summary_entry = summary_[s];
+            } while (
+                !thread::atomic_cas(summary_entry, summary_entry | summary_mask, &summary_[s]));
+          }
+        }
+        // Acquired.
+        return (i * kDataSizeBits) + acquired_idx;
       }
-
-      // Entry has a free bit. Acquire it.
-      uint64_t bit = 1ull << (kDataSizeBits - index - 1);
-      new_entry = entry & ~bit;
-      assert_not_zero(entry & bit);
-
-      acquired_idx = index;
-    } while (!thread::atomic_cas(entry, new_entry, &data_[i]));
-
-    if (acquired_idx != -1) {
-      // Acquired.
-      return (i * kDataSizeBits) + acquired_idx;
     }
   }
 
@@ -75,17 +99,125 @@ void BitMap::Release(size_t index) {
 
     new_entry = entry | bit;
   } while (!thread::atomic_cas(entry, new_entry, &data_[slot]));
+
+  // Data bit first, summary bit second - Acquire drops summary bits in the
+  // opposite order and rechecks the word, so free entries are never lost.
+  uint64_t summary_mask = 1ull << (slot % kDataSizeBits);
+  do {
+    entry = summary_[slot / kDataSizeBits];
+    new_entry = entry | summary_mask;
+  } while (!thread::atomic_cas(entry, new_entry, &summary_[slot / kDataSizeBits]));
+}
+
+size_t BitMap::FindFirstSet(size_t first) const {
+  size_t bit_count = data_.size() * kDataSizeBits;
+  if (first >= bit_count) {
+    return -1;
+  }
+
+  // Finish the word containing first; index 0 is the top bit of its word.
+  size_t word_index = first / kDataSizeBits;
+  uint64_t word = data_[word_index] & (~uint64_t(0) >> (first % kDataSizeBits));
+  if (word) {
+    return (word_index * kDataSizeBits) + lzcnt(word);
+  }
+
+  // Walk the summary for the next non-empty word.
+  size_t next_word = word_index + 1;
+  while (next_word < data_.size()) {
+    size_t s = next_word / kDataSizeBits;
+    uint64_t summary = summary_[s] & (~uint64_t(0) << (next_word % kDataSizeBits));
+    uint32_t summary_bit;
+    if (!rex::bit_scan_forward(summary, &summary_bit)) {
+      next_word = (s + 1) * kDataSizeBits;
+      continue;
+    }
+    size_t candidate = (s * kDataSizeBits) + summary_bit;
+    word = data_[candidate];
+    if (word) {
+      return (candidate * kDataSizeBits) + lzcnt(word);
+    }
+    // Stale summary bit; keep scanning.
+    next_word = candidate + 1;
+  }
+  return -1;
+}
+
+std::pair<size_t, size_t> BitMap::NextSetRange(size_t first) const {
+  size_t bit_count = data_.size() * kDataSizeBits;
+  size_t range_start = FindFirstSet(first);
+  if (range_start == size_t(-1)) {
+    return std::make_pair(bit_count, size_t(0));
+  }
+
+  // Find the first clear bit after the run opens. Runs are dense by
+  // definition, so a plain word walk is as good as it gets here.
+  size_t word_index = range_start / kDataSizeBits;
+  uint64_t inverted = ~data_[word_index] & (~uint64_t(0) >> (range_start % kDataSizeBits));
+  while (!inverted) {
+    word_index++;
+    if (word_index == data_.size()) {
+      return std::make_pair(range_start, bit_count - range_start);
+    }
+    inverted = ~data_[word_index];
+  }
+  size_t range_end = (word_index * kDataSizeBits) + lzcnt(inverted);
+  return std::make_pair(range_start, range_end - range_start);
+}
+
+void BitMap::SetRange(size_t first, size_t length) {
+  if (!length) {
+    return;
+  }
+  size_t last = first + length - 1;
+  size_t word_first = first / kDataSizeBits;
+  size_t word_last = last / kDataSizeBits;
+  for (size_t i = word_first; i <= word_last; i++) {
+    uint64_t mask = ~uint64_t(0);
+    if (i == word_first) {
+      mask &= ~uint64_t(0) >> (first % kDataSizeBits);
+    }
+    if (i == word_last) {
+      mask &= ~uint64_t(0) << (kDataSizeBits - 1 - (last % kDataSizeBits));
+    }
+    data_[i] |= mask;
+    summary_[i / kDataSizeBits] |= 1ull << (i % kDataSizeBits);
+  }
+}
+
+void BitMap::ClearRange(size_t first, size_t length) {
+  if (!length) {
+    return;
+  }
+  size_t last = first + length - 1;
+  size_t word_first = first / kDataSizeBits;
+  size_t word_last = last / kDataSizeBits;
+  for (size_t i = word_first; i <= word_last; i++) {
+    uint64_t mask = ~uint64_t(0);
+    if (i == word_first) {
+      mask &= ~uint64_t(0) >> (first % kDataSizeBits);
+    }
+    if (i == word_last) {
+      mask &= ~uint64_t(0) << (kDataSizeBits - 1 - (last % kDataSizeBits));
+    }
+    data_[i] &= ~mask;
+    if (!data_[i]) {
+      summary_[i / kDataSizeBits] &= ~(1ull << (i % kDataSizeBits));
+    }
+  }
 }
 
 void BitMap::Resize(size_t new_size_bits) {
   auto old_size = data_.size();
   assert_true(new_size_bits % kDataSizeBits == 0);
   data_.resize(new_size_bits / kDataSizeBits);
+  summary_.resize((data_.size() + kDataSizeBits - 1) / kDataSizeBits);
 
   // Initialize new entries.
   if (data_.size() > old_size) {
     for (size_t i = old_size; i < data_.size(); i++) {
       data_[i] = -1;
+      summary_[i / kDataSizeBits] |= 1ull << (i % kDataSizeBits);
     }
   }
 }
@@ -94,6 +226,16 @@ void BitMap::Reset() {
   for (size_t i = 0; i < data_.size(); i++) {
     data_[i] = -1;
   }
+  RebuildSummary();
+}
+
+void BitMap::RebuildSummary() {
+  summary_.assign((data_.size() + kDataSizeBits - 1) / kDataSizeBits, 0);
+  for (size_t i = 0; i < data_.size(); i++) {
+    if (data_[i]) {
+      summary_[i / kDataSizeBits] |= 1ull << (i % kDataSizeBits);
+    }
+  }
 }
 
-}  // namespace rex::bit
\ No newline at end of file
+}  // namespace rex::bit
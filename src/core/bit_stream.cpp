@@ -32,15 +32,8 @@ size_t BitStream::BitsRemaining() {
   return size_bits_ - offset_bits_;
 }
 
-uint64_t BitStream::Peek(size_t num_bits) {
-  // FYI: The reason we can't copy more than 57 bits is:
-  // 57 = 7 * 8 + 1 - that can only span a maximum of 8 bytes.
-  // We can't read in 9 bytes (easily), so we limit it.
-  assert_false(num_bits > 57);
-  assert_false(offset_bits_ + num_bits > size_bits_);
-
+void BitStream::RefillWindow() {
   size_t offset_bytes = offset_bits_ >> 3;
-  size_t rel_offset_bits = offset_bits_ - (offset_bytes << 3);
 
   // offset -->
   // ..[junk]..| target bits |....[junk].............
@@ -48,11 +41,33 @@ uint64_t BitStream::Peek(size_t num_bits) {
 
   // We need the data in little endian.
   // TODO: Have a flag specifying endianness of data?
-  bits = rex::byte_swap(bits);
+  window_ = rex::byte_swap(bits);
+  window_base_bits_ = offset_bytes << 3;
+  window_valid_ = true;
+}
+
+uint64_t BitStream::Peek(size_t num_bits) {
+  // FYI: The reason we can't copy more than 57 bits is:
+  // 57 = 7 * 8 + 1 - that can only span a maximum of 8 bytes.
+  // We can't read in 9 bytes (easily), so we limit it.
+  assert_false(num_bits > 57);
+  assert_false(offset_bits_ + num_bits > size_bits_);
+
+  if (!num_bits) {
+    return 0;
+  }
+
+  // After a refill the window starts at most 7 bits before the offset, so
+  // any permitted read fits; revalidate only when the read falls outside.
+  if (!window_valid_ || offset_bits_ < window_base_bits_ ||
+      offset_bits_ + num_bits > window_base_bits_ + 64) {
+    RefillWindow();
+  }
+  size_t rel_offset_bits = offset_bits_ - window_base_bits_;
 
   // Shift right
   // .....[junk]........| target bits |
-  bits >>= 64 - (rel_offset_bits + num_bits);
+  uint64_t bits = window_ >> (64 - (rel_offset_bits + num_bits));
 
   // AND with mask
   // ...................| target bits |
@@ -68,6 +83,29 @@ uint64_t BitStream::Read(size_t num_bits) {
   return val;
 }
 
+void BitStream::ReadMany(const uint8_t* field_bits, uint64_t* out_values, size_t count) {
+  size_t total_bits = 0;
+  for (size_t i = 0; i < count; ++i) {
+    total_bits += field_bits[i];
+  }
+  if (total_bits > 57) {
+    // Too wide for one window; read field by field.
+    for (size_t i = 0; i < count; ++i) {
+      out_values[i] = Read(field_bits[i]);
+    }
+    return;
+  }
+
+  // One peek covers every field; slice it up from the high end.
+  uint64_t bits = Peek(total_bits);
+  size_t shift = total_bits;
+  for (size_t i = 0; i < count; ++i) {
+    shift -= field_bits[i];
+    out_values[i] = (bits >> shift) & ((1ULL << field_bits[i]) - 1);
+  }
+  Advance(total_bits);
+}
+
 // TODO: This is totally not tested!
 bool BitStream::Write(uint64_t val, size_t num_bits) {
   assert_false(num_bits > 57);
@@ -99,6 +137,9 @@ bool BitStream::Write(uint64_t val, size_t num_bits) {
   // Store into the bitstream.
   *(uint64_t*)(buffer_ + offset_bytes) = bits;
 
+  // The cached read window may now hold overwritten bytes.
+  window_valid_ = false;
+
   // Advance the bitstream forward.
   Advance(num_bits);
 
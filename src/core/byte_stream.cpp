@@ -39,6 +39,41 @@ void ByteStream::Write(std::span<const uint8_t> buf) {
   Advance(buf.size());
 }
 
+std::span<const uint8_t> ByteStream::ReadView(size_t num_bytes) {
+  assert_true(offset_ + num_bytes <= data_length_);
+  std::span<const uint8_t> view(data_ + offset_, num_bytes);
+  Advance(num_bytes);
+  return view;
+}
+
+std::span<uint8_t> ByteStream::Reserve(size_t num_bytes) {
+  assert_true(offset_ + num_bytes <= data_length_);
+  assert_true(reserved_length_ == SIZE_MAX);
+  reserved_length_ = num_bytes;
+  return std::span<uint8_t>(data_ + offset_, num_bytes);
+}
+
+void ByteStream::Commit(size_t num_bytes) {
+  assert_true(reserved_length_ != SIZE_MAX);
+  assert_true(num_bytes <= reserved_length_);
+  reserved_length_ = SIZE_MAX;
+  Advance(num_bytes);
+}
+
+void ByteStream::WriteVectored(std::span<const std::span<const uint8_t>> bufs) {
+  size_t total_length = 0;
+  for (const auto& buf : bufs) {
+    total_length += buf.size();
+  }
+  assert_true(offset_ + total_length <= data_length_);
+  uint8_t* out = data_ + offset_;
+  for (const auto& buf : bufs) {
+    std::memcpy(out, buf.data(), buf.size());
+    out += buf.size();
+  }
+  Advance(total_length);
+}
+
 template <>
 std::string ByteStream::Read() {
   std::string str;
@@ -11,17 +11,37 @@
 
 #include <algorithm>
 #include <limits>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 #include <rex/chrono/clock.h>
 #include <rex/cvar.h>
 #include <rex/math.h>
 
+#if REX_ARCH_AMD64
+#include <cpuid.h>
+#endif
+
 REXCVAR_DEFINE_BOOL(clock_no_scaling, false, "Clock",
                     "Disable clock scaling (inverted: false = scaling enabled)");
 
 REXCVAR_DEFINE_BOOL(clock_source_raw, false, "Clock", "Use raw clock source without scaling");
 
+REXCVAR_DEFINE_BOOL(clock_fast_timebase, true, "Clock",
+                    "Read the guest timebase from the invariant TSC when available");
+
+REXCVAR_DEFINE_BOOL(clock_virtual_tick, false, "Clock",
+                    "Decouple guest time from host time for headless fast-run mode: the "
+                    "timebase advances per query/wait instead of with the wall clock, and "
+                    "guest waits complete immediately. Takes precedence over "
+                    "clock_no_scaling");
+
+REXCVAR_DEFINE_UINT64(clock_virtual_ticks_per_query, 50, "Clock",
+                      "Guest ticks added to the virtual timebase per timebase query (50 = "
+                      "1us at the 50MHz guest tick rate), so polling loops observe forward "
+                      "progress");
+
 namespace rex::chrono {
 
 // Time scalar applied to all time operations.
@@ -35,6 +55,11 @@ uint64_t guest_system_time_base_ = Clock::QueryHostSystemTime();
 // Computed by RecomputeGuestTickScalar.
 std::pair<uint64_t, uint64_t> guest_tick_ratio_ = std::make_pair(1, 1);
 
+// Virtual timebase for clock_virtual_tick mode. Only ever advanced by
+// queries and explicit AdvanceVirtualTicks calls, never by host time, so a
+// run that issues the same sequence of queries observes the same timestamps.
+std::atomic<uint64_t> virtual_guest_tick_count_{0};
+
 // Native guest ticks.
 uint64_t last_guest_tick_count_ = 0;
 // Last sampled host tick count.
@@ -42,6 +67,17 @@ uint64_t last_host_tick_count_ = Clock::QueryHostTickCount();
 // Mutex to ensure last_host_tick_count_ and last_guest_tick_count_ are in sync
 std::mutex tick_mutex_;
 
+namespace detail {
+std::atomic<const GuestTimebaseParams*> guest_timebase_params_{nullptr};
+}  // namespace detail
+
+// Retired fast-path parameter blocks. A reader may still hold a pointer to a
+// superseded block, so they are kept until process exit; ratio changes are
+// rare enough that this never amounts to anything.
+std::vector<std::unique_ptr<const detail::GuestTimebaseParams>> retired_timebase_params_;
+
+void RepublishGuestTimebaseParams();
+
 void RecomputeGuestTickScalar() {
   // Create a rational number with numerator (first) and denominator (second)
   auto frac = std::make_pair(guest_tick_frequency_, Clock::QueryHostTickFrequency());
@@ -57,13 +93,23 @@ void RecomputeGuestTickScalar() {
   // Keep this a rational calculation and reduce the fraction
   reduce_fraction(frac);
 
-  std::lock_guard<std::mutex> lock(tick_mutex_);
-  guest_tick_ratio_ = frac;
+  {
+    std::lock_guard<std::mutex> lock(tick_mutex_);
+    guest_tick_ratio_ = frac;
+  }
+  RepublishGuestTimebaseParams();
 }
 
 // Update the guest timer for all threads.
 // Return a copy of the value so locking is reduced.
 uint64_t UpdateGuestClock() {
+  if (Clock::virtual_tick_enabled()) {
+    // Each query nudges the virtual clock forward so timebase polling loops
+    // terminate; nothing here reads host time.
+    uint64_t step = REXCVAR_GET(clock_virtual_ticks_per_query);
+    return virtual_guest_tick_count_.fetch_add(step, std::memory_order_relaxed) + step;
+  }
+
   uint64_t host_tick_count = Clock::QueryHostTickCount();
 
   if (REXCVAR_GET(clock_no_scaling)) {
@@ -88,9 +134,74 @@ uint64_t UpdateGuestClock() {
   }
 }
 
+#if REX_ARCH_AMD64
+// Returns the TSC frequency in Hz, or 0 if the TSC is unusable as a time
+// source. Requires the invariant TSC (CPUID 8000_0007h EDX[8]): on anything
+// modern the TSC ticks at a constant rate regardless of frequency scaling and
+// power states, which is what lets us trust a one-time calibration.
+uint64_t QueryTscFrequency() {
+  static uint64_t tsc_frequency = [] {
+    uint32_t eax, ebx, ecx, edx;
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) || !(edx & (1u << 8))) {
+      return uint64_t(0);
+    }
+    // Calibrate against the host clock over a ~10ms window. The clock read
+    // latency at either end puts the measurement error well below anything a
+    // game can observe through mftb.
+    uint64_t host_frequency = Clock::host_tick_frequency_platform();
+    uint64_t window = host_frequency / 100;
+    uint64_t host_begin = Clock::host_tick_count_platform();
+    uint64_t tsc_begin = __rdtsc();
+    uint64_t host_end;
+    do {
+      host_end = Clock::host_tick_count_platform();
+    } while (host_end - host_begin < window);
+    uint64_t tsc_end = __rdtsc();
+    return (tsc_end - tsc_begin) * host_frequency / (host_end - host_begin);
+  }();
+  return tsc_frequency;
+}
+#endif
+
+// Re-anchors and republishes the TSC fast-path parameters. Called whenever
+// the guest tick ratio changes; the anchor ties the fast path to the slow
+// path's current tick count so the two never disagree by more than the drift
+// accumulated since the last ratio change.
+void RepublishGuestTimebaseParams() {
+#if REX_ARCH_AMD64
+  if (!REXCVAR_GET(clock_fast_timebase) || Clock::virtual_tick_enabled()) {
+    // In virtual tick mode mftb must observe the virtual counter, so the TSC
+    // fast path is never published and readers fall back to
+    // QueryGuestTickCount().
+    return;
+  }
+  uint64_t tsc_frequency = QueryTscFrequency();
+  if (!tsc_frequency) {
+    return;
+  }
+
+  auto params = std::make_unique<detail::GuestTimebaseParams>();
+  params->guest_tick_base = UpdateGuestClock();
+  params->tsc_base = __rdtsc();
+  auto ratio = Clock::guest_tick_ratio();
+  // Guest ticks per second is host_frequency * ratio; divide by the TSC rate
+  // in 128-bit to get the per-TSC-tick step without losing precision.
+  params->ticks_per_tsc_fp32 = static_cast<uint64_t>(
+      ((static_cast<unsigned __int128>(Clock::QueryHostTickFrequency()) * ratio.first) << 32) /
+      (static_cast<unsigned __int128>(ratio.second) * tsc_frequency));
+
+  const auto* old =
+      detail::guest_timebase_params_.exchange(params.release(), std::memory_order_acq_rel);
+  if (old) {
+    std::lock_guard<std::mutex> lock(tick_mutex_);
+    retired_timebase_params_.emplace_back(old);
+  }
+#endif
+}
+
 // Offset of the current guest system file time relative to the guest base time.
 inline uint64_t QueryGuestSystemTimeOffset() {
-  if (REXCVAR_GET(clock_no_scaling)) {
+  if (REXCVAR_GET(clock_no_scaling) && !Clock::virtual_tick_enabled()) {
     return Clock::QueryHostSystemTime() - guest_system_time_base_;
   }
 
@@ -160,8 +271,21 @@ uint64_t Clock::QueryGuestTickCount() {
   return guest_tick_count;
 }
 
+bool Clock::virtual_tick_enabled() {
+  // Latched once: flipping the mode mid-run would splice two unrelated
+  // timelines together.
+  static const bool enabled = REXCVAR_GET(clock_virtual_tick);
+  return enabled;
+}
+
+void Clock::AdvanceVirtualTicks(uint64_t guest_ticks) {
+  if (virtual_tick_enabled()) {
+    virtual_guest_tick_count_.fetch_add(guest_ticks, std::memory_order_relaxed);
+  }
+}
+
 uint64_t Clock::QueryGuestSystemTime() {
-  if (REXCVAR_GET(clock_no_scaling)) {
+  if (REXCVAR_GET(clock_no_scaling) && !virtual_tick_enabled()) {
     return Clock::QueryHostSystemTime();
   }
 
@@ -175,7 +299,7 @@ uint32_t Clock::QueryGuestUptimeMillis() {
 }
 
 void Clock::SetGuestSystemTime(uint64_t system_time) {
-  if (REXCVAR_GET(clock_no_scaling)) {
+  if (REXCVAR_GET(clock_no_scaling) && !virtual_tick_enabled()) {
     // Time is fixed to host time.
     return;
   }
@@ -186,6 +310,12 @@ void Clock::SetGuestSystemTime(uint64_t system_time) {
 }
 
 uint32_t Clock::ScaleGuestDurationMillis(uint32_t guest_ms) {
+  if (virtual_tick_enabled()) {
+    // Waits complete immediately, but the waited-for time still passes on the
+    // virtual timebase so guest timeouts stay observable.
+    AdvanceVirtualTicks(uint64_t(guest_ms) * guest_tick_frequency_ / 1000);
+    return 0;
+  }
   if (REXCVAR_GET(clock_no_scaling)) {
     return guest_ms;
   }
@@ -202,7 +332,36 @@ uint32_t Clock::ScaleGuestDurationMillis(uint32_t guest_ms) {
   return static_cast<uint32_t>(std::min(scaled_ms, max));
 }
 
+uint64_t Clock::ScaleGuestDurationMicros(uint64_t guest_us) {
+  if (virtual_tick_enabled()) {
+    AdvanceVirtualTicks(guest_us * guest_tick_frequency_ / 1000000);
+    return 0;
+  }
+  if (REXCVAR_GET(clock_no_scaling)) {
+    return guest_us;
+  }
+
+  if (!guest_us) {
+    return 0;
+  }
+  return static_cast<uint64_t>(static_cast<uint64_t>(guest_us) * guest_time_scalar_);
+}
+
 int64_t Clock::ScaleGuestDurationFileTime(int64_t guest_file_time) {
+  if (virtual_tick_enabled()) {
+    if (guest_file_time < 0) {
+      // Relative wait: pass the full duration on the virtual timebase.
+      AdvanceVirtualTicks(uint64_t(-guest_file_time) * guest_tick_frequency_ / 10000000);
+    } else if (guest_file_time > 0) {
+      // Absolute deadline: jump the virtual clock to it if still ahead.
+      uint64_t guest_time = Clock::QueryGuestSystemTime();
+      if (uint64_t(guest_file_time) > guest_time) {
+        AdvanceVirtualTicks((uint64_t(guest_file_time) - guest_time) * guest_tick_frequency_ /
+                            10000000);
+      }
+    }
+    return 0;
+  }
   if (REXCVAR_GET(clock_no_scaling)) {
     return static_cast<uint64_t>(guest_file_time);
   }
@@ -225,6 +384,13 @@ int64_t Clock::ScaleGuestDurationFileTime(int64_t guest_file_time) {
 }
 
 void Clock::ScaleGuestDurationTimeval(int32_t* tv_sec, int32_t* tv_usec) {
+  if (virtual_tick_enabled()) {
+    AdvanceVirtualTicks(uint64_t(*tv_sec) * guest_tick_frequency_ +
+                        uint64_t(*tv_usec) * guest_tick_frequency_ / 1000000);
+    *tv_sec = 0;
+    *tv_usec = 0;
+    return;
+  }
   if (REXCVAR_GET(clock_no_scaling)) {
     return;
   }
@@ -7,6 +7,7 @@
  */
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <cstdlib>
 #include <filesystem>
@@ -17,6 +18,7 @@
 #include <CLI/CLI.hpp>
 
 #include <rex/cvar.h>
+#include <rex/hash.h>
 #include <rex/logging.h>
 
 #include <toml++/toml.hpp>
@@ -28,6 +30,11 @@ namespace {
 bool g_finalized = false;
 bool g_lifecycle_override = false;
 std::mutex g_mutex;
+std::atomic<uint64_t> g_modification_epoch{0};
+
+// Heterogeneous hashing so by-name lookups take a string_view without
+// allocating a temporary std::string key.
+using StringHash = rex::TransparentStringHasher;
 
 // Flag registry - use functions to avoid static init order issues
 std::vector<FlagEntry>& GetRegistryStorage() {
@@ -35,8 +42,8 @@ std::vector<FlagEntry>& GetRegistryStorage() {
   return registry;
 }
 
-std::unordered_map<std::string, size_t>& GetRegistryIndex() {
-  static std::unordered_map<std::string, size_t> index;
+std::unordered_map<std::string, size_t, StringHash, std::equal_to<>>& GetRegistryIndex() {
+  static std::unordered_map<std::string, size_t, StringHash, std::equal_to<>> index;
   return index;
 }
 
@@ -87,8 +94,10 @@ std::vector<std::string>& GetPendingRestartStorage() {
 }
 
 // Callback storage for change notifications
-std::unordered_map<std::string, std::vector<ChangeCallback>>& GetCallbackStorage() {
-  static std::unordered_map<std::string, std::vector<ChangeCallback>> callbacks;
+std::unordered_map<std::string, std::vector<ChangeCallback>, StringHash, std::equal_to<>>&
+GetCallbackStorage() {
+  static std::unordered_map<std::string, std::vector<ChangeCallback>, StringHash, std::equal_to<>>
+      callbacks;
   return callbacks;
 }
 
@@ -175,7 +184,7 @@ void RegisterFlag(FlagEntry entry) {
 }
 
 bool SetFlagByName(std::string_view name, std::string_view value) {
-  auto it = GetRegistryIndex().find(std::string(name));
+  auto it = GetRegistryIndex().find(name);
   if (it == GetRegistryIndex().end()) {
     return false;
   }
@@ -202,8 +211,9 @@ bool SetFlagByName(std::string_view name, std::string_view value) {
 
   // Invoke registered callbacks
   if (success) {
+    g_modification_epoch.fetch_add(1, std::memory_order_release);
     auto& callbacks = GetCallbackStorage();
-    auto it = callbacks.find(std::string(name));
+    auto it = callbacks.find(name);
     if (it != callbacks.end()) {
       for (const auto& callback : it->second) {
         callback(name, value);
@@ -215,7 +225,7 @@ bool SetFlagByName(std::string_view name, std::string_view value) {
 }
 
 std::string GetFlagByName(std::string_view name) {
-  auto it = GetRegistryIndex().find(std::string(name));
+  auto it = GetRegistryIndex().find(name);
   if (it == GetRegistryIndex().end()) {
     return "";
   }
@@ -256,7 +266,7 @@ std::vector<std::string> ListFlagsByLifecycle(Lifecycle lc) {
 }
 
 const FlagEntry* GetFlagInfo(std::string_view name) {
-  auto it = GetRegistryIndex().find(std::string(name));
+  auto it = GetRegistryIndex().find(name);
   if (it == GetRegistryIndex().end()) {
     return nullptr;
   }
@@ -272,22 +282,24 @@ void ClearPendingRestartFlags() {
 }
 
 void ResetToDefault(std::string_view name) {
-  auto it = GetRegistryIndex().find(std::string(name));
+  auto it = GetRegistryIndex().find(name);
   if (it == GetRegistryIndex().end()) {
     return;
   }
   const auto& entry = GetRegistryStorage()[it->second];
   entry.setter(entry.default_value);
+  g_modification_epoch.fetch_add(1, std::memory_order_release);
 }
 
 void ResetAllToDefaults() {
   for (const auto& entry : GetRegistryStorage()) {
     entry.setter(entry.default_value);
   }
+  g_modification_epoch.fetch_add(1, std::memory_order_release);
 }
 
 bool HasNonDefaultValue(std::string_view name) {
-  auto it = GetRegistryIndex().find(std::string(name));
+  auto it = GetRegistryIndex().find(name);
   if (it == GetRegistryIndex().end()) {
     return false;
   }
@@ -338,7 +350,14 @@ void RegisterChangeCallback(std::string_view name, ChangeCallback callback) {
 }
 
 void UnregisterChangeCallbacks(std::string_view name) {
-  GetCallbackStorage().erase(std::string(name));
+  auto it = GetCallbackStorage().find(name);
+  if (it != GetCallbackStorage().end()) {
+    GetCallbackStorage().erase(it);
+  }
+}
+
+uint64_t ModificationEpoch() {
+  return g_modification_epoch.load(std::memory_order_acquire);
 }
 
 //=============================================================================
@@ -11,8 +11,54 @@
 
 #include <rex/exception_handler.h>
 
+#include <atomic>
+
 namespace rex::arch {
 
+namespace {
+
+// Each entry packs the faulting PC (truncated to its low 56 bits) with the
+// handler slot index plus one in the low byte, so lookup and update are a
+// single relaxed word each and an entry can never tear. Zero means empty.
+constexpr size_t kHandlerCacheSize = 64;
+static_assert((kHandlerCacheSize & (kHandlerCacheSize - 1)) == 0);
+
+std::atomic<uint64_t> handler_cache_[kHandlerCacheSize];
+
+constexpr size_t HandlerCacheIndex(uint64_t pc) {
+  // Host instructions are variable-length, so fold rather than shifting out
+  // low bits.
+  return size_t(pc ^ (pc >> 12)) & (kHandlerCacheSize - 1);
+}
+
+constexpr uint64_t HandlerCacheTag(uint64_t pc) {
+  return pc << 8;
+}
+
+}  // namespace
+
+size_t LookupHandlerCache(uint64_t pc) {
+  uint64_t entry = handler_cache_[HandlerCacheIndex(pc)].load(std::memory_order_relaxed);
+  if (!entry || (entry & ~uint64_t(0xFF)) != HandlerCacheTag(pc)) {
+    return kHandlerCacheMiss;
+  }
+  return size_t(entry & 0xFF) - 1;
+}
+
+void UpdateHandlerCache(uint64_t pc, size_t handler_index) {
+  if (handler_index >= 0xFF) {
+    return;
+  }
+  handler_cache_[HandlerCacheIndex(pc)].store(HandlerCacheTag(pc) | uint64_t(handler_index + 1),
+                                              std::memory_order_relaxed);
+}
+
+void InvalidateHandlerCache() {
+  for (size_t i = 0; i < kHandlerCacheSize; ++i) {
+    handler_cache_[i].store(0, std::memory_order_relaxed);
+  }
+}
+
 // Based on VIXL Instruction::IsLoad and IsStore.
 // https://github.com/Linaro/vixl/blob/d48909dd0ac62197edb75d26ed50927e4384a199/src/aarch64/instructions-aarch64.cc#L484
 //
@@ -77,9 +77,32 @@ LONG CALLBACK ExceptionHandlerCallback(PEXCEPTION_POINTERS ex_info) {
       return EXCEPTION_CONTINUE_SEARCH;
   }
 
-  for (size_t i = 0; i < rex::countof(handlers_) && handlers_[i].first; ++i) {
+  // Try the handler that resolved this faulting PC last time first - repeat
+  // faults (MMIO accesses, write watches) come from the same few instructions.
+  const uint64_t fault_pc = thread_context.rip;
+  const size_t cached_index = LookupHandlerCache(fault_pc);
+  for (size_t attempt = 0; attempt <= rex::countof(handlers_); ++attempt) {
+    size_t i;
+    if (attempt == 0) {
+      i = cached_index;
+      if (i >= rex::countof(handlers_) || !handlers_[i].first) {
+        continue;
+      }
+    } else {
+      i = attempt - 1;
+      if (!handlers_[i].first) {
+        break;
+      }
+      if (i == cached_index) {
+        // Already declined above.
+        continue;
+      }
+    }
     if (handlers_[i].first(&ex, handlers_[i].second)) {
       // Exception handled.
+      if (i != cached_index) {
+        UpdateHandlerCache(fault_pc, i);
+      }
       ex_info->ContextRecord->Rip = thread_context.rip;
       ex_info->ContextRecord->EFlags = thread_context.eflags;
       uint32_t modified_register_index;
@@ -116,6 +139,7 @@ void ExceptionHandler::Install(Handler fn, void* data) {
     if (!handlers_[i].first) {
       handlers_[i].first = fn;
       handlers_[i].second = data;
+      InvalidateHandlerCache();
       return;
     }
   }
@@ -130,6 +154,8 @@ void ExceptionHandler::Uninstall(Handler fn, void* data) {
       }
       handlers_[i].first = nullptr;
       handlers_[i].second = nullptr;
+      // Compaction renumbers the remaining slots, so cached indices are stale.
+      InvalidateHandlerCache();
       break;
     }
   }
@@ -17,6 +17,37 @@
 
 namespace rex::filesystem {
 
+namespace {
+
+char lower_ascii(char c) {
+  return (c >= 'A' && c <= 'Z') ? char(c + ('a' - 'A')) : c;
+}
+
+// Case-insensitively compares str at offset against a pre-lowered segment.
+// The caller guarantees the segment fits.
+bool equals_lowered_at(const std::string_view str, std::string_view::size_type offset,
+                       const std::string_view lowered) {
+  for (std::string_view::size_type i = 0; i < lowered.size(); ++i) {
+    if (lower_ascii(str[offset + i]) != lowered[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::string_view::size_type find_lowered_from(const std::string_view str,
+                                              std::string_view::size_type offset,
+                                              const std::string_view lowered) {
+  for (; offset + lowered.size() <= str.size(); ++offset) {
+    if (equals_lowered_at(str, offset, lowered)) {
+      return offset;
+    }
+  }
+  return std::string_view::npos;
+}
+
+}  // namespace
+
 WildcardFlags WildcardFlags::FIRST(true, false, false);
 WildcardFlags WildcardFlags::LAST(false, true, false);
 WildcardFlags WildcardFlags::ANY(false, false, true);
@@ -30,36 +61,49 @@ WildcardFlags::WildcardFlags(bool start, bool end, bool exact_length)
 WildcardRule::WildcardRule(const std::string_view match, const WildcardFlags& flags)
     : match_(rex::string::utf8_lower_ascii(match)), rules_(flags) {}
 
-bool WildcardRule::Check(const std::string_view lower, std::string::size_type* offset) const {
+bool WildcardRule::Check(const std::string_view str, std::string_view::size_type* offset) const {
   if (match_.empty()) {
     return true;
   }
 
-  if ((lower.size() - *offset) < match_.size()) {
+  if ((str.size() - *offset) < match_.size()) {
     return false;
   }
 
   if (rules_.ExactLength) {
+    // A '?' run: any characters, exact count.
     *offset += match_.size();
     return true;
   }
 
-  std::string_view::size_type result(lower.find(match_, *offset));
-
-  if (result != std::string_view::npos) {
-    if (rules_.FromStart && result != *offset) {
+  if (rules_.ToEnd) {
+    // Anchored to the end: compare the suffix in place instead of scanning
+    // for the first occurrence (which could sit before the real suffix).
+    auto suffix = str.size() - match_.size();
+    if (rules_.FromStart && suffix != *offset) {
       return false;
     }
-
-    if (rules_.ToEnd && result != (lower.size() - match_.size())) {
+    if (!equals_lowered_at(str, suffix, match_)) {
       return false;
     }
+    *offset = str.size();
+    return true;
+  }
 
-    *offset = (result + match_.size());
+  if (rules_.FromStart) {
+    if (!equals_lowered_at(str, *offset, match_)) {
+      return false;
+    }
+    *offset += match_.size();
     return true;
   }
 
-  return false;
+  auto result = find_lowered_from(str, *offset, match_);
+  if (result == std::string_view::npos) {
+    return false;
+  }
+  *offset = result + match_.size();
+  return true;
 }
 
 void WildcardEngine::PreparePattern(const std::string_view pattern) {
@@ -97,10 +141,11 @@ void WildcardEngine::SetRule(const std::string_view pattern) {
 }
 
 bool WildcardEngine::Match(const std::string_view str) const {
-  std::string str_lc = rex::string::utf8_lower_ascii(str);
-  std::string::size_type offset(0);
+  // The rules hold pre-lowered segments, so candidates are compared
+  // case-insensitively in place - no per-candidate allocation.
+  std::string_view::size_type offset(0);
   for (const auto& rule : rules_) {
-    if (!(rule.Check(str_lc, &offset))) {
+    if (!(rule.Check(str, &offset))) {
       return false;
     }
   }
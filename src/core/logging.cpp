@@ -15,6 +15,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include <spdlog/async.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
@@ -31,6 +32,17 @@ REXCVAR_DEFINE_STRING(log_file, "", "Log", "Log file path (empty = no file loggi
 REXCVAR_DEFINE_BOOL(log_verbose, false, "Log", "Enable verbose logging (sets level to trace)")
     .debug_only();
 
+REXCVAR_DEFINE_BOOL(log_async, true, "Log",
+                    "Format and write log messages on a dedicated thread so hot paths only "
+                    "enqueue them")
+    .lifecycle(rex::cvar::Lifecycle::kInitOnly);
+
+REXCVAR_DEFINE_INT32(log_async_queue_size, 8192, "Log",
+                     "Capacity of the async logging ring in messages; producers block when it "
+                     "is full until the writer thread catches up")
+    .range(256, 1048576)
+    .lifecycle(rex::cvar::Lifecycle::kInitOnly);
+
 namespace rex {
 
 namespace {
@@ -45,6 +57,11 @@ spdlog::sink_ptr g_file_sink;
 // Extra global sinks added via AddSink()
 std::vector<spdlog::sink_ptr> g_extra_sinks;
 
+// Writer thread pool shared by all category loggers when LogConfig::async is
+// set - producers enqueue into its ring, formatting and sink I/O happen on
+// the single writer thread.
+std::shared_ptr<spdlog::details::thread_pool> g_thread_pool;
+
 // Initialization state
 bool g_initialized = false;
 std::mutex g_mutex;
@@ -92,7 +109,17 @@ spdlog::level::level_enum ResolveCategoryLevel(const std::string& name) {
 // Create a logger and register it
 std::shared_ptr<spdlog::logger> CreateCategoryLogger(const std::string& name) {
   auto sinks = BuildCategorySinks(name);
-  auto logger = std::make_shared<spdlog::logger>(name, sinks.begin(), sinks.end());
+  std::shared_ptr<spdlog::logger> logger;
+  if (g_thread_pool) {
+    // Block rather than drop when the ring is full - the writer thread
+    // normally drains far faster than producers fill, so this only matters
+    // during pathological bursts, where losing messages would be worse.
+    logger = std::make_shared<spdlog::async_logger>(name, sinks.begin(), sinks.end(),
+                                                    g_thread_pool,
+                                                    spdlog::async_overflow_policy::block);
+  } else {
+    logger = std::make_shared<spdlog::logger>(name, sinks.begin(), sinks.end());
+  }
   logger->set_level(ResolveCategoryLevel(name));
   logger->flush_on(g_config.flush_level);
   spdlog::register_logger(logger);
@@ -140,6 +167,13 @@ void InitLogging(const LogConfig& config) {
   // Populate extra global sinks from config
   g_extra_sinks = config.extra_sinks;
 
+  // Create the shared writer thread before any logger so every category gets
+  // the async path.
+  if (config.async) {
+    g_thread_pool = std::make_shared<spdlog::details::thread_pool>(
+        std::max(config.async_queue_size, size_t(1)), size_t(1));
+  }
+
   // Ensure registry has room for built-in categories (don't truncate
   // any consumer categories that were registered during static init).
   if (g_registry.size() < log::kBuiltinCount) {
@@ -184,6 +218,9 @@ void ShutdownLogging() {
   spdlog::shutdown();
 
   g_registry.clear();
+  // Dropping the last thread pool reference drains the ring and joins the
+  // writer thread.
+  g_thread_pool.reset();
   g_console_sink.reset();
   g_file_sink.reset();
   g_extra_sinks.clear();
@@ -375,6 +412,10 @@ LogConfig BuildLogConfig(const char* log_file, const std::string& cli_level,
       config.default_level = *level;
   }
 
+  // Async sink configuration comes straight from the init-only CVARs
+  config.async = REXCVAR_GET(log_async);
+  config.async_queue_size = static_cast<size_t>(std::max(REXCVAR_GET(log_async_queue_size), 1));
+
   // Per-category CLI levels (string-keyed)
   for (const auto& [cat_name, level_str] : category_levels) {
     if (level_str.empty())
@@ -9,6 +9,7 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <algorithm>
 #include <memory>
 
 #include <fcntl.h>
@@ -18,6 +19,7 @@
 
 #include <rex/filesystem.h>
 #include <rex/memory/mapped_memory.h>
+#include <rex/memory/utils.h>
 #include <rex/platform.h>
 
 namespace rex::memory {
@@ -93,6 +95,31 @@ class PosixMappedMemory : public MappedMemory {
 
   void Flush() override { msync(data(), size(), MS_ASYNC); }
 
+  void Advise(AdviseHint hint, size_t offset, size_t length) override {
+    if (offset >= size()) {
+      return;
+    }
+    length = std::min(length, size() - offset);
+    // madvise wants a page-aligned start address.
+    const size_t page_mask = memory::page_size() - 1;
+    const size_t aligned_offset = offset & ~page_mask;
+    int advice;
+    switch (hint) {
+      case AdviseHint::kWillNeed:
+        advice = MADV_WILLNEED;
+        break;
+      case AdviseHint::kSequential:
+        advice = MADV_SEQUENTIAL;
+        break;
+      case AdviseHint::kRandom:
+        advice = MADV_RANDOM;
+        break;
+      default:
+        return;
+    }
+    madvise(data() + aligned_offset, length + (offset - aligned_offset), advice);
+  }
+
  private:
   int file_descriptor_;
 };
@@ -11,6 +11,7 @@
 
 #include "platform_win.h"
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -70,6 +71,25 @@ class Win32MappedMemory : public MappedMemory {
   }
 
   void Flush() override { FlushViewOfFile(data(), size()); }
+
+  void Advise(AdviseHint hint, size_t offset, size_t length) override {
+#ifdef REX_BASE_MAPPED_MEMORY_WIN_USE_DESKTOP_FUNCTIONS
+    // Windows only offers an equivalent of MADV_WILLNEED; the ordering hints
+    // have no counterpart.
+    if (hint != AdviseHint::kWillNeed || offset >= size()) {
+      return;
+    }
+    WIN32_MEMORY_RANGE_ENTRY range;
+    range.VirtualAddress = data() + offset;
+    range.NumberOfBytes = std::min(length, size() - offset);
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+    (void)hint;
+    (void)offset;
+    (void)length;
+#endif
+  }
+
   bool Remap(size_t offset, size_t length) override {
     size_t aligned_offset = offset & ~(memory::allocation_granularity() - 1);
     size_t aligned_length = length + (offset - aligned_offset);
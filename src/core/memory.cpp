@@ -10,6 +10,7 @@
  */
 
 #include <rex/cvar.h>
+#include <rex/math.h>
 #include <rex/memory/utils.h>
 #include <rex/platform.h>
 
@@ -30,7 +31,9 @@ bool IsWritableExecutableMemoryPreferred() {
   return REXCVAR_GET(writable_executable_memory);
 }
 
-// TODO(benvanik): fancy AVX versions.
+// AVX2 main loops below when the target has it (the presets build with
+// -march=x86-64-v3); vpshufb swaps within each 128-bit lane, which is exactly
+// what a byte swap needs, so the SSSE3 masks broadcast straight across.
 // https://github.com/gnuradio/volk/blob/master/kernels/volk/volk_16u_byteswap.h
 // https://github.com/gnuradio/volk/blob/master/kernels/volk/volk_32u_byteswap.h
 // https://github.com/gnuradio/volk/blob/master/kernels/volk/volk_64u_byteswap.h
@@ -65,7 +68,15 @@ void copy_and_swap_16_aligned(void* dest_ptr, const void* src_ptr, size_t count)
                                   0x05, 0x02, 0x03, 0x00, 0x01);
 
   size_t i = 0;
-  for (i = 0; i + 8 <= count; i += 8) {
+#if defined(__AVX2__)
+  const __m256i shufmask256 = _mm256_broadcastsi128_si256(shufmask);
+  for (; i + 16 <= count; i += 16) {
+    __m256i wide = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src[i]));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dest[i]),
+                        _mm256_shuffle_epi8(wide, shufmask256));
+  }
+#endif
+  for (; i + 8 <= count; i += 8) {
     __m128i input = _mm_load_si128(reinterpret_cast<const __m128i*>(&src[i]));
     __m128i output = _mm_shuffle_epi8(input, shufmask);
     _mm_store_si128(reinterpret_cast<__m128i*>(&dest[i]), output);
@@ -82,8 +93,16 @@ void copy_and_swap_16_unaligned(void* dest_ptr, const void* src_ptr, size_t coun
   __m128i shufmask = _mm_set_epi8(0x0E, 0x0F, 0x0C, 0x0D, 0x0A, 0x0B, 0x08, 0x09, 0x06, 0x07, 0x04,
                                   0x05, 0x02, 0x03, 0x00, 0x01);
 
-  size_t i;
-  for (i = 0; i + 8 <= count; i += 8) {
+  size_t i = 0;
+#if defined(__AVX2__)
+  const __m256i shufmask256 = _mm256_broadcastsi128_si256(shufmask);
+  for (; i + 16 <= count; i += 16) {
+    __m256i wide = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src[i]));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dest[i]),
+                        _mm256_shuffle_epi8(wide, shufmask256));
+  }
+#endif
+  for (; i + 8 <= count; i += 8) {
     __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
     __m128i output = _mm_shuffle_epi8(input, shufmask);
     _mm_storeu_si128(reinterpret_cast<__m128i*>(&dest[i]), output);
@@ -103,8 +122,16 @@ void copy_and_swap_32_aligned(void* dest_ptr, const void* src_ptr, size_t count)
   __m128i shufmask = _mm_set_epi8(0x0C, 0x0D, 0x0E, 0x0F, 0x08, 0x09, 0x0A, 0x0B, 0x04, 0x05, 0x06,
                                   0x07, 0x00, 0x01, 0x02, 0x03);
 
-  size_t i;
-  for (i = 0; i + 4 <= count; i += 4) {
+  size_t i = 0;
+#if defined(__AVX2__)
+  const __m256i shufmask256 = _mm256_broadcastsi128_si256(shufmask);
+  for (; i + 8 <= count; i += 8) {
+    __m256i wide = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src[i]));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dest[i]),
+                        _mm256_shuffle_epi8(wide, shufmask256));
+  }
+#endif
+  for (; i + 4 <= count; i += 4) {
     __m128i input = _mm_load_si128(reinterpret_cast<const __m128i*>(&src[i]));
     __m128i output = _mm_shuffle_epi8(input, shufmask);
     _mm_store_si128(reinterpret_cast<__m128i*>(&dest[i]), output);
@@ -121,8 +148,16 @@ void copy_and_swap_32_unaligned(void* dest_ptr, const void* src_ptr, size_t coun
   __m128i shufmask = _mm_set_epi8(0x0C, 0x0D, 0x0E, 0x0F, 0x08, 0x09, 0x0A, 0x0B, 0x04, 0x05, 0x06,
                                   0x07, 0x00, 0x01, 0x02, 0x03);
 
-  size_t i;
-  for (i = 0; i + 4 <= count; i += 4) {
+  size_t i = 0;
+#if defined(__AVX2__)
+  const __m256i shufmask256 = _mm256_broadcastsi128_si256(shufmask);
+  for (; i + 8 <= count; i += 8) {
+    __m256i wide = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src[i]));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dest[i]),
+                        _mm256_shuffle_epi8(wide, shufmask256));
+  }
+#endif
+  for (; i + 4 <= count; i += 4) {
     __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
     __m128i output = _mm_shuffle_epi8(input, shufmask);
     _mm_storeu_si128(reinterpret_cast<__m128i*>(&dest[i]), output);
@@ -142,8 +177,16 @@ void copy_and_swap_64_aligned(void* dest_ptr, const void* src_ptr, size_t count)
   __m128i shufmask = _mm_set_epi8(0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02,
                                   0x03, 0x04, 0x05, 0x06, 0x07);
 
-  size_t i;
-  for (i = 0; i + 2 <= count; i += 2) {
+  size_t i = 0;
+#if defined(__AVX2__)
+  const __m256i shufmask256 = _mm256_broadcastsi128_si256(shufmask);
+  for (; i + 4 <= count; i += 4) {
+    __m256i wide = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src[i]));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dest[i]),
+                        _mm256_shuffle_epi8(wide, shufmask256));
+  }
+#endif
+  for (; i + 2 <= count; i += 2) {
     __m128i input = _mm_load_si128(reinterpret_cast<const __m128i*>(&src[i]));
     __m128i output = _mm_shuffle_epi8(input, shufmask);
     _mm_store_si128(reinterpret_cast<__m128i*>(&dest[i]), output);
@@ -160,8 +203,16 @@ void copy_and_swap_64_unaligned(void* dest_ptr, const void* src_ptr, size_t coun
   __m128i shufmask = _mm_set_epi8(0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02,
                                   0x03, 0x04, 0x05, 0x06, 0x07);
 
-  size_t i;
-  for (i = 0; i + 2 <= count; i += 2) {
+  size_t i = 0;
+#if defined(__AVX2__)
+  const __m256i shufmask256 = _mm256_broadcastsi128_si256(shufmask);
+  for (; i + 4 <= count; i += 4) {
+    __m256i wide = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src[i]));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dest[i]),
+                        _mm256_shuffle_epi8(wide, shufmask256));
+  }
+#endif
+  for (; i + 2 <= count; i += 2) {
     __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
     __m128i output = _mm_shuffle_epi8(input, shufmask);
     _mm_storeu_si128(reinterpret_cast<__m128i*>(&dest[i]), output);
@@ -175,8 +226,15 @@ void copy_and_swap_64_unaligned(void* dest_ptr, const void* src_ptr, size_t coun
 void copy_and_swap_16_in_32_aligned(void* dest_ptr, const void* src_ptr, size_t count) {
   auto dest = reinterpret_cast<uint32_t*>(dest_ptr);
   auto src = reinterpret_cast<const uint32_t*>(src_ptr);
-  size_t i;
-  for (i = 0; i + 4 <= count; i += 4) {
+  size_t i = 0;
+#if defined(__AVX2__)
+  for (; i + 8 <= count; i += 8) {
+    __m256i wide = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src[i]));
+    __m256i rotated = _mm256_or_si256(_mm256_slli_epi32(wide, 16), _mm256_srli_epi32(wide, 16));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dest[i]), rotated);
+  }
+#endif
+  for (; i + 4 <= count; i += 4) {
     __m128i input = _mm_load_si128(reinterpret_cast<const __m128i*>(&src[i]));
     __m128i output = _mm_or_si128(_mm_slli_epi32(input, 16), _mm_srli_epi32(input, 16));
     _mm_store_si128(reinterpret_cast<__m128i*>(&dest[i]), output);
@@ -190,8 +248,15 @@ void copy_and_swap_16_in_32_aligned(void* dest_ptr, const void* src_ptr, size_t
 void copy_and_swap_16_in_32_unaligned(void* dest_ptr, const void* src_ptr, size_t count) {
   auto dest = reinterpret_cast<uint32_t*>(dest_ptr);
   auto src = reinterpret_cast<const uint32_t*>(src_ptr);
-  size_t i;
-  for (i = 0; i + 4 <= count; i += 4) {
+  size_t i = 0;
+#if defined(__AVX2__)
+  for (; i + 8 <= count; i += 8) {
+    __m256i wide = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src[i]));
+    __m256i rotated = _mm256_or_si256(_mm256_slli_epi32(wide, 16), _mm256_srli_epi32(wide, 16));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dest[i]), rotated);
+  }
+#endif
+  for (; i + 4 <= count; i += 4) {
     __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
     __m128i output = _mm_or_si128(_mm_slli_epi32(input, 16), _mm_srli_epi32(input, 16));
     _mm_storeu_si128(reinterpret_cast<__m128i*>(&dest[i]), output);
@@ -202,6 +267,53 @@ void copy_and_swap_16_in_32_unaligned(void* dest_ptr, const void* src_ptr, size_
   }
 }
 
+size_t count_matching_8(const void* a_ptr, const void* b_ptr, size_t count) {
+  auto a = reinterpret_cast<const uint8_t*>(a_ptr);
+  auto b = reinterpret_cast<const uint8_t*>(b_ptr);
+  size_t matched = 0;
+  size_t i = 0;
+#if defined(__AVX2__)
+  for (; i + 32 <= count; i += 32) {
+    __m256i eq = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&a[i])),
+                                   _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&b[i])));
+    matched += rex::bit_count(uint32_t(_mm256_movemask_epi8(eq)));
+  }
+#endif
+  for (; i + 16 <= count; i += 16) {
+    __m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&a[i])),
+                                _mm_loadu_si128(reinterpret_cast<const __m128i*>(&b[i])));
+    matched += rex::bit_count(uint32_t(_mm_movemask_epi8(eq)));
+  }
+  for (; i < count; ++i) {  // handle residual elements
+    matched += a[i] == b[i];
+  }
+  return matched;
+}
+
+size_t count_equal_32(const void* src_ptr, size_t count, uint32_t value) {
+  auto src = reinterpret_cast<const uint32_t*>(src_ptr);
+  size_t matched = 0;
+  size_t i = 0;
+#if defined(__AVX2__)
+  const __m256i pattern256 = _mm256_set1_epi32(int32_t(value));
+  for (; i + 8 <= count; i += 8) {
+    __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src[i])),
+                                    pattern256);
+    matched += rex::bit_count(uint32_t(_mm256_movemask_ps(_mm256_castsi256_ps(eq))));
+  }
+#endif
+  const __m128i pattern = _mm_set1_epi32(int32_t(value));
+  for (; i + 4 <= count; i += 4) {
+    __m128i eq =
+        _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i])), pattern);
+    matched += rex::bit_count(uint32_t(_mm_movemask_ps(_mm_castsi128_ps(eq))));
+  }
+  for (; i < count; ++i) {  // handle residual elements
+    matched += src[i] == value;
+  }
+  return matched;
+}
+
 #elif REX_ARCH_ARM64
 
 // Although NEON offers vector rev instructions (like vrev32q_u8), they are
@@ -318,6 +430,56 @@ void copy_and_swap_16_in_32_unaligned(void* dst_ptr, const void* src_ptr, size_t
   }
 }
 
+size_t count_matching_8(const void* a_ptr, const void* b_ptr, size_t count) {
+  auto a = reinterpret_cast<const uint8_t*>(a_ptr);
+  auto b = reinterpret_cast<const uint8_t*>(b_ptr);
+
+  const uint8x16_t ones = vdupq_n_u8(1);
+
+  size_t matched = 0;
+  while (count >= 16) {
+    uint8x16_t eq = vceqq_u8(vld1q_u8(a), vld1q_u8(b));
+    matched += vaddlvq_u8(vandq_u8(eq, ones));
+
+    count -= 16;
+    a += 16;
+    b += 16;
+  }
+
+  while (count > 0) {
+    matched += *a == *b;
+
+    count--;
+    a++;
+    b++;
+  }
+  return matched;
+}
+
+size_t count_equal_32(const void* src_ptr, size_t count, uint32_t value) {
+  auto src = reinterpret_cast<const uint8_t*>(src_ptr);
+
+  const uint32x4_t pattern = vdupq_n_u32(value);
+  const uint32x4_t ones = vdupq_n_u32(1);
+
+  size_t matched = 0;
+  while (count >= 4) {
+    uint32x4_t eq = vceqq_u32(vld1q_u32(reinterpret_cast<const uint32_t*>(src)), pattern);
+    matched += vaddvq_u32(vandq_u32(eq, ones));
+
+    count -= 4;
+    src += 16;
+  }
+
+  while (count > 0) {
+    matched += load<uint32_t>(src) == value;
+
+    count--;
+    src += 4;
+  }
+  return matched;
+}
+
 #else
 
 // Generic routines.
@@ -374,6 +536,26 @@ void copy_and_swap_16_in_32_unaligned(void* dst_ptr, const void* src_ptr, size_t
   }
 }
 
+size_t count_matching_8(const void* a_ptr, const void* b_ptr, size_t count) {
+  auto a = reinterpret_cast<const uint8_t*>(a_ptr);
+  auto b = reinterpret_cast<const uint8_t*>(b_ptr);
+  size_t matched = 0;
+  // Branchless so the compiler can vectorize.
+  for (size_t i = 0; i < count; ++i) {
+    matched += a[i] == b[i];
+  }
+  return matched;
+}
+
+size_t count_equal_32(const void* src_ptr, size_t count, uint32_t value) {
+  auto src = reinterpret_cast<const uint32_t*>(src_ptr);
+  size_t matched = 0;
+  for (size_t i = 0; i < count; ++i) {
+    matched += src[i] == value;
+  }
+  return matched;
+}
+
 #endif
 
 }  // namespace memory
@@ -19,6 +19,7 @@
 #include <fcntl.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <unistd.h>
 
 #include <rex/math.h>
@@ -331,6 +332,49 @@ bool Protect(void* base_address, size_t length, PageAccess access, PageAccess* o
   return mprotect(base_address, length, prot) == 0;
 }
 
+bool AdviseHugePages(void* base_address, size_t length) {
+#if REX_PLATFORM_LINUX && defined(MADV_HUGEPAGE)
+  // Align inward to 2 MB: madvise is fine with smaller alignment, but khugepaged
+  // can only collapse fully-covered huge-page-sized extents anyway.
+  constexpr uintptr_t kHugePageSize = 2u * 1024 * 1024;
+  uintptr_t begin = (reinterpret_cast<uintptr_t>(base_address) + kHugePageSize - 1) &
+                    ~(kHugePageSize - 1);
+  uintptr_t end = (reinterpret_cast<uintptr_t>(base_address) + length) & ~(kHugePageSize - 1);
+  if (begin >= end) {
+    return false;
+  }
+  // Fails with EINVAL on kernels without THP (or, for shmem mappings like the
+  // guest space, with shmem_enabled=never) - the range then keeps 4 KB pages.
+  return madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE) == 0;
+#else
+  // No transparent-huge-page equivalent to retrofit onto an existing mapping
+  // on this platform.
+  (void)base_address;
+  (void)length;
+  return false;
+#endif
+}
+
+bool BindToNumaNode(void* base_address, size_t length, uint32_t node) {
+#if REX_PLATFORM_LINUX && defined(SYS_mbind)
+  // Raw syscall instead of a libnuma dependency; numaif.h isn't guaranteed
+  // to be installed either, so the two constants are spelled out.
+  constexpr int kMpolBind = 2;          // MPOL_BIND
+  constexpr unsigned kMpolMfMove = 2;   // MPOL_MF_MOVE: migrate already-faulted pages
+  if (node >= 64) {
+    return false;
+  }
+  unsigned long nodemask = 1ul << node;
+  return syscall(SYS_mbind, base_address, length, kMpolBind, &nodemask,
+                 sizeof(nodemask) * 8, kMpolMfMove) == 0;
+#else
+  (void)base_address;
+  (void)length;
+  (void)node;
+  return false;
+#endif
+}
+
 bool QueryProtect(void* base_address, size_t& length, PageAccess& access_out) {
 #if !REX_PLATFORM_LINUX
   access_out = PageAccess::kNoAccess;
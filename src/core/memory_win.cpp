@@ -154,6 +154,26 @@ bool Protect(void* base_address, size_t length, PageAccess access, PageAccess* o
   return true;
 }
 
+bool AdviseHugePages(void* base_address, size_t length) {
+  // Windows large pages (MEM_LARGE_PAGES) must be requested when the memory
+  // is allocated, need SeLockMemoryPrivilege, and can't be retrofitted onto
+  // an existing section view like the guest address space - so there is
+  // nothing advisory to do here. Callers fall back to 4 KB pages.
+  (void)base_address;
+  (void)length;
+  return false;
+}
+
+bool BindToNumaNode(void* base_address, size_t length, uint32_t node) {
+  // Windows NUMA placement (VirtualAllocExNuma / CreateFileMappingNuma) is
+  // chosen at allocation time; an existing section view can't be re-bound.
+  // First-touch placement applies instead.
+  (void)base_address;
+  (void)length;
+  (void)node;
+  return false;
+}
+
 bool QueryProtect(void* base_address, size_t& length, PageAccess& access_out) {
   access_out = PageAccess::kNoAccess;
 
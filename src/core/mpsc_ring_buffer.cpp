@@ -0,0 +1,173 @@
+/**
+ * @file        core/mpsc_ring_buffer.cpp
+ * @brief       Multi-producer single-consumer byte ring with batched reservation
+ *
+ * @copyright   Copyright (c) 2026 Tom Clay <tomc@tctechstuff.com>
+ *              All rights reserved.
+ *
+ * @license     BSD 3-Clause License
+ *              See LICENSE file in the project root for full license text.
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include <rex/assert.h>
+#include <rex/memory/mpsc_ring_buffer.h>
+#include <rex/thread.h>
+
+namespace rex::memory {
+
+namespace {
+
+constexpr uint64_t AlignRecord(uint64_t size) {
+  return (size + 7) & ~uint64_t(7);
+}
+
+}  // namespace
+
+MpscRingBuffer::MpscRingBuffer(size_t capacity) {
+  capacity_ = std::bit_ceil(std::max(capacity, size_t(64)));
+  capacity_mask_ = capacity_ - 1;
+  // uint64_t storage keeps every (8-byte aligned) record header a single
+  // naturally aligned word.
+  storage_ = std::make_unique<uint64_t[]>(capacity_ / sizeof(uint64_t));
+  buffer_ = reinterpret_cast<uint8_t*>(storage_.get());
+}
+
+// Headers are only read below the commit cursor and only written above it,
+// so the cursor's release/acquire pair is what orders them; the atomic_ref
+// just keeps the word access tear-free.
+uint64_t MpscRingBuffer::LoadHeader(uint64_t offset) const {
+  auto* header = reinterpret_cast<uint64_t*>(buffer_ + (size_t(offset) & capacity_mask_));
+  return std::atomic_ref<uint64_t>(*header).load(std::memory_order_relaxed);
+}
+
+void MpscRingBuffer::StoreHeader(uint64_t offset, uint64_t value) {
+  auto* header = reinterpret_cast<uint64_t*>(buffer_ + (size_t(offset) & capacity_mask_));
+  std::atomic_ref<uint64_t>(*header).store(value, std::memory_order_relaxed);
+}
+
+bool MpscRingBuffer::TryReserve(size_t size, Reservation* out_reservation) {
+  assert_not_zero(size);
+  uint64_t total = kHeaderSize + AlignRecord(size);
+  assert_true(total <= capacity_);
+
+  uint64_t offset = reserve_offset_.load(std::memory_order_relaxed);
+  do {
+    if (offset + total - read_offset_.load(std::memory_order_acquire) > capacity_) {
+      return false;
+    }
+  } while (!reserve_offset_.compare_exchange_weak(offset, offset + total,
+                                                  std::memory_order_acq_rel,
+                                                  std::memory_order_relaxed));
+
+  out_reservation->offset = offset;
+  out_reservation->size = uint32_t(size);
+  size_t index = size_t(offset + kHeaderSize) & capacity_mask_;
+  if (index + size <= capacity_) {
+    out_reservation->first = buffer_ + index;
+    out_reservation->first_length = size;
+    out_reservation->second = nullptr;
+    out_reservation->second_length = 0;
+  } else {
+    out_reservation->first = buffer_ + index;
+    out_reservation->first_length = capacity_ - index;
+    out_reservation->second = buffer_;
+    out_reservation->second_length = size - (capacity_ - index);
+  }
+  return true;
+}
+
+void MpscRingBuffer::Reserve(size_t size, Reservation* out_reservation) {
+  while (!TryReserve(size, out_reservation)) {
+    rex::thread::MaybeYield();
+  }
+}
+
+void MpscRingBuffer::Commit(const Reservation& reservation) {
+  StoreHeader(reservation.offset, reservation.size);
+  // Publish strictly in reservation order: wait for every earlier reservation
+  // to land, then advance the cursor over ours. The wait is bounded by the
+  // time the other producers spend filling their spans. The release store
+  // publishes the payload bytes along with the header.
+  while (commit_offset_.load(std::memory_order_acquire) != reservation.offset) {
+    rex::thread::MaybeYield();
+  }
+  commit_offset_.store(reservation.offset + kHeaderSize + AlignRecord(reservation.size),
+                       std::memory_order_release);
+  if (drain_waiting_.load()) {
+    // Taking the lock orders the notify against a consumer that is between
+    // setting the flag and sleeping; the bounded wait covers the rest.
+    std::lock_guard<std::mutex> lock(drain_mutex_);
+    drain_cond_.notify_one();
+  }
+}
+
+bool MpscRingBuffer::TryWrite(const void* data, size_t size) {
+  Reservation reservation;
+  if (!TryReserve(size, &reservation)) {
+    return false;
+  }
+  reservation.CopyIn(data, size);
+  Commit(reservation);
+  return true;
+}
+
+void MpscRingBuffer::Reservation::CopyIn(const void* data, size_t size) {
+  const uint8_t* src = static_cast<const uint8_t*>(data);
+  size_t first_copy = std::min(size, first_length);
+  std::memcpy(first, src, first_copy);
+  if (size > first_copy) {
+    std::memcpy(second, src + first_copy, size - first_copy);
+  }
+}
+
+size_t MpscRingBuffer::CopyReady(uint8_t* buffer, size_t buffer_size) {
+  size_t copied = 0;
+  uint64_t offset = read_offset_.load(std::memory_order_relaxed);
+  uint64_t committed = commit_offset_.load(std::memory_order_acquire);
+  while (offset != committed) {
+    size_t size = size_t(LoadHeader(offset));
+    if (copied + size > buffer_size) {
+      break;
+    }
+    size_t index = size_t(offset + kHeaderSize) & capacity_mask_;
+    if (index + size <= capacity_) {
+      std::memcpy(buffer + copied, buffer_ + index, size);
+    } else {
+      size_t first_length = capacity_ - index;
+      std::memcpy(buffer + copied, buffer_ + index, first_length);
+      std::memcpy(buffer + copied + first_length, buffer_, size - first_length);
+    }
+    copied += size;
+    offset += kHeaderSize + AlignRecord(size);
+  }
+  // Release so producers' free-space check can't see the cursor move before
+  // the payload copies above are done with the bytes.
+  read_offset_.store(offset, std::memory_order_release);
+  return copied;
+}
+
+size_t MpscRingBuffer::Drain(uint8_t* buffer, size_t buffer_size, std::chrono::milliseconds wait) {
+  size_t copied = CopyReady(buffer, buffer_size);
+  if (copied || wait <= std::chrono::milliseconds::zero()) {
+    return copied;
+  }
+  drain_waiting_.store(true);
+  // Recheck after raising the flag so a commit that raced the store above
+  // isn't slept on; mirrors the parked-writer pattern in CommandProcessor.
+  copied = CopyReady(buffer, buffer_size);
+  if (!copied) {
+    std::unique_lock<std::mutex> lock(drain_mutex_);
+    drain_cond_.wait_for(lock, wait);
+  }
+  drain_waiting_.store(false);
+  if (!copied) {
+    copied = CopyReady(buffer, buffer_size);
+  }
+  return copied;
+}
+
+}  // namespace rex::memory
@@ -11,8 +11,51 @@
 
 #include <rex/thread/mutex.h>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
 namespace rex::thread {
 
+namespace {
+
+inline void SpinPause() {
+#if defined(__x86_64__) || defined(_M_X64)
+  _mm_pause();
+#elif defined(__aarch64__) || defined(_M_ARM64)
+  asm volatile("yield" ::: "memory");
+#endif
+}
+
+}  // namespace
+
+void mutex::LockContended() {
+  contended_.fetch_add(1, std::memory_order_relaxed);
+
+  // Bounded exponential spin: 1 + 2 + ... + 64 pauses is a few hundred
+  // nanoseconds, comfortably longer than the typical hold time, while still
+  // bailing to a park quickly when the owner is actually blocked.
+  for (uint32_t spins = 1; spins <= 64; spins *= 2) {
+    for (uint32_t i = 0; i < spins; ++i) {
+      SpinPause();
+    }
+    if (state_.load(std::memory_order_relaxed) == kUnlocked) {
+      uint32_t expected = kUnlocked;
+      if (state_.compare_exchange_weak(expected, kLocked, std::memory_order_acquire,
+                                       std::memory_order_relaxed)) {
+        return;
+      }
+    }
+  }
+
+  // Park. We advertise a waiter by taking the lock with kLockedWaiters so the
+  // eventual unlock() knows to notify; the state may then over-report waiters
+  // for one unlock, which costs a spurious notify at worst.
+  while (state_.exchange(kLockedWaiters, std::memory_order_acquire) != kUnlocked) {
+    state_.wait(kLockedWaiters, std::memory_order_relaxed);
+  }
+}
+
 std::recursive_mutex& global_critical_region::mutex() {
   static std::recursive_mutex global_mutex;
   return global_mutex;
@@ -1,19 +1,271 @@
 /**
  * SHA256 hashing utilities implementation
  *
- * Uses picosha2 header-only library for SHA256 computation.
+ * Uses the hardware SHA-256 instructions (x86 SHA-NI, ARMv8 crypto
+ * extensions) when the CPU reports them at runtime, falling back to the
+ * portable picosha2 header-only library otherwise.
  */
 
 #include "thirdparty/picosha2/picosha2.h"
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
-#include <sstream>
+#include <vector>
 
 #include <rex/crypto/sha256.h>
 
+#if defined(__x86_64__) && (defined(__clang__) || defined(__GNUC__))
+#define REX_SHA256_X86_SHA_NI 1
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__) && (defined(__clang__) || defined(__GNUC__))
+#define REX_SHA256_ARM_SHA2 1
+#include <arm_neon.h>
+#if defined(__linux__)
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+#endif
+
 namespace rex::crypto {
 
+namespace {
+
+#if defined(REX_SHA256_X86_SHA_NI) || defined(REX_SHA256_ARM_SHA2)
+
+// FIPS 180-4 round constants (the same table picosha2 uses).
+alignas(16) constexpr uint32_t kRoundConstants[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+#if defined(REX_SHA256_X86_SHA_NI)
+
+__attribute__((target("sha,sse4.1"))) void ProcessBlocks(uint32_t state[8], const uint8_t* data,
+                                                         size_t block_count) {
+  const __m128i kShuffleMask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+  // The SHA instructions want the state split into {a,b,e,f} and {c,d,g,h}.
+  __m128i tmp =
+      _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0])), 0xB1);
+  __m128i state1 =
+      _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4])), 0x1B);
+  __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+  state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+  while (block_count--) {
+    __m128i abef_save = state0;
+    __m128i cdgh_save = state1;
+
+    __m128i msgs[4];
+    for (int i = 0; i < 4; ++i) {
+      msgs[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 16)),
+                                 kShuffleMask);
+    }
+
+    // 16 groups of 4 rounds each, with the message schedule for group j
+    // derived in place from groups j-4 through j-1.
+    for (int j = 0; j < 16; ++j) {
+      if (j >= 4) {
+        __m128i& m0 = msgs[j & 3];
+        const __m128i m1 = msgs[(j + 1) & 3];
+        const __m128i m2 = msgs[(j + 2) & 3];
+        const __m128i m3 = msgs[(j + 3) & 3];
+        m0 = _mm_sha256msg1_epu32(m0, m1);
+        m0 = _mm_add_epi32(m0, _mm_alignr_epi8(m3, m2, 4));
+        m0 = _mm_sha256msg2_epu32(m0, m3);
+      }
+      __m128i wk = _mm_add_epi32(
+          msgs[j & 3], _mm_loadu_si128(reinterpret_cast<const __m128i*>(&kRoundConstants[j * 4])));
+      state1 = _mm_sha256rnds2_epu32(state1, state0, wk);
+      state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(wk, 0x0E));
+    }
+
+    state0 = _mm_add_epi32(state0, abef_save);
+    state1 = _mm_add_epi32(state1, cdgh_save);
+    data += 64;
+  }
+
+  // Back to the {a..d}, {e..h} layout.
+  tmp = _mm_shuffle_epi32(state0, 0x1B);
+  state1 = _mm_shuffle_epi32(state1, 0xB1);
+  state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+  state1 = _mm_alignr_epi8(state1, tmp, 8);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), state0);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), state1);
+}
+
+bool HardwareSha256Supported() {
+  static const bool supported = [] {
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+      return false;
+    }
+    return (ebx & (1u << 29)) != 0;  // SHA extensions.
+  }();
+  return supported;
+}
+
+#elif defined(REX_SHA256_ARM_SHA2)
+
+__attribute__((target("+sha2"))) void ProcessBlocks(uint32_t state[8], const uint8_t* data,
+                                                    size_t block_count) {
+  uint32x4_t state0 = vld1q_u32(&state[0]);
+  uint32x4_t state1 = vld1q_u32(&state[4]);
+
+  while (block_count--) {
+    uint32x4_t abcd_save = state0;
+    uint32x4_t efgh_save = state1;
+
+    uint32x4_t msgs[4];
+    for (int i = 0; i < 4; ++i) {
+      msgs[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + i * 16)));
+    }
+
+    // 16 groups of 4 rounds each; after group j is consumed its register is
+    // rotated forward into the schedule for group j+4.
+    for (int j = 0; j < 16; ++j) {
+      uint32x4_t wk = vaddq_u32(msgs[j & 3], vld1q_u32(&kRoundConstants[j * 4]));
+      if (j < 12) {
+        msgs[j & 3] = vsha256su1q_u32(vsha256su0q_u32(msgs[j & 3], msgs[(j + 1) & 3]),
+                                      msgs[(j + 2) & 3], msgs[(j + 3) & 3]);
+      }
+      uint32x4_t tmp = state0;
+      state0 = vsha256hq_u32(state0, state1, wk);
+      state1 = vsha256h2q_u32(state1, tmp, wk);
+    }
+
+    state0 = vaddq_u32(state0, abcd_save);
+    state1 = vaddq_u32(state1, efgh_save);
+    data += 64;
+  }
+
+  vst1q_u32(&state[0], state0);
+  vst1q_u32(&state[4], state1);
+}
+
+bool HardwareSha256Supported() {
+#if defined(__APPLE__)
+  // All arm64 Apple devices implement the SHA-2 extensions.
+  return true;
+#elif defined(__linux__)
+  static const bool supported = (getauxval(AT_HWCAP) & HWCAP_SHA2) != 0;
+  return supported;
+#else
+  return false;
+#endif
+}
+
+#endif
+
+// Incremental SHA-256 over the hardware block function.
+struct HardwareSha256 {
+  uint32_t state[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                       0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+  uint8_t block[64];
+  size_t block_used = 0;
+  uint64_t total_length = 0;
+
+  void Update(const void* data, size_t length) {
+    auto bytes = static_cast<const uint8_t*>(data);
+    total_length += length;
+    if (block_used) {
+      size_t fill = std::min(length, sizeof(block) - block_used);
+      std::memcpy(block + block_used, bytes, fill);
+      block_used += fill;
+      bytes += fill;
+      length -= fill;
+      if (block_used == sizeof(block)) {
+        ProcessBlocks(state, block, 1);
+        block_used = 0;
+      }
+    }
+    size_t whole_blocks = length / sizeof(block);
+    if (whole_blocks) {
+      ProcessBlocks(state, bytes, whole_blocks);
+      bytes += whole_blocks * sizeof(block);
+      length -= whole_blocks * sizeof(block);
+    }
+    if (length) {
+      std::memcpy(block, bytes, length);
+      block_used = length;
+    }
+  }
+
+  void Finish(uint8_t digest[32]) {
+    uint64_t bit_length = total_length * 8;
+    const uint8_t kPad = 0x80;
+    const uint8_t kZero = 0;
+    Update(&kPad, 1);
+    while (block_used != 56) {
+      Update(&kZero, 1);
+    }
+    uint8_t length_bytes[8];
+    for (int i = 0; i < 8; ++i) {
+      length_bytes[i] = uint8_t(bit_length >> ((7 - i) * 8));
+    }
+    Update(length_bytes, 8);
+    for (int i = 0; i < 8; ++i) {
+      digest[i * 4 + 0] = uint8_t(state[i] >> 24);
+      digest[i * 4 + 1] = uint8_t(state[i] >> 16);
+      digest[i * 4 + 2] = uint8_t(state[i] >> 8);
+      digest[i * 4 + 3] = uint8_t(state[i]);
+    }
+  }
+};
+
+std::string DigestToHexString(const uint8_t digest[32]) {
+  static const char kHexDigits[] = "0123456789abcdef";
+  std::string hex(64, '0');
+  for (size_t i = 0; i < 32; ++i) {
+    hex[i * 2] = kHexDigits[digest[i] >> 4];
+    hex[i * 2 + 1] = kHexDigits[digest[i] & 0xF];
+  }
+  return hex;
+}
+
+#endif  // REX_SHA256_X86_SHA_NI || REX_SHA256_ARM_SHA2
+
+}  // namespace
+
+bool sha256_hardware_supported() {
+#if defined(REX_SHA256_X86_SHA_NI) || defined(REX_SHA256_ARM_SHA2)
+  return HardwareSha256Supported();
+#else
+  return false;
+#endif
+}
+
+void sha256_process_blocks(uint32_t state[8], const uint8_t* data, size_t block_count) {
+#if defined(REX_SHA256_X86_SHA_NI) || defined(REX_SHA256_ARM_SHA2)
+  ProcessBlocks(state, data, block_count);
+#else
+  // Callers must check sha256_hardware_supported() first.
+  (void)state;
+  (void)data;
+  (void)block_count;
+#endif
+}
+
 std::string sha256(std::string_view data) {
+#if defined(REX_SHA256_X86_SHA_NI) || defined(REX_SHA256_ARM_SHA2)
+  if (HardwareSha256Supported()) {
+    HardwareSha256 hasher;
+    hasher.Update(data.data(), data.size());
+    uint8_t digest[32];
+    hasher.Finish(digest);
+    return DigestToHexString(digest);
+  }
+#endif
   std::string hash_hex;
   picosha2::hash256_hex_string(data.begin(), data.end(), hash_hex);
   return hash_hex;
@@ -24,9 +276,28 @@ std::string sha256_file(const std::filesystem::path& path) {
   if (!file) {
     return "";
   }
-  std::ostringstream ss;
-  ss << file.rdbuf();
-  return sha256(ss.str());
+  // Stream in chunks rather than reading the whole file into memory - the
+  // basefiles hashed at startup can be hundreds of megabytes.
+  std::vector<char> buffer(1 << 20);
+#if defined(REX_SHA256_X86_SHA_NI) || defined(REX_SHA256_ARM_SHA2)
+  if (HardwareSha256Supported()) {
+    HardwareSha256 hasher;
+    while (file) {
+      file.read(buffer.data(), std::streamsize(buffer.size()));
+      hasher.Update(buffer.data(), size_t(file.gcount()));
+    }
+    uint8_t digest[32];
+    hasher.Finish(digest);
+    return DigestToHexString(digest);
+  }
+#endif
+  picosha2::hash256_one_by_one hasher;
+  while (file) {
+    file.read(buffer.data(), std::streamsize(buffer.size()));
+    hasher.process(buffer.begin(), buffer.begin() + file.gcount());
+  }
+  hasher.finish();
+  return picosha2::get_hash_hex_string(hasher);
 }
 
 }  // namespace rex::crypto
@@ -20,6 +20,8 @@
 
 #include <rex/string.h>
 
+#include <simde/x86/sse2.h>
+
 #define UTF_CPP_CPLUSPLUS 201703L
 #include <utf8.h>
 
@@ -27,12 +29,98 @@ namespace utfcpp = utf8;
 
 namespace rex::string {
 
+namespace {
+
+// Length of the leading run of ASCII bytes, validated 16 bytes at a time.
+size_t ascii_prefix_length(const char* data, size_t size) {
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    simde__m128i chunk = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(data + i));
+    if (simde_mm_movemask_epi8(chunk)) {
+      break;
+    }
+  }
+  for (; i < size && !(uint8_t(data[i]) & 0x80); ++i) {
+  }
+  return i;
+}
+
+// Length of the leading run of ASCII UTF-16 units, validated 8 units at a time.
+size_t ascii_prefix_length(const char16_t* data, size_t size) {
+  const simde__m128i high_mask = simde_mm_set1_epi16(int16_t(0xFF80));
+  const simde__m128i zero = simde_mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    simde__m128i chunk = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(data + i));
+    simde__m128i high = simde_mm_and_si128(chunk, high_mask);
+    if (simde_mm_movemask_epi8(simde_mm_cmpeq_epi16(high, zero)) != 0xFFFF) {
+      break;
+    }
+  }
+  for (; i < size && data[i] < 0x80; ++i) {
+  }
+  return i;
+}
+
+// Narrows count ASCII UTF-16 units to bytes, 16 units per step.
+void narrow_ascii(const char16_t* data, size_t count, char* out) {
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    simde__m128i lo = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(data + i));
+    simde__m128i hi = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(data + i + 8));
+    simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(out + i),
+                          simde_mm_packus_epi16(lo, hi));
+  }
+  for (; i < count; ++i) {
+    out[i] = char(data[i]);
+  }
+}
+
+// Widens count ASCII bytes to UTF-16 units, 16 bytes per step.
+void widen_ascii(const char* data, size_t count, char16_t* out) {
+  const simde__m128i zero = simde_mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    simde__m128i chunk = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(data + i));
+    simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(out + i),
+                          simde_mm_unpacklo_epi8(chunk, zero));
+    simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(out + i + 8),
+                          simde_mm_unpackhi_epi8(chunk, zero));
+  }
+  for (; i < count; ++i) {
+    out[i] = char16_t(uint8_t(data[i]));
+  }
+}
+
+}  // namespace
+
 std::string to_utf8(const std::u16string_view source) {
-  return utfcpp::utf16to8(source);
+  // Guest strings on the hot kernel paths (file paths, debug output) are
+  // overwhelmingly ASCII - validate and narrow those in 128-bit blocks and
+  // only hand the non-ASCII tail to the codepoint-wise converter.
+  size_t ascii = ascii_prefix_length(source.data(), source.size());
+  if (!ascii) {
+    return utfcpp::utf16to8(source);
+  }
+  std::string result(ascii, '\0');
+  narrow_ascii(source.data(), ascii, result.data());
+  if (ascii < source.size()) {
+    result += utfcpp::utf16to8(source.substr(ascii));
+  }
+  return result;
 }
 
 std::u16string to_utf16(const std::string_view source) {
-  return utfcpp::utf8to16(source);
+  size_t ascii = ascii_prefix_length(source.data(), source.size());
+  if (!ascii) {
+    return utfcpp::utf8to16(source);
+  }
+  std::u16string result(ascii, u'\0');
+  widen_ascii(source.data(), ascii, result.data());
+  if (ascii < source.size()) {
+    result += utfcpp::utf8to16(source.substr(ascii));
+  }
+  return result;
 }
 
 std::string_view trim_left(std::string_view sv, std::string_view chars) {
@@ -11,6 +11,9 @@
 
 #include <algorithm>
 #include <cstdarg>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
 
 #include <rex/assert.h>
 #include <rex/literals.h>
@@ -21,15 +24,71 @@ namespace rex::string {
 
 using namespace rex::literals;
 
+namespace {
+
+// Heap blocks released by destroyed StringBuffers, kept per thread so the
+// next buffer that outgrows its inline storage can reuse them instead of
+// hitting the allocator.
+struct PooledBlock {
+  char* data;
+  size_t capacity;
+};
+
+struct BlockPool {
+  static constexpr size_t kMaxBlocks = 8;
+
+  ~BlockPool() {
+    for (auto& block : blocks) {
+      std::free(block.data);
+    }
+  }
+
+  // Returns a block of at least *capacity bytes, updating *capacity to the
+  // actual size.
+  char* Acquire(size_t* capacity) {
+    for (auto it = blocks.begin(); it != blocks.end(); ++it) {
+      if (it->capacity >= *capacity) {
+        char* data = it->data;
+        *capacity = it->capacity;
+        blocks.erase(it);
+        return data;
+      }
+    }
+    auto data = reinterpret_cast<char*>(std::malloc(*capacity));
+    assert_not_null(data);
+    return data;
+  }
+
+  void Release(char* data, size_t capacity) {
+    if (blocks.size() < kMaxBlocks) {
+      blocks.push_back({data, capacity});
+    } else {
+      std::free(data);
+    }
+  }
+
+  std::vector<PooledBlock> blocks;
+};
+
+thread_local BlockPool block_pool;
+
+}  // namespace
+
 StringBuffer::StringBuffer(size_t initial_capacity) {
-  buffer_capacity_ = std::max(initial_capacity, static_cast<size_t>(16_KiB));
-  buffer_ = reinterpret_cast<char*>(std::malloc(buffer_capacity_));
-  assert_not_null(buffer_);
+  if (initial_capacity <= sizeof(inline_buffer_)) {
+    buffer_ = inline_buffer_;
+    buffer_capacity_ = sizeof(inline_buffer_);
+  } else {
+    buffer_capacity_ = initial_capacity;
+    buffer_ = block_pool.Acquire(&buffer_capacity_);
+  }
   buffer_[0] = 0;
 }
 
 StringBuffer::~StringBuffer() {
-  free(buffer_);
+  if (!is_inline()) {
+    block_pool.Release(buffer_, buffer_capacity_);
+  }
   buffer_ = nullptr;
 }
 
@@ -42,12 +101,15 @@ void StringBuffer::Grow(size_t additional_length) {
   if (buffer_offset_ + additional_length <= buffer_capacity_) {
     return;
   }
-  size_t old_capacity = buffer_capacity_;
-  size_t new_capacity =
-      std::max(rex::round_up(buffer_offset_ + additional_length, 16_KiB), old_capacity * 2);
-  auto new_buffer = std::realloc(buffer_, new_capacity);
-  assert_not_null(new_buffer);
-  buffer_ = reinterpret_cast<char*>(new_buffer);
+  size_t new_capacity = std::max(
+      rex::round_up(buffer_offset_ + additional_length, sizeof(inline_buffer_)),
+      buffer_capacity_ * 2);
+  char* new_buffer = block_pool.Acquire(&new_capacity);
+  std::memcpy(new_buffer, buffer_, buffer_offset_ + 1);
+  if (!is_inline()) {
+    block_pool.Release(buffer_, buffer_capacity_);
+  }
+  buffer_ = new_buffer;
   buffer_capacity_ = new_capacity;
 }
 
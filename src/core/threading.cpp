@@ -9,10 +9,17 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <bit>
 #include <thread>
 
+#include <rex/cvar.h>
 #include <rex/thread.h>
 
+REXCVAR_DEFINE_INT32(numa_node, -1, "Kernel",
+                     "Pin guest memory and guest hardware threads to this NUMA node "
+                     "(-1 = no placement policy). Avoids cross-node access storms on "
+                     "multi-socket hosts");
+
 namespace rex::thread {
 
 // =============================================================================
@@ -27,6 +34,31 @@ uint32_t logical_processor_count() {
   return value;
 }
 
+uint64_t guest_cpu_affinity_mask(uint32_t guest_cpu_index) {
+  int32_t node = REXCVAR_GET(numa_node);
+  if (node < 0) {
+    return uint64_t(1) << guest_cpu_index;
+  }
+  // Latched: the policy must not move threads between nodes mid-run.
+  static const uint64_t node_mask = numa_node_affinity_mask(uint32_t(node));
+  uint32_t node_cpu_count = uint32_t(std::popcount(node_mask));
+  if (node_cpu_count == 0) {
+    // Node doesn't exist (or topology unreadable) - fall back to the plain
+    // mapping rather than pinning everything to nothing.
+    return uint64_t(1) << guest_cpu_index;
+  }
+  // Give each guest hardware thread its own processor within the node,
+  // wrapping when the node has fewer than six. Guest threads 2i and 2i+1
+  // share a 360 core and land on adjacent node processors, which keeps them
+  // on SMT siblings on hosts that enumerate siblings adjacently.
+  uint32_t target = guest_cpu_index % node_cpu_count;
+  uint64_t mask = node_mask;
+  for (uint32_t i = 0; i < target; i++) {
+    mask &= mask - 1;
+  }
+  return mask & ~(mask - 1);  // Lowest remaining set bit.
+}
+
 thread_local uint32_t current_thread_id_ = UINT_MAX;
 
 uint32_t current_thread_id() {
@@ -23,8 +23,11 @@ static_assert(REX_PLATFORM_LINUX || REX_PLATFORM_MAC, "This file is POSIX-only")
 
 #include <array>
 #include <cstddef>
+#include <cstdio>
 #include <ctime>
+#include <fstream>
 #include <memory>
+#include <string>
 
 #include <pthread.h>
 #if !defined(__APPLE__)
@@ -142,6 +145,58 @@ void install_signal_handler(SignalType type) {
 // TODO(dougvj)
 void EnableAffinityConfiguration() {}
 
+uint32_t numa_node_count() {
+#if REX_PLATFORM_LINUX
+  // Nodes are exposed as /sys/devices/system/node/nodeN; present nodes are
+  // numbered densely on anything we care about, so count by probing.
+  uint32_t count = 0;
+  while (true) {
+    std::string path = "/sys/devices/system/node/node" + std::to_string(count);
+    if (access(path.c_str(), F_OK) != 0) {
+      break;
+    }
+    count++;
+  }
+  return count ? count : 1;
+#else
+  // macOS doesn't expose NUMA topology (or multi-node hardware) to userland.
+  return 1;
+#endif
+}
+
+uint64_t numa_node_affinity_mask(uint32_t node) {
+#if REX_PLATFORM_LINUX
+  std::string path = "/sys/devices/system/node/node" + std::to_string(node) + "/cpulist";
+  std::ifstream cpulist(path);
+  if (!cpulist.is_open()) {
+    return 0;
+  }
+  // Format is comma-separated ranges, e.g. "0-7,16-23".
+  uint64_t mask = 0;
+  std::string token;
+  while (std::getline(cpulist, token, ',')) {
+    unsigned int first = 0, last = 0;
+    int matched = std::sscanf(token.c_str(), "%u-%u", &first, &last);
+    if (matched < 1) {
+      continue;
+    }
+    if (matched < 2) {
+      last = first;
+    }
+    for (unsigned int cpu = first; cpu <= last && cpu < 64; cpu++) {
+      mask |= uint64_t(1) << cpu;
+    }
+  }
+  return mask;
+#else
+  if (node != 0) {
+    return 0;
+  }
+  uint32_t count = std::min(logical_processor_count(), 64u);
+  return count < 64 ? (uint64_t(1) << count) - 1 : ~uint64_t(0);
+#endif
+}
+
 // uint64_t ticks() { return mach_absolute_time(); }
 
 uint32_t current_thread_system_id() {
@@ -205,6 +260,35 @@ bool SetTlsValue(TlsHandle handle, uintptr_t value) {
          0;
 }
 
+#if defined(__x86_64__) || defined(__i386__)
+inline void wait_spin_pause() {
+  __builtin_ia32_pause();
+}
+#elif defined(__aarch64__)
+inline void wait_spin_pause() {
+  asm volatile("yield");
+}
+#else
+inline void wait_spin_pause() {}
+#endif
+
+void PreciseSleep(std::chrono::microseconds duration) {
+  if (duration.count() <= 0) {
+    MaybeYield();
+    return;
+  }
+  auto deadline = std::chrono::steady_clock::now() + duration;
+  // nanosleep overshoots by roughly a scheduler tick - stop it short of the
+  // deadline and spin on the clock for the tail.
+  constexpr std::chrono::microseconds kSpinWindow(500);
+  if (duration > kSpinWindow) {
+    Sleep(duration - kSpinWindow);
+  }
+  while (std::chrono::steady_clock::now() < deadline) {
+    wait_spin_pause();
+  }
+}
+
 class PosixConditionBase {
  public:
   virtual bool Signal() = 0;
@@ -213,14 +297,24 @@ class PosixConditionBase {
     bool executed;
     auto predicate = [this] { return this->signaled(); };
     auto lock = std::unique_lock<std::mutex>(mutex_);
+    // Briefly re-poll before parking: guest signal/wait pairs are usually
+    // microseconds apart, and catching the signal here keeps the whole
+    // exchange in user space. Zero-timeout polls must not linger.
+    if (timeout != std::chrono::milliseconds::zero()) {
+      for (int spin = 0; spin < kWaitSpinCount && !predicate(); ++spin) {
+        lock.unlock();
+        wait_spin_pause();
+        lock.lock();
+      }
+    }
     if (predicate()) {
       executed = true;
     } else {
       if (timeout == std::chrono::milliseconds::max()) {
-        cond_.wait(lock, predicate);
+        object_cond_.wait(lock, predicate);
         executed = true;  // Did not time out;
       } else {
-        executed = cond_.wait_for(lock, timeout, predicate);
+        executed = object_cond_.wait_for(lock, timeout, predicate);
       }
     }
     if (executed) {
@@ -254,6 +348,9 @@ class PosixConditionBase {
     std::unique_lock<std::mutex> lock(PosixConditionBase::mutex_);
 
     bool wait_success = true;
+    // Multi-object waiters park on the shared condition variable; track how
+    // many are there so signalers can skip notifying it when nobody is.
+    ++multi_waiter_count_;
     // If the timeout is infinite, wait without timeout.
     // The predicate will be checked before beginning the wait
     if (timeout == std::chrono::milliseconds::max()) {
@@ -262,6 +359,7 @@ class PosixConditionBase {
       // Wait with timeout.
       wait_success = PosixConditionBase::cond_.wait_for(lock, timeout, predicate);
     }
+    --multi_waiter_count_;
     if (wait_success) {
       auto first_signaled = std::numeric_limits<size_t>::max();
       for (auto i = 0u; i < handles.size(); ++i) {
@@ -284,14 +382,33 @@ class PosixConditionBase {
   virtual void* native_handle() const { return cond_.native_handle(); }
 
  protected:
+  static constexpr int kWaitSpinCount = 64;
+
   inline virtual bool signaled() const = 0;
   inline virtual void post_execution() = 0;
+
+  // Wakes waiters after a signaled-state change. Must be called with mutex_
+  // held. Single-object waiters park on this object's own condition variable,
+  // so an unrelated Signal() no longer wakes every waiter in the process; the
+  // shared condition variable only needs notifying while multi-object waiters
+  // are parked on it.
+  void NotifyStateChanged() {
+    object_cond_.notify_all();
+    if (multi_waiter_count_) {
+      cond_.notify_all();
+    }
+  }
+
+  std::condition_variable object_cond_;
   static std::condition_variable cond_;
   static std::mutex mutex_;
+  // Guarded by mutex_.
+  static uint32_t multi_waiter_count_;
 };
 
 std::condition_variable PosixConditionBase::cond_;
 std::mutex PosixConditionBase::mutex_;
+uint32_t PosixConditionBase::multi_waiter_count_ = 0;
 
 // There really is no native POSIX handle for a single wait/signal construct
 // pthreads is at a lower level with more handles for such a mechanism.
@@ -310,7 +427,7 @@ class PosixCondition<Event> : public PosixConditionBase {
   bool Signal() override {
     auto lock = std::unique_lock<std::mutex>(mutex_);
     signal_ = true;
-    cond_.notify_all();
+    NotifyStateChanged();
     return true;
   }
 
@@ -344,7 +461,7 @@ class PosixCondition<Semaphore> : public PosixConditionBase {
       if (out_previous_count)
         *out_previous_count = count_;
       count_ += release_count;
-      cond_.notify_all();
+      NotifyStateChanged();
       return true;
     }
     return false;
@@ -354,7 +471,7 @@ class PosixCondition<Semaphore> : public PosixConditionBase {
   inline bool signaled() const override { return count_ > 0; }
   inline void post_execution() override {
     count_--;
-    cond_.notify_all();
+    NotifyStateChanged();
   }
   uint32_t count_;
   const uint32_t maximum_count_;
@@ -378,7 +495,7 @@ class PosixCondition<Mutant> : public PosixConditionBase {
       --count_;
       // Free to be acquired by another thread
       if (count_ == 0) {
-        cond_.notify_all();
+        NotifyStateChanged();
       }
       return true;
     }
@@ -410,7 +527,7 @@ class PosixCondition<Timer> : public PosixConditionBase {
   bool Signal() override {
     std::lock_guard<std::mutex> lock(mutex_);
     signal_ = true;
-    cond_.notify_all();
+    NotifyStateChanged();
     return true;
   }
 
@@ -760,7 +877,7 @@ class PosixCondition<Thread> : public PosixConditionBase {
 
       exit_code_ = exit_code;
       signaled_ = true;
-      cond_.notify_all();
+      NotifyStateChanged();
     }
     if (is_current_thread) {
       pthread_exit(reinterpret_cast<void*>(exit_code));
@@ -1108,7 +1225,7 @@ void* PosixCondition<Thread>::ThreadStartRoutine(void* parameter) {
   std::unique_lock<std::mutex> lock(mutex_);
   thread->handle_.exit_code_ = 0;
   thread->handle_.signaled_ = true;
-  cond_.notify_all();
+  thread->handle_.NotifyStateChanged();
 
   current_thread_ = nullptr;
   return nullptr;
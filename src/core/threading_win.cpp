@@ -33,6 +33,22 @@ void EnableAffinityConfiguration() {
   SetProcessAffinityMask(process_handle, system_affinity_mask);
 }
 
+uint32_t numa_node_count() {
+  ULONG highest_node = 0;
+  if (!GetNumaHighestNodeNumber(&highest_node)) {
+    return 1;
+  }
+  return uint32_t(highest_node) + 1;
+}
+
+uint64_t numa_node_affinity_mask(uint32_t node) {
+  ULONGLONG mask = 0;
+  if (!GetNumaNodeProcessorMask(UCHAR(node), &mask)) {
+    return 0;
+  }
+  return uint64_t(mask);
+}
+
 uint32_t current_thread_system_id() {
   return static_cast<uint32_t>(GetCurrentThreadId());
 }
@@ -108,6 +124,45 @@ SleepResult AlertableSleep(std::chrono::microseconds duration) {
   return SleepResult::kSuccess;
 }
 
+typedef LONG(NTAPI* NtSetTimerResolutionFn)(ULONG desired_resolution, BOOLEAN set_resolution,
+                                            PULONG current_resolution);
+
+static void RequestPreciseTimerResolution() {
+  // At the default timer resolution Sleep rounds up to as much as ~15.6 ms.
+  // Request the 0.5 ms minimum once and never restore it - guest frame-pacing
+  // sleeps keep coming for the rest of the process lifetime once they start.
+  // Going through ntdll rather than timeBeginPeriod avoids both the winmm
+  // dependency and the 1 ms floor.
+  static const bool requested = [] {
+    auto nt_set_timer_resolution = reinterpret_cast<NtSetTimerResolutionFn>(
+        GetProcAddress(GetModuleHandleW(L"ntdll.dll"), "NtSetTimerResolution"));
+    if (!nt_set_timer_resolution) {
+      return false;
+    }
+    ULONG current_resolution;
+    return nt_set_timer_resolution(5000, TRUE, &current_resolution) >= 0;
+  }();
+  (void)requested;
+}
+
+void PreciseSleep(std::chrono::microseconds duration) {
+  if (duration.count() <= 0) {
+    MaybeYield();
+    return;
+  }
+  auto deadline = std::chrono::steady_clock::now() + duration;
+  // Coarse OS wait for the bulk, undershooting by the worst-case rounding of
+  // Sleep at the raised timer resolution, then a bounded spin for the tail.
+  constexpr std::chrono::microseconds kSpinWindow(2000);
+  if (duration > kSpinWindow) {
+    RequestPreciseTimerResolution();
+    ::Sleep(static_cast<DWORD>((duration - kSpinWindow).count() / 1000));
+  }
+  while (std::chrono::steady_clock::now() < deadline) {
+    YieldProcessor();
+  }
+}
+
 TlsHandle AllocateTlsHandle() {
   return TlsAlloc();
 }
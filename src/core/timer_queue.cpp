@@ -10,7 +10,10 @@
  */
 
 #include <algorithm>
+#include <array>
+#include <chrono>
 #include <forward_list>
+#include <limits>
 
 #include <disruptorplus/multi_threaded_claim_strategy.hpp>
 #include <disruptorplus/ring_buffer.hpp>
@@ -18,15 +21,151 @@
 #include <disruptorplus/spin_wait_strategy.hpp>
 
 #include <rex/assert.h>
+#include <rex/chrono/clock.h>
+#include <rex/cvar.h>
 #include <rex/thread.h>
 #include <rex/thread/timer_queue.h>
 
+REXCVAR_DEFINE_UINT64(timer_queue_slack_us, 500, "Kernel",
+                      "Timer coalescing slack in microseconds. Timers expiring within the same "
+                      "slack window are serviced in a single wakeup of the timer thread; a timer "
+                      "may fire up to twice this late but never early.")
+    .lifecycle(rex::cvar::Lifecycle::kRequiresRestart);
+
 namespace dp = disruptorplus;
 
 namespace rex::thread {
 
 using WaitItem = TimerQueueWaitItem;
 
+// Hierarchical timing wheel holding armed wait items. Level 0 has one slot
+// per slack-sized tick; each higher level spans kSlots times the level below
+// and cascades a slot's items back down when the cursor crosses its boundary.
+// Every item in a slot is serviced in the same wakeup, and a slot is only
+// drained once its tick has fully elapsed, so items never fire early - at
+// worst they fire two ticks late.
+class TimingWheel {
+ public:
+  using clock = WaitItem::clock;
+
+  explicit TimingWheel(clock::duration tick) : tick_(tick), current_tick_(TickOf(clock::now())) {}
+
+  // Files an item under the first tick at or after its due time. Items
+  // already due go straight to the ready list.
+  void Queue(std::shared_ptr<WaitItem> item) {
+    const int64_t fire_tick = FireTickOf(item->due_);
+    const int64_t delta = fire_tick - current_tick_;
+    if (delta <= 0) {
+      ready_.push_front(std::move(item));
+      return;
+    }
+    for (size_t level = 0; level < kLevels; ++level) {
+      if (delta < (int64_t(1) << (kSlotBits * (level + 1)))) {
+        const size_t slot = (fire_tick >> (kSlotBits * level)) & kSlotMask;
+        wheel_[level][slot].push_front(std::move(item));
+        return;
+      }
+    }
+    // Beyond the span of the top level (~2.3 hours at the default tick);
+    // rescanned when the top level wraps, which is always before it is due.
+    overflow_.push_front(std::move(item));
+  }
+
+  // Advances the cursor to `now` and returns every item whose tick has fully
+  // elapsed - one batch per wakeup, regardless of how many timers expired.
+  std::forward_list<std::shared_ptr<WaitItem>> TakeReady(clock::time_point now) {
+    const int64_t now_tick = TickOf(now);
+    while (current_tick_ < now_tick) {
+      ++current_tick_;
+      if ((current_tick_ & kSlotMask) == 0) {
+        Cascade(1);
+      }
+      ready_.splice_after(ready_.before_begin(), wheel_[0][current_tick_ & kSlotMask]);
+    }
+    auto ready = std::move(ready_);
+    ready_ = {};
+    return ready;
+  }
+
+  // Earliest point the dispatch thread must wake to service something, or
+  // time_point::max() when the wheel is empty. For levels above 0 the
+  // candidate is the cascade boundary of the next occupied slot - a
+  // conservative wakeup that re-files the slot's items at finer granularity
+  // and sleeps again. All levels must be considered: a level-0 slot can be
+  // due later than a higher level's cascade boundary, so the first occupied
+  // slot found is not necessarily the earliest wakeup.
+  clock::time_point NextDeadline() const {
+    if (!ready_.empty()) {
+      return clock::time_point::min();
+    }
+    int64_t best_tick = std::numeric_limits<int64_t>::max();
+    for (size_t level = 0; level < kLevels; ++level) {
+      const int64_t base = current_tick_ >> (kSlotBits * level);
+      for (int64_t d = 1; d <= int64_t(kSlots); ++d) {
+        if (!wheel_[level][(base + d) & kSlotMask].empty()) {
+          best_tick = std::min(best_tick, (base + d) << (kSlotBits * level));
+          // Later slots at this level are strictly later ticks.
+          break;
+        }
+      }
+    }
+    if (!overflow_.empty()) {
+      // Wake at the top-level wrap that rescans the overflow list.
+      const int64_t wrap = (current_tick_ >> (kSlotBits * kLevels)) + 1;
+      best_tick = std::min(best_tick, wrap << (kSlotBits * kLevels));
+    }
+    if (best_tick == std::numeric_limits<int64_t>::max()) {
+      return clock::time_point::max();
+    }
+    return clock::time_point(best_tick * tick_);
+  }
+
+ private:
+  static constexpr size_t kSlotBits = 6;
+  static constexpr size_t kSlots = size_t(1) << kSlotBits;  // 64
+  static constexpr size_t kSlotMask = kSlots - 1;
+  static constexpr size_t kLevels = 4;
+
+  int64_t TickOf(clock::time_point tp) const { return tp.time_since_epoch() / tick_; }
+  int64_t FireTickOf(clock::time_point tp) const {
+    // Round up so an item is never filed under a tick that elapses before it
+    // is due.
+    return (tp.time_since_epoch() + tick_ - clock::duration(1)) / tick_;
+  }
+
+  // Re-files the slot the cursor just entered at `level` down into finer
+  // levels (or the ready list); recurses upward on wrap.
+  void Cascade(size_t level) {
+    if (level >= kLevels) {
+      auto items = std::move(overflow_);
+      overflow_ = {};
+      while (!items.empty()) {
+        auto item = std::move(items.front());
+        items.pop_front();
+        Queue(std::move(item));
+      }
+      return;
+    }
+    const size_t slot = (current_tick_ >> (kSlotBits * level)) & kSlotMask;
+    if (slot == 0) {
+      Cascade(level + 1);
+    }
+    auto items = std::move(wheel_[level][slot]);
+    wheel_[level][slot] = {};
+    while (!items.empty()) {
+      auto item = std::move(items.front());
+      items.pop_front();
+      Queue(std::move(item));
+    }
+  }
+
+  clock::duration tick_;
+  int64_t current_tick_;
+  std::array<std::array<std::forward_list<std::shared_ptr<WaitItem>>, kSlots>, kLevels> wheel_;
+  std::forward_list<std::shared_ptr<WaitItem>> ready_;
+  std::forward_list<std::shared_ptr<WaitItem>> overflow_;
+};
+
 class TimerQueue {
  public:
   using clock = WaitItem::clock;
@@ -57,40 +196,37 @@ class TimerQueue {
 
   void TimerThreadMain(std::stop_token stop_token) {
     dp::sequence_t next_sequence = 0;
-    const auto comp = [](const std::shared_ptr<WaitItem>& left,
-                         const std::shared_ptr<WaitItem>& right) {
-      return left->due_ < right->due_;
-    };
 
     set_current_thread_name("rex::thread::TimerQueue");
 
+    // The slack is the wheel's tick: every timer landing in the same tick is
+    // serviced in one wakeup instead of one wakeup per timer.
+    const auto slack = std::chrono::duration_cast<clock::duration>(
+        std::chrono::microseconds(std::max<uint64_t>(uint64_t(1), REXCVAR_GET(timer_queue_slack_us))));
+    TimingWheel wheel(slack);
+
     while (!stop_token.stop_requested()) {
       {
-        // Consume new wait items and add them to sorted wait queue
+        // Consume new wait items and file them into the wheel
         dp::sequence_t available = claim_strategy_.wait_until_published(
-            next_sequence, next_sequence - 1,
-            wait_queue_.empty() ? clock::time_point::max() : wait_queue_.front()->due_);
+            next_sequence, next_sequence - 1, wheel.NextDeadline());
 
         // Check for timeout
         if (available != next_sequence - 1) {
-          std::forward_list<std::shared_ptr<WaitItem>> wait_items;
           do {
-            wait_items.push_front(std::move(buffer_[next_sequence]));
+            wheel.Queue(std::move(buffer_[next_sequence]));
           } while (next_sequence++ != available);
 
           consumed_.publish(available);
-
-          wait_items.sort(comp);
-          wait_queue_.merge(wait_items, comp);
         }
       }
 
       {
-        // Check wait queue, invoke callbacks and reschedule
-        std::forward_list<std::shared_ptr<WaitItem>> wait_items;
-        while (!wait_queue_.empty() && wait_queue_.front()->due_ <= clock::now()) {
-          auto wait_item = std::move(wait_queue_.front());
-          wait_queue_.pop_front();
+        // Service every tick that has elapsed, invoke callbacks and reschedule
+        auto wait_items = wheel.TakeReady(clock::now());
+        while (!wait_items.empty()) {
+          auto wait_item = std::move(wait_items.front());
+          wait_items.pop_front();
 
           // Ensure that it isn't disarmed
           auto state = WaitItem::State::kIdle;
@@ -107,7 +243,7 @@ class TimerQueue {
               wait_item->due_ += wait_item->interval_;
               wait_item->state_.store(WaitItem::State::kIdle, std::memory_order_release);
               wait_item->state_.notify_all();
-              wait_items.push_front(std::move(wait_item));
+              wheel.Queue(std::move(wait_item));
             } else {
               wait_item->state_.store(WaitItem::State::kDisarmed, std::memory_order_release);
               wait_item->state_.notify_all();
@@ -117,8 +253,6 @@ class TimerQueue {
             assert_true(WaitItem::State::kDisarmed == state);
           }
         }
-        wait_items.sort(comp);
-        wait_queue_.merge(wait_items, comp);
       }
     }
   }
@@ -126,6 +260,14 @@ class TimerQueue {
   std::weak_ptr<WaitItem> QueueTimer(std::shared_ptr<WaitItem> wait_item) {
     auto wait_item_weak = std::weak_ptr<WaitItem>(wait_item);
 
+    // Virtual tick mode runs the guest flat out: deadlines derived from the
+    // (decoupled) guest clock can land far in the host future, so expire
+    // everything on the next dispatch wakeup instead of pacing against wall
+    // time.
+    if (chrono::Clock::virtual_tick_enabled()) {
+      wait_item->due_ = clock::now();
+    }
+
     // Mitigate callback flooding
     wait_item->due_ = std::max(clock::now() - wait_item->interval_, wait_item->due_);
 
@@ -146,9 +288,7 @@ class TimerQueue {
   dp::multi_threaded_claim_strategy<dp::spin_wait_strategy> claim_strategy_;
   dp::sequence_barrier<dp::spin_wait_strategy> consumed_;
 
-  // This is a _sorted_ (ascending due_) list of active timers managed by a
-  // dedicated thread
-  std::forward_list<std::shared_ptr<WaitItem>> wait_queue_;
+  // Active timers live in a TimingWheel local to the dispatch thread.
   std::jthread dispatch_thread_;
 };
 
@@ -17,6 +17,8 @@
 
 #include <rex/string/utf8.h>
 
+#include <simde/x86/sse2.h>
+
 #define UTF_CPP_CPLUSPLUS 201703L
 #include <utf8.h>
 
@@ -27,16 +29,69 @@ using utf8_citer = utfcpp::iterator<std::string_view::const_iterator>;
 
 namespace rex::string {
 
+uint32_t lower_ascii(const uint32_t c) {
+  return c >= 'A' && c <= 'Z' ? c + 32 : c;
+}
+
+namespace {
+
+// Length of the leading run of ASCII bytes, validated 16 bytes at a time.
+size_t ascii_prefix_length(const char* data, size_t size) {
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    simde__m128i chunk = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(data + i));
+    if (simde_mm_movemask_epi8(chunk)) {
+      break;
+    }
+  }
+  for (; i < size && !(uint8_t(data[i]) & 0x80); ++i) {
+  }
+  return i;
+}
+
+// Folds ASCII upper-case letters in each byte lane to lower case.
+simde__m128i lower_ascii_bytes(simde__m128i v) {
+  simde__m128i is_upper =
+      simde_mm_and_si128(simde_mm_cmpgt_epi8(v, simde_mm_set1_epi8('A' - 1)),
+                         simde_mm_cmpgt_epi8(simde_mm_set1_epi8('Z' + 1), v));
+  return simde_mm_or_si128(v, simde_mm_and_si128(is_upper, simde_mm_set1_epi8(0x20)));
+}
+
+// Byte length of the leading run where both sides are ASCII and equal after
+// case folding, compared 16 bytes at a time. ASCII codepoints are single
+// bytes, so the run always ends on a codepoint boundary and the iterator
+// compare can resume on the remainder.
+size_t ascii_case_equal_prefix(const char* left, const char* right, size_t size) {
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    simde__m128i l = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(left + i));
+    simde__m128i r = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(right + i));
+    if (simde_mm_movemask_epi8(simde_mm_or_si128(l, r))) {
+      break;
+    }
+    if (simde_mm_movemask_epi8(
+            simde_mm_cmpeq_epi8(lower_ascii_bytes(l), lower_ascii_bytes(r))) != 0xFFFF) {
+      break;
+    }
+  }
+  for (; i < size; ++i) {
+    uint32_t l = uint8_t(left[i]);
+    uint32_t r = uint8_t(right[i]);
+    if (((l | r) & 0x80) || lower_ascii(l) != lower_ascii(r)) {
+      break;
+    }
+  }
+  return i;
+}
+
+}  // namespace
+
 std::string to_string(char32_t c) {
   std::string result;
   utfcpp::append(c, result);
   return result;
 }
 
-uint32_t lower_ascii(const uint32_t c) {
-  return c >= 'A' && c <= 'Z' ? c + 32 : c;
-}
-
 uint32_t upper_ascii(const uint32_t c) {
   return c >= 'A' && c <= 'Z' ? c + 32 : c;
 }
@@ -91,7 +146,26 @@ inline size_t hash_fnv1a(const std::string_view view) {
     return hash;
   };
   auto hash = offset_basis;
-  auto [begin, end] = make_citer(view);
+  // ASCII codepoints are their own bytes, so the leading ASCII run (validated
+  // 16 bytes at a time) can be hashed without UTF-8 decode. FNV-1a itself is
+  // a serial dependency chain - the win here is skipping the iterator. Each
+  // byte is still mixed with the three zero padding bytes the codepoint-wise
+  // loop below would produce, so the two paths hash identically.
+  size_t ascii = ascii_prefix_length(view.data(), view.size());
+  for (size_t i = 0; i < ascii; ++i) {
+    uint32_t c = uint8_t(view[i]);
+    if constexpr (LOWER) {
+      c = lower_ascii(c);
+    }
+    hash = work(hash, uint8_t(c));
+    hash = work(hash, 0);
+    hash = work(hash, 0);
+    hash = work(hash, 0);
+  }
+  if (ascii == view.size()) {
+    return hash;
+  }
+  auto [begin, end] = make_citer(view.substr(ascii));
   for (auto it = begin; it != end; ++it) {
     uint32_t c;
     if constexpr (LOWER) {
@@ -202,8 +276,20 @@ bool utf8_equal_case(const std::string_view left, const std::string_view right)
   } else if (!right.size()) {
     return false;
   }
-  auto [left_begin, left_end] = make_citer(left);
-  auto [right_begin, right_end] = make_citer(right);
+  // ASCII case folding never changes a codepoint's byte length and non-ASCII
+  // codepoints must match exactly, so differing byte lengths can never be
+  // equal.
+  if (left.size() != right.size()) {
+    return false;
+  }
+  // Guest paths are overwhelmingly ASCII - burn through the case-equal ASCII
+  // prefix in 128-bit blocks and only decode what's left.
+  size_t prefix = ascii_case_equal_prefix(left.data(), right.data(), left.size());
+  if (prefix == left.size()) {
+    return true;
+  }
+  auto [left_begin, left_end] = make_citer(left.substr(prefix));
+  auto [right_begin, right_end] = make_citer(right.substr(prefix));
   return std::equal(left_begin, left_end, right_begin, right_end, equal_ascii_case);
 }
 
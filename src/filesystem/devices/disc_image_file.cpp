@@ -14,6 +14,12 @@
 
 #include <algorithm>
 
+#include <rex/cvar.h>
+
+REXCVAR_DEFINE_UINT64(disc_image_readahead_kb, 512, "Kernel",
+                      "Readahead window in KB kept ahead of sequential disc image reads "
+                      "(0 disables). Advised to the OS in 64 KB blocks.");
+
 namespace rex::filesystem {
 
 DiscImageFile::DiscImageFile(uint32_t file_access, DiscImageEntry* entry)
@@ -32,6 +38,32 @@ X_STATUS DiscImageFile::ReadSync(void* buffer, size_t buffer_length, size_t byte
   }
   size_t real_offset = entry_->data_offset() + byte_offset;
   size_t real_length = std::min(buffer_length, entry_->data_size() - byte_offset);
+
+  // The image is memory-mapped, so a cold sequential read otherwise faults it
+  // in one page at a time. Detect sequential access and keep a readahead
+  // window paged in ahead of the reader.
+  if (byte_offset == last_read_end_) {
+    ++sequential_reads_;
+  } else {
+    sequential_reads_ = 1;
+    readahead_issued_ = 0;
+  }
+  last_read_end_ = byte_offset + real_length;
+
+  const size_t window = size_t(REXCVAR_GET(disc_image_readahead_kb)) << 10;
+  if (window && sequential_reads_ >= 2) {
+    // Advance the window in whole 64 KB blocks so a stream of small reads
+    // doesn't become an advise syscall per read.
+    constexpr size_t kReadaheadBlock = 64 * 1024;
+    const size_t ahead_begin = std::max(real_offset + real_length, readahead_issued_);
+    const size_t ahead_end = real_offset + real_length + window;
+    if (ahead_end >= ahead_begin + kReadaheadBlock) {
+      entry_->mmap()->Advise(memory::MappedMemory::AdviseHint::kWillNeed, ahead_begin,
+                             ahead_end - ahead_begin);
+      readahead_issued_ = ahead_end;
+    }
+  }
+
   std::memcpy(buffer, entry_->mmap()->data() + real_offset, real_length);
   *out_bytes_read = real_length;
   return X_STATUS_SUCCESS;
@@ -41,6 +41,11 @@ class DiscImageFile : public File {
 
  private:
   DiscImageEntry* entry_;
+
+  // Sequential-access detection state driving readahead (see ReadSync).
+  size_t last_read_end_ = 0;
+  size_t readahead_issued_ = 0;
+  uint32_t sequential_reads_ = 0;
 };
 
 }  // namespace rex::filesystem
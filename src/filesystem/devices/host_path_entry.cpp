@@ -12,6 +12,7 @@
 #include "host_path_entry.h"
 #include "host_path_file.h"
 
+#include <rex/cvar.h>
 #include <rex/filesystem.h>
 #include <rex/filesystem/device.h>
 #include <rex/logging.h>
@@ -19,6 +20,10 @@
 #include <rex/memory/mapped_memory.h>
 #include <rex/string.h>
 
+REXCVAR_DEFINE_BOOL(host_path_mmap_reads, true, "Kernel",
+                    "Serve files on read-only host-path devices from a memory mapping instead "
+                    "of issuing a read syscall per request.");
+
 namespace rex::filesystem {
 
 HostPathEntry::HostPathEntry(Device* device, Entry* parent, const std::string_view path,
@@ -55,6 +60,19 @@ X_STATUS HostPathEntry::Open(uint32_t desired_access, File** out_file) {
     REXFS_ERROR("Attempting to open file for write access on read-only device");
     return X_STATUS_ACCESS_DENIED;
   }
+  // On read-only devices, read-only opens of regular files are served from a
+  // mapping of the host file, turning every guest read into a memcpy.
+  constexpr uint32_t kWriteAccessMask =
+      FileAccess::kGenericWrite | FileAccess::kFileWriteData | FileAccess::kFileAppendData;
+  if (REXCVAR_GET(host_path_mmap_reads) && device()->is_read_only() &&
+      !(desired_access & kWriteAccessMask) && !(attributes() & kFileAttributeDirectory) && size()) {
+    auto mmap = OpenMapped(memory::MappedMemory::Mode::kRead, 0, 0);
+    if (mmap) {
+      *out_file = new HostPathFile(desired_access, this, std::move(mmap));
+      return X_STATUS_SUCCESS;
+    }
+    // Mapping failed - fall back to handle-based I/O.
+  }
   auto file_handle = rex::filesystem::FileHandle::OpenExisting(host_path_, desired_access);
   if (!file_handle) {
     // TODO(benvanik): pick correct response.
@@ -12,12 +12,19 @@
 #include "host_path_entry.h"
 #include "host_path_file.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace rex::filesystem {
 
 HostPathFile::HostPathFile(uint32_t file_access, HostPathEntry* entry,
                            std::unique_ptr<rex::filesystem::FileHandle> file_handle)
     : File(file_access, entry), file_handle_(std::move(file_handle)) {}
 
+HostPathFile::HostPathFile(uint32_t file_access, HostPathEntry* entry,
+                           std::unique_ptr<memory::MappedMemory> mmap)
+    : File(file_access, entry), mmap_(std::move(mmap)) {}
+
 HostPathFile::~HostPathFile() = default;
 
 void HostPathFile::Destroy() {
@@ -30,6 +37,16 @@ X_STATUS HostPathFile::ReadSync(void* buffer, size_t buffer_length, size_t byte_
     return X_STATUS_ACCESS_DENIED;
   }
 
+  if (mmap_) {
+    if (byte_offset >= mmap_->size()) {
+      return X_STATUS_END_OF_FILE;
+    }
+    size_t read_length = std::min(buffer_length, mmap_->size() - byte_offset);
+    std::memcpy(buffer, mmap_->data() + byte_offset, read_length);
+    *out_bytes_read = read_length;
+    return X_STATUS_SUCCESS;
+  }
+
   if (file_handle_->Read(byte_offset, buffer, buffer_length, out_bytes_read)) {
     return X_STATUS_SUCCESS;
   } else {
@@ -44,7 +61,14 @@ X_STATUS HostPathFile::WriteSync(const void* buffer, size_t buffer_length, size_
     return X_STATUS_ACCESS_DENIED;
   }
 
+  if (!file_handle_) {
+    // Mapped files are only ever opened without write access.
+    return X_STATUS_ACCESS_DENIED;
+  }
+
   if (file_handle_->Write(byte_offset, buffer, buffer_length, out_bytes_written)) {
+    // The write may have extended the file.
+    entry_->MarkInfoDirty();
     return X_STATUS_SUCCESS;
   } else {
     return X_STATUS_END_OF_FILE;
@@ -56,7 +80,12 @@ X_STATUS HostPathFile::SetLength(size_t length) {
     return X_STATUS_ACCESS_DENIED;
   }
 
+  if (!file_handle_) {
+    return X_STATUS_ACCESS_DENIED;
+  }
+
   if (file_handle_->SetLength(length)) {
+    entry_->MarkInfoDirty();
     return X_STATUS_SUCCESS;
   } else {
     return X_STATUS_END_OF_FILE;
@@ -15,6 +15,7 @@
 
 #include <rex/filesystem.h>
 #include <rex/filesystem/file.h>
+#include <rex/memory/mapped_memory.h>
 
 namespace rex::filesystem {
 
@@ -24,6 +25,10 @@ class HostPathFile : public File {
  public:
   HostPathFile(uint32_t file_access, HostPathEntry* entry,
                std::unique_ptr<rex::filesystem::FileHandle> file_handle);
+  // Read-only variant serving reads straight from a mapping of the host file,
+  // with no handle-based I/O.
+  HostPathFile(uint32_t file_access, HostPathEntry* entry,
+               std::unique_ptr<memory::MappedMemory> mmap);
   ~HostPathFile() override;
 
   void Destroy() override;
@@ -36,6 +41,7 @@ class HostPathFile : public File {
 
  private:
   std::unique_ptr<rex::filesystem::FileHandle> file_handle_;
+  std::unique_ptr<memory::MappedMemory> mmap_;
 };
 
 }  // namespace rex::filesystem
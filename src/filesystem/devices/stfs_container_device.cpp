@@ -427,7 +427,10 @@ StfsContainerDevice::Error StfsContainerDevice::ReadEntrySVOD(uint32_t block, ui
           continue;
         }
 
-        entry->block_list_.push_back({file_index, offset, BLOCK_SIZE});
+        size_t start = entry->block_list_.empty()
+                           ? 0
+                           : entry->block_list_.back().start + entry->block_list_.back().length;
+        entry->block_list_.push_back({start, file_index, offset, BLOCK_SIZE});
         last_record = entry->block_list_.size() - 1;
         last_offset = offset;
       }
@@ -574,11 +577,23 @@ StfsContainerDevice::Error StfsContainerDevice::ReadSTFS() {
       if (entry->attributes() & system::X_FILE_ATTRIBUTE_NORMAL) {
         uint32_t block_index = dir_entry.start_block_number();
         size_t remaining_size = dir_entry.length;
+        size_t blocks_read = 0;
         while (remaining_size && block_index != kEndOfChain) {
           size_t block_size = std::min(static_cast<size_t>(kBlockSize), remaining_size);
           size_t offset = BlockToOffsetSTFS(block_index);
-          entry->block_list_.push_back({0, offset, block_size});
+          // Coalesce physically adjacent blocks so reads become one large
+          // fread per extent instead of one per block.
+          if (!entry->block_list_.empty() &&
+              entry->block_list_.back().offset + entry->block_list_.back().length == offset) {
+            entry->block_list_.back().length += block_size;
+          } else {
+            size_t start = entry->block_list_.empty()
+                               ? 0
+                               : entry->block_list_.back().start + entry->block_list_.back().length;
+            entry->block_list_.push_back({start, 0, offset, block_size});
+          }
           remaining_size -= block_size;
+          blocks_read++;
           auto block_hash = GetBlockHash(block_index);
           block_index = block_hash->level0_next_block();
         }
@@ -595,11 +610,11 @@ StfsContainerDevice::Error StfsContainerDevice::ReadSTFS() {
 
         // Check that the number of blocks retrieved from hash entries matches
         // the block count read from the file entry
-        if (entry->block_list_.size() != dir_entry.allocated_data_blocks()) {
+        if (blocks_read != dir_entry.allocated_data_blocks()) {
           REXFS_WARN(
               "STFS failed to read correct block-chain for entry {}, read {} "
               "blocks, expected {}",
-              entry->name_, entry->block_list_.size(), dir_entry.allocated_data_blocks());
+              entry->name_, blocks_read, dir_entry.allocated_data_blocks());
           assert_always();
         }
       }
@@ -689,6 +704,9 @@ const StfsHashEntry* StfsContainerDevice::GetBlockHash(uint32_t block_index) {
   uint32_t secondary_table_offset = descriptor.flags.bits.root_active_index ? kBlockSize : 0;
 
   auto hash_offset_lv0 = BlockToHashBlockOffsetSTFS(block_index, 0);
+  if (hash_offset_lv0 == last_hash_table_offset_) {
+    return &last_hash_table_->entries[block_index % kBlocksPerHashLevel[0]];
+  }
   if (!cached_hash_tables_.count(hash_offset_lv0)) {
     // If this is read_only_format then it doesn't contain secondary blocks, no
     // need to check upper hash levels
@@ -752,10 +770,11 @@ const StfsHashEntry* StfsContainerDevice::GetBlockHash(uint32_t block_index) {
     cached_hash_tables_[hash_offset_lv0] = table_lv0;
   }
 
-  auto record = block_index % kBlocksPerHashLevel[0];
-  auto record_data = &cached_hash_tables_[hash_offset_lv0].entries[record];
+  const StfsHashTable& table = cached_hash_tables_[hash_offset_lv0];
+  last_hash_table_offset_ = hash_offset_lv0;
+  last_hash_table_ = &table;
 
-  return record_data;
+  return &table.entries[block_index % kBlocksPerHashLevel[0]];
 }
 
 XContentPackageType StfsContainerDevice::ReadMagic(const std::filesystem::path& path) {
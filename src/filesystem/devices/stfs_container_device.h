@@ -131,6 +131,11 @@ class StfsContainerDevice : public Device {
   uint32_t block_step[2];
 
   std::unordered_map<size_t, StfsHashTable> cached_hash_tables_;
+  // Most recently returned level-0 hash table. The mount-time block-chain
+  // walk asks for ~170 consecutive blocks out of the same table, so this
+  // memo skips the map probes (pointers into the node-based map are stable).
+  size_t last_hash_table_offset_ = SIZE_MAX;
+  const StfsHashTable* last_hash_table_ = nullptr;
 };
 
 }  // namespace rex::filesystem
@@ -40,7 +40,10 @@ class StfsContainerEntry : public Entry {
 
   X_STATUS Open(uint32_t desired_access, File** out_file) override;
 
+  // One physically contiguous extent of the file; adjacent blocks are
+  // coalesced when the list is built, and records are sorted by start.
   struct BlockRecord {
+    size_t start;  // Logical offset within the file
     size_t file;
     size_t offset;
     size_t length;
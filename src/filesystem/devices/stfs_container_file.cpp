@@ -34,20 +34,25 @@ X_STATUS StfsContainerFile::ReadSync(void* buffer, size_t buffer_length, size_t
     return X_STATUS_END_OF_FILE;
   }
 
-  size_t src_offset = 0;
+  const auto& block_list = entry_->block_list();
   uint8_t* p = reinterpret_cast<uint8_t*>(buffer);
   size_t remaining_length = std::min(buffer_length, entry_->size() - byte_offset);
 
   *out_bytes_read = 0;
-  for (size_t i = 0; i < entry_->block_list().size(); i++) {
-    auto& record = entry_->block_list()[i];
-    if (src_offset + record.length <= byte_offset) {
-      // Doesn't begin in this region. Skip it.
-      src_offset += record.length;
-      continue;
-    }
+  if (block_list.empty()) {
+    return X_STATUS_SUCCESS;
+  }
 
-    size_t read_offset = (byte_offset > src_offset) ? byte_offset - src_offset : 0;
+  // Records are sorted by logical start, so binary search for the extent
+  // containing byte_offset instead of scanning from the first block.
+  auto it = std::upper_bound(
+      block_list.begin(), block_list.end(), byte_offset,
+      [](size_t offset, const StfsContainerEntry::BlockRecord& record) {
+        return offset < record.start;
+      });
+  for (size_t i = size_t(it - block_list.begin()) - 1; i < block_list.size(); i++) {
+    auto& record = block_list[i];
+    size_t read_offset = (byte_offset > record.start) ? byte_offset - record.start : 0;
     size_t read_length = std::min(record.length - read_offset, remaining_length);
 
     auto& file = entry_->files()->at(record.file);
@@ -56,7 +61,6 @@ X_STATUS StfsContainerFile::ReadSync(void* buffer, size_t buffer_length, size_t
 
     *out_bytes_read += num_read;
     p += num_read;
-    src_offset += record.length;
     remaining_length -= read_length;
     if (remaining_length == 0) {
       break;
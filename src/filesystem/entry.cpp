@@ -27,12 +27,17 @@ Entry::Entry(Device* device, Entry* parent, const std::string_view path)
       allocation_size_(0),
       create_timestamp_(0),
       access_timestamp_(0),
-      write_timestamp_(0) {
+      write_timestamp_(0),
+      child_index_size_(SIZE_MAX) {
   assert_not_null(device);
   absolute_path_ = rex::string::utf8_join_guest_paths(device->mount_path(), path);
   name_ = rex::string::utf8_find_name_from_guest_path(path);
 }
 
+std::atomic<uint64_t> Entry::tree_generation_{0};
+std::atomic<uint64_t> Entry::info_cache_hits_{0};
+std::atomic<uint64_t> Entry::info_cache_misses_{0};
+
 Entry::~Entry() = default;
 
 void Entry::Dump(rex::string::StringBuffer* string_buffer, int indent) {
@@ -52,13 +57,25 @@ bool Entry::is_read_only() const {
 
 Entry* Entry::GetChild(const std::string_view name) {
   auto global_lock = global_critical_region_.Acquire();
-  auto it = std::find_if(children_.cbegin(), children_.cend(), [&](const auto& child) {
-    return rex::string::utf8_equal_case(child->name(), name);
-  });
-  if (it == children_.cend()) {
+  if (children_.size() != child_index_size_) {
+    RebuildChildIndex();
+  }
+  auto it = child_index_.find(rex::string::string_key_case(name));
+  if (it == child_index_.cend()) {
     return nullptr;
   }
-  return (*it).get();
+  return it->second;
+}
+
+void Entry::RebuildChildIndex() {
+  child_index_.clear();
+  child_index_.reserve(children_.size());
+  for (auto& child : children_) {
+    // emplace keeps the first entry on case-insensitive duplicates, matching
+    // the linear scan this index replaced.
+    child_index_.emplace(rex::string::string_key_case(child->name()), child.get());
+  }
+  child_index_size_ = children_.size();
 }
 
 Entry* Entry::ResolvePath(const std::string_view path) {
@@ -102,6 +119,7 @@ Entry* Entry::CreateEntry(const std::string_view name, uint32_t attributes) {
   }
   children_.push_back(std::move(entry));
   // TODO(benvanik): resort? would break iteration?
+  tree_generation_.fetch_add(1, std::memory_order_relaxed);
   Touch();
   return children_.back().get();
 }
@@ -123,6 +141,10 @@ bool Entry::Delete(Entry* entry) {
       break;
     }
   }
+  // The erased child's name may still be keyed in the index; force a rebuild
+  // even if an add later brings the list back to the same size.
+  child_index_size_ = SIZE_MAX;
+  tree_generation_.fetch_add(1, std::memory_order_relaxed);
   Touch();
   return true;
 }
@@ -134,6 +156,19 @@ bool Entry::Delete() {
 
 void Entry::Touch() {
   // TODO(benvanik): update timestamps.
+  MarkInfoDirty();
+}
+
+void Entry::RefreshInfo() {
+  // The acquire pairs with the release in MarkInfoDirty so the refresh sees
+  // whatever mutation raised the flag. A writer racing the exchange leaves
+  // the flag set for the next refresh.
+  if (!info_dirty_.exchange(false, std::memory_order_acquire)) {
+    info_cache_hits_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  info_cache_misses_.fetch_add(1, std::memory_order_relaxed);
+  update();
 }
 
 }  // namespace rex::filesystem
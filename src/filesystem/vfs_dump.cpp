@@ -9,8 +9,12 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <queue>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <rex/cvar.h>
@@ -24,6 +28,9 @@ REXCVAR_DEFINE_STRING(dump_source, "", "Filesystem", "Specifies the file to dump
 
 REXCVAR_DEFINE_STRING(dump_path, "", "Filesystem", "Specifies the directory to dump files to");
 
+REXCVAR_DEFINE_UINT32(dump_jobs, 0, "Filesystem",
+                      "Number of extraction workers (0 = one per hardware thread)");
+
 namespace rex::filesystem {
 
 using namespace rex::literals;
@@ -45,68 +52,103 @@ int vfs_dump_main(const std::vector<std::string>& args) {
     return 1;
   }
 
-  // Run through all the files, breadth-first style.
+  // Walk the tree breadth-first, creating the directory skeleton up front and
+  // collecting the files for the workers.
+  std::vector<vfs::Entry*> files;
   std::queue<vfs::Entry*> queue;
   auto root = device->ResolvePath("/");
   queue.push(root);
-
-  // Allocate a buffer when needed.
-  size_t buffer_size = 0;
-  uint8_t* buffer = nullptr;
-
   while (!queue.empty()) {
     auto entry = queue.front();
     queue.pop();
-    for (auto& entry : entry->children()) {
-      queue.push(entry.get());
+    for (auto& child : entry->children()) {
+      queue.push(child.get());
     }
-
-    REXFS_INFO("{}", entry->path());
-    auto dest_name = base_path / rex::to_path(entry->path());
     if (entry->attributes() & kFileAttributeDirectory) {
-      std::filesystem::create_directories(dest_name);
-      continue;
+      std::filesystem::create_directories(base_path / rex::to_path(entry->path()));
+    } else {
+      files.push_back(entry);
     }
+  }
 
-    vfs::File* in_file = nullptr;
-    if (entry->Open(FileAccess::kFileReadData, &in_file) != X_STATUS_SUCCESS) {
-      continue;
-    }
+  size_t job_count = REXCVAR_GET(dump_jobs);
+  if (!job_count) {
+    job_count = std::thread::hardware_concurrency();
+  }
+  job_count = std::max<size_t>(1, std::min(job_count, files.size()));
+
+  REXFS_INFO("Dumping {} files with {} workers", files.size(), job_count);
+
+  // Workers claim files from a shared counter and stream each one out in
+  // fixed-size chunks. The container seeks shared FILE handles, so non-mapped
+  // reads are serialized under read_mutex; mapped reads and all destination
+  // writes run concurrently, overlapping container input with dump output.
+  std::atomic<size_t> next_file{0};
+  std::atomic<size_t> failed{0};
+  std::mutex read_mutex;
+
+  auto worker_main = [&]() {
+    constexpr size_t kChunkSize = 16_MiB;
+    auto buffer = std::make_unique<uint8_t[]>(kChunkSize);
+    while (true) {
+      size_t index = next_file.fetch_add(1, std::memory_order_relaxed);
+      if (index >= files.size()) {
+        break;
+      }
+      auto entry = files[index];
+      REXFS_INFO("{}", entry->path());
+      auto dest_name = base_path / rex::to_path(entry->path());
+
+      vfs::File* in_file = nullptr;
+      if (entry->Open(FileAccess::kFileReadData, &in_file) != X_STATUS_SUCCESS) {
+        failed.fetch_add(1, std::memory_order_relaxed);
+        continue;
+      }
 
-    auto file = rex::filesystem::OpenFile(dest_name, "wb");
-    if (!file) {
-      in_file->Destroy();
-      continue;
-    }
+      auto file = rex::filesystem::OpenFile(dest_name, "wb");
+      if (!file) {
+        in_file->Destroy();
+        failed.fetch_add(1, std::memory_order_relaxed);
+        continue;
+      }
 
-    if (entry->can_map()) {
-      auto map = entry->OpenMapped(rex::memory::MappedMemory::Mode::kRead);
-      fwrite(map->data(), map->size(), 1, file);
-      map->Close();
-    } else {
-      // Can't map the file into memory. Read it into a temporary buffer.
-      if (!buffer || entry->size() > buffer_size) {
-        // Resize the buffer.
-        if (buffer) {
-          delete[] buffer;
+      if (entry->can_map()) {
+        auto map = entry->OpenMapped(rex::memory::MappedMemory::Mode::kRead);
+        fwrite(map->data(), map->size(), 1, file);
+        map->Close();
+      } else {
+        // Can't map the file into memory. Stream it through a chunk buffer.
+        size_t offset = 0;
+        while (offset < entry->size()) {
+          size_t bytes_read = 0;
+          {
+            std::lock_guard<std::mutex> lock(read_mutex);
+            in_file->ReadSync(buffer.get(), kChunkSize, offset, &bytes_read);
+          }
+          if (!bytes_read) {
+            break;
+          }
+          fwrite(buffer.get(), bytes_read, 1, file);
+          offset += bytes_read;
         }
-
-        // Allocate a buffer rounded up to the nearest 512MB.
-        buffer_size = rex::round_up(entry->size(), 512_MiB);
-        buffer = new uint8_t[buffer_size];
       }
 
-      size_t bytes_read = 0;
-      in_file->ReadSync(buffer, entry->size(), 0, &bytes_read);
-      fwrite(buffer, bytes_read, 1, file);
+      fclose(file);
+      in_file->Destroy();
     }
+  };
 
-    fclose(file);
-    in_file->Destroy();
+  std::vector<std::thread> workers;
+  workers.reserve(job_count);
+  for (size_t i = 0; i < job_count; i++) {
+    workers.emplace_back(worker_main);
+  }
+  for (auto& worker : workers) {
+    worker.join();
   }
 
-  if (buffer) {
-    delete[] buffer;
+  if (failed.load()) {
+    REXFS_WARN("Failed to dump {} files", failed.load());
   }
 
   return 0;
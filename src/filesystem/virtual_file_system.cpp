@@ -9,15 +9,34 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <rex/cvar.h>
 #include <rex/filesystem/vfs.h>
 #include <rex/logging.h>
 #include <rex/string.h>
 
+REXCVAR_DEFINE_BOOL(vfs_access_trace, false, "Kernel",
+                    "Record the guest's file read pattern and replay it as readahead hints on "
+                    "the next launch to warm the host page cache.");
+
 namespace rex::filesystem {
 
+namespace {
+// Upper bound on recorded accesses; streaming titles issue a lot of reads and
+// the trace only needs to cover the launch window.
+constexpr size_t kMaxAccessTraceRecords = 262144;
+}  // namespace
+
 VirtualFileSystem::VirtualFileSystem() {}
 
 VirtualFileSystem::~VirtualFileSystem() {
+  // The prefetch thread walks entries, so it must be gone before the devices.
+  StopAccessTrace();
+  uint64_t info_hits = Entry::info_cache_hits();
+  uint64_t info_misses = Entry::info_cache_misses();
+  if (info_hits + info_misses) {
+    REXFS_INFO("VFS: file info cache: {} hits / {} misses ({:.1f}% hit rate)", info_hits,
+               info_misses, 100.0 * double(info_hits) / double(info_hits + info_misses));
+  }
   // Delete all devices.
   // This will explode if anyone is still using data from them.
   devices_.clear();
@@ -27,6 +46,8 @@ VirtualFileSystem::~VirtualFileSystem() {
 bool VirtualFileSystem::RegisterDevice(std::unique_ptr<Device> device) {
   auto global_lock = global_critical_region_.Acquire();
   devices_.emplace_back(std::move(device));
+  // A new mount can shadow or satisfy previously resolved paths.
+  resolved_path_cache_.clear();
   return true;
 }
 
@@ -36,6 +57,8 @@ bool VirtualFileSystem::UnregisterDevice(const std::string_view path) {
     if ((*it)->mount_path() == path) {
       REXFS_DEBUG("Unregistered device: {}", (*it)->mount_path());
       devices_.erase(it);
+      // Cached entries under this mount are now dangling.
+      resolved_path_cache_.clear();
       return true;
     }
   }
@@ -46,6 +69,7 @@ bool VirtualFileSystem::RegisterSymbolicLink(const std::string_view path,
                                              const std::string_view target) {
   auto global_lock = global_critical_region_.Acquire();
   symlinks_.insert({std::string(path), std::string(target)});
+  resolved_path_cache_.clear();
   REXFS_DEBUG("Registered symbolic link: {} => {}", path, target);
 
   return true;
@@ -62,6 +86,7 @@ bool VirtualFileSystem::UnregisterSymbolicLink(const std::string_view path) {
   REXFS_DEBUG("Unregistered symbolic link: {} => {}", it->first, it->second);
 
   symlinks_.erase(it);
+  resolved_path_cache_.clear();
   return true;
 }
 
@@ -98,6 +123,17 @@ bool VirtualFileSystem::ResolveSymbolicLink(const std::string_view path, std::st
 Entry* VirtualFileSystem::ResolvePath(const std::string_view path) {
   auto global_lock = global_critical_region_.Acquire();
 
+  // Serve repeat lookups from the cache; creates and deletes anywhere in the
+  // entry trees bump the generation, invalidating every cached resolution.
+  if (resolved_path_cache_generation_ != Entry::tree_generation()) {
+    resolved_path_cache_.clear();
+    resolved_path_cache_generation_ = Entry::tree_generation();
+  }
+  auto cached_it = resolved_path_cache_.find(rex::string::string_key_case(path));
+  if (cached_it != resolved_path_cache_.end()) {
+    return cached_it->second;
+  }
+
   // Resolve relative paths
   auto normalized_path(rex::string::utf8_canonicalize_guest_path(path));
 
@@ -127,6 +163,9 @@ Entry* VirtualFileSystem::ResolvePath(const std::string_view path) {
   auto* entry = device->ResolvePath(relative_path);
 
   if (entry) {
+    // Only successful resolutions are cached; failed probes are common and
+    // not worth pinning.
+    resolved_path_cache_.emplace(rex::string::string_key_case::create(path), entry);
     REXFS_INFO("VFS: '{}' -> '{}' -> device '{}' -> host '{}'", path,
                had_symlink ? normalized_path : "(no symlink)", device->mount_path(),
                entry->absolute_path());
@@ -308,4 +347,124 @@ X_STATUS VirtualFileSystem::OpenFile(Entry* root_entry, const std::string_view p
   return result;
 }
 
+void VirtualFileSystem::StartAccessTrace(const std::filesystem::path& trace_file) {
+  if (!REXCVAR_GET(vfs_access_trace)) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(access_trace_mutex_);
+    access_trace_file_ = trace_file;
+    access_trace_.clear();
+  }
+  access_trace_enabled_ = true;
+
+  auto records = LoadAccessTrace(trace_file);
+  if (records.empty()) {
+    return;
+  }
+  REXFS_INFO("VFS: replaying {} recorded accesses from {}", records.size(), trace_file.string());
+  prefetch_thread_ = std::jthread([this, records = std::move(records)](std::stop_token stop) mutable {
+    ReplayAccessTrace(stop, std::move(records));
+  });
+}
+
+void VirtualFileSystem::StopAccessTrace() {
+  // Joins (and cancels) any in-flight replay.
+  prefetch_thread_ = {};
+  if (!access_trace_enabled_.exchange(false)) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(access_trace_mutex_);
+  if (access_trace_.empty()) {
+    // Keep the previous trace rather than clobbering it with nothing.
+    return;
+  }
+  auto file = rex::filesystem::OpenFile(access_trace_file_, "w");
+  if (!file) {
+    REXFS_WARN("VFS: failed to write access trace to {}", access_trace_file_.string());
+    return;
+  }
+  for (const auto& record : access_trace_) {
+    fprintf(file, "%llu %u %s\n", static_cast<unsigned long long>(record.offset), record.length,
+            record.path.c_str());
+  }
+  fclose(file);
+  REXFS_INFO("VFS: wrote {} access records to {}", access_trace_.size(),
+             access_trace_file_.string());
+  access_trace_.clear();
+}
+
+void VirtualFileSystem::RecordAccess(const std::string_view path, uint64_t offset,
+                                     uint32_t length) {
+  if (!access_trace_enabled_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(access_trace_mutex_);
+  if (!access_trace_.empty()) {
+    // Fold reads that continue the previous one into a single record.
+    auto& last = access_trace_.back();
+    if (last.offset + last.length == offset && last.path == path) {
+      last.length += length;
+      return;
+    }
+  }
+  if (access_trace_.size() >= kMaxAccessTraceRecords) {
+    return;
+  }
+  access_trace_.push_back({std::string(path), offset, length});
+}
+
+std::vector<VirtualFileSystem::AccessRecord> VirtualFileSystem::LoadAccessTrace(
+    const std::filesystem::path& trace_file) {
+  std::vector<AccessRecord> records;
+  auto file = rex::filesystem::OpenFile(trace_file, "r");
+  if (!file) {
+    return records;
+  }
+  char line[1024];
+  while (fgets(line, sizeof(line), file)) {
+    unsigned long long offset = 0;
+    unsigned int length = 0;
+    int path_begin = 0;
+    if (sscanf(line, "%llu %u %n", &offset, &length, &path_begin) != 2 || !path_begin) {
+      continue;
+    }
+    std::string path(line + path_begin);
+    while (!path.empty() && (path.back() == '\n' || path.back() == '\r')) {
+      path.pop_back();
+    }
+    if (path.empty()) {
+      continue;
+    }
+    records.push_back({std::move(path), uint64_t(offset), uint32_t(length)});
+  }
+  fclose(file);
+  return records;
+}
+
+void VirtualFileSystem::ReplayAccessTrace(std::stop_token stop, std::vector<AccessRecord> records) {
+  // Only mappable entries are prefetched: the advise path is asynchronous and
+  // touches no shared file handles, so it can't race guest reads the way
+  // seeking a container's FILE stream would.
+  std::string last_path;
+  std::unique_ptr<memory::MappedMemory> map;
+  for (const auto& record : records) {
+    if (stop.stop_requested()) {
+      break;
+    }
+    if (record.path != last_path) {
+      map.reset();
+      last_path = record.path;
+      auto entry = ResolvePath(record.path);
+      if (entry && entry->can_map() && !(entry->attributes() & kFileAttributeDirectory)) {
+        map = entry->OpenMapped(memory::MappedMemory::Mode::kRead);
+      }
+    }
+    if (!map) {
+      continue;
+    }
+    map->Advise(memory::MappedMemory::AdviseHint::kWillNeed, size_t(record.offset), record.length);
+  }
+}
+
 }  // namespace rex::filesystem
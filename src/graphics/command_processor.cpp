@@ -16,6 +16,7 @@
 
 #include <fmt/format.h>
 
+#include <rex/chrono/clock.h>
 #include <rex/cvar.h>
 #include <rex/dbg.h>
 #include <rex/graphics/command_processor.h>
@@ -38,6 +39,20 @@ REXCVAR_DEFINE_INT32(query_occlusion_fake_sample_count, 1000, "GPU",
                      "Fake sample count for occlusion queries")
     .range(1, 100000);
 
+REXCVAR_DEFINE_BOOL(gpu_packet_stats, false, "GPU",
+                    "Log per-PM4-packet-type execution time on the command processor "
+                    "thread every 60 frames");
+
+REXCVAR_DEFINE_BOOL(gpu_frame_phase_stats, true, "GPU",
+                    "Record per-frame command processor time spent on draws, resolves and "
+                    "swaps for the debug overlay");
+
+REXCVAR_DEFINE_INT32(trace_stream_keyframe_interval, 60, "GPU",
+                     "Number of frames between full GPU state snapshots in streamed traces, "
+                     "letting the trace viewer seek to the nearest keyframe instead of "
+                     "replaying from the start (0 to disable)")
+    .range(0, 100000);
+
 namespace rex::graphics {
 
 using namespace rex::graphics::xenos;
@@ -152,9 +167,7 @@ void CommandProcessor::RestoreRegisters(uint32_t first_register, const uint32_t*
         std::min(uint32_t(RegisterFile::kRegisterCount) - first_register, register_count);
   }
   if (execute_callbacks) {
-    for (uint32_t i = 0; i < register_count; ++i) {
-      WriteRegister(first_register + i, register_values[i]);
-    }
+    WriteRegisterRange(first_register, register_values, register_count);
   } else {
     std::memcpy(register_file_->values + first_register, register_values,
                 sizeof(uint32_t) * register_count);
@@ -214,9 +227,19 @@ void CommandProcessor::WorkerThreadMain() {
       do {
         // If we spin around too much, revert to a "low-power" state.
         if (loop_count > 500) {
-          const int wait_time_ms = 5;
-          rex::thread::Wait(write_ptr_index_event_.get(), true,
-                            std::chrono::milliseconds(wait_time_ms));
+          // Advertise that we're about to park on the event so that
+          // UpdateWritePointer knows the atomic store alone won't reach us,
+          // then recheck for work published in the window before the flag
+          // became visible.
+          write_ptr_index_parked_.store(true);
+          write_ptr_index = write_ptr_index_.load();
+          if (worker_running_ && pending_fns_.empty() &&
+              (write_ptr_index == 0xBAADF00D || read_ptr_index_ == write_ptr_index)) {
+            const int wait_time_ms = 5;
+            rex::thread::Wait(write_ptr_index_event_.get(), true,
+                              std::chrono::milliseconds(wait_time_ms));
+          }
+          write_ptr_index_parked_.store(false);
         }
 
         rex::thread::MaybeYield();
@@ -322,7 +345,13 @@ void CommandProcessor::EnableReadPointerWriteBack(uint32_t ptr, uint32_t block_s
 
 void CommandProcessor::UpdateWritePointer(uint32_t value) {
   write_ptr_index_ = value;
-  write_ptr_index_event_->Set();
+  // Only pay for the kernel event when the worker has actually parked on it.
+  // While it spins or executes packets (the common case mid-frame) the
+  // sequentially consistent store above is the whole handoff, so VdSwap's
+  // write-pointer bump reaches the worker without a syscall.
+  if (write_ptr_index_parked_.load()) {
+    write_ptr_index_event_->Set();
+  }
 }
 
 void CommandProcessor::WriteRegister(uint32_t index, uint32_t value) {
@@ -370,6 +399,11 @@ void CommandProcessor::WriteRegister(uint32_t index, uint32_t value) {
         // enable mask is blue, green, red.
         bool write_gamma_ramp_component = (regs[XE_GPU_REG_DC_LUT_WRITE_EN_MASK] &
                                            (UINT32_C(1) << (2 - gamma_ramp_rw_component_))) != 0;
+        // Notify the implementation only when the value actually changes -
+        // titles commonly rewrite an identical ramp every frame, and an
+        // unchanged ramp must not force the host ramp representation to be
+        // re-uploaded every presentation.
+        bool gamma_ramp_changed = false;
         if (write_gamma_ramp_component) {
           reg::DC_LUT_30_COLOR& gamma_ramp_entry =
               gamma_ramp_256_entry_table_[gamma_ramp_rw_index.rw_index];
@@ -377,12 +411,15 @@ void CommandProcessor::WriteRegister(uint32_t index, uint32_t value) {
           uint32_t gamma_ramp_seq_color = regs.Get<reg::DC_LUT_SEQ_COLOR>().seq_color >> 6;
           switch (gamma_ramp_rw_component_) {
             case 0:
+              gamma_ramp_changed = gamma_ramp_entry.color_10_red != gamma_ramp_seq_color;
               gamma_ramp_entry.color_10_red = gamma_ramp_seq_color;
               break;
             case 1:
+              gamma_ramp_changed = gamma_ramp_entry.color_10_green != gamma_ramp_seq_color;
               gamma_ramp_entry.color_10_green = gamma_ramp_seq_color;
               break;
             case 2:
+              gamma_ramp_changed = gamma_ramp_entry.color_10_blue != gamma_ramp_seq_color;
               gamma_ramp_entry.color_10_blue = gamma_ramp_seq_color;
               break;
           }
@@ -394,7 +431,7 @@ void CommandProcessor::WriteRegister(uint32_t index, uint32_t value) {
           WriteRegister(XE_GPU_REG_DC_LUT_RW_INDEX,
                         rex::memory::Reinterpret<uint32_t>(new_gamma_ramp_rw_index));
         }
-        if (write_gamma_ramp_component) {
+        if (gamma_ramp_changed) {
           OnGammaRamp256EntryTableValueWritten();
         }
       } break;
@@ -409,13 +446,18 @@ void CommandProcessor::WriteRegister(uint32_t index, uint32_t value) {
         // DC_LUT_SEQ_COLOR is, but the write enable mask is blue, green, red.
         bool write_gamma_ramp_component = (regs[XE_GPU_REG_DC_LUT_WRITE_EN_MASK] &
                                            (UINT32_C(1) << (2 - gamma_ramp_rw_component_))) != 0;
+        bool gamma_ramp_changed = false;
         if (write_gamma_ramp_component) {
           reg::DC_LUT_PWL_DATA& gamma_ramp_entry =
               gamma_ramp_pwl_rgb_[gamma_ramp_rw_index_pwl][gamma_ramp_rw_component_];
           auto gamma_ramp_value = regs.Get<reg::DC_LUT_PWL_DATA>();
           // Bits 0:5 are hardwired to zero.
-          gamma_ramp_entry.base = gamma_ramp_value.base & ~UINT32_C(0x3F);
-          gamma_ramp_entry.delta = gamma_ramp_value.delta & ~UINT32_C(0x3F);
+          uint32_t gamma_ramp_base = gamma_ramp_value.base & ~UINT32_C(0x3F);
+          uint32_t gamma_ramp_delta = gamma_ramp_value.delta & ~UINT32_C(0x3F);
+          gamma_ramp_changed = gamma_ramp_entry.base != gamma_ramp_base ||
+                               gamma_ramp_entry.delta != gamma_ramp_delta;
+          gamma_ramp_entry.base = gamma_ramp_base;
+          gamma_ramp_entry.delta = gamma_ramp_delta;
         }
         if (++gamma_ramp_rw_component_ >= 3) {
           gamma_ramp_rw_component_ = 0;
@@ -429,7 +471,7 @@ void CommandProcessor::WriteRegister(uint32_t index, uint32_t value) {
           WriteRegister(XE_GPU_REG_DC_LUT_RW_INDEX,
                         rex::memory::Reinterpret<uint32_t>(new_gamma_ramp_rw_index));
         }
-        if (write_gamma_ramp_component) {
+        if (gamma_ramp_changed) {
           OnGammaRampPWLValueWritten();
         }
       } break;
@@ -439,17 +481,21 @@ void CommandProcessor::WriteRegister(uint32_t index, uint32_t value) {
         assert_zero(regs[XE_GPU_REG_DC_LUT_RW_MODE] & 0b1);
         auto gamma_ramp_rw_index = regs.Get<reg::DC_LUT_RW_INDEX>();
         uint32_t gamma_ramp_write_enable_mask = regs[XE_GPU_REG_DC_LUT_WRITE_EN_MASK] & 0b111;
+        bool gamma_ramp_changed = false;
         if (gamma_ramp_write_enable_mask) {
           reg::DC_LUT_30_COLOR& gamma_ramp_entry =
               gamma_ramp_256_entry_table_[gamma_ramp_rw_index.rw_index];
           auto gamma_ramp_value = regs.Get<reg::DC_LUT_30_COLOR>();
           if (gamma_ramp_write_enable_mask & 0b001) {
+            gamma_ramp_changed |= gamma_ramp_entry.color_10_blue != gamma_ramp_value.color_10_blue;
             gamma_ramp_entry.color_10_blue = gamma_ramp_value.color_10_blue;
           }
           if (gamma_ramp_write_enable_mask & 0b010) {
+            gamma_ramp_changed |= gamma_ramp_entry.color_10_green != gamma_ramp_value.color_10_green;
             gamma_ramp_entry.color_10_green = gamma_ramp_value.color_10_green;
           }
           if (gamma_ramp_write_enable_mask & 0b100) {
+            gamma_ramp_changed |= gamma_ramp_entry.color_10_red != gamma_ramp_value.color_10_red;
             gamma_ramp_entry.color_10_red = gamma_ramp_value.color_10_red;
           }
         }
@@ -462,7 +508,7 @@ void CommandProcessor::WriteRegister(uint32_t index, uint32_t value) {
         ++new_gamma_ramp_rw_index.rw_index;
         WriteRegister(XE_GPU_REG_DC_LUT_RW_INDEX,
                       rex::memory::Reinterpret<uint32_t>(new_gamma_ramp_rw_index));
-        if (gamma_ramp_write_enable_mask) {
+        if (gamma_ramp_changed) {
           OnGammaRamp256EntryTableValueWritten();
         }
       } break;
@@ -470,6 +516,57 @@ void CommandProcessor::WriteRegister(uint32_t index, uint32_t value) {
   }
 }
 
+void CommandProcessor::WriteRegisterRange(uint32_t first_index, const uint32_t* values,
+                                          uint32_t count) {
+  if (first_index >= RegisterFile::kRegisterCount ||
+      RegisterFile::kRegisterCount - first_index < count) {
+    REXGPU_WARN(
+        "CommandProcessor::WriteRegisterRange out of bounds (0x{:X} registers "
+        "starting with 0x{:X})",
+        count, first_index);
+    if (first_index >= RegisterFile::kRegisterCount) {
+      return;
+    }
+    count = RegisterFile::kRegisterCount - first_index;
+  }
+  if (!count) {
+    return;
+  }
+  // Registers with side effects on write (scratch register writeback, the
+  // display controller LUT, COHER_STATUS_HOST) all live below the PM4 constant
+  // space, so constant upload bursts - the dominant users of range writes -
+  // take the memcpy path.
+  if (first_index <= XE_GPU_REG_DC_LUT_30_COLOR &&
+      first_index + count - 1 >= XE_GPU_REG_SCRATCH_REG0) {
+    for (uint32_t i = 0; i < count; ++i) {
+      WriteRegister(first_index + i, values[i]);
+    }
+    return;
+  }
+  std::memcpy(register_file_->values + first_index, values, sizeof(uint32_t) * count);
+  OnRegisterRangeWritten(first_index, count);
+}
+
+void CommandProcessor::WriteRegisterRangeFromRing(memory::RingBuffer* reader, uint32_t first_index,
+                                                  uint32_t count) {
+  if (!count) {
+    return;
+  }
+  // Swap the whole burst out of the ring at once so the range write can be a
+  // single memcpy into the register file.
+  burst_registers_.resize(count);
+  memory::RingBuffer::ReadRange read_range = reader->BeginRead(count * sizeof(uint32_t));
+  memory::copy_and_swap_32_unaligned(burst_registers_.data(), read_range.first,
+                                     read_range.first_length / sizeof(uint32_t));
+  if (read_range.second_length) {
+    memory::copy_and_swap_32_unaligned(
+        burst_registers_.data() + read_range.first_length / sizeof(uint32_t), read_range.second,
+        read_range.second_length / sizeof(uint32_t));
+  }
+  reader->EndRead(read_range);
+  WriteRegisterRange(first_index, burst_registers_.data(), count);
+}
+
 void CommandProcessor::MakeCoherent() {
   SCOPE_profile_cpu_f("gpu");
 
@@ -538,21 +635,26 @@ uint32_t CommandProcessor::ExecutePrimaryBuffer(uint32_t read_index, uint32_t wr
 
   trace_writer_.WritePrimaryBufferStart(start_ptr, write_index - read_index);
 
+  uint64_t busy_start_ticks = rex::chrono::Clock::QueryHostTickCount();
+
   // Execute commands!
   memory::RingBuffer reader(memory_->TranslatePhysical(primary_buffer_ptr_), primary_buffer_size_);
   reader.set_read_offset(read_index * sizeof(uint32_t));
   reader.set_write_offset(write_index * sizeof(uint32_t));
-  do {
-    if (!ExecutePacket(&reader)) {
-      // This probably should be fatal - but we're going to continue anyways.
-      REXGPU_ERROR("**** PRIMARY RINGBUFFER: Failed to execute packet.");
-      assert_always();
-      break;
-    }
-  } while (reader.read_count());
+  if (!ExecutePacketBatch(&reader)) {
+    // This probably should be fatal - but we're going to continue anyways.
+    REXGPU_ERROR("**** PRIMARY RINGBUFFER: Failed to execute packet.");
+    assert_always();
+  }
 
   OnPrimaryBufferEnd();
 
+  frame_phase_busy_ticks_ += rex::chrono::Clock::QueryHostTickCount() - busy_start_ticks;
+
+  if (REXCVAR_GET(gpu_packet_stats) && counter_ - packet_stats_last_counter_ >= 60) {
+    LogPacketStats();
+  }
+
   trace_writer_.WritePrimaryBufferEnd();
 
   return write_index;
@@ -566,14 +668,11 @@ void CommandProcessor::ExecuteIndirectBuffer(uint32_t ptr, uint32_t count) {
   // Execute commands!
   memory::RingBuffer reader(memory_->TranslatePhysical(ptr), count * sizeof(uint32_t));
   reader.set_write_offset(count * sizeof(uint32_t));
-  do {
-    if (!ExecutePacket(&reader)) {
-      // Return up a level if we encounter a bad packet.
-      REXGPU_ERROR("**** INDIRECT RINGBUFFER: Failed to execute packet.");
-      assert_always();
-      break;
-    }
-  } while (reader.read_count());
+  if (!ExecutePacketBatch(&reader)) {
+    // Return up a level if we encounter a bad packet.
+    REXGPU_ERROR("**** INDIRECT RINGBUFFER: Failed to execute packet.");
+    assert_always();
+  }
 
   trace_writer_.WriteIndirectBufferEnd();
 }
@@ -582,18 +681,87 @@ void CommandProcessor::ExecutePacket(uint32_t ptr, uint32_t count) {
   // Execute commands!
   memory::RingBuffer reader(memory_->TranslatePhysical(ptr), count * sizeof(uint32_t));
   reader.set_write_offset(count * sizeof(uint32_t));
-  do {
-    if (!ExecutePacket(&reader)) {
-      REXGPU_ERROR("**** ExecutePacket: Failed to execute packet.");
-      assert_always();
+  if (!ExecutePacketBatch(&reader)) {
+    REXGPU_ERROR("**** ExecutePacket: Failed to execute packet.");
+    assert_always();
+  }
+}
+
+void CommandProcessor::DecodePacketBatch(memory::RingBuffer reader,
+                                         std::vector<DecodedPacket>* decoded) {
+  // The reader is taken by value: this is a scan cursor over the same ring
+  // storage the execute stage consumes afterwards.
+  decoded->clear();
+  while (reader.read_count() >= sizeof(uint32_t)) {
+    DecodedPacket packet;
+    packet.packet = reader.ReadAndSwap<uint32_t>();
+    packet.type = packet.packet >> 30;
+    packet.opcode = 0;
+    packet.count = 0;
+    // A zero header is a single no-op dword with no payload, regardless of
+    // the count field.
+    if (packet.packet != 0) {
+      switch (packet.type) {
+        case 0x00:
+        case 0x03:
+          packet.count = ((packet.packet >> 16) & 0x3FFF) + 1;
+          break;
+        case 0x01:
+          packet.count = 2;
+          break;
+        case 0x02:
+          break;
+      }
+    }
+    if (packet.type == 0x03) {
+      packet.opcode = (packet.packet >> 8) & 0x7F;
+    }
+    decoded->push_back(packet);
+    size_t payload_size = packet.count * sizeof(uint32_t);
+    if (payload_size > reader.read_count()) {
+      // Truncated packet; the execute stage reports the overflow through the
+      // packet's own error path.
       break;
     }
-  } while (reader.read_count());
+    reader.AdvanceRead(payload_size);
+  }
 }
 
-bool CommandProcessor::ExecutePacket(memory::RingBuffer* reader) {
+bool CommandProcessor::ExecutePacketBatch(memory::RingBuffer* reader) {
+  // Stage 1: scan the whole pending segment into a flat packet array. The
+  // headers are touched sequentially and boundaries are known up front, so
+  // the execute stage dispatches off precomputed fields instead of reparsing.
+  if (batch_depth_ == decode_buffers_.size()) {
+    decode_buffers_.emplace_back();
+  }
+  std::vector<DecodedPacket>& decoded = decode_buffers_[batch_depth_++];
+  DecodePacketBatch(*reader, &decoded);
+
+  // Stage 2: execute.
+  bool result = true;
+  bool collect_stats = REXCVAR_GET(gpu_packet_stats);
+  for (const DecodedPacket& packet : decoded) {
+    if (collect_stats) {
+      uint64_t start_ticks = rex::chrono::Clock::QueryHostTickCount();
+      result = ExecutePacket(reader, packet);
+      PacketStat& stat =
+          packet_stats_[packet.type == 0x03 ? 4 + packet.opcode : packet.type];
+      ++stat.packets;
+      stat.ticks += rex::chrono::Clock::QueryHostTickCount() - start_ticks;
+    } else {
+      result = ExecutePacket(reader, packet);
+    }
+    if (!result) {
+      break;
+    }
+  }
+  --batch_depth_;
+  return result;
+}
+
+bool CommandProcessor::ExecutePacket(memory::RingBuffer* reader, const DecodedPacket& decoded) {
   const uint32_t packet = reader->ReadAndSwap<uint32_t>();
-  const uint32_t packet_type = packet >> 30;
+  assert_true(packet == decoded.packet);
   if (packet == 0) {
     trace_writer_.WritePacketStart(uint32_t(reader->read_ptr() - 4), 1);
     trace_writer_.WritePacketEnd();
@@ -604,7 +772,7 @@ bool CommandProcessor::ExecutePacket(memory::RingBuffer* reader) {
     REXGPU_WARN("GPU packet is CDCDCDCD - probably read uninitialized memory!");
   }
 
-  switch (packet_type) {
+  switch (decoded.type) {
     case 0x00:
       return ExecutePacketType0(reader, packet);
     case 0x01:
@@ -614,11 +782,31 @@ bool CommandProcessor::ExecutePacket(memory::RingBuffer* reader) {
     case 0x03:
       return ExecutePacketType3(reader, packet);
     default:
-      assert_unhandled_case(packet_type);
+      assert_unhandled_case(decoded.type);
       return false;
   }
 }
 
+void CommandProcessor::LogPacketStats() {
+  uint32_t frames = counter_ - packet_stats_last_counter_;
+  packet_stats_last_counter_ = counter_;
+  uint64_t tick_frequency = rex::chrono::Clock::QueryHostTickFrequency();
+  REXGPU_INFO("PM4 packet stats over {} frames:", frames);
+  for (uint32_t i = 0; i < rex::countof(packet_stats_); ++i) {
+    PacketStat& stat = packet_stats_[i];
+    if (!stat.packets) {
+      continue;
+    }
+    uint64_t microseconds = stat.ticks * 1000000 / tick_frequency;
+    if (i < 4) {
+      REXGPU_INFO("  type{}: {} packets, {} us", i, stat.packets, microseconds);
+    } else {
+      REXGPU_INFO("  type3 op 0x{:02X}: {} packets, {} us", i - 4, stat.packets, microseconds);
+    }
+    stat = {};
+  }
+}
+
 bool CommandProcessor::ExecutePacketType0(memory::RingBuffer* reader, uint32_t packet) {
   // Type-0 packet.
   // Write count registers in sequence to the registers starting at
@@ -841,6 +1029,16 @@ bool CommandProcessor::ExecutePacketType3(memory::RingBuffer* reader, uint32_t p
       if (trace_state_ == TraceState::kSingleFrame) {
         trace_state_ = TraceState::kDisabled;
         trace_writer_.Close();
+      } else if (trace_state_ == TraceState::kStreaming) {
+        // Periodically rewrite the full GPU state so the trace viewer can
+        // restore the nearest keyframe when seeking instead of replaying the
+        // whole stream up to the target frame.
+        int32_t keyframe_interval = REXCVAR_GET(trace_stream_keyframe_interval);
+        if (keyframe_interval &&
+            ++trace_stream_frames_since_keyframe_ >= uint32_t(keyframe_interval)) {
+          trace_stream_frames_since_keyframe_ = 0;
+          InitializeTrace();
+        }
       }
     } else if (trace_state_ == TraceState::kSingleFrame) {
       // New trace request - we only start tracing at the beginning of a frame.
@@ -882,11 +1080,7 @@ bool CommandProcessor::ExecutePacketType3_INTERRUPT(memory::RingBuffer* reader,
 
   // generate interrupt from the command stream
   uint32_t cpu_mask = reader->ReadAndSwap<uint32_t>();
-  for (int n = 0; n < 6; n++) {
-    if (cpu_mask & (1 << n)) {
-      graphics_system_->DispatchInterruptCallback(1, n);
-    }
-  }
+  graphics_system_->DispatchInterruptCallbackBatch(1, cpu_mask);
   return true;
 }
 
@@ -909,12 +1103,60 @@ bool CommandProcessor::ExecutePacketType3_XE_SWAP(memory::RingBuffer* reader, ui
   uint32_t frontbuffer_height = reader->ReadAndSwap<uint32_t>();
   reader->AdvanceRead((count - 4) * sizeof(uint32_t));
 
+  uint64_t swap_start_ticks = rex::chrono::Clock::QueryHostTickCount();
   IssueSwap(frontbuffer_ptr, frontbuffer_width, frontbuffer_height);
+  frame_phase_swap_ticks_ += rex::chrono::Clock::QueryHostTickCount() - swap_start_ticks;
+
+  if (REXCVAR_GET(gpu_frame_phase_stats)) {
+    CompleteFramePhaseTiming();
+  } else {
+    frame_phase_draw_ticks_ = 0;
+    frame_phase_resolve_ticks_ = 0;
+    frame_phase_swap_ticks_ = 0;
+    frame_phase_busy_ticks_ = 0;
+  }
 
   ++counter_;
   return true;
 }
 
+void CommandProcessor::CompleteFramePhaseTiming() {
+  double ms_per_tick = 1000.0 / double(rex::chrono::Clock::QueryHostTickFrequency());
+  FramePhaseTiming timing;
+  timing.draw_ms = float(frame_phase_draw_ticks_ * ms_per_tick);
+  timing.resolve_ms = float(frame_phase_resolve_ticks_ * ms_per_tick);
+  timing.swap_ms = float(frame_phase_swap_ticks_ * ms_per_tick);
+  // The primary buffer time includes the phases measured separately - the
+  // remainder is register writes, constant uploads and other PM4 processing.
+  uint64_t accounted_ticks =
+      frame_phase_draw_ticks_ + frame_phase_resolve_ticks_ + frame_phase_swap_ticks_;
+  timing.other_ms = float(
+      (frame_phase_busy_ticks_ > accounted_ticks ? frame_phase_busy_ticks_ - accounted_ticks : 0) *
+      ms_per_tick);
+  frame_phase_draw_ticks_ = 0;
+  frame_phase_resolve_ticks_ = 0;
+  frame_phase_swap_ticks_ = 0;
+  frame_phase_busy_ticks_ = 0;
+  {
+    std::lock_guard<std::mutex> lock(frame_phase_mutex_);
+    frame_phase_history_[frame_phase_history_next_] = timing;
+    frame_phase_history_next_ = (frame_phase_history_next_ + 1) % kFramePhaseHistorySize;
+    frame_phase_history_count_ = std::min(frame_phase_history_count_ + 1, kFramePhaseHistorySize);
+  }
+}
+
+std::vector<CommandProcessor::FramePhaseTiming> CommandProcessor::GetFramePhaseTimings() const {
+  std::vector<FramePhaseTiming> timings;
+  std::lock_guard<std::mutex> lock(frame_phase_mutex_);
+  timings.reserve(frame_phase_history_count_);
+  size_t first = (frame_phase_history_next_ + kFramePhaseHistorySize - frame_phase_history_count_) %
+                 kFramePhaseHistorySize;
+  for (size_t i = 0; i < frame_phase_history_count_; ++i) {
+    timings.push_back(frame_phase_history_[(first + i) % kFramePhaseHistorySize]);
+  }
+  return timings;
+}
+
 bool CommandProcessor::ExecutePacketType3_INDIRECT_BUFFER(memory::RingBuffer* reader,
                                                           uint32_t packet, uint32_t count) {
   // indirect buffer dispatch
@@ -1338,10 +1580,19 @@ bool CommandProcessor::ExecutePacketType3Draw(memory::RingBuffer* reader, uint32
       // TODO(Triang3l || JoelLinn): Handle this properly in the render
       // backends.
 
+      uint64_t draw_start_ticks = rex::chrono::Clock::QueryHostTickCount();
       draw_succeeded = IssueDraw(
           vgt_draw_initiator.prim_type, vgt_draw_initiator.num_indices,
           is_indexed ? &index_buffer_info : nullptr,
           xenos::IsMajorModeExplicit(vgt_draw_initiator.major_mode, vgt_draw_initiator.prim_type));
+      uint64_t draw_ticks = rex::chrono::Clock::QueryHostTickCount() - draw_start_ticks;
+      // Backends dispatch EDRAM-mode-kCopy draws to IssueCopy - account for
+      // resolves separately from actual draws.
+      if (register_file_->Get<reg::RB_MODECONTROL>().edram_mode == xenos::EdramMode::kCopy) {
+        frame_phase_resolve_ticks_ += draw_ticks;
+      } else {
+        frame_phase_draw_ticks_ += draw_ticks;
+      }
       if (!draw_succeeded) {
         REXGPU_ERROR("{}({}, {}, {}): Failed in backend", opcode_name,
                      static_cast<uint32_t>(vgt_draw_initiator.num_indices),
@@ -1412,10 +1663,7 @@ bool CommandProcessor::ExecutePacketType3_SET_CONSTANT(memory::RingBuffer* reade
       reader->AdvanceRead((count - 1) * sizeof(uint32_t));
       return true;
   }
-  for (uint32_t n = 0; n < count - 1; n++, index++) {
-    uint32_t data = reader->ReadAndSwap<uint32_t>();
-    WriteRegister(index, data);
-  }
+  WriteRegisterRangeFromRing(reader, index, count - 1);
   return true;
 }
 
@@ -1423,10 +1671,7 @@ bool CommandProcessor::ExecutePacketType3_SET_CONSTANT2(memory::RingBuffer* read
                                                         uint32_t count) {
   uint32_t offset_type = reader->ReadAndSwap<uint32_t>();
   uint32_t index = offset_type & 0xFFFF;
-  for (uint32_t n = 0; n < count - 1; n++, index++) {
-    uint32_t data = reader->ReadAndSwap<uint32_t>();
-    WriteRegister(index, data);
-  }
+  WriteRegisterRangeFromRing(reader, index, count - 1);
   return true;
 }
 
@@ -1461,9 +1706,11 @@ bool CommandProcessor::ExecutePacketType3_LOAD_ALU_CONSTANT(memory::RingBuffer*
       return true;
   }
   trace_writer_.WriteMemoryRead(CpuToGpu(address), size_dwords * 4);
-  for (uint32_t n = 0; n < size_dwords; n++, index++) {
-    uint32_t data = memory::load_and_swap<uint32_t>(memory_->TranslatePhysical(address + n * 4));
-    WriteRegister(index, data);
+  if (size_dwords) {
+    burst_registers_.resize(size_dwords);
+    memory::copy_and_swap_32_unaligned(burst_registers_.data(),
+                                       memory_->TranslatePhysical(address), size_dwords);
+    WriteRegisterRange(index, burst_registers_.data(), size_dwords);
   }
   return true;
 }
@@ -1472,10 +1719,7 @@ bool CommandProcessor::ExecutePacketType3_SET_SHADER_CONSTANTS(memory::RingBuffe
                                                                uint32_t packet, uint32_t count) {
   uint32_t offset_type = reader->ReadAndSwap<uint32_t>();
   uint32_t index = offset_type & 0xFFFF;
-  for (uint32_t n = 0; n < count - 1; n++, index++) {
-    uint32_t data = reader->ReadAndSwap<uint32_t>();
-    WriteRegister(index, data);
-  }
+  WriteRegisterRangeFromRing(reader, index, count - 1);
   return true;
 }
 
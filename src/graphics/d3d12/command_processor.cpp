@@ -1574,6 +1574,79 @@ void D3D12CommandProcessor::WriteRegister(uint32_t index, uint32_t value) {
   }
 }
 
+void D3D12CommandProcessor::OnRegisterRangeWritten(uint32_t first_index, uint32_t count) {
+  uint32_t last_index = first_index + count - 1;
+  if (frame_open_ && first_index <= XE_GPU_REG_SHADER_CONSTANT_511_W &&
+      last_index >= XE_GPU_REG_SHADER_CONSTANT_000_X) {
+    // Invalidate the float constant buffers only if constants actually used by
+    // the current shaders are in the range, like in WriteRegister, but with one
+    // check per 64 constants. Vertex float constants are 0...255, pixel
+    // constants are 256...511.
+    uint32_t float_constant_first =
+        (std::max(first_index, uint32_t(XE_GPU_REG_SHADER_CONSTANT_000_X)) -
+         XE_GPU_REG_SHADER_CONSTANT_000_X) >>
+        2;
+    uint32_t float_constant_last =
+        (std::min(last_index, uint32_t(XE_GPU_REG_SHADER_CONSTANT_511_W)) -
+         XE_GPU_REG_SHADER_CONSTANT_000_X) >>
+        2;
+    if (float_constant_first < 256 && cbuffer_binding_float_vertex_.up_to_date) {
+      uint32_t vertex_last = std::min(float_constant_last, uint32_t(255));
+      for (uint32_t i = float_constant_first >> 6; i <= (vertex_last >> 6); ++i) {
+        uint64_t mask = UINT64_MAX;
+        if (i == (float_constant_first >> 6)) {
+          mask &= ~((uint64_t(1) << (float_constant_first & 63)) - 1);
+        }
+        if (i == (vertex_last >> 6) && (vertex_last & 63) != 63) {
+          mask &= (uint64_t(1) << ((vertex_last & 63) + 1)) - 1;
+        }
+        if (current_float_constant_map_vertex_[i] & mask) {
+          cbuffer_binding_float_vertex_.up_to_date = false;
+          break;
+        }
+      }
+    }
+    if (float_constant_last >= 256 && cbuffer_binding_float_pixel_.up_to_date) {
+      uint32_t pixel_first = std::max(float_constant_first, uint32_t(256)) - 256;
+      uint32_t pixel_last = float_constant_last - 256;
+      for (uint32_t i = pixel_first >> 6; i <= (pixel_last >> 6); ++i) {
+        uint64_t mask = UINT64_MAX;
+        if (i == (pixel_first >> 6)) {
+          mask &= ~((uint64_t(1) << (pixel_first & 63)) - 1);
+        }
+        if (i == (pixel_last >> 6) && (pixel_last & 63) != 63) {
+          mask &= (uint64_t(1) << ((pixel_last & 63) + 1)) - 1;
+        }
+        if (current_float_constant_map_pixel_[i] & mask) {
+          cbuffer_binding_float_pixel_.up_to_date = false;
+          break;
+        }
+      }
+    }
+  }
+  if (first_index <= XE_GPU_REG_SHADER_CONSTANT_LOOP_31 &&
+      last_index >= XE_GPU_REG_SHADER_CONSTANT_BOOL_000_031) {
+    cbuffer_binding_bool_loop_.up_to_date = false;
+  }
+  if (first_index <= XE_GPU_REG_SHADER_CONSTANT_FETCH_31_5 &&
+      last_index >= XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0) {
+    cbuffer_binding_fetch_.up_to_date = false;
+    if (texture_cache_ != nullptr) {
+      uint32_t fetch_constant_first =
+          (std::max(first_index, uint32_t(XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0)) -
+           XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0) /
+          6;
+      uint32_t fetch_constant_last =
+          (std::min(last_index, uint32_t(XE_GPU_REG_SHADER_CONSTANT_FETCH_31_5)) -
+           XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0) /
+          6;
+      for (uint32_t i = fetch_constant_first; i <= fetch_constant_last; ++i) {
+        texture_cache_->TextureFetchConstantWritten(i);
+      }
+    }
+  }
+}
+
 void D3D12CommandProcessor::OnGammaRamp256EntryTableValueWritten() {
   gamma_ramp_256_entry_table_up_to_date_ = false;
 }
@@ -2502,9 +2575,18 @@ bool D3D12CommandProcessor::BeginSubmission(bool is_guest_command) {
 
   // Check the fence - needed for all kinds of submissions (to reclaim transient
   // resources early) and specifically for frames (not to queue too many), and
-  // await the availability of the current frame.
-  CheckSubmissionFence(is_opening_frame ? closed_frame_submissions_[frame_current_ % kQueueFrames]
-                                        : 0);
+  // await the availability of the current frame. The frame queue depth can be
+  // lowered below kQueueFrames (which only sizes the per-frame resource arrays)
+  // to trade CPU/GPU overlap for latency.
+  uint64_t await_submission = 0;
+  if (is_opening_frame) {
+    uint64_t max_queued_frames = uint64_t(
+        std::clamp(REXCVAR_GET(gpu_max_queued_frames), int32_t(1), int32_t(kQueueFrames)));
+    await_submission =
+        closed_frame_submissions_[(frame_current_ + kQueueFrames - max_queued_frames) %
+                                  kQueueFrames];
+  }
+  CheckSubmissionFence(await_submission);
   // TODO(Triang3l): If failed to await (completed submission < awaited frame
   // submission), do something like dropping the draw command that wanted to
   // open the frame.
@@ -2641,6 +2723,10 @@ bool D3D12CommandProcessor::EndSubmission(bool is_swap) {
 
     ID3D12CommandQueue* direct_queue = provider.GetDirectQueue();
 
+    // Put any tile mappings allocated during this submission on the queue
+    // before the command lists that rely on them execute.
+    shared_memory_->FlushPendingTileMappings();
+
     // Submit the deferred command list.
     // Only one deferred command list must be executed in the same
     // ExecuteCommandLists - the boundaries of ExecuteCommandLists are a full
@@ -3800,11 +3886,10 @@ bool D3D12CommandProcessor::UpdateBindings(const D3D12Shader* vertex_shader,
       assert_true(current_graphics_root_bindful_extras_.textures_vertex !=
                   RootBindfulExtraParameterIndices::kUnavailable);
       gpu_handle_textures_vertex_ = view_gpu_handle;
-      for (size_t i = 0; i < texture_count_vertex; ++i) {
-        texture_cache_->WriteActiveTextureBindfulSRV(textures_vertex[i], view_cpu_handle);
-        view_cpu_handle.ptr += descriptor_size_view;
-        view_gpu_handle.ptr += descriptor_size_view;
-      }
+      texture_cache_->WriteActiveTextureBindfulSRVs(textures_vertex.data(), texture_count_vertex,
+                                                    view_cpu_handle);
+      view_cpu_handle.ptr += descriptor_size_view * texture_count_vertex;
+      view_gpu_handle.ptr += descriptor_size_view * texture_count_vertex;
       current_texture_layout_uid_vertex_ = texture_layout_uid_vertex;
       current_texture_srv_keys_vertex_.resize(
           std::max(current_texture_srv_keys_vertex_.size(), size_t(texture_count_vertex)));
@@ -3818,11 +3903,10 @@ bool D3D12CommandProcessor::UpdateBindings(const D3D12Shader* vertex_shader,
       assert_true(current_graphics_root_bindful_extras_.textures_pixel !=
                   RootBindfulExtraParameterIndices::kUnavailable);
       gpu_handle_textures_pixel_ = view_gpu_handle;
-      for (size_t i = 0; i < texture_count_pixel; ++i) {
-        texture_cache_->WriteActiveTextureBindfulSRV((*textures_pixel)[i], view_cpu_handle);
-        view_cpu_handle.ptr += descriptor_size_view;
-        view_gpu_handle.ptr += descriptor_size_view;
-      }
+      texture_cache_->WriteActiveTextureBindfulSRVs(textures_pixel->data(), texture_count_pixel,
+                                                    view_cpu_handle);
+      view_cpu_handle.ptr += descriptor_size_view * texture_count_pixel;
+      view_gpu_handle.ptr += descriptor_size_view * texture_count_pixel;
       current_texture_layout_uid_pixel_ = texture_layout_uid_pixel;
       current_texture_srv_keys_pixel_.resize(
           std::max(current_texture_srv_keys_pixel_.size(), size_t(texture_count_pixel)));
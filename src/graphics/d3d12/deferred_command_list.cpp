@@ -9,6 +9,8 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <algorithm>
+
 #include <rex/assert.h>
 #include <rex/dbg.h>
 #include <rex/graphics/d3d12/command_processor.h>
@@ -25,7 +27,10 @@ DeferredCommandList::DeferredCommandList(const D3D12CommandProcessor& command_pr
 }
 
 void DeferredCommandList::Reset() {
-  command_stream_.clear();
+  // Keep the vector at its high-water size - clearing and re-growing it every
+  // frame would zero-initialize the whole stream again in resize before the
+  // actual commands are written over it.
+  command_stream_used_ = 0;
 }
 
 void DeferredCommandList::Execute(ID3D12GraphicsCommandList* command_list,
@@ -34,7 +39,7 @@ void DeferredCommandList::Execute(ID3D12GraphicsCommandList* command_list,
   SCOPE_profile_cpu_f("gpu");
 #endif  // XE_GPU_FINE_GRAINED_DRAW_SCOPES
   const uintmax_t* stream = command_stream_.data();
-  size_t stream_remaining = command_stream_.size();
+  size_t stream_remaining = command_stream_used_;
   ID3D12PipelineState* current_pipeline_state = nullptr;
   while (stream_remaining != 0) {
     const CommandHeader& header = *reinterpret_cast<const CommandHeader*>(stream);
@@ -231,8 +236,11 @@ void DeferredCommandList::Execute(ID3D12GraphicsCommandList* command_list,
 void* DeferredCommandList::WriteCommand(Command command, size_t arguments_size_bytes) {
   size_t arguments_size_elements =
       (arguments_size_bytes + sizeof(uintmax_t) - 1) / sizeof(uintmax_t);
-  size_t offset = command_stream_.size();
-  command_stream_.resize(offset + kCommandHeaderSizeElements + arguments_size_elements);
+  size_t offset = command_stream_used_;
+  command_stream_used_ += kCommandHeaderSizeElements + arguments_size_elements;
+  if (command_stream_used_ > command_stream_.size()) {
+    command_stream_.resize(std::max(command_stream_used_, command_stream_.size() * 2));
+  }
   CommandHeader& header = *reinterpret_cast<CommandHeader*>(command_stream_.data() + offset);
   header.command = command;
   header.arguments_size_elements = uint32_t(arguments_size_elements);
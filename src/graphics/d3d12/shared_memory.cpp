@@ -151,6 +151,7 @@ void D3D12SharedMemory::Shutdown(bool from_destructor) {
   // First free the buffer to detach it from the heaps.
   ui::d3d12::util::ReleaseAndNull(buffer_);
 
+  buffer_pending_tile_mappings_.clear();
   for (ID3D12Heap* heap : buffer_tiled_heaps_) {
     heap->Release();
   }
@@ -335,8 +336,11 @@ bool D3D12SharedMemory::AllocateSparseHostGpuMemoryRange(uint32_t offset_allocat
 
   const ui::d3d12::D3D12Provider& provider = command_processor_.GetD3D12Provider();
   ID3D12Device* device = provider.GetDevice();
-  ID3D12CommandQueue* direct_queue = provider.GetDirectQueue();
 
+  // Create the heap eagerly so out-of-memory still fails the request that
+  // needs the range, but defer the queue-side tile mapping update to
+  // FlushPendingTileMappings - mapping one granule at a time during streaming
+  // produced an UpdateTileMappings storm on the direct queue.
   D3D12_HEAP_DESC heap_desc = {};
   heap_desc.SizeInBytes = length_bytes;
   heap_desc.Properties.Type = D3D12_HEAP_TYPE_DEFAULT;
@@ -348,23 +352,43 @@ bool D3D12SharedMemory::AllocateSparseHostGpuMemoryRange(uint32_t offset_allocat
   }
   buffer_tiled_heaps_.push_back(heap);
 
-  D3D12_TILED_RESOURCE_COORDINATE region_start_coordinates;
-  region_start_coordinates.X = offset_bytes / D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES;
-  region_start_coordinates.Y = 0;
-  region_start_coordinates.Z = 0;
-  region_start_coordinates.Subresource = 0;
-  D3D12_TILE_REGION_SIZE region_size;
-  region_size.NumTiles = length_bytes / D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES;
-  region_size.UseBox = FALSE;
-  D3D12_TILE_RANGE_FLAGS range_flags = D3D12_TILE_RANGE_FLAG_NONE;
-  UINT heap_range_start_offset = 0;
-  direct_queue->UpdateTileMappings(buffer_, 1, &region_start_coordinates, &region_size, heap, 1,
-                                   &range_flags, &heap_range_start_offset, &region_size.NumTiles,
-                                   D3D12_TILE_MAPPING_FLAG_NONE);
-  command_processor_.NotifyQueueOperationsDoneDirectly();
+  PendingTileMapping& pending_mapping = buffer_pending_tile_mappings_.emplace_back();
+  pending_mapping.offset_bytes = offset_bytes;
+  pending_mapping.length_bytes = length_bytes;
+  pending_mapping.heap = heap;
   return true;
 }
 
+void D3D12SharedMemory::FlushPendingTileMappings() {
+  if (buffer_pending_tile_mappings_.empty()) {
+    return;
+  }
+  const ui::d3d12::D3D12Provider& provider = command_processor_.GetD3D12Provider();
+  ID3D12CommandQueue* direct_queue = provider.GetDirectQueue();
+  // UpdateTileMappings can only reference a single heap, so one call per
+  // allocated range - but issued in one burst at submission end rather than
+  // scattered through command recording.
+  for (const PendingTileMapping& pending_mapping : buffer_pending_tile_mappings_) {
+    D3D12_TILED_RESOURCE_COORDINATE region_start_coordinates;
+    region_start_coordinates.X =
+        pending_mapping.offset_bytes / D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES;
+    region_start_coordinates.Y = 0;
+    region_start_coordinates.Z = 0;
+    region_start_coordinates.Subresource = 0;
+    D3D12_TILE_REGION_SIZE region_size;
+    region_size.NumTiles = pending_mapping.length_bytes / D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES;
+    region_size.UseBox = FALSE;
+    D3D12_TILE_RANGE_FLAGS range_flags = D3D12_TILE_RANGE_FLAG_NONE;
+    UINT heap_range_start_offset = 0;
+    direct_queue->UpdateTileMappings(buffer_, 1, &region_start_coordinates, &region_size,
+                                     pending_mapping.heap, 1, &range_flags,
+                                     &heap_range_start_offset, &region_size.NumTiles,
+                                     D3D12_TILE_MAPPING_FLAG_NONE);
+  }
+  buffer_pending_tile_mappings_.clear();
+  command_processor_.NotifyQueueOperationsDoneDirectly();
+}
+
 bool D3D12SharedMemory::UploadRanges(
     const std::vector<std::pair<uint32_t, uint32_t>>& upload_page_ranges) {
   if (upload_page_ranges.empty()) {
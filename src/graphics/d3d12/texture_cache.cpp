@@ -779,61 +779,78 @@ void D3D12TextureCache::WriteActiveTextureSRVKeys(
   }
 }
 
-void D3D12TextureCache::WriteActiveTextureBindfulSRV(
-    const D3D12Shader::TextureBinding& host_shader_binding, D3D12_CPU_DESCRIPTOR_HANDLE handle) {
+void D3D12TextureCache::WriteActiveTextureBindfulSRVs(
+    const D3D12Shader::TextureBinding* host_shader_bindings, size_t host_shader_binding_count,
+    D3D12_CPU_DESCRIPTOR_HANDLE handle_start) {
   assert_false(bindless_resources_used_);
-  uint32_t descriptor_index = UINT32_MAX;
-  Texture* texture = nullptr;
-  uint32_t fetch_constant_index = host_shader_binding.fetch_constant;
-  const TextureBinding* binding = GetValidTextureBinding(fetch_constant_index);
-  if (binding && AreDimensionsCompatible(host_shader_binding.dimension, binding->key.dimension)) {
-    const D3D12TextureBinding& d3d12_binding = d3d12_texture_bindings_[fetch_constant_index];
-    if (host_shader_binding.is_signed) {
-      // Not supporting signed compressed textures - hopefully DXN and DXT5A are
-      // not used as signed.
-      if (texture_util::IsAnySignSigned(binding->swizzled_signs)) {
-        descriptor_index = d3d12_binding.descriptor_index_signed;
-        texture = IsSignedVersionSeparateForFormat(binding->key) ? binding->texture_signed
-                                                                 : binding->texture;
+  if (!host_shader_binding_count) {
+    return;
+  }
+  const ui::d3d12::D3D12Provider& provider = command_processor_.GetD3D12Provider();
+  bindful_srv_copy_source_handles_.clear();
+  bindful_srv_copy_source_handles_.reserve(host_shader_binding_count);
+  for (size_t i = 0; i < host_shader_binding_count; ++i) {
+    const D3D12Shader::TextureBinding& host_shader_binding = host_shader_bindings[i];
+    uint32_t descriptor_index = UINT32_MAX;
+    Texture* texture = nullptr;
+    uint32_t fetch_constant_index = host_shader_binding.fetch_constant;
+    const TextureBinding* binding = GetValidTextureBinding(fetch_constant_index);
+    if (binding && AreDimensionsCompatible(host_shader_binding.dimension, binding->key.dimension)) {
+      const D3D12TextureBinding& d3d12_binding = d3d12_texture_bindings_[fetch_constant_index];
+      if (host_shader_binding.is_signed) {
+        // Not supporting signed compressed textures - hopefully DXN and DXT5A
+        // are not used as signed.
+        if (texture_util::IsAnySignSigned(binding->swizzled_signs)) {
+          descriptor_index = d3d12_binding.descriptor_index_signed;
+          texture = IsSignedVersionSeparateForFormat(binding->key) ? binding->texture_signed
+                                                                   : binding->texture;
+        }
+      } else {
+        if (texture_util::IsAnySignNotSigned(binding->swizzled_signs)) {
+          descriptor_index = d3d12_binding.descriptor_index;
+          texture = binding->texture;
+        }
       }
+    }
+    D3D12_CPU_DESCRIPTOR_HANDLE source_handle;
+    if (descriptor_index != UINT32_MAX) {
+      assert_not_null(texture);
+      texture->MarkAsUsed();
+      source_handle = GetTextureDescriptorCPUHandle(descriptor_index);
     } else {
-      if (texture_util::IsAnySignNotSigned(binding->swizzled_signs)) {
-        descriptor_index = d3d12_binding.descriptor_index;
-        texture = binding->texture;
+      NullSRVDescriptorIndex null_descriptor_index;
+      switch (host_shader_binding.dimension) {
+        case xenos::FetchOpDimension::k3DOrStacked:
+          null_descriptor_index = NullSRVDescriptorIndex::k3D;
+          break;
+        case xenos::FetchOpDimension::kCube:
+          null_descriptor_index = NullSRVDescriptorIndex::kCube;
+          break;
+        default:
+          assert_true(host_shader_binding.dimension == xenos::FetchOpDimension::k1D ||
+                      host_shader_binding.dimension == xenos::FetchOpDimension::k2D);
+          null_descriptor_index = NullSRVDescriptorIndex::k2DArray;
       }
+      source_handle = provider.OffsetViewDescriptor(null_srv_descriptor_heap_start_,
+                                                    uint32_t(null_descriptor_index));
     }
-  }
-  const ui::d3d12::D3D12Provider& provider = command_processor_.GetD3D12Provider();
-  D3D12_CPU_DESCRIPTOR_HANDLE source_handle;
-  if (descriptor_index != UINT32_MAX) {
-    assert_not_null(texture);
-    texture->MarkAsUsed();
-    source_handle = GetTextureDescriptorCPUHandle(descriptor_index);
-  } else {
-    NullSRVDescriptorIndex null_descriptor_index;
-    switch (host_shader_binding.dimension) {
-      case xenos::FetchOpDimension::k3DOrStacked:
-        null_descriptor_index = NullSRVDescriptorIndex::k3D;
-        break;
-      case xenos::FetchOpDimension::kCube:
-        null_descriptor_index = NullSRVDescriptorIndex::kCube;
-        break;
-      default:
-        assert_true(host_shader_binding.dimension == xenos::FetchOpDimension::k1D ||
-                    host_shader_binding.dimension == xenos::FetchOpDimension::k2D);
-        null_descriptor_index = NullSRVDescriptorIndex::k2DArray;
-    }
-    source_handle = provider.OffsetViewDescriptor(null_srv_descriptor_heap_start_,
-                                                  uint32_t(null_descriptor_index));
+    bindful_srv_copy_source_handles_.push_back(source_handle);
   }
   auto device = provider.GetDevice();
   {
 #if XE_GPU_FINE_GRAINED_DRAW_SCOPES
     SCOPE_profile_cpu_i("gpu",
-                        "rex::graphics::d3d12::D3D12TextureCache::WriteActiveTextureBindfulSRV->"
-                        "CopyDescriptorsSimple");
+                        "rex::graphics::d3d12::D3D12TextureCache::WriteActiveTextureBindfulSRVs->"
+                        "CopyDescriptors");
 #endif  // XE_GPU_FINE_GRAINED_DRAW_SCOPES
-    device->CopyDescriptorsSimple(1, handle, source_handle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+    // One destination range covering all the slots of the table, and one
+    // single-descriptor source range per binding (null source range sizes mean
+    // 1 descriptor each).
+    UINT destination_range_size = UINT(host_shader_binding_count);
+    device->CopyDescriptors(1, &handle_start, &destination_range_size,
+                            UINT(host_shader_binding_count),
+                            bindful_srv_copy_source_handles_.data(), nullptr,
+                            D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
   }
 }
 
@@ -20,3 +20,8 @@ REXCVAR_DEFINE_BOOL(depth_float24_convert_in_pixel_shader, false, "GPU",
 REXCVAR_DEFINE_BOOL(depth_transfer_not_equal_test, false, "GPU",
                     "Use not-equal test for depth transfer");
 REXCVAR_DEFINE_STRING(dump_shaders, "", "GPU", "Path to dump shaders to");
+REXCVAR_DEFINE_INT32(gpu_max_queued_frames, 3, "GPU",
+                     "Maximum number of guest frames in flight on the host GPU before the "
+                     "command processor waits for frame completion - higher values improve "
+                     "CPU/GPU overlap, lower values reduce frame latency")
+    .range(1, 3);
@@ -199,7 +199,7 @@ uint32_t GraphicsSystem::ReadRegister(uint32_t addr) {
                   // maximum [width(0x0FFF), height(0x0FFF)]
       return 0x050002D0;
     default:
-      if (!register_file_.GetRegisterInfo(r)) {
+      if (!RegisterFile::IsValidRegister(r)) {
         REXGPU_ERROR("GPU: Read from unknown register ({:04X})", r);
       }
   }
@@ -218,7 +218,13 @@ void GraphicsSystem::WriteRegister(uint32_t addr, uint32_t value) {
     case 0x1844:  // AVIVO_D1GRPH_PRIMARY_SURFACE_ADDRESS
       break;
     default:
-      REXGPU_WARN("Unknown GPU register {:04X} write: {:08X}", r, value);
+      // Writes to known registers are plain state updates - only registers
+      // missing from register_table.inc are worth a warning, and formatting
+      // one per write would dominate the cost of the hot registers (coherency,
+      // interrupt acknowledgement) that land here.
+      if (!RegisterFile::IsValidRegister(r)) {
+        REXGPU_WARN("Unknown GPU register {:04X} write: {:08X}", r, value);
+      }
       break;
   }
 
@@ -262,6 +268,27 @@ void GraphicsSystem::DispatchInterruptCallback(uint32_t source, uint32_t cpu) {
                                rex::countof(args));
 }
 
+void GraphicsSystem::DispatchInterruptCallbackBatch(uint32_t source, uint32_t cpu_mask) {
+  if (!interrupt_callback_ || !cpu_mask) {
+    return;
+  }
+
+  auto thread = system::XThread::GetCurrentThread();
+  assert_not_null(thread);
+
+  // One global-lock acquisition, IRQL raise and TLS transition covers every
+  // CPU targeted by this event - CP interrupts commonly fan out to several
+  // CPUs at once and arrive at kHz rates.
+  runtime::Processor::InterruptBatch batch(processor_, thread->thread_state());
+  uint64_t args[] = {source, interrupt_callback_data_};
+  for (uint32_t cpu = 0; cpu < 6; ++cpu) {
+    if (cpu_mask & (1u << cpu)) {
+      thread->SetActiveCpu(cpu);
+      batch.Execute(interrupt_callback_, args, rex::countof(args));
+    }
+  }
+}
+
 void GraphicsSystem::MarkVblank() {
   // TODO: Enable profiling once ported
   // SCOPE_profile_cpu_f("gpu");
@@ -366,7 +366,14 @@ bool MetalCommandProcessor::TranslateShaderToMetal(MetalShader* shader) {
 
 bool MetalCommandProcessor::IssueDraw(xenos::PrimitiveType, uint32_t,
                                        IndexBufferInfo*, bool) {
-  // TODO: full draw implementation (pipeline state, vertex/index binding)
+  // TODO: full draw implementation (pipeline state, vertex/index binding).
+  // When resource binding is implemented, don't bind per draw with
+  // setVertexTexture:/setFragmentTexture: - encode the texture/sampler tables
+  // into Metal argument buffers and allocate the backing resources from a
+  // persistent MTLHeap made resident once per encoder with useHeap:, the same
+  // way the D3D12 texture cache keeps one shader-visible descriptor heap
+  // instead of rebinding descriptors per draw. MetalShaderConverter already
+  // emits IR expecting the D3D12-style top-level argument buffer layout.
   return true;
 }
 
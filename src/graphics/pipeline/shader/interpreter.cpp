@@ -9,6 +9,7 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstring>
@@ -27,6 +28,14 @@ void ShaderInterpreter::Execute() {
   // For more consistency between invocations in case of a malformed shader.
   state_.Reset();
 
+  // The register file can't change while a shader invocation is being
+  // interpreted - decode the float constant window once instead of for every
+  // operand read.
+  auto float_constant_base_and_size = register_file_.Get<reg::SQ_VS_CONST>(
+      shader_type_ == xenos::ShaderType::kVertex ? XE_GPU_REG_SQ_VS_CONST : XE_GPU_REG_SQ_PS_CONST);
+  float_constant_base_ = float_constant_base_and_size.base;
+  float_constant_size_minus_1_ = float_constant_base_and_size.size;
+
   const uint32_t* bool_constants = &register_file_[XE_GPU_REG_SHADER_CONSTANT_BOOL_000_031];
 
   bool exec_ended = false;
@@ -243,12 +252,10 @@ const std::array<float, 4> ShaderInterpreter::GetFloatConstant(uint32_t address,
   if (index < 0) {
     return std::array<float, 4>();
   }
-  auto base_and_size_minus_1 = register_file_.Get<reg::SQ_VS_CONST>(
-      shader_type_ == xenos::ShaderType::kVertex ? XE_GPU_REG_SQ_VS_CONST : XE_GPU_REG_SQ_PS_CONST);
-  if (uint32_t(index) > base_and_size_minus_1.size) {
+  if (uint32_t(index) > float_constant_size_minus_1_) {
     return std::array<float, 4>();
   }
-  index += base_and_size_minus_1.base;
+  index += float_constant_base_;
   if (index >= 512) {
     return std::array<float, 4>();
   }
@@ -954,6 +961,8 @@ void ShaderInterpreter::ExecuteVertexFetchInstruction(ucode::VertexFetchInstruct
     uint32_t buffer_end_dwords = fetch_constant.address + fetch_constant.size;
     uint32_t dword_0_address_dwords =
         uint32_t(int32_t(state_.vfetch_address_dwords) + instr.offset());
+    uint32_t traced_range_start_dwords = UINT32_MAX;
+    uint32_t traced_range_end_dwords = 0;
     for (uint32_t i = 0; i < 4; ++i) {
       if (!(needed_dwords & (UINT32_C(1) << i))) {
         continue;
@@ -962,13 +971,20 @@ void ShaderInterpreter::ExecuteVertexFetchInstruction(ucode::VertexFetchInstruct
       uint32_t dword_address_dwords = dword_0_address_dwords + i;
       if (dword_address_dwords >= fetch_constant.address &&
           dword_address_dwords < buffer_end_dwords) {
-        if (trace_writer_) {
-          trace_writer_->WriteMemoryRead(sizeof(uint32_t) * dword_address_dwords, sizeof(uint32_t));
-        }
+        traced_range_start_dwords = std::min(traced_range_start_dwords, dword_address_dwords);
+        traced_range_end_dwords = std::max(traced_range_end_dwords, dword_address_dwords + 1);
         dword_value = xenos::GpuSwap(memory_dwords[dword_address_dwords], fetch_constant.endian);
       }
       data[i] = dword_value;
     }
+    // One trace record covering the whole fetch rather than one per dword -
+    // vertex fetches are executed for every vertex of a draw, and per-dword
+    // records dominated both the interpretation time and the trace size.
+    if (trace_writer_ && traced_range_start_dwords < traced_range_end_dwords) {
+      trace_writer_->WriteMemoryRead(
+          sizeof(uint32_t) * traced_range_start_dwords,
+          sizeof(uint32_t) * (traced_range_end_dwords - traced_range_start_dwords));
+    }
 
     uint32_t packed_components = 0b0000;
     uint32_t packed_widths[4], packed_offsets[4];
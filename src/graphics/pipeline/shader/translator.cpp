@@ -105,45 +105,71 @@ void Shader::AnalyzeUcode(string::StringBuffer& ucode_disasm_buffer) {
 
       const ControlFlowInstruction& cf = cf_ab[j];
       uint32_t bool_constant_index = UINT32_MAX;
+      // Parsed instructions are stored for replaying by the translator, so
+      // translations (potentially multiple per shader, by multiple backends)
+      // don't need to decode the microcode again.
+      ParsedControlFlowRef cf_ref;
       switch (cf.opcode()) {
         case ControlFlowOpcode::kNop:
           ucode_disasm_buffer.Append("      cnop\n");
+          cf_ref.kind = ParsedControlFlowRef::Kind::kNop;
           break;
         case ControlFlowOpcode::kExec:
         case ControlFlowOpcode::kExecEnd: {
-          ParsedExecInstruction instr;
-          ParseControlFlowExec(cf.exec, cf_index, instr);
-          GatherExecInformation(instr, previous_vfetch_full, unique_texture_bindings,
+          ParsedExecBlock block;
+          ParseControlFlowExec(cf.exec, cf_index, block.instr);
+          block.body_first = uint32_t(parsed_exec_body_.size());
+          GatherExecInformation(block.instr, previous_vfetch_full, unique_texture_bindings,
                                 ucode_disasm_buffer);
+          block.body_count = uint32_t(parsed_exec_body_.size()) - block.body_first;
+          cf_ref.kind = ParsedControlFlowRef::Kind::kExec;
+          cf_ref.index = uint32_t(parsed_execs_.size());
+          parsed_execs_.push_back(block);
         } break;
         case ControlFlowOpcode::kCondExec:
         case ControlFlowOpcode::kCondExecEnd:
         case ControlFlowOpcode::kCondExecPredClean:
         case ControlFlowOpcode::kCondExecPredCleanEnd: {
           bool_constant_index = cf.cond_exec.bool_address();
-          ParsedExecInstruction instr;
-          ParseControlFlowCondExec(cf.cond_exec, cf_index, instr);
-          GatherExecInformation(instr, previous_vfetch_full, unique_texture_bindings,
+          ParsedExecBlock block;
+          ParseControlFlowCondExec(cf.cond_exec, cf_index, block.instr);
+          block.body_first = uint32_t(parsed_exec_body_.size());
+          GatherExecInformation(block.instr, previous_vfetch_full, unique_texture_bindings,
                                 ucode_disasm_buffer);
+          block.body_count = uint32_t(parsed_exec_body_.size()) - block.body_first;
+          cf_ref.kind = ParsedControlFlowRef::Kind::kExec;
+          cf_ref.index = uint32_t(parsed_execs_.size());
+          parsed_execs_.push_back(block);
         } break;
         case ControlFlowOpcode::kCondExecPred:
         case ControlFlowOpcode::kCondExecPredEnd: {
-          ParsedExecInstruction instr;
-          ParseControlFlowCondExecPred(cf.cond_exec_pred, cf_index, instr);
-          GatherExecInformation(instr, previous_vfetch_full, unique_texture_bindings,
+          ParsedExecBlock block;
+          ParseControlFlowCondExecPred(cf.cond_exec_pred, cf_index, block.instr);
+          block.body_first = uint32_t(parsed_exec_body_.size());
+          GatherExecInformation(block.instr, previous_vfetch_full, unique_texture_bindings,
                                 ucode_disasm_buffer);
+          block.body_count = uint32_t(parsed_exec_body_.size()) - block.body_first;
+          cf_ref.kind = ParsedControlFlowRef::Kind::kExec;
+          cf_ref.index = uint32_t(parsed_execs_.size());
+          parsed_execs_.push_back(block);
         } break;
         case ControlFlowOpcode::kLoopStart: {
           ParsedLoopStartInstruction instr;
           ParseControlFlowLoopStart(cf.loop_start, cf_index, instr);
           instr.Disassemble(&ucode_disasm_buffer);
           constant_register_map_.loop_bitmap |= uint32_t(1) << instr.loop_constant_index;
+          cf_ref.kind = ParsedControlFlowRef::Kind::kLoopStart;
+          cf_ref.index = uint32_t(parsed_loop_starts_.size());
+          parsed_loop_starts_.push_back(instr);
         } break;
         case ControlFlowOpcode::kLoopEnd: {
           ParsedLoopEndInstruction instr;
           ParseControlFlowLoopEnd(cf.loop_end, cf_index, instr);
           instr.Disassemble(&ucode_disasm_buffer);
           constant_register_map_.loop_bitmap |= uint32_t(1) << instr.loop_constant_index;
+          cf_ref.kind = ParsedControlFlowRef::Kind::kLoopEnd;
+          cf_ref.index = uint32_t(parsed_loop_ends_.size());
+          parsed_loop_ends_.push_back(instr);
         } break;
         case ControlFlowOpcode::kCondCall: {
           ParsedCallInstruction instr;
@@ -152,11 +178,17 @@ void Shader::AnalyzeUcode(string::StringBuffer& ucode_disasm_buffer) {
           if (instr.type == ParsedCallInstruction::Type::kConditional) {
             bool_constant_index = instr.bool_constant_index;
           }
+          cf_ref.kind = ParsedControlFlowRef::Kind::kCall;
+          cf_ref.index = uint32_t(parsed_calls_.size());
+          parsed_calls_.push_back(instr);
         } break;
         case ControlFlowOpcode::kReturn: {
           ParsedReturnInstruction instr;
           ParseControlFlowReturn(cf.ret, cf_index, instr);
           instr.Disassemble(&ucode_disasm_buffer);
+          cf_ref.kind = ParsedControlFlowRef::Kind::kReturn;
+          cf_ref.index = uint32_t(parsed_returns_.size());
+          parsed_returns_.push_back(instr);
         } break;
         case ControlFlowOpcode::kCondJmp: {
           ParsedJumpInstruction instr;
@@ -165,11 +197,17 @@ void Shader::AnalyzeUcode(string::StringBuffer& ucode_disasm_buffer) {
           if (instr.type == ParsedJumpInstruction::Type::kConditional) {
             bool_constant_index = instr.bool_constant_index;
           }
+          cf_ref.kind = ParsedControlFlowRef::Kind::kJump;
+          cf_ref.index = uint32_t(parsed_jumps_.size());
+          parsed_jumps_.push_back(instr);
         } break;
         case ControlFlowOpcode::kAlloc: {
           ParsedAllocInstruction instr;
           ParseControlFlowAlloc(cf.alloc, cf_index, type() == xenos::ShaderType::kVertex, instr);
           instr.Disassemble(&ucode_disasm_buffer);
+          cf_ref.kind = ParsedControlFlowRef::Kind::kAlloc;
+          cf_ref.index = uint32_t(parsed_allocs_.size());
+          parsed_allocs_.push_back(instr);
         } break;
         case ControlFlowOpcode::kMarkVsFetchDone:
           break;
@@ -177,6 +215,7 @@ void Shader::AnalyzeUcode(string::StringBuffer& ucode_disasm_buffer) {
           assert_unhandled_case(cf.opcode);
           break;
       }
+      parsed_cf_instructions_.push_back(cf_ref);
       if (bool_constant_index != UINT32_MAX) {
         constant_register_map_.bool_bitmap[bool_constant_index / 32] |=
             uint32_t(1) << (bool_constant_index % 32);
@@ -352,18 +391,28 @@ void Shader::GatherExecInformation(const ParsedExecInstruction& instr,
       ucode_disasm_buffer.Append("         serialize\n             ");
     }
     const uint32_t* op_ptr = ucode_data_.data() + instr_offset * 3;
+    // Each Gather* helper appends exactly one instruction to the vector the
+    // reference points into.
+    ParsedExecBodyRef body_ref;
     if (sequence & 0b01) {
       auto& op = *reinterpret_cast<const FetchInstruction*>(op_ptr);
       if (op.opcode() == FetchOpcode::kVertexFetch) {
+        body_ref.kind = ParsedExecBodyRef::Kind::kVertexFetch;
+        body_ref.index = uint32_t(parsed_vertex_fetch_instructions_.size());
         GatherVertexFetchInformation(op.vertex_fetch(), previous_vfetch_full, ucode_disasm_buffer);
       } else {
+        body_ref.kind = ParsedExecBodyRef::Kind::kTextureFetch;
+        body_ref.index = uint32_t(parsed_texture_fetch_instructions_.size());
         GatherTextureFetchInformation(op.texture_fetch(), unique_texture_bindings,
                                       ucode_disasm_buffer);
       }
     } else {
       auto& op = *reinterpret_cast<const AluInstruction*>(op_ptr);
+      body_ref.kind = ParsedExecBodyRef::Kind::kAlu;
+      body_ref.index = uint32_t(parsed_alu_instructions_.size());
       GatherAluInstructionInformation(op, instr.dword_index, ucode_disasm_buffer);
     }
+    parsed_exec_body_.push_back(body_ref);
   }
 }
 
@@ -375,6 +424,9 @@ void Shader::GatherVertexFetchInformation(const VertexFetchInstruction& op,
     previous_vfetch_full = op;
   }
   fetch_instr.Disassemble(&ucode_disasm_buffer);
+  // Mini-fetch inheritance is resolved here, so the translator replaying the
+  // parsed stream doesn't need to track the previous full fetch.
+  parsed_vertex_fetch_instructions_.push_back(fetch_instr);
 
   GatherFetchResultInformation(fetch_instr.result);
 
@@ -428,6 +480,7 @@ void Shader::GatherTextureFetchInformation(const TextureFetchInstruction& op,
   TextureBinding binding;
   ParseTextureFetchInstruction(op, binding.fetch_instr);
   binding.fetch_instr.Disassemble(&ucode_disasm_buffer);
+  parsed_texture_fetch_instructions_.push_back(binding.fetch_instr);
 
   GatherFetchResultInformation(binding.fetch_instr.result);
   for (size_t i = 0; i < binding.fetch_instr.operand_count; ++i) {
@@ -472,6 +525,7 @@ void Shader::GatherAluInstructionInformation(const AluInstruction& op, uint32_t
   ParsedAluInstruction instr;
   ParseAluInstruction(op, type(), instr);
   instr.Disassemble(&ucode_disasm_buffer);
+  parsed_alu_instructions_.push_back(instr);
 
   kills_pixels_ = kills_pixels_ ||
                   (ucode::GetAluVectorOpcodeInfo(op.vector_opcode()).changed_state &
@@ -596,10 +650,7 @@ ShaderTranslator::ShaderTranslator() = default;
 
 ShaderTranslator::~ShaderTranslator() = default;
 
-void ShaderTranslator::Reset() {
-  errors_.clear();
-  std::memset(&previous_vfetch_full_, 0, sizeof(previous_vfetch_full_));
-}
+void ShaderTranslator::Reset() { errors_.clear(); }
 
 bool ShaderTranslator::TranslateAnalyzedShader(Shader::Translation& translation) {
   const Shader& shader = translation.shader();
@@ -622,34 +673,19 @@ bool ShaderTranslator::TranslateAnalyzedShader(Shader::Translation& translation)
 
   StartTranslation();
 
-  const uint32_t* ucode_dwords = shader.ucode_data().data();
-
-  // TODO(Triang3l): Remove when the old SPIR-V shader translator is deleted.
-  uint32_t cf_pair_index_bound = shader.cf_pair_index_bound();
-  std::vector<ControlFlowInstruction> cf_instructions;
-  for (uint32_t i = 0; i < cf_pair_index_bound; ++i) {
-    ControlFlowInstruction cf_ab[2];
-    UnpackControlFlowInstructions(ucode_dwords + i * 3, cf_ab);
-    cf_instructions.push_back(cf_ab[0]);
-    cf_instructions.push_back(cf_ab[1]);
-  }
-  PreProcessControlFlowInstructions(cf_instructions);
-
-  // Translate all instructions.
+  // Translate all instructions by replaying the stream parsed during the ucode
+  // analysis - the microcode itself doesn't need to be decoded again.
   const std::set<uint32_t>& label_addresses = shader.label_addresses();
-  for (uint32_t i = 0; i < cf_pair_index_bound; ++i) {
-    ControlFlowInstruction cf_ab[2];
-    UnpackControlFlowInstructions(ucode_dwords + i * 3, cf_ab);
-    for (uint32_t j = 0; j < 2; ++j) {
-      uint32_t cf_index = i * 2 + j;
-      cf_index_ = cf_index;
-      if (label_addresses.find(cf_index) != label_addresses.end()) {
-        ProcessLabel(cf_index);
-      }
-      ProcessControlFlowInstructionBegin(cf_index);
-      TranslateControlFlowInstruction(cf_ab[j]);
-      ProcessControlFlowInstructionEnd(cf_index);
+  const std::vector<Shader::ParsedControlFlowRef>& cf_instructions =
+      shader.parsed_cf_instructions();
+  for (uint32_t cf_index = 0; cf_index < uint32_t(cf_instructions.size()); ++cf_index) {
+    cf_index_ = cf_index;
+    if (label_addresses.find(cf_index) != label_addresses.end()) {
+      ProcessLabel(cf_index);
     }
+    ProcessControlFlowInstructionBegin(cf_index);
+    TranslateControlFlowInstruction(cf_instructions[cf_index]);
+    ProcessControlFlowInstructionEnd(cf_index);
   }
 
   translation.errors_ = std::move(errors_);
@@ -680,73 +716,46 @@ void ShaderTranslator::EmitTranslationError(const char* message, bool is_fatal)
   REXGPU_ERROR("Shader translation {}error: {}", is_fatal ? "fatal " : "", message);
 }
 
-void ShaderTranslator::TranslateControlFlowInstruction(const ControlFlowInstruction& cf) {
-  switch (cf.opcode()) {
-    case ControlFlowOpcode::kNop:
+void ShaderTranslator::TranslateControlFlowInstruction(const Shader::ParsedControlFlowRef& cf) {
+  const Shader& shader = current_shader();
+  switch (cf.kind) {
+    case Shader::ParsedControlFlowRef::Kind::kNop:
       ProcessControlFlowNopInstruction(cf_index_);
       break;
-    case ControlFlowOpcode::kExec:
-    case ControlFlowOpcode::kExecEnd: {
-      ParsedExecInstruction instr;
-      ParseControlFlowExec(cf.exec, cf_index_, instr);
-      TranslateExecInstructions(instr);
-    } break;
-    case ControlFlowOpcode::kCondExec:
-    case ControlFlowOpcode::kCondExecEnd:
-    case ControlFlowOpcode::kCondExecPredClean:
-    case ControlFlowOpcode::kCondExecPredCleanEnd: {
-      ParsedExecInstruction instr;
-      ParseControlFlowCondExec(cf.cond_exec, cf_index_, instr);
-      TranslateExecInstructions(instr);
-    } break;
-    case ControlFlowOpcode::kCondExecPred:
-    case ControlFlowOpcode::kCondExecPredEnd: {
-      ParsedExecInstruction instr;
-      ParseControlFlowCondExecPred(cf.cond_exec_pred, cf_index_, instr);
-      TranslateExecInstructions(instr);
-    } break;
-    case ControlFlowOpcode::kLoopStart: {
-      ParsedLoopStartInstruction instr;
-      ParseControlFlowLoopStart(cf.loop_start, cf_index_, instr);
-      ProcessLoopStartInstruction(instr);
-    } break;
-    case ControlFlowOpcode::kLoopEnd: {
-      ParsedLoopEndInstruction instr;
-      ParseControlFlowLoopEnd(cf.loop_end, cf_index_, instr);
-      ProcessLoopEndInstruction(instr);
-    } break;
-    case ControlFlowOpcode::kCondCall: {
-      ParsedCallInstruction instr;
-      ParseControlFlowCondCall(cf.cond_call, cf_index_, instr);
-      ProcessCallInstruction(instr);
-    } break;
-    case ControlFlowOpcode::kReturn: {
-      ParsedReturnInstruction instr;
-      ParseControlFlowReturn(cf.ret, cf_index_, instr);
-      ProcessReturnInstruction(instr);
-    } break;
-    case ControlFlowOpcode::kCondJmp: {
-      ParsedJumpInstruction instr;
-      ParseControlFlowCondJmp(cf.cond_jmp, cf_index_, instr);
-      ProcessJumpInstruction(instr);
-    } break;
-    case ControlFlowOpcode::kAlloc: {
-      ParsedAllocInstruction instr;
-      ParseControlFlowAlloc(cf.alloc, cf_index_, is_vertex_shader(), instr);
+    case Shader::ParsedControlFlowRef::Kind::kExec:
+      TranslateExecInstructions(shader.parsed_execs()[cf.index]);
+      break;
+    case Shader::ParsedControlFlowRef::Kind::kLoopStart:
+      ProcessLoopStartInstruction(shader.parsed_loop_starts()[cf.index]);
+      break;
+    case Shader::ParsedControlFlowRef::Kind::kLoopEnd:
+      ProcessLoopEndInstruction(shader.parsed_loop_ends()[cf.index]);
+      break;
+    case Shader::ParsedControlFlowRef::Kind::kCall:
+      ProcessCallInstruction(shader.parsed_calls()[cf.index]);
+      break;
+    case Shader::ParsedControlFlowRef::Kind::kReturn:
+      ProcessReturnInstruction(shader.parsed_returns()[cf.index]);
+      break;
+    case Shader::ParsedControlFlowRef::Kind::kJump:
+      ProcessJumpInstruction(shader.parsed_jumps()[cf.index]);
+      break;
+    case Shader::ParsedControlFlowRef::Kind::kAlloc: {
+      const ParsedAllocInstruction& instr = shader.parsed_allocs()[cf.index];
       const std::vector<Shader::ControlFlowMemExportInfo>& cf_memexport_info =
-          current_shader().cf_memexport_info();
+          shader.cf_memexport_info();
       ProcessAllocInstruction(
           instr, instr.dword_index < cf_memexport_info.size()
                      ? cf_memexport_info[instr.dword_index].eM_potentially_written_before
                      : 0);
     } break;
-    case ControlFlowOpcode::kMarkVsFetchDone:
+    case Shader::ParsedControlFlowRef::Kind::kNone:
       break;
     default:
-      assert_unhandled_case(cf.opcode);
+      assert_unhandled_case(cf.kind);
       break;
   }
-  // TODO(benvanik): return if (DoesControlFlowOpcodeEndShader(cf.opcode()))?
+  // TODO(benvanik): return if the control flow instruction ends the shader?
 }
 
 void ParseControlFlowExec(const ControlFlowExecInstruction& cf, uint32_t cf_index,
@@ -871,51 +880,44 @@ void ParseControlFlowAlloc(const ControlFlowAllocInstruction& cf, uint32_t cf_in
   instr.is_vertex_shader = is_vertex_shader;
 }
 
-void ShaderTranslator::TranslateExecInstructions(const ParsedExecInstruction& instr) {
+void ShaderTranslator::TranslateExecInstructions(const Shader::ParsedExecBlock& block) {
+  const Shader& shader = current_shader();
+  const ParsedExecInstruction& instr = block.instr;
   ProcessExecInstructionBegin(instr);
 
   const std::vector<Shader::ControlFlowMemExportInfo>& cf_memexport_info =
-      current_shader().cf_memexport_info();
+      shader.cf_memexport_info();
   uint8_t eM_potentially_written_before =
       instr.dword_index < cf_memexport_info.size()
           ? cf_memexport_info[instr.dword_index].eM_potentially_written_before
           : 0;
 
-  const uint32_t* ucode_dwords = current_shader().ucode_data().data();
-  uint32_t sequence = instr.sequence;
-  for (uint32_t instr_offset = instr.instruction_address;
-       instr_offset < instr.instruction_address + instr.instruction_count;
-       ++instr_offset, sequence >>= 2) {
-    const uint32_t* op_ptr = ucode_dwords + instr_offset * 3;
-    if (sequence & 0b01) {
-      auto& op = *reinterpret_cast<const FetchInstruction*>(op_ptr);
-      if (op.opcode() == FetchOpcode::kVertexFetch) {
-        const VertexFetchInstruction& vfetch_op = op.vertex_fetch();
-        ParsedVertexFetchInstruction vfetch_instr;
-        if (ParseVertexFetchInstruction(vfetch_op, previous_vfetch_full_, vfetch_instr)) {
-          previous_vfetch_full_ = vfetch_op;
+  const std::vector<Shader::ParsedExecBodyRef>& exec_body = shader.parsed_exec_body();
+  for (uint32_t i = 0; i < block.body_count; ++i) {
+    const Shader::ParsedExecBodyRef& body_ref = exec_body[block.body_first + i];
+    switch (body_ref.kind) {
+      case Shader::ParsedExecBodyRef::Kind::kVertexFetch:
+        // Mini-fetch inheritance has already been resolved during the ucode
+        // analysis, which walked the instructions in the same order.
+        ProcessVertexFetchInstruction(shader.parsed_vertex_fetch_instructions()[body_ref.index]);
+        break;
+      case Shader::ParsedExecBodyRef::Kind::kTextureFetch:
+        ProcessTextureFetchInstruction(shader.parsed_texture_fetch_instructions()[body_ref.index]);
+        break;
+      default: {
+        const ParsedAluInstruction& alu_instr = shader.parsed_alu_instructions()[body_ref.index];
+        ProcessAluInstruction(alu_instr, eM_potentially_written_before);
+        if (alu_instr.vector_and_constant_result.storage_target ==
+                InstructionStorageTarget::kExportData &&
+            alu_instr.vector_and_constant_result.GetUsedWriteMask()) {
+          eM_potentially_written_before |= uint8_t(1)
+                                           << alu_instr.vector_and_constant_result.storage_index;
         }
-        ProcessVertexFetchInstruction(vfetch_instr);
-      } else {
-        ParsedTextureFetchInstruction tfetch_instr;
-        ParseTextureFetchInstruction(op.texture_fetch(), tfetch_instr);
-        ProcessTextureFetchInstruction(tfetch_instr);
-      }
-    } else {
-      auto& op = *reinterpret_cast<const AluInstruction*>(op_ptr);
-      ParsedAluInstruction alu_instr;
-      ParseAluInstruction(op, current_shader().type(), alu_instr);
-      ProcessAluInstruction(alu_instr, eM_potentially_written_before);
-      if (alu_instr.vector_and_constant_result.storage_target ==
-              InstructionStorageTarget::kExportData &&
-          alu_instr.vector_and_constant_result.GetUsedWriteMask()) {
-        eM_potentially_written_before |= uint8_t(1)
-                                         << alu_instr.vector_and_constant_result.storage_index;
-      }
-      if (alu_instr.scalar_result.storage_target == InstructionStorageTarget::kExportData &&
-          alu_instr.scalar_result.GetUsedWriteMask()) {
-        eM_potentially_written_before |= uint8_t(1) << alu_instr.scalar_result.storage_index;
-      }
+        if (alu_instr.scalar_result.storage_target == InstructionStorageTarget::kExportData &&
+            alu_instr.scalar_result.GetUsedWriteMask()) {
+          eM_potentially_written_before |= uint8_t(1) << alu_instr.scalar_result.storage_index;
+        }
+      } break;
     }
   }
 
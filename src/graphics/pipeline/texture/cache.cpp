@@ -630,6 +630,17 @@ TextureCache::Texture* TextureCache::FindOrCreateTexture(TextureKey key) {
   return texture;
 }
 
+// Loading is synchronous with the draw by design, not as a shortcut. The
+// guest samples whatever is in its memory at this draw, so presenting an
+// older or lower mip instead would diverge from Direct3D 9 behavior that
+// games depend on (render-to-texture, CPU-generated textures updated between
+// draws). Conversion also happens in compute shaders on the host GPU reading
+// straight from the shared memory buffer - there is no CPU-side mip decode
+// that could be moved to worker threads, and partial per-mip residency would
+// invalidate the one-texture-one-resource invalidation model built on the
+// shared memory watches. Memory pressure is instead handled by the LRU
+// eviction in CompletedSubmissionUpdated driven by the
+// texture_cache_memory_limit_* cvars.
 bool TextureCache::LoadTextureData(Texture& texture) {
   // Check what needs to be uploaded.
   bool base_outdated, mips_outdated;
@@ -12,7 +12,6 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
-#include <functional>
 
 #include <rex/dbg.h>
 #include <rex/graphics/pipeline/texture/conversion.h>
@@ -25,26 +24,27 @@ namespace rex::graphics::texture_conversion {
 
 using namespace rex::graphics::xenos;
 
-void CopySwapBlock(xenos::Endian endian, void* output, const void* input, size_t length) {
-  switch (endian) {
-    case xenos::Endian::k8in16:
-      memory::copy_and_swap_16_unaligned(output, input, length / 2);
-      break;
-    case xenos::Endian::k8in32:
-      memory::copy_and_swap_32_unaligned(output, input, length / 4);
-      break;
-    case xenos::Endian::k16in32:  // Swap high and low 16 bits within a 32 bit
-                                  // word
-      memory::copy_and_swap_16_in_32_unaligned(output, input, length);
-      break;
-    default:
-    case xenos::Endian::kNone:
-      std::memcpy(output, input, length);
-      break;
+namespace {
+
+// The endianness is a template parameter so that every instantiation compiles
+// down to a direct call to the matching swap kernel with no per-block branch -
+// the dispatch tables below are indexed by xenos::Endian once per texture.
+template <xenos::Endian endian>
+void CopySwapBlockTyped(void* output, const void* input, size_t length) {
+  if constexpr (endian == xenos::Endian::k8in16) {
+    memory::copy_and_swap_16_unaligned(output, input, length / 2);
+  } else if constexpr (endian == xenos::Endian::k8in32) {
+    memory::copy_and_swap_32_unaligned(output, input, length / 4);
+  } else if constexpr (endian == xenos::Endian::k16in32) {
+    // Swap high and low 16 bits within a 32 bit word.
+    memory::copy_and_swap_16_in_32_unaligned(output, input, length);
+  } else {
+    std::memcpy(output, input, length);
   }
 }
 
-void ConvertTexelCTX1ToR8G8(xenos::Endian endian, void* output, const void* input, size_t length) {
+template <xenos::Endian endian>
+void ConvertTexelCTX1ToR8G8Typed(void* output, const void* input, size_t length) {
   // https://fileadmin.cs.lth.se/cs/Personal/Michael_Doggett/talks/unc-xenos-doggett.pdf
   // (R is in the higher bits, according to how this format is used in
   //  4D5307E6).
@@ -58,7 +58,7 @@ void ConvertTexelCTX1ToR8G8(xenos::Endian endian, void* output, const void* inpu
   static_assert(sizeof(block) == 8, "CTX1 block mismatch");
 
   const uint32_t bytes_per_block = 8;
-  CopySwapBlock(endian, block.data, input, bytes_per_block);
+  CopySwapBlockTyped<endian>(block.data, input, bytes_per_block);
 
   uint8_t cr[4] = {block.r0, block.r1,
                    static_cast<uint8_t>(2.f / 3.f * block.r0 + 1.f / 3.f * block.r1),
@@ -77,13 +77,53 @@ void ConvertTexelCTX1ToR8G8(xenos::Endian endian, void* output, const void* inpu
   }
 }
 
-void ConvertTexelDXT3AToDXT3(xenos::Endian endian, void* output, const void* input, size_t length) {
-  const uint32_t bytes_per_block = 16;
+template <xenos::Endian endian>
+void ConvertTexelDXT3AToDXT3Typed(void* output, const void* input, size_t length) {
   auto output_bytes = static_cast<uint8_t*>(output);
-  CopySwapBlock(endian, &output_bytes[0], input, 8);
+  CopySwapBlockTyped<endian>(&output_bytes[0], input, 8);
   std::memset(&output_bytes[8], 0, 8);
 }
 
+// Flat tables over the instantiations above, in xenos::Endian value order.
+#define UNTILE_CALLBACK_TABLE(function)                                                  \
+  {                                                                                      \
+    function<xenos::Endian::kNone>, function<xenos::Endian::k8in16>,                     \
+        function<xenos::Endian::k8in32>, function<xenos::Endian::k16in32>,               \
+  }
+constexpr UntileCopyBlockCallback kCopySwapBlockCallbacks[4] =
+    UNTILE_CALLBACK_TABLE(CopySwapBlockTyped);
+constexpr UntileCopyBlockCallback kConvertTexelCTX1ToR8G8Callbacks[4] =
+    UNTILE_CALLBACK_TABLE(ConvertTexelCTX1ToR8G8Typed);
+constexpr UntileCopyBlockCallback kConvertTexelDXT3AToDXT3Callbacks[4] =
+    UNTILE_CALLBACK_TABLE(ConvertTexelDXT3AToDXT3Typed);
+#undef UNTILE_CALLBACK_TABLE
+
+}  // namespace
+
+UntileCopyBlockCallback GetCopySwapBlockCallback(xenos::Endian endian) {
+  return kCopySwapBlockCallbacks[uint32_t(endian) & 3];
+}
+
+UntileCopyBlockCallback GetConvertTexelCTX1ToR8G8Callback(xenos::Endian endian) {
+  return kConvertTexelCTX1ToR8G8Callbacks[uint32_t(endian) & 3];
+}
+
+UntileCopyBlockCallback GetConvertTexelDXT3AToDXT3Callback(xenos::Endian endian) {
+  return kConvertTexelDXT3AToDXT3Callbacks[uint32_t(endian) & 3];
+}
+
+void CopySwapBlock(xenos::Endian endian, void* output, const void* input, size_t length) {
+  GetCopySwapBlockCallback(endian)(output, input, length);
+}
+
+void ConvertTexelCTX1ToR8G8(xenos::Endian endian, void* output, const void* input, size_t length) {
+  GetConvertTexelCTX1ToR8G8Callback(endian)(output, input, length);
+}
+
+void ConvertTexelDXT3AToDXT3(xenos::Endian endian, void* output, const void* input, size_t length) {
+  GetConvertTexelDXT3AToDXT3Callback(endian)(output, input, length);
+}
+
 // https://github.com/BinomialLLC/crunch/blob/ea9b8d8c00c8329791256adafa8cf11e4e7942a2/inc/crn_decomp.h#L4108
 static uint32_t TiledOffset2DRow(uint32_t y, uint32_t width, uint32_t log2_bpp) {
   uint32_t macro = ((y / 32) * (width / 32)) << (log2_bpp + 7);
@@ -115,20 +155,47 @@ void Untile(uint8_t* output_buffer, const uint8_t* input_buffer, const UntileInf
   auto log2_bpp =
       (input_bytes_per_block / 4) + ((input_bytes_per_block / 2) >> (input_bytes_per_block / 4));
 
+  // When the input and output blocks are the same size the callback is a plain
+  // (possibly swapping) copy, so horizontally contiguous blocks in the tiled
+  // layout can be handed to it as a single run - the vectorized kernels behind
+  // CopySwapBlock are far more effective on whole runs than on lone blocks,
+  // and the callback indirection happens once per run instead of once per
+  // block. Texel converters change the block size and interpret the length
+  // argument as a pitch, so they always get exactly one block per call.
+  bool coalesce_runs = input_bytes_per_block == output_bytes_per_block;
+
   // Offset to the current row, in bytes.
   uint32_t output_row_offset = 0;
   for (uint32_t y = 0; y < untile_info->height; y++) {
-    auto input_row_offset =
-        TiledOffset2DRow(untile_info->offset_y + y, untile_info->input_pitch, log2_bpp);
+    uint32_t tiled_y = untile_info->offset_y + y;
+    auto input_row_offset = TiledOffset2DRow(tiled_y, untile_info->input_pitch, log2_bpp);
 
     // Go block-by-block on this row.
     uint32_t output_offset = output_row_offset;
+    uint32_t run_first_offset = 0;
+    uint32_t run_blocks = 0;
 
     for (uint32_t x = 0; x < untile_info->width; x++) {
-      auto input_offset = TiledOffset2DColumn(untile_info->offset_x + x, untile_info->offset_y + y,
-                                              log2_bpp, input_row_offset);
+      auto input_offset =
+          TiledOffset2DColumn(untile_info->offset_x + x, tiled_y, log2_bpp, input_row_offset);
       input_offset >>= log2_bpp;
 
+      if (coalesce_runs) {
+        if (run_blocks && input_offset == run_first_offset + run_blocks) {
+          ++run_blocks;
+          continue;
+        }
+        if (run_blocks) {
+          untile_info->copy_callback(&output_buffer[output_offset],
+                                     &input_buffer[run_first_offset * input_bytes_per_block],
+                                     run_blocks * output_bytes_per_block);
+          output_offset += run_blocks * output_bytes_per_block;
+        }
+        run_first_offset = input_offset;
+        run_blocks = 1;
+        continue;
+      }
+
       untile_info->copy_callback(&output_buffer[output_offset],
                                  &input_buffer[input_offset * input_bytes_per_block],
                                  output_bytes_per_block);
@@ -136,6 +203,12 @@ void Untile(uint8_t* output_buffer, const uint8_t* input_buffer, const UntileInf
       output_offset += output_bytes_per_block;
     }
 
+    if (run_blocks) {
+      untile_info->copy_callback(&output_buffer[output_offset],
+                                 &input_buffer[run_first_offset * input_bytes_per_block],
+                                 run_blocks * output_bytes_per_block);
+    }
+
     output_row_offset += output_pitch;
   }
 }
@@ -23,10 +23,40 @@ namespace rex::graphics {
 
 using namespace rex::graphics::xenos;
 
+namespace {
+
+// TextureInfo is a pure function of the six fetch constant dwords, and fetch
+// constants rarely change between draws - memoize recent derivations so
+// rebinding a texture costs a hash probe instead of redoing the extent math.
+constexpr size_t kPrepareCacheSize = 64;
+static_assert(!(kPrepareCacheSize & (kPrepareCacheSize - 1)),
+              "Prepare cache is indexed by a masked hash");
+
+struct PrepareCacheEntry {
+  xe_gpu_texture_fetch_t fetch;
+  TextureInfo info;
+  bool valid = false;
+};
+
+// Thread-local since textures may be prepared both by the command processor
+// and by tooling such as the trace viewer, without synchronization.
+thread_local PrepareCacheEntry prepare_cache_[kPrepareCacheSize];
+
+}  // namespace
+
 bool TextureInfo::Prepare(const xe_gpu_texture_fetch_t& fetch, TextureInfo* out_info) {
   // https://msdn.microsoft.com/en-us/library/windows/desktop/cc308051(v=vs.85).aspx
   // a2xx_sq_surfaceformat
 
+  // xe_gpu_texture_fetch_t is fully covered by its dword fields, so comparing
+  // and hashing the raw bytes is well-defined.
+  PrepareCacheEntry& cache_entry =
+      prepare_cache_[size_t(XXH3_64bits(&fetch, sizeof(fetch))) & (kPrepareCacheSize - 1)];
+  if (cache_entry.valid && !std::memcmp(&cache_entry.fetch, &fetch, sizeof(fetch))) {
+    *out_info = cache_entry.info;
+    return true;
+  }
+
   std::memset(out_info, 0, sizeof(TextureInfo));
 
   auto& info = *out_info;
@@ -87,6 +117,10 @@ bool TextureInfo::Prepare(const xe_gpu_texture_fetch_t& fetch, TextureInfo* out_
 
   assert_true(info.mip_min_level <= info.mip_max_level);
 
+  cache_entry.fetch = fetch;
+  cache_entry.info = info;
+  cache_entry.valid = true;
+
   return true;
 }
 
@@ -9,6 +9,7 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <array>
 #include <cstring>
 
 #include <rex/graphics/register_file.h>
@@ -37,4 +38,22 @@ const RegisterInfo* RegisterFile::GetRegisterInfo(uint32_t index) {
   }
 }
 
+bool RegisterFile::IsValidRegister(uint32_t index) {
+  if (index >= kRegisterCount) {
+    return false;
+  }
+  // Bitmap of the registers present in register_table.inc, built on the first
+  // use so register writes don't have to go through the info switch just to
+  // tell whether the register is known.
+  static const auto valid_bits = [] {
+    std::array<uint64_t, (kRegisterCount + 63) / 64> bits = {};
+#define XE_GPU_REGISTER(index, type, name) \
+  bits[(index) / 64] |= uint64_t(1) << ((index) % 64);
+#include <rex/graphics/register_table.inc>
+#undef XE_GPU_REGISTER
+    return bits;
+  }();
+  return (valid_bits[index / 64] & (uint64_t(1) << (index % 64))) != 0;
+}
+
 }  // namespace rex::graphics
@@ -12,13 +12,20 @@
 #include <algorithm>
 #include <utility>
 
+#include <xxhash.h>
+
 #include <rex/assert.h>
 #include <rex/bit.h>
+#include <rex/cvar.h>
 #include <rex/dbg.h>
 #include <rex/graphics/shared_memory.h>
 #include <rex/math.h>
 #include <rex/memory.h>
 
+REXCVAR_DEFINE_INT32(shared_memory_hash_poll_fault_threshold, 0, "GPU",
+                     "Stop write-watching a shared memory page after this many write faults and "
+                     "detect further changes by hashing it on use instead (0 = always watch)");
+
 namespace rex::graphics {
 
 SharedMemory::SharedMemory(memory::Memory& memory) : memory_(memory) {
@@ -32,6 +39,13 @@ SharedMemory::~SharedMemory() {
 void SharedMemory::InitializeCommon() {
   system_page_flags_.clear();
   system_page_flags_.resize(((kBufferSize >> page_size_log2_) + 63) / 64);
+  system_page_flags_valid_summary_.clear();
+  system_page_flags_valid_summary_.resize((system_page_flags_.size() + 63) / 64);
+  page_fault_counts_.clear();
+  page_fault_counts_.resize(kBufferSize >> page_size_log2_);
+  hash_polled_pages_.clear();
+  hash_polled_pages_.resize(system_page_flags_.size());
+  hash_polled_page_hashes_.clear();
 
   memory_invalidation_callback_handle_ =
       memory_.RegisterPhysicalMemoryInvalidationCallback(MemoryInvalidationCallbackThunk, this);
@@ -70,6 +84,12 @@ void SharedMemory::ShutdownCommon() {
     memory_invalidation_callback_handle_ = nullptr;
   }
 
+  page_fault_counts_.clear();
+  page_fault_counts_.shrink_to_fit();
+  hash_polled_pages_.clear();
+  hash_polled_pages_.shrink_to_fit();
+  hash_polled_page_hashes_.clear();
+
   if (host_gpu_memory_sparse_used_bytes_) {
     host_gpu_memory_sparse_used_bytes_ = 0;
     COUNT_profile_set("gpu/shared_memory/host_gpu_memory_sparse_used_mb", 0);
@@ -103,8 +123,12 @@ void SharedMemory::ClearCache() {
 
   {
     auto global_lock = global_critical_region_.Acquire();
-    for (SystemPageFlagsBlock& block : system_page_flags_) {
+    for (size_t i = 0; i < system_page_flags_.size(); ++i) {
+      SystemPageFlagsBlock& block = system_page_flags_[i];
       block.valid = block.valid_and_gpu_written;
+      if (block.valid != UINT64_MAX) {
+        system_page_flags_valid_summary_[i >> 6] &= ~(uint64_t(1) << (i & 63));
+      }
     }
   }
 }
@@ -288,6 +312,9 @@ void SharedMemory::MakeRangeValid(uint32_t start, uint32_t length, bool written_
       }
       SystemPageFlagsBlock& block = system_page_flags_[i];
       block.valid |= valid_bits;
+      if (block.valid == UINT64_MAX) {
+        system_page_flags_valid_summary_[i >> 6] |= uint64_t(1) << (i & 63);
+      }
       if (written_by_gpu) {
         block.valid_and_gpu_written |= valid_bits;
       } else {
@@ -296,10 +323,107 @@ void SharedMemory::MakeRangeValid(uint32_t start, uint32_t length, bool written_
     }
   }
 
-  if (memory_invalidation_callback_handle_) {
-    memory().EnablePhysicalMemoryAccessCallbacks(
-        valid_page_first << page_size_log2_,
-        (valid_page_last - valid_page_first + 1) << page_size_log2_, true, false);
+  if (!memory_invalidation_callback_handle_) {
+    return;
+  }
+
+  int32_t hash_poll_threshold = REXCVAR_GET(shared_memory_hash_poll_fault_threshold);
+  if (hash_poll_threshold > 0) {
+    auto global_lock = global_critical_region_.Acquire();
+    if (written_by_gpu) {
+      // GPU-written pages must stay watched - their GPU copy can't be compared
+      // against CPU memory - so put any polled pages back on the watch path.
+      for (uint32_t page = valid_page_first; page <= valid_page_last; ++page) {
+        uint64_t page_bit = uint64_t(1) << (page & 63);
+        if (hash_polled_pages_[page >> 6] & page_bit) {
+          hash_polled_pages_[page >> 6] &= ~page_bit;
+          hash_polled_page_hashes_.erase(page);
+        }
+      }
+    } else {
+      // Carve high-churn pages out of the watch request - snapshot their
+      // contents instead of protecting them, PollHashedPages catches changes.
+      uint32_t watch_run_first = UINT32_MAX;
+      for (uint32_t page = valid_page_first; page <= valid_page_last + 1; ++page) {
+        bool poll_page = page > valid_page_last;
+        if (!poll_page && page_fault_counts_[page] >= uint32_t(hash_poll_threshold)) {
+          hash_polled_pages_[page >> 6] |= uint64_t(1) << (page & 63);
+          hash_polled_page_hashes_[page] =
+              XXH3_64bits(memory().TranslatePhysical(page << page_size_log2_),
+                          size_t(1) << page_size_log2_);
+          poll_page = true;
+        }
+        if (!poll_page) {
+          if (watch_run_first == UINT32_MAX) {
+            watch_run_first = page;
+          }
+        } else if (watch_run_first != UINT32_MAX) {
+          EnableRangeCallbacks(watch_run_first, page - 1);
+          watch_run_first = UINT32_MAX;
+        }
+      }
+      return;
+    }
+  }
+
+  EnableRangeCallbacks(valid_page_first, valid_page_last);
+}
+
+void SharedMemory::EnableRangeCallbacks(uint32_t page_first, uint32_t page_last) {
+  {
+    auto global_lock = global_critical_region_.Acquire();
+    if (page_first >= protect_batch_page_first_ && page_last <= protect_batch_page_last_) {
+      // Already enabled for the whole request in one pass by RequestRange,
+      // and no invalidation has touched the span since (that clears it).
+      return;
+    }
+  }
+  memory().EnablePhysicalMemoryAccessCallbacks(page_first << page_size_log2_,
+                                               (page_last - page_first + 1) << page_size_log2_,
+                                               true, false);
+}
+
+void SharedMemory::PollHashedPages(uint32_t page_first, uint32_t page_last) {
+  uint32_t stale_run_first = UINT32_MAX;
+  uint32_t stale_run_last = 0;
+  for (uint32_t i = page_first >> 6; i <= (page_last >> 6); ++i) {
+    uint64_t polled = hash_polled_pages_[i];
+    if (i == (page_first >> 6)) {
+      polled &= ~((uint64_t(1) << (page_first & 63)) - 1);
+    }
+    if (i == (page_last >> 6) && (page_last & 63) != 63) {
+      polled &= (uint64_t(1) << ((page_last & 63) + 1)) - 1;
+    }
+    // Only pages believed valid can be stale.
+    polled &= system_page_flags_[i].valid;
+    uint32_t page_bit;
+    while (rex::bit_scan_forward(polled, &page_bit)) {
+      polled &= ~(uint64_t(1) << page_bit);
+      uint32_t page = (i << 6) + page_bit;
+      uint64_t hash = XXH3_64bits(memory().TranslatePhysical(page << page_size_log2_),
+                                  size_t(1) << page_size_log2_);
+      if (hash == hash_polled_page_hashes_[page]) {
+        continue;
+      }
+      // Contents changed since the upload - invalidate like a write fault
+      // would have.
+      SystemPageFlagsBlock& block = system_page_flags_[i];
+      block.valid &= ~(uint64_t(1) << page_bit);
+      block.valid_and_gpu_written &= ~(uint64_t(1) << page_bit);
+      system_page_flags_valid_summary_[i >> 6] &= ~(uint64_t(1) << (i & 63));
+      if (stale_run_first != UINT32_MAX && page == stale_run_last + 1) {
+        stale_run_last = page;
+      } else {
+        if (stale_run_first != UINT32_MAX) {
+          FireWatches(stale_run_first, stale_run_last, false);
+        }
+        stale_run_first = page;
+        stale_run_last = page;
+      }
+    }
+  }
+  if (stale_run_first != UINT32_MAX) {
+    FireWatches(stale_run_first, stale_run_last, false);
   }
 }
 
@@ -343,13 +467,41 @@ bool SharedMemory::RequestRange(uint32_t start, uint32_t length) {
   uint32_t page_first = start >> page_size_log2_;
   uint32_t page_last = (start + length - 1) >> page_size_log2_;
 
+  if (REXCVAR_GET(shared_memory_hash_poll_fault_threshold) > 0 &&
+      !hash_polled_page_hashes_.empty()) {
+    // Unwatched high-churn pages can't fault - detect their changes by hash
+    // before scanning validity so they get re-uploaded below.
+    auto global_lock = global_critical_region_.Acquire();
+    PollHashedPages(page_first, page_last);
+  }
+
   upload_ranges_.clear();
   uint32_t block_first = page_first >> 6;
   uint32_t block_last = page_last >> 6;
   uint32_t range_start = UINT32_MAX;
   {
     auto global_lock = global_critical_region_.Acquire();
-    for (uint32_t i = block_first; i <= block_last; ++i) {
+    uint32_t i = block_first;
+    while (i <= block_last) {
+      if (range_start == UINT32_MAX) {
+        // Nothing to upload from a fully valid block, and no range can be
+        // opened in it - use the summary bitmap to jump directly to the next
+        // block containing at least one invalid page.
+        uint32_t summary_index = i >> 6;
+        uint64_t summary_invalid =
+            ~system_page_flags_valid_summary_[summary_index] & (UINT64_MAX << (i & 63));
+        while (!summary_invalid && ++summary_index <= (block_last >> 6)) {
+          summary_invalid = ~system_page_flags_valid_summary_[summary_index];
+        }
+        uint32_t summary_bit;
+        if (!rex::bit_scan_forward(summary_invalid, &summary_bit)) {
+          break;
+        }
+        i = (summary_index << 6) + summary_bit;
+        if (i > block_last) {
+          break;
+        }
+      }
       const SystemPageFlagsBlock& block = system_page_flags_[i];
       uint64_t block_valid = block.valid;
       // Consider pages in the block outside the requested range valid.
@@ -388,6 +540,8 @@ bool SharedMemory::RequestRange(uint32_t start, uint32_t length) {
           range_start = UINT32_MAX;
         }
       }
+
+      ++i;
     }
   }
   if (range_start != UINT32_MAX) {
@@ -397,7 +551,43 @@ bool SharedMemory::RequestRange(uint32_t start, uint32_t length) {
     return true;
   }
 
-  return UploadRanges(upload_ranges_);
+  // Enable invalidation callbacks for everything being uploaded in one merged
+  // pass up front: UploadRanges implementations call MakeRangeValid once per
+  // upload buffer chunk, and streaming scenes produce thousands of chunks per
+  // second, each re-walking the heap page tables. Ranges separated by small
+  // already-valid gaps share one call - the gap pages are already watched, so
+  // they're skipped cheaply inside. Skipped in hash-poll mode, where
+  // MakeRangeValid decides per page whether to watch at all.
+  if (memory_invalidation_callback_handle_ &&
+      REXCVAR_GET(shared_memory_hash_poll_fault_threshold) <= 0) {
+    constexpr uint32_t kMaxMergeGapPages = 512;
+    uint32_t merged_first = upload_ranges_.front().first;
+    uint32_t merged_last = merged_first + upload_ranges_.front().second - 1;
+    for (size_t i = 1; i < upload_ranges_.size(); ++i) {
+      uint32_t range_first = upload_ranges_[i].first;
+      if (range_first - merged_last - 1 > kMaxMergeGapPages) {
+        memory().EnablePhysicalMemoryAccessCallbacks(
+            merged_first << page_size_log2_, (merged_last - merged_first + 1) << page_size_log2_,
+            true, false);
+        merged_first = range_first;
+      }
+      merged_last = range_first + upload_ranges_[i].second - 1;
+    }
+    memory().EnablePhysicalMemoryAccessCallbacks(
+        merged_first << page_size_log2_, (merged_last - merged_first + 1) << page_size_log2_, true,
+        false);
+    auto global_lock = global_critical_region_.Acquire();
+    protect_batch_page_first_ = page_first;
+    protect_batch_page_last_ = page_last;
+  }
+
+  bool uploaded = UploadRanges(upload_ranges_);
+  {
+    auto global_lock = global_critical_region_.Acquire();
+    protect_batch_page_first_ = UINT32_MAX;
+    protect_batch_page_last_ = 0;
+  }
+  return uploaded;
 }
 
 std::pair<uint32_t, uint32_t> SharedMemory::MemoryInvalidationCallbackThunk(
@@ -421,6 +611,17 @@ std::pair<uint32_t, uint32_t> SharedMemory::MemoryInvalidationCallback(
 
   auto global_lock = global_critical_region_.Acquire();
 
+  if (REXCVAR_GET(shared_memory_hash_poll_fault_threshold) > 0) {
+    // Count faults per page (before the range is widened - the surrounding
+    // pages didn't actually take this fault) so repeatedly rewritten pages
+    // can be switched to hash polling by MakeRangeValid.
+    for (uint32_t i = page_first; i <= page_last; ++i) {
+      if (page_fault_counts_[i] != UINT8_MAX) {
+        ++page_fault_counts_[i];
+      }
+    }
+  }
+
   if (!exact_range) {
     // Check if a somewhat wider range (up to 256 KB with 4 KB pages) can be
     // invalidated - if no GPU-written data nearby that was not intended to be
@@ -454,6 +655,15 @@ std::pair<uint32_t, uint32_t> SharedMemory::MemoryInvalidationCallback(
     SystemPageFlagsBlock& block = system_page_flags_[i];
     block.valid &= ~invalidate_bits;
     block.valid_and_gpu_written &= ~invalidate_bits;
+    system_page_flags_valid_summary_[i >> 6] &= ~(uint64_t(1) << (i & 63));
+  }
+
+  // This write just unprotected pages; if any fall inside the batched
+  // pre-arm span, the span's "already watched" assumption is gone - drop it
+  // so the per-chunk MakeRangeValid calls re-arm these pages.
+  if (page_first <= protect_batch_page_last_ && page_last >= protect_batch_page_first_) {
+    protect_batch_page_first_ = UINT32_MAX;
+    protect_batch_page_last_ = 0;
   }
 
   FireWatches(page_first, page_last, false);
@@ -479,6 +689,9 @@ void SharedMemory::PrepareForTraceDownload() {
     uint64_t previously_valid_block = page_flags_block.valid;
     uint64_t gpu_written_block = page_flags_block.valid_and_gpu_written;
     page_flags_block.valid = gpu_written_block;
+    if (gpu_written_block != UINT64_MAX) {
+      system_page_flags_valid_summary_[i >> 6] &= ~(uint64_t(1) << (i & 63));
+    }
 
     // Fire watches on the invalidated pages.
     uint64_t fire_watches_block = previously_valid_block & ~gpu_written_block;
@@ -9,6 +9,11 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <algorithm>
+
+#include <fmt/format.h>
+
+#include <rex/cvar.h>
 #include <rex/dbg.h>
 #include <rex/filesystem.h>
 #include <rex/graphics/command_processor.h>
@@ -23,15 +28,22 @@
 #include <rex/ui/presenter.h>
 #include <rex/ui/window.h>
 
-#include <stb_image_write.h"
+#include "stb_image_write.h"
 
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 #undef _CRT_SECURE_NO_WARNINGS
 #undef _CRT_NONSTDC_NO_DEPRECATE
-#include <stb_image_write.h"
-
-DEFINE_path(target_trace_file, "", "Specifies the trace file to load.", "GPU");
-DEFINE_path(trace_dump_path, "", "Output path for dumped files.", "GPU");
+#include "stb_image_write.h"
+
+REXCVAR_DEFINE_STRING(target_trace_file, "", "GPU", "Specifies the trace file to load.");
+REXCVAR_DEFINE_STRING(trace_dump_path, "", "GPU", "Output path for dumped files.");
+REXCVAR_DEFINE_INT32(trace_dump_shard_index, 0, "GPU",
+                     "Zero-based index of this process within trace_dump_shard_count. Each "
+                     "process renders a contiguous, disjoint range of the trace's frames.");
+REXCVAR_DEFINE_INT32(trace_dump_shard_count, 1, "GPU",
+                     "Number of trace dump processes sharing the frame export. Output names "
+                     "are keyed by absolute frame index, so shards can write into the same "
+                     "directory and any shard split produces identical files.");
 
 namespace rex::graphics {
 
@@ -119,20 +131,43 @@ bool TraceDump::Load(const std::filesystem::path& trace_file_path) {
 }
 
 int TraceDump::Run() {
-  BeginHostCapture();
-  player_->SeekFrame(0);
-  player_->SeekCommand(static_cast<int>(player_->current_frame()->commands.size() - 1));
-  player_->WaitOnPlayback();
-  EndHostCapture();
+  // Frame range for this process. Shards render contiguous disjoint ranges so
+  // each pays at most one keyframe seek and then steps frame to frame.
+  const int frame_count = player_->frame_count();
+  const int shard_count = std::max(REXCVAR_GET(trace_dump_shard_count), 1);
+  const int shard_index = std::clamp(REXCVAR_GET(trace_dump_shard_index), 0, shard_count - 1);
+  const int range_begin = int(int64_t(frame_count) * shard_index / shard_count);
+  const int range_end = int(int64_t(frame_count) * (shard_index + 1) / shard_count);
 
-  // Capture.
   int result = 0;
-  ui::Presenter* presenter = graphics_system_->presenter();
-  ui::RawImage raw_image;
-  if (presenter && presenter->CaptureGuestOutput(raw_image)) {
-    // Save framebuffer png.
-    auto png_path = base_output_path_.replace_extension(".png");
+  for (int frame_index = range_begin; frame_index < range_end; ++frame_index) {
+    BeginHostCapture();
+    player_->SeekFrame(frame_index);
+    player_->SeekCommand(static_cast<int>(player_->current_frame()->commands.size() - 1));
+    player_->WaitOnPlayback();
+    EndHostCapture();
+
+    // Capture.
+    ui::Presenter* presenter = graphics_system_->presenter();
+    ui::RawImage raw_image;
+    if (!presenter || !presenter->CaptureGuestOutput(raw_image)) {
+      result = 1;
+      continue;
+    }
+
+    // Save framebuffer png. Single-frame traces keep the bare name; frames of
+    // longer traces are keyed by absolute frame index so the naming does not
+    // depend on how the export was sharded.
+    auto png_path = base_output_path_;
+    if (frame_count > 1) {
+      png_path += fmt::format("-{:04d}", frame_index);
+    }
+    png_path.replace_extension(".png");
     auto handle = filesystem::OpenFile(png_path, "wb");
+    if (!handle) {
+      result = 1;
+      continue;
+    }
     auto callback = [](void* context, void* data, int size) {
       fwrite(data, 1, size, (FILE*)context);
     };
@@ -140,8 +175,6 @@ int TraceDump::Run() {
                            static_cast<int>(raw_image.height), 4, raw_image.data.data(),
                            static_cast<int>(raw_image.stride));
     fclose(handle);
-  } else {
-    result = 1;
   }
 
   player_.reset();
@@ -45,13 +45,28 @@ void TracePlayer::SeekFrame(int target_frame) {
   if (current_frame_index_ == target_frame) {
     return;
   }
+  int previous_frame_index = current_frame_index_;
   current_frame_index_ = target_frame;
   auto frame = current_frame();
   current_command_index_ = int(frame->commands.size()) - 1;
 
   assert_true(frame->start_ptr <= frame->end_ptr);
-  PlayTrace(frame->start_ptr, frame->end_ptr - frame->start_ptr, TracePlaybackMode::kBreakOnSwap,
-            false);
+  if (target_frame == previous_frame_index + 1 || !frame->keyframe_ptr) {
+    // Stepping to the next frame - continue from the state playback has
+    // already established. Also the fallback for traces without keyframes,
+    // where playing the frame alone is the best that can be done.
+    PlayTrace(frame->start_ptr, frame->end_ptr - frame->start_ptr, TracePlaybackMode::kBreakOnSwap,
+              false);
+    return;
+  }
+
+  // Jumping around in the trace - restore the nearest preceding state
+  // snapshot and replay the tail up to the target frame, so the registers,
+  // EDRAM and memory the target frame reads match what the title had set by
+  // that point rather than whatever the previous seek left behind.
+  assert_true(frame->keyframe_ptr <= frame->start_ptr);
+  PlayTrace(frame->keyframe_ptr, frame->end_ptr - frame->keyframe_ptr,
+            TracePlaybackMode::kUntilEnd, true);
 }
 
 void TracePlayer::SeekCommand(int target_command) {
@@ -21,7 +21,7 @@
 #include <rex/memory/mapped_memory.h>
 #include <rex/platform.h>
 
-#include <snappy.h"
+#include "snappy.h"
 
 namespace rex::graphics {
 
@@ -82,6 +82,7 @@ void TraceReader::ParseTrace() {
   const PacketStartCommand* packet_start = nullptr;
   const uint8_t* packet_start_ptr = nullptr;
   const uint8_t* last_ptr = trace_ptr;
+  const uint8_t* last_keyframe_ptr = nullptr;
   bool pending_break = false;
   auto current_command_buffer = new CommandBuffer();
   current_frame.command_tree = std::unique_ptr<CommandBuffer>(current_command_buffer);
@@ -178,6 +179,7 @@ void TraceReader::ParseTrace() {
           current_frame.command_tree = std::unique_ptr<CommandBuffer>(current_command_buffer);
           current_frame.start_ptr = trace_ptr;
           current_frame.end_ptr = nullptr;
+          current_frame.keyframe_ptr = last_keyframe_ptr;
           current_frame.command_count = 0;
           pending_break = false;
         }
@@ -211,6 +213,13 @@ void TraceReader::ParseTrace() {
       }
       case TraceCommandType::kRegisters: {
         auto cmd = reinterpret_cast<const RegistersCommand*>(trace_ptr);
+        // A register dump is only ever written as the first record of a full
+        // state snapshot, so it marks a keyframe the player can seek to. A
+        // snapshot emitted after a swap establishes the next frame's state.
+        last_keyframe_ptr = trace_ptr;
+        if (current_frame.commands.empty() && !current_frame.keyframe_ptr) {
+          current_frame.keyframe_ptr = trace_ptr;
+        }
         trace_ptr += sizeof(*cmd) + cmd->encoded_length;
         break;
       }
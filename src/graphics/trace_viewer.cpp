@@ -283,6 +283,117 @@ void TraceViewer::DrawPacketDisassemblerUI() {
               player_->current_command_index());
   ImGui::Separator();
   ImGui::BeginChild("packet_disassembler_list");
+  if (start_ptr != packet_disassembler_rows_start_ptr_ ||
+      end_ptr != packet_disassembler_rows_end_ptr_) {
+    BuildPacketDisassemblerRows(start_ptr, end_ptr);
+  }
+  // Decoded lazily only for the packets the clipper reveals, and kept across
+  // consecutive rows belonging to the same packet.
+  PacketInfo packet_info;
+  const uint8_t* packet_info_ptr = nullptr;
+  bool packet_info_valid = false;
+  auto ensure_packet_info = [&](const uint8_t* packet_ptr) {
+    if (packet_info_ptr == packet_ptr) {
+      return;
+    }
+    packet_info_ptr = packet_ptr;
+    packet_info.type_info = nullptr;
+    packet_info.predicated = false;
+    packet_info.count = 0;
+    packet_info.actions.clear();
+    packet_info_valid =
+        PacketDisassembler::DisasmPacket(packet_ptr + sizeof(PacketStartCommand), &packet_info);
+  };
+  ImGuiListClipper clipper;
+  clipper.Begin(int(packet_disassembler_rows_.size()));
+  while (clipper.Step()) {
+    for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+      const PacketDisassemblerRow& row = packet_disassembler_rows_[size_t(i)];
+      auto type = static_cast<TraceCommandType>(memory::load<uint32_t>(row.trace_ptr));
+      if (type != TraceCommandType::kPacketStart) {
+        switch (type) {
+          case TraceCommandType::kPrimaryBufferStart: {
+            ImGui::BulletText("PrimaryBufferStart");
+            break;
+          }
+          case TraceCommandType::kPrimaryBufferEnd: {
+            ImGui::BulletText("PrimaryBufferEnd");
+            break;
+          }
+          case TraceCommandType::kIndirectBufferStart: {
+            ImGui::BulletText("IndirectBufferStart");
+            break;
+          }
+          case TraceCommandType::kIndirectBufferEnd: {
+            ImGui::BulletText("IndirectBufferEnd");
+            break;
+          }
+          case TraceCommandType::kEvent: {
+            ImGui::BulletText("<swap>");
+            break;
+          }
+          default: {
+            break;
+          }
+        }
+        continue;
+      }
+      ensure_packet_info(row.trace_ptr);
+      if (!packet_info_valid) {
+        ImGui::BulletText("<invalid packet>");
+        continue;
+      }
+      if (packet_info.predicated) {
+        ImGui::PushStyleColor(ImGuiCol_Text, kColorIgnored);
+      }
+      if (row.action_index < 0) {
+        ImGui::BulletText("%s", packet_info.type_info->name);
+      } else {
+        ImGui::Indent();
+        const PacketAction& action = packet_info.actions[size_t(row.action_index)];
+        switch (action.type) {
+          case PacketAction::Type::kRegisterWrite: {
+            auto register_info =
+                rex::graphics::RegisterFile::GetRegisterInfo(action.register_write.index);
+            ImGui::Columns(2);
+            ImGui::Text("%.4X %s", action.register_write.index,
+                        register_info ? register_info->name : "???");
+            ImGui::NextColumn();
+            if (!register_info || register_info->type == RegisterInfo::Type::kDword) {
+              ImGui::Text("%.8X", action.register_write.value);
+            } else {
+              ImGui::Text("%8f", rex::memory::Reinterpret<float>(action.register_write.value));
+            }
+            ImGui::Columns(1);
+            break;
+          }
+          case PacketAction::Type::kSetBinMask: {
+            ImGui::Text("%.16" PRIX64, action.set_bin_mask.value);
+            break;
+          }
+          case PacketAction::Type::kSetBinSelect: {
+            ImGui::Text("%.16" PRIX64, action.set_bin_select.value);
+            break;
+          }
+        }
+        ImGui::Unindent();
+      }
+      if (packet_info.predicated) {
+        ImGui::PopStyleColor();
+      }
+    }
+  }
+  ImGui::EndChild();
+  ImGui::End();
+}
+
+void TraceViewer::BuildPacketDisassemblerRows(const uint8_t* start_ptr, const uint8_t* end_ptr) {
+  packet_disassembler_rows_.clear();
+  packet_disassembler_rows_start_ptr_ = start_ptr;
+  packet_disassembler_rows_end_ptr_ = end_ptr;
+  // Reused across packets so the pre-scan doesn't allocate per packet - the
+  // decoded actions are discarded, only their count is turned into rows.
+  PacketInfo packet_info;
   const PacketStartCommand* pending_packet = nullptr;
   auto trace_ptr = start_ptr;
   while (trace_ptr < end_ptr) {
@@ -290,26 +401,26 @@ void TraceViewer::DrawPacketDisassemblerUI() {
     switch (type) {
       case TraceCommandType::kPrimaryBufferStart: {
         auto cmd = reinterpret_cast<const PrimaryBufferStartCommand*>(trace_ptr);
+        packet_disassembler_rows_.push_back({trace_ptr, -1});
         trace_ptr += sizeof(*cmd) + cmd->count * 4;
-        ImGui::BulletText("PrimaryBufferStart");
         break;
       }
       case TraceCommandType::kPrimaryBufferEnd: {
         auto cmd = reinterpret_cast<const PrimaryBufferEndCommand*>(trace_ptr);
+        packet_disassembler_rows_.push_back({trace_ptr, -1});
         trace_ptr += sizeof(*cmd);
-        ImGui::BulletText("PrimaryBufferEnd");
         break;
       }
       case TraceCommandType::kIndirectBufferStart: {
         auto cmd = reinterpret_cast<const IndirectBufferStartCommand*>(trace_ptr);
+        packet_disassembler_rows_.push_back({trace_ptr, -1});
         trace_ptr += sizeof(*cmd) + cmd->count * 4;
-        ImGui::BulletText("IndirectBufferStart");
         break;
       }
       case TraceCommandType::kIndirectBufferEnd: {
         auto cmd = reinterpret_cast<const IndirectBufferEndCommand*>(trace_ptr);
+        packet_disassembler_rows_.push_back({trace_ptr, -1});
         trace_ptr += sizeof(*cmd);
-        ImGui::BulletText("IndirectBufferEnd");
         break;
       }
       case TraceCommandType::kPacketStart: {
@@ -322,49 +433,17 @@ void TraceViewer::DrawPacketDisassemblerUI() {
         auto cmd = reinterpret_cast<const PacketEndCommand*>(trace_ptr);
         trace_ptr += sizeof(*cmd);
         if (pending_packet) {
-          PacketInfo packet_info = {0};
-          if (PacketDisassembler::DisasmPacket(
-                  reinterpret_cast<const uint8_t*>(pending_packet) + sizeof(PacketStartCommand),
-                  &packet_info)) {
-            if (packet_info.predicated) {
-              ImGui::PushStyleColor(ImGuiCol_Text, kColorIgnored);
-            }
-            ImGui::BulletText("%s", packet_info.type_info->name);
-            ImGui::TreePush((const char*)0);
-            for (auto action : packet_info.actions) {
-              switch (action.type) {
-                case PacketAction::Type::kRegisterWrite: {
-                  auto register_info =
-                      rex::graphics::RegisterFile::GetRegisterInfo(action.register_write.index);
-                  ImGui::Columns(2);
-                  ImGui::Text("%.4X %s", action.register_write.index,
-                              register_info ? register_info->name : "???");
-                  ImGui::NextColumn();
-                  if (!register_info || register_info->type == RegisterInfo::Type::kDword) {
-                    ImGui::Text("%.8X", action.register_write.value);
-                  } else {
-                    ImGui::Text("%8f",
-                                rex::memory::Reinterpret<float>(action.register_write.value));
-                  }
-                  ImGui::Columns(1);
-                  break;
-                }
-                case PacketAction::Type::kSetBinMask: {
-                  ImGui::Text("%.16" PRIX64, action.set_bin_mask.value);
-                  break;
-                }
-                case PacketAction::Type::kSetBinSelect: {
-                  ImGui::Text("%.16" PRIX64, action.set_bin_select.value);
-                  break;
-                }
-              }
+          auto pending_packet_ptr = reinterpret_cast<const uint8_t*>(pending_packet);
+          packet_disassembler_rows_.push_back({pending_packet_ptr, -1});
+          packet_info.type_info = nullptr;
+          packet_info.predicated = false;
+          packet_info.count = 0;
+          packet_info.actions.clear();
+          if (PacketDisassembler::DisasmPacket(pending_packet_ptr + sizeof(PacketStartCommand),
+                                               &packet_info)) {
+            for (int32_t j = 0; j < int32_t(packet_info.actions.size()); ++j) {
+              packet_disassembler_rows_.push_back({pending_packet_ptr, j});
             }
-            ImGui::TreePop();
-            if (packet_info.predicated) {
-              ImGui::PopStyleColor();
-            }
-          } else {
-            ImGui::BulletText("<invalid packet>");
           }
           pending_packet = nullptr;
         }
@@ -373,48 +452,38 @@ void TraceViewer::DrawPacketDisassemblerUI() {
       case TraceCommandType::kMemoryRead: {
         auto cmd = reinterpret_cast<const MemoryCommand*>(trace_ptr);
         trace_ptr += sizeof(*cmd) + cmd->encoded_length;
-        // ImGui::BulletText("MemoryRead");
         break;
       }
       case TraceCommandType::kMemoryWrite: {
         auto cmd = reinterpret_cast<const MemoryCommand*>(trace_ptr);
         trace_ptr += sizeof(*cmd) + cmd->encoded_length;
-        // ImGui::BulletText("MemoryWrite");
         break;
       }
       case TraceCommandType::kEdramSnapshot: {
         auto cmd = reinterpret_cast<const EdramSnapshotCommand*>(trace_ptr);
         trace_ptr += sizeof(*cmd) + cmd->encoded_length;
-        // ImGui::BulletText("EdramSnapshot");
         break;
       }
       case TraceCommandType::kEvent: {
         auto cmd = reinterpret_cast<const EventCommand*>(trace_ptr);
-        trace_ptr += sizeof(*cmd);
-        switch (cmd->event_type) {
-          case EventCommand::Type::kSwap: {
-            ImGui::BulletText("<swap>");
-            break;
-          }
+        if (cmd->event_type == EventCommand::Type::kSwap) {
+          packet_disassembler_rows_.push_back({trace_ptr, -1});
         }
+        trace_ptr += sizeof(*cmd);
         break;
       }
       case TraceCommandType::kRegisters: {
         auto cmd = reinterpret_cast<const RegistersCommand*>(trace_ptr);
         trace_ptr += sizeof(*cmd) + cmd->encoded_length;
-        // ImGui::BulletText("Registers");
         break;
       }
       case TraceCommandType::kGammaRamp: {
         auto cmd = reinterpret_cast<const GammaRampCommand*>(trace_ptr);
         trace_ptr += sizeof(*cmd) + cmd->encoded_length;
-        // ImGui::BulletText("GammaRamp");
         break;
       }
     }
   }
-  ImGui::EndChild();
-  ImGui::End();
 }
 
 int TraceViewer::RecursiveDrawCommandBufferUI(const TraceReader::Frame* frame,
@@ -14,12 +14,7 @@
 
 #include <rex/graphics/trace_writer.h>
 
-// TODO(tomc): Enable on other platforms once the RTTI linking issue is resolved
-#ifdef _WIN32
-#define REX_TRACE_USE_SNAPPY 1
-#include "snappy-sinksource.h"
 #include "snappy.h"
-#endif
 
 #include <rex/assert.h>
 #include <rex/filesystem.h>
@@ -31,7 +26,9 @@ namespace rex::graphics {
 
 TraceWriter::TraceWriter(uint8_t* membase) : membase_(membase), file_(nullptr) {}
 
-TraceWriter::~TraceWriter() = default;
+TraceWriter::~TraceWriter() {
+  Close();
+}
 
 bool TraceWriter::Open(const std::filesystem::path& path, uint32_t title_id) {
   Close();
@@ -61,26 +58,104 @@ bool TraceWriter::Open(const std::filesystem::path& path, uint32_t title_id) {
   std::memset(header.build_commit_sha, 0, sizeof(header.build_commit_sha));
   std::strncpy(header.build_commit_sha, "rexglue-dev", sizeof(header.build_commit_sha) - 1);
   header.title_id = title_id;
-  fwrite(&header, sizeof(header), 1, file_);
 
   cached_memory_reads_.clear();
+
+  write_chunk_.clear();
+  write_chunk_.reserve(kWriteChunkSize * 2);
+  write_queue_.clear();
+  write_flush_pending_ = false;
+  write_thread_shutdown_ = false;
+  AppendBytes(&header, sizeof(header));
+  write_thread_ = rex::thread::Thread::Create({}, [this]() { WriteThread(); });
+  assert_not_null(write_thread_);
+  write_thread_->set_name("GPU Trace writer");
   return true;
 }
 
 void TraceWriter::Flush() {
-  if (file_) {
-    fflush(file_);
+  if (!file_) {
+    return;
   }
+  // Hand off whatever has been recorded so far and request a file flush, but
+  // don't wait for the write thread - the flush is only needed so a crash
+  // doesn't lose much of the stream, not for ordering.
+  {
+    std::lock_guard<std::mutex> lock(write_request_lock_);
+    if (!write_chunk_.empty()) {
+      write_queue_.push_back(std::move(write_chunk_));
+      write_chunk_.clear();
+    }
+    write_flush_pending_ = true;
+  }
+  write_request_cond_.notify_one();
 }
 
 void TraceWriter::Close() {
-  if (file_) {
-    cached_memory_reads_.clear();
+  if (!file_) {
+    return;
+  }
+  cached_memory_reads_.clear();
 
-    fflush(file_);
-    fclose(file_);
-    file_ = nullptr;
-    REXGPU_INFO("TraceWriter: Closed trace file");
+  {
+    std::lock_guard<std::mutex> lock(write_request_lock_);
+    if (!write_chunk_.empty()) {
+      write_queue_.push_back(std::move(write_chunk_));
+      write_chunk_.clear();
+    }
+    write_thread_shutdown_ = true;
+  }
+  write_request_cond_.notify_one();
+  rex::thread::Wait(write_thread_.get(), false);
+  write_thread_.reset();
+
+  fflush(file_);
+  fclose(file_);
+  file_ = nullptr;
+  REXGPU_INFO("TraceWriter: Closed trace file");
+}
+
+void TraceWriter::AppendBytes(const void* data, size_t length) {
+  size_t offset = write_chunk_.size();
+  write_chunk_.resize(offset + length);
+  std::memcpy(write_chunk_.data() + offset, data, length);
+  if (write_chunk_.size() >= kWriteChunkSize) {
+    {
+      std::lock_guard<std::mutex> lock(write_request_lock_);
+      write_queue_.push_back(std::move(write_chunk_));
+    }
+    write_chunk_.clear();
+    write_request_cond_.notify_one();
+  }
+}
+
+void TraceWriter::WriteThread() {
+  while (true) {
+    std::vector<uint8_t> chunk;
+    bool flush_file = false;
+    {
+      std::unique_lock<std::mutex> lock(write_request_lock_);
+      if (!write_queue_.empty()) {
+        chunk = std::move(write_queue_.front());
+        write_queue_.pop_front();
+      } else if (write_flush_pending_) {
+        write_flush_pending_ = false;
+        flush_file = true;
+      } else {
+        // The queue is drained before shutting down so Close can't lose
+        // records.
+        if (write_thread_shutdown_) {
+          return;
+        }
+        write_request_cond_.wait(lock);
+        continue;
+      }
+    }
+    if (flush_file) {
+      fflush(file_);
+      continue;
+    }
+    fwrite(chunk.data(), 1, chunk.size(), file_);
   }
 }
 
@@ -93,7 +168,7 @@ void TraceWriter::WritePrimaryBufferStart(uint32_t base_ptr, uint32_t count) {
       base_ptr,
       0,
   };
-  fwrite(&cmd, 1, sizeof(cmd), file_);
+  AppendBytes(&cmd, sizeof(cmd));
 }
 
 void TraceWriter::WritePrimaryBufferEnd() {
@@ -103,7 +178,7 @@ void TraceWriter::WritePrimaryBufferEnd() {
   PrimaryBufferEndCommand cmd = {
       TraceCommandType::kPrimaryBufferEnd,
   };
-  fwrite(&cmd, 1, sizeof(cmd), file_);
+  AppendBytes(&cmd, sizeof(cmd));
 }
 
 void TraceWriter::WriteIndirectBufferStart(uint32_t base_ptr, uint32_t count) {
@@ -115,7 +190,7 @@ void TraceWriter::WriteIndirectBufferStart(uint32_t base_ptr, uint32_t count) {
       base_ptr,
       0,
   };
-  fwrite(&cmd, 1, sizeof(cmd), file_);
+  AppendBytes(&cmd, sizeof(cmd));
 }
 
 void TraceWriter::WriteIndirectBufferEnd() {
@@ -125,7 +200,7 @@ void TraceWriter::WriteIndirectBufferEnd() {
   IndirectBufferEndCommand cmd = {
       TraceCommandType::kIndirectBufferEnd,
   };
-  fwrite(&cmd, 1, sizeof(cmd), file_);
+  AppendBytes(&cmd, sizeof(cmd));
 }
 
 void TraceWriter::WritePacketStart(uint32_t base_ptr, uint32_t count) {
@@ -137,8 +212,8 @@ void TraceWriter::WritePacketStart(uint32_t base_ptr, uint32_t count) {
       base_ptr,
       count,
   };
-  fwrite(&cmd, 1, sizeof(cmd), file_);
-  fwrite(membase_ + base_ptr, 4, count, file_);
+  AppendBytes(&cmd, sizeof(cmd));
+  AppendBytes(membase_ + base_ptr, size_t(4) * count);
 }
 
 void TraceWriter::WritePacketEnd() {
@@ -148,7 +223,7 @@ void TraceWriter::WritePacketEnd() {
   PacketEndCommand cmd = {
       TraceCommandType::kPacketEnd,
   };
-  fwrite(&cmd, 1, sizeof(cmd), file_);
+  AppendBytes(&cmd, sizeof(cmd));
 }
 
 void TraceWriter::WriteMemoryRead(uint32_t base_ptr, size_t length, const void* host_ptr) {
@@ -190,18 +265,6 @@ void TraceWriter::WriteMemoryWrite(uint32_t base_ptr, size_t length, const void*
   WriteMemoryCommand(TraceCommandType::kMemoryWrite, base_ptr, length, host_ptr);
 }
 
-#if REX_TRACE_USE_SNAPPY
-class SnappySink : public snappy::Sink {
- public:
-  SnappySink(FILE* file) : file_(file) {}
-
-  void Append(const char* bytes, size_t n) override { fwrite(bytes, 1, n, file_); }
-
- private:
-  FILE* file_ = nullptr;
-};
-#endif
-
 void TraceWriter::WriteMemoryCommand(TraceCommandType type, uint32_t base_ptr, size_t length,
                                      const void* host_ptr) {
   MemoryCommand cmd = {};
@@ -214,63 +277,48 @@ void TraceWriter::WriteMemoryCommand(TraceCommandType type, uint32_t base_ptr, s
     host_ptr = membase_ + cmd.base_ptr;
   }
 
-#if REX_TRACE_USE_SNAPPY
   bool compress = compress_output_ && length > compression_threshold_;
   if (compress) {
-    // Write the header now so we reserve space in the buffer.
-    long header_position = std::ftell(file_);
+    // Compress into the scratch buffer first so the header can be written
+    // with the final size and the output stays purely sequential.
+    compression_scratch_.resize(snappy::MaxCompressedLength(cmd.decoded_length));
+    size_t encoded_length;
+    snappy::RawCompress(reinterpret_cast<const char*>(host_ptr), cmd.decoded_length,
+                        compression_scratch_.data(), &encoded_length);
     cmd.encoding_format = MemoryEncodingFormat::kSnappy;
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-
-    // Stream the content right to the buffer.
-    snappy::ByteArraySource snappy_source(reinterpret_cast<const char*>(host_ptr),
-                                          cmd.decoded_length);
-    SnappySink snappy_sink(file_);
-    cmd.encoded_length = static_cast<uint32_t>(snappy::Compress(&snappy_source, &snappy_sink));
-
-    // Seek back and overwrite the header with our final size.
-    std::fseek(file_, header_position, SEEK_SET);
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-    std::fseek(file_, header_position + sizeof(cmd) + cmd.encoded_length, SEEK_SET);
-  } else
-#endif
-  {
-    // Uncompressed - write buffer directly to the file.
+    cmd.encoded_length = static_cast<uint32_t>(encoded_length);
+    AppendBytes(&cmd, sizeof(cmd));
+    AppendBytes(compression_scratch_.data(), encoded_length);
+  } else {
+    // Uncompressed - write buffer directly to the stream.
     cmd.encoding_format = MemoryEncodingFormat::kNone;
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-    fwrite(host_ptr, 1, cmd.decoded_length, file_);
+    AppendBytes(&cmd, sizeof(cmd));
+    AppendBytes(host_ptr, cmd.decoded_length);
   }
 }
 
 void TraceWriter::WriteEdramSnapshot(const void* snapshot) {
+  if (!file_) {
+    return;
+  }
   EdramSnapshotCommand cmd = {};
   cmd.type = TraceCommandType::kEdramSnapshot;
 
-#if REX_TRACE_USE_SNAPPY
   if (compress_output_) {
-    // Write the header now so we reserve space in the buffer.
-    long header_position = std::ftell(file_);
+    compression_scratch_.resize(snappy::MaxCompressedLength(xenos::kEdramSizeBytes));
+    size_t encoded_length;
+    snappy::RawCompress(reinterpret_cast<const char*>(snapshot), xenos::kEdramSizeBytes,
+                        compression_scratch_.data(), &encoded_length);
     cmd.encoding_format = MemoryEncodingFormat::kSnappy;
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-
-    // Stream the content right to the buffer.
-    snappy::ByteArraySource snappy_source(reinterpret_cast<const char*>(snapshot),
-                                          xenos::kEdramSizeBytes);
-    SnappySink snappy_sink(file_);
-    cmd.encoded_length = static_cast<uint32_t>(snappy::Compress(&snappy_source, &snappy_sink));
-
-    // Seek back and overwrite the header with our final size.
-    std::fseek(file_, header_position, SEEK_SET);
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-    std::fseek(file_, header_position + sizeof(cmd) + cmd.encoded_length, SEEK_SET);
-  } else
-#endif
-  {
-    // Uncompressed - write buffer directly to the file.
+    cmd.encoded_length = static_cast<uint32_t>(encoded_length);
+    AppendBytes(&cmd, sizeof(cmd));
+    AppendBytes(compression_scratch_.data(), encoded_length);
+  } else {
+    // Uncompressed - write buffer directly to the stream.
     cmd.encoding_format = MemoryEncodingFormat::kNone;
     cmd.encoded_length = xenos::kEdramSizeBytes;
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-    fwrite(snapshot, 1, xenos::kEdramSizeBytes, file_);
+    AppendBytes(&cmd, sizeof(cmd));
+    AppendBytes(snapshot, xenos::kEdramSizeBytes);
   }
 }
 
@@ -282,11 +330,14 @@ void TraceWriter::WriteEvent(EventCommand::Type event_type) {
       TraceCommandType::kEvent,
       event_type,
   };
-  fwrite(&cmd, 1, sizeof(cmd), file_);
+  AppendBytes(&cmd, sizeof(cmd));
 }
 
 void TraceWriter::WriteRegisters(uint32_t first_register, const uint32_t* register_values,
                                  uint32_t register_count, bool execute_callbacks_on_play) {
+  if (!file_) {
+    return;
+  }
   RegistersCommand cmd = {};
   cmd.type = TraceCommandType::kRegisters;
   cmd.first_register = first_register;
@@ -294,37 +345,30 @@ void TraceWriter::WriteRegisters(uint32_t first_register, const uint32_t* regist
   cmd.execute_callbacks = execute_callbacks_on_play;
 
   uint32_t uncompressed_length = uint32_t(sizeof(uint32_t) * register_count);
-#if REX_TRACE_USE_SNAPPY
   if (compress_output_) {
-    // Write the header now so we reserve space in the buffer.
-    long header_position = std::ftell(file_);
+    compression_scratch_.resize(snappy::MaxCompressedLength(uncompressed_length));
+    size_t encoded_length;
+    snappy::RawCompress(reinterpret_cast<const char*>(register_values), uncompressed_length,
+                        compression_scratch_.data(), &encoded_length);
     cmd.encoding_format = MemoryEncodingFormat::kSnappy;
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-
-    // Stream the content right to the buffer.
-    snappy::ByteArraySource snappy_source(reinterpret_cast<const char*>(register_values),
-                                          uncompressed_length);
-    SnappySink snappy_sink(file_);
-    cmd.encoded_length = static_cast<uint32_t>(snappy::Compress(&snappy_source, &snappy_sink));
-
-    // Seek back and overwrite the header with our final size.
-    std::fseek(file_, header_position, SEEK_SET);
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-    std::fseek(file_, header_position + sizeof(cmd) + cmd.encoded_length, SEEK_SET);
-  } else
-#endif
-  {
-    // Uncompressed - write the values directly to the file.
+    cmd.encoded_length = static_cast<uint32_t>(encoded_length);
+    AppendBytes(&cmd, sizeof(cmd));
+    AppendBytes(compression_scratch_.data(), encoded_length);
+  } else {
+    // Uncompressed - write the values directly to the stream.
     cmd.encoding_format = MemoryEncodingFormat::kNone;
     cmd.encoded_length = uncompressed_length;
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-    fwrite(register_values, 1, uncompressed_length, file_);
+    AppendBytes(&cmd, sizeof(cmd));
+    AppendBytes(register_values, uncompressed_length);
   }
 }
 
 void TraceWriter::WriteGammaRamp(const reg::DC_LUT_30_COLOR* gamma_ramp_256_entry_table,
                                  const reg::DC_LUT_PWL_DATA* gamma_ramp_pwl_rgb,
                                  uint32_t gamma_ramp_rw_component) {
+  if (!file_) {
+    return;
+  }
   GammaRampCommand cmd = {};
   cmd.type = TraceCommandType::kGammaRamp;
   cmd.rw_component = uint8_t(gamma_ramp_rw_component);
@@ -333,37 +377,26 @@ void TraceWriter::WriteGammaRamp(const reg::DC_LUT_30_COLOR* gamma_ramp_256_entr
   constexpr uint32_t kPWLUncompressedLength = sizeof(reg::DC_LUT_PWL_DATA) * 3 * 128;
   constexpr uint32_t kUncompressedLength =
       k256EntryTableUncompressedLength + kPWLUncompressedLength;
-#if REX_TRACE_USE_SNAPPY
   if (compress_output_) {
-    // Write the header now so we reserve space in the buffer.
-    long header_position = std::ftell(file_);
+    std::unique_ptr<char[]> gamma_ramps(new char[kUncompressedLength]);
+    std::memcpy(gamma_ramps.get(), gamma_ramp_256_entry_table, k256EntryTableUncompressedLength);
+    std::memcpy(gamma_ramps.get() + k256EntryTableUncompressedLength, gamma_ramp_pwl_rgb,
+                kPWLUncompressedLength);
+    compression_scratch_.resize(snappy::MaxCompressedLength(kUncompressedLength));
+    size_t encoded_length;
+    snappy::RawCompress(gamma_ramps.get(), kUncompressedLength, compression_scratch_.data(),
+                        &encoded_length);
     cmd.encoding_format = MemoryEncodingFormat::kSnappy;
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-
-    // Stream the content right to the buffer.
-    {
-      std::unique_ptr<char[]> gamma_ramps(new char[kUncompressedLength]);
-      std::memcpy(gamma_ramps.get(), gamma_ramp_256_entry_table, k256EntryTableUncompressedLength);
-      std::memcpy(gamma_ramps.get() + k256EntryTableUncompressedLength, gamma_ramp_pwl_rgb,
-                  kPWLUncompressedLength);
-      snappy::ByteArraySource snappy_source(gamma_ramps.get(), kUncompressedLength);
-      SnappySink snappy_sink(file_);
-      cmd.encoded_length = static_cast<uint32_t>(snappy::Compress(&snappy_source, &snappy_sink));
-    }
-
-    // Seek back and overwrite the header with our final size.
-    std::fseek(file_, header_position, SEEK_SET);
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-    std::fseek(file_, header_position + sizeof(cmd) + cmd.encoded_length, SEEK_SET);
-  } else
-#endif
-  {
-    // Uncompressed - write the values directly to the file.
+    cmd.encoded_length = static_cast<uint32_t>(encoded_length);
+    AppendBytes(&cmd, sizeof(cmd));
+    AppendBytes(compression_scratch_.data(), encoded_length);
+  } else {
+    // Uncompressed - write the values directly to the stream.
     cmd.encoding_format = MemoryEncodingFormat::kNone;
     cmd.encoded_length = kUncompressedLength;
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-    fwrite(gamma_ramp_256_entry_table, 1, k256EntryTableUncompressedLength, file_);
-    fwrite(gamma_ramp_pwl_rgb, 1, kPWLUncompressedLength, file_);
+    AppendBytes(&cmd, sizeof(cmd));
+    AppendBytes(gamma_ramp_256_entry_table, k256EntryTableUncompressedLength);
+    AppendBytes(gamma_ramp_pwl_rgb, kPWLUncompressedLength);
   }
 }
 
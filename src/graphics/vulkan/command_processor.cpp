@@ -85,6 +85,12 @@ void VulkanCommandProcessor::ClearCaches() {
   cache_clear_requested_ = true;
 }
 
+void VulkanCommandProcessor::InitializeShaderStorage(const std::filesystem::path& cache_root,
+                                                     uint32_t title_id, bool blocking) {
+  CommandProcessor::InitializeShaderStorage(cache_root, title_id, blocking);
+  pipeline_cache_->InitializeShaderStorage(cache_root, title_id, blocking);
+}
+
 void VulkanCommandProcessor::TracePlaybackWroteMemory(uint32_t base_ptr, uint32_t length) {
   shared_memory_->MemoryInvalidationCallback(base_ptr, length, true);
   primitive_processor_->MemoryInvalidationCallback(base_ptr, length, true);
@@ -1040,6 +1046,87 @@ void VulkanCommandProcessor::WriteRegister(uint32_t index, uint32_t value) {
   }
 }
 
+void VulkanCommandProcessor::OnRegisterRangeWritten(uint32_t first_index, uint32_t count) {
+  uint32_t last_index = first_index + count - 1;
+  if (frame_open_ && first_index <= XE_GPU_REG_SHADER_CONSTANT_511_W &&
+      last_index >= XE_GPU_REG_SHADER_CONSTANT_000_X) {
+    // Invalidate the float constant buffers only if constants actually used by
+    // the current shaders are in the range, like in WriteRegister, but with one
+    // check per 64 constants. Vertex float constants are 0...255, pixel
+    // constants are 256...511.
+    uint32_t float_constant_first =
+        (std::max(first_index, uint32_t(XE_GPU_REG_SHADER_CONSTANT_000_X)) -
+         XE_GPU_REG_SHADER_CONSTANT_000_X) >>
+        2;
+    uint32_t float_constant_last =
+        (std::min(last_index, uint32_t(XE_GPU_REG_SHADER_CONSTANT_511_W)) -
+         XE_GPU_REG_SHADER_CONSTANT_000_X) >>
+        2;
+    if (float_constant_first < 256 &&
+        (current_constant_buffers_up_to_date_ &
+         (UINT32_C(1) << SpirvShaderTranslator::kConstantBufferFloatVertex))) {
+      uint32_t vertex_last = std::min(float_constant_last, uint32_t(255));
+      for (uint32_t i = float_constant_first >> 6; i <= (vertex_last >> 6); ++i) {
+        uint64_t mask = UINT64_MAX;
+        if (i == (float_constant_first >> 6)) {
+          mask &= ~((uint64_t(1) << (float_constant_first & 63)) - 1);
+        }
+        if (i == (vertex_last >> 6) && (vertex_last & 63) != 63) {
+          mask &= (uint64_t(1) << ((vertex_last & 63) + 1)) - 1;
+        }
+        if (current_float_constant_map_vertex_[i] & mask) {
+          current_constant_buffers_up_to_date_ &=
+              ~(UINT32_C(1) << SpirvShaderTranslator::kConstantBufferFloatVertex);
+          break;
+        }
+      }
+    }
+    if (float_constant_last >= 256 &&
+        (current_constant_buffers_up_to_date_ &
+         (UINT32_C(1) << SpirvShaderTranslator::kConstantBufferFloatPixel))) {
+      uint32_t pixel_first = std::max(float_constant_first, uint32_t(256)) - 256;
+      uint32_t pixel_last = float_constant_last - 256;
+      for (uint32_t i = pixel_first >> 6; i <= (pixel_last >> 6); ++i) {
+        uint64_t mask = UINT64_MAX;
+        if (i == (pixel_first >> 6)) {
+          mask &= ~((uint64_t(1) << (pixel_first & 63)) - 1);
+        }
+        if (i == (pixel_last >> 6) && (pixel_last & 63) != 63) {
+          mask &= (uint64_t(1) << ((pixel_last & 63) + 1)) - 1;
+        }
+        if (current_float_constant_map_pixel_[i] & mask) {
+          current_constant_buffers_up_to_date_ &=
+              ~(UINT32_C(1) << SpirvShaderTranslator::kConstantBufferFloatPixel);
+          break;
+        }
+      }
+    }
+  }
+  if (first_index <= XE_GPU_REG_SHADER_CONSTANT_LOOP_31 &&
+      last_index >= XE_GPU_REG_SHADER_CONSTANT_BOOL_000_031) {
+    current_constant_buffers_up_to_date_ &=
+        ~(UINT32_C(1) << SpirvShaderTranslator::kConstantBufferBoolLoop);
+  }
+  if (first_index <= XE_GPU_REG_SHADER_CONSTANT_FETCH_31_5 &&
+      last_index >= XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0) {
+    current_constant_buffers_up_to_date_ &=
+        ~(UINT32_C(1) << SpirvShaderTranslator::kConstantBufferFetch);
+    if (texture_cache_) {
+      uint32_t fetch_constant_first =
+          (std::max(first_index, uint32_t(XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0)) -
+           XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0) /
+          6;
+      uint32_t fetch_constant_last =
+          (std::min(last_index, uint32_t(XE_GPU_REG_SHADER_CONSTANT_FETCH_31_5)) -
+           XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0) /
+          6;
+      for (uint32_t i = fetch_constant_first; i <= fetch_constant_last; ++i) {
+        texture_cache_->TextureFetchConstantWritten(i);
+      }
+    }
+  }
+}
+
 void VulkanCommandProcessor::SparseBindBuffer(VkBuffer buffer, uint32_t bind_count,
                                               const VkSparseMemoryBind* binds,
                                               VkPipelineStageFlags wait_stage_mask) {
@@ -1816,6 +1903,16 @@ void VulkanCommandProcessor::BindExternalGraphicsPipeline(VkPipeline pipeline,
     dynamic_stencil_reference_front_update_needed_ = true;
     dynamic_stencil_reference_back_update_needed_ = true;
   }
+  // External pipelines don't declare the VK_EXT_extended_dynamic_state state
+  // as dynamic, so binding them always invalidates it.
+  dynamic_cull_mode_update_needed_ = true;
+  dynamic_front_face_update_needed_ = true;
+  dynamic_depth_test_enable_update_needed_ = true;
+  dynamic_depth_write_enable_update_needed_ = true;
+  dynamic_depth_compare_op_update_needed_ = true;
+  dynamic_stencil_test_enable_update_needed_ = true;
+  dynamic_stencil_op_front_update_needed_ = true;
+  dynamic_stencil_op_back_update_needed_ = true;
   if (current_external_graphics_pipeline_ == pipeline) {
     return;
   }
@@ -2475,9 +2572,17 @@ bool VulkanCommandProcessor::BeginSubmission(bool is_guest_command) {
   // Check the fence - needed for all kinds of submissions (to reclaim transient
   // resources early) and specifically for frames (not to queue too many), and
   // await the availability of the current frame. Also check whether the device
-  // is still available, and whether the await was successful.
-  uint64_t await_submission =
-      is_opening_frame ? closed_frame_submissions_[frame_current_ % kMaxFramesInFlight] : 0;
+  // is still available, and whether the await was successful. The frame queue
+  // depth can be lowered below kMaxFramesInFlight (which only sizes the
+  // per-frame resource arrays) to trade CPU/GPU overlap for latency.
+  uint64_t await_submission = 0;
+  if (is_opening_frame) {
+    uint64_t max_queued_frames = uint64_t(
+        std::clamp(REXCVAR_GET(gpu_max_queued_frames), int32_t(1), int32_t(kMaxFramesInFlight)));
+    await_submission =
+        closed_frame_submissions_[(frame_current_ + kMaxFramesInFlight - max_queued_frames) %
+                                  kMaxFramesInFlight];
+  }
   CheckSubmissionFenceAndDeviceLoss(await_submission);
   if (device_lost_ || submission_completed_ < await_submission) {
     return false;
@@ -2515,6 +2620,14 @@ bool VulkanCommandProcessor::BeginSubmission(bool is_guest_command) {
     dynamic_stencil_write_mask_back_update_needed_ = true;
     dynamic_stencil_reference_front_update_needed_ = true;
     dynamic_stencil_reference_back_update_needed_ = true;
+    dynamic_cull_mode_update_needed_ = true;
+    dynamic_front_face_update_needed_ = true;
+    dynamic_depth_test_enable_update_needed_ = true;
+    dynamic_depth_write_enable_update_needed_ = true;
+    dynamic_depth_compare_op_update_needed_ = true;
+    dynamic_stencil_test_enable_update_needed_ = true;
+    dynamic_stencil_op_front_update_needed_ = true;
+    dynamic_stencil_op_back_update_needed_ = true;
     current_render_pass_ = VK_NULL_HANDLE;
     current_framebuffer_ = nullptr;
     current_guest_graphics_pipeline_ = VK_NULL_HANDLE;
@@ -2668,6 +2781,8 @@ bool VulkanCommandProcessor::EndSubmission(bool is_swap) {
 
     primitive_processor_->EndSubmission();
 
+    pipeline_cache_->EndSubmission();
+
     shared_memory_->EndSubmission();
 
     uniform_buffer_pool_->FlushWrites();
@@ -3080,8 +3195,143 @@ void VulkanCommandProcessor::UpdateDynamicState(const draw_util::ViewportInfo& v
     }
   }
 
-  // TODO(Triang3l): VK_EXT_extended_dynamic_state and
-  // VK_EXT_extended_dynamic_state2.
+  // State that is baked into pipeline objects on devices without
+  // VK_EXT_extended_dynamic_state - when the extendedDynamicState device
+  // property is available, the pipeline cache excludes it from the pipeline
+  // description, and it must be set dynamically instead.
+  if (GetVulkanDevice()->properties().extendedDynamicState) {
+    // Culling.
+    auto pa_su_sc_mode_cntl = regs.Get<reg::PA_SU_SC_MODE_CNTL>();
+    VkCullModeFlags cull_mode = VK_CULL_MODE_NONE;
+    VkFrontFace front_face = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    if (primitive_polygonal) {
+      if (pa_su_sc_mode_cntl.cull_front) {
+        cull_mode |= VK_CULL_MODE_FRONT_BIT;
+      }
+      if (pa_su_sc_mode_cntl.cull_back) {
+        cull_mode |= VK_CULL_MODE_BACK_BIT;
+      }
+      front_face = pa_su_sc_mode_cntl.face != 0 ? VK_FRONT_FACE_CLOCKWISE
+                                                : VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    }
+    dynamic_cull_mode_update_needed_ |= dynamic_cull_mode_ != cull_mode;
+    if (dynamic_cull_mode_update_needed_) {
+      dynamic_cull_mode_ = cull_mode;
+      deferred_command_buffer_.CmdVkSetCullMode(cull_mode);
+      dynamic_cull_mode_update_needed_ = false;
+    }
+    dynamic_front_face_update_needed_ |= dynamic_front_face_ != front_face;
+    if (dynamic_front_face_update_needed_) {
+      dynamic_front_face_ = front_face;
+      deferred_command_buffer_.CmdVkSetFrontFace(front_face);
+      dynamic_front_face_update_needed_ = false;
+    }
+
+    if (render_target_cache_->GetPath() == RenderTargetCache::Path::kHostRenderTargets) {
+      // Depth testing, mirroring the meaning the pipeline description fields
+      // have without extended dynamic state.
+      VkBool32 depth_test_enable = VK_FALSE;
+      VkBool32 depth_write_enable = VK_FALSE;
+      VkCompareOp depth_compare_op = VK_COMPARE_OP_ALWAYS;
+      if (normalized_depth_control.z_enable) {
+        depth_test_enable = VK_TRUE;
+        depth_write_enable = normalized_depth_control.z_write_enable ? VK_TRUE : VK_FALSE;
+        depth_compare_op =
+            VkCompareOp(uint32_t(VK_COMPARE_OP_NEVER) + uint32_t(normalized_depth_control.zfunc));
+      }
+      dynamic_depth_test_enable_update_needed_ |= dynamic_depth_test_enable_ != depth_test_enable;
+      if (dynamic_depth_test_enable_update_needed_) {
+        dynamic_depth_test_enable_ = depth_test_enable;
+        deferred_command_buffer_.CmdVkSetDepthTestEnable(depth_test_enable);
+        dynamic_depth_test_enable_update_needed_ = false;
+      }
+      dynamic_depth_write_enable_update_needed_ |=
+          dynamic_depth_write_enable_ != depth_write_enable;
+      if (dynamic_depth_write_enable_update_needed_) {
+        dynamic_depth_write_enable_ = depth_write_enable;
+        deferred_command_buffer_.CmdVkSetDepthWriteEnable(depth_write_enable);
+        dynamic_depth_write_enable_update_needed_ = false;
+      }
+      dynamic_depth_compare_op_update_needed_ |= dynamic_depth_compare_op_ != depth_compare_op;
+      if (dynamic_depth_compare_op_update_needed_) {
+        dynamic_depth_compare_op_ = depth_compare_op;
+        deferred_command_buffer_.CmdVkSetDepthCompareOp(depth_compare_op);
+        dynamic_depth_compare_op_update_needed_ = false;
+      }
+
+      // Stencil testing.
+      VkBool32 stencil_test_enable = normalized_depth_control.stencil_enable ? VK_TRUE : VK_FALSE;
+      dynamic_stencil_test_enable_update_needed_ |=
+          dynamic_stencil_test_enable_ != stencil_test_enable;
+      if (dynamic_stencil_test_enable_update_needed_) {
+        dynamic_stencil_test_enable_ = stencil_test_enable;
+        deferred_command_buffer_.CmdVkSetStencilTestEnable(stencil_test_enable);
+        dynamic_stencil_test_enable_update_needed_ = false;
+      }
+      // Like the stencil masks and references, the operations are updated only
+      // when stencil is actually enabled, to avoid changing the back face
+      // values when stencil is disabled and the primitive type is changed
+      // between polygonal and non-polygonal. Not setting them while the
+      // dynamic stencil test is disabled is also valid.
+      if (normalized_depth_control.stencil_enable) {
+        VkStencilOpState stencil_op_front = {};
+        stencil_op_front.failOp = VkStencilOp(uint32_t(VK_STENCIL_OP_KEEP) +
+                                              uint32_t(normalized_depth_control.stencilfail));
+        stencil_op_front.passOp = VkStencilOp(uint32_t(VK_STENCIL_OP_KEEP) +
+                                              uint32_t(normalized_depth_control.stencilzpass));
+        stencil_op_front.depthFailOp = VkStencilOp(
+            uint32_t(VK_STENCIL_OP_KEEP) + uint32_t(normalized_depth_control.stencilzfail));
+        stencil_op_front.compareOp = VkCompareOp(uint32_t(VK_COMPARE_OP_NEVER) +
+                                                 uint32_t(normalized_depth_control.stencilfunc));
+        VkStencilOpState stencil_op_back = stencil_op_front;
+        if (primitive_polygonal && normalized_depth_control.backface_enable) {
+          stencil_op_back.failOp = VkStencilOp(uint32_t(VK_STENCIL_OP_KEEP) +
+                                               uint32_t(normalized_depth_control.stencilfail_bf));
+          stencil_op_back.passOp = VkStencilOp(uint32_t(VK_STENCIL_OP_KEEP) +
+                                               uint32_t(normalized_depth_control.stencilzpass_bf));
+          stencil_op_back.depthFailOp = VkStencilOp(
+              uint32_t(VK_STENCIL_OP_KEEP) + uint32_t(normalized_depth_control.stencilzfail_bf));
+          stencil_op_back.compareOp = VkCompareOp(
+              uint32_t(VK_COMPARE_OP_NEVER) + uint32_t(normalized_depth_control.stencilfunc_bf));
+        }
+        const auto stencil_op_differs = [](const VkStencilOpState& a, const VkStencilOpState& b) {
+          return a.failOp != b.failOp || a.passOp != b.passOp || a.depthFailOp != b.depthFailOp ||
+                 a.compareOp != b.compareOp;
+        };
+        dynamic_stencil_op_front_update_needed_ |=
+            stencil_op_differs(dynamic_stencil_op_front_, stencil_op_front);
+        dynamic_stencil_op_front_ = stencil_op_front;
+        dynamic_stencil_op_back_update_needed_ |=
+            stencil_op_differs(dynamic_stencil_op_back_, stencil_op_back);
+        dynamic_stencil_op_back_ = stencil_op_back;
+        if (dynamic_stencil_op_front_update_needed_ || dynamic_stencil_op_back_update_needed_) {
+          if (!stencil_op_differs(dynamic_stencil_op_front_, dynamic_stencil_op_back_)) {
+            deferred_command_buffer_.CmdVkSetStencilOp(
+                VK_STENCIL_FACE_FRONT_AND_BACK, dynamic_stencil_op_front_.failOp,
+                dynamic_stencil_op_front_.passOp, dynamic_stencil_op_front_.depthFailOp,
+                dynamic_stencil_op_front_.compareOp);
+          } else {
+            if (dynamic_stencil_op_front_update_needed_) {
+              deferred_command_buffer_.CmdVkSetStencilOp(
+                  VK_STENCIL_FACE_FRONT_BIT, dynamic_stencil_op_front_.failOp,
+                  dynamic_stencil_op_front_.passOp, dynamic_stencil_op_front_.depthFailOp,
+                  dynamic_stencil_op_front_.compareOp);
+            }
+            if (dynamic_stencil_op_back_update_needed_) {
+              deferred_command_buffer_.CmdVkSetStencilOp(
+                  VK_STENCIL_FACE_BACK_BIT, dynamic_stencil_op_back_.failOp,
+                  dynamic_stencil_op_back_.passOp, dynamic_stencil_op_back_.depthFailOp,
+                  dynamic_stencil_op_back_.compareOp);
+            }
+          }
+          dynamic_stencil_op_front_update_needed_ = false;
+          dynamic_stencil_op_back_update_needed_ = false;
+        }
+      }
+    }
+  }
+
+  // TODO(Triang3l): VK_EXT_extended_dynamic_state2 for primitive restart.
 }
 
 void VulkanCommandProcessor::UpdateSystemConstantValues(
@@ -9,6 +9,7 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -29,7 +30,10 @@ DeferredCommandBuffer::DeferredCommandBuffer(const VulkanCommandProcessor& comma
 }
 
 void DeferredCommandBuffer::Reset() {
-  command_stream_.clear();
+  // Keep the vector at its high-water size - clearing and re-growing it every
+  // frame would zero-initialize the whole stream again in resize before the
+  // actual commands are written over it.
+  command_stream_used_ = 0;
 }
 
 void DeferredCommandBuffer::Execute(VkCommandBuffer command_buffer) {
@@ -40,7 +44,7 @@ void DeferredCommandBuffer::Execute(VkCommandBuffer command_buffer) {
   const ui::vulkan::VulkanDevice::Functions& dfn =
       command_processor_.GetVulkanDevice()->functions();
   const uintmax_t* stream = command_stream_.data();
-  size_t stream_remaining = command_stream_.size();
+  size_t stream_remaining = command_stream_used_;
   while (stream_remaining) {
     const CommandHeader& header = *reinterpret_cast<const CommandHeader*>(stream);
     stream += kCommandHeaderSizeElements;
@@ -215,12 +219,37 @@ void DeferredCommandBuffer::Execute(VkCommandBuffer command_buffer) {
         dfn.vkCmdSetBlendConstants(command_buffer, args.blend_constants);
       } break;
 
+      case Command::kVkSetCullMode: {
+        auto& args = *reinterpret_cast<const ArgsVkSetCullMode*>(stream);
+        dfn.vkCmdSetCullMode(command_buffer, args.cull_mode);
+      } break;
+
       case Command::kVkSetDepthBias: {
         auto& args = *reinterpret_cast<const ArgsVkSetDepthBias*>(stream);
         dfn.vkCmdSetDepthBias(command_buffer, args.depth_bias_constant_factor,
                               args.depth_bias_clamp, args.depth_bias_slope_factor);
       } break;
 
+      case Command::kVkSetDepthCompareOp: {
+        auto& args = *reinterpret_cast<const ArgsVkSetDepthCompareOp*>(stream);
+        dfn.vkCmdSetDepthCompareOp(command_buffer, args.compare_op);
+      } break;
+
+      case Command::kVkSetDepthTestEnable: {
+        auto& args = *reinterpret_cast<const ArgsSetEnable*>(stream);
+        dfn.vkCmdSetDepthTestEnable(command_buffer, args.enable);
+      } break;
+
+      case Command::kVkSetDepthWriteEnable: {
+        auto& args = *reinterpret_cast<const ArgsSetEnable*>(stream);
+        dfn.vkCmdSetDepthWriteEnable(command_buffer, args.enable);
+      } break;
+
+      case Command::kVkSetFrontFace: {
+        auto& args = *reinterpret_cast<const ArgsVkSetFrontFace*>(stream);
+        dfn.vkCmdSetFrontFace(command_buffer, args.front_face);
+      } break;
+
       case Command::kVkSetScissor: {
         auto& args = *reinterpret_cast<const ArgsVkSetScissor*>(stream);
         dfn.vkCmdSetScissor(command_buffer, args.first_scissor, args.scissor_count,
@@ -234,11 +263,22 @@ void DeferredCommandBuffer::Execute(VkCommandBuffer command_buffer) {
         dfn.vkCmdSetStencilCompareMask(command_buffer, args.face_mask, args.mask_reference);
       } break;
 
+      case Command::kVkSetStencilOp: {
+        auto& args = *reinterpret_cast<const ArgsVkSetStencilOp*>(stream);
+        dfn.vkCmdSetStencilOp(command_buffer, args.face_mask, args.fail_op, args.pass_op,
+                              args.depth_fail_op, args.compare_op);
+      } break;
+
       case Command::kVkSetStencilReference: {
         auto& args = *reinterpret_cast<const ArgsSetStencilMaskReference*>(stream);
         dfn.vkCmdSetStencilReference(command_buffer, args.face_mask, args.mask_reference);
       } break;
 
+      case Command::kVkSetStencilTestEnable: {
+        auto& args = *reinterpret_cast<const ArgsSetEnable*>(stream);
+        dfn.vkCmdSetStencilTestEnable(command_buffer, args.enable);
+      } break;
+
       case Command::kVkSetStencilWriteMask: {
         auto& args = *reinterpret_cast<const ArgsSetStencilMaskReference*>(stream);
         dfn.vkCmdSetStencilWriteMask(command_buffer, args.face_mask, args.mask_reference);
@@ -313,8 +353,11 @@ void DeferredCommandBuffer::CmdVkPipelineBarrier(
 void* DeferredCommandBuffer::WriteCommand(Command command, size_t arguments_size_bytes) {
   size_t arguments_size_elements =
       (arguments_size_bytes + sizeof(uintmax_t) - 1) / sizeof(uintmax_t);
-  size_t offset = command_stream_.size();
-  command_stream_.resize(offset + kCommandHeaderSizeElements + arguments_size_elements);
+  size_t offset = command_stream_used_;
+  command_stream_used_ += kCommandHeaderSizeElements + arguments_size_elements;
+  if (command_stream_used_ > command_stream_.size()) {
+    command_stream_.resize(std::max(command_stream_used_, command_stream_.size() * 2));
+  }
   CommandHeader& header = *reinterpret_cast<CommandHeader*>(command_stream_.data() + offset);
   header.command = command;
   header.arguments_size_elements = uint32_t(arguments_size_elements);
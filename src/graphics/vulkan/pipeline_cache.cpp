@@ -11,16 +11,22 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <utility>
 #include <vector>
 
 #include <fmt/format.h>
 
 #include <rex/assert.h>
+#include <rex/chrono/clock.h>
 #include <rex/dbg.h>
+#include <rex/filesystem.h>
 #include <rex/graphics/flags.h>
 #include <rex/graphics/pipeline/shader/spirv_builder.h>
 #include <rex/graphics/pipeline/shader/spirv_translator.h>
@@ -34,6 +40,8 @@
 #include <rex/hash.h>
 #include <rex/logging.h>
 #include <rex/math.h>
+#include <rex/memory.h>
+#include <rex/string.h>
 #include <rex/ui/vulkan/util.h>
 
 namespace rex::graphics::vulkan {
@@ -81,11 +89,17 @@ bool VulkanPipelineCache::Initialize() {
 }
 
 void VulkanPipelineCache::Shutdown() {
+  ShutdownShaderStorage();
+
   const ui::vulkan::VulkanDevice* const vulkan_device = command_processor_.GetVulkanDevice();
   const ui::vulkan::VulkanDevice::Functions& dfn = vulkan_device->functions();
   const VkDevice device = vulkan_device->device();
 
   // Destroy all pipelines.
+  // The unique pipeline object count measures how much the baked state is
+  // multiplying the key space - extended dynamic state adoption should keep it
+  // low, so report it for comparison between devices and titles.
+  REXGPU_INFO("VulkanPipelineCache: {} unique pipeline objects", pipelines_.size());
   last_pipeline_ = nullptr;
   for (const auto& pipeline_pair : pipelines_) {
     if (pipeline_pair.second.pipeline != VK_NULL_HANDLE) {
@@ -116,10 +130,576 @@ void VulkanPipelineCache::Shutdown() {
   shader_translator_.reset();
 }
 
+void VulkanPipelineCache::InitializeShaderStorage(const std::filesystem::path& cache_root,
+                                                  uint32_t title_id, bool blocking) {
+  ShutdownShaderStorage();
+
+  auto shader_storage_root = cache_root / "shaders";
+  // For files that can be moved between different hosts - the guest ucode
+  // storage is shared with the Direct3D 12 backend, the pipeline description
+  // storage is Vulkan-specific.
+  auto shader_storage_shareable_root = shader_storage_root / "shareable";
+  if (!std::filesystem::exists(shader_storage_shareable_root)) {
+    if (!std::filesystem::create_directories(shader_storage_shareable_root)) {
+      REXGPU_ERROR(
+          "Failed to create the shareable shader storage directory, persistent "
+          "shader storage will be disabled: {}",
+          rex::path_to_utf8(shader_storage_shareable_root));
+      return;
+    }
+  }
+
+  bool edram_fragment_shader_interlock =
+      render_target_cache_.GetPath() == RenderTargetCache::Path::kPixelShaderInterlock;
+
+  // Initialize the pipeline storage stream - read pipeline descriptions and
+  // collect used shader modifications to translate.
+  std::vector<PipelineStoredDescription> pipeline_stored_descriptions;
+  // <Shader hash, modification bits>.
+  std::set<std::pair<uint64_t, uint64_t>> shader_translations_needed;
+  auto pipeline_storage_file_path =
+      shader_storage_shareable_root /
+      fmt::format("{:08X}.{}.vk.xpso", title_id, edram_fragment_shader_interlock ? "fsi" : "rtv");
+  pipeline_storage_file_ = rex::filesystem::OpenFile(pipeline_storage_file_path, "a+b");
+  if (!pipeline_storage_file_) {
+    REXGPU_ERROR(
+        "Failed to open the Vulkan pipeline description storage file for "
+        "writing, persistent shader storage will be disabled: {}",
+        rex::path_to_utf8(pipeline_storage_file_path));
+    return;
+  }
+  pipeline_storage_file_flush_needed_ = false;
+  // 'XEPS'.
+  const uint32_t pipeline_storage_magic = 0x53504558;
+  // 'VKFS' or 'VKRT'.
+  const uint32_t pipeline_storage_magic_api =
+      edram_fragment_shader_interlock ? 0x53464B56 : 0x54524B56;
+  const uint32_t pipeline_storage_version_swapped = rex::byte_swap(std::max(
+      PipelineDescription::kVersion, uint32_t(SpirvShaderTranslator::Modification::kVersion)));
+  struct {
+    uint32_t magic;
+    uint32_t magic_api;
+    uint32_t version_swapped;
+  } pipeline_storage_file_header;
+  if (fread(&pipeline_storage_file_header, sizeof(pipeline_storage_file_header), 1,
+            pipeline_storage_file_) &&
+      pipeline_storage_file_header.magic == pipeline_storage_magic &&
+      pipeline_storage_file_header.magic_api == pipeline_storage_magic_api &&
+      pipeline_storage_file_header.version_swapped == pipeline_storage_version_swapped) {
+    rex::filesystem::Seek(pipeline_storage_file_, 0, SEEK_END);
+    int64_t pipeline_storage_told_end = rex::filesystem::Tell(pipeline_storage_file_);
+    size_t pipeline_storage_told_count =
+        size_t(pipeline_storage_told_end >= int64_t(sizeof(pipeline_storage_file_header))
+                   ? (uint64_t(pipeline_storage_told_end) - sizeof(pipeline_storage_file_header)) /
+                         sizeof(PipelineStoredDescription)
+                   : 0);
+    if (pipeline_storage_told_count &&
+        rex::filesystem::Seek(pipeline_storage_file_, int64_t(sizeof(pipeline_storage_file_header)),
+                              SEEK_SET)) {
+      pipeline_stored_descriptions.resize(pipeline_storage_told_count);
+      pipeline_stored_descriptions.resize(
+          fread(pipeline_stored_descriptions.data(), sizeof(PipelineStoredDescription),
+                pipeline_storage_told_count, pipeline_storage_file_));
+      size_t pipeline_storage_read_count = pipeline_stored_descriptions.size();
+      for (size_t i = 0; i < pipeline_storage_read_count; ++i) {
+        const PipelineStoredDescription& pipeline_stored_description =
+            pipeline_stored_descriptions[i];
+        // Validate file integrity, stop and truncate the stream if data is
+        // corrupted.
+        if (XXH3_64bits(&pipeline_stored_description.description,
+                        sizeof(pipeline_stored_description.description)) !=
+            pipeline_stored_description.description_hash) {
+          pipeline_stored_descriptions.resize(i);
+          break;
+        }
+        // Mark the shader modifications as needed for translation.
+        shader_translations_needed.emplace(
+            pipeline_stored_description.description.vertex_shader_hash,
+            pipeline_stored_description.description.vertex_shader_modification);
+        if (pipeline_stored_description.description.pixel_shader_hash) {
+          shader_translations_needed.emplace(
+              pipeline_stored_description.description.pixel_shader_hash,
+              pipeline_stored_description.description.pixel_shader_modification);
+        }
+      }
+    }
+  }
+
+  size_t logical_processor_count = rex::thread::logical_processor_count();
+  if (!logical_processor_count) {
+    // Pick some reasonable amount if couldn't determine the number of cores.
+    logical_processor_count = 6;
+  }
+
+  // Initialize the Xenos shader storage stream.
+  uint64_t shader_storage_initialization_start = rex::chrono::Clock::QueryHostTickCount();
+  auto shader_storage_file_path =
+      shader_storage_shareable_root / fmt::format("{:08X}.xsh", title_id);
+  shader_storage_file_ = rex::filesystem::OpenFile(shader_storage_file_path, "a+b");
+  if (!shader_storage_file_) {
+    REXGPU_ERROR(
+        "Failed to open the guest shader storage file for writing, persistent "
+        "shader storage will be disabled: {}",
+        rex::path_to_utf8(shader_storage_file_path));
+    fclose(pipeline_storage_file_);
+    pipeline_storage_file_ = nullptr;
+    return;
+  }
+  ++shader_storage_index_;
+  shader_storage_file_flush_needed_ = false;
+  struct {
+    uint32_t magic;
+    uint32_t version_swapped;
+  } shader_storage_file_header;
+  // 'XESH'.
+  const uint32_t shader_storage_magic = 0x48534558;
+  if (fread(&shader_storage_file_header, sizeof(shader_storage_file_header), 1,
+            shader_storage_file_) &&
+      shader_storage_file_header.magic == shader_storage_magic &&
+      rex::byte_swap(shader_storage_file_header.version_swapped) == ShaderStoredHeader::kVersion) {
+    uint64_t shader_storage_valid_bytes = sizeof(shader_storage_file_header);
+    // Load and translate shaders written by previous runs until the end of the
+    // file or until a corrupted one is detected.
+    ShaderStoredHeader shader_header;
+    std::vector<uint32_t> ucode_dwords;
+    ucode_dwords.reserve(0xFFFF);
+    size_t shaders_translated = 0;
+
+    // Threads overlapping file reading.
+    std::mutex shaders_translation_thread_mutex;
+    std::condition_variable shaders_translation_thread_cond;
+    std::deque<VulkanShader*> shaders_to_translate;
+    size_t shader_translation_threads_busy = 0;
+    bool shader_translation_threads_shutdown = false;
+    std::mutex shaders_failed_to_translate_mutex;
+    std::vector<VulkanShader::VulkanTranslation*> shaders_failed_to_translate;
+    auto shader_translation_thread_function = [&]() {
+      const ui::vulkan::VulkanDevice* const vulkan_device = command_processor_.GetVulkanDevice();
+      string::StringBuffer ucode_disasm_buffer;
+      SpirvShaderTranslator translator(SpirvShaderTranslator::Features(vulkan_device),
+                                       render_target_cache_.msaa_2x_attachments_supported(),
+                                       render_target_cache_.msaa_2x_no_attachments_supported(),
+                                       edram_fragment_shader_interlock);
+      for (;;) {
+        VulkanShader* shader_to_translate;
+        for (;;) {
+          std::unique_lock<std::mutex> lock(shaders_translation_thread_mutex);
+          if (shaders_to_translate.empty()) {
+            if (shader_translation_threads_shutdown) {
+              return;
+            }
+            shaders_translation_thread_cond.wait(lock);
+            continue;
+          }
+          shader_to_translate = shaders_to_translate.front();
+          shaders_to_translate.pop_front();
+          ++shader_translation_threads_busy;
+          break;
+        }
+        shader_to_translate->AnalyzeUcode(ucode_disasm_buffer);
+        // Translate each needed modification on this thread after performing
+        // modification-independent analysis of the whole shader.
+        uint64_t ucode_data_hash = shader_to_translate->ucode_data_hash();
+        for (auto modification_it = shader_translations_needed.lower_bound(
+                 std::make_pair(ucode_data_hash, uint64_t(0)));
+             modification_it != shader_translations_needed.end() &&
+             modification_it->first == ucode_data_hash;
+             ++modification_it) {
+          VulkanShader::VulkanTranslation* translation =
+              static_cast<VulkanShader::VulkanTranslation*>(
+                  shader_to_translate->GetOrCreateTranslation(modification_it->second));
+          // Only try (and delete in case of failure) if it's a new translation.
+          // If it's a shader previously encountered in the game, translation of
+          // which has failed, and the shader storage is loaded later, keep it
+          // this way not to try to translate it again.
+          if (!translation->is_translated() &&
+              !TranslateAnalyzedShader(translator, *translation)) {
+            std::lock_guard<std::mutex> lock(shaders_failed_to_translate_mutex);
+            shaders_failed_to_translate.push_back(translation);
+          }
+        }
+        {
+          std::lock_guard<std::mutex> lock(shaders_translation_thread_mutex);
+          --shader_translation_threads_busy;
+        }
+      }
+    };
+    std::vector<std::unique_ptr<rex::thread::Thread>> shader_translation_threads;
+
+    while (true) {
+      if (!fread(&shader_header, sizeof(shader_header), 1, shader_storage_file_)) {
+        break;
+      }
+      size_t ucode_byte_count = shader_header.ucode_dword_count * sizeof(uint32_t);
+      ucode_dwords.resize(shader_header.ucode_dword_count);
+      if (shader_header.ucode_dword_count &&
+          !fread(ucode_dwords.data(), ucode_byte_count, 1, shader_storage_file_)) {
+        break;
+      }
+      uint64_t ucode_data_hash = XXH3_64bits(ucode_dwords.data(), ucode_byte_count);
+      if (shader_header.ucode_data_hash != ucode_data_hash) {
+        // Validation failed.
+        break;
+      }
+      shader_storage_valid_bytes += sizeof(shader_header) + ucode_byte_count;
+      VulkanShader* shader = LoadShader(shader_header.type, ucode_dwords.data(),
+                                        shader_header.ucode_dword_count, ucode_data_hash);
+      if (shader->ucode_storage_index() == shader_storage_index_) {
+        // Appeared twice in this file for some reason - skip, otherwise race
+        // condition will be caused by translating twice in parallel.
+        continue;
+      }
+      // Loaded from the current storage - don't write again.
+      shader->set_ucode_storage_index(shader_storage_index_);
+      // Create new threads if the currently existing threads can't keep up
+      // with file reading, but not more than the number of logical processors
+      // minus one.
+      size_t shader_translation_threads_needed;
+      {
+        std::lock_guard<std::mutex> lock(shaders_translation_thread_mutex);
+        shader_translation_threads_needed =
+            std::min(shader_translation_threads_busy + shaders_to_translate.size() + size_t(1),
+                     logical_processor_count - size_t(1));
+      }
+      while (shader_translation_threads.size() < shader_translation_threads_needed) {
+        auto thread = rex::thread::Thread::Create({}, shader_translation_thread_function);
+        assert_not_null(thread);
+        thread->set_name("Shader Translation");
+        shader_translation_threads.push_back(std::move(thread));
+      }
+      // Request ucode information gathering and translation of all the needed
+      // shaders.
+      {
+        std::lock_guard<std::mutex> lock(shaders_translation_thread_mutex);
+        shaders_to_translate.push_back(shader);
+      }
+      shaders_translation_thread_cond.notify_one();
+      ++shaders_translated;
+    }
+    if (!shader_translation_threads.empty()) {
+      {
+        std::lock_guard<std::mutex> lock(shaders_translation_thread_mutex);
+        shader_translation_threads_shutdown = true;
+      }
+      shaders_translation_thread_cond.notify_all();
+      for (auto& shader_translation_thread : shader_translation_threads) {
+        rex::thread::Wait(shader_translation_thread.get(), false);
+      }
+      shader_translation_threads.clear();
+      for (VulkanShader::VulkanTranslation* translation : shaders_failed_to_translate) {
+        VulkanShader* shader = static_cast<VulkanShader*>(&translation->shader());
+        shader->DestroyTranslation(translation->modification());
+        if (shader->translations().empty()) {
+          shaders_.erase(shader->ucode_data_hash());
+          delete shader;
+        }
+      }
+    }
+    REXGPU_INFO("Translated {} shaders from the storage in {} milliseconds", shaders_translated,
+                (rex::chrono::Clock::QueryHostTickCount() - shader_storage_initialization_start) *
+                    1000 / rex::chrono::Clock::QueryHostTickFrequency());
+    rex::filesystem::TruncateStdioFile(shader_storage_file_, shader_storage_valid_bytes);
+  } else {
+    rex::filesystem::TruncateStdioFile(shader_storage_file_, 0);
+    shader_storage_file_header.magic = shader_storage_magic;
+    shader_storage_file_header.version_swapped = rex::byte_swap(ShaderStoredHeader::kVersion);
+    fwrite(&shader_storage_file_header, sizeof(shader_storage_file_header), 1,
+           shader_storage_file_);
+  }
+
+  // Create the pipelines.
+  if (!pipeline_stored_descriptions.empty()) {
+    uint64_t pipeline_creation_start = rex::chrono::Clock::QueryHostTickCount();
+
+    // Gather the creation arguments on this thread - pipeline layouts, render
+    // passes and geometry shaders are created on demand and cached, and none
+    // of those caches are safe to touch from the workers.
+    std::vector<PipelineCreationArguments> pipelines_to_create;
+    pipelines_to_create.reserve(pipeline_stored_descriptions.size());
+    for (const PipelineStoredDescription& pipeline_stored_description :
+         pipeline_stored_descriptions) {
+      const PipelineDescription& description = pipeline_stored_description.description;
+      // Skip pipelines requiring unsupported device features (to keep the
+      // cache files mostly shareable across devices).
+      if (!ArePipelineRequirementsMet(description)) {
+        continue;
+      }
+      // Skip already known pipelines.
+      if (pipelines_.find(description) != pipelines_.end()) {
+        continue;
+      }
+      auto vertex_shader_it = shaders_.find(description.vertex_shader_hash);
+      if (vertex_shader_it == shaders_.end()) {
+        continue;
+      }
+      VulkanShader* vertex_shader = vertex_shader_it->second;
+      auto vertex_translation = static_cast<VulkanShader::VulkanTranslation*>(
+          vertex_shader->GetTranslation(description.vertex_shader_modification));
+      if (!vertex_translation || !vertex_translation->is_translated() ||
+          !vertex_translation->is_valid()) {
+        continue;
+      }
+      VulkanShader* pixel_shader = nullptr;
+      VulkanShader::VulkanTranslation* pixel_translation = nullptr;
+      if (description.pixel_shader_hash) {
+        auto pixel_shader_it = shaders_.find(description.pixel_shader_hash);
+        if (pixel_shader_it == shaders_.end()) {
+          continue;
+        }
+        pixel_shader = pixel_shader_it->second;
+        pixel_translation = static_cast<VulkanShader::VulkanTranslation*>(
+            pixel_shader->GetTranslation(description.pixel_shader_modification));
+        if (!pixel_translation || !pixel_translation->is_translated() ||
+            !pixel_translation->is_valid()) {
+          continue;
+        }
+      }
+      const PipelineLayoutProvider* pipeline_layout = command_processor_.GetPipelineLayout(
+          pixel_shader ? pixel_shader->GetTextureBindingsAfterTranslation().size() : 0,
+          pixel_shader ? pixel_shader->GetSamplerBindingsAfterTranslation().size() : 0,
+          vertex_shader->GetTextureBindingsAfterTranslation().size(),
+          vertex_shader->GetSamplerBindingsAfterTranslation().size());
+      if (!pipeline_layout) {
+        continue;
+      }
+      VkShaderModule geometry_shader = VK_NULL_HANDLE;
+      GeometryShaderKey geometry_shader_key;
+      if (GetGeometryShaderKey(
+              description.geometry_shader,
+              SpirvShaderTranslator::Modification(description.vertex_shader_modification),
+              SpirvShaderTranslator::Modification(description.pixel_shader_modification),
+              geometry_shader_key)) {
+        geometry_shader = GetGeometryShader(geometry_shader_key);
+        if (geometry_shader == VK_NULL_HANDLE) {
+          continue;
+        }
+      }
+      VkRenderPass render_pass =
+          edram_fragment_shader_interlock
+              ? render_target_cache_.GetFragmentShaderInterlockRenderPass()
+              : render_target_cache_.GetHostRenderTargetsRenderPass(description.render_pass_key);
+      if (render_pass == VK_NULL_HANDLE) {
+        continue;
+      }
+      PipelineCreationArguments creation_arguments;
+      creation_arguments.pipeline =
+          &*pipelines_.emplace(description, Pipeline(pipeline_layout)).first;
+      creation_arguments.vertex_shader = vertex_translation;
+      creation_arguments.pixel_shader = pixel_translation;
+      creation_arguments.geometry_shader = geometry_shader;
+      creation_arguments.render_pass = render_pass;
+      pipelines_to_create.push_back(creation_arguments);
+    }
+
+    // Create the VkPipeline objects on all cores - EnsurePipelineCreated can
+    // be called from multiple threads once the arguments are fully set up.
+    if (!pipelines_to_create.empty()) {
+      std::atomic<size_t> pipeline_to_create_index{0};
+      std::mutex pipelines_failed_to_create_mutex;
+      std::vector<PipelineDescription> pipelines_failed_to_create;
+      auto pipeline_creation_thread_function = [&]() {
+        for (;;) {
+          size_t index = pipeline_to_create_index.fetch_add(1, std::memory_order_relaxed);
+          if (index >= pipelines_to_create.size()) {
+            break;
+          }
+          const PipelineCreationArguments& creation_arguments = pipelines_to_create[index];
+          if (!EnsurePipelineCreated(creation_arguments)) {
+            std::lock_guard<std::mutex> lock(pipelines_failed_to_create_mutex);
+            pipelines_failed_to_create.push_back(creation_arguments.pipeline->first);
+          }
+        }
+      };
+      size_t pipeline_creation_thread_count =
+          std::min(pipelines_to_create.size(), logical_processor_count);
+      std::vector<std::unique_ptr<rex::thread::Thread>> pipeline_creation_threads;
+      for (size_t i = 1; i < pipeline_creation_thread_count; ++i) {
+        auto thread = rex::thread::Thread::Create({}, pipeline_creation_thread_function);
+        assert_not_null(thread);
+        thread->set_name("Pipeline Creation");
+        pipeline_creation_threads.push_back(std::move(thread));
+      }
+      // Also use this thread.
+      pipeline_creation_thread_function();
+      for (auto& pipeline_creation_thread : pipeline_creation_threads) {
+        rex::thread::Wait(pipeline_creation_thread.get(), false);
+      }
+      pipeline_creation_threads.clear();
+      // Drop entries whose creation failed so the draw path retries (and
+      // reports) instead of binding a null pipeline.
+      for (const PipelineDescription& description : pipelines_failed_to_create) {
+        pipelines_.erase(description);
+      }
+
+      REXGPU_INFO(
+          "Created {} graphics pipelines (not including reading the "
+          "descriptions) from the storage in {} milliseconds",
+          pipelines_to_create.size() - pipelines_failed_to_create.size(),
+          (rex::chrono::Clock::QueryHostTickCount() - pipeline_creation_start) * 1000 /
+              rex::chrono::Clock::QueryHostTickFrequency());
+    }
+
+    // If any pipeline descriptions were corrupted (or the whole file has
+    // excess bytes in the end), truncate to the last valid pipeline
+    // description.
+    rex::filesystem::TruncateStdioFile(
+        pipeline_storage_file_,
+        uint64_t(sizeof(pipeline_storage_file_header) +
+                 sizeof(PipelineStoredDescription) * pipeline_stored_descriptions.size()));
+  } else {
+    rex::filesystem::TruncateStdioFile(pipeline_storage_file_, 0);
+    pipeline_storage_file_header.magic = pipeline_storage_magic;
+    pipeline_storage_file_header.magic_api = pipeline_storage_magic_api;
+    pipeline_storage_file_header.version_swapped = pipeline_storage_version_swapped;
+    fwrite(&pipeline_storage_file_header, sizeof(pipeline_storage_file_header), 1,
+           pipeline_storage_file_);
+  }
+
+  shader_storage_cache_root_ = cache_root;
+  shader_storage_title_id_ = title_id;
+
+  // Start the storage writing thread.
+  storage_write_flush_shaders_ = false;
+  storage_write_flush_pipelines_ = false;
+  storage_write_thread_shutdown_ = false;
+  storage_write_thread_ = rex::thread::Thread::Create({}, [this]() { StorageWriteThread(); });
+  assert_not_null(storage_write_thread_);
+  storage_write_thread_->set_name("Vulkan Storage writer");
+}
+
+void VulkanPipelineCache::ShutdownShaderStorage() {
+  if (storage_write_thread_) {
+    {
+      std::lock_guard<std::mutex> lock(storage_write_request_lock_);
+      storage_write_thread_shutdown_ = true;
+    }
+    storage_write_request_cond_.notify_all();
+    rex::thread::Wait(storage_write_thread_.get(), false);
+    storage_write_thread_.reset();
+  }
+  storage_write_shader_queue_.clear();
+  storage_write_pipeline_queue_.clear();
+
+  if (pipeline_storage_file_) {
+    fclose(pipeline_storage_file_);
+    pipeline_storage_file_ = nullptr;
+    pipeline_storage_file_flush_needed_ = false;
+  }
+
+  if (shader_storage_file_) {
+    fclose(shader_storage_file_);
+    shader_storage_file_ = nullptr;
+    shader_storage_file_flush_needed_ = false;
+  }
+
+  shader_storage_cache_root_.clear();
+  shader_storage_title_id_ = 0;
+}
+
+void VulkanPipelineCache::EndSubmission() {
+  if (shader_storage_file_flush_needed_ || pipeline_storage_file_flush_needed_) {
+    {
+      std::lock_guard<std::mutex> lock(storage_write_request_lock_);
+      if (shader_storage_file_flush_needed_) {
+        storage_write_flush_shaders_ = true;
+      }
+      if (pipeline_storage_file_flush_needed_) {
+        storage_write_flush_pipelines_ = true;
+      }
+    }
+    storage_write_request_cond_.notify_one();
+    shader_storage_file_flush_needed_ = false;
+    pipeline_storage_file_flush_needed_ = false;
+  }
+}
+
+void VulkanPipelineCache::StorageWriteThread() {
+  ShaderStoredHeader shader_header;
+  // Don't leak anything in unused bits.
+  std::memset(&shader_header, 0, sizeof(shader_header));
+
+  std::vector<uint32_t> ucode_guest_endian;
+  ucode_guest_endian.reserve(0xFFFF);
+
+  bool flush_shaders = false;
+  bool flush_pipelines = false;
+
+  while (true) {
+    if (flush_shaders) {
+      flush_shaders = false;
+      assert_not_null(shader_storage_file_);
+      fflush(shader_storage_file_);
+    }
+    if (flush_pipelines) {
+      flush_pipelines = false;
+      assert_not_null(pipeline_storage_file_);
+      fflush(pipeline_storage_file_);
+    }
+
+    const Shader* shader = nullptr;
+    PipelineStoredDescription pipeline_description;
+    bool write_pipeline = false;
+    {
+      std::unique_lock<std::mutex> lock(storage_write_request_lock_);
+      if (storage_write_thread_shutdown_) {
+        return;
+      }
+      if (!storage_write_shader_queue_.empty()) {
+        shader = storage_write_shader_queue_.front();
+        storage_write_shader_queue_.pop_front();
+      } else if (storage_write_flush_shaders_) {
+        storage_write_flush_shaders_ = false;
+        flush_shaders = true;
+      }
+      if (!storage_write_pipeline_queue_.empty()) {
+        std::memcpy(&pipeline_description, &storage_write_pipeline_queue_.front(),
+                    sizeof(pipeline_description));
+        storage_write_pipeline_queue_.pop_front();
+        write_pipeline = true;
+      } else if (storage_write_flush_pipelines_) {
+        storage_write_flush_pipelines_ = false;
+        flush_pipelines = true;
+      }
+      if (!shader && !write_pipeline) {
+        storage_write_request_cond_.wait(lock);
+        continue;
+      }
+    }
+
+    if (shader) {
+      shader_header.ucode_data_hash = shader->ucode_data_hash();
+      shader_header.ucode_dword_count = shader->ucode_dword_count();
+      shader_header.type = shader->type();
+      assert_not_null(shader_storage_file_);
+      fwrite(&shader_header, sizeof(shader_header), 1, shader_storage_file_);
+      if (shader_header.ucode_dword_count) {
+        ucode_guest_endian.resize(shader_header.ucode_dword_count);
+        // Need to swap because the hash is calculated for the shader with guest
+        // endianness.
+        memory::copy_and_swap(ucode_guest_endian.data(), shader->ucode_dwords(),
+                              shader_header.ucode_dword_count);
+        fwrite(ucode_guest_endian.data(), shader_header.ucode_dword_count * sizeof(uint32_t), 1,
+               shader_storage_file_);
+      }
+    }
+
+    if (write_pipeline) {
+      assert_not_null(pipeline_storage_file_);
+      fwrite(&pipeline_description, sizeof(pipeline_description), 1, pipeline_storage_file_);
+    }
+  }
+}
+
 VulkanShader* VulkanPipelineCache::LoadShader(xenos::ShaderType shader_type,
                                               const uint32_t* host_address, uint32_t dword_count) {
   // Hash the input memory and lookup the shader.
-  uint64_t data_hash = XXH3_64bits(host_address, dword_count * sizeof(uint32_t));
+  return LoadShader(shader_type, host_address, dword_count,
+                    XXH3_64bits(host_address, dword_count * sizeof(uint32_t)));
+}
+
+VulkanShader* VulkanPipelineCache::LoadShader(xenos::ShaderType shader_type,
+                                              const uint32_t* host_address, uint32_t dword_count,
+                                              uint64_t data_hash) {
   auto it = shaders_.find(data_hash);
   if (it != shaders_.end()) {
     // Shader has been previously loaded.
@@ -217,6 +797,17 @@ bool VulkanPipelineCache::EnsureShadersTranslated(VulkanShader::VulkanTranslatio
       REXGPU_ERROR("Failed to translate the vertex shader!");
       return false;
     }
+    if (shader_storage_file_ &&
+        vertex_shader->shader().ucode_storage_index() != shader_storage_index_) {
+      vertex_shader->shader().set_ucode_storage_index(shader_storage_index_);
+      assert_not_null(storage_write_thread_);
+      shader_storage_file_flush_needed_ = true;
+      {
+        std::lock_guard<std::mutex> lock(storage_write_request_lock_);
+        storage_write_shader_queue_.push_back(&vertex_shader->shader());
+      }
+      storage_write_request_cond_.notify_all();
+    }
   }
   if (!vertex_shader->is_valid()) {
     // Translation attempted previously, but not valid.
@@ -229,6 +820,17 @@ bool VulkanPipelineCache::EnsureShadersTranslated(VulkanShader::VulkanTranslatio
         REXGPU_ERROR("Failed to translate the pixel shader!");
         return false;
       }
+      if (shader_storage_file_ &&
+          pixel_shader->shader().ucode_storage_index() != shader_storage_index_) {
+        pixel_shader->shader().set_ucode_storage_index(shader_storage_index_);
+        assert_not_null(storage_write_thread_);
+        shader_storage_file_flush_needed_ = true;
+        {
+          std::lock_guard<std::mutex> lock(storage_write_request_lock_);
+          storage_write_shader_queue_.push_back(&pixel_shader->shader());
+        }
+        storage_write_request_cond_.notify_all();
+      }
     }
     if (!pixel_shader->is_valid()) {
       // Translation attempted previously, but not valid.
@@ -312,6 +914,20 @@ bool VulkanPipelineCache::ConfigurePipeline(
   }
   PipelineCreationArguments creation_arguments;
   auto& pipeline = *pipelines_.emplace(description, Pipeline(pipeline_layout)).first;
+
+  if (pipeline_storage_file_) {
+    assert_not_null(storage_write_thread_);
+    pipeline_storage_file_flush_needed_ = true;
+    {
+      std::lock_guard<std::mutex> lock(storage_write_request_lock_);
+      storage_write_pipeline_queue_.emplace_back();
+      PipelineStoredDescription& stored_description = storage_write_pipeline_queue_.back();
+      stored_description.description_hash = description.GetHash();
+      std::memcpy(&stored_description.description, &description, sizeof(description));
+    }
+    storage_write_request_cond_.notify_all();
+  }
+
   creation_arguments.pipeline = &pipeline;
   creation_arguments.vertex_shader = vertex_shader;
   creation_arguments.pixel_shader = pixel_shader;
@@ -355,6 +971,9 @@ bool VulkanPipelineCache::TranslateAnalyzedShader(SpirvShaderTranslator& transla
           texture_binding_count * sizeof(*texture_bindings.data());
       uint64_t texture_binding_layout_hash =
           XXH3_64bits(texture_bindings.data(), texture_binding_layout_bytes);
+      // The layout tables are shared with the shader storage translation
+      // threads.
+      std::lock_guard<std::mutex> layouts_lock(layouts_mutex_);
       auto found_range = texture_binding_layout_map_.equal_range(texture_binding_layout_hash);
       for (auto it = found_range.first; it != found_range.second; ++it) {
         if (it->second.vector_span_length == texture_binding_count &&
@@ -613,6 +1232,28 @@ bool VulkanPipelineCache::GetCurrentStateDescription(
     }
   }
 
+  if (device_properties.extendedDynamicState) {
+    // Culling and depth / stencil testing are set dynamically via
+    // VK_EXT_extended_dynamic_state - exclude them from the description so
+    // draws differing only in this state share one pipeline object. The
+    // polygon mode is still derived from the real culling state above as it
+    // can't be set dynamically without VK_EXT_extended_dynamic_state3.
+    description_out.cull_front = 0;
+    description_out.cull_back = 0;
+    description_out.front_face_clockwise = 0;
+    description_out.depth_write_enable = 0;
+    description_out.depth_compare_op = xenos::CompareFunction::kAlways;
+    description_out.stencil_test_enable = 0;
+    description_out.stencil_front_fail_op = xenos::StencilOp::kKeep;
+    description_out.stencil_front_pass_op = xenos::StencilOp::kKeep;
+    description_out.stencil_front_depth_fail_op = xenos::StencilOp::kKeep;
+    description_out.stencil_front_compare_op = xenos::CompareFunction::kNever;
+    description_out.stencil_back_fail_op = xenos::StencilOp::kKeep;
+    description_out.stencil_back_pass_op = xenos::StencilOp::kKeep;
+    description_out.stencil_back_depth_fail_op = xenos::StencilOp::kKeep;
+    description_out.stencil_back_compare_op = xenos::CompareFunction::kNever;
+  }
+
   return true;
 }
 
@@ -1894,7 +2535,7 @@ bool VulkanPipelineCache::EnsurePipelineCreated(
     color_blend_state.pAttachments = color_blend_attachments;
   }
 
-  std::array<VkDynamicState, 7> dynamic_states;
+  std::array<VkDynamicState, 14> dynamic_states;
   VkPipelineDynamicStateCreateInfo dynamic_state;
   dynamic_state.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
   dynamic_state.pNext = nullptr;
@@ -1907,12 +2548,24 @@ bool VulkanPipelineCache::EnsurePipelineCreated(
   // invalidated (again, even if it has no effect).
   dynamic_states[dynamic_state.dynamicStateCount++] = VK_DYNAMIC_STATE_VIEWPORT;
   dynamic_states[dynamic_state.dynamicStateCount++] = VK_DYNAMIC_STATE_SCISSOR;
+  const bool extended_dynamic_state = vulkan_device->properties().extendedDynamicState;
+  if (extended_dynamic_state) {
+    dynamic_states[dynamic_state.dynamicStateCount++] = VK_DYNAMIC_STATE_CULL_MODE;
+    dynamic_states[dynamic_state.dynamicStateCount++] = VK_DYNAMIC_STATE_FRONT_FACE;
+  }
   if (!edram_fragment_shader_interlock) {
     dynamic_states[dynamic_state.dynamicStateCount++] = VK_DYNAMIC_STATE_DEPTH_BIAS;
     dynamic_states[dynamic_state.dynamicStateCount++] = VK_DYNAMIC_STATE_BLEND_CONSTANTS;
     dynamic_states[dynamic_state.dynamicStateCount++] = VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK;
     dynamic_states[dynamic_state.dynamicStateCount++] = VK_DYNAMIC_STATE_STENCIL_WRITE_MASK;
     dynamic_states[dynamic_state.dynamicStateCount++] = VK_DYNAMIC_STATE_STENCIL_REFERENCE;
+    if (extended_dynamic_state) {
+      dynamic_states[dynamic_state.dynamicStateCount++] = VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE;
+      dynamic_states[dynamic_state.dynamicStateCount++] = VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE;
+      dynamic_states[dynamic_state.dynamicStateCount++] = VK_DYNAMIC_STATE_DEPTH_COMPARE_OP;
+      dynamic_states[dynamic_state.dynamicStateCount++] = VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE;
+      dynamic_states[dynamic_state.dynamicStateCount++] = VK_DYNAMIC_STATE_STENCIL_OP;
+    }
   }
 
   VkGraphicsPipelineCreateInfo pipeline_create_info;
@@ -9,6 +9,9 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <chrono>
+
+#include <rex/cvar.h>
 #include <rex/dbg.h>
 #include <rex/input/flags.h>
 #include <rex/input/input_driver.h>
@@ -17,6 +20,10 @@
 #include <rex/input/sdl/sdl_input_driver.h>
 #include <rex/logging.h>
 
+REXCVAR_DEFINE_INT32(input_poll_cache_micros, 1000, "Input",
+                     "How long a polled controller state stays fresh before the drivers are "
+                     "queried again; 0 hits the drivers on every poll");
+
 namespace rex::input {
 
 InputSystem::InputSystem(rex::ui::Window* window) : window_(window) {}
@@ -52,9 +59,7 @@ X_RESULT InputSystem::GetCapabilities(uint32_t user_index, uint32_t flags,
   return any_connected ? X_ERROR_EMPTY : X_ERROR_DEVICE_NOT_CONNECTED;
 }
 
-X_RESULT InputSystem::GetState(uint32_t user_index, X_INPUT_STATE* out_state) {
-  SCOPE_profile_cpu_f("hid");
-
+X_RESULT InputSystem::QueryStateFromDrivers(uint32_t user_index, X_INPUT_STATE* out_state) {
   bool any_connected = false;
   for (auto& driver : drivers_) {
     X_RESULT result = driver->GetState(user_index, out_state);
@@ -68,6 +73,55 @@ X_RESULT InputSystem::GetState(uint32_t user_index, X_INPUT_STATE* out_state) {
   return any_connected ? X_ERROR_EMPTY : X_ERROR_DEVICE_NOT_CONNECTED;
 }
 
+X_RESULT InputSystem::GetState(uint32_t user_index, X_INPUT_STATE* out_state) {
+  SCOPE_profile_cpu_f("hid");
+
+  int32_t cache_micros = REXCVAR_GET(input_poll_cache_micros);
+  if (cache_micros <= 0 || user_index >= kMaxUsers || !out_state) {
+    return QueryStateFromDrivers(user_index, out_state);
+  }
+
+  auto& snapshot = state_snapshots_[user_index];
+  int64_t now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                       .count();
+  if (now_ns < snapshot.valid_until_ns.load(std::memory_order_acquire)) {
+    uint64_t sequence = snapshot.sequence.load(std::memory_order_acquire);
+    if (!(sequence & 1)) {
+      X_RESULT result = snapshot.result;
+      X_INPUT_STATE state = snapshot.state;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (snapshot.sequence.load(std::memory_order_relaxed) == sequence) {
+        // Like the drivers themselves, only write the caller's buffer on
+        // success.
+        if (result == X_ERROR_SUCCESS) {
+          *out_state = state;
+        }
+        return result;
+      }
+    }
+  }
+
+  // Snapshot stale (or torn by a concurrent refresh) - hit the drivers and
+  // publish the fresh result for everyone polling behind us.
+  X_INPUT_STATE state = {};
+  X_RESULT result = QueryStateFromDrivers(user_index, &state);
+  uint64_t sequence = snapshot.sequence.load(std::memory_order_relaxed);
+  if (!(sequence & 1) &&
+      snapshot.sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_acquire,
+                                                std::memory_order_relaxed)) {
+    snapshot.result = result;
+    snapshot.state = state;
+    snapshot.sequence.store(sequence + 2, std::memory_order_release);
+    snapshot.valid_until_ns.store(now_ns + int64_t(cache_micros) * 1000,
+                                  std::memory_order_release);
+  }
+  if (result == X_ERROR_SUCCESS) {
+    *out_state = state;
+  }
+  return result;
+}
+
 X_RESULT InputSystem::SetState(uint32_t user_index, X_INPUT_VIBRATION* vibration) {
   SCOPE_profile_cpu_f("hid");
 
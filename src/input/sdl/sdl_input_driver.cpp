@@ -10,6 +10,7 @@
  */
 
 #include <array>
+#include <chrono>
 #include <filesystem>
 
 #include <rex/assert.h>
@@ -25,12 +26,17 @@ REXCVAR_DEFINE_BOOL(guide_button, false, "Input", "Enable guide button pass-thro
 REXCVAR_DEFINE_STRING(hid_mappings_file, "gamecontrollerdb.txt", "Input",
                       "Path to SDL gamecontroller mappings file");
 
+REXCVAR_DEFINE_UINT32(hid_poll_rate, 250, "Input",
+                      "Controller poll rate in Hz on the dedicated polling thread "
+                      "(0 to poll only when the guest reads input)");
+
 namespace rex::input::sdl {
 
 SDLInputDriver::SDLInputDriver(rex::ui::Window* window, size_t window_z_order)
     : InputDriver(window, window_z_order),
       sdl_events_initialized_(false),
       sdl_gamecontroller_initialized_(false),
+      poll_thread_exit_(false),
       sdl_events_unflushed_(0),
       sdl_pumpevents_queued_(false),
       controllers_(),
@@ -38,6 +44,10 @@ SDLInputDriver::SDLInputDriver(rex::ui::Window* window, size_t window_z_order)
       keystroke_states_() {}
 
 SDLInputDriver::~SDLInputDriver() {
+  if (poll_thread_.joinable()) {
+    poll_thread_exit_.store(true, std::memory_order_relaxed);
+    poll_thread_.join();
+  }
   for (size_t i = 0; i < controllers_.size(); i++) {
     if (controllers_.at(i).sdl) {
       SDL_GameControllerClose(controllers_.at(i).sdl);
@@ -121,6 +131,22 @@ X_STATUS SDLInputDriver::Setup() {
     }
   }
 
+  // Pump SDL on a dedicated thread at a fixed rate so new device state is
+  // delivered through the event watch between guest reads as well - titles may
+  // read input only once per frame, which can be as rare as 30 Hz. Guest reads
+  // still pump on the calling thread for the freshest possible state, with the
+  // sdl_pumpevents_queued_ guard keeping the pumps from overlapping.
+  uint32_t poll_rate = REXCVAR_GET(hid_poll_rate);
+  if (poll_rate) {
+    poll_thread_ = std::thread([this, poll_rate]() {
+      const auto poll_interval = std::chrono::nanoseconds(UINT64_C(1000000000) / poll_rate);
+      while (!poll_thread_exit_.load(std::memory_order_relaxed)) {
+        QueueControllerUpdate();
+        std::this_thread::sleep_for(poll_interval);
+      }
+    });
+  }
+
   REXLOG_INFO("SDL input driver initialized successfully");
   return X_STATUS_SUCCESS;
 }
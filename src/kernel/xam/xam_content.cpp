@@ -9,6 +9,8 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <optional>
+
 #include <rex/cvar.h>
 #include <rex/kernel/xam/private.h>
 #include <rex/logging.h>
@@ -79,27 +81,37 @@ ppc_u32_result_t XamContentCreateEnumerator_entry(ppc_u32_t user_index, ppc_u32_
     *buffer_size_ptr = sizeof(XCONTENT_DATA) * items_per_enumerate;
   }
 
-  auto e = make_object<XStaticEnumerator<XCONTENT_DATA>>(kernel_state(), items_per_enumerate);
+  // Content is listed lazily - the store is only scanned once the title
+  // actually enumerates, and items are converted to the guest format a batch
+  // at a time, so opening an enumerator over a large content list is cheap.
+  auto e = make_object<XLazyEnumerator<XCONTENT_DATA>>(
+      kernel_state(), items_per_enumerate,
+      [device_info, content_type = uint32_t(content_type),
+       content_datas = std::optional<std::vector<XCONTENT_AGGREGATE_DATA>>()](
+          size_t first_item, size_t item_capacity, XCONTENT_DATA* out_items) mutable -> size_t {
+        if (device_info && device_info->device_id != DummyDeviceId::HDD) {
+          // TODO(gibbed): disc drive content
+          return 0;
+        }
+        if (!content_datas) {
+          // Get all content data.
+          content_datas = kernel_state()->content_manager()->ListContent(
+              static_cast<uint32_t>(DummyDeviceId::HDD), XContentType(content_type));
+        }
+        size_t produced = 0;
+        while (produced < item_capacity && first_item + produced < content_datas->size()) {
+          out_items[produced] = (*content_datas)[first_item + produced];
+          ++produced;
+        }
+        return produced;
+      });
   auto result = e->Initialize(0xFF, 0xFE, 0x20005, 0x20007, 0);
   if (XFAILED(result)) {
     return result;
   }
 
-  if (!device_info || device_info->device_id == DummyDeviceId::HDD) {
-    // Get all content data.
-    auto content_datas = kernel_state()->content_manager()->ListContent(
-        static_cast<uint32_t>(DummyDeviceId::HDD), XContentType(uint32_t(content_type)));
-    for (const auto& content_data : content_datas) {
-      auto item = e->AppendItem();
-      *item = content_data;
-    }
-  }
-
-  if (!device_info || device_info->device_id == DummyDeviceId::ODD) {
-    // TODO(gibbed): disc drive content
-  }
-
-  REXKRNL_DEBUG("XamContentCreateEnumerator: added {} items to enumerator", e->item_count());
+  REXKRNL_DEBUG("XamContentCreateEnumerator: created enumerator for content type {:08X}",
+                uint32_t(content_type));
 
   *handle_out = e->handle();
   return X_ERROR_SUCCESS;
@@ -9,6 +9,8 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <optional>
+
 #include <rex/filesystem/file.h>
 #include <rex/kernel/xam/private.h>
 #include <rex/logging.h>
@@ -28,7 +30,7 @@ namespace xam {
 using namespace rex::system;
 using namespace rex::system::xam;
 
-void AddODDContentTest(object_ref<XStaticEnumerator<XCONTENT_AGGREGATE_DATA>> e,
+void AddODDContentTest(std::vector<XCONTENT_AGGREGATE_DATA>& out_content,
                        XContentType content_type) {
   auto root_entry = kernel_state()->file_system()->ResolvePath("game:\\Content\\0000000000000000");
   if (!root_entry) {
@@ -64,15 +66,12 @@ void AddODDContentTest(object_ref<XStaticEnumerator<XCONTENT_AGGREGATE_DATA>> e,
           break;
         }
 
-        auto item = e->AppendItem();
-        assert_not_null(item);
-        if (item) {
-          item->device_id = static_cast<uint32_t>(DummyDeviceId::ODD);
-          item->content_type = content_type;
-          item->set_display_name(string::to_utf16(content_entry->name()));
-          item->set_file_name(content_entry->name());
-          item->title_id = title_id;
-        }
+        auto& item = out_content.emplace_back();
+        item.device_id = static_cast<uint32_t>(DummyDeviceId::ODD);
+        item.content_type = content_type;
+        item.set_display_name(string::to_utf16(content_entry->name()));
+        item.set_file_name(content_entry->name());
+        item.title_id = title_id;
       }
     }
   }
@@ -89,7 +88,51 @@ ppc_u32_result_t XamContentAggregateCreateEnumerator_entry(ppc_u64_t xuid, ppc_u
     return X_E_INVALIDARG;
   }
 
-  auto e = make_object<XStaticEnumerator<XCONTENT_AGGREGATE_DATA>>(kernel_state(), 1);
+  auto content_type_enum = XContentType(uint32_t(content_type));
+
+  // Both the HDD listing and the ODD directory walk are deferred to the first
+  // enumerate call, so merely creating the enumerator doesn't touch the
+  // content store at all.
+  auto e = make_object<XLazyEnumerator<XCONTENT_AGGREGATE_DATA>>(
+      kernel_state(), 1,
+      [device_info, content_type_enum,
+       content = std::optional<std::vector<XCONTENT_AGGREGATE_DATA>>()](
+          size_t first_item, size_t item_capacity,
+          XCONTENT_AGGREGATE_DATA* out_items) mutable -> size_t {
+        if (!content) {
+          content.emplace();
+
+          if (!device_info || device_info->device_type == DeviceType::HDD) {
+            // Fetch any alternate title IDs defined in the XEX header
+            // (used by games to load saves from other titles, etc)
+            std::vector<uint32_t> title_ids{kCurrentlyRunningTitleId};
+            auto exe_module = kernel_state()->GetExecutableModule();
+            if (exe_module && exe_module->xex_module()) {
+              const auto& alt_ids = exe_module->xex_module()->opt_alternate_title_ids();
+              std::copy(alt_ids.cbegin(), alt_ids.cend(), std::back_inserter(title_ids));
+            }
+
+            for (auto& title_id : title_ids) {
+              // Get all content data.
+              auto content_datas = kernel_state()->content_manager()->ListContent(
+                  static_cast<uint32_t>(DummyDeviceId::HDD), content_type_enum, title_id);
+              std::copy(content_datas.cbegin(), content_datas.cend(),
+                        std::back_inserter(*content));
+            }
+          }
+
+          if (!device_info || device_info->device_type == DeviceType::ODD) {
+            AddODDContentTest(*content, content_type_enum);
+          }
+        }
+
+        size_t produced = 0;
+        while (produced < item_capacity && first_item + produced < content->size()) {
+          out_items[produced] = (*content)[first_item + produced];
+          ++produced;
+        }
+        return produced;
+      });
   X_KENUMERATOR_CONTENT_AGGREGATE* extra;
   auto result = e->Initialize(0xFF, 0xFE, 0x2000E, 0x20010, 0, &extra);
   if (XFAILED(result)) {
@@ -99,38 +142,8 @@ ppc_u32_result_t XamContentAggregateCreateEnumerator_entry(ppc_u64_t xuid, ppc_u
   extra->magic = kXObjSignature;
   extra->handle = e->handle();
 
-  auto content_type_enum = XContentType(uint32_t(content_type));
-
-  if (!device_info || device_info->device_type == DeviceType::HDD) {
-    // Fetch any alternate title IDs defined in the XEX header
-    // (used by games to load saves from other titles, etc)
-    std::vector<uint32_t> title_ids{kCurrentlyRunningTitleId};
-    auto exe_module = kernel_state()->GetExecutableModule();
-    if (exe_module && exe_module->xex_module()) {
-      const auto& alt_ids = exe_module->xex_module()->opt_alternate_title_ids();
-      std::copy(alt_ids.cbegin(), alt_ids.cend(), std::back_inserter(title_ids));
-    }
-
-    for (auto& title_id : title_ids) {
-      // Get all content data.
-      auto content_datas = kernel_state()->content_manager()->ListContent(
-          static_cast<uint32_t>(DummyDeviceId::HDD), content_type_enum, title_id);
-      for (const auto& content_data : content_datas) {
-        auto item = e->AppendItem();
-        assert_not_null(item);
-        if (item) {
-          *item = content_data;
-        }
-      }
-    }
-  }
-
-  if (!device_info || device_info->device_type == DeviceType::ODD) {
-    AddODDContentTest(e, content_type_enum);
-  }
-
-  REXKRNL_DEBUG("XamContentAggregateCreateEnumerator: added {} items to enumerator",
-                e->item_count());
+  REXKRNL_DEBUG("XamContentAggregateCreateEnumerator: created enumerator for content type {:08X}",
+                uint32_t(content_type_enum));
 
   *handle_out = e->handle();
   return X_ERROR_SUCCESS;
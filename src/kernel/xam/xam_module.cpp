@@ -67,7 +67,9 @@ void XamModule::RegisterExportTable(rex::runtime::ExportResolver* export_resolve
   export_resolver->RegisterTable("xam.xex", &xam_exports);
 }
 
-XamModule::~XamModule() {}
+XamModule::~XamModule() {
+  xeXamTaskShutdownPool();
+}
 
 }  // namespace xam
 }  // namespace kernel
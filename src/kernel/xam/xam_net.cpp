@@ -338,29 +338,72 @@ ppc_u32_result_t NetDll_WSASendTo_entry(ppc_u32_t caller, ppc_u32_t socket_handl
     return -1;
   }
 
-  // Our sockets implementation doesn't support multiple buffers, so we need
-  // to combine the buffers the game has given us!
-  std::vector<uint8_t> combined_buffer_mem;
-  uint32_t combined_buffer_size = 0;
-  uint32_t combined_buffer_offset = 0;
+  // Guest memory is a flat host mapping, so the WSABUF array can be handed to
+  // the OS as a gather array - no staging copy.
+  XSocket::Buffer stack_bufs[8];
+  std::vector<XSocket::Buffer> heap_bufs;
+  XSocket::Buffer* xbufs = stack_bufs;
+  if (num_buffers > rex::countof(stack_bufs)) {
+    heap_bufs.resize(num_buffers);
+    xbufs = heap_bufs.data();
+  }
   for (uint32_t i = 0; i < num_buffers; i++) {
-    combined_buffer_size += buffers[i].len;
-    combined_buffer_mem.resize(combined_buffer_size);
-    uint8_t* combined_buffer = combined_buffer_mem.data();
-
-    std::memcpy(combined_buffer + combined_buffer_offset,
-                kernel_memory()->TranslateVirtual(buffers[i].buf_ptr), buffers[i].len);
-    combined_buffer_offset += buffers[i].len;
+    xbufs[i].data = kernel_memory()->TranslateVirtual(buffers[i].buf_ptr);
+    xbufs[i].len = buffers[i].len;
   }
 
   N_XSOCKADDR_IN native_to(to_ptr);
-  socket->SendTo(combined_buffer_mem.data(), combined_buffer_size, flags, &native_to, to_len);
+  int ret = socket->SendTo(xbufs, num_buffers, flags, &native_to, to_len);
+  if (ret < 0) {
+    return -1;
+  }
+  if (num_bytes_sent) {
+    *num_bytes_sent = static_cast<uint32_t>(ret);
+  }
 
   // TODO: Instantly complete overlapped
 
   return 0;
 }
 
+ppc_u32_result_t NetDll_WSASend_entry(ppc_u32_t caller, ppc_u32_t socket_handle,
+                                      ppc_ptr_t<XWSABUF> buffers, ppc_u32_t num_buffers,
+                                      ppc_pu32_t num_bytes_sent, ppc_u32_t flags,
+                                      ppc_ptr_t<XWSAOVERLAPPED> overlapped,
+                                      ppc_pvoid_t completion_routine) {
+  assert(!overlapped);
+  assert(!completion_routine);
+
+  auto socket = kernel_state()->object_table()->LookupObject<XSocket>(socket_handle);
+  if (!socket) {
+    // WSAENOTSOCK
+    XThread::SetLastError(0x2736);
+    return -1;
+  }
+
+  XSocket::Buffer stack_bufs[8];
+  std::vector<XSocket::Buffer> heap_bufs;
+  XSocket::Buffer* xbufs = stack_bufs;
+  if (num_buffers > rex::countof(stack_bufs)) {
+    heap_bufs.resize(num_buffers);
+    xbufs = heap_bufs.data();
+  }
+  for (uint32_t i = 0; i < num_buffers; i++) {
+    xbufs[i].data = kernel_memory()->TranslateVirtual(buffers[i].buf_ptr);
+    xbufs[i].len = buffers[i].len;
+  }
+
+  int ret = socket->Send(xbufs, num_buffers, flags);
+  if (ret < 0) {
+    return -1;
+  }
+  if (num_bytes_sent) {
+    *num_bytes_sent = static_cast<uint32_t>(ret);
+  }
+
+  return 0;
+}
+
 ppc_u32_result_t NetDll_WSAWaitForMultipleEvents_entry(ppc_u32_t num_events, ppc_pu32_t events,
                                                        ppc_u32_t wait_all, ppc_u32_t timeout,
                                                        ppc_u32_t alertable) {
@@ -966,6 +1009,7 @@ XAM_EXPORT(__imp__NetDll_WSAStartup, rex::kernel::xam::NetDll_WSAStartup_entry)
 XAM_EXPORT(__imp__NetDll_WSACleanup, rex::kernel::xam::NetDll_WSACleanup_entry)
 XAM_EXPORT(__imp__NetDll_WSAGetLastError, rex::kernel::xam::NetDll_WSAGetLastError_entry)
 XAM_EXPORT(__imp__NetDll_WSARecvFrom, rex::kernel::xam::NetDll_WSARecvFrom_entry)
+XAM_EXPORT(__imp__NetDll_WSASend, rex::kernel::xam::NetDll_WSASend_entry)
 XAM_EXPORT(__imp__NetDll_WSASendTo, rex::kernel::xam::NetDll_WSASendTo_entry)
 XAM_EXPORT(__imp__NetDll_WSAWaitForMultipleEvents,
            rex::kernel::xam::NetDll_WSAWaitForMultipleEvents_entry)
@@ -1025,7 +1069,6 @@ XAM_EXPORT_STUB(__imp__NetDll_WSACancelOverlappedIO);
 XAM_EXPORT_STUB(__imp__NetDll_WSAEventSelect);
 XAM_EXPORT_STUB(__imp__NetDll_WSAGetOverlappedResult);
 XAM_EXPORT_STUB(__imp__NetDll_WSARecv);
-XAM_EXPORT_STUB(__imp__NetDll_WSASend);
 XAM_EXPORT_STUB(__imp__NetDll_WSAStartupEx);
 XAM_EXPORT_STUB(__imp__NetDll_XHttpCloseHandle);
 XAM_EXPORT_STUB(__imp__NetDll_XHttpConnect);
@@ -9,9 +9,15 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+
 #include <rex/kernel/xam/module.h>
 #include <rex/kernel/xam/private.h>
 #include <rex/logging.h>
+#include <rex/math.h>
 #include <rex/ppc/function.h>
 #include <rex/ppc/types.h>
 #include <rex/string/util.h>
@@ -44,26 +50,106 @@ struct XTASK_MESSAGE {
 };
 static_assert_size(XTASK_MESSAGE, 0x1C);
 
-ppc_u32_result_t XamTaskSchedule_entry(ppc_pvoid_t callback, ppc_ptr_t<XTASK_MESSAGE> message,
-                                       ppc_pu32_t unknown, ppc_pu32_t handle_ptr) {
-  // TODO(gibbed): figure out what this is for
-  *handle_ptr = 12345;
+namespace {
+
+// Persistent worker pool for XAM tasks. Titles schedule dozens of short tasks
+// per second during online play, and a host thread (plus 16KB+ of guest
+// stack) per XamTaskSchedule call is measurable churn. Instead a small fixed
+// set of XHostThreads drains a shared queue, calling each guest callback on
+// the worker's own thread state - the same shape as the kernel dispatch
+// thread. Long-running tasks simply occupy a worker; queued tasks behind them
+// wait, like they would have waited on the guest's two hardware threads.
+struct PendingXamTask {
+  uint32_t callback_address;
+  uint32_t message_address;
+};
+
+struct XamTaskPool {
+  // Enough to overlap a blocking task with the steady stream of micro-tasks.
+  static constexpr uint32_t kWorkerCount = 2;
+
+  std::mutex mutex;
+  std::condition_variable cond;
+  std::deque<PendingXamTask> queue;
+  std::vector<object_ref<XHostThread>> workers;
+  bool running = false;
+};
+XamTaskPool task_pool_;
+
+int XamTaskWorkerMain() {
+  auto* processor = kernel_state()->processor();
+  auto* thread_state = XThread::GetCurrentThread()->thread_state();
+
+  std::unique_lock<std::mutex> lock(task_pool_.mutex);
+  while (task_pool_.running) {
+    if (task_pool_.queue.empty()) {
+      task_pool_.cond.wait(lock);
+      continue;
+    }
+    auto task = task_pool_.queue.front();
+    task_pool_.queue.pop_front();
+    size_t queued = task_pool_.queue.size();
+    lock.unlock();
+
+    REXKRNL_DEBUG("XAM task ({:08X}) running ({} queued)", task.callback_address, queued);
+    uint64_t args[] = {task.message_address};
+    processor->Execute(thread_state, task.callback_address, args, rex::countof(args));
+
+    lock.lock();
+  }
+  return 0;
+}
+
+// Call with task_pool_.mutex held.
+void StartTaskPool() {
+  if (task_pool_.running) {
+    return;
+  }
+  task_pool_.running = true;
 
   uint32_t stack_size = kernel_state()->GetExecutableModule()->stack_size();
 
   // Stack must be aligned to 16kb pages
   stack_size = std::max((uint32_t)0x4000, ((stack_size + 0xFFF) & 0xFFFFF000));
 
-  auto thread = object_ref<XThread>(new XThread(
-      kernel_state(), stack_size, 0, callback.guest_address(), message.guest_address(), 0, true));
+  for (uint32_t i = 0; i < task_pool_.kWorkerCount; ++i) {
+    auto worker = object_ref<XHostThread>(
+        new XHostThread(kernel_state(), stack_size, 0, XamTaskWorkerMain));
+    worker->set_name(fmt::format("XAM Task Worker {}", i));
+    worker->Create();
+    task_pool_.workers.push_back(std::move(worker));
+  }
+}
+
+}  // namespace
+
+void xeXamTaskShutdownPool() {
+  std::unique_lock<std::mutex> lock(task_pool_.mutex);
+  if (!task_pool_.running) {
+    return;
+  }
+  task_pool_.running = false;
+  task_pool_.queue.clear();
+  task_pool_.cond.notify_all();
+  auto workers = std::move(task_pool_.workers);
+  lock.unlock();
+
+  for (auto& worker : workers) {
+    worker->Wait(0, 0, 0, nullptr);
+  }
+}
 
-  X_STATUS result = thread->Create();
+ppc_u32_result_t XamTaskSchedule_entry(ppc_pvoid_t callback, ppc_ptr_t<XTASK_MESSAGE> message,
+                                       ppc_pu32_t unknown, ppc_pu32_t handle_ptr) {
+  // TODO(gibbed): figure out what this is for
+  *handle_ptr = 12345;
 
-  if (XFAILED(result)) {
-    // Failed!
-    REXKRNL_ERROR("XAM task creation failed: {:08X}", result);
-    return result;
+  {
+    std::lock_guard<std::mutex> lock(task_pool_.mutex);
+    StartTaskPool();
+    task_pool_.queue.push_back({callback.guest_address(), message.guest_address()});
   }
+  task_pool_.cond.notify_one();
 
   REXKRNL_DEBUG("XAM task ({:08X}) scheduled asynchronously", callback.guest_address());
 
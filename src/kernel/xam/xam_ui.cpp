@@ -74,6 +74,47 @@ class XamDialog : public rex::ui::ImGuiDialog {
   std::function<void()> close_callback_ = nullptr;
 };
 
+// Coroutine flow for overlapped dialogs: runs on the kernel dispatch thread
+// but suspends while the dialog is open, so other deferred completions keep
+// flowing instead of queueing behind a fence wait. The dialog's close
+// callback (UI thread) resumes the task back onto the dispatch thread.
+template <typename T>
+system::DispatchTask xeXamDialogOverlappedTask(
+    T* dialog, std::function<X_RESULT(T*, uint32_t&, uint32_t&)> close_callback,
+    uint32_t overlapped) {
+  // Broadcast XN_SYS_UI = true
+  kernel_state()->BroadcastNotification(0x9, true);
+  // Same deliberate delay as the fence-based path: give games time to observe
+  // X_ERROR_IO_PENDING before the dialog can possibly resolve
+  rex::thread::Sleep(std::chrono::milliseconds(100));
+
+  X_RESULT result = X_ERROR_SUCCESS;
+  uint32_t extended_error = 0;
+  uint32_t length = 0;
+  system::DispatchContinuation closed(kernel_state());
+  dialog->set_close_callback(
+      [dialog, &result, &extended_error, &length, &closed, &close_callback]() {
+        result = close_callback(dialog, extended_error, length);
+        closed.resume();
+      });
+
+  rex::ui::WindowedAppContext* app_context = kernel_state()->emulator()->app_context();
+  if (app_context && app_context->CallInUIThreadSynchronous([]() {})) {
+    ++xam_dialogs_shown_;
+    co_await closed;
+    --xam_dialogs_shown_;
+  } else {
+    delete dialog;
+  }
+  // dialog should be deleted at this point!
+
+  kernel_state()->CompleteOverlappedEx(overlapped, result, extended_error, length);
+
+  rex::thread::Sleep(std::chrono::milliseconds(100));
+  // Broadcast XN_SYS_UI = false
+  kernel_state()->BroadcastNotification(0x9, false);
+}
+
 template <typename T>
 X_RESULT xeXamDispatchDialog(T* dialog, std::function<X_RESULT(T*)> close_callback,
                              uint32_t overlapped) {
@@ -109,7 +150,16 @@ X_RESULT xeXamDispatchDialog(T* dialog, std::function<X_RESULT(T*)> close_callba
     post();
     return result;
   } else {
-    kernel_state()->CompleteOverlappedDeferred(run, overlapped, pre, post);
+    kernel_state()->MarkOverlappedPending(overlapped);
+    kernel_state()->LaunchDispatchTask(xeXamDialogOverlappedTask<T>(
+        dialog,
+        [close_callback](T* d, uint32_t& extended_error, uint32_t& length) -> X_RESULT {
+          auto result = close_callback(d);
+          extended_error = static_cast<uint32_t>(result);
+          length = 0;
+          return result;
+        },
+        overlapped));
     return X_ERROR_IO_PENDING;
   }
 }
@@ -153,7 +203,9 @@ X_RESULT xeXamDispatchDialogEx(T* dialog,
     // TODO(gibbed): do something with extended_error/length?
     return result;
   } else {
-    kernel_state()->CompleteOverlappedDeferredEx(run, overlapped, pre, post);
+    kernel_state()->MarkOverlappedPending(overlapped);
+    kernel_state()->LaunchDispatchTask(
+        xeXamDialogOverlappedTask<T>(dialog, close_callback, overlapped));
     return X_ERROR_IO_PENDING;
   }
 }
@@ -14,6 +14,7 @@
 #include <rex/chrono/clock.h>
 #include <rex/dbg.h>
 #include <rex/kernel/xboxkrnl/cert_monitor.h>
+#include <rex/kernel/xboxkrnl/monitor_telemetry.h>
 #include <rex/kernel/xboxkrnl/private.h>
 #include <rex/logging.h>
 #include <rex/math.h>
@@ -25,9 +26,11 @@
 namespace rex::kernel::xboxkrnl {
 
 void KeCertMonitorCallback(PPCContext* ppc_context, rex::system::KernelState* kernel_state) {
-  auto id = ppc_context->r[3];
-  auto arg = ppc_context->r[4];
-  REXKRNL_DEBUG("KeCertMonitorCallback({}, {:08X})", id, arg);
+  auto id = ppc_context->r3.u32;
+  auto arg = ppc_context->r4.u32;
+  // Recorded off-thread; logging here would stall the guest thread when a
+  // title spams the monitor.
+  monitor_telemetry::Record(MonitorSource::kCertMonitor, id, arg);
   // TODO: Implement cert monitor callback if needed
 }
 
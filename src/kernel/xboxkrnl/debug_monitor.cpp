@@ -15,6 +15,7 @@
 #include <rex/cvar.h>
 #include <rex/dbg.h>
 #include <rex/kernel/xboxkrnl/debug_monitor.h>
+#include <rex/kernel/xboxkrnl/monitor_telemetry.h>
 #include <rex/kernel/xboxkrnl/private.h>
 #include <rex/logging.h>
 #include <rex/math.h>
@@ -36,13 +37,15 @@ enum class DebugMonitorCommand {
 };
 
 void KeDebugMonitorCallback(PPCContext* ppc_context, rex::system::KernelState* kernel_state) {
-  auto id = static_cast<DebugMonitorCommand>(ppc_context->r[3] & 0xFFFFFFFFu);
-  auto arg = static_cast<uint32_t>(ppc_context->r[4] & 0xFFFFFFFFu);
+  auto id = static_cast<DebugMonitorCommand>(ppc_context->r3.u32);
+  auto arg = ppc_context->r4.u32;
 
-  REXKRNL_DEBUG("KeDebugMonitorCallback({}, {:08X})", static_cast<uint32_t>(id), arg);
+  // Recorded off-thread; logging here would stall the guest thread when a
+  // title spams DbgPrint-style output.
+  monitor_telemetry::Record(MonitorSource::kDebugMonitor, static_cast<uint32_t>(id), arg);
 
   if (!REXCVAR_GET(kernel_pix)) {
-    ppc_context->r[3] = static_cast<uint64_t>(-1);
+    ppc_context->r3.u64 = uint64_t(-1);
     return;
   }
 
@@ -51,12 +54,12 @@ void KeDebugMonitorCallback(PPCContext* ppc_context, rex::system::KernelState* k
       auto s = kernel_state->memory()->TranslateVirtual<const char*>(arg);
       rex::debug::DebugPrint("{}\n", s);
       REXKRNL_DEBUG("PIX command result: {}\n", s);
-      ppc_context->r[3] = 0;
+      ppc_context->r3.u64 = 0;
       break;
     }
     case DebugMonitorCommand::SetPIXCallback:
       // TODO: Implement PIX callback if needed
-      ppc_context->r[3] = 0;
+      ppc_context->r3.u64 = 0;
       break;
     case DebugMonitorCommand::Unknown66: {
       struct callback_info {
@@ -64,18 +67,18 @@ void KeDebugMonitorCallback(PPCContext* ppc_context, rex::system::KernelState* k
         rex::be<uint32_t> callback_arg;  // D3D device object?
       };
       auto cbi = kernel_state->memory()->TranslateVirtual<callback_info*>(arg);
-      ppc_context->r[3] = 0;
+      ppc_context->r3.u64 = 0;
       break;
     }
     case DebugMonitorCommand::Unknown89:
       // arg = function pointer?
-      ppc_context->r[3] = 0;
+      ppc_context->r3.u64 = 0;
       break;
     case DebugMonitorCommand::Unknown94:
-      ppc_context->r[3] = 0;
+      ppc_context->r3.u64 = 0;
       break;
     default:
-      ppc_context->r[3] = static_cast<uint64_t>(-1);
+      ppc_context->r3.u64 = uint64_t(-1);
       break;
   }
 }
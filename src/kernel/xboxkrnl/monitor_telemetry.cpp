@@ -0,0 +1,143 @@
+/**
+ * @file        kernel/xboxkrnl/monitor_telemetry.cpp
+ * @brief       Lock-free telemetry fan-in for the cert/debug monitor callbacks
+ *
+ * @copyright   Copyright (c) 2026 Tom Clay <tomc@tctechstuff.com>
+ *              All rights reserved.
+ *
+ * @license     BSD 3-Clause License
+ *              See LICENSE file in the project root for full license text.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+
+#include <rex/cvar.h>
+#include <rex/kernel/xboxkrnl/monitor_telemetry.h>
+#include <rex/logging.h>
+#include <rex/memory/mpsc_ring_buffer.h>
+#include <rex/thread.h>
+
+REXCVAR_DEFINE_UINT32(kernel_monitor_telemetry_interval_ms, 1000, "Kernel",
+                      "How often the monitor telemetry thread logs aggregated "
+                      "cert/debug monitor callback counts.");
+
+namespace rex::kernel::xboxkrnl {
+namespace monitor_telemetry {
+
+namespace {
+
+// Fixed-size record pushed by guest threads; the ring is byte-granular so the
+// drain side parses in strides of this struct.
+struct MonitorEvent {
+  uint32_t source;
+  uint32_t id;
+  uint32_t arg;
+};
+static_assert(std::is_trivially_copyable_v<MonitorEvent>);
+
+std::once_flag start_once_;
+std::unique_ptr<rex::memory::MpscRingBuffer> ring_;
+std::unique_ptr<rex::thread::Thread> drain_thread_;
+std::atomic<bool> shutdown_{false};
+std::atomic<uint64_t> dropped_{0};
+
+const char* SourceName(MonitorSource source) {
+  switch (source) {
+    case MonitorSource::kDebugMonitor:
+      return "KeDebugMonitorCallback";
+    case MonitorSource::kCertMonitor:
+      return "KeCertMonitorCallback";
+    default:
+      return "?";
+  }
+}
+
+void DrainThread() {
+  struct Aggregate {
+    uint64_t calls = 0;
+    uint32_t last_arg = 0;
+  };
+  // source << 32 | id -> counts since the last report
+  std::unordered_map<uint64_t, Aggregate> pending;
+  uint64_t reported_drops = 0;
+  uint8_t buffer[4096];
+  auto last_report = std::chrono::steady_clock::now();
+
+  while (true) {
+    bool stopping = shutdown_.load(std::memory_order_acquire);
+    size_t drained =
+        ring_->Drain(buffer, sizeof(buffer),
+                     stopping ? std::chrono::milliseconds(0) : std::chrono::milliseconds(100));
+    for (size_t offset = 0; offset + sizeof(MonitorEvent) <= drained;
+         offset += sizeof(MonitorEvent)) {
+      MonitorEvent event;
+      std::memcpy(&event, buffer + offset, sizeof(event));
+      auto& aggregate = pending[uint64_t(event.source) << 32 | event.id];
+      aggregate.calls++;
+      aggregate.last_arg = event.arg;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    auto interval =
+        std::chrono::milliseconds(std::max(REXCVAR_GET(kernel_monitor_telemetry_interval_ms), 1u));
+    if ((now - last_report >= interval || stopping) && !pending.empty()) {
+      for (const auto& [key, aggregate] : pending) {
+        REXKRNL_DEBUG("{}({}, {:08X}) x{}", SourceName(MonitorSource(uint32_t(key >> 32))),
+                      uint32_t(key), aggregate.last_arg, aggregate.calls);
+      }
+      pending.clear();
+      uint64_t drops = dropped_.load(std::memory_order_relaxed);
+      if (drops != reported_drops) {
+        REXKRNL_DEBUG("Monitor telemetry: dropped {} events (ring full)", drops - reported_drops);
+        reported_drops = drops;
+      }
+      last_report = now;
+    }
+
+    if (stopping && !drained) {
+      break;
+    }
+  }
+}
+
+void Start() {
+  // Bounds payload bytes plus one 8-byte header per event in flight; events
+  // are dropped (and counted) past that rather than stalling guest threads.
+  ring_ = std::make_unique<rex::memory::MpscRingBuffer>(64 * 1024);
+  drain_thread_ = rex::thread::Thread::Create({}, []() { DrainThread(); });
+  drain_thread_->set_name("Monitor telemetry");
+}
+
+}  // namespace
+
+void Record(MonitorSource source, uint32_t id, uint32_t arg) {
+  if (shutdown_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  std::call_once(start_once_, Start);
+  MonitorEvent event{uint32_t(source), id, arg};
+  if (!ring_->TryWrite(&event, sizeof(event))) {
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void Shutdown() {
+  if (shutdown_.exchange(true, std::memory_order_acq_rel)) {
+    return;
+  }
+  if (drain_thread_) {
+    rex::thread::Wait(drain_thread_.get(), false);
+    drain_thread_.reset();
+    ring_.reset();
+  }
+}
+
+}  // namespace monitor_telemetry
+}  // namespace rex::kernel::xboxkrnl
@@ -14,6 +14,7 @@
 
 #include <algorithm>
 
+#include <rex/crypto/sha256.h>
 #include <rex/kernel/xboxkrnl/private.h>
 #include <rex/logging.h>
 #include <rex/platform.h>
@@ -40,6 +41,21 @@ extern "C" {
 #include "aes_128/aes.h"
 }
 
+// Hardware AES paths, detected at runtime like the SHA-256 instructions in
+// core/sha256.cpp.
+#if defined(__x86_64__) && (defined(__clang__) || defined(__GNUC__))
+#define REX_CRYPT_X86_AES_NI 1
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__) && (defined(__clang__) || defined(__GNUC__))
+#define REX_CRYPT_ARM_AES 1
+#include <arm_neon.h>
+#if defined(__linux__)
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+#endif
+
 namespace rex::kernel::xboxkrnl {
 
 typedef struct {
@@ -182,12 +198,37 @@ void XeCryptSha256Init_entry(ppc_ptr_t<XECRYPT_SHA256_STATE> sha_state) {
 
 void XeCryptSha256Update_entry(ppc_ptr_t<XECRYPT_SHA256_STATE> sha_state, ppc_pvoid_t input,
                                ppc_u32_t input_size) {
+  const uint8_t* bytes = input.as<const uint8_t*>();
+  uint32_t size = input_size;
+
+  // Run whole 64-byte blocks through the shared hardware SHA-256 compression
+  // function when the block buffer is empty - content verification hashes
+  // megabytes through this export, and the portable code below then only sees
+  // the sub-block tail.
+  if (rex::crypto::sha256_hardware_supported() && !(sha_state->count % 64) && size >= 64) {
+    uint32_t state[8];
+    for (uint32_t i = 0; i < 8; ++i) {
+      state[i] = sha_state->state[i];
+    }
+    uint32_t whole_size = size & ~uint32_t(63);
+    rex::crypto::sha256_process_blocks(state, bytes, whole_size / 64);
+    for (uint32_t i = 0; i < 8; ++i) {
+      sha_state->state[i] = state[i];
+    }
+    sha_state->count += whole_size;
+    bytes += whole_size;
+    size -= whole_size;
+    if (!size) {
+      return;
+    }
+  }
+
   sha256::SHA256 sha;
   std::copy(std::begin(sha_state->state), std::end(sha_state->state), sha.getHashValues());
   std::copy(std::begin(sha_state->buffer), std::end(sha_state->buffer), sha.getBuffer());
   sha.setTotalSize(sha_state->count);
 
-  sha.add(input, input_size);
+  sha.add(bytes, size);
 
   std::copy_n(sha.getHashValues(), rex::countof(sha_state->state), sha_state->state);
   std::copy_n(sha.getBuffer(), rex::countof(sha_state->buffer), sha_state->buffer);
@@ -400,6 +441,222 @@ static inline uint8_t xeXeCryptAesMul2(uint8_t a) {
   return (a & 0x80) ? ((a << 1) ^ 0x1B) : (a << 1);
 }
 
+// Hardware AES-128 over the keytabenc schedule. The decryption round keys are
+// derived from the encryption schedule with the inverse MixColumns instruction
+// (the equivalent inverse cipher), so only the verified keytabenc layout is
+// relied upon - see the TODO about keytabdec in XeCryptAesKey.
+#if defined(REX_CRYPT_X86_AES_NI)
+
+static bool HardwareAesSupported() {
+  static const bool supported = [] {
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+      return false;
+    }
+    return (ecx & (1u << 25)) != 0;  // AES-NI.
+  }();
+  return supported;
+}
+
+__attribute__((target("aes,sse2"))) static void AesHwLoadEncryptKeys(const uint8_t* keytab,
+                                                                     __m128i round_keys[11]) {
+  for (uint32_t i = 0; i < 11; ++i) {
+    round_keys[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keytab + i * 16));
+  }
+}
+
+__attribute__((target("aes,sse2"))) static void AesHwLoadDecryptKeys(const uint8_t* keytab,
+                                                                     __m128i round_keys[11]) {
+  round_keys[0] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keytab + 10 * 16));
+  for (uint32_t i = 1; i < 10; ++i) {
+    round_keys[i] =
+        _mm_aesimc_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(keytab + (10 - i) * 16)));
+  }
+  round_keys[10] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keytab));
+}
+
+__attribute__((target("aes,sse2"))) static __m128i AesHwEncryptBlock(const __m128i round_keys[11],
+                                                                     __m128i block) {
+  block = _mm_xor_si128(block, round_keys[0]);
+  for (uint32_t i = 1; i < 10; ++i) {
+    block = _mm_aesenc_si128(block, round_keys[i]);
+  }
+  return _mm_aesenclast_si128(block, round_keys[10]);
+}
+
+__attribute__((target("aes,sse2"))) static __m128i AesHwDecryptBlock(const __m128i round_keys[11],
+                                                                     __m128i block) {
+  block = _mm_xor_si128(block, round_keys[0]);
+  for (uint32_t i = 1; i < 10; ++i) {
+    block = _mm_aesdec_si128(block, round_keys[i]);
+  }
+  return _mm_aesdeclast_si128(block, round_keys[10]);
+}
+
+__attribute__((target("aes,sse2"))) static void AesHwEcb(const uint8_t* keytab, const uint8_t* inp,
+                                                         uint8_t* out, bool encrypt) {
+  __m128i round_keys[11];
+  __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(inp));
+  if (encrypt) {
+    AesHwLoadEncryptKeys(keytab, round_keys);
+    block = AesHwEncryptBlock(round_keys, block);
+  } else {
+    AesHwLoadDecryptKeys(keytab, round_keys);
+    block = AesHwDecryptBlock(round_keys, block);
+  }
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out), block);
+}
+
+__attribute__((target("aes,sse2"))) static void AesHwCbcEncrypt(const uint8_t* keytab,
+                                                                const uint8_t* inp,
+                                                                uint32_t inp_size, uint8_t* out,
+                                                                uint8_t* feed) {
+  __m128i round_keys[11];
+  AesHwLoadEncryptKeys(keytab, round_keys);
+  __m128i chain = _mm_loadu_si128(reinterpret_cast<const __m128i*>(feed));
+  for (uint32_t i = 0; i < inp_size; i += 16) {
+    chain = AesHwEncryptBlock(
+        round_keys,
+        _mm_xor_si128(chain, _mm_loadu_si128(reinterpret_cast<const __m128i*>(inp + i))));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), chain);
+  }
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(feed), chain);
+}
+
+__attribute__((target("aes,sse2"))) static void AesHwCbcDecrypt(const uint8_t* keytab,
+                                                                const uint8_t* inp,
+                                                                uint32_t inp_size, uint8_t* out,
+                                                                uint8_t* feed) {
+  __m128i round_keys[11];
+  AesHwLoadDecryptKeys(keytab, round_keys);
+  __m128i chain = _mm_loadu_si128(reinterpret_cast<const __m128i*>(feed));
+  uint32_t i = 0;
+  // Unlike encryption, the blocks are independent when decrypting - run four
+  // through the AES units at once to hide the aesdec latency (the ciphertext
+  // inputs are read upfront, so operating in place is fine).
+  for (; i + 64 <= inp_size; i += 64) {
+    __m128i c0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(inp + i));
+    __m128i c1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(inp + i + 16));
+    __m128i c2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(inp + i + 32));
+    __m128i c3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(inp + i + 48));
+    __m128i b0 = _mm_xor_si128(c0, round_keys[0]);
+    __m128i b1 = _mm_xor_si128(c1, round_keys[0]);
+    __m128i b2 = _mm_xor_si128(c2, round_keys[0]);
+    __m128i b3 = _mm_xor_si128(c3, round_keys[0]);
+    for (uint32_t r = 1; r < 10; ++r) {
+      b0 = _mm_aesdec_si128(b0, round_keys[r]);
+      b1 = _mm_aesdec_si128(b1, round_keys[r]);
+      b2 = _mm_aesdec_si128(b2, round_keys[r]);
+      b3 = _mm_aesdec_si128(b3, round_keys[r]);
+    }
+    b0 = _mm_aesdeclast_si128(b0, round_keys[10]);
+    b1 = _mm_aesdeclast_si128(b1, round_keys[10]);
+    b2 = _mm_aesdeclast_si128(b2, round_keys[10]);
+    b3 = _mm_aesdeclast_si128(b3, round_keys[10]);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_xor_si128(b0, chain));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 16), _mm_xor_si128(b1, c0));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 32), _mm_xor_si128(b2, c1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 48), _mm_xor_si128(b3, c2));
+    chain = c3;
+  }
+  for (; i < inp_size; i += 16) {
+    __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(inp + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                     _mm_xor_si128(AesHwDecryptBlock(round_keys, c), chain));
+    chain = c;
+  }
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(feed), chain);
+}
+
+#elif defined(REX_CRYPT_ARM_AES)
+
+static bool HardwareAesSupported() {
+#if defined(__APPLE__)
+  // All arm64 Apple devices implement the AES extensions.
+  return true;
+#elif defined(__linux__)
+  static const bool supported = (getauxval(AT_HWCAP) & HWCAP_AES) != 0;
+  return supported;
+#else
+  return false;
+#endif
+}
+
+__attribute__((target("+aes"))) static void AesHwLoadEncryptKeys(const uint8_t* keytab,
+                                                                 uint8x16_t round_keys[11]) {
+  for (uint32_t i = 0; i < 11; ++i) {
+    round_keys[i] = vld1q_u8(keytab + i * 16);
+  }
+}
+
+__attribute__((target("+aes"))) static void AesHwLoadDecryptKeys(const uint8_t* keytab,
+                                                                 uint8x16_t round_keys[11]) {
+  round_keys[0] = vld1q_u8(keytab + 10 * 16);
+  for (uint32_t i = 1; i < 10; ++i) {
+    round_keys[i] = vaesimcq_u8(vld1q_u8(keytab + (10 - i) * 16));
+  }
+  round_keys[10] = vld1q_u8(keytab);
+}
+
+__attribute__((target("+aes"))) static uint8x16_t AesHwEncryptBlock(const uint8x16_t round_keys[11],
+                                                                    uint8x16_t block) {
+  for (uint32_t i = 0; i < 9; ++i) {
+    block = vaesmcq_u8(vaeseq_u8(block, round_keys[i]));
+  }
+  return veorq_u8(vaeseq_u8(block, round_keys[9]), round_keys[10]);
+}
+
+__attribute__((target("+aes"))) static uint8x16_t AesHwDecryptBlock(const uint8x16_t round_keys[11],
+                                                                    uint8x16_t block) {
+  for (uint32_t i = 0; i < 9; ++i) {
+    block = vaesimcq_u8(vaesdq_u8(block, round_keys[i]));
+  }
+  return veorq_u8(vaesdq_u8(block, round_keys[9]), round_keys[10]);
+}
+
+__attribute__((target("+aes"))) static void AesHwEcb(const uint8_t* keytab, const uint8_t* inp,
+                                                     uint8_t* out, bool encrypt) {
+  uint8x16_t round_keys[11];
+  uint8x16_t block = vld1q_u8(inp);
+  if (encrypt) {
+    AesHwLoadEncryptKeys(keytab, round_keys);
+    block = AesHwEncryptBlock(round_keys, block);
+  } else {
+    AesHwLoadDecryptKeys(keytab, round_keys);
+    block = AesHwDecryptBlock(round_keys, block);
+  }
+  vst1q_u8(out, block);
+}
+
+__attribute__((target("+aes"))) static void AesHwCbcEncrypt(const uint8_t* keytab,
+                                                            const uint8_t* inp, uint32_t inp_size,
+                                                            uint8_t* out, uint8_t* feed) {
+  uint8x16_t round_keys[11];
+  AesHwLoadEncryptKeys(keytab, round_keys);
+  uint8x16_t chain = vld1q_u8(feed);
+  for (uint32_t i = 0; i < inp_size; i += 16) {
+    chain = AesHwEncryptBlock(round_keys, veorq_u8(chain, vld1q_u8(inp + i)));
+    vst1q_u8(out + i, chain);
+  }
+  vst1q_u8(feed, chain);
+}
+
+__attribute__((target("+aes"))) static void AesHwCbcDecrypt(const uint8_t* keytab,
+                                                            const uint8_t* inp, uint32_t inp_size,
+                                                            uint8_t* out, uint8_t* feed) {
+  uint8x16_t round_keys[11];
+  AesHwLoadDecryptKeys(keytab, round_keys);
+  uint8x16_t chain = vld1q_u8(feed);
+  for (uint32_t i = 0; i < inp_size; i += 16) {
+    uint8x16_t c = vld1q_u8(inp + i);
+    vst1q_u8(out + i, veorq_u8(AesHwDecryptBlock(round_keys, c), chain));
+    chain = c;
+  }
+  vst1q_u8(feed, chain);
+}
+
+#endif
+
 void XeCryptAesKey_entry(ppc_ptr_t<XECRYPT_AES_STATE> state_ptr, ppc_pvoid_t key) {
   aes_key_schedule_128(key, reinterpret_cast<uint8_t*>(state_ptr->keytabenc));
   // Decryption key schedule not needed by openluopworld/aes_128, but generated
@@ -466,6 +723,12 @@ void XeCryptAesKey_entry(ppc_ptr_t<XECRYPT_AES_STATE> state_ptr, ppc_pvoid_t key
 void XeCryptAesEcb_entry(ppc_ptr_t<XECRYPT_AES_STATE> state_ptr, ppc_pvoid_t inp_ptr,
                          ppc_pvoid_t out_ptr, ppc_u32_t encrypt) {
   const uint8_t* keytab = reinterpret_cast<const uint8_t*>(state_ptr->keytabenc);
+#if defined(REX_CRYPT_X86_AES_NI) || defined(REX_CRYPT_ARM_AES)
+  if (HardwareAesSupported()) {
+    AesHwEcb(keytab, inp_ptr, out_ptr, encrypt != 0);
+    return;
+  }
+#endif
   if (encrypt) {
     aes_encrypt_128(keytab, inp_ptr, out_ptr);
   } else {
@@ -480,6 +743,16 @@ void XeCryptAesCbc_entry(ppc_ptr_t<XECRYPT_AES_STATE> state_ptr, ppc_pvoid_t inp
   const uint8_t* inp = inp_ptr.as<const uint8_t*>();
   uint8_t* out = out_ptr.as<uint8_t*>();
   uint8_t* feed = feed_ptr.as<uint8_t*>();
+#if defined(REX_CRYPT_X86_AES_NI) || defined(REX_CRYPT_ARM_AES)
+  if (HardwareAesSupported()) {
+    if (encrypt) {
+      AesHwCbcEncrypt(keytab, inp, inp_size, out, feed);
+    } else {
+      AesHwCbcDecrypt(keytab, inp, inp_size, out, feed);
+    }
+    return;
+  }
+#endif
   if (encrypt) {
     for (uint32_t i = 0; i < inp_size; i += 16) {
       for (uint32_t j = 0; j < 16; ++j) {
@@ -213,7 +213,7 @@ ppc_u32_result_t NtReadFile_entry(ppc_u32_t file_handle, ppc_u32_t event_handle,
   }
 
   if (XSUCCEEDED(result)) {
-    if (true || file->is_synchronous()) {
+    if (file->is_synchronous()) {
       // Synchronous.
       uint32_t bytes_read = 0;
       result = file->Read(buffer.guest_address(), buffer_length,
@@ -243,24 +243,23 @@ ppc_u32_result_t NtReadFile_entry(ppc_u32_t file_handle, ppc_u32_t event_handle,
       // we have written the info out.
       signal_event = true;
     } else {
-      // TODO(benvanik): async.
-
-      // X_STATUS_PENDING if not returning immediately.
-      // XFile is waitable and signalled after each async req completes.
-      // reset the input event (->Reset())
-      /*xeNtReadFileState* call_state = new xeNtReadFileState();
-      XAsyncRequest* request = new XAsyncRequest(
-      state, file,
-      (XAsyncRequest::CompletionCallback)xeNtReadFileCompleted,
-      call_state);*/
-      // result = file->Read(buffer.guest_address(), buffer_length, byte_offset,
-      //                     request);
+      // Overlapped: queue on the kernel's background I/O workers. The worker
+      // writes the IO status block, queues the APC on this thread, and
+      // signals the event once the read finishes; XFile itself is waitable
+      // and signalled after each async request completes.
       if (io_status_block) {
         io_status_block->status = X_STATUS_PENDING;
         io_status_block->information = 0;
       }
+      if (ev) {
+        ev->Reset();
+      }
 
-      result = X_STATUS_PENDING;
+      result = file->ReadAsync(buffer.guest_address(), buffer_length,
+                               byte_offset_ptr ? static_cast<uint64_t>(*byte_offset_ptr) : -1,
+                               apc_context.guest_address(),
+                               static_cast<uint32_t>(apc_routine_ptr),
+                               io_status_block.guest_address(), ev);
     }
   }
 
@@ -391,8 +390,7 @@ ppc_u32_result_t NtWriteFile_entry(ppc_u32_t file_handle, ppc_u32_t event_handle
 
   // Execute write.
   if (XSUCCEEDED(result)) {
-    // TODO(benvanik): async path.
-    if (true || file->is_synchronous()) {
+    if (file->is_synchronous()) {
       // Synchronous request.
       uint32_t bytes_written = 0;
       result = file->Write(buffer.guest_address(), buffer_length,
@@ -423,13 +421,19 @@ ppc_u32_result_t NtWriteFile_entry(ppc_u32_t file_handle, ppc_u32_t event_handle
       // we have written the info out.
       signal_event = true;
     } else {
-      // X_STATUS_PENDING if not returning immediately.
-      result = X_STATUS_PENDING;
-
+      // Overlapped: same background-worker completion sequence as NtReadFile.
       if (io_status_block) {
         io_status_block->status = X_STATUS_PENDING;
         io_status_block->information = 0;
       }
+      if (ev) {
+        ev->Reset();
+      }
+
+      result = file->WriteAsync(buffer.guest_address(), buffer_length,
+                                byte_offset_ptr ? static_cast<uint64_t>(*byte_offset_ptr) : -1,
+                                apc_context.guest_address(), static_cast<uint32_t>(apc_routine),
+                                io_status_block.guest_address(), ev);
     }
   }
 
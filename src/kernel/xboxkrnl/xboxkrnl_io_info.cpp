@@ -117,8 +117,11 @@ ppc_u32_result_t NtQueryInformationFile_entry(ppc_u32_t file_handle,
     case XFileNetworkOpenInformation: {
       // Make sure we're working with up-to-date information, just in case the
       // file size has changed via something other than NtSetInfoFile
-      // (eg. seems NtWriteFile might extend the file in some cases)
-      file->entry()->update();
+      // (eg. seems NtWriteFile might extend the file in some cases). Writes
+      // dirty the entry's info cache, so this only hits the host after an
+      // actual mutation - titles stat'ing the same file every frame stay on
+      // the cached values.
+      file->entry()->RefreshInfo();
 
       auto info = info_ptr.as<X_FILE_NETWORK_OPEN_INFORMATION*>();
       info->creation_time = file->entry()->create_timestamp();
@@ -230,7 +233,7 @@ ppc_u32_result_t NtSetInformationFile_entry(ppc_u32_t file_handle,
       out_length = sizeof(*info);
 
       // Update the files rex::filesystem::Entry information
-      file->entry()->update();
+      file->entry()->RefreshInfo();
       break;
     }
     case XFileCompletionInformation: {
@@ -12,6 +12,7 @@
 // Disable warnings about unused parameters for kernel functions
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 
+#include <atomic>
 #include <cstring>
 
 #include <rex/assert.h>
@@ -298,13 +299,82 @@ struct X_MEMORY_BASIC_INFORMATION {
   be<uint32_t> type;
 };
 
+namespace {
+
+// NtQueryVirtualMemory result cache. Some middleware re-queries every
+// allocation on every GC cycle, and each query otherwise takes the global
+// critical region and re-scans the page table. Entries are stamped with the
+// owning heap's allocation generation, so any allocation change invalidates
+// them wholesale, and repeated queries between changes are served without
+// touching the lock. Slots are seqlock-protected: a writer claims a slot by
+// CASing the sequence odd (skipping the fill on contention), and a reader
+// accepts a slot only if the sequence is even and unchanged around its reads,
+// which makes the racy field reads in between benign.
+struct CachedRegionInfo {
+  std::atomic<uint64_t> sequence{0};  // Odd while a writer owns the slot.
+  uint64_t generation;
+  uint32_t query_address;
+  memory::HeapAllocationInfo info;
+};
+
+constexpr uint32_t kRegionCacheSizeLog2 = 8;
+CachedRegionInfo region_cache_[1 << kRegionCacheSizeLog2];
+
+CachedRegionInfo& RegionCacheSlot(uint32_t guest_address) {
+  // Queries are region-granular; spread nearby pages across slots.
+  uint32_t hash = (guest_address >> 12) * 2654435761u;
+  return region_cache_[hash >> (32 - kRegionCacheSizeLog2)];
+}
+
+bool RegionCacheLookup(uint32_t guest_address, uint64_t generation,
+                       memory::HeapAllocationInfo* out_info) {
+  auto& slot = RegionCacheSlot(guest_address);
+  uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+  if ((sequence & 1) || slot.generation != generation || slot.query_address != guest_address) {
+    return false;
+  }
+  *out_info = slot.info;
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return slot.sequence.load(std::memory_order_relaxed) == sequence;
+}
+
+void RegionCacheStore(uint32_t guest_address, uint64_t generation,
+                      const memory::HeapAllocationInfo& info) {
+  auto& slot = RegionCacheSlot(guest_address);
+  uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+  if (sequence & 1) {
+    return;
+  }
+  if (!slot.sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_acquire,
+                                             std::memory_order_relaxed)) {
+    return;
+  }
+  slot.generation = generation;
+  slot.query_address = guest_address;
+  slot.info = info;
+  slot.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+}  // namespace
+
 ppc_u32_result_t NtQueryVirtualMemory_entry(
     ppc_u32_t base_address, ppc_ptr_t<X_MEMORY_BASIC_INFORMATION> memory_basic_information_ptr) {
   auto heap = kernel_state()->memory()->LookupHeap(base_address);
-  memory::HeapAllocationInfo alloc_info;
-  if (heap == nullptr || !heap->QueryRegionInfo(base_address, &alloc_info)) {
+  if (heap == nullptr) {
     return X_STATUS_INVALID_PARAMETER;
   }
+  memory::HeapAllocationInfo alloc_info;
+  uint64_t generation = heap->allocation_generation();
+  if (!RegionCacheLookup(base_address, generation, &alloc_info)) {
+    if (!heap->QueryRegionInfo(base_address, &alloc_info)) {
+      return X_STATUS_INVALID_PARAMETER;
+    }
+    // Only cache results that are provably from this generation - a mutation
+    // racing the query just means this one isn't cached.
+    if (heap->allocation_generation() == generation) {
+      RegionCacheStore(base_address, generation, alloc_info);
+    }
+  }
 
   memory_basic_information_ptr->base_address = alloc_info.base_address;
   memory_basic_information_ptr->allocation_base = alloc_info.allocation_base;
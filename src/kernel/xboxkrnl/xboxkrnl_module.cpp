@@ -24,6 +24,7 @@
 #include <rex/kernel/xboxkrnl/cert_monitor.h>
 #include <rex/kernel/xboxkrnl/debug_monitor.h>
 #include <rex/kernel/xboxkrnl/module.h>
+#include <rex/kernel/xboxkrnl/monitor_telemetry.h>
 #include <rex/kernel/xboxkrnl/private.h>
 #include <rex/kernel/xboxkrnl/video.h>
 #include <rex/logging.h>
@@ -231,6 +232,8 @@ void XboxkrnlModule::RegisterExportTable(rex::runtime::ExportResolver* export_re
   export_resolver->RegisterTable("xboxkrnl.exe", &xboxkrnl_exports);
 }
 
-XboxkrnlModule::~XboxkrnlModule() = default;
+XboxkrnlModule::~XboxkrnlModule() {
+  monitor_telemetry::Shutdown();
+}
 
 }  // namespace rex::kernel::xboxkrnl
@@ -90,7 +90,7 @@ ppc_u32_result_t ObReferenceObjectByHandle_entry(ppc_u32_t handle, ppc_u32_t obj
       {XObject::Type::Event, 0xD00EBEEF},
       {XObject::Type::Semaphore, 0xD017BEEF},
       {XObject::Type::Thread, 0xD01BBEEF}};
-  auto object = kernel_state()->object_table()->LookupObject<XObject>(handle);
+  auto object = kernel_state()->object_table()->LookupObjectBorrowed<XObject>(handle);
   if (!object) {
     return X_STATUS_INVALID_HANDLE;
   }
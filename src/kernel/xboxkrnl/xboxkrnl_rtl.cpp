@@ -20,6 +20,7 @@
 #include <rex/kernel/xboxkrnl/rtl.h>
 #include <rex/kernel/xboxkrnl/threading.h>
 #include <rex/logging.h>
+#include <rex/memory/utils.h>
 #include <rex/ppc/function.h>
 #include <rex/ppc/types.h>
 #include <rex/string.h>
@@ -44,14 +45,7 @@ ppc_u32_result_t RtlCompareMemory_entry(ppc_pvoid_t source1, ppc_pvoid_t source2
   // we just do this ourselves vs. using memcmp.
   // On Windows we could use the builtin function.
 
-  uint32_t c = 0;
-  for (uint32_t n = 0; n < length; n++, p1++, p2++) {
-    if (*p1 == *p2) {
-      c++;
-    }
-  }
-
-  return c;
+  return uint32_t(rex::memory::count_matching_8(p1, p2, length));
 }
 
 // https://msdn.microsoft.com/en-us/library/ff552123
@@ -62,16 +56,10 @@ ppc_u32_result_t RtlCompareMemoryUlong_entry(ppc_pvoid_t source, ppc_u32_t lengt
     return 0;
   }
 
-  uint32_t n = 0;
-  for (uint32_t i = 0; i < (length / 4); i++) {
-    // FIXME: This assumes as_array returns rex::be
-    uint32_t val = source.as_array<uint32_t>()[i];
-    if (val == pattern) {
-      n++;
-    }
-  }
-
-  return n;
+  // Compare the raw guest words against the pattern swapped to guest
+  // endianness so no per-element swap is needed.
+  return uint32_t(rex::memory::count_equal_32(source.as<uint32_t*>(), length / 4,
+                                              rex::byte_swap(pattern.value())));
 }
 
 // https://msdn.microsoft.com/en-us/library/ff552263
@@ -17,7 +17,6 @@
 #include <cstring>
 
 #include <rex/logging.h>
-#include <rex/memory/utils.h>
 #include <rex/ppc/function.h>
 #include <rex/system/flags.h>
 #include <rex/system/format.h>
@@ -92,13 +91,12 @@ extern "C" PPC_FUNC(__imp__sprintf) {
   auto format = reinterpret_cast<const uint8_t*>(PPC_RAW_ADDR(format_ptr));
 
   StackArgList args(ctx, base, 2);
-  StringFormatData data(format);
+  GuestStringFormatData data(format, buffer, INT32_MAX);
 
   int32_t count = format_core(base, data, args, false);
-  if (count <= 0) {
+  if (count < 0) {
     buffer[0] = '\0';
   } else {
-    std::memcpy(buffer, data.str().c_str(), count);
     buffer[count] = '\0';
   }
   ctx.r3.u64 = count;
@@ -118,20 +116,15 @@ extern "C" PPC_FUNC(__imp___snprintf) {
   auto format = reinterpret_cast<const uint8_t*>(PPC_RAW_ADDR(format_ptr));
 
   StackArgList args(ctx, base, 3);
-  StringFormatData data(format);
+  GuestStringFormatData data(format, buffer, buffer_count);
 
   int32_t count = format_core(base, data, args, false);
   if (count < 0) {
-    if (buffer_count > 0) {
-      buffer[0] = '\0';
-    }
-  } else if (count <= buffer_count) {
-    std::memcpy(buffer, data.str().c_str(), count);
-    if (count < buffer_count) {
-      buffer[count] = '\0';
-    }
-  } else {
-    std::memcpy(buffer, data.str().c_str(), buffer_count);
+    buffer[0] = '\0';
+  } else if (count < buffer_count) {
+    buffer[count] = '\0';
+  } else if (count > buffer_count) {
+    // Truncated; the writer stopped at capacity.
     count = -1;
   }
   ctx.r3.u64 = count;
@@ -154,14 +147,12 @@ extern "C" PPC_FUNC(__imp__swprintf) {
   auto format = reinterpret_cast<const uint16_t*>(PPC_RAW_ADDR(format_ptr));
 
   StackArgList args(ctx, base, 2);
-  WideStringFormatData data(format);
+  GuestWideStringFormatData data(format, buffer, INT32_MAX);
 
   int32_t count = format_core(base, data, args, true);
-  if (count <= 0) {
+  if (count < 0) {
     buffer[0] = '\0';
   } else {
-    rex::memory::copy_and_swap(buffer, reinterpret_cast<const uint16_t*>(data.wstr().c_str()),
-                               count);
     buffer[count] = '\0';
   }
   ctx.r3.u64 = count;
@@ -181,22 +172,15 @@ extern "C" PPC_FUNC(__imp___snwprintf) {
   auto format = reinterpret_cast<const uint16_t*>(PPC_RAW_ADDR(format_ptr));
 
   StackArgList args(ctx, base, 3);
-  WideStringFormatData data(format);
+  GuestWideStringFormatData data(format, buffer, buffer_count);
 
   int32_t count = format_core(base, data, args, true);
   if (count < 0) {
-    if (buffer_count > 0) {
-      buffer[0] = '\0';
-    }
-  } else if (count <= buffer_count) {
-    rex::memory::copy_and_swap(buffer, reinterpret_cast<const uint16_t*>(data.wstr().c_str()),
-                               count);
-    if (count < buffer_count) {
-      buffer[count] = '\0';
-    }
-  } else {
-    rex::memory::copy_and_swap(buffer, reinterpret_cast<const uint16_t*>(data.wstr().c_str()),
-                               buffer_count);
+    buffer[0] = '\0';
+  } else if (count < buffer_count) {
+    buffer[count] = '\0';
+  } else if (count > buffer_count) {
+    // Truncated; the writer stopped at capacity.
     count = -1;
   }
   ctx.r3.u64 = count;
@@ -220,13 +204,12 @@ extern "C" PPC_FUNC(__imp__vsprintf) {
   auto format = reinterpret_cast<const uint8_t*>(PPC_RAW_ADDR(format_ptr));
 
   ArrayArgList args(base, arg_ptr);
-  StringFormatData data(format);
+  GuestStringFormatData data(format, buffer, INT32_MAX);
 
   int32_t count = format_core(base, data, args, false);
-  if (count <= 0) {
+  if (count < 0) {
     buffer[0] = '\0';
   } else {
-    std::memcpy(buffer, data.str().c_str(), count);
     buffer[count] = '\0';
   }
   ctx.r3.u64 = count;
@@ -247,20 +230,13 @@ extern "C" PPC_FUNC(__imp___vsnprintf) {
   auto format = reinterpret_cast<const uint8_t*>(PPC_RAW_ADDR(format_ptr));
 
   ArrayArgList args(base, arg_ptr);
-  StringFormatData data(format);
+  GuestStringFormatData data(format, buffer, buffer_count);
 
   int32_t count = format_core(base, data, args, false);
   if (count < 0) {
-    if (buffer_count > 0) {
-      buffer[0] = '\0';
-    }
-  } else if (count <= buffer_count) {
-    std::memcpy(buffer, data.str().c_str(), count);
-    if (count < buffer_count) {
-      buffer[count] = '\0';
-    }
-  } else {
-    std::memcpy(buffer, data.str().c_str(), buffer_count);
+    buffer[0] = '\0';
+  } else if (count < buffer_count) {
+    buffer[count] = '\0';
   }
   ctx.r3.u64 = count;
 }
@@ -283,14 +259,12 @@ extern "C" PPC_FUNC(__imp__vswprintf) {
   auto format = reinterpret_cast<const uint16_t*>(PPC_RAW_ADDR(format_ptr));
 
   ArrayArgList args(base, arg_ptr);
-  WideStringFormatData data(format);
+  GuestWideStringFormatData data(format, buffer, INT32_MAX);
 
   int32_t count = format_core(base, data, args, true);
-  if (count <= 0) {
+  if (count < 0) {
     buffer[0] = '\0';
   } else {
-    rex::memory::copy_and_swap(buffer, reinterpret_cast<const uint16_t*>(data.wstr().c_str()),
-                               count);
     buffer[count] = '\0';
   }
   ctx.r3.u64 = count;
@@ -311,22 +285,13 @@ extern "C" PPC_FUNC(__imp___vsnwprintf) {
   auto format = reinterpret_cast<const uint16_t*>(PPC_RAW_ADDR(format_ptr));
 
   ArrayArgList args(base, arg_ptr);
-  WideStringFormatData data(format);
+  GuestWideStringFormatData data(format, buffer, buffer_count);
 
   int32_t count = format_core(base, data, args, true);
   if (count < 0) {
-    if (buffer_count > 0) {
-      buffer[0] = '\0';
-    }
-  } else if (count <= buffer_count) {
-    rex::memory::copy_and_swap(buffer, reinterpret_cast<const uint16_t*>(data.wstr().c_str()),
-                               count);
-    if (count < buffer_count) {
-      buffer[count] = '\0';
-    }
-  } else {
-    rex::memory::copy_and_swap(buffer, reinterpret_cast<const uint16_t*>(data.wstr().c_str()),
-                               buffer_count);
+    buffer[0] = '\0';
+  } else if (count < buffer_count) {
+    buffer[count] = '\0';
   }
   ctx.r3.u64 = count;
 }
@@ -468,7 +468,7 @@ ppc_u32_result_t NtCreateEvent_entry(ppc_pu32_t handle_ptr,
 uint32_t xeNtSetEvent(uint32_t handle, rex::be<uint32_t>* previous_state_ptr) {
   X_STATUS result = X_STATUS_SUCCESS;
 
-  auto ev = kernel_state()->object_table()->LookupObject<XEvent>(handle);
+  auto ev = kernel_state()->object_table()->LookupObjectBorrowed<XEvent>(handle);
   if (ev) {
     int32_t was_signalled = ev->Set(0, false);
     if (previous_state_ptr) {
@@ -488,7 +488,7 @@ ppc_u32_result_t NtSetEvent_entry(ppc_u32_t handle, ppc_pu32_t previous_state_pt
 ppc_u32_result_t NtPulseEvent_entry(ppc_u32_t handle, ppc_pu32_t previous_state_ptr) {
   X_STATUS result = X_STATUS_SUCCESS;
 
-  auto ev = kernel_state()->object_table()->LookupObject<XEvent>(handle);
+  auto ev = kernel_state()->object_table()->LookupObjectBorrowed<XEvent>(handle);
   if (ev) {
     int32_t was_signalled = ev->Pulse(0, false);
     if (previous_state_ptr) {
@@ -504,7 +504,7 @@ ppc_u32_result_t NtPulseEvent_entry(ppc_u32_t handle, ppc_pu32_t previous_state_
 uint32_t xeNtClearEvent(uint32_t handle) {
   X_STATUS result = X_STATUS_SUCCESS;
 
-  auto ev = kernel_state()->object_table()->LookupObject<XEvent>(handle);
+  auto ev = kernel_state()->object_table()->LookupObjectBorrowed<XEvent>(handle);
   if (ev) {
     ev->Reset();
   } else {
@@ -596,7 +596,7 @@ ppc_u32_result_t NtReleaseSemaphore_entry(ppc_u32_t sem_handle, ppc_u32_t releas
   X_STATUS result = X_STATUS_SUCCESS;
   int32_t previous_count = 0;
 
-  auto sem = kernel_state()->object_table()->LookupObject<XSemaphore>(sem_handle);
+  auto sem = kernel_state()->object_table()->LookupObjectBorrowed<XSemaphore>(sem_handle);
   if (sem) {
     previous_count = sem->ReleaseSemaphore((int32_t)release_count);
   } else {
@@ -655,7 +655,7 @@ ppc_u32_result_t NtReleaseMutant_entry(ppc_u32_t mutant_handle, ppc_u32_t unknow
 
   X_STATUS result = X_STATUS_SUCCESS;
 
-  auto mutant = kernel_state()->object_table()->LookupObject<XMutant>(mutant_handle);
+  auto mutant = kernel_state()->object_table()->LookupObjectBorrowed<XMutant>(mutant_handle);
   if (mutant) {
     result = mutant->ReleaseMutant(priority_increment, abandon, wait);
   } else {
@@ -710,7 +710,7 @@ ppc_u32_result_t NtSetTimerEx_entry(ppc_u32_t timer_handle, ppc_pu64_t due_time_
 
   X_STATUS result = X_STATUS_SUCCESS;
 
-  auto timer = kernel_state()->object_table()->LookupObject<XTimer>(timer_handle);
+  auto timer = kernel_state()->object_table()->LookupObjectBorrowed<XTimer>(timer_handle);
   if (timer) {
     result = timer->SetTimer(due_time, period_ms, routine_ptr.guest_address(),
                              routine_arg.guest_address(), resume ? true : false);
@@ -724,7 +724,7 @@ ppc_u32_result_t NtSetTimerEx_entry(ppc_u32_t timer_handle, ppc_pu64_t due_time_
 ppc_u32_result_t NtCancelTimer_entry(ppc_u32_t timer_handle, ppc_pu32_t current_state_ptr) {
   X_STATUS result = X_STATUS_SUCCESS;
 
-  auto timer = kernel_state()->object_table()->LookupObject<XTimer>(timer_handle);
+  auto timer = kernel_state()->object_table()->LookupObjectBorrowed<XTimer>(timer_handle);
   if (timer) {
     result = timer->Cancel();
   } else {
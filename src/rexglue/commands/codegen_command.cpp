@@ -11,15 +11,180 @@
 
 #include "codegen_command.h"
 
+#include <algorithm>
+#include <cstdio>
 #include <filesystem>
+#include <memory>
+#include <optional>
 
 #include <fmt/format.h>
 
 #include <rex/codegen/codegen.h>
+#include <rex/codegen/phase_timing.h>
+#include <rex/cvar.h>
 #include <rex/logging.h>
 
+REXCVAR_DECLARE(std::string, timing_json);
+REXCVAR_DECLARE(uint32_t, bench_runs);
+REXCVAR_DECLARE(std::string, bench_json);
+
 namespace rexglue::cli {
 
+using rex::Err;
+using rex::ErrorCategory;
+using rex::Ok;
+
+namespace {
+
+/// Run one created pipeline: apply CLI overrides, run, report timings
+Result<void> RunPipeline(rex::codegen::CodegenPipeline& pipeline, const CliContext& ctx,
+                         const std::string& timingJsonPath) {
+  if (ctx.enableExceptionHandlers) {
+    pipeline.context().Config().generateExceptionHandlers = true;
+    REXLOG_INFO("Exception handler generation enabled");
+  }
+
+  auto result = pipeline.Run(ctx.force);
+
+  // Report where the time went even on failure - slow runs that die late are
+  // exactly the ones worth filing
+  const auto& timings = pipeline.context().timings;
+  REXLOG_INFO("{}", timings.report());
+
+  if (!timingJsonPath.empty()) {
+    if (timings.writeJson(timingJsonPath)) {
+      REXLOG_INFO("Timing report written to {}", timingJsonPath);
+    } else {
+      REXLOG_WARN("Failed to write timing report to {}", timingJsonPath);
+    }
+  }
+
+  return result;
+}
+
+/// Timing JSON path for one config; batch runs get one file per config
+std::string TimingJsonPathFor(const std::string& config_path, bool batch) {
+  std::string base = REXCVAR_GET(timing_json);
+  if (base.empty() || !batch) {
+    return base;
+  }
+  std::filesystem::path p(base);
+  auto stem = std::filesystem::path(config_path).stem().string();
+  return (p.parent_path() / fmt::format("{}.{}{}", p.stem().string(), stem,
+                                        p.extension().string()))
+      .string();
+}
+
+/// Per-phase wall times collected across benchmark runs
+struct BenchPhase {
+  std::string name;
+  std::vector<double> ms;
+};
+
+double Median(std::vector<double> values) {
+  std::sort(values.begin(), values.end());
+  size_t mid = values.size() / 2;
+  return values.size() % 2 ? values[mid] : (values[mid - 1] + values[mid]) / 2.0;
+}
+
+/// Benchmark mode: rerun the full pipeline per config and summarize per-phase
+/// wall time (minimum and median across runs) plus process peak RSS. The
+/// minimum is the regression gate number - it is the least noisy estimate of
+/// what the phase actually costs; the median shows run-to-run spread.
+Result<void> CodegenBench(const std::vector<std::string>& config_paths, const CliContext& ctx) {
+  const uint32_t runs = REXCVAR_GET(bench_runs);
+  REXLOG_INFO("Benchmark mode: {} run(s) per config", runs);
+
+  struct ConfigResult {
+    std::string config;
+    std::vector<BenchPhase> phases;
+    size_t functions = 0;
+    size_t instructions = 0;
+  };
+  std::vector<ConfigResult> results;
+
+  for (const auto& config_path : config_paths) {
+    ConfigResult entry;
+    entry.config = config_path;
+
+    for (uint32_t run = 0; run < runs; ++run) {
+      auto pipeline = rex::codegen::CodegenPipeline::Create(config_path);
+      if (!pipeline) {
+        return Err<void>(pipeline.error());
+      }
+      if (ctx.enableExceptionHandlers) {
+        pipeline->context().Config().generateExceptionHandlers = true;
+      }
+
+      // Always force: incremental emission would turn every run after the
+      // first into a cache hit and benchmark nothing.
+      auto result = pipeline->Run(/*force=*/true);
+      if (!result) {
+        return result;
+      }
+
+      const auto& timings = pipeline->context().timings;
+      entry.functions = timings.functionCount();
+      entry.instructions = timings.instructionCount();
+      const auto& phases = timings.phases();
+      for (size_t i = 0; i < phases.size(); ++i) {
+        if (i >= entry.phases.size()) {
+          entry.phases.push_back(BenchPhase{phases[i].name, {}});
+        }
+        entry.phases[i].ms.push_back(phases[i].ms);
+      }
+    }
+
+    std::string out = fmt::format("Benchmark: {} ({} functions, {} instructions, {} runs)\n",
+                                  entry.config, entry.functions, entry.instructions, runs);
+    for (const auto& phase : entry.phases) {
+      double min_ms = *std::min_element(phase.ms.begin(), phase.ms.end());
+      out += fmt::format("  {:<24} min {:>10.1f} ms  median {:>10.1f} ms\n", phase.name, min_ms,
+                         Median(phase.ms));
+    }
+    out += fmt::format("  {:<24}     {:>10.1f} MiB\n", "peak RSS",
+                       rex::codegen::PhaseTimings::QueryPeakRssKb() / 1024.0);
+    REXLOG_INFO("{}", out);
+
+    results.push_back(std::move(entry));
+  }
+
+  std::string json_path = REXCVAR_GET(bench_json);
+  if (!json_path.empty()) {
+    FILE* f = fopen(json_path.c_str(), "w");
+    if (f == nullptr) {
+      return Err<void>(ErrorCategory::Runtime,
+                       fmt::format("Failed to write benchmark summary to {}", json_path));
+    }
+    fprintf(f, "{\n");
+    fprintf(f, "  \"runs\": %u,\n", runs);
+    fprintf(f, "  \"peak_rss_kb\": %zu,\n", rex::codegen::PhaseTimings::QueryPeakRssKb());
+    fprintf(f, "  \"configs\": [\n");
+    for (size_t c = 0; c < results.size(); ++c) {
+      const auto& entry = results[c];
+      fprintf(f, "    {\"config\": \"%s\", \"functions\": %zu, \"instructions\": %zu,\n",
+              entry.config.c_str(), entry.functions, entry.instructions);
+      fprintf(f, "     \"phases\": [\n");
+      for (size_t i = 0; i < entry.phases.size(); ++i) {
+        const auto& phase = entry.phases[i];
+        double min_ms = *std::min_element(phase.ms.begin(), phase.ms.end());
+        fprintf(f, "       {\"name\": \"%s\", \"min_ms\": %.3f, \"median_ms\": %.3f}%s\n",
+                phase.name.c_str(), min_ms, Median(phase.ms),
+                i + 1 < entry.phases.size() ? "," : "");
+      }
+      fprintf(f, "     ]}%s\n", c + 1 < results.size() ? "," : "");
+    }
+    fprintf(f, "  ]\n");
+    fprintf(f, "}\n");
+    fclose(f);
+    REXLOG_INFO("Benchmark summary written to {}", json_path);
+  }
+
+  return Ok();
+}
+
+}  // namespace
+
 Result<void> CodegenFromConfig(const std::string& config_path, const CliContext& ctx) {
   REXLOG_INFO("Generating code with config: {}", config_path);
 
@@ -28,13 +193,61 @@ Result<void> CodegenFromConfig(const std::string& config_path, const CliContext&
     return Err<void>(pipeline.error());
   }
 
-  // Apply CLI overrides to config
-  if (ctx.enableExceptionHandlers) {
-    pipeline->context().Config().generateExceptionHandlers = true;
-    REXLOG_INFO("Exception handler generation enabled");
+  return RunPipeline(*pipeline, ctx, TimingJsonPathFor(config_path, /*batch=*/false));
+}
+
+Result<void> CodegenBatch(const std::vector<std::string>& config_paths, const CliContext& ctx) {
+  if (REXCVAR_GET(bench_runs) > 0) {
+    return CodegenBench(config_paths, ctx);
+  }
+
+  if (config_paths.size() == 1) {
+    return CodegenFromConfig(config_paths[0], ctx);
+  }
+
+  // Keep the previous pipeline alive so the next one can adopt its analysis
+  // cache when both configs target the same binary image (base + DLC
+  // configs) - discovery is the dominant cost and need not repeat.
+  std::optional<rex::codegen::CodegenPipeline> previous;
+  std::vector<std::string> failed;
+
+  for (size_t i = 0; i < config_paths.size(); i++) {
+    const auto& config_path = config_paths[i];
+    REXLOG_INFO("Generating code with config: {} ({}/{})", config_path, i + 1,
+                config_paths.size());
+
+    auto pipeline = rex::codegen::CodegenPipeline::Create(config_path);
+    if (!pipeline) {
+      REXLOG_ERROR("Failed to load {}: {}", config_path, pipeline.error().what());
+      failed.push_back(config_path);
+      continue;
+    }
+
+    if (previous) {
+      pipeline->AdoptAnalysisCache(*previous);
+    }
+
+    auto result = RunPipeline(*pipeline, ctx, TimingJsonPathFor(config_path, /*batch=*/true));
+    if (!result) {
+      REXLOG_ERROR("Codegen failed for {}: {}", config_path, result.error().what());
+      failed.push_back(config_path);
+    }
+
+    previous.emplace(std::move(*pipeline));
+  }
+
+  if (!failed.empty()) {
+    std::string failedList;
+    for (const auto& path : failed) {
+      failedList += failedList.empty() ? path : ", " + path;
+    }
+    return Err<void>(ErrorCategory::Runtime,
+                     fmt::format("Batch codegen: {}/{} configs failed ({})", failed.size(),
+                                 config_paths.size(), failedList));
   }
 
-  return pipeline->Run(ctx.force);
+  REXLOG_INFO("Batch codegen: all {} configs succeeded", config_paths.size());
+  return Ok();
 }
 
 }  // namespace rexglue::cli
@@ -14,6 +14,7 @@
 #include "../cli_utils.h"
 
 #include <string>
+#include <vector>
 
 #include <rex/result.h>
 
@@ -30,4 +31,18 @@ using rex::Result;
  */
 Result<void> CodegenFromConfig(const std::string& config_path, const CliContext& ctx);
 
+/**
+ * Generate C++ code for several related configs in one process.
+ *
+ * Configs are processed in order; when consecutive configs target the same
+ * binary image the expensive jump-table analysis is shared between them.
+ * A failing config does not stop the batch - all failures are reported at
+ * the end.
+ *
+ * @param config_paths Paths to TOML config files, in processing order
+ * @param ctx CLI context with template path
+ * @return Success if every config succeeded
+ */
+Result<void> CodegenBatch(const std::vector<std::string>& config_paths, const CliContext& ctx);
+
 }  // namespace rexglue::cli
@@ -140,6 +140,103 @@ std::string generate_cmakelists(const AppNameParts& names) {
   return content;
 }
 
+// Generate CMakePresets.json content (no vcpkg toolchain - SDK bundles all dependencies)
+std::string generate_cmake_presets() {
+  std::string content;
+
+  content += "{\n";
+  content += "    \"version\": 6,\n";
+  content += "    \"cmakeMinimumRequired\": { \"major\": 3, \"minor\": 25, \"patch\": 0 },\n";
+  content += "    \"configurePresets\": [\n";
+  content += "        {\n";
+  content += "            \"name\": \"windows-base\",\n";
+  content += "            \"hidden\": true,\n";
+  content += "            \"generator\": \"Ninja\",\n";
+  content += "            \"binaryDir\": \"${sourceDir}/out/build/${presetName}\",\n";
+  content += "            \"cacheVariables\": {\n";
+  content += "                \"CMAKE_C_COMPILER\": \"clang\",\n";
+  content += "                \"CMAKE_CXX_COMPILER\": \"clang++\"\n";
+  content += "            },\n";
+  content += "            \"condition\": {\n";
+  content += "                \"type\": \"equals\",\n";
+  content += "                \"lhs\": \"${hostSystemName}\",\n";
+  content += "                \"rhs\": \"Windows\"\n";
+  content += "            }\n";
+  content += "        },\n";
+  content += "        {\n";
+  content += "            \"name\": \"linux-base\",\n";
+  content += "            \"hidden\": true,\n";
+  content += "            \"generator\": \"Ninja\",\n";
+  content += "            \"binaryDir\": \"${sourceDir}/out/build/${presetName}\",\n";
+  content += "            \"cacheVariables\": {\n";
+  content += "                \"CMAKE_C_COMPILER\": \"clang-20\",\n";
+  content += "                \"CMAKE_CXX_COMPILER\": \"clang++-20\"\n";
+  content += "            },\n";
+  content += "            \"condition\": {\n";
+  content += "                \"type\": \"equals\",\n";
+  content += "                \"lhs\": \"${hostSystemName}\",\n";
+  content += "                \"rhs\": \"Linux\"\n";
+  content += "            }\n";
+  content += "        },\n";
+  content += "        {\n";
+  content += "            \"name\": \"win-amd64-debug\",\n";
+  content += "            \"displayName\": \"Windows AMD64 Debug\",\n";
+  content += "            \"inherits\": \"windows-base\",\n";
+  content += "            \"cacheVariables\": { \"CMAKE_BUILD_TYPE\": \"Debug\" }\n";
+  content += "        },\n";
+  content += "        {\n";
+  content += "            \"name\": \"win-amd64-release\",\n";
+  content += "            \"displayName\": \"Windows AMD64 Release\",\n";
+  content += "            \"inherits\": \"windows-base\",\n";
+  content += "            \"cacheVariables\": { \"CMAKE_BUILD_TYPE\": \"Release\" }\n";
+  content += "        },\n";
+  content += "        {\n";
+  content += "            \"name\": \"linux-amd64-debug\",\n";
+  content += "            \"displayName\": \"Linux AMD64 Debug\",\n";
+  content += "            \"inherits\": \"linux-base\",\n";
+  content += "            \"cacheVariables\": { \"CMAKE_BUILD_TYPE\": \"Debug\" }\n";
+  content += "        },\n";
+  content += "        {\n";
+  content += "            \"name\": \"linux-amd64-release\",\n";
+  content += "            \"displayName\": \"Linux AMD64 Release\",\n";
+  content += "            \"inherits\": \"linux-base\",\n";
+  content += "            \"cacheVariables\": { \"CMAKE_BUILD_TYPE\": \"Release\" }\n";
+  content += "        },\n";
+  content += "        {\n";
+  content += "            \"name\": \"win-amd64-relwithdebinfo\",\n";
+  content += "            \"displayName\": \"Windows AMD64 RelWithDebInfo\",\n";
+  content += "            \"inherits\": \"windows-base\",\n";
+  content += "            \"cacheVariables\": { \"CMAKE_BUILD_TYPE\": \"RelWithDebInfo\" }\n";
+  content += "        },\n";
+  content += "        {\n";
+  content += "            \"name\": \"linux-amd64-relwithdebinfo\",\n";
+  content += "            \"displayName\": \"Linux AMD64 RelWithDebInfo\",\n";
+  content += "            \"inherits\": \"linux-base\",\n";
+  content += "            \"cacheVariables\": { \"CMAKE_BUILD_TYPE\": \"RelWithDebInfo\" }\n";
+  content += "        }\n";
+  content += "    ],\n";
+  content += "    \"buildPresets\": [\n";
+  content +=
+      "        { \"name\": \"win-amd64-debug\", \"configurePreset\": \"win-amd64-debug\" },\n";
+  content +=
+      "        { \"name\": \"win-amd64-release\", \"configurePreset\": \"win-amd64-release\" },\n";
+  content +=
+      "        { \"name\": \"win-amd64-relwithdebinfo\", \"configurePreset\": "
+      "\"win-amd64-relwithdebinfo\" },\n";
+  content +=
+      "        { \"name\": \"linux-amd64-debug\", \"configurePreset\": \"linux-amd64-debug\" },\n";
+  content +=
+      "        { \"name\": \"linux-amd64-release\", \"configurePreset\": \"linux-amd64-release\" "
+      "},\n";
+  content +=
+      "        { \"name\": \"linux-amd64-relwithdebinfo\", \"configurePreset\": "
+      "\"linux-amd64-relwithdebinfo\" }\n";
+  content += "    ]\n";
+  content += "}\n";
+
+  return content;
+}
+
 std::string read_file_content(const fs::path& path) {
   std::ifstream file(path);
   if (!file)
@@ -192,27 +289,38 @@ Result<void> MigrateProject(const MigrateOptions& opts, const CliContext& ctx) {
 
   auto names = parse_app_name(config.projectName);
 
-  // Check which files will be modified and warn if they differ from the template
-  std::string new_main = generate_main_cpp(names);
-  std::string new_cmake = generate_cmakelists(names);
-  std::string old_main = read_file_content(root / "src" / "main.cpp");
-  std::string old_cmake = read_file_content(root / "CMakeLists.txt");
-
-  std::vector<std::string> modified_files;
-  if (old_main != new_main)
-    modified_files.push_back("src/main.cpp");
-  if (old_cmake != new_cmake)
-    modified_files.push_back("CMakeLists.txt");
+  // Diff every SDK-managed file against the current template up front. Files
+  // that already match are never reopened for writing, so their mtimes stay
+  // put and downstream incremental builds (and ccache) stay warm after an
+  // SDK upgrade that only touches some of the templates.
+  struct ManagedFile {
+    std::string relative;  // path shown to the user, relative to project root
+    std::string content;   // freshly generated template content
+    bool modified = false;
+  };
+
+  std::vector<ManagedFile> managed;
+  managed.push_back({"src/main.cpp", generate_main_cpp(names)});
+  managed.push_back({"CMakeLists.txt", generate_cmakelists(names)});
+  managed.push_back({"CMakePresets.json", generate_cmake_presets()});
+
+  size_t modifiedCount = 0;
+  for (auto& file : managed) {
+    file.modified = read_file_content(root / file.relative) != file.content;
+    if (file.modified)
+      ++modifiedCount;
+  }
 
-  if (modified_files.empty()) {
+  if (modifiedCount == 0) {
     REXLOG_INFO("Project '{}' is already up to date.", names.snake_case);
     return Ok();
   }
 
   if (!opts.force) {
     std::cerr << "The following files will be overwritten:\n";
-    for (const auto& f : modified_files) {
-      std::cerr << "  " << f << "\n";
+    for (const auto& file : managed) {
+      if (file.modified)
+        std::cerr << "  " << file.relative << "\n";
     }
     std::cerr << "\nAny local changes to these files will be lost.\n";
     std::cerr << "Continue? [y/N] " << std::flush;
@@ -227,21 +335,16 @@ Result<void> MigrateProject(const MigrateOptions& opts, const CliContext& ctx) {
 
   REXLOG_INFO("Migrating project '{}' at: {}", names.snake_case, root.string());
 
-  // Overwrite src/main.cpp
-  if (old_main != new_main) {
-    if (!write_file(root / "src" / "main.cpp", new_main)) {
-      return Err<void>(ErrorCategory::IO, "Failed to write src/main.cpp");
-    }
-    REXLOG_INFO("  Overwrote src/main.cpp");
-  }
-
-  // Overwrite CMakeLists.txt
-  if (old_cmake != new_cmake) {
-    if (!write_file(root / "CMakeLists.txt", new_cmake)) {
-      return Err<void>(ErrorCategory::IO, "Failed to write CMakeLists.txt");
+  for (const auto& file : managed) {
+    if (!file.modified)
+      continue;
+    if (!write_file(root / file.relative, file.content)) {
+      return Err<void>(ErrorCategory::IO, "Failed to write " + file.relative);
     }
-    REXLOG_INFO("  Overwrote CMakeLists.txt");
+    REXLOG_INFO("  Overwrote {}", file.relative);
   }
+  REXLOG_INFO("  {} of {} SDK-managed files unchanged, left untouched", managed.size() - modifiedCount,
+              managed.size());
 
   REXLOG_INFO("Migration complete. Re-run CMake configure to pick up changes.");
 
@@ -12,11 +12,13 @@
 #include "test_recompiler.h"
 
 #include <algorithm>
+#include <atomic>
 #include <charconv>
 #include <filesystem>
 #include <fstream>
 #include <map>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -53,7 +55,7 @@ std::map<size_t, std::string> parse_map_file(const std::string& mapPath) {
   rex::runtime::MapParseOptions options;
   options.base_address = TEST_BASE_ADDRESS;
 
-  auto result = rex::runtime::ParseNmMap(mapPath, options);
+  auto result = rex::runtime::ParseNmMapCached(mapPath, options);
   if (!result) {
     return symbols;
   }
@@ -324,85 +326,131 @@ bool recompile_tests(const std::string_view& binDirPath, const std::string_view&
   // Create output directory
   fs::create_directories(outDirPath);
 
-  // Track all functions per file
-  std::map<std::string, std::unordered_set<size_t>> functionsByFile;
-  std::vector<std::string> allFunctionNames;
-  std::stringstream functionsOut;
-
-  // Process each .bin file
+  // Collect the .bin files up front, sorted so the generated files do not
+  // depend on directory iteration order
+  std::vector<fs::path> binFiles;
   for (const auto& entry : fs::directory_iterator(binDirPath)) {
-    if (entry.path().extension() != ".bin") {
-      continue;
+    if (entry.path().extension() == ".bin") {
+      binFiles.push_back(entry.path());
     }
-
-    auto stem = entry.path().stem().string();
-    REXLOG_DEBUG("Processing binary file: {}", stem);
-
-    // Load the linked binary file
-    std::vector<uint8_t> fileData;
-    {
-      std::ifstream file(entry.path(), std::ios::binary | std::ios::ate);
-      if (!file) {
-        REXLOG_WARN("Failed to load binary file: {}", entry.path().string());
+  }
+  std::sort(binFiles.begin(), binFiles.end());
+
+  // Per-file results, merged in sorted order after the workers finish
+  struct FileResult {
+    std::string stem;
+    std::unordered_set<size_t> functionAddresses;
+    std::vector<std::string> functionNames;
+    std::string functionsOut;
+  };
+  std::vector<FileResult> results(binFiles.size());
+
+  // Shard the binaries across cores. Every file gets its own module, context
+  // and recompiler, so workers share nothing but the claim counter; the
+  // disassembler is thread_local and the map cache is per-path.
+  std::atomic<size_t> nextFile{0};
+  auto workerMain = [&]() {
+    for (size_t i = nextFile.fetch_add(1); i < binFiles.size(); i = nextFile.fetch_add(1)) {
+      const auto& binPath = binFiles[i];
+      auto stem = binPath.stem().string();
+      REXLOG_DEBUG("Processing binary file: {}", stem);
+
+      // Load the linked binary file
+      std::vector<uint8_t> fileData;
+      {
+        std::ifstream file(binPath, std::ios::binary | std::ios::ate);
+        if (!file) {
+          REXLOG_WARN("Failed to load binary file: {}", binPath.string());
+          continue;
+        }
+        auto size = file.tellg();
+        file.seekg(0, std::ios::beg);
+        fileData.resize(static_cast<size_t>(size));
+        file.read(reinterpret_cast<char*>(fileData.data()), size);
+      }
+      if (fileData.empty()) {
         continue;
       }
-      auto size = file.tellg();
-      file.seekg(0, std::ios::beg);
-      fileData.resize(static_cast<size_t>(size));
-      file.read(reinterpret_cast<char*>(fileData.data()), size);
-    }
-    if (fileData.empty()) {
-      continue;
-    }
 
-    // Load map file (required)
-    auto mapPath = fmt::format("{}/{}.map", binDirPath, stem);
-    auto symbols = parse_map_file(mapPath);
-    if (symbols.empty()) {
-      REXLOG_ERROR("No symbols found in map file: {}", mapPath);
-      continue;
-    }
+      // Load map file (required)
+      auto mapPath = fmt::format("{}/{}.map", binDirPath, stem);
+      auto symbols = parse_map_file(mapPath);
+      if (symbols.empty()) {
+        REXLOG_ERROR("No symbols found in map file: {}", mapPath);
+        continue;
+      }
 
-    // Create TestModule and load the binary data
-    codegen::TestModule module;
-    module.Load(TEST_BASE_ADDRESS, fileData.data(), fileData.size());
-    module.set_name(stem);
-
-    // Create recompiler and CodegenContext from our module
-    codegen::Recompiler recompiler;
-    codegen::RecompilerConfig config;
-    config.outDirectoryPath = std::string(outDirPath);
-    auto ctx =
-        codegen::CodegenContext::Create(codegen::BinaryView::fromModule(module), std::move(config));
-    recompiler.ctx_ = &ctx;
-
-    // Analyze functions using test_ prefixed symbols from map
-    codegen::AnalyzeTestBinary(ctx, stem, symbols, TEST_BASE_ADDRESS, fileData.data(),
-                               fileData.size());
-
-    REXLOG_DEBUG("  Found {} functions", recompiler.ctx_->graph.functionCount());
-
-    // Build sorted function list from graph
-    std::vector<const codegen::FunctionNode*> functions;
-    for (const auto& [addr, node] : recompiler.ctx_->graph.functions()) {
-      functions.push_back(node.get());
-    }
-    std::sort(functions.begin(), functions.end(),
-              [](const auto* a, const auto* b) { return a->base() < b->base(); });
-
-    // Recompile each function
-    for (const auto* fn : functions) {
-      if (recompiler.recompile(*fn)) {
-        functionsByFile[stem].emplace(fn->base());
-        // Collect function name for forward declaration
-        allFunctionNames.push_back(fmt::format("{}_{:X}", stem, fn->base()));
-      } else {
-        REXLOG_WARN("Function {:X} in {} has unimplemented instructions", fn->base(), stem);
+      // Create TestModule and load the binary data
+      codegen::TestModule module;
+      module.Load(TEST_BASE_ADDRESS, fileData.data(), fileData.size());
+      module.set_name(stem);
+
+      // Create recompiler and CodegenContext from our module
+      codegen::Recompiler recompiler;
+      codegen::RecompilerConfig config;
+      config.outDirectoryPath = std::string(outDirPath);
+      auto ctx = codegen::CodegenContext::Create(codegen::BinaryView::fromModule(module),
+                                                 std::move(config));
+      recompiler.ctx_ = &ctx;
+
+      // Analyze functions using test_ prefixed symbols from map
+      codegen::AnalyzeTestBinary(ctx, stem, symbols, TEST_BASE_ADDRESS, fileData.data(),
+                                 fileData.size());
+
+      REXLOG_DEBUG("  Found {} functions", recompiler.ctx_->graph.functionCount());
+
+      // Build sorted function list from graph
+      std::vector<const codegen::FunctionNode*> functions;
+      for (const auto& [addr, node] : recompiler.ctx_->graph.functions()) {
+        functions.push_back(node);
       }
+      std::sort(functions.begin(), functions.end(),
+                [](const auto* a, const auto* b) { return a->base() < b->base(); });
+
+      auto& result = results[i];
+      result.stem = stem;
+
+      // Recompile each function
+      for (const auto* fn : functions) {
+        if (recompiler.recompile(*fn)) {
+          result.functionAddresses.emplace(fn->base());
+          // Collect function name for forward declaration
+          result.functionNames.push_back(fmt::format("{}_{:X}", stem, fn->base()));
+        } else {
+          REXLOG_WARN("Function {:X} in {} has unimplemented instructions", fn->base(), stem);
+        }
+      }
+
+      result.functionsOut = std::move(recompiler.out);
     }
+  };
 
-    // Get recompiled code and append to output
-    functionsOut << recompiler.out;
+  const size_t jobCount =
+      std::min(binFiles.size(), static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency())));
+  if (jobCount > 1) {
+    std::vector<std::thread> workers;
+    workers.reserve(jobCount);
+    for (size_t i = 0; i < jobCount; i++)
+      workers.emplace_back(workerMain);
+    for (auto& worker : workers)
+      worker.join();
+  } else {
+    workerMain();
+  }
+
+  // Track all functions per file
+  std::map<std::string, std::unordered_set<size_t>> functionsByFile;
+  std::vector<std::string> allFunctionNames;
+  std::stringstream functionsOut;
+
+  for (auto& result : results) {
+    if (result.stem.empty())
+      continue;
+    for (auto& name : result.functionNames)
+      allFunctionNames.push_back(std::move(name));
+    if (!result.functionAddresses.empty())
+      functionsByFile[result.stem] = std::move(result.functionAddresses);
+    functionsOut << result.functionsOut;
     functionsOut << "\n";
   }
 
@@ -0,0 +1,290 @@
+/**
+ * @file        rexglue/commands/test_runner.cpp
+ * @brief       Parallel PPC test runner implementation
+ *
+ * @copyright   Copyright (c) 2026 Tom Clay <tomc@tctechstuff.com>
+ *              All rights reserved.
+ *
+ * @license     BSD 3-Clause License
+ *              See LICENSE file in the project root for full license text.
+ */
+
+#include "test_runner.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <rex/logging.h>
+
+namespace fs = std::filesystem;
+
+namespace rexglue::commands {
+
+namespace {
+
+/// One shard per test binary stem (instr_add, instr_lwz, ...). The generated
+/// Catch2 cases tag every test with its stem, so a shard runs as one child
+/// process with a "[stem]" filter.
+struct Shard {
+  std::string stem;
+  bool ran = false;
+  bool failed = false;
+  std::string output;
+};
+
+/// FNV-1a over file contents; only used to detect builder source changes
+/// between runs, so no cross-platform stability requirements beyond that.
+uint64_t hash_file(const fs::path& path) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in.is_open())
+    return 0;
+
+  uint64_t hash = 0xCBF29CE484222325ull;
+  char buffer[4096];
+  while (in.read(buffer, sizeof(buffer)) || in.gcount() > 0) {
+    for (std::streamsize i = 0; i < in.gcount(); ++i) {
+      hash ^= static_cast<uint8_t>(buffer[i]);
+      hash *= 0x100000001B3ull;
+    }
+  }
+  return hash;
+}
+
+/// Collect the build_<mnemonic> definitions a builder source contains. Files
+/// without any (helpers, dispatch tables, shared context code) affect every
+/// shard and force a full run when they change.
+std::unordered_set<std::string> collect_builder_mnemonics(const fs::path& path) {
+  std::unordered_set<std::string> mnemonics;
+  std::ifstream in(path);
+  if (!in.is_open())
+    return mnemonics;
+
+  std::string line;
+  while (std::getline(in, line)) {
+    size_t pos = 0;
+    while ((pos = line.find("build_", pos)) != std::string::npos) {
+      size_t start = pos + 6;
+      size_t end = start;
+      while (end < line.size() && (std::isalnum(static_cast<unsigned char>(line[end])) ||
+                                   line[end] == '_')) {
+        end++;
+      }
+      if (end > start)
+        mnemonics.insert(line.substr(start, end - start));
+      pos = end;
+    }
+  }
+  return mnemonics;
+}
+
+/// The stamp records the hash of every watched builder file at the last run
+/// where all shards passed; quick mode diffs against it.
+fs::path stamp_path(const RunTestsOptions& options) {
+  return fs::path(options.testsBinPath + ".lastgreen");
+}
+
+std::unordered_map<std::string, uint64_t> load_stamp(const fs::path& path) {
+  std::unordered_map<std::string, uint64_t> hashes;
+  FILE* f = fopen(path.string().c_str(), "r");
+  if (!f)
+    return hashes;
+
+  unsigned long long hash = 0;
+  char name[256];
+  while (fscanf(f, "%llx %255s", &hash, name) == 2)
+    hashes.emplace(name, static_cast<uint64_t>(hash));
+  fclose(f);
+  return hashes;
+}
+
+void save_stamp(const fs::path& path, const std::map<std::string, uint64_t>& hashes) {
+  FILE* f = fopen(path.string().c_str(), "w");
+  if (!f) {
+    REXLOG_WARN("Failed to write green-run stamp: {}", path.string());
+    return;
+  }
+  for (const auto& [name, hash] : hashes)
+    fprintf(f, "%llx %s\n", static_cast<unsigned long long>(hash), name.c_str());
+  fclose(f);
+}
+
+/// Run one shard as a child process and capture its combined output.
+/// @return process exit status (0 = all tests passed)
+int run_shard(const std::string& testsBinPath, const std::string& stem, std::string& output) {
+  // --allow-running-no-tests keeps helper-only stems from counting as
+  // failures when their filter matches nothing
+  auto command = fmt::format("\"{}\" \"[{}]\" --allow-running-no-tests 2>&1", testsBinPath, stem);
+
+#ifdef _WIN32
+  FILE* pipe = _popen(command.c_str(), "r");
+#else
+  FILE* pipe = popen(command.c_str(), "r");
+#endif
+  if (!pipe) {
+    output = fmt::format("failed to launch: {}", command);
+    return -1;
+  }
+
+  char buffer[4096];
+  size_t bytes = 0;
+  while ((bytes = fread(buffer, 1, sizeof(buffer), pipe)) > 0)
+    output.append(buffer, bytes);
+
+#ifdef _WIN32
+  return _pclose(pipe);
+#else
+  return pclose(pipe);
+#endif
+}
+
+}  // anonymous namespace
+
+bool run_tests(const RunTestsOptions& options) {
+  if (!fs::exists(options.testsBinPath)) {
+    REXLOG_ERROR("Test executable not found: {}", options.testsBinPath);
+    return false;
+  }
+
+  // One shard per assembly source; stems double as Catch2 tags
+  std::vector<Shard> shards;
+  for (const auto& entry : fs::directory_iterator(options.asmDirPath)) {
+    if (entry.path().extension() == ".s")
+      shards.push_back({entry.path().stem().string()});
+  }
+  std::sort(shards.begin(), shards.end(),
+            [](const Shard& a, const Shard& b) { return a.stem < b.stem; });
+
+  if (shards.empty()) {
+    REXLOG_ERROR("No .s test sources found in {}", options.asmDirPath);
+    return false;
+  }
+
+  // Hash the builder sources and, in quick mode, drop shards whose builders
+  // are unchanged since the last green run. A changed file with no
+  // build_<mnemonic> definitions (helpers, shared emission code) can affect
+  // anything, so it forces the full sweep.
+  std::map<std::string, uint64_t> builderHashes;
+  size_t skipped = 0;
+  if (!options.buildersDirPath.empty() && fs::exists(options.buildersDirPath)) {
+    std::unordered_set<std::string> changedMnemonics;
+    std::unordered_set<std::string> allMnemonics;
+    bool fullRun = !options.quick;
+
+    auto previous = load_stamp(stamp_path(options));
+    if (previous.empty())
+      fullRun = true;  // no green run recorded yet
+
+    for (const auto& entry : fs::directory_iterator(options.buildersDirPath)) {
+      auto ext = entry.path().extension();
+      if (ext != ".cpp" && ext != ".h")
+        continue;
+
+      auto name = entry.path().filename().string();
+      builderHashes[name] = hash_file(entry.path());
+
+      auto mnemonics = collect_builder_mnemonics(entry.path());
+      allMnemonics.insert(mnemonics.begin(), mnemonics.end());
+
+      auto it = previous.find(name);
+      if (it != previous.end() && it->second == builderHashes[name])
+        continue;  // unchanged since last green run
+
+      if (mnemonics.empty())
+        fullRun = true;
+      else
+        changedMnemonics.insert(mnemonics.begin(), mnemonics.end());
+    }
+
+    if (options.quick && !fullRun) {
+      for (auto& shard : shards) {
+        // Stems are instr_<mnemonic>; a stem no builder claims keeps running
+        // unconditionally rather than silently rotting
+        auto mnemonic = shard.stem.rfind("instr_", 0) == 0 ? shard.stem.substr(6) : shard.stem;
+        if (allMnemonics.contains(mnemonic) && !changedMnemonics.contains(mnemonic)) {
+          shard.failed = false;
+          skipped++;
+        } else {
+          shard.ran = true;  // marked for execution below
+        }
+      }
+      REXLOG_INFO("Quick mode: {} of {} shards affected by builder changes", shards.size() - skipped,
+                  shards.size());
+    } else {
+      for (auto& shard : shards)
+        shard.ran = true;
+      if (options.quick)
+        REXLOG_INFO("Quick mode: shared builder source changed, running the full sweep");
+    }
+  } else {
+    if (options.quick)
+      REXLOG_WARN("--quick requires --builders_dir; running the full sweep");
+    for (auto& shard : shards)
+      shard.ran = true;
+  }
+
+  // Shard execution: worker threads claim stems from a shared counter and
+  // run each one as its own ppc_tests process, so a crash in generated code
+  // takes down one shard instead of the sweep
+  std::atomic<size_t> nextShard{0};
+  auto workerMain = [&]() {
+    for (size_t i = nextShard.fetch_add(1); i < shards.size(); i = nextShard.fetch_add(1)) {
+      auto& shard = shards[i];
+      if (!shard.ran)
+        continue;
+      shard.failed = run_shard(options.testsBinPath, shard.stem, shard.output) != 0;
+    }
+  };
+
+  const size_t jobCount = std::min(
+      shards.size(),
+      options.jobs ? options.jobs : static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency())));
+  std::vector<std::thread> workers;
+  workers.reserve(jobCount);
+  for (size_t i = 0; i < jobCount; i++)
+    workers.emplace_back(workerMain);
+  for (auto& worker : workers)
+    worker.join();
+
+  // Aggregated report: every failing shard's full Catch2 output (expected vs
+  // actual expansions included) in one place, then the summary
+  size_t ran = 0;
+  size_t failures = 0;
+  for (const auto& shard : shards) {
+    if (!shard.ran)
+      continue;
+    ran++;
+    if (shard.failed) {
+      failures++;
+      REXLOG_ERROR("Shard [{}] failed:", shard.stem);
+      fputs(shard.output.c_str(), stderr);
+    }
+  }
+
+  if (failures) {
+    REXLOG_ERROR("PPC tests: {} of {} shards failed ({} skipped)", failures, ran, skipped);
+    return false;
+  }
+
+  REXLOG_INFO("PPC tests: {} shards passed ({} skipped)", ran, skipped);
+
+  // Record the green run so the next --quick sweep can diff against it
+  if (!builderHashes.empty())
+    save_stamp(stamp_path(options), builderHashes);
+
+  return true;
+}
+
+}  // namespace rexglue::commands
@@ -0,0 +1,33 @@
+/**
+ * @file        rexglue/commands/test_runner.h
+ * @brief       Parallel PPC test runner interface
+ *
+ * @copyright   Copyright (c) 2026 Tom Clay <tomc@tctechstuff.com>
+ *              All rights reserved.
+ *
+ * @license     BSD 3-Clause License
+ *              See LICENSE file in the project root for full license text.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace rexglue::commands {
+
+/// Options for the run-tests command
+struct RunTestsOptions {
+  std::string testsBinPath;     ///< Path to the ppc_tests executable
+  std::string asmDirPath;       ///< Directory with .s test sources; one shard per stem
+  std::string buildersDirPath;  ///< Builder sources watched by quick mode (optional)
+  size_t jobs = 0;              ///< Worker processes; 0 = hardware concurrency
+  bool quick = false;  ///< Only rerun shards whose builder source changed since the last green run
+};
+
+/// Run the PPC instruction tests sharded across worker processes, one shard
+/// per test binary, with failure output aggregated into a single report.
+/// @return true if every shard passed
+bool run_tests(const RunTestsOptions& options);
+
+}  // namespace rexglue::commands
@@ -11,10 +11,13 @@
 #include "commands/init_command.h"
 #include "commands/migrate_command.h"
 #include "commands/test_recompiler.h"
+#include "commands/test_runner.h"
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <map>
+#include <vector>
 
 #include <rex/cvar.h>
 #include <rex/logging.h>
@@ -31,6 +34,14 @@ REXCVAR_DEFINE_STRING(asm_dir, "", "RecompileTests",
                       "Directory containing .s assembly source files");
 REXCVAR_DEFINE_STRING(output, "", "RecompileTests", "Output path for recompile-tests");
 
+// Run-tests flags
+REXCVAR_DEFINE_STRING(tests_bin, "", "RunTests", "Path to the ppc_tests executable");
+REXCVAR_DEFINE_STRING(builders_dir, "", "RunTests",
+                      "Builder sources watched by --quick (src/codegen/builders)");
+REXCVAR_DEFINE_INT32(test_jobs, 0, "RunTests", "Worker processes (0 = hardware concurrency)");
+REXCVAR_DEFINE_BOOL(quick, false, "RunTests",
+                    "Only rerun shards whose builder source changed since the last green run");
+
 // Init flags
 REXCVAR_DEFINE_STRING(app_name, "", "Init", "Project name for init command");
 REXCVAR_DEFINE_STRING(app_root, "", "Init", "Project root directory for init command");
@@ -45,10 +56,13 @@ void PrintUsage() {
   std::cerr << "ReXGlue - Xbox 360 Recompilation Toolkit\n\n";
   std::cerr << "Usage: rexglue <command> [flags] [args]\n\n";
   std::cerr << "Commands:\n";
-  std::cerr << "  codegen <config.toml>   Analyze XEX and generate C++ code\n";
+  std::cerr << "  codegen <config.toml> [more.toml...]\n";
+  std::cerr << "                          Analyze XEX and generate C++ code; multiple\n";
+  std::cerr << "                          configs run as one batch sharing analysis\n";
   std::cerr << "  init                    Initialize a new project\n";
   std::cerr << "  migrate                 Migrate project to current SDK version\n";
-  std::cerr << "  recompile-tests         Generate Catch2 tests from PPC assembly\n\n";
+  std::cerr << "  recompile-tests         Generate Catch2 tests from PPC assembly\n";
+  std::cerr << "  run-tests               Run PPC tests sharded across worker processes\n\n";
   std::cerr << "Run 'rexglue --help' for flag details.\n";
 }
 
@@ -119,15 +133,11 @@ int main(int argc, char** argv) {
     result = rexglue::cli::InitProject(opts, ctx);
   } else if (command == "codegen") {
     if (remaining.size() < 2) {
-      REXLOG_ERROR("Missing config path. Usage: rexglue codegen <config.toml>");
-      return 1;
-    }
-    if (remaining.size() > 2) {
-      REXLOG_ERROR("Too many arguments for codegen command");
+      REXLOG_ERROR("Missing config path. Usage: rexglue codegen <config.toml> [more.toml...]");
       return 1;
     }
-    std::string config_path = remaining[1];
-    result = rexglue::cli::CodegenFromConfig(config_path, ctx);
+    std::vector<std::string> config_paths(remaining.begin() + 1, remaining.end());
+    result = rexglue::cli::CodegenBatch(config_paths, ctx);
   } else if (command == "recompile-tests") {
     std::string bin_dir = REXCVAR_GET(bin_dir);
     std::string asm_dir = REXCVAR_GET(asm_dir);
@@ -142,6 +152,23 @@ int main(int argc, char** argv) {
       REXLOG_ERROR("Test recompilation failed");
       return 1;
     }
+  } else if (command == "run-tests") {
+    rexglue::commands::RunTestsOptions opts;
+    opts.testsBinPath = REXCVAR_GET(tests_bin);
+    opts.asmDirPath = REXCVAR_GET(asm_dir);
+    opts.buildersDirPath = REXCVAR_GET(builders_dir);
+    opts.jobs = static_cast<size_t>(std::max(0, REXCVAR_GET(test_jobs)));
+    opts.quick = REXCVAR_GET(quick);
+
+    if (opts.testsBinPath.empty() || opts.asmDirPath.empty()) {
+      REXLOG_ERROR("--tests_bin and --asm_dir are required");
+      return 1;
+    }
+
+    if (!rexglue::commands::run_tests(opts)) {
+      REXLOG_ERROR("PPC tests failed");
+      return 1;
+    }
   } else if (command == "migrate") {
     rexglue::cli::MigrateOptions opts;
     opts.app_root = REXCVAR_GET(app_root);
@@ -0,0 +1,163 @@
+/**
+ * @file        system/coverage_profiler.cpp
+ * @brief       Snapshot/report of recompiled-function call counters
+ *
+ * @copyright   Copyright (c) 2026 Tom Clay <tomc@tctechstuff.com>
+ *              All rights reserved.
+ *
+ * @license     BSD 3-Clause License
+ *              See LICENSE file in the project root for full license text.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <rex/cvar.h>
+#include <rex/logging.h>
+#include <rex/platform.h>
+#include <rex/ppc/coverage.h>
+#include <rex/system/coverage_profiler.h>
+#include <rex/system/map_parser.h>
+
+REXCVAR_DEFINE_STRING(coverage_dump, "", "Runtime",
+                      "Write per-function call counts here at shutdown as "
+                      "\"<hex address> <call count>\" lines (codegen profile_path format)");
+REXCVAR_DEFINE_STRING(coverage_map, "", "Runtime",
+                      "nm-style .map file used to name functions in the coverage report");
+
+// Linker-provided bounds of the counter section emitted by instrumented
+// builds. Weak so uninstrumented builds still link; the section and these
+// symbols simply don't exist then.
+#if REX_PLATFORM_MAC
+extern "C" rex::PPCFuncCounter __rex_fn_counters_start[] __asm(
+    "section$start$__DATA$rex_fn_cnt") __attribute__((weak));
+extern "C" rex::PPCFuncCounter __rex_fn_counters_stop[] __asm(
+    "section$end$__DATA$rex_fn_cnt") __attribute__((weak));
+#elif !REX_PLATFORM_WIN32
+extern "C" __attribute__((weak)) rex::PPCFuncCounter __rex_fn_counters_start[] __asm(
+    "__start_rex_fn_counters");
+extern "C" __attribute__((weak)) rex::PPCFuncCounter __rex_fn_counters_stop[] __asm(
+    "__stop_rex_fn_counters");
+#endif
+
+namespace rex::runtime {
+
+namespace {
+
+const PPCFuncCounter* CountersBegin() {
+#if REX_PLATFORM_WIN32
+  // MSVC link has no section-bounds symbols; counters are reported on the
+  // toolchains the generated code targets.
+  return nullptr;
+#else
+  return __rex_fn_counters_start;
+#endif
+}
+
+const PPCFuncCounter* CountersEnd() {
+#if REX_PLATFORM_WIN32
+  return nullptr;
+#else
+  return __rex_fn_counters_stop;
+#endif
+}
+
+std::string FormatFunction(uint32_t address, const std::vector<BinarySymbol>& symbols) {
+  if (!symbols.empty()) {
+    // Symbols are address-sorted - attribute to the closest preceding one.
+    auto it = std::upper_bound(
+        symbols.begin(), symbols.end(), address,
+        [](uint32_t value, const BinarySymbol& symbol) { return value < symbol.address; });
+    if (it != symbols.begin()) {
+      --it;
+      if (!it->size || address < it->address + it->size) {
+        if (address == it->address) {
+          return it->name;
+        }
+        return fmt::format("{}+{:#x}", it->name, address - it->address);
+      }
+    }
+  }
+  return fmt::format("sub_{:08X}", address);
+}
+
+}  // namespace
+
+bool CoverageProfiler::available() {
+  return CountersBegin() != CountersEnd();
+}
+
+void CoverageProfiler::WriteReport() {
+  const PPCFuncCounter* begin = CountersBegin();
+  const PPCFuncCounter* end = CountersEnd();
+  if (begin == end) {
+    return;
+  }
+
+  struct Entry {
+    uint32_t address;
+    uint64_t count;
+  };
+  std::vector<Entry> executed;
+  size_t total_functions = size_t(end - begin);
+  uint64_t total_calls = 0;
+  for (const PPCFuncCounter* counter = begin; counter != end; ++counter) {
+    uint64_t count = counter->count.load(std::memory_order_relaxed);
+    if (count) {
+      executed.push_back({counter->guest_address, count});
+      total_calls += count;
+    }
+  }
+
+  REXSYS_INFO("Coverage: {} of {} recompiled functions executed, {} calls total", executed.size(),
+              total_functions, total_calls);
+  if (executed.empty()) {
+    return;
+  }
+
+  const std::string& dump_path = REXCVAR_GET(coverage_dump);
+  if (!dump_path.empty()) {
+    FILE* f = fopen(dump_path.c_str(), "w");
+    if (f == nullptr) {
+      REXSYS_WARN("Coverage: failed to write {}", dump_path);
+    } else {
+      // Address-sorted so diffs between runs stay readable.
+      std::sort(executed.begin(), executed.end(),
+                [](const Entry& a, const Entry& b) { return a.address < b.address; });
+      fprintf(f, "# rexglue function coverage: <guest address> <call count>\n");
+      for (const Entry& entry : executed) {
+        fprintf(f, "%08x %llu\n", entry.address, (unsigned long long)entry.count);
+      }
+      fclose(f);
+      REXSYS_INFO("Coverage dump written to {} (usable as codegen profile_path)", dump_path);
+    }
+  }
+
+  std::vector<BinarySymbol> symbols;
+  const std::string& map_path = REXCVAR_GET(coverage_map);
+  if (!map_path.empty()) {
+    MapParseOptions options;
+    options.functions_only = true;
+    auto parsed = ParseNmMapCached(map_path, options);
+    if (parsed) {
+      symbols = std::move(*parsed);
+      std::sort(symbols.begin(), symbols.end(),
+                [](const BinarySymbol& a, const BinarySymbol& b) { return a.address < b.address; });
+    } else {
+      REXSYS_WARN("Coverage: failed to load {}: {}", map_path, to_string(parsed.error()));
+    }
+  }
+
+  std::sort(executed.begin(), executed.end(),
+            [](const Entry& a, const Entry& b) { return a.count > b.count; });
+  constexpr size_t kMaxReportLines = 50;
+  for (size_t i = 0; i < executed.size() && i < kMaxReportLines; ++i) {
+    REXSYS_INFO("  {:>12} calls  {}", executed[i].count,
+                FormatFunction(executed[i].address, symbols));
+  }
+}
+
+}  // namespace rex::runtime
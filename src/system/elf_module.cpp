@@ -10,19 +10,30 @@
  */
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
+#include <mutex>
 
+#include <rex/cvar.h>
+#include <rex/exception_handler.h>
+#include <rex/filesystem/entry.h>
+#include <rex/filesystem/vfs.h>
 #include <rex/logging.h>
 #include <rex/system/elf_module.h>
+#include <rex/system/kernel_state.h>
 #include <rex/system/processor.h>
 #include <rex/types.h>
 
+REXCVAR_DEFINE_BOOL(elf_lazy_loading, true, "Runtime",
+                    "Populate ELF segments on first touch from a file mapping instead of "
+                    "copying them all into guest memory up front");
+
 namespace rex::runtime {
 
 ElfModule::ElfModule(Processor* processor, system::KernelState* kernel_state)
     : Module(processor), kernel_state_(kernel_state) {}
 
-ElfModule::~ElfModule() = default;
+ElfModule::~ElfModule() { Unload(); }
 
 // ELF structures
 struct elf32_ehdr {
@@ -109,6 +120,17 @@ bool ElfModule::Load(const std::string_view name, const std::string_view path, c
   assert_true(hdr->e_phentsize == sizeof(elf32_phdr));
   elf32_phdr* phdr = (elf32_phdr*)(pelf + hdr->e_phoff);
 
+  // Demand-paged loading: when the ELF comes from a mappable VFS entry, keep
+  // a read-only file mapping around and populate segment pages on first
+  // touch instead of copying (and zeroing) everything here. Large homebrew
+  // images then "load" in the time it takes to reserve address space.
+  if (REXCVAR_GET(elf_lazy_loading) && kernel_state_ && kernel_state_->file_system()) {
+    auto fs_entry = kernel_state_->file_system()->ResolvePath(path_);
+    if (fs_entry && fs_entry->can_map()) {
+      elf_mapping_ = fs_entry->OpenMapped(memory::MappedMemory::Mode::kRead);
+    }
+  }
+
   // Calculate base address and image size from loaded segments
   uint32_t min_addr = UINT32_MAX;
   uint32_t max_addr = 0;
@@ -142,9 +164,28 @@ bool ElfModule::Load(const std::string_view name, const std::string_view path, c
         REXLOG_ERROR("ELF: Could not allocate memory!");
       }
 
-      auto p = memory()->TranslateVirtual(phdr[i].p_vaddr);
-      std::memset(p, 0, phdr[i].p_memsz);
-      std::memcpy(p, pelf + phdr[i].p_offset, phdr[i].p_filesz);
+      // Lazy path: leave the pages inaccessible and remember how to fill
+      // them; the fault handler installed below does the copy on demand.
+      // Requires the file mapping to actually cover the segment and the
+      // committed pages to take the protection change.
+      bool materialize_lazily =
+          elf_mapping_ && uint64_t(phdr[i].p_offset) + phdr[i].p_filesz <= elf_mapping_->size() &&
+          memory()
+              ->LookupHeap(virtual_addr)
+              ->Protect(virtual_addr, virtual_size, rex::memory::kMemoryProtectNoAccess);
+      if (materialize_lazily) {
+        uint32_t page_size = memory()->LookupHeap(virtual_addr)->page_size();
+        LazyRange range;
+        range.guest_address = virtual_addr;
+        range.size = virtual_size;
+        range.materialized_pages.resize(virtual_size / page_size, false);
+        lazy_ranges_.push_back(std::move(range));
+        lazy_segments_.push_back({phdr[i].p_vaddr, phdr[i].p_filesz, phdr[i].p_offset});
+      } else {
+        auto p = memory()->TranslateVirtual(phdr[i].p_vaddr);
+        std::memset(p, 0, phdr[i].p_memsz);
+        std::memcpy(p, pelf + phdr[i].p_offset, phdr[i].p_filesz);
+      }
 
       // crack: No JIT backend to notify about executable code
       // In JIT mode this would be: processor_->backend()->CommitExecutableRange(...)
@@ -153,6 +194,14 @@ bool ElfModule::Load(const std::string_view name, const std::string_view path, c
     }
   }
 
+  if (!lazy_ranges_.empty()) {
+    arch::ExceptionHandler::Install(ExceptionCallbackThunk, this);
+    fault_handler_installed_ = true;
+    REXLOG_DEBUG("ELF: demand-paging {} segment(s) from {}", lazy_segments_.size(), path_);
+  } else {
+    elf_mapping_.reset();
+  }
+
   // Set base address and image size
   base_address_ = (min_addr != UINT32_MAX) ? min_addr : 0;
   image_size_ = (max_addr > min_addr) ? (max_addr - min_addr) : 0;
@@ -161,11 +210,92 @@ bool ElfModule::Load(const std::string_view name, const std::string_view path, c
   return true;
 }
 
+bool ElfModule::MaterializePage(uint32_t guest_address) {
+  std::lock_guard<std::mutex> lock(lazy_mutex_);
+  for (auto& range : lazy_ranges_) {
+    if (guest_address - range.guest_address >= range.size) {
+      continue;
+    }
+    uint32_t page_size = memory()->LookupHeap(range.guest_address)->page_size();
+    uint32_t page_index = (guest_address - range.guest_address) / page_size;
+    if (!range.materialized_pages[page_index]) {
+      MaterializePageLocked(range, page_index);
+    }
+    // Already-populated pages mean another thread won the race between the
+    // fault and the lock; the retry will succeed either way.
+    return true;
+  }
+  return false;
+}
+
+void ElfModule::MaterializePageLocked(LazyRange& range, uint32_t page_index) {
+  uint32_t page_size = memory()->LookupHeap(range.guest_address)->page_size();
+  uint32_t page_address = range.guest_address + page_index * page_size;
+  memory()
+      ->LookupHeap(page_address)
+      ->Protect(page_address, page_size,
+                rex::memory::kMemoryProtectRead | rex::memory::kMemoryProtectWrite);
+  uint8_t* host_page = memory()->TranslateVirtual(page_address);
+  std::memset(host_page, 0, page_size);
+  for (const LazySegment& segment : lazy_segments_) {
+    // Copy whatever file-backed part of any segment lands in this page;
+    // everything else stays zero-fill (bss tail and alignment padding).
+    uint32_t copy_start = std::max(page_address, segment.vaddr);
+    uint32_t copy_end = std::min(page_address + page_size, segment.vaddr + segment.filesz);
+    if (copy_start < copy_end) {
+      std::memcpy(host_page + (copy_start - page_address),
+                  elf_mapping_->data() + segment.file_offset + (copy_start - segment.vaddr),
+                  copy_end - copy_start);
+    }
+  }
+  range.materialized_pages[page_index] = true;
+}
+
+void ElfModule::MaterializeAllPages() {
+  std::lock_guard<std::mutex> lock(lazy_mutex_);
+  for (auto& range : lazy_ranges_) {
+    for (uint32_t i = 0; i < range.materialized_pages.size(); i++) {
+      if (!range.materialized_pages[i]) {
+        MaterializePageLocked(range, i);
+      }
+    }
+  }
+}
+
+bool ElfModule::ExceptionCallback(arch::Exception* ex) {
+  if (ex->code() != arch::Exception::Code::kAccessViolation) {
+    return false;
+  }
+  auto operation = ex->access_violation_operation();
+  if (operation != arch::Exception::AccessViolationOperation::kRead &&
+      operation != arch::Exception::AccessViolationOperation::kWrite) {
+    return false;
+  }
+  uint64_t membase = reinterpret_cast<uint64_t>(memory()->virtual_membase());
+  if (ex->fault_address() < membase || ex->fault_address() - membase > UINT32_MAX) {
+    return false;
+  }
+  return MaterializePage(uint32_t(ex->fault_address() - membase));
+}
+
+bool ElfModule::ExceptionCallbackThunk(arch::Exception* ex, void* data) {
+  return reinterpret_cast<ElfModule*>(data)->ExceptionCallback(ex);
+}
+
 bool ElfModule::Unload() {
   if (!loaded_) {
     return true;
   }
-  // crack: Memory allocated for ELF segments remains - no deallocation
+  // crack: Memory allocated for ELF segments remains - no deallocation.
+  // Finish populating any pages never touched before dropping the fault
+  // handler and the file mapping, so the leftover memory reads the same as
+  // an eager load would have.
+  if (fault_handler_installed_) {
+    MaterializeAllPages();
+    arch::ExceptionHandler::Uninstall(ExceptionCallbackThunk, this);
+    fault_handler_installed_ = false;
+    elf_mapping_.reset();
+  }
   loaded_ = false;
   return true;
 }
@@ -18,20 +18,27 @@ namespace rex::runtime {
 EntryTable::EntryTable() = default;
 
 EntryTable::~EntryTable() {
-  auto global_lock = global_critical_region_.Acquire();
-  for (auto it : map_) {
-    Entry* entry = it.second;
-    delete entry;
+  const Map* map = map_.load(std::memory_order_acquire);
+  if (map) {
+    for (auto it : *map) {
+      Entry* entry = it.second;
+      delete entry;
+    }
+    delete map;
   }
+  // retired_ versions only reference entries owned by the final map.
 }
 
 Entry* EntryTable::Get(uint32_t address) {
-  auto global_lock = global_critical_region_.Acquire();
-  const auto& it = map_.find(address);
-  Entry* entry = it != map_.end() ? it->second : nullptr;
+  const Map* map = map_.load(std::memory_order_acquire);
+  if (!map) {
+    return nullptr;
+  }
+  const auto& it = map->find(address);
+  Entry* entry = it != map->end() ? it->second : nullptr;
   if (entry) {
     // TODO(benvanik): wait if needed?
-    if (entry->status != Entry::STATUS_READY) {
+    if (entry->status.load(std::memory_order_acquire) != Entry::STATUS_READY) {
       entry = nullptr;
     }
   }
@@ -39,47 +46,64 @@ Entry* EntryTable::Get(uint32_t address) {
 }
 
 Entry::Status EntryTable::GetOrCreate(uint32_t address, Entry** out_entry) {
-  // TODO(benvanik): replace with a map with wait-free for find.
-  // https://github.com/facebook/folly/blob/master/folly/AtomicHashMap.h
+  // Fast path: the entry is already published, no lock needed.
+  const Map* map = map_.load(std::memory_order_acquire);
+  Entry* entry = nullptr;
+  if (map) {
+    const auto& it = map->find(address);
+    entry = it != map->end() ? it->second : nullptr;
+  }
 
-  auto global_lock = global_critical_region_.Acquire();
-  const auto& it = map_.find(address);
-  Entry* entry = it != map_.end() ? it->second : nullptr;
-  Entry::Status status;
-  if (entry) {
-    // If we aren't ready yet spin and wait.
-    if (entry->status == Entry::STATUS_COMPILING) {
-      // Still compiling, so spin.
-      do {
-        global_lock.unlock();
-        // TODO(benvanik): sleep for less time?
-        rex::thread::Sleep(std::chrono::microseconds(10));
-        global_lock.lock();
-      } while (entry->status == Entry::STATUS_COMPILING);
+  if (!entry) {
+    std::lock_guard<rex::thread::mutex> lock(write_mutex_);
+
+    // Re-check: another thread may have published while we waited.
+    map = map_.load(std::memory_order_relaxed);
+    if (map) {
+      const auto& it = map->find(address);
+      entry = it != map->end() ? it->second : nullptr;
+    }
+
+    if (!entry) {
+      // Create and return for initialization, publishing a rebuilt map.
+      entry = new Entry();
+      entry->address = address;
+      entry->end_address = 0;
+      entry->status = Entry::STATUS_COMPILING;
+      entry->function = 0;
+
+      auto new_map = map ? std::make_unique<Map>(*map) : std::make_unique<Map>();
+      (*new_map)[address] = entry;
+      map_.store(new_map.release(), std::memory_order_release);
+      if (map) {
+        retired_.emplace_back(map);
+      }
+
+      *out_entry = entry;
+      return Entry::STATUS_NEW;
     }
-    status = entry->status;
-  } else {
-    // Create and return for initialization.
-    entry = new Entry();
-    entry->address = address;
-    entry->end_address = 0;
-    entry->status = Entry::STATUS_COMPILING;
-    entry->function = 0;
-    map_[address] = entry;
-    status = Entry::STATUS_NEW;
   }
-  global_lock.unlock();
+
+  // If we aren't ready yet spin and wait.
+  while (entry->status.load(std::memory_order_acquire) == Entry::STATUS_COMPILING) {
+    // TODO(benvanik): sleep for less time?
+    rex::thread::Sleep(std::chrono::microseconds(10));
+  }
+
   *out_entry = entry;
-  return status;
+  return entry->status.load(std::memory_order_acquire);
 }
 
 std::vector<Function*> EntryTable::FindWithAddress(uint32_t address) {
-  auto global_lock = global_critical_region_.Acquire();
   std::vector<Function*> fns;
-  for (auto& it : map_) {
+  const Map* map = map_.load(std::memory_order_acquire);
+  if (!map) {
+    return fns;
+  }
+  for (auto& it : *map) {
     Entry* entry = it.second;
     if (address >= entry->address && address <= entry->end_address) {
-      if (entry->status == Entry::STATUS_READY) {
+      if (entry->status.load(std::memory_order_acquire) == Entry::STATUS_READY) {
         fns.push_back(entry->function);
       }
     }
@@ -88,4 +112,3 @@ std::vector<Function*> EntryTable::FindWithAddress(uint32_t address) {
 }
 
 }  // namespace rex::runtime
-// (removed orphan xe namespace)
@@ -0,0 +1,150 @@
+/**
+ * @file        system/export_profiler.cpp
+ * @brief       Sampling profiler for HLE kernel export dispatch
+ *
+ * @copyright   Copyright (c) 2026 Tom Clay <tomc@tctechstuff.com>
+ *              All rights reserved.
+ *
+ * @license     BSD 3-Clause License
+ *              See LICENSE file in the project root for full license text.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <rex/cvar.h>
+#include <rex/logging.h>
+#include <rex/system/export_profiler.h>
+#include <rex/system/map_parser.h>
+
+REXCVAR_DEFINE_BOOL(export_profiler, false, "Runtime",
+                    "Sample HLE export calls and report the hottest (export, caller) "
+                    "pairs at shutdown");
+REXCVAR_DEFINE_INT32(export_profiler_sample_interval, 16, "Runtime",
+                     "Record every Nth export call per thread when the export profiler "
+                     "is enabled");
+REXCVAR_DEFINE_STRING(export_profiler_map, "", "Runtime",
+                      "nm-style .map file used to attribute export callers to guest "
+                      "symbols in the profiler report");
+
+namespace rex::runtime {
+
+namespace {
+
+// Fixed-size overwriting sample ring. Writers claim a slot with a relaxed
+// fetch_add and store each field individually, so recording never takes a
+// lock and never tears a field; a sample raced with the report may pair a
+// fresh export with a stale duration, which is harmless noise.
+constexpr size_t kRingSizeLog2 = 15;
+constexpr size_t kRingSize = size_t(1) << kRingSizeLog2;
+
+struct RingSlot {
+  std::atomic<const char*> export_name{nullptr};
+  std::atomic<uint32_t> caller_address{0};
+  std::atomic<uint64_t> duration_ns{0};
+};
+
+RingSlot ring_[kRingSize];
+std::atomic<uint64_t> ring_write_index_{0};
+
+std::string FormatCaller(uint32_t caller_address, const std::vector<BinarySymbol>& symbols) {
+  if (!symbols.empty()) {
+    // Symbols are address-sorted - attribute to the closest preceding one.
+    auto it = std::upper_bound(
+        symbols.begin(), symbols.end(), caller_address,
+        [](uint32_t address, const BinarySymbol& symbol) { return address < symbol.address; });
+    if (it != symbols.begin()) {
+      --it;
+      if (!it->size || caller_address < it->address + it->size) {
+        return fmt::format("{}+{:#x}", it->name, caller_address - it->address);
+      }
+    }
+  }
+  return fmt::format("{:08X}", caller_address);
+}
+
+}  // namespace
+
+std::atomic<bool> ExportProfiler::enabled_{false};
+
+void ExportProfiler::set_enabled(bool enabled) {
+  enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+bool ExportProfiler::ShouldSample() {
+  thread_local int32_t countdown = 0;
+  if (--countdown > 0) {
+    return false;
+  }
+  countdown = std::max(REXCVAR_GET(export_profiler_sample_interval), 1);
+  return true;
+}
+
+void ExportProfiler::RecordSample(const char* export_name, uint32_t caller_address,
+                                  uint64_t duration_ns) {
+  uint64_t index = ring_write_index_.fetch_add(1, std::memory_order_relaxed);
+  RingSlot& slot = ring_[index & (kRingSize - 1)];
+  slot.export_name.store(export_name, std::memory_order_relaxed);
+  slot.caller_address.store(caller_address, std::memory_order_relaxed);
+  slot.duration_ns.store(duration_ns, std::memory_order_relaxed);
+}
+
+void ExportProfiler::WriteReport() {
+  uint64_t recorded = ring_write_index_.load(std::memory_order_relaxed);
+  size_t sample_count = size_t(std::min<uint64_t>(recorded, kRingSize));
+  if (!sample_count) {
+    return;
+  }
+
+  std::vector<BinarySymbol> symbols;
+  const std::string& map_path = REXCVAR_GET(export_profiler_map);
+  if (!map_path.empty()) {
+    MapParseOptions options;
+    options.functions_only = true;
+    auto parsed = ParseNmMapCached(map_path, options);
+    if (parsed) {
+      symbols = std::move(*parsed);
+      std::sort(symbols.begin(), symbols.end(),
+                [](const BinarySymbol& a, const BinarySymbol& b) { return a.address < b.address; });
+    } else {
+      REXSYS_WARN("ExportProfiler: failed to load {}: {}", map_path, to_string(parsed.error()));
+    }
+  }
+
+  struct Aggregate {
+    uint64_t call_count = 0;
+    uint64_t total_ns = 0;
+  };
+  // Export names are string literals, so the pointer is a stable key.
+  std::map<std::pair<const char*, uint32_t>, Aggregate> aggregates;
+  for (size_t i = 0; i < sample_count; ++i) {
+    const char* export_name = ring_[i].export_name.load(std::memory_order_relaxed);
+    if (!export_name) {
+      continue;
+    }
+    auto& aggregate = aggregates[{export_name, ring_[i].caller_address.load(std::memory_order_relaxed)}];
+    aggregate.call_count++;
+    aggregate.total_ns += ring_[i].duration_ns.load(std::memory_order_relaxed);
+  }
+
+  std::vector<std::pair<std::pair<const char*, uint32_t>, Aggregate>> sorted(aggregates.begin(),
+                                                                             aggregates.end());
+  std::sort(sorted.begin(), sorted.end(),
+            [](const auto& a, const auto& b) { return a.second.total_ns > b.second.total_ns; });
+
+  REXSYS_INFO("Export profile: {} samples ({} calls recorded, every {}th call per thread)",
+              sample_count, recorded, std::max(REXCVAR_GET(export_profiler_sample_interval), 1));
+  constexpr size_t kMaxReportLines = 50;
+  for (size_t i = 0; i < sorted.size() && i < kMaxReportLines; ++i) {
+    const auto& [key, aggregate] = sorted[i];
+    REXSYS_INFO("  {:>10.3f} ms {:>8} samples {:>10.2f} us/call  {}  <- {}",
+                aggregate.total_ns / 1e6, aggregate.call_count,
+                aggregate.total_ns / 1e3 / aggregate.call_count, key.first,
+                FormatCaller(key.second, symbols));
+  }
+}
+
+}  // namespace rex::runtime
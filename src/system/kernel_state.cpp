@@ -9,6 +9,7 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <mutex>
 #include <string>
 
 #include <fmt/format.h>
@@ -171,7 +172,7 @@ void KernelState::RegisterModule(XModule* module) {}
 void KernelState::UnregisterModule(XModule* module) {}
 
 bool KernelState::RegisterUserModule(object_ref<UserModule> module) {
-  auto lock = global_critical_region_.Acquire();
+  std::lock_guard<std::recursive_mutex> lock(module_mutex_);
 
   for (auto user_module : user_modules_) {
     if (user_module->path() == module->path()) {
@@ -185,7 +186,7 @@ bool KernelState::RegisterUserModule(object_ref<UserModule> module) {
 }
 
 void KernelState::UnregisterUserModule(UserModule* module) {
-  auto lock = global_critical_region_.Acquire();
+  std::lock_guard<std::recursive_mutex> lock(module_mutex_);
 
   for (auto it = user_modules_.begin(); it != user_modules_.end(); it++) {
     if ((*it)->path() == module->path()) {
@@ -231,7 +232,7 @@ object_ref<XModule> KernelState::GetModule(const std::string_view name, bool use
     return nullptr;
   }
 
-  auto global_lock = global_critical_region_.Acquire();
+  std::lock_guard<std::recursive_mutex> lock(module_mutex_);
 
   if (!user_only) {
     for (auto kernel_module : kernel_modules_) {
@@ -355,13 +356,13 @@ void KernelState::SetExecutableModule(object_ref<UserModule> module) {
   if (!dispatch_thread_running_) {
     dispatch_thread_running_ = true;
     dispatch_thread_ = object_ref<XHostThread>(new XHostThread(this, 128 * 1024, 0, [this]() {
-      auto global_lock = global_critical_region_.AcquireDeferred();
+      std::unique_lock<rex::thread::mutex> lock(dispatch_mutex_, std::defer_lock);
       while (dispatch_thread_running_) {
-        global_lock.lock();
+        lock.lock();
         if (dispatch_queue_.empty()) {
-          dispatch_cond_.wait(global_lock);
+          dispatch_cond_.wait(lock);
           if (!dispatch_thread_running_) {
-            global_lock.unlock();
+            lock.unlock();
             break;
           }
         }
@@ -369,7 +370,7 @@ void KernelState::SetExecutableModule(object_ref<UserModule> module) {
         dispatch_queue_.pop_front();
         REXSYS_DEBUG("Dispatch thread processing queued item ({} remaining)",
                      dispatch_queue_.size());
-        global_lock.unlock();
+        lock.unlock();
 
         fn();
         REXSYS_DEBUG("Dispatch thread completed item");
@@ -382,7 +383,7 @@ void KernelState::SetExecutableModule(object_ref<UserModule> module) {
 }
 
 void KernelState::LoadKernelModule(object_ref<KernelModule> kernel_module) {
-  auto global_lock = global_critical_region_.Acquire();
+  std::lock_guard<std::recursive_mutex> lock(module_mutex_);
   kernel_modules_.push_back(std::move(kernel_module));
 }
 
@@ -399,7 +400,7 @@ object_ref<UserModule> KernelState::LoadUserModule(const std::string_view raw_na
 
   object_ref<UserModule> module;
   {
-    auto global_lock = global_critical_region_.Acquire();
+    std::unique_lock<std::recursive_mutex> lock(module_mutex_);
 
     // See if we've already loaded it
     for (auto& existing_module : user_modules_) {
@@ -408,7 +409,7 @@ object_ref<UserModule> KernelState::LoadUserModule(const std::string_view raw_na
       }
     }
 
-    global_lock.unlock();
+    lock.unlock();
 
     // Module wasn't loaded, so load it.
     module = object_ref<UserModule>(new UserModule(this));
@@ -418,7 +419,7 @@ object_ref<UserModule> KernelState::LoadUserModule(const std::string_view raw_na
       return nullptr;
     }
 
-    global_lock.lock();
+    lock.lock();
 
     // Putting into the listing automatically retains.
     user_modules_.push_back(module);
@@ -437,7 +438,7 @@ object_ref<UserModule> KernelState::LoadUserModule(const std::string_view raw_na
 }
 
 void KernelState::UnloadUserModule(const object_ref<UserModule>& module, bool call_entry) {
-  auto global_lock = global_critical_region_.Acquire();
+  std::lock_guard<std::recursive_mutex> lock(module_mutex_);
 
   if (module->is_dll_module() && module->entry_point() && call_entry) {
     // TODO(tomc): add support for this. see comment in LoadUserModule
@@ -460,6 +461,8 @@ void KernelState::UnloadUserModule(const object_ref<UserModule>& module, bool ca
 
 void KernelState::TerminateTitle() {
   REXSYS_DEBUG("KernelState::TerminateTitle");
+  // The global critical region still serializes termination against anything
+  // that may suspend threads; list traffic takes the per-object locks.
   auto global_lock = global_critical_region_.Acquire();
 
   // Call terminate routines.
@@ -477,42 +480,59 @@ void KernelState::TerminateTitle() {
   */
 
   // Kill all guest threads.
-  for (auto it = threads_by_id_.begin(); it != threads_by_id_.end();) {
-    if (!XThread::IsInThread(it->second) && it->second->is_guest_thread()) {
-      auto thread = it->second;
-
-      if (thread->is_running()) {
-        // NOTE(tomc): JIT safe point stepping not available
-        // Just terminate the thread directly
-        thread->thread()->Suspend();
-
-        global_lock.unlock();
-        // NOTE(tomc): processor_->StepToGuestSafePoint() is JIT-only
-        thread->Terminate(0);
-        global_lock.lock();
-      }
+  {
+    std::unique_lock<rex::thread::mutex> thread_lock(thread_mutex_);
+    for (auto it = threads_by_id_.begin(); it != threads_by_id_.end();) {
+      if (!XThread::IsInThread(it->second) && it->second->is_guest_thread()) {
+        auto thread = it->second;
+
+        if (thread->is_running()) {
+          // NOTE(tomc): JIT safe point stepping not available
+          // Just terminate the thread directly
+          thread->thread()->Suspend();
+
+          thread_lock.unlock();
+          global_lock.unlock();
+          // NOTE(tomc): processor_->StepToGuestSafePoint() is JIT-only
+          thread->Terminate(0);
+          global_lock.lock();
+          thread_lock.lock();
+        }
 
-      // Erase it from the thread list.
-      it = threads_by_id_.erase(it);
-    } else {
-      ++it;
+        // Erase it from the thread list.
+        it = threads_by_id_.erase(it);
+      } else {
+        ++it;
+      }
     }
   }
 
   // Third: Unload all user modules (including the executable).
-  for (size_t i = 0; i < user_modules_.size(); i++) {
-    X_STATUS status = user_modules_[i]->Unload();
-    assert_true(XSUCCEEDED(status));
+  {
+    std::lock_guard<std::recursive_mutex> module_lock(module_mutex_);
+    for (size_t i = 0; i < user_modules_.size(); i++) {
+      X_STATUS status = user_modules_[i]->Unload();
+      assert_true(XSUCCEEDED(status));
 
-    object_table_.RemoveHandle(user_modules_[i]->handle());
+      object_table_.RemoveHandle(user_modules_[i]->handle());
+    }
+    user_modules_.clear();
   }
-  user_modules_.clear();
 
   // Release all objects in the object table.
   object_table_.PurgeAllObjects();
 
+  // Drop pooled thread resources - the next title sizes TLS differently.
+  XThread::PurgeResourcePool(memory_);
+
   // Unregister all notify listeners.
-  notify_listeners_.clear();
+  {
+    std::lock_guard<rex::thread::mutex> listener_lock(listener_mutex_);
+    for (auto& shard : notify_listener_shards_) {
+      std::lock_guard<rex::thread::mutex> shard_lock(shard.mutex);
+      shard.listeners.clear();
+    }
+  }
 
   // Clear the TLS map.
   tls_bitmap_.Reset();
@@ -526,7 +546,10 @@ void KernelState::TerminateTitle() {
   }
 
   if (XThread::IsInThread()) {
-    threads_by_id_.erase(XThread::GetCurrentThread()->thread_id());
+    {
+      std::lock_guard<rex::thread::mutex> thread_lock(thread_mutex_);
+      threads_by_id_.erase(XThread::GetCurrentThread()->thread_id());
+    }
 
     // Now commit suicide (using Terminate, because we can't call into guest
     // code anymore).
@@ -536,7 +559,7 @@ void KernelState::TerminateTitle() {
 }
 
 void KernelState::RegisterThread(XThread* thread) {
-  auto global_lock = global_critical_region_.Acquire();
+  std::lock_guard<rex::thread::mutex> lock(thread_mutex_);
   threads_by_id_[thread->thread_id()] = thread;
 
   /*
@@ -547,7 +570,7 @@ void KernelState::RegisterThread(XThread* thread) {
 }
 
 void KernelState::UnregisterThread(XThread* thread) {
-  auto global_lock = global_critical_region_.Acquire();
+  std::lock_guard<rex::thread::mutex> lock(thread_mutex_);
   auto it = threads_by_id_.find(thread->thread_id());
   if (it != threads_by_id_.end()) {
     threads_by_id_.erase(it);
@@ -561,8 +584,6 @@ void KernelState::UnregisterThread(XThread* thread) {
 }
 
 void KernelState::OnThreadExecute(XThread* thread) {
-  auto global_lock = global_critical_region_.Acquire();
-
   // Must be called on executing thread.
   assert_true(XThread::GetCurrentThread() == thread);
 
@@ -573,8 +594,6 @@ void KernelState::OnThreadExecute(XThread* thread) {
 }
 
 void KernelState::OnThreadExit(XThread* thread) {
-  auto global_lock = global_critical_region_.Acquire();
-
   // Must be called on executing thread.
   assert_true(XThread::GetCurrentThread() == thread);
 
@@ -583,7 +602,7 @@ void KernelState::OnThreadExit(XThread* thread) {
 }
 
 object_ref<XThread> KernelState::GetThreadByID(uint32_t thread_id) {
-  auto global_lock = global_critical_region_.Acquire();
+  std::lock_guard<rex::thread::mutex> lock(thread_mutex_);
   XThread* thread = nullptr;
   auto it = threads_by_id_.find(thread_id);
   if (it != threads_by_id_.end()) {
@@ -593,8 +612,18 @@ object_ref<XThread> KernelState::GetThreadByID(uint32_t thread_id) {
 }
 
 void KernelState::RegisterNotifyListener(XNotifyListener* listener) {
-  auto global_lock = global_critical_region_.Acquire();
-  notify_listeners_.push_back(retain_object(listener));
+  std::lock_guard<rex::thread::mutex> lock(listener_mutex_);
+  // Register into every area shard the listener's mask covers; broadcasts
+  // only walk the shard for the event's area.
+  const uint64_t mask = listener->mask();
+  for (size_t i = 0; i < kNotifyListenerShards; ++i) {
+    if (!(mask & (1ULL << i))) {
+      continue;
+    }
+    auto& shard = notify_listener_shards_[i];
+    std::lock_guard<rex::thread::mutex> shard_lock(shard.mutex);
+    shard.listeners.push_back(retain_object(listener));
+  }
 
   // Games seem to expect a few notifications on startup, only for the first
   // listener.
@@ -617,20 +646,38 @@ void KernelState::RegisterNotifyListener(XNotifyListener* listener) {
 }
 
 void KernelState::UnregisterNotifyListener(XNotifyListener* listener) {
-  auto global_lock = global_critical_region_.Acquire();
-  for (auto it = notify_listeners_.begin(); it != notify_listeners_.end(); ++it) {
-    if ((*it).get() == listener) {
-      notify_listeners_.erase(it);
-      break;
+  std::lock_guard<rex::thread::mutex> lock(listener_mutex_);
+  // The mask is immutable after Initialize, so it names exactly the shards
+  // RegisterNotifyListener put the listener into.
+  const uint64_t mask = listener->mask();
+  for (size_t i = 0; i < kNotifyListenerShards; ++i) {
+    if (!(mask & (1ULL << i))) {
+      continue;
+    }
+    auto& shard = notify_listener_shards_[i];
+    std::lock_guard<rex::thread::mutex> shard_lock(shard.mutex);
+    for (auto it = shard.listeners.begin(); it != shard.listeners.end(); ++it) {
+      if ((*it).get() == listener) {
+        shard.listeners.erase(it);
+        break;
+      }
     }
   }
 }
 
 void KernelState::BroadcastNotification(XNotificationID id, uint32_t data) {
+  auto& shard = notify_listener_shards_[XNotificationKey(id).mask_index];
+  // Snapshot the shard and deliver outside its lock so concurrent broadcasts
+  // to other areas never serialize on us, and the registry lock is held for
+  // one copy rather than the whole delivery walk.
+  std::vector<object_ref<XNotifyListener>> targets;
+  {
+    std::lock_guard<rex::thread::mutex> shard_lock(shard.mutex);
+    targets = shard.listeners;
+  }
   REXSYS_DEBUG("BroadcastNotification(id={:#x}, data={}) to {} listeners",
-               static_cast<uint32_t>(id), data, notify_listeners_.size());
-  auto global_lock = global_critical_region_.Acquire();
-  for (const auto& notify_listener : notify_listeners_) {
+               static_cast<uint32_t>(id), data, targets.size());
+  for (const auto& notify_listener : targets) {
     notify_listener->EnqueueNotification(id, data);
   }
 }
@@ -679,6 +726,35 @@ void KernelState::CompleteOverlappedImmediateEx(uint32_t overlapped_ptr, X_RESUL
   CompleteOverlappedEx(overlapped_ptr, result, extended_error, length);
 }
 
+void KernelState::MarkOverlappedPending(uint32_t overlapped_ptr) {
+  auto ptr = memory()->TranslateVirtual(overlapped_ptr);
+  XOverlappedSetResult(ptr, X_ERROR_IO_PENDING);
+  XOverlappedSetContext(ptr, XThread::GetCurrentThreadHandle());
+}
+
+void KernelState::QueueDispatch(std::move_only_function<void()> fn) {
+  std::lock_guard<rex::thread::mutex> lock(dispatch_mutex_);
+  dispatch_queue_.push_back(std::move(fn));
+  dispatch_cond_.notify_all();
+}
+
+void KernelState::LaunchDispatchTask(DispatchTask task) {
+  auto handle = task.detach();
+  if (!handle) {
+    return;
+  }
+  QueueDispatch([handle]() { handle.resume(); });
+}
+
+void DispatchContinuation::resume() {
+  void* prev = state_.exchange(signaled_tag(), std::memory_order_acq_rel);
+  if (prev != nullptr && prev != signaled_tag()) {
+    // A coroutine was parked here - hand it back to the dispatch thread
+    auto handle = std::coroutine_handle<>::from_address(prev);
+    kernel_state_->QueueDispatch([handle]() { handle.resume(); });
+  }
+}
+
 void KernelState::CompleteOverlappedDeferred(std::move_only_function<void()> completion_callback,
                                              uint32_t overlapped_ptr, X_RESULT result,
                                              std::move_only_function<void()> pre_callback,
@@ -722,11 +798,8 @@ void KernelState::CompleteOverlappedDeferredEx(
     uint32_t overlapped_ptr, std::move_only_function<void()> pre_callback,
     std::move_only_function<void()> post_callback) {
   REXSYS_DEBUG("CompleteOverlappedDeferredEx: queuing for overlapped {:08X}", overlapped_ptr);
-  auto ptr = memory()->TranslateVirtual(overlapped_ptr);
-  XOverlappedSetResult(ptr, X_ERROR_IO_PENDING);
-  XOverlappedSetContext(ptr, XThread::GetCurrentThreadHandle());
-  auto global_lock = global_critical_region_.Acquire();
-  dispatch_queue_.push_back(
+  MarkOverlappedPending(overlapped_ptr);
+  QueueDispatch(
       [this, overlapped_ptr, completion_callback = std::move(completion_callback),
        pre_callback = std::move(pre_callback), post_callback = std::move(post_callback)]() mutable {
         REXSYS_DEBUG("Deferred overlapped {:08X}: running pre_callback", overlapped_ptr);
@@ -747,7 +820,6 @@ void KernelState::CompleteOverlappedDeferredEx(
           post_callback();
         }
       });
-  dispatch_cond_.notify_all();
 }
 
 bool KernelState::Save(stream::ByteStream* stream) {
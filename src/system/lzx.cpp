@@ -147,6 +147,57 @@ int lzx_decompress(const void* lzx_data, size_t lzx_len, void* dest, size_t dest
   return result_code;
 }
 
+typedef struct mspack_stream_file_t {
+  lzx_stream_buffer* source;
+  off_t offset;
+} mspack_stream_file;
+
+int mspack_stream_read(mspack_file* file, void* buffer, int chars) {
+  auto streamfile = (mspack_stream_file*)file;
+  // Blocks until the producer has published the bytes (or finished short).
+  size_t total =
+      streamfile->source->WaitForBytes((size_t)streamfile->offset, (size_t)chars);
+  std::memcpy(buffer, streamfile->source->data() + streamfile->offset, total);
+  streamfile->offset += (off_t)total;
+  return (int)total;
+}
+
+int lzx_decompress_pipelined(lzx_stream_buffer* source, void* dest, size_t dest_len,
+                             uint32_t window_size) {
+  int result_code = 1;
+
+  uint32_t window_bits;
+  if (!rex::bit_scan_forward(window_size, &window_bits)) {
+    return result_code;
+  }
+
+  mspack_system* sys = mspack_memory_sys_create();
+  sys->read = mspack_stream_read;
+  mspack_stream_file lzxsrc = {source, 0};
+  mspack_memory_file* lzxdst = mspack_memory_open(sys, dest, dest_len);
+  lzxd_stream* lzxd = lzxd_init(sys, (mspack_file*)&lzxsrc, (mspack_file*)lzxdst, window_bits, 0,
+                                0x8000, (off_t)dest_len, 0);
+
+  if (lzxd) {
+    result_code = lzxd_decompress(lzxd, (off_t)dest_len);
+
+    lzxd_free(lzxd);
+    lzxd = NULL;
+  }
+
+  if (lzxdst) {
+    mspack_memory_close(lzxdst);
+    lzxdst = NULL;
+  }
+
+  if (sys) {
+    mspack_memory_sys_destroy(sys);
+    sys = NULL;
+  }
+
+  return result_code;
+}
+
 int lzxdelta_apply_patch(rex::xex2_delta_patch* patch, size_t patch_len, uint32_t window_size,
                          void* dest) {
   void* patch_end = (char*)patch + patch_len;
@@ -9,8 +9,12 @@
  *              See LICENSE file in the project root for full license text.
  */
 
+#include <algorithm>
 #include <charconv>
+#include <cstring>
 #include <fstream>
+#include <numeric>
+#include <optional>
 #include <sstream>
 
 #include <rex/system/map_parser.h>
@@ -48,6 +52,156 @@ bool IsFunctionType(char c) {
   return c == 'T' || c == 't';
 }
 
+//=============================================================================
+// Compiled symbol cache
+//=============================================================================
+// On-disk layout (host endianness/arch, not portable - it's a local cache):
+//   SymbolCacheHeader
+//   symbol_count * SymbolCacheEntry, sorted by address
+//   string pool of NUL-terminated names, referenced by name_offset
+
+constexpr uint32_t kSymbolCacheMagic = 0x52585343;  // 'RXSC'
+constexpr uint32_t kSymbolCacheVersion = 1;
+
+struct SymbolCacheHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t symbol_count;
+  uint32_t string_pool_size;
+  int64_t source_mtime;  // filesystem::file_time_type ticks
+  uint64_t source_size;
+  uint64_t options_hash;
+};
+
+struct SymbolCacheEntry {
+  uint32_t address;
+  uint32_t size;
+  uint32_t name_offset;
+  uint8_t type;
+  uint8_t pad[3];
+};
+
+/**
+ * The parse options are part of the cache key - a cache built with
+ * functions_only or a prefix filter holds a different symbol set.
+ */
+uint64_t HashParseOptions(const MapParseOptions& options) {
+  // FNV-1a
+  uint64_t hash = 14695981039346656037ull;
+  auto mix = [&hash](uint64_t value) {
+    hash ^= value;
+    hash *= 1099511628211ull;
+  };
+  mix(options.base_address);
+  mix(options.functions_only ? 1 : 0);
+  for (char c : options.prefix_filter) {
+    mix(static_cast<uint8_t>(c));
+  }
+  return hash;
+}
+
+std::optional<std::vector<BinarySymbol>> TryLoadSymbolCache(
+    const std::filesystem::path& cache_path, int64_t source_mtime, uint64_t source_size,
+    uint64_t options_hash) {
+  std::ifstream file(cache_path, std::ios::binary);
+  if (!file) {
+    return std::nullopt;
+  }
+
+  SymbolCacheHeader header;
+  if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+    return std::nullopt;
+  }
+  if (header.magic != kSymbolCacheMagic || header.version != kSymbolCacheVersion ||
+      header.source_mtime != source_mtime || header.source_size != source_size ||
+      header.options_hash != options_hash || !header.symbol_count || !header.string_pool_size) {
+    return std::nullopt;
+  }
+
+  std::vector<SymbolCacheEntry> entries(header.symbol_count);
+  std::vector<char> string_pool(header.string_pool_size);
+  if (!file.read(reinterpret_cast<char*>(entries.data()),
+                 entries.size() * sizeof(SymbolCacheEntry)) ||
+      !file.read(string_pool.data(), string_pool.size())) {
+    return std::nullopt;
+  }
+  if (string_pool.back() != '\0') {
+    return std::nullopt;
+  }
+
+  std::vector<BinarySymbol> symbols;
+  symbols.reserve(entries.size());
+  for (const auto& entry : entries) {
+    if (entry.name_offset >= string_pool.size()) {
+      return std::nullopt;
+    }
+    BinarySymbol sym;
+    sym.name = &string_pool[entry.name_offset];
+    sym.address = entry.address;
+    sym.size = entry.size;
+    sym.type = static_cast<BinarySymbolType>(entry.type);
+    symbols.push_back(std::move(sym));
+  }
+  return symbols;
+}
+
+void WriteSymbolCache(const std::filesystem::path& cache_path,
+                      const std::vector<BinarySymbol>& symbols, int64_t source_mtime,
+                      uint64_t source_size, uint64_t options_hash) {
+  // Address-sorted order so consumers get a binary-searchable array.
+  std::vector<uint32_t> order(symbols.size());
+  std::iota(order.begin(), order.end(), 0u);
+  std::sort(order.begin(), order.end(), [&symbols](uint32_t a, uint32_t b) {
+    return symbols[a].address < symbols[b].address;
+  });
+
+  std::vector<SymbolCacheEntry> entries;
+  entries.reserve(symbols.size());
+  std::vector<char> string_pool;
+  for (uint32_t index : order) {
+    const auto& sym = symbols[index];
+    SymbolCacheEntry entry = {};
+    entry.address = sym.address;
+    entry.size = sym.size;
+    entry.name_offset = static_cast<uint32_t>(string_pool.size());
+    entry.type = static_cast<uint8_t>(sym.type);
+    entries.push_back(entry);
+    string_pool.insert(string_pool.end(), sym.name.data(), sym.name.data() + sym.name.size());
+    string_pool.push_back('\0');
+  }
+
+  SymbolCacheHeader header = {};
+  header.magic = kSymbolCacheMagic;
+  header.version = kSymbolCacheVersion;
+  header.symbol_count = static_cast<uint32_t>(entries.size());
+  header.string_pool_size = static_cast<uint32_t>(string_pool.size());
+  header.source_mtime = source_mtime;
+  header.source_size = source_size;
+  header.options_hash = options_hash;
+
+  // Write to a temp file and rename so a crash never leaves a torn cache.
+  auto temp_path = cache_path;
+  temp_path += ".tmp";
+  {
+    std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      return;
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(entries.data()),
+               entries.size() * sizeof(SymbolCacheEntry));
+    file.write(string_pool.data(), string_pool.size());
+    if (!file) {
+      return;
+    }
+  }
+  std::error_code ec;
+  std::filesystem::rename(temp_path, cache_path, ec);
+  if (ec) {
+    std::filesystem::remove(temp_path, ec);
+  }
+}
+
 }  // namespace
 
 std::expected<std::vector<BinarySymbol>, MapParseError> ParseNmMapString(
@@ -159,4 +313,29 @@ std::expected<std::vector<BinarySymbol>, MapParseError> ParseNmMap(
   return ParseNmMapString(contents, options);
 }
 
+std::expected<std::vector<BinarySymbol>, MapParseError> ParseNmMapCached(
+    const std::filesystem::path& map_path, const MapParseOptions& options) {
+  std::error_code ec;
+  if (!std::filesystem::exists(map_path, ec)) {
+    return std::unexpected(MapParseError::FileNotFound);
+  }
+
+  int64_t source_mtime = std::filesystem::last_write_time(map_path, ec).time_since_epoch().count();
+  uint64_t source_size = std::filesystem::file_size(map_path, ec);
+  uint64_t options_hash = HashParseOptions(options);
+
+  auto cache_path = map_path;
+  cache_path += ".symcache";
+
+  if (auto cached = TryLoadSymbolCache(cache_path, source_mtime, source_size, options_hash)) {
+    return std::move(*cached);
+  }
+
+  auto parsed = ParseNmMap(map_path, options);
+  if (parsed) {
+    WriteSymbolCache(cache_path, *parsed, source_mtime, source_size, options_hash);
+  }
+  return parsed;
+}
+
 }  // namespace rex::runtime
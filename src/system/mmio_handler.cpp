@@ -62,7 +62,8 @@ MMIOHandler::MMIOHandler(uint8_t* virtual_membase, uint8_t* physical_membase, ui
       host_to_guest_virtual_(host_to_guest_virtual),
       host_to_guest_virtual_context_(host_to_guest_virtual_context),
       access_violation_callback_(access_violation_callback),
-      access_violation_callback_context_(access_violation_callback_context) {}
+      access_violation_callback_context_(access_violation_callback_context),
+      page_table_(kPageTableSize, kPageTableEntryEmpty) {}
 
 MMIOHandler::~MMIOHandler() {
   arch::ExceptionHandler::Uninstall(ExceptionCallbackThunk, this);
@@ -74,6 +75,8 @@ MMIOHandler::~MMIOHandler() {
 bool MMIOHandler::RegisterRange(uint32_t virtual_address, uint32_t mask, uint32_t size,
                                 void* context, MMIOReadCallback read_callback,
                                 MMIOWriteCallback write_callback) {
+  assert_true(mapped_ranges_.size() < size_t(kPageTableEntryMultiple));
+  uint16_t range_index = uint16_t(mapped_ranges_.size());
   mapped_ranges_.push_back({
       virtual_address,
       mask,
@@ -82,10 +85,32 @@ bool MMIOHandler::RegisterRange(uint32_t virtual_address, uint32_t mask, uint32_
       read_callback,
       write_callback,
   });
+  // Mark the pages within which the new range can match addresses. The low
+  // mask bits only constrain the address within a page, so whether a page can
+  // contain matches depends only on the upper bits.
+  constexpr uint32_t page_high_mask = ~uint32_t(0) << kPageTablePageSizeLog2;
+  for (uint32_t page = 0; page < kPageTableSize; ++page) {
+    uint32_t page_base = page << kPageTablePageSizeLog2;
+    if (((page_base & mask) & page_high_mask) != (virtual_address & page_high_mask)) {
+      continue;
+    }
+    uint16_t& page_entry = page_table_[page];
+    page_entry = page_entry == kPageTableEntryEmpty ? range_index : kPageTableEntryMultiple;
+  }
   return true;
 }
 
 MMIORange* MMIOHandler::LookupRange(uint32_t virtual_address) {
+  uint16_t page_entry = page_table_[virtual_address >> kPageTablePageSizeLog2];
+  if (page_entry == kPageTableEntryEmpty) {
+    return nullptr;
+  }
+  if (page_entry != kPageTableEntryMultiple) {
+    MMIORange& range = mapped_ranges_[page_entry];
+    return (virtual_address & range.mask) == range.address ? &range : nullptr;
+  }
+  // Multiple ranges can match addresses within this page - rare, walk the
+  // list.
   for (auto& range : mapped_ranges_) {
     if ((virtual_address & range.mask) == range.address) {
       return &range;
@@ -95,24 +120,21 @@ MMIORange* MMIOHandler::LookupRange(uint32_t virtual_address) {
 }
 
 bool MMIOHandler::CheckLoad(uint32_t virtual_address, uint32_t* out_value) {
-  for (const auto& range : mapped_ranges_) {
-    if ((virtual_address & range.mask) == range.address) {
-      *out_value =
-          static_cast<uint32_t>(range.read(nullptr, range.callback_context, virtual_address));
-      return true;
-    }
+  const MMIORange* range = LookupRange(virtual_address);
+  if (!range) {
+    return false;
   }
-  return false;
+  *out_value = static_cast<uint32_t>(range->read(nullptr, range->callback_context, virtual_address));
+  return true;
 }
 
 bool MMIOHandler::CheckStore(uint32_t virtual_address, uint32_t value) {
-  for (const auto& range : mapped_ranges_) {
-    if ((virtual_address & range.mask) == range.address) {
-      range.write(nullptr, range.callback_context, virtual_address, value);
-      return true;
-    }
+  const MMIORange* range = LookupRange(virtual_address);
+  if (!range) {
+    return false;
   }
-  return false;
+  range->write(nullptr, range->callback_context, virtual_address, value);
+  return true;
 }
 
 bool MMIOHandler::TryDecodeLoadStore(const uint8_t* p, DecodedLoadStore& decoded_out) {
@@ -378,20 +400,13 @@ bool MMIOHandler::ExceptionCallback(arch::Exception* ex) {
   }
   void* fault_host_address = reinterpret_cast<void*>(ex->fault_address());
 
-  // Access violations are pretty rare, so we can do a linear search here.
   // Only check if in the virtual range, as we only support virtual ranges.
   const MMIORange* range = nullptr;
   uint32_t fault_guest_virtual_address = 0;
   if (ex->fault_address() < uint64_t(physical_membase_)) {
     fault_guest_virtual_address =
         host_to_guest_virtual_(host_to_guest_virtual_context_, fault_host_address);
-    for (const auto& test_range : mapped_ranges_) {
-      if ((fault_guest_virtual_address & test_range.mask) == test_range.address) {
-        // Address is within the range of this mapping.
-        range = &test_range;
-        break;
-      }
-    }
+    range = LookupRange(fault_guest_virtual_address);
   }
   if (!range) {
     // Recheck if the pages are still protected (race condition - another thread
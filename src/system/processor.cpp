@@ -36,7 +36,7 @@ Processor::Processor(rex::memory::Memory* memory, ExportResolver* export_resolve
 
 Processor::~Processor() {
   {
-    auto global_lock = global_critical_region_.Acquire();
+    std::lock_guard<std::mutex> lock(modules_mutex_);
     modules_.clear();
   }
 }
@@ -48,13 +48,13 @@ void Processor::PreLaunch() {
 }
 
 bool Processor::AddModule(std::unique_ptr<Module> module) {
-  auto global_lock = global_critical_region_.Acquire();
+  std::lock_guard<std::mutex> lock(modules_mutex_);
   modules_.push_back(std::move(module));
   return true;
 }
 
 Module* Processor::GetModule(const std::string_view name) {
-  auto global_lock = global_critical_region_.Acquire();
+  std::lock_guard<std::mutex> lock(modules_mutex_);
   for (const auto& module : modules_) {
     if (module->name() == name) {
       return module.get();
@@ -64,7 +64,7 @@ Module* Processor::GetModule(const std::string_view name) {
 }
 
 std::vector<Module*> Processor::GetModules() {
-  auto global_lock = global_critical_region_.Acquire();
+  std::lock_guard<std::mutex> lock(modules_mutex_);
   std::vector<Module*> clone(modules_.size());
   for (const auto& module : modules_) {
     clone.push_back(module.get());
@@ -165,12 +165,37 @@ uint64_t Processor::ExecuteInterrupt(ThreadState* thread_state, uint32_t address
                                      size_t arg_count) {
   SCOPE_profile_cpu_f("cpu");
 
-  // Hold the global lock during interrupt dispatch.
+  InterruptBatch batch(this, thread_state);
+  return batch.Execute(address, args, arg_count);
+}
+
+Processor::InterruptBatch::InterruptBatch(Processor* processor, ThreadState* thread_state)
+    : processor_(processor), thread_state_(thread_state) {
+  // Hold the global lock for the whole batch.
   // This will block if any code is in a critical region (has interrupts
   // disabled) or if any other interrupt is executing.
-  auto global_lock = global_critical_region_.Acquire();
+  global_lock_ = processor_->global_critical_region_.Acquire();
 
-  auto* ctx = thread_state->context();
+  // Interrupt handlers run at dispatch level; raising once up front lets every
+  // delivery in the batch share the transition.
+  previous_irql_ = processor_->RaiseIrql(Irql::DISPATCH);
+
+  // TLS ptr must be zero during interrupts. Some games check this and
+  // early-exit routines when under interrupts.
+  auto* ctx = thread_state_->context();
+  pcr_address_ = processor_->memory_->TranslateVirtual(static_cast<uint32_t>(ctx->r13.u64));
+  old_tls_ptr_ = memory::load_and_swap<uint32_t>(pcr_address_);
+  memory::store_and_swap<uint32_t>(pcr_address_, 0);
+}
+
+Processor::InterruptBatch::~InterruptBatch() {
+  // Restores TLS ptr and the IRQL the thread entered the batch with.
+  memory::store_and_swap<uint32_t>(pcr_address_, old_tls_ptr_);
+  processor_->LowerIrql(previous_irql_);
+}
+
+uint64_t Processor::InterruptBatch::Execute(uint32_t address, uint64_t args[], size_t arg_count) {
+  auto* ctx = thread_state_->context();
   assert_true(arg_count <= 5);
 
   // Set up arguments (rexglue uses named registers)
@@ -185,19 +210,10 @@ uint64_t Processor::ExecuteInterrupt(ThreadState* thread_state, uint32_t address
   if (arg_count > 4)
     ctx->r7.u64 = args[4];
 
-  // TLS ptr must be zero during interrupts. Some games check this and
-  // early-exit routines when under interrupts.
-  auto pcr_address = memory_->TranslateVirtual(static_cast<uint32_t>(ctx->r13.u64));
-  uint32_t old_tls_ptr = memory::load_and_swap<uint32_t>(pcr_address);
-  memory::store_and_swap<uint32_t>(pcr_address, 0);
-
-  if (!Execute(thread_state, address)) {
+  if (!processor_->Execute(thread_state_, address)) {
     return 0xDEADBABE;
   }
 
-  // Restores TLS ptr.
-  memory::store_and_swap<uint32_t>(pcr_address, old_tls_ptr);
-
   return ctx->r3.u64;
 }
 
@@ -256,6 +272,10 @@ bool Processor::InitializeFunctionTable(uint32_t code_base, uint32_t code_size,
   code_size_ = code_size;
   image_base_ = image_base;
   image_size_ = image_size;
+
+  // One slot per 4-byte-aligned guest address, nullptr until registered.
+  function_table_.assign(code_size / 4, nullptr);
+
   function_table_initialized_ = true;
   REXLOG_INFO("Processor function table initialized: code={:08X}-{:08X}, image={:08X}-{:08X}",
               code_base, code_base + code_size, image_base, image_base + image_size);
@@ -265,19 +285,37 @@ bool Processor::InitializeFunctionTable(uint32_t code_base, uint32_t code_size,
 void Processor::SetFunction(uint32_t guest_address, ::PPCFunc* func) {
   assert_true(function_table_initialized_);
 
-  // Store in C++ map (for Processor::Execute/GetFunction)
-  function_table_[guest_address] = func;
+  // Addresses outside the code section are expected (IAT imports); those are
+  // called directly via __imp__ symbols, not through the function table.
+  uint32_t offset = guest_address - code_base_;
+  if (offset < code_size_) {
+    function_table_[offset / 4] = func;
+  }
 
   // Also write to guest memory (for PPC_LOOKUP_FUNC in recompiled code)
   memory_->SetFunction(guest_address, func);
 }
 
+size_t Processor::SetFunctions(const ::PPCFuncMapping* mappings) {
+  assert_true(function_table_initialized_);
+
+  // Fill the host-side mirror in one pass; Memory::SetFunctions handles the
+  // guest table with a single base translation instead of per-entry calls.
+  for (size_t i = 0; mappings[i].guest != 0; ++i) {
+    uint32_t offset = uint32_t(mappings[i].guest) - code_base_;
+    if (offset < code_size_ && mappings[i].host != nullptr) {
+      function_table_[offset / 4] = mappings[i].host;
+    }
+  }
+  return memory_->SetFunctions(mappings);
+}
+
 ::PPCFunc* Processor::GetFunction(uint32_t guest_address) {
-  auto it = function_table_.find(guest_address);
-  if (it != function_table_.end()) {
-    return it->second;
+  uint32_t offset = guest_address - code_base_;
+  if (offset >= code_size_) {
+    return nullptr;
   }
-  return nullptr;
+  return function_table_[offset / 4];
 }
 
 }  // namespace rex::runtime
@@ -9,7 +9,10 @@
  *              See LICENSE file in the project root for full license text.
  */
 
+#include <future>
+
 #include <rex/chrono/clock.h>
+#include <rex/cvar.h>
 #include <rex/filesystem/devices/host_path_device.h>
 #include <rex/filesystem/devices/null_device.h>
 #include <rex/filesystem/vfs.h>
@@ -17,14 +20,19 @@
 #include <rex/ppc/context.h>     // PPCFuncMapping
 #include <rex/ppc/exceptions.h>  // SEH exception support
 #include <rex/runtime.h>
+#include <rex/system/coverage_profiler.h>
+#include <rex/system/export_profiler.h>
 #include <rex/system/export_resolver.h>
 #include <rex/system/kernel_state.h>
 #include <rex/system/processor.h>
+#include <rex/system/startup_profiler.h>
 #include <rex/system/user_module.h>
 #include <rex/system/xmemory.h>
 #include <rex/system/xthread.h>
 #include <rex/thread.h>
 
+REXCVAR_DECLARE(bool, export_profiler);
+
 namespace rex {
 
 // Static instance for global access
@@ -53,6 +61,10 @@ X_STATUS Runtime::Setup(RuntimeConfig config) {
   // Enable threading affinity configuration
   thread::EnableAffinityConfiguration();
 
+  // Start sampling export dispatch if requested; the report is written at
+  // shutdown.
+  runtime::ExportProfiler::set_enabled(REXCVAR_GET(export_profiler));
+
   // Guard against reinitialization
   if (memory_) {
     REXSYS_ERROR("Runtime::Setup() called but already initialized");
@@ -61,18 +73,26 @@ X_STATUS Runtime::Setup(RuntimeConfig config) {
 
   tool_mode_ = config.tool_mode;
 
-  // Create memory system first
-  memory_ = std::make_unique<memory::Memory>();
-  if (!memory_->Initialize()) {
-    REXSYS_ERROR("Failed to initialize memory system");
-    memory_.reset();
-    return X_STATUS_UNSUCCESSFUL;
+  {
+    runtime::StartupPhaseTimer phase_timer("memory");
+
+    // Create memory system first
+    memory_ = std::make_unique<memory::Memory>();
+    if (!memory_->Initialize()) {
+      REXSYS_ERROR("Failed to initialize memory system");
+      memory_.reset();
+      return X_STATUS_UNSUCCESSFUL;
+    }
   }
 
-  export_resolver_ = std::make_unique<runtime::ExportResolver>();
+  {
+    runtime::StartupPhaseTimer phase_timer("processor");
+
+    export_resolver_ = std::make_unique<runtime::ExportResolver>();
 
-  processor_ = std::make_unique<runtime::Processor>(memory_.get(), export_resolver_.get());
-  REXSYS_INFO("Processor initialized");
+    processor_ = std::make_unique<runtime::Processor>(memory_.get(), export_resolver_.get());
+    REXSYS_INFO("Processor initialized");
+  }
 
   // Create virtual file system
   file_system_ = std::make_unique<rex::filesystem::VirtualFileSystem>();
@@ -80,8 +100,17 @@ X_STATUS Runtime::Setup(RuntimeConfig config) {
   // Create kernel state - this sets the global singleton
   kernel_state_ = std::make_unique<system::KernelState>(this);
 
+  // VFS mounting only touches file_system_ and the host filesystem, so it
+  // runs overlapped with the input/kernel/audio init below. Nothing consumes
+  // the mounts before the join - module load can't start until Setup returns.
+  auto vfs_future = std::async(std::launch::async, [this]() {
+    runtime::StartupPhaseTimer phase_timer("vfs");
+    return SetupVfs();
+  });
+
   // Initialize input from injected config
   if (config.input_factory) {
+    runtime::StartupPhaseTimer phase_timer("input");
     input_system_ = config.input_factory(tool_mode_);
     if (input_system_) {
       X_STATUS input_status = input_system_->Setup();
@@ -97,11 +126,13 @@ X_STATUS Runtime::Setup(RuntimeConfig config) {
 
   // HLE kernel modules and apps.
   if (config.kernel_init) {
+    runtime::StartupPhaseTimer phase_timer("kernel modules");
     config.kernel_init(this, kernel_state_.get());
   }
 
   // Initialize the APU (Audio Processing Unit) from injected config
   if (config.audio_factory) {
+    runtime::StartupPhaseTimer phase_timer("audio");
     audio_system_ = config.audio_factory(processor_.get());
     if (audio_system_) {
       X_STATUS audio_status = audio_system_->Setup(kernel_state_.get());
@@ -115,8 +146,8 @@ X_STATUS Runtime::Setup(RuntimeConfig config) {
     }
   }
 
-  // Set up VFS: game_data_root as game:/d:, update_data_root as update:
-  if (!SetupVfs()) {
+  // VFS: game_data_root as game:/d:, update_data_root as update:
+  if (!vfs_future.get()) {
     REXSYS_ERROR("Failed to set up VFS");
     return X_STATUS_UNSUCCESSFUL;
   }
@@ -124,11 +155,13 @@ X_STATUS Runtime::Setup(RuntimeConfig config) {
   // Skip GPU initialization in tool mode (for analysis tools like codegen)
   if (tool_mode_) {
     REXSYS_INFO("Runtime initialized in tool mode (no GPU)");
+    runtime::StartupProfiler::WriteSummary();
     return X_STATUS_SUCCESS;
   }
 
   // Initialize GPU from injected config
   if (config.graphics) {
+    runtime::StartupPhaseTimer phase_timer("graphics");
     graphics_system_ = std::move(config.graphics);
     bool with_presentation = (app_context_ != nullptr);
     X_STATUS gpu_status = graphics_system_->Setup(processor_.get(), kernel_state_.get(),
@@ -142,6 +175,7 @@ X_STATUS Runtime::Setup(RuntimeConfig config) {
   }
 
   REXSYS_INFO("Runtime initialized successfully");
+  runtime::StartupProfiler::WriteSummary();
   return X_STATUS_SUCCESS;
 }
 
@@ -166,16 +200,9 @@ X_STATUS Runtime::Setup(uint32_t code_base, uint32_t code_size, uint32_t image_b
     return X_STATUS_UNSUCCESSFUL;
   }
 
-  // Register all recompiled functions from the mapping table
+  // Register all recompiled functions from the mapping table in one bulk pass
   if (func_mappings) {
-    int count = 0;
-    for (int i = 0; func_mappings[i].guest != 0; ++i) {
-      if (func_mappings[i].host != nullptr) {
-        processor_->SetFunction(static_cast<uint32_t>(func_mappings[i].guest),
-                                func_mappings[i].host);
-        ++count;
-      }
-    }
+    size_t count = processor_->SetFunctions(func_mappings);
     REXSYS_DEBUG("Registered {} recompiled functions", count);
   }
 
@@ -193,6 +220,17 @@ void Runtime::Shutdown() {
     instance_ = nullptr;
   }
 
+  // Report sampled export dispatch times before the systems they name go away.
+  if (runtime::ExportProfiler::enabled()) {
+    runtime::ExportProfiler::set_enabled(false);
+    runtime::ExportProfiler::WriteReport();
+  }
+
+  // Dump guest call counts when the binary carries counter-instrumented code.
+  if (runtime::CoverageProfiler::available()) {
+    runtime::CoverageProfiler::WriteReport();
+  }
+
   // Destroy in reverse order
   if (graphics_system_) {
     graphics_system_->Shutdown();
@@ -279,6 +317,11 @@ bool Runtime::SetupVfs() {
   // Games handle "device not found" gracefully but don't handle actual device
   // errors (like NAME_COLLISION) well. Let cache: fail cleanly.
 
+  // Warm the host page cache from the previous run's guest access pattern
+  // (no-op unless vfs_access_trace is set).
+  file_system_->StartAccessTrace(std::filesystem::absolute(user_data_root_) /
+                                 "file_access.trace");
+
   return true;
 }
 
@@ -286,7 +329,12 @@ X_STATUS Runtime::LoadXexImage(const std::string_view module_path) {
   REXSYS_INFO("Loading XEX image: {}", std::string(module_path));
 
   auto module = system::object_ref<system::UserModule>(new system::UserModule(kernel_state_.get()));
-  X_STATUS status = module->LoadFromFile(module_path);
+  X_STATUS status;
+  {
+    // Covers XEX parsing, LZX decompression and patch application.
+    runtime::StartupPhaseTimer phase_timer("xex load");
+    status = module->LoadFromFile(module_path);
+  }
   if (XFAILED(status)) {
     REXSYS_ERROR("Runtime::LoadXexImage: Failed to load module, status {:08X}", status);
     return status;
@@ -304,13 +352,19 @@ system::object_ref<system::XThread> Runtime::LaunchModule() {
     return nullptr;
   }
 
-  auto thread = kernel_state_->LaunchModule(executable);
+  system::object_ref<system::XThread> thread;
+  {
+    runtime::StartupPhaseTimer phase_timer("launch");
+    thread = kernel_state_->LaunchModule(executable);
+  }
   if (!thread) {
     REXSYS_ERROR("Runtime::LaunchModule: Failed to launch module");
     return nullptr;
   }
 
   REXSYS_DEBUG("  Module launched on thread '{}'", thread->name());
+  // Rewrite the startup summary/trace now that module load is included.
+  runtime::StartupProfiler::WriteSummary();
   return thread;
 }
 
@@ -0,0 +1,107 @@
+/**
+ * @file        system/startup_profiler.cpp
+ * @brief       Wall-clock accounting for runtime startup phases
+ *
+ * @copyright   Copyright (c) 2026 Tom Clay <tomc@tctechstuff.com>
+ *              All rights reserved.
+ *
+ * @license     BSD 3-Clause License
+ *              See LICENSE file in the project root for full license text.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <rex/cvar.h>
+#include <rex/logging.h>
+#include <rex/system/startup_profiler.h>
+
+REXCVAR_DEFINE_STRING(startup_trace, "", "Runtime",
+                      "Write startup phase timings as chrome-trace JSON to this path "
+                      "(empty = log breakdown only)");
+
+namespace rex::runtime {
+
+namespace {
+
+struct PhaseRecord {
+  const char* name;
+  uint64_t start_us;  // Relative to the first recorded phase.
+  uint64_t duration_us;
+  uint64_t thread_id;
+};
+
+std::mutex phases_mutex_;
+std::vector<PhaseRecord> phases_;
+std::chrono::steady_clock::time_point epoch_;
+bool epoch_set_ = false;
+
+}  // namespace
+
+void StartupProfiler::RecordPhase(const char* name, std::chrono::steady_clock::time_point start,
+                                  std::chrono::steady_clock::time_point end) {
+  std::lock_guard<std::mutex> lock(phases_mutex_);
+  if (!epoch_set_) {
+    epoch_ = start;
+    epoch_set_ = true;
+  }
+  PhaseRecord record;
+  record.name = name;
+  record.start_us =
+      uint64_t(std::chrono::duration_cast<std::chrono::microseconds>(start - epoch_).count());
+  record.duration_us =
+      uint64_t(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+  record.thread_id = uint64_t(std::hash<std::thread::id>()(std::this_thread::get_id()));
+  phases_.push_back(record);
+}
+
+void StartupProfiler::WriteSummary() {
+  std::vector<PhaseRecord> phases;
+  {
+    std::lock_guard<std::mutex> lock(phases_mutex_);
+    phases = phases_;
+  }
+  if (phases.empty()) {
+    return;
+  }
+
+  // Wall time is first start to last end, not the phase sum - phases overlap.
+  uint64_t end_us = 0;
+  for (const auto& phase : phases) {
+    end_us = std::max(end_us, phase.start_us + phase.duration_us);
+  }
+  std::string out = fmt::format("Startup phases ({:.1f} ms wall):\n", end_us / 1000.0);
+  for (const auto& phase : phases) {
+    out += fmt::format("  {:<20} {:>8.1f} ms  (at +{:.1f} ms)\n", phase.name,
+                       phase.duration_us / 1000.0, phase.start_us / 1000.0);
+  }
+  REXSYS_INFO("{}", out);
+
+  std::string trace_path = REXCVAR_GET(startup_trace);
+  if (trace_path.empty()) {
+    return;
+  }
+  FILE* f = fopen(trace_path.c_str(), "w");
+  if (f == nullptr) {
+    REXSYS_WARN("Failed to write startup trace to {}", trace_path);
+    return;
+  }
+  fprintf(f, "{\"traceEvents\":[\n");
+  for (size_t i = 0; i < phases.size(); i++) {
+    const auto& phase = phases[i];
+    // Chrome trace complete events; tid is a hash, only identity matters.
+    fprintf(f,
+            "{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%llu,\"dur\":%llu,\"pid\":1,\"tid\":%llu}%s\n",
+            phase.name, (unsigned long long)phase.start_us, (unsigned long long)phase.duration_us,
+            (unsigned long long)(phase.thread_id % 100000), i + 1 < phases.size() ? "," : "");
+  }
+  fprintf(f, "]}\n");
+  fclose(f);
+  REXSYS_INFO("Startup trace written to {}", trace_path);
+}
+
+}  // namespace rex::runtime
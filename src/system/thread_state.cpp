@@ -11,17 +11,72 @@
 
 #include <cstdlib>
 #include <cstring>
+#include <mutex>
+#include <vector>
 
 #include <rex/assert.h>
+#include <rex/exception_handler.h>
 #include <rex/kernel.h>
 #include <rex/logging.h>
 #include <rex/system/thread_state.h>
+#include <rex/system/xmemory.h>
 #include <rex/thread.h>
 
 namespace rex::runtime {
 
 thread_local ThreadState* thread_state_ = nullptr;
 
+namespace {
+
+// Guest stacks carry a no-access guard page on either side (see
+// XThread::AllocateStack); an overflowing guest thread faults there instead
+// of corrupting a neighboring allocation, so stack checking costs zero
+// instructions in the emitted code. This registry lets the exception
+// handler attribute such a fault to the owning thread and say so before
+// dying, rather than reporting an anonymous access violation.
+struct StackGuardRange {
+  const ThreadState* owner;
+  uint32_t thread_id;
+  uint32_t stack_base;
+  uint32_t stack_limit;
+  uint32_t guard_size;
+  memory::Memory* memory;
+};
+
+std::mutex stack_guard_mutex_;
+std::vector<StackGuardRange> stack_guard_ranges_;
+
+bool StackGuardExceptionCallback(arch::Exception* ex, void*) {
+  if (ex->code() != arch::Exception::Code::kAccessViolation) {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(stack_guard_mutex_);
+  for (const auto& range : stack_guard_ranges_) {
+    uint64_t membase = uint64_t(range.memory->virtual_membase());
+    if (ex->fault_address() < membase || ex->fault_address() >= membase + 0x100000000ull) {
+      continue;
+    }
+    uint32_t guest_address = uint32_t(ex->fault_address() - membase);
+    if (guest_address >= range.stack_limit - range.guard_size &&
+        guest_address < range.stack_limit) {
+      REXSYS_CRITICAL("Guest stack overflow: thread {:X} hit the guard page at {:08X} "
+                      "(stack {:08X}-{:08X})",
+                      range.thread_id, guest_address, range.stack_limit, range.stack_base);
+      FatalError("Guest stack overflow");
+    }
+    if (guest_address >= range.stack_base && guest_address < range.stack_base + range.guard_size) {
+      REXSYS_CRITICAL("Guest stack overrun: thread {:X} hit the guard page at {:08X} "
+                      "(stack {:08X}-{:08X})",
+                      range.thread_id, guest_address, range.stack_limit, range.stack_base);
+      FatalError("Guest stack overrun");
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
 ThreadState::ThreadState(uint32_t thread_id, uint32_t stack_base, uint32_t pcr_address,
                          memory::Memory* memory)
     : memory_(memory), pcr_address_(pcr_address), thread_id_(thread_id) {
@@ -44,11 +99,40 @@ ThreadState::ThreadState(uint32_t thread_id, uint32_t stack_base, uint32_t pcr_a
 }
 
 ThreadState::~ThreadState() {
+  if (stack_guard_size_) {
+    std::lock_guard<std::mutex> lock(stack_guard_mutex_);
+    for (auto it = stack_guard_ranges_.begin(); it != stack_guard_ranges_.end(); ++it) {
+      if (it->owner == this) {
+        stack_guard_ranges_.erase(it);
+        break;
+      }
+    }
+  }
   if (thread_state_ == this) {
     thread_state_ = nullptr;
   }
 }
 
+void ThreadState::RegisterGuestStack(uint32_t stack_base, uint32_t stack_limit,
+                                     uint32_t guard_size) {
+  stack_base_ = stack_base;
+  stack_limit_ = stack_limit;
+  stack_guard_size_ = guard_size;
+
+  std::lock_guard<std::mutex> lock(stack_guard_mutex_);
+  if (stack_guard_ranges_.empty()) {
+    // First guest stack in the process; handlers stay installed for its
+    // lifetime since uninstalling on an exception path is not safe.
+    static bool handler_installed = false;
+    if (!handler_installed) {
+      arch::ExceptionHandler::Install(StackGuardExceptionCallback, nullptr);
+      handler_installed = true;
+    }
+  }
+  stack_guard_ranges_.push_back(
+      {this, thread_id_, stack_base_, stack_limit_, stack_guard_size_, memory_});
+}
+
 void ThreadState::Bind(ThreadState* thread_state) {
   thread_state_ = thread_state;
 }
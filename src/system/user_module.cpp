@@ -9,8 +9,14 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <filesystem>
+#include <future>
+#include <optional>
 #include <vector>
 
+#include <fmt/format.h>
+#include <xxhash.h>
+
 #include <rex/cvar.h>
 #include <rex/logging.h>
 #include <rex/runtime.h>
@@ -24,6 +30,11 @@
 #include <rex/system/xthread.h>
 
 REXCVAR_DEFINE_BOOL(xex_apply_patches, true, "Kernel", "Apply XEX patches");
+REXCVAR_DEFINE_STRING(xex_prelink_cache_dir, "", "Kernel",
+                      "Directory for prelinked XEX image cache files. Second and later launches "
+                      "of an unchanged title map the prepared (post-decryption, post-LZX, "
+                      "post-patch) image from the cache instead of redoing the work. Empty "
+                      "disables the cache.");
 
 namespace rex::system {
 
@@ -64,6 +75,81 @@ X_STATUS UserModule::LoadFromFile(const std::string_view path) {
   path_ = fs_entry->absolute_path();
   name_ = rex::string::utf8_find_base_name_from_guest_path(path_);
 
+  // Stage the xexp patch file (resolve + read) while the base image below
+  // loads and decompresses. Only host file I/O happens off-thread; the patch
+  // module itself is built from the staged bytes once the base load is done.
+  struct PatchStaging {
+    bool found = false;
+    X_STATUS result = X_STATUS_UNSUCCESSFUL;
+    std::vector<uint8_t> data;
+  };
+  std::future<PatchStaging> patch_staging;
+  if (REXCVAR_GET(xex_apply_patches)) {
+    patch_staging = std::async(std::launch::async, [this]() {
+      PatchStaging staging;
+      auto patch_entry = kernel_state()->file_system()->ResolvePath(path_ + "p");
+      if (!patch_entry) {
+        return staging;
+      }
+      staging.found = true;
+      staging.data.resize(patch_entry->size());
+      rex::filesystem::File* file = nullptr;
+      staging.result = patch_entry->Open(rex::filesystem::FileAccess::kGenericRead, &file);
+      if (XFAILED(staging.result)) {
+        return staging;
+      }
+      size_t bytes_read = 0;
+      staging.result = file->ReadSync(staging.data.data(), staging.data.size(), 0, &bytes_read);
+      file->Destroy();
+      staging.data.resize(bytes_read);
+      return staging;
+    });
+  }
+
+  // Prelinked cache probe. Keyed by the XXH3 digest of the basefile with any
+  // patch bytes folded in, so a changed basefile or patch misses cleanly. On
+  // a hit the prepared image is mapped straight into guest memory and both
+  // decompression and patching are skipped; on a miss prelink_path_/digest
+  // stay set so the full load below can populate the cache.
+  std::optional<PatchStaging> staged_patch;
+  std::filesystem::path prelink_path;
+  uint64_t prelink_digest = 0;
+  bool prelink_loaded = false;
+
+  auto try_load_prelinked = [&](const void* data, size_t length) -> bool {
+    const std::string& cache_dir = REXCVAR_GET(xex_prelink_cache_dir);
+    if (cache_dir.empty() || length < sizeof(memory::fourcc_t)) {
+      return false;
+    }
+    be<memory::fourcc_t> magic;
+    magic.value = memory::load<memory::fourcc_t>(data);
+    if (magic != runtime::kXEX1Signature && magic != runtime::kXEX2Signature) {
+      return false;
+    }
+    prelink_digest = XXH3_64bits(data, length);
+    // The cache stores the post-patch image, so the patch bytes are part of
+    // the key; resolving the staging future here costs the load/patch overlap
+    // only on the launch that misses.
+    if (patch_staging.valid()) {
+      staged_patch = patch_staging.get();
+      if (staged_patch->found && !staged_patch->result) {
+        prelink_digest = XXH3_64bits_withSeed(staged_patch->data.data(),
+                                              staged_patch->data.size(), prelink_digest);
+      }
+    }
+    prelink_path = std::filesystem::path(cache_dir) /
+                   fmt::format("{}-{:016x}.prelink", name_, prelink_digest);
+    auto xex_module = new runtime::XexModule(kernel_state()->processor(), kernel_state());
+    if (!xex_module->LoadPrelinked(name_, path_, prelink_path, prelink_digest)) {
+      delete xex_module;
+      return false;
+    }
+    module_format_ = kModuleFormatXex;
+    processor_module_ = xex_module;
+    prelink_loaded = true;
+    return true;
+  };
+
   // If the FS supports mapping, map the file in and load from that.
   if (fs_entry->can_map()) {
     // Map.
@@ -73,7 +159,11 @@ X_STATUS UserModule::LoadFromFile(const std::string_view path) {
     }
 
     // Load the module.
-    result = LoadFromMemory(mmap->data(), mmap->size());
+    if (try_load_prelinked(mmap->data(), mmap->size())) {
+      result = X_STATUS_PENDING;
+    } else {
+      result = LoadFromMemory(mmap->data(), mmap->size());
+    }
   } else {
     std::vector<uint8_t> buffer(fs_entry->size());
 
@@ -93,7 +183,11 @@ X_STATUS UserModule::LoadFromFile(const std::string_view path) {
     }
 
     // Load the module.
-    result = LoadFromMemory(buffer.data(), bytes_read);
+    if (try_load_prelinked(buffer.data(), bytes_read)) {
+      result = X_STATUS_PENDING;
+    } else {
+      result = LoadFromMemory(buffer.data(), bytes_read);
+    }
 
     // Close the file.
     file->Destroy();
@@ -104,17 +198,20 @@ X_STATUS UserModule::LoadFromFile(const std::string_view path) {
     return result;
   }
 
-  if (REXCVAR_GET(xex_apply_patches)) {
-    // Search for xexp patch file
-    auto patch_entry = kernel_state()->file_system()->ResolvePath(path_ + "p");
-
-    if (patch_entry) {
-      auto patch_path = patch_entry->absolute_path();
-
-      REXSYS_DEBUG("Loading XEX patch from {}", patch_path);
+  // The cache image is already patched; patching only runs on the full path.
+  if (!prelink_loaded) {
+    if (patch_staging.valid()) {
+      staged_patch = patch_staging.get();
+    }
+    if (staged_patch && staged_patch->found) {
+      REXSYS_DEBUG("Loading XEX patch from {}p", path_);
 
-      auto patch_module = object_ref<UserModule>(new UserModule(kernel_state_));
-      result = patch_module->LoadFromFile(patch_path);
+      result = staged_patch->result;
+      object_ref<UserModule> patch_module;
+      if (!result) {
+        patch_module = object_ref<UserModule>(new UserModule(kernel_state_));
+        result = patch_module->LoadFromMemory(staged_patch->data.data(), staged_patch->data.size());
+      }
       if (!result) {
         result = patch_module->xex_module()->ApplyPatch(xex_module());
         if (result) {
@@ -130,7 +227,22 @@ X_STATUS UserModule::LoadFromFile(const std::string_view path) {
     }
   }
 
-  return LoadXexContinue();
+  // Populate the cache before import fixup: LoadXexContinue overwrites
+  // variable-import slots with runtime guest addresses (SystemHeapAlloc
+  // results with no cross-run stability), and a cache hit re-runs the fixup
+  // against the original record encodings. Saved post-patch so the next
+  // launch of this basefile+patch combination maps the image directly.
+  if (!prelink_loaded && !prelink_path.empty()) {
+    xex_module()->SavePrelinked(prelink_path, prelink_digest);
+  }
+
+  result = LoadXexContinue();
+  if (XFAILED(result) && !prelink_loaded && !prelink_path.empty()) {
+    // Don't cache an image whose load didn't finish.
+    std::error_code ec;
+    std::filesystem::remove(prelink_path, ec);
+  }
+  return result;
 }
 
 X_STATUS UserModule::LoadFromMemory(const void* addr, const size_t length) {
@@ -11,6 +11,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <mutex>
 
 #include <rex/logging.h>
 #include <rex/stream.h>
@@ -27,7 +28,14 @@ ObjectTable::~ObjectTable() {
 }
 
 void ObjectTable::Reset() {
-  auto global_lock = global_critical_region_.Acquire();
+  std::lock_guard<std::recursive_mutex> lock(table_mutex_);
+
+  // No borrows can be outstanding at teardown; drop anything still parked.
+  for (auto* object : retired_objects_) {
+    object->Release();
+  }
+  retired_objects_.clear();
+  hazard_slots_.clear();
 
   // Release all objects.
   for (uint32_t n = 0; n < table_capacity_; n++) {
@@ -100,7 +108,8 @@ X_STATUS ObjectTable::AddHandle(XObject* object, X_HANDLE* out_handle) {
 
   uint32_t handle = 0;
   {
-    auto global_lock = global_critical_region_.Acquire();
+    std::lock_guard<std::recursive_mutex> lock(table_mutex_);
+    ReleaseRetiredObjects();
 
     // Find a free slot.
     uint32_t slot = 0;
@@ -146,7 +155,7 @@ X_STATUS ObjectTable::DuplicateHandle(X_HANDLE handle, X_HANDLE* out_handle) {
 }
 
 X_STATUS ObjectTable::RetainHandle(X_HANDLE handle) {
-  auto global_lock = global_critical_region_.Acquire();
+  std::lock_guard<std::recursive_mutex> lock(table_mutex_);
 
   ObjectTableEntry* entry = LookupTable(handle);
   if (!entry) {
@@ -158,7 +167,7 @@ X_STATUS ObjectTable::RetainHandle(X_HANDLE handle) {
 }
 
 X_STATUS ObjectTable::ReleaseHandle(X_HANDLE handle) {
-  auto global_lock = global_critical_region_.Acquire();
+  std::lock_guard<std::recursive_mutex> lock(table_mutex_);
 
   ObjectTableEntry* entry = LookupTable(handle);
   if (!entry) {
@@ -188,7 +197,8 @@ X_STATUS ObjectTable::RemoveHandle(X_HANDLE handle) {
     return X_STATUS_INVALID_HANDLE;
   }
 
-  auto global_lock = global_critical_region_.Acquire();
+  std::lock_guard<std::recursive_mutex> lock(table_mutex_);
+  ReleaseRetiredObjects();
   if (entry->object) {
     auto object = entry->object;
     entry->object = nullptr;
@@ -207,15 +217,16 @@ X_STATUS ObjectTable::RemoveHandle(X_HANDLE handle) {
     if (!object->name().empty()) {
       RemoveNameMapping(object->name());
     }
-    // Release now that the object has been removed from the table.
-    object->Release();
+    // Release now that the object has been removed from the table - deferred
+    // if a borrowed lookup still has it pinned.
+    ReleaseWhenUnhazarded(object);
   }
 
   return X_STATUS_SUCCESS;
 }
 
 std::vector<object_ref<XObject>> ObjectTable::GetAllObjects() {
-  auto lock = global_critical_region_.Acquire();
+  std::lock_guard<std::recursive_mutex> lock(table_mutex_);
   std::vector<object_ref<XObject>> results;
 
   for (uint32_t slot = 0; slot < table_capacity_; slot++) {
@@ -230,12 +241,12 @@ std::vector<object_ref<XObject>> ObjectTable::GetAllObjects() {
 }
 
 void ObjectTable::PurgeAllObjects() {
-  auto lock = global_critical_region_.Acquire();
+  std::lock_guard<std::recursive_mutex> lock(table_mutex_);
   for (uint32_t slot = 0; slot < table_capacity_; slot++) {
     auto& entry = table_[slot];
     if (entry.object && !entry.object->is_host_object()) {
       entry.handle_ref_count = 0;
-      entry.object->Release();
+      ReleaseWhenUnhazarded(entry.object);
 
       entry.object = nullptr;
     }
@@ -248,7 +259,7 @@ ObjectTable::ObjectTableEntry* ObjectTable::LookupTable(X_HANDLE handle) {
     return nullptr;
   }
 
-  auto global_lock = global_critical_region_.Acquire();
+  std::lock_guard<std::recursive_mutex> lock(table_mutex_);
 
   // Lower 2 bits are ignored.
   uint32_t slot = GetHandleSlot(handle);
@@ -267,6 +278,86 @@ object_ref<XObject> ObjectTable::LookupObject<XObject>(X_HANDLE handle) {
   return result;
 }
 
+// Generic borrowed lookup
+template <>
+ObjectTable::Borrowed<XObject> ObjectTable::LookupObjectBorrowed<XObject>(X_HANDLE handle) {
+  HazardSlot* slot = nullptr;
+  auto object = LookupObjectBorrowed(handle, &slot);
+  return Borrowed<XObject>(object, slot);
+}
+
+XObject* ObjectTable::LookupObjectBorrowed(X_HANDLE handle, HazardSlot** out_slot) {
+  *out_slot = nullptr;
+  handle = TranslateHandle(handle);
+  if (!handle) {
+    return nullptr;
+  }
+
+  std::lock_guard<std::recursive_mutex> lock(table_mutex_);
+
+  // Lower 2 bits are ignored.
+  uint32_t slot_index = GetHandleSlot(handle);
+  XObject* object = nullptr;
+  if (slot_index < table_capacity_) {
+    object = table_[slot_index].object;
+  }
+  if (!object) {
+    return nullptr;
+  }
+
+  // Pin the object in a hazard slot instead of retaining it. Publication is
+  // ordered against RemoveHandle by table_mutex_: any removal observes the
+  // pin and parks the object in retired_objects_ until the borrow ends.
+  for (auto& slot : hazard_slots_) {
+    if (!slot->object.load(std::memory_order_relaxed)) {
+      slot->object.store(object, std::memory_order_relaxed);
+      *out_slot = slot.get();
+      return object;
+    }
+  }
+  if (hazard_slots_.size() < kMaxHazardSlots) {
+    hazard_slots_.push_back(std::make_unique<HazardSlot>());
+    auto* slot = hazard_slots_.back().get();
+    slot->object.store(object, std::memory_order_relaxed);
+    *out_slot = slot;
+    return object;
+  }
+
+  // All slots busy - fall back to a plain retained reference; ~Borrowed
+  // releases it.
+  object->Retain();
+  return object;
+}
+
+bool ObjectTable::IsHazarded(XObject* object) {
+  for (auto& slot : hazard_slots_) {
+    if (slot->object.load(std::memory_order_acquire) == object) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void ObjectTable::ReleaseWhenUnhazarded(XObject* object) {
+  if (IsHazarded(object)) {
+    retired_objects_.push_back(object);
+  } else {
+    object->Release();
+  }
+}
+
+void ObjectTable::ReleaseRetiredObjects() {
+  auto it = retired_objects_.begin();
+  while (it != retired_objects_.end()) {
+    if (!IsHazarded(*it)) {
+      (*it)->Release();
+      it = retired_objects_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
 XObject* ObjectTable::LookupObject(X_HANDLE handle, bool already_locked) {
   handle = TranslateHandle(handle);
   if (!handle) {
@@ -275,7 +366,7 @@ XObject* ObjectTable::LookupObject(X_HANDLE handle, bool already_locked) {
 
   XObject* object = nullptr;
   if (!already_locked) {
-    global_critical_region_.mutex().lock();
+    table_mutex_.lock();
   }
 
   // Lower 2 bits are ignored.
@@ -295,14 +386,14 @@ XObject* ObjectTable::LookupObject(X_HANDLE handle, bool already_locked) {
   }
 
   if (!already_locked) {
-    global_critical_region_.mutex().unlock();
+    table_mutex_.unlock();
   }
 
   return object;
 }
 
 void ObjectTable::GetObjectsByType(XObject::Type type, std::vector<object_ref<XObject>>* results) {
-  auto global_lock = global_critical_region_.Acquire();
+  std::lock_guard<std::recursive_mutex> lock(table_mutex_);
   for (uint32_t slot = 0; slot < table_capacity_; ++slot) {
     auto& entry = table_[slot];
     if (entry.object) {
@@ -328,7 +419,7 @@ X_HANDLE ObjectTable::TranslateHandle(X_HANDLE handle) {
 }
 
 X_STATUS ObjectTable::AddNameMapping(const std::string_view name, X_HANDLE handle) {
-  auto global_lock = global_critical_region_.Acquire();
+  std::lock_guard<std::recursive_mutex> lock(table_mutex_);
   if (name_table_.count(string::string_key_case(name))) {
     return X_STATUS_OBJECT_NAME_COLLISION;
   }
@@ -338,7 +429,7 @@ X_STATUS ObjectTable::AddNameMapping(const std::string_view name, X_HANDLE handl
 
 void ObjectTable::RemoveNameMapping(const std::string_view name) {
   // Names are case-insensitive.
-  auto global_lock = global_critical_region_.Acquire();
+  std::lock_guard<std::recursive_mutex> lock(table_mutex_);
   auto it = name_table_.find(string::string_key_case(name));
   if (it != name_table_.end()) {
     name_table_.erase(it);
@@ -347,7 +438,7 @@ void ObjectTable::RemoveNameMapping(const std::string_view name) {
 
 X_STATUS ObjectTable::GetObjectByName(const std::string_view name, X_HANDLE* out_handle) {
   // Names are case-insensitive.
-  auto global_lock = global_critical_region_.Acquire();
+  std::lock_guard<std::recursive_mutex> lock(table_mutex_);
   auto it = name_table_.find(string::string_key_case(name));
   if (it == name_table_.end()) {
     *out_handle = X_INVALID_HANDLE_VALUE;
@@ -9,9 +9,18 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <algorithm>
+#include <chrono>
+
+#include <rex/cvar.h>
+#include <rex/logging.h>
 #include <rex/system/kernel_state.h>
 #include <rex/system/xam/app_manager.h>
 
+REXCVAR_DEFINE_BOOL(xam_dispatch_stats, false, "Kernel",
+                    "Count XMsg dispatches and wall time per (app, message) pair; "
+                    "the breakdown is logged at shutdown.");
+
 namespace rex {
 namespace system {
 namespace xam {
@@ -19,28 +28,64 @@ namespace xam {
 App::App(KernelState* kernel_state, uint32_t app_id)
     : kernel_state_(kernel_state), memory_(kernel_state->memory()), app_id_(app_id) {}
 
+AppManager::~AppManager() {
+  DumpDispatchStats();
+}
+
 void AppManager::RegisterApp(std::unique_ptr<App> app) {
-  assert_zero(app_lookup_.count(app->app_id()));
-  app_lookup_.insert({app->app_id(), app.get()});
+  assert_true(app->app_id() < kMaxAppId);
+  assert_null(app_index_[app->app_id()]);
+  app_index_[app->app_id()] = app.get();
   apps_.push_back(std::move(app));
 }
 
 X_HRESULT AppManager::DispatchMessageSync(uint32_t app_id, uint32_t message, uint32_t buffer_ptr,
                                           uint32_t buffer_length) {
-  const auto& it = app_lookup_.find(app_id);
-  if (it == app_lookup_.end()) {
+  auto* app = LookupApp(app_id);
+  if (!app) {
     return X_E_NOTFOUND;
   }
-  return it->second->DispatchMessageSync(message, buffer_ptr, buffer_length);
+  if (!REXCVAR_GET(xam_dispatch_stats)) {
+    return app->DispatchMessageSync(message, buffer_ptr, buffer_length);
+  }
+  auto start = std::chrono::steady_clock::now();
+  X_HRESULT result = app->DispatchMessageSync(message, buffer_ptr, buffer_length);
+  auto end = std::chrono::steady_clock::now();
+  RecordDispatch(app_id, message,
+                 uint64_t(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()));
+  return result;
 }
 
 X_HRESULT AppManager::DispatchMessageAsync(uint32_t app_id, uint32_t message, uint32_t buffer_ptr,
                                            uint32_t buffer_length) {
-  const auto& it = app_lookup_.find(app_id);
-  if (it == app_lookup_.end()) {
-    return X_E_NOTFOUND;
+  // Async requests are completed synchronously for now; route through the
+  // same fast path so the stats see every dispatch.
+  return DispatchMessageSync(app_id, message, buffer_ptr, buffer_length);
+}
+
+void AppManager::RecordDispatch(uint32_t app_id, uint32_t message, uint64_t duration_us) {
+  std::lock_guard<std::mutex> lock(stats_mutex_);
+  auto& stats = message_stats_[uint64_t(app_id) << 32 | message];
+  stats.calls++;
+  stats.total_us += duration_us;
+}
+
+void AppManager::DumpDispatchStats() {
+  std::vector<std::pair<uint64_t, MessageStats>> entries;
+  {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    entries.assign(message_stats_.begin(), message_stats_.end());
+  }
+  if (entries.empty()) {
+    return;
+  }
+  std::sort(entries.begin(), entries.end(),
+            [](const auto& a, const auto& b) { return a.second.total_us > b.second.total_us; });
+  REXSYS_INFO("XMsg dispatch stats ({} distinct (app, message) pairs):", entries.size());
+  for (const auto& [key, stats] : entries) {
+    REXSYS_INFO("  app 0x{:02X} msg 0x{:08X}: {} calls, {:.1f} ms", uint32_t(key >> 32),
+                uint32_t(key), stats.calls, stats.total_us / 1000.0);
   }
-  return it->second->DispatchMessageSync(message, buffer_ptr, buffer_length);
 }
 
 }  // namespace xam
@@ -89,6 +89,25 @@ std::vector<XCONTENT_AGGREGATE_DATA> ContentManager::ListContent(uint32_t device
   // Search path:
   // content_root/title_id/type_name/*
   auto package_root = ResolvePackageRoot(content_type, title_id);
+
+  // One stat on the package root decides whether the cached enumeration is
+  // still valid - adding or removing a package updates the directory's write
+  // time. Saves a full rescan per enumerator on slow content stores.
+  std::error_code ec;
+  auto root_write_time = std::filesystem::last_write_time(package_root, ec);
+  if (ec) {
+    root_write_time = std::filesystem::file_time_type::min();
+  }
+
+  const auto cache_key = std::make_tuple(device_id, uint32_t(content_type), title_id);
+  {
+    auto global_lock = global_critical_region_.Acquire();
+    auto it = list_content_cache_.find(cache_key);
+    if (it != list_content_cache_.end() && it->second.root_write_time == root_write_time) {
+      return it->second.content;
+    }
+  }
+
   auto file_infos = rex::filesystem::ListFiles(package_root);
   for (const auto& file_info : file_infos) {
     if (file_info.type != rex::filesystem::FileInfo::Type::kDirectory) {
@@ -104,9 +123,30 @@ std::vector<XCONTENT_AGGREGATE_DATA> ContentManager::ListContent(uint32_t device
     result.emplace_back(std::move(content_data));
   }
 
+  {
+    auto global_lock = global_critical_region_.Acquire();
+    list_content_cache_[cache_key] = {root_write_time, result};
+  }
+
   return result;
 }
 
+void ContentManager::InvalidateListContentCache(XContentType content_type, uint32_t title_id) {
+  // Write-time granularity on network filesystems can be too coarse to catch
+  // a create/delete immediately followed by an enumeration, so our own
+  // mutations invalidate explicitly. Callers hold the global lock.
+  if (title_id == kCurrentlyRunningTitleId) {
+    title_id = kernel_state_->title_id();
+  }
+  for (auto it = list_content_cache_.begin(); it != list_content_cache_.end();) {
+    if (std::get<1>(it->first) == uint32_t(content_type) && std::get<2>(it->first) == title_id) {
+      it = list_content_cache_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
 std::unique_ptr<ContentPackage> ContentManager::ResolvePackage(
     const std::string_view root_name, const XCONTENT_AGGREGATE_DATA& data) {
   auto package_path = ResolvePackagePath(data);
@@ -144,6 +184,8 @@ X_RESULT ContentManager::CreateContent(const std::string_view root_name,
     return X_ERROR_ACCESS_DENIED;
   }
 
+  InvalidateListContentCache(data.content_type, data.title_id);
+
   auto package = ResolvePackage(root_name, data);
   assert_not_null(package);
 
@@ -215,7 +257,9 @@ X_RESULT ContentManager::SetContentThumbnail(const XCONTENT_AGGREGATE_DATA& data
                                              std::vector<uint8_t> buffer) {
   auto global_lock = global_critical_region_.Acquire();
   auto package_path = ResolvePackagePath(data);
+  // May create the package directory, making new content enumerable.
   std::filesystem::create_directories(package_path);
+  InvalidateListContentCache(data.content_type, data.title_id);
   if (std::filesystem::exists(package_path)) {
     auto thumb_path = package_path / kThumbnailFileName;
     auto file = rex::filesystem::OpenFile(thumb_path, "wb");
@@ -237,6 +281,7 @@ X_RESULT ContentManager::DeleteContent(const XCONTENT_AGGREGATE_DATA& data) {
 
   auto package_path = ResolvePackagePath(data);
   if (std::filesystem::remove_all(package_path) > 0) {
+    InvalidateListContentCache(data.content_type, data.title_id);
     return X_ERROR_SUCCESS;
   } else {
     return X_ERROR_FILE_NOT_FOUND;
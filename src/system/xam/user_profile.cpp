@@ -99,6 +99,9 @@ void UserProfile::AddSetting(std::unique_ptr<Setting> setting) {
 
   if (setting->is_set && setting->is_title_specific()) {
     SaveSetting(setting.get());
+    // Write-through: the in-memory value now matches what was just saved, so
+    // reads for this title can stay memory-only instead of reloading it.
+    setting->loaded_title_id = kernel_state()->title_id();
   }
 
   if (previous_setting) {
@@ -146,8 +149,12 @@ void UserProfile::LoadSetting(UserProfile::Setting* setting) {
       fread(serialized_data.data(), 1, serialized_data.size(), file);
       fclose(file);
       setting->Deserialize(serialized_data);
-      setting->loaded_title_id = kernel_state()->title_id();
     }
+    // Stamp even when the file doesn't exist - titles poll unset settings
+    // every frame for UI state, and re-probing the filesystem per poll is a
+    // wasted round trip. A write through AddSetting re-stamps, and a title
+    // change invalidates via the loaded_title_id check in GetSetting.
+    setting->loaded_title_id = kernel_state()->title_id();
   } else {
     // Unsupported for now.  Other settings aren't per-game and need to be
     // stored some other way.
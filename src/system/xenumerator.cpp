@@ -72,4 +72,35 @@ uint32_t XStaticUntypedEnumerator::WriteItems(uint32_t buffer_ptr, uint8_t* buff
   return X_ERROR_SUCCESS;
 }
 
+uint32_t XLazyUntypedEnumerator::WriteItems(uint32_t buffer_ptr, uint8_t* buffer_data,
+                                            uint32_t* written_count) {
+  if (readahead_offset_ == readahead_.size() && !end_reached_) {
+    size_t fetch_count = items_per_enumerate() * kReadaheadBatches;
+    readahead_.resize(fetch_count * item_size());
+    readahead_offset_ = 0;
+    size_t produced = produce_fn_(next_item_, fetch_count, readahead_.data());
+    next_item_ += produced;
+    readahead_.resize(produced * item_size());
+    if (produced < fetch_count) {
+      end_reached_ = true;
+    }
+  }
+
+  size_t count =
+      std::min((readahead_.size() - readahead_offset_) / item_size(), items_per_enumerate());
+  if (!count) {
+    return X_ERROR_NO_MORE_FILES;
+  }
+
+  std::memcpy(buffer_data, readahead_.data() + readahead_offset_, count * item_size());
+
+  readahead_offset_ += count * item_size();
+
+  if (written_count) {
+    *written_count = static_cast<uint32_t>(count);
+  }
+
+  return X_ERROR_SUCCESS;
+}
+
 }  // namespace rex::system
@@ -15,7 +15,10 @@
 #include "pe/pe_image.h"
 
 #include <algorithm>
+#include <future>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -38,10 +41,12 @@ static const uint8_t xe_xex2_retail_key[16] = {0x20, 0xB1, 0x85, 0xA5, 0x9D, 0x2
 static const uint8_t xe_xex2_devkit_key[16] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
                                                0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
-void aes_decrypt_buffer(const uint8_t* session_key, const uint8_t* input_buffer,
-                        const size_t input_size, uint8_t* output_buffer, const size_t output_size) {
+// CBC decryption with caller-owned chaining state, so a buffer can be
+// decrypted in sequential pieces (per XEX compression block) with the IV
+// carried across calls.
+void aes_decrypt_buffer_cbc(const uint8_t* session_key, const uint8_t* input_buffer,
+                            const size_t input_size, uint8_t* output_buffer, uint8_t ivec[16]) {
   uint32_t rk[4 * (MAXNR + 1)];
-  uint8_t ivec[16] = {0};
   int32_t Nr = rijndaelKeySetupDec(rk, session_key, 128);
   const uint8_t* ct = input_buffer;
   uint8_t* pt = output_buffer;
@@ -57,6 +62,12 @@ void aes_decrypt_buffer(const uint8_t* session_key, const uint8_t* input_buffer,
   }
 }
 
+void aes_decrypt_buffer(const uint8_t* session_key, const uint8_t* input_buffer,
+                        const size_t input_size, uint8_t* output_buffer, const size_t output_size) {
+  uint8_t ivec[16] = {0};
+  aes_decrypt_buffer_cbc(session_key, input_buffer, input_size, output_buffer, ivec);
+}
+
 namespace rex::runtime {
 
 using rex::system::KernelState;
@@ -380,37 +391,54 @@ int XexModule::ApplyPatch(XexModule* module) {
     memset(base_exe + image_target_size, 0, original_image_size - image_target_size);
   }
 
-  // Now loop through each block and apply the delta patches inside
+  // Stage the block chain up front - each block's leading 24 bytes describe
+  // the block that follows, so the walk itself is just pointer arithmetic.
+  struct PatchBlock {
+    const xex2_compressed_block_info* info;
+    const uint8_t* data;  // Block start, including the next-block header.
+  };
+  std::vector<PatchBlock> blocks;
   while (cur_block->block_size) {
+    blocks.push_back({cur_block, p});
     const auto* next_block = (const xex2_compressed_block_info*)p;
+    p += cur_block->block_size;
+    cur_block = next_block;
+  }
 
-    // Compare block hash, if no match we probably used wrong decrypt key
-    s.reset();
-    s.processBytes(p, cur_block->block_size);
-    s.finalize(digest);
-
-    if (memcmp(digest, cur_block->block_hash, 0x14) != 0) {
+  // SHA-1 verification of the staged blocks fans out across threads. If a
+  // hash doesn't match we probably used the wrong decrypt key.
+  std::vector<std::future<bool>> verified;
+  verified.reserve(blocks.size());
+  for (const auto& block : blocks) {
+    verified.push_back(std::async(std::launch::async, [data = block.data, info = block.info]() {
+      uint8_t block_digest[0x14];
+      sha1::SHA1 block_sha;
+      block_sha.processBytes(data, info->block_size);
+      block_sha.finalize(block_digest);
+      return memcmp(block_digest, info->block_hash, 0x14) == 0;
+    }));
+  }
+
+  // Application stays strictly serial: delta records copy from old addresses
+  // within the image being patched and LZX reference windows read from it
+  // (see lzxdelta_apply_patch), so blocks cannot be applied out of order. A
+  // block is only ever applied after its verification has completed; on early
+  // exit the remaining futures join in their destructors.
+  for (size_t i = 0; i < blocks.size(); i++) {
+    if (!verified[i].get()) {
       result_code = 9;
       REXLOG_ERROR("XEX patch block hash doesn't match hash inside block info!");
       break;
     }
 
-    // skip block info
-    p += 20;
-    p += 4;
-
-    uint32_t block_data_size = cur_block->block_size - 20 - 4;
-
-    // Apply delta patch
+    // Apply delta patch, skipping the 24-byte block info.
+    uint32_t block_data_size = blocks[i].info->block_size - 20 - 4;
     result_code =
-        lzxdelta_apply_patch((xex2_delta_patch*)p, block_data_size,
+        lzxdelta_apply_patch((xex2_delta_patch*)(blocks[i].data + 20 + 4), block_data_size,
                              file_format_header->compression_info.normal.window_size, base_exe);
     if (result_code) {
       break;
     }
-
-    p += block_data_size;
-    cur_block = next_block;
   }
 
   if (!result_code) {
@@ -632,32 +660,40 @@ int XexModule::ReadImageCompressed(const void* xex_addr, size_t xex_length) {
   //   20b hash of entire next block (including size/hash)
   //    Nb block uint8_ts
   // - decompress block contents
+  //
+  // The LZX stream itself is sequential (one window), but the block framing
+  // lets us pipeline: decryption, hashing and de-blocking run per block on
+  // this thread while lzx_decompress_pipelined consumes the published bytes
+  // on another, so decode overlaps the AES/SHA-1 passes instead of waiting
+  // for them to finish over the whole basefile.
 
   uint8_t* compress_buffer = NULL;
   const uint8_t* p = NULL;
   uint8_t* d = NULL;
   sha1::SHA1 s;
 
-  // Decrypt (if needed).
-  bool free_input = false;
-  const uint8_t* input_buffer = exe_buffer;
-  size_t input_size = exe_length;
-
+  bool encrypted = false;
   switch (opt_file_format_info()->encryption_type) {
     case XEX_ENCRYPTION_NONE:
-      // No-op.
       break;
     case XEX_ENCRYPTION_NORMAL:
-      // TODO: a way to do without a copy/alloc?
-      free_input = true;
-      input_buffer = (const uint8_t*)calloc(1, exe_length);
-      aes_decrypt_buffer(session_key_, exe_buffer, exe_length, (uint8_t*)input_buffer, exe_length);
+      encrypted = true;
       break;
     default:
       assert_always();
       return 1;
   }
 
+  // Decrypted per block below, with the CBC IV carried across blocks.
+  // TODO: a way to do without a copy/alloc?
+  bool free_input = false;
+  const uint8_t* input_buffer = exe_buffer;
+  if (encrypted) {
+    free_input = true;
+    input_buffer = (const uint8_t*)calloc(1, exe_length);
+  }
+  uint8_t ivec[16] = {0};
+
   const auto* compression_info = &opt_file_format_info()->compression_info;
   const xex2_compressed_block_info* cur_block = &compression_info->normal.first_block;
 
@@ -666,11 +702,48 @@ int XexModule::ReadImageCompressed(const void* xex_addr, size_t xex_length) {
   p = input_buffer;
   d = compress_buffer;
 
+  // Allocate in-place the XEX memory before starting the decompressor.
+  uint32_t uncompressed_size = image_size();
+  bool alloc_result =
+      memory()
+          ->LookupHeap(base_address_)
+          ->AllocFixed(base_address_, uncompressed_size, 4096,
+                       rex::memory::kMemoryAllocationReserve | rex::memory::kMemoryAllocationCommit,
+                       rex::memory::kMemoryProtectRead | rex::memory::kMemoryProtectWrite);
+  if (!alloc_result) {
+    REXLOG_ERROR("Unable to allocate XEX memory at {:08X}-{:08X}.", base_address_,
+                 uncompressed_size);
+    free((void*)compress_buffer);
+    if (free_input) {
+      free((void*)input_buffer);
+    }
+    return 3;
+  }
+
+  uint8_t* buffer = memory()->TranslateVirtual(base_address_);
+  std::memset(buffer, 0, uncompressed_size);
+
+  // Decode ahead: the decompressor blocks in its read callback until the
+  // de-blocking loop below publishes the bytes it needs.
+  lzx_stream_buffer stream(compress_buffer, exe_length);
+  int decompress_result = 1;
+  std::thread decompress_thread([&]() {
+    decompress_result = lzx_decompress_pipelined(&stream, buffer, uncompressed_size,
+                                                 compression_info->normal.window_size);
+  });
+
   // De-block.
   int result_code = 0;
 
   uint8_t block_calced_digest[0x14];
   while (cur_block->block_size) {
+    if (encrypted) {
+      // Decrypt just this block; the IV chains from the previous one.
+      size_t offset = p - input_buffer;
+      aes_decrypt_buffer_cbc(session_key_, exe_buffer + offset, cur_block->block_size,
+                             (uint8_t*)input_buffer + offset, ivec);
+    }
+
     const uint8_t* pnext = p + cur_block->block_size;
     const auto* next_block = (const xex2_compressed_block_info*)p;
 
@@ -699,34 +772,18 @@ int XexModule::ReadImageCompressed(const void* xex_addr, size_t xex_length) {
       d += chunk_size;
     }
 
+    stream.Publish(d - compress_buffer);
+
     p = pnext;
     cur_block = next_block;
   }
 
-  if (!result_code) {
-    uint32_t uncompressed_size = image_size();
+  // Unblocks the decompressor; on a short (errored) stream it fails cleanly.
+  stream.Finish();
+  decompress_thread.join();
 
-    // Allocate in-place the XEX memory.
-    bool alloc_result =
-        memory()
-            ->LookupHeap(base_address_)
-            ->AllocFixed(
-                base_address_, uncompressed_size, 4096,
-                rex::memory::kMemoryAllocationReserve | rex::memory::kMemoryAllocationCommit,
-                rex::memory::kMemoryProtectRead | rex::memory::kMemoryProtectWrite);
-
-    if (alloc_result) {
-      uint8_t* buffer = memory()->TranslateVirtual(base_address_);
-      std::memset(buffer, 0, uncompressed_size);
-
-      // Decompress into XEX base
-      result_code = lzx_decompress(compress_buffer, d - compress_buffer, buffer, uncompressed_size,
-                                   compression_info->normal.window_size, nullptr, 0);
-    } else {
-      REXLOG_ERROR("Unable to allocate XEX memory at {:08X}-{:08X}.", base_address_,
-                   uncompressed_size);
-      result_code = 3;
-    }
+  if (!result_code) {
+    result_code = decompress_result;
   }
 
   if (compress_buffer) {
@@ -1005,7 +1062,13 @@ bool XexModule::LoadContinue() {
       assert_true(library_name_index < opt_import_libraries->string_table.count);
       assert_not_null(string_table[library_name_index]);
       auto library_name = std::string(string_table[library_name_index]);
-      SetupLibraryImports(library_name, library);
+      // Patch guest-visible variable imports now; everything else (ordinal
+      // pairing, symbol names) is built on first use by BuildImportLibraries.
+      PendingImportLibrary pending;
+      pending.name = library_name;
+      pending.library_offset = library_offset;
+      PatchVariableImports(library_name, library, &pending.variable_records);
+      pending_import_libs_.push_back(std::move(pending));
       library_offset += library->size;
     }
   }
@@ -1051,12 +1114,141 @@ bool XexModule::Unload() {
   }
 
   xex_header_mem_.resize(0);
+  pending_import_libs_.clear();
 
   return true;
 }
 
-bool XexModule::SetupLibraryImports(const std::string_view name,
-                                    const xex2_import_library* library) {
+// Prelinked cache file layout: PrelinkedHeader, then the (post-patch) XEX
+// headers, then the prepared image bytes as they sit in guest memory.
+namespace {
+
+constexpr uint32_t kPrelinkedMagic = memory::make_fourcc("RXPL");
+constexpr uint32_t kPrelinkedVersion = 1;
+
+struct PrelinkedHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t basefile_digest;
+  uint32_t xex_format;
+  uint32_t is_dev_kit;
+  uint32_t base_address;
+  uint32_t header_size;
+  uint32_t image_size;
+  uint32_t reserved;
+};
+
+}  // namespace
+
+bool XexModule::LoadPrelinked(const std::string_view name, const std::string_view path,
+                              const std::filesystem::path& cache_path, uint64_t basefile_digest) {
+  assert_false(loaded_);
+
+  FILE* file = fopen(cache_path.string().c_str(), "rb");
+  if (!file) {
+    return false;
+  }
+
+  PrelinkedHeader prelinked;
+  if (fread(&prelinked, sizeof(prelinked), 1, file) != 1 ||
+      prelinked.magic != kPrelinkedMagic || prelinked.version != kPrelinkedVersion ||
+      prelinked.basefile_digest != basefile_digest || !prelinked.base_address ||
+      !prelinked.header_size || !prelinked.image_size) {
+    // Stale, truncated, or from a different basefile - fall back to a full
+    // load, which will rewrite the cache.
+    fclose(file);
+    return false;
+  }
+
+  xex_header_mem_.resize(prelinked.header_size);
+  if (fread(xex_header_mem_.data(), 1, prelinked.header_size, file) != prelinked.header_size) {
+    fclose(file);
+    xex_header_mem_.resize(0);
+    return false;
+  }
+
+  xex_format_ = XexFormat(prelinked.xex_format);
+  is_dev_kit_ = prelinked.is_dev_kit != 0;
+  ReadSecurityInfo();
+
+  name_ = name;
+  path_ = path;
+  base_address_ = prelinked.base_address;
+
+  // Map the prepared image straight into guest memory, mirroring the
+  // allocation ReadImage would have made.
+  auto heap = memory()->LookupHeap(base_address_);
+  heap->Reset();
+  if (!heap->AllocFixed(base_address_, prelinked.image_size, 4096,
+                        rex::memory::kMemoryAllocationReserve | rex::memory::kMemoryAllocationCommit,
+                        rex::memory::kMemoryProtectRead | rex::memory::kMemoryProtectWrite)) {
+    REXLOG_ERROR("Unable to allocate XEX memory at {:08X}-{:08X}.", base_address_,
+                 prelinked.image_size);
+    fclose(file);
+    return false;
+  }
+
+  uint8_t* buffer = memory()->TranslateVirtual(base_address_);
+  if (fread(buffer, 1, prelinked.image_size, file) != prelinked.image_size) {
+    fclose(file);
+    return false;
+  }
+  fclose(file);
+
+  if (!is_valid_executable()) {
+    return false;
+  }
+
+  loaded_ = true;
+  REXLOG_INFO("Loaded prelinked XEX image from cache: {} ({} bytes at {:08X})",
+              cache_path.string(), prelinked.image_size, base_address_);
+  return true;
+}
+
+bool XexModule::SavePrelinked(const std::filesystem::path& cache_path,
+                              uint64_t basefile_digest) const {
+  if (!loaded_ || !base_address_ || is_patch()) {
+    return false;
+  }
+
+  PrelinkedHeader prelinked = {};
+  prelinked.magic = kPrelinkedMagic;
+  prelinked.version = kPrelinkedVersion;
+  prelinked.basefile_digest = basefile_digest;
+  prelinked.xex_format = uint32_t(xex_format_);
+  prelinked.is_dev_kit = is_dev_kit_ ? 1 : 0;
+  prelinked.base_address = base_address_;
+  prelinked.header_size = uint32_t(xex_header_mem_.size());
+  prelinked.image_size = image_size();
+
+  std::error_code ec;
+  std::filesystem::create_directories(cache_path.parent_path(), ec);
+
+  FILE* file = fopen(cache_path.string().c_str(), "wb");
+  if (!file) {
+    REXLOG_WARN("Could not write prelinked XEX cache to {}", cache_path.string());
+    return false;
+  }
+
+  const uint8_t* image = memory()->TranslateVirtual(base_address_);
+  bool ok = fwrite(&prelinked, sizeof(prelinked), 1, file) == 1 &&
+            fwrite(xex_header_mem_.data(), 1, prelinked.header_size, file) ==
+                prelinked.header_size &&
+            fwrite(image, 1, prelinked.image_size, file) == prelinked.image_size;
+  fclose(file);
+  if (!ok) {
+    std::filesystem::remove(cache_path, ec);
+    return false;
+  }
+
+  REXLOG_DEBUG("Saved prelinked XEX image to cache: {} ({} bytes)", cache_path.string(),
+               prelinked.image_size);
+  return true;
+}
+
+bool XexModule::PatchVariableImports(
+    const std::string_view name, const xex2_import_library* library,
+    std::vector<std::pair<uint16_t, uint32_t>>* out_variable_records) {
   // NOTE(tomc): import resolution is done at compile time.
   // however, we still need to patch variable imports in guest memory
   // since they are accessed via memory loads, not function calls.
@@ -1066,6 +1258,88 @@ bool XexModule::SetupLibraryImports(const std::string_view name,
   // Get export resolver for variable import patching
   auto* export_resolver = kernel_state_->emulator()->export_resolver();
 
+  for (uint32_t i = 0; i < library->count; i++) {
+    uint32_t record_addr = library->import_table[i];
+    if (!record_addr)
+      continue;
+
+    auto record_slot = memory()->TranslateVirtual<rex::be<uint32_t>*>(record_addr);
+    uint32_t record_value = *record_slot;
+
+    uint16_t record_type = (record_value & 0xFF000000) >> 24;
+    uint16_t ordinal = record_value & 0xFFFF;
+
+    if (record_type != 0) {
+      continue;
+    }
+
+    // Keep the original encoding around - the patch below destroys it and
+    // the lazy metadata pass still needs the ordinal.
+    out_variable_records->emplace_back(ordinal, record_addr);
+
+    if (!export_resolver) {
+      continue;
+    }
+
+    // Variable import - patch with the actual address
+    auto kernel_export = export_resolver->GetExportByOrdinal(base_name, ordinal);
+    if (kernel_export && kernel_export->type == runtime::Export::Type::kVariable) {
+      if (kernel_export->is_implemented() && kernel_export->variable_ptr) {
+        // Write the variable address to guest memory
+        *record_slot = kernel_export->variable_ptr;
+        REXLOG_DEBUG("Patched variable import {}:{:#x} ({}) -> {:#x}", base_name, ordinal,
+                     kernel_export->name, kernel_export->variable_ptr);
+      } else {
+        // write garbage value if we don't have it implemented
+        *record_slot = 0xD000BEEF | (kernel_export->ordinal & 0xFFF) << 16;
+        REXLOG_WARN("Variable import {}:{:#x} ({}) not implemented", base_name, ordinal,
+                    kernel_export->name);
+      }
+    }
+  }
+
+  return true;
+}
+
+void XexModule::BuildImportLibraries() {
+  if (import_libs_built_) {
+    return;
+  }
+  import_libs_built_ = true;
+
+  if (pending_import_libs_.empty() || xex_header_mem_.empty()) {
+    return;
+  }
+
+  xex2_opt_import_libraries* opt_import_libraries = nullptr;
+  GetOptHeader(XEX_HEADER_IMPORT_LIBRARIES, &opt_import_libraries);
+  if (!opt_import_libraries) {
+    return;
+  }
+
+  auto library_data = reinterpret_cast<uint8_t*>(opt_import_libraries);
+  for (const auto& pending : pending_import_libs_) {
+    auto library = reinterpret_cast<xex2_import_library*>(library_data + pending.library_offset);
+    BuildImportLibrary(pending, library);
+  }
+
+  // Expose the imports through binary introspection now that they exist.
+  for (const auto& lib : import_libs_) {
+    for (const auto& import : lib.imports) {
+      BinarySymbol sym;
+      sym.name = fmt::format("{}@{}", lib.name, import.ordinal);
+      sym.address = import.thunk_address;
+      sym.size = 16;  // Thunk size: 2 ordinal words + mtctr + bctr
+      sym.type = BinarySymbolType::Import;
+      binary_symbols_.push_back(std::move(sym));
+    }
+  }
+}
+
+bool XexModule::BuildImportLibrary(const PendingImportLibrary& pending,
+                                   const xex2_import_library* library) {
+  auto base_name = rex::string::utf8_find_base_name_from_guest_path(pending.name);
+
   ImportLibrary library_info;
   library_info.name = base_name;
   library_info.id = library->id;
@@ -1077,6 +1351,14 @@ bool XexModule::SetupLibraryImports(const std::string_view name,
   // They may not come in immediate succession, so we pair by ordinal.
   std::unordered_map<uint16_t, ImportLibraryFn> import_map;
 
+  // Variable records come from the snapshot captured before load-time
+  // patching overwrote their ordinal encoding.
+  for (const auto& [ordinal, value_address] : pending.variable_records) {
+    auto& import_info = import_map[ordinal];
+    import_info.ordinal = ordinal;
+    import_info.value_address = value_address;
+  }
+
   for (uint32_t i = 0; i < library->count; i++) {
     uint32_t record_addr = library->import_table[i];
     if (!record_addr)
@@ -1088,35 +1370,16 @@ bool XexModule::SetupLibraryImports(const std::string_view name,
     uint16_t record_type = (record_value & 0xFF000000) >> 24;
     uint16_t ordinal = record_value & 0xFFFF;
 
+    if (record_type != 1) {
+      // Variable records were handled above (and no longer parse anyway).
+      continue;
+    }
+
+    // Thunk import - thunk_address is the function pointer location
+    // This is the address we need for function table registration
     auto& import_info = import_map[ordinal];
     import_info.ordinal = ordinal;
-
-    if (record_type == 0) {
-      // Variable import - value_address is where the variable value is stored
-      import_info.value_address = record_addr;
-
-      // Patch variable imports in guest memory with the actual address
-      if (export_resolver) {
-        auto kernel_export = export_resolver->GetExportByOrdinal(base_name, ordinal);
-        if (kernel_export && kernel_export->type == runtime::Export::Type::kVariable) {
-          if (kernel_export->is_implemented() && kernel_export->variable_ptr) {
-            // Write the variable address to guest memory
-            *record_slot = kernel_export->variable_ptr;
-            REXLOG_DEBUG("Patched variable import {}:{:#x} ({}) -> {:#x}", base_name, ordinal,
-                         kernel_export->name, kernel_export->variable_ptr);
-          } else {
-            // write garbage value if we don't have it implemented
-            *record_slot = 0xD000BEEF | (kernel_export->ordinal & 0xFFF) << 16;
-            REXLOG_WARN("Variable import {}:{:#x} ({}) not implemented", base_name, ordinal,
-                        kernel_export->name);
-          }
-        }
-      }
-    } else if (record_type == 1) {
-      // Thunk import - thunk_address is the function pointer location
-      // This is the address we need for function table registration
-      import_info.thunk_address = record_addr;
-    }
+    import_info.thunk_address = record_addr;
   }
 
   // Convert map to vector (sorted by ordinal for consistent output)
@@ -1170,17 +1433,7 @@ void XexModule::PopulateBinaryData() {
     binary_sections_.push_back(std::move(sec));
   }
 
-  // Populate symbols from import libraries
-  for (const auto& lib : import_libs_) {
-    for (const auto& import : lib.imports) {
-      BinarySymbol sym;
-      sym.name = fmt::format("{}@{}", lib.name, import.ordinal);
-      sym.address = import.thunk_address;
-      sym.size = 16;  // Thunk size: 2 ordinal words + mtctr + bctr
-      sym.type = BinarySymbolType::Import;
-      binary_symbols_.push_back(std::move(sym));
-    }
-  }
+  // Import symbols are appended by BuildImportLibraries on first use.
 }
 
 std::span<const BinarySection> XexModule::binary_sections() const {
@@ -1196,7 +1449,23 @@ const BinarySection* XexModule::FindSectionByName(std::string_view name) const {
 }
 
 std::span<const BinarySymbol> XexModule::binary_symbols() const {
+  EnsureImportLibraries();
   return binary_symbols_;
 }
 
+const BinarySymbol* XexModule::FindSymbolByName(std::string_view name) const {
+  EnsureImportLibraries();
+  return Module::FindSymbolByName(name);
+}
+
+const BinarySymbol* XexModule::FindSymbolByAddress(uint32_t address) const {
+  EnsureImportLibraries();
+  return Module::FindSymbolByAddress(address);
+}
+
+const BinarySymbol* XexModule::FindSymbolContainingAddress(uint32_t address) const {
+  EnsureImportLibraries();
+  return Module::FindSymbolContainingAddress(address);
+}
+
 }  // namespace rex::runtime
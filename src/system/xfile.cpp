@@ -9,6 +9,11 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+
 #include <rex/filesystem/vfs.h>
 #include <rex/logging.h>
 #include <rex/math.h>
@@ -17,10 +22,68 @@
 #include <rex/system/kernel_state.h>
 #include <rex/system/xevent.h>
 #include <rex/system/xfile.h>
+#include <rex/system/xthread.h>
 #include <rex/thread/mutex.h>
 
 namespace rex::system {
 
+namespace {
+
+// Background workers servicing overlapped NtReadFile/NtWriteFile requests.
+// The guest thread returns X_STATUS_PENDING right away and the transfer
+// overlaps guest execution, which is what streaming titles depend on. Two
+// workers keep one long read from starving a second stream; deeper disk
+// queues than that are rare on our content.
+class IOWorkerPool {
+ public:
+  static IOWorkerPool& Get() {
+    // Deliberately leaked: the workers run until process exit, and tearing
+    // them down during static destruction would race in-flight requests.
+    static IOWorkerPool* instance = new IOWorkerPool();
+    return *instance;
+  }
+
+  void Submit(std::function<void()> request) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      requests_.push_back(std::move(request));
+    }
+    cond_.notify_one();
+  }
+
+ private:
+  static constexpr size_t kWorkerCount = 2;
+
+  IOWorkerPool() {
+    rex::thread::Thread::CreationParameters params;
+    for (size_t i = 0; i < kWorkerCount; ++i) {
+      workers_[i] = rex::thread::Thread::Create(params, [this]() {
+        rex::thread::Thread::GetCurrentThread()->set_name("Kernel IO Worker");
+        WorkerLoop();
+      });
+    }
+  }
+
+  void WorkerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      cond_.wait(lock, [this]() { return !requests_.empty(); });
+      auto request = std::move(requests_.front());
+      requests_.pop_front();
+      lock.unlock();
+      request();
+      lock.lock();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  std::deque<std::function<void()>> requests_;
+  std::unique_ptr<rex::thread::Thread> workers_[kWorkerCount];
+};
+
+}  // namespace
+
 XFile::XFile(KernelState* kernel_state, rex::filesystem::File* file, bool synchronous)
     : XObject(kernel_state, kObjectType), file_(file), is_synchronous_(synchronous) {
   async_event_ = rex::thread::Event::CreateAutoResetEvent(false);
@@ -147,6 +210,8 @@ X_STATUS XFile::Read(uint32_t buffer_guest_address, uint32_t buffer_length, uint
                   buffer_length, true, true);
             }
             position_ += bytes_read;
+            kernel_state()->file_system()->RecordAccess(file_->entry()->absolute_path(),
+                                                        byte_offset, buffer_length);
           }
         }
       }
@@ -254,6 +319,64 @@ X_STATUS XFile::Write(uint32_t buffer_guest_address, uint32_t buffer_length, uin
   return result;
 }
 
+X_STATUS XFile::ReadAsync(uint32_t buffer_guest_address, uint32_t buffer_length,
+                          uint64_t byte_offset, uint32_t apc_context, uint32_t apc_routine,
+                          uint32_t io_status_block_address, object_ref<XEvent> event) {
+  auto self = retain_object(this);
+  auto issuing_thread = retain_object(XThread::GetCurrentThread());
+  IOWorkerPool::Get().Submit([self, issuing_thread, buffer_guest_address, buffer_length,
+                              byte_offset, apc_context, apc_routine, io_status_block_address,
+                              event]() {
+    uint32_t bytes_read = 0;
+    // Read() notifies completion ports and signals the file's async event.
+    X_STATUS status =
+        self->Read(buffer_guest_address, buffer_length, byte_offset, &bytes_read, apc_context);
+    if (io_status_block_address) {
+      auto* iosb = self->memory()->TranslateVirtual<X_IO_STATUS_BLOCK*>(io_status_block_address);
+      iosb->status = status;
+      iosb->information = bytes_read;
+    }
+    // Low bit means do not queue to IO ports; see NtReadFile.
+    if (apc_routine & ~1u) {
+      if (apc_context) {
+        issuing_thread->EnqueueApc(apc_routine & ~1u, apc_context, io_status_block_address, 0);
+      }
+    }
+    if (event) {
+      event->Set(0, false);
+    }
+  });
+  return X_STATUS_PENDING;
+}
+
+X_STATUS XFile::WriteAsync(uint32_t buffer_guest_address, uint32_t buffer_length,
+                           uint64_t byte_offset, uint32_t apc_context, uint32_t apc_routine,
+                           uint32_t io_status_block_address, object_ref<XEvent> event) {
+  auto self = retain_object(this);
+  auto issuing_thread = retain_object(XThread::GetCurrentThread());
+  IOWorkerPool::Get().Submit([self, issuing_thread, buffer_guest_address, buffer_length,
+                              byte_offset, apc_context, apc_routine, io_status_block_address,
+                              event]() {
+    uint32_t bytes_written = 0;
+    X_STATUS status =
+        self->Write(buffer_guest_address, buffer_length, byte_offset, &bytes_written, apc_context);
+    if (io_status_block_address) {
+      auto* iosb = self->memory()->TranslateVirtual<X_IO_STATUS_BLOCK*>(io_status_block_address);
+      iosb->status = status;
+      iosb->information = bytes_written;
+    }
+    if (apc_routine & ~1u) {
+      if (apc_context) {
+        issuing_thread->EnqueueApc(apc_routine & ~1u, apc_context, io_status_block_address, 0);
+      }
+    }
+    if (event) {
+      event->Set(0, false);
+    }
+  });
+  return X_STATUS_PENDING;
+}
+
 X_STATUS XFile::SetLength(size_t length) {
   return file_->SetLength(length);
 }
@@ -14,6 +14,9 @@
 namespace rex::system {
 
 XIOCompletion::XIOCompletion(KernelState* kernel_state) : XObject(kernel_state, kObjectType) {
+  for (uint32_t i = 0; i < kMaxNotifications; ++i) {
+    notification_slots_[i].sequence.store(i, std::memory_order_relaxed);
+  }
   notification_semaphore_ = rex::thread::Semaphore::Create(0, kMaxNotifications);
   assert_not_null(notification_semaphore_);
 }
@@ -21,26 +24,59 @@ XIOCompletion::XIOCompletion(KernelState* kernel_state) : XObject(kernel_state,
 XIOCompletion::~XIOCompletion() = default;
 
 void XIOCompletion::QueueNotification(IONotification& notification) {
-  std::unique_lock<std::mutex> lock(notification_lock_);
-
-  notifications_.push(notification);
+  uint32_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+  for (;;) {
+    NotificationSlot& slot = notification_slots_[pos & (kMaxNotifications - 1)];
+    uint32_t seq = slot.sequence.load(std::memory_order_acquire);
+    int32_t diff = int32_t(seq - pos);
+    if (diff == 0) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+        slot.notification = notification;
+        // Publishes the payload; a consumer claiming this position spins
+        // until it sees the bumped sequence.
+        slot.sequence.store(pos + 1, std::memory_order_release);
+        break;
+      }
+    } else {
+      if (diff < 0) {
+        // Full - the semaphore bound means a consumer is mid-dequeue; wait
+        // for it to recycle the slot.
+        rex::thread::MaybeYield();
+      }
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
   notification_semaphore_->Release(1, nullptr);
 }
 
 bool XIOCompletion::WaitForNotification(uint64_t wait_ticks, IONotification* notify) {
   auto ms = std::chrono::milliseconds(TimeoutTicksToMs(wait_ticks));
   auto res = rex::thread::Wait(notification_semaphore_.get(), false, ms);
-  if (res == rex::thread::WaitResult::kSuccess) {
-    std::unique_lock<std::mutex> lock(notification_lock_);
-    assert_false(notifications_.empty());
-
-    std::memcpy(notify, &notifications_.front(), sizeof(IONotification));
-    notifications_.pop();
-
-    return true;
+  if (res != rex::thread::WaitResult::kSuccess) {
+    return false;
   }
 
-  return false;
+  // The semaphore granted exactly one dequeue, so the only stall possible
+  // here is a producer that claimed the head slot but hasn't published yet.
+  uint32_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+  for (;;) {
+    NotificationSlot& slot = notification_slots_[pos & (kMaxNotifications - 1)];
+    uint32_t seq = slot.sequence.load(std::memory_order_acquire);
+    int32_t diff = int32_t(seq - (pos + 1));
+    if (diff == 0) {
+      if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+        *notify = slot.notification;
+        // Recycles the slot for the producer one lap ahead.
+        slot.sequence.store(pos + kMaxNotifications, std::memory_order_release);
+        return true;
+      }
+    } else {
+      if (diff < 0) {
+        rex::thread::MaybeYield();
+      }
+      pos = dequeue_pos_.load(std::memory_order_relaxed);
+    }
+  }
 }
 
 }  // namespace rex::system
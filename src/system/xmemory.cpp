@@ -18,6 +18,7 @@
 #include <rex/assert.h>
 #include <rex/chrono/clock.h>
 #include <rex/cvar.h>
+#include <rex/hash.h>
 #include <rex/logging.h>
 #include <rex/math.h>
 #include <rex/stream.h>
@@ -36,6 +37,19 @@ REXCVAR_DEFINE_BOOL(protect_on_release, false, "Memory",
 
 REXCVAR_DEFINE_BOOL(scribble_heap, false, "Memory", "Scribble 0xCD into all allocated heap memory");
 
+REXCVAR_DECLARE(int32_t, numa_node);
+
+REXCVAR_DEFINE_BOOL(memory_huge_pages, false, "Memory",
+                    "Back bulk guest memory views with 2 MB huge pages where the OS supports "
+                    "it, cutting dTLB pressure. Views that take page-granular protection "
+                    "changes keep 4 KB pages");
+
+REXCVAR_DEFINE_INT32(heap_large_alloc_top_down_size, 0x100000, "Memory",
+                     "Size in bytes from which non-fixed guest heap allocations are placed "
+                     "top-down, keeping them from interleaving with the small bottom-up "
+                     "allocations and fragmenting the heap over time (0 to disable)")
+    .range(0, 0x40000000);
+
 namespace rex::memory {
 
 uint32_t get_page_count(uint32_t value, uint32_t page_size) {
@@ -217,60 +231,74 @@ static const struct {
   uint64_t virtual_address_start;
   uint64_t virtual_address_end;
   uint64_t target_address;
+  // Whether this view may be backed with huge pages (memory_huge_pages).
+  // Views whose heaps take frequent 4 KB-granular protection changes (write
+  // watches, the GPU writeback window) are kept on base pages so the kernel
+  // isn't constantly splitting and re-collapsing huge mappings under them.
+  bool huge_pages;
 } map_info[] = {
     // (1024mb) - virtual 4k pages
     {
         0x00000000,
         0x3FFFFFFF,
         0x0000000000000000ull,
+        true,
     },
     // (1024mb) - virtual 64k pages (cont)
     {
         0x40000000,
         0x7EFFFFFF,
         0x0000000040000000ull,
+        true,
     },
     //   (16mb) - GPU writeback + 15mb of XPS?
     {
         0x7F000000,
         0x7FFFFFFF,
         0x0000000100000000ull,
+        false,
     },
     //  (256mb) - xex 64k pages
     {
         0x80000000,
         0x8FFFFFFF,
         0x0000000080000000ull,
+        true,
     },
     //  (256mb) - xex 4k pages
     {
         0x90000000,
         0x9FFFFFFF,
         0x0000000080000000ull,
+        true,
     },
     //  (512mb) - physical 64k pages
     {
         0xA0000000,
         0xBFFFFFFF,
         0x0000000100000000ull,
+        true,
     },
     //          - physical 16mb pages
     {
         0xC0000000,
         0xDFFFFFFF,
         0x0000000100000000ull,
+        true,
     },
-    //          - physical 4k pages
+    //          - physical 4k pages (write-watch granularity)
     {
         0xE0000000,
         0xFFFFFFFF,
         0x0000000100001000ull,
+        false,
     },
     //          - physical raw
     {
         0x100000000,
         0x11FFFFFFF,
         0x0000000100000000ull,
+        true,
     },
 };
 int Memory::MapViews(uint8_t* mapping_base) {
@@ -288,6 +316,26 @@ int Memory::MapViews(uint8_t* mapping_base) {
       UnmapViews();
       return 1;
     }
+    if (REXCVAR_GET(memory_huge_pages) && map_info[n].huge_pages) {
+      size_t view_length =
+          map_info[n].virtual_address_end - map_info[n].virtual_address_start + 1;
+      if (!rex::memory::AdviseHugePages(views_.all_views[n], view_length)) {
+        REXSYS_DEBUG("Huge pages unavailable for view {:08X}-{:08X}, keeping base pages",
+                     map_info[n].virtual_address_start, map_info[n].virtual_address_end);
+      }
+    }
+    if (REXCVAR_GET(numa_node) >= 0) {
+      // Every view aliasing the shm backing gets the policy, so whichever
+      // view a page first faults through allocates it on the chosen node.
+      size_t view_length =
+          map_info[n].virtual_address_end - map_info[n].virtual_address_start + 1;
+      if (!rex::memory::BindToNumaNode(views_.all_views[n], view_length,
+                                       uint32_t(REXCVAR_GET(numa_node)))) {
+        REXSYS_WARN("Could not bind guest memory view {:08X}-{:08X} to NUMA node {}",
+                    map_info[n].virtual_address_start, map_info[n].virtual_address_end,
+                    REXCVAR_GET(numa_node));
+      }
+    }
   }
   return 0;
 }
@@ -584,6 +632,28 @@ bool Memory::Restore(stream::ByteStream* stream) {
   return true;
 }
 
+bool Memory::SaveDelta(stream::ByteStream* stream) {
+  REXSYS_DEBUG("Serializing memory delta...");
+  heaps_.v00000000.SaveDelta(stream);
+  heaps_.v40000000.SaveDelta(stream);
+  heaps_.v80000000.SaveDelta(stream);
+  heaps_.v90000000.SaveDelta(stream);
+  heaps_.physical.SaveDelta(stream);
+
+  return true;
+}
+
+bool Memory::RestoreDelta(stream::ByteStream* stream) {
+  REXSYS_DEBUG("Restoring memory delta...");
+  heaps_.v00000000.RestoreDelta(stream);
+  heaps_.v40000000.RestoreDelta(stream);
+  heaps_.v80000000.RestoreDelta(stream);
+  heaps_.v90000000.RestoreDelta(stream);
+  heaps_.physical.RestoreDelta(stream);
+
+  return true;
+}
+
 //=============================================================================
 // Recompiled Code Function Table
 //=============================================================================
@@ -650,6 +720,30 @@ void Memory::SetFunction(uint32_t guest_address, PPCFunc* host_function) {
   *slot = host_function;
 }
 
+size_t Memory::SetFunctions(const PPCFuncMapping* mappings) {
+  if (function_table_base_ == 0) {
+    REXSYS_ERROR("SetFunctions called before InitializeFunctionTable");
+    return 0;
+  }
+
+  // Translate the table base once; per-entry work is then a subtract, a
+  // compare, and a store. With tens of thousands of entries this is what
+  // keeps startup registration out of the boot profile.
+  auto* table = TranslateVirtual<PPCFunc**>(function_table_base_);
+  size_t count = 0;
+  for (size_t i = 0; mappings[i].guest != 0; ++i) {
+    // Addresses outside the code section are expected (IAT imports); those
+    // are called directly via __imp__ symbols, not through the table.
+    uint32_t offset = uint32_t(mappings[i].guest) - function_code_base_;
+    if (offset >= function_code_size_ || mappings[i].host == nullptr) {
+      continue;
+    }
+    table[offset / 4] = mappings[i].host;
+    ++count;
+  }
+  return count;
+}
+
 PPCFunc* Memory::GetFunction(uint32_t guest_address) const {
   if (function_table_base_ == 0) {
     return nullptr;
@@ -809,9 +903,34 @@ uint32_t BaseHeap::GetUnreservedPageCount() {
   return count;
 }
 
+BaseHeap::FragmentationStats BaseHeap::GetFragmentationStats() {
+  auto global_lock = global_critical_region_.Acquire();
+  FragmentationStats stats;
+  uint32_t run_length = 0;
+  uint32_t size = uint32_t(page_table_.size());
+  for (uint32_t i = 0; i < size; ++i) {
+    auto& page = page_table_[i];
+    if (!page.state) {
+      if (!run_length) {
+        ++stats.free_runs;
+      }
+      ++run_length;
+      continue;
+    }
+    stats.free_pages += run_length;
+    stats.largest_free_run = std::max(stats.largest_free_run, run_length);
+    run_length = 0;
+    i += page.region_page_count - 1;
+  }
+  stats.free_pages += run_length;
+  stats.largest_free_run = std::max(stats.largest_free_run, run_length);
+  return stats;
+}
+
 bool BaseHeap::Save(stream::ByteStream* stream) {
   REXSYS_DEBUG("Heap {:08X}-{:08X}", heap_base_, heap_base_ + (heap_size_ - 1));
 
+  saved_page_hashes_.assign(page_table_.size(), 0);
   for (size_t i = 0; i < page_table_.size(); i++) {
     auto& page = page_table_[i];
     stream->Write(page.qword);
@@ -828,6 +947,7 @@ bool BaseHeap::Save(stream::ByteStream* stream) {
       memory::Protect(addr, page_size_, memory::PageAccess::kReadWrite, &old_access);
 
       stream->Write(addr, page_size_);
+      saved_page_hashes_[i] = XXH3_64bits(addr, page_size_);
 
       memory::Protect(addr, page_size_, old_access, nullptr);
     }
@@ -836,6 +956,81 @@ bool BaseHeap::Save(stream::ByteStream* stream) {
   return true;
 }
 
+bool BaseHeap::SaveDelta(stream::ByteStream* stream) {
+  REXSYS_DEBUG("Heap delta {:08X}-{:08X}", heap_base_, heap_base_ + (heap_size_ - 1));
+
+  // Without a baseline every committed page is considered changed.
+  if (saved_page_hashes_.size() != page_table_.size()) {
+    saved_page_hashes_.assign(page_table_.size(), 0);
+  }
+  for (size_t i = 0; i < page_table_.size(); i++) {
+    auto& page = page_table_[i];
+    stream->Write(page.qword);
+    if (!page.state) {
+      // Unallocated.
+      continue;
+    }
+
+    if (page.state & memory::kMemoryAllocationCommit) {
+      void* addr = TranslateRelative(i * page_size_);
+
+      memory::PageAccess old_access;
+      memory::Protect(addr, page_size_, memory::PageAccess::kReadWrite, &old_access);
+
+      uint64_t hash = XXH3_64bits(addr, page_size_);
+      uint8_t changed = hash != saved_page_hashes_[i] ? 1 : 0;
+      stream->Write(changed);
+      if (changed) {
+        stream->Write(addr, page_size_);
+        saved_page_hashes_[i] = hash;
+      }
+
+      memory::Protect(addr, page_size_, old_access, nullptr);
+    }
+  }
+
+  return true;
+}
+
+bool BaseHeap::RestoreDelta(stream::ByteStream* stream) {
+  REXSYS_DEBUG("Heap delta {:08X}-{:08X}", heap_base_, heap_base_ + (heap_size_ - 1));
+
+  for (size_t i = 0; i < page_table_.size(); i++) {
+    auto& page = page_table_[i];
+    page.qword = stream->Read<uint64_t>();
+    if (!page.state) {
+      // Unallocated.
+      continue;
+    }
+
+    if (page.state & memory::kMemoryAllocationCommit) {
+      // Commit the memory if it isn't already - the page may have been
+      // allocated after the baseline snapshot.
+      rex::memory::AllocFixed(TranslateRelative(i * page_size_), page_size_,
+                              memory::AllocationType::kCommit, memory::PageAccess::kReadWrite);
+
+      uint8_t changed = stream->Read<uint8_t>();
+      void* addr = TranslateRelative(i * page_size_);
+      rex::memory::Protect(addr, page_size_, memory::PageAccess::kReadWrite, nullptr);
+      if (changed) {
+        stream->Read(addr, page_size_);
+      }
+
+      memory::PageAccess page_access = memory::PageAccess::kNoAccess;
+      if ((page.current_protect & memory::kMemoryProtectRead) &&
+          (page.current_protect & memory::kMemoryProtectWrite)) {
+        page_access = memory::PageAccess::kReadWrite;
+      } else if (page.current_protect & memory::kMemoryProtectRead) {
+        page_access = memory::PageAccess::kReadOnly;
+      }
+      rex::memory::Protect(addr, page_size_, page_access, nullptr);
+    }
+  }
+
+  BumpAllocationGeneration();
+  return true;
+}
+
 bool BaseHeap::Restore(stream::ByteStream* stream) {
   REXSYS_DEBUG("Heap {:08X}-{:08X}", heap_base_, heap_base_ + (heap_size_ - 1));
 
@@ -875,12 +1070,14 @@ bool BaseHeap::Restore(stream::ByteStream* stream) {
     }
   }
 
+  BumpAllocationGeneration();
   return true;
 }
 
 void BaseHeap::Reset() {
   // TODO(DrChat): protect pages.
   std::memset(page_table_.data(), 0, sizeof(PageEntry) * page_table_.size());
+  BumpAllocationGeneration();
   // TODO(Triang3l): Remove access callbacks from pages if this is a physical
   // memory heap.
 }
@@ -890,6 +1087,13 @@ bool BaseHeap::Alloc(uint32_t size, uint32_t alignment, uint32_t allocation_type
   *out_address = 0;
   size = rex::round_up(size, page_size_);
   alignment = rex::round_up(alignment, page_size_);
+  // Segregate large allocations at the top of the heap. Long-lived small
+  // regions freed and reallocated bottom-up then can't carve holes out of the
+  // contiguous space large allocations will need later.
+  uint32_t top_down_size = uint32_t(std::max(REXCVAR_GET(heap_large_alloc_top_down_size), 0));
+  if (top_down_size && size >= top_down_size) {
+    top_down = true;
+  }
   uint32_t low_address = heap_base_;
   uint32_t high_address = heap_base_ + (heap_size_ - 1);
   return AllocRange(low_address, high_address, size, alignment, allocation_type, protect, top_down,
@@ -967,6 +1171,7 @@ bool BaseHeap::AllocFixed(uint32_t base_address, uint32_t size, uint32_t alignme
     page_entry.state = memory::kMemoryAllocationReserve | allocation_type;
   }
 
+  BumpAllocationGeneration();
   return true;
 }
 
@@ -1069,8 +1274,13 @@ bool BaseHeap::AllocRange(uint32_t low_address, uint32_t high_address, uint32_t
     }
   }
   if (start_page_number == UINT_MAX || end_page_number == UINT_MAX) {
-    // Out of memory.
-    REXSYS_ERROR("BaseHeap::Alloc failed to find contiguous range");
+    // Out of memory - report how fragmented the heap is, as this commonly
+    // fails with plenty of free pages but no contiguous run left.
+    FragmentationStats stats = GetFragmentationStats();
+    REXSYS_ERROR(
+        "BaseHeap::Alloc failed to find contiguous range ({} pages requested, "
+        "{} free in {} runs, largest run {} pages)",
+        page_count, stats.free_pages, stats.free_runs, stats.largest_free_run);
     assert_always("Heap exhausted!");
     return false;
   }
@@ -1106,6 +1316,7 @@ bool BaseHeap::AllocRange(uint32_t low_address, uint32_t high_address, uint32_t
   }
 
   *out_address = heap_base_ + (start_page_number * page_size_);
+  BumpAllocationGeneration();
   return true;
 }
 
@@ -1135,6 +1346,7 @@ bool BaseHeap::Decommit(uint32_t address, uint32_t size) {
     page_entry.state &= ~memory::kMemoryAllocationCommit;
   }
 
+  BumpAllocationGeneration();
   return true;
 }
 
@@ -1189,6 +1401,7 @@ bool BaseHeap::Release(uint32_t base_address, uint32_t* out_region_size) {
     page_entry.qword = 0;
   }
 
+  BumpAllocationGeneration();
   return true;
 }
 
@@ -1270,6 +1483,7 @@ bool BaseHeap::Protect(uint32_t address, uint32_t size, uint32_t protect, uint32
     page_entry.current_protect = protect;
   }
 
+  BumpAllocationGeneration();
   return true;
 }
 
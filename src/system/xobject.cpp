@@ -9,6 +9,7 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <mutex>
 #include <vector>
 
 #include <rex/chrono/clock.h>
@@ -29,6 +30,15 @@
 
 namespace rex::system {
 
+namespace {
+// Guards first-use initialization of guest-backed objects: CreateNative,
+// SetNativePointer, and the header stash/lookup in GetNativeObject. This is
+// the only cross-object race on the init path, so it gets its own narrow
+// lock instead of the global critical region. Recursive because CreateNative
+// calls SetNativePointer while holding it.
+std::recursive_mutex guest_object_mutex_;
+}  // namespace
+
 XObject::XObject(Type type) : kernel_state_(nullptr), pointer_ref_count_(1), type_(type) {
   handles_.reserve(10);
 }
@@ -315,7 +325,7 @@ X_STATUS XObject::WaitMultiple(uint32_t count, XObject** objects, uint32_t wait_
 }
 
 uint8_t* XObject::CreateNative(uint32_t size) {
-  auto global_lock = rex::thread::global_critical_region::AcquireDirect();
+  std::lock_guard<std::recursive_mutex> lock(guest_object_mutex_);
 
   uint32_t total_size = size + sizeof(X_OBJECT_HEADER);
 
@@ -343,7 +353,7 @@ uint8_t* XObject::CreateNative(uint32_t size) {
 }
 
 void XObject::SetNativePointer(uint32_t native_ptr, bool uninitialized) {
-  auto global_lock = rex::thread::global_critical_region::AcquireDirect();
+  std::lock_guard<std::recursive_mutex> lock(guest_object_mutex_);
 
   // If hit: We've already setup the native ptr with CreateNative!
   assert_zero(guest_object_ptr_);
@@ -375,16 +385,30 @@ object_ref<XObject> XObject::GetNativeObject(KernelState* kernel_state, void* na
   // We identify this by setting wait_list_flink to a magic value. When set,
   // wait_list_blink will hold a handle to our object.
 
-  auto global_lock = rex::thread::global_critical_region::AcquireDirect();
-
   auto header = reinterpret_cast<X_DISPATCH_HEADER*>(native_ptr);
 
+  // Fast path: the stashed handle in the header is itself the guest-address
+  // index for the object, so once a header is initialized no lock is needed
+  // to resolve it - StashHandle publishes the handle before the signature,
+  // and the object table synchronizes its own lookups. A dead handle (object
+  // torn down while we raced) falls through to the locked path below.
+  if (header->wait_list_flink == kXObjSignature) {
+    uint32_t handle = header->wait_list_blink;
+    auto object = kernel_state->object_table()->LookupObject<XObject>(handle);
+    if (object) {
+      return object;
+    }
+  }
+
+  std::lock_guard<std::recursive_mutex> lock(guest_object_mutex_);
+
   if (as_type == -1) {
     as_type = header->type;
   }
 
   if (header->wait_list_flink == kXObjSignature) {
-    // Already initialized.
+    // Already initialized (possibly by a racing first-use on another thread
+    // between our unlocked check and taking the lock).
     // TODO: assert if the type of the object != as_type
     uint32_t handle = header->wait_list_blink;
     auto object = kernel_state->object_table()->LookupObject<XObject>(handle);
@@ -9,12 +9,19 @@
  * @modified    Tom Clay, 2026 - Adapted for ReXGlue runtime
  */
 
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
 #include <cstring>
+#include <vector>
 
+#include <rex/cvar.h>
 #include <rex/kernel/xam/module.h>
+#include <rex/logging.h>
 #include <rex/platform.h>
 #include <rex/system/kernel_state.h>
 #include <rex/system/xsocket.h>
+#include <rex/thread/timer_queue.h>
 // #include <rex/system/xnet.h>
 
 #include <rex/net/socket.h>
@@ -29,6 +36,7 @@
 #include <netinet/in.h>
 #include <netinet/ip.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #endif
 
 // Undefine system socket macros that collide with XSocket enum names
@@ -45,8 +53,29 @@
 #undef SOCK_DGRAM
 #endif
 
+REXCVAR_DEFINE_BOOL(net_batch_datagram_sends, true, "Kernel",
+                    "Defer small datagram sends into a per-socket batch that is flushed as one "
+                    "sendmmsg call. Netplay-heavy titles issue hundreds of small UDP/VDP packets "
+                    "per second and otherwise pay a host syscall for each. Titles opt a socket "
+                    "out with TCP_NODELAY.");
+REXCVAR_DEFINE_INT32(net_send_batch_size, 16, "Kernel",
+                     "Datagrams to accumulate before a deferred send batch is flushed.");
+REXCVAR_DEFINE_INT32(net_send_batch_flush_ms, 2, "Kernel",
+                     "Upper bound in milliseconds on how long a deferred datagram may sit in the "
+                     "send batch before it is flushed, counted from the first datagram queued "
+                     "into an empty batch.");
+
 namespace rex::system {
 
+namespace {
+// Largest datagram worth copying into the send batch; anything bigger goes
+// straight to the OS (after a flush, to preserve ordering).
+constexpr uint32_t kMaxBatchedDatagramSize = 1472;
+// Hard cap on batched datagrams per flush; bounds the stack arrays below and
+// clamps the net_send_batch_size cvar.
+constexpr uint32_t kMaxSendBatch = 64;
+}  // namespace
+
 XSocket::XSocket(KernelState* kernel_state) : XObject(kernel_state, kObjectType) {}
 
 XSocket::XSocket(KernelState* kernel_state, uint64_t native_handle)
@@ -75,6 +104,7 @@ X_STATUS XSocket::Initialize(AddressFamily af, Type type, Protocol proto) {
 }
 
 X_STATUS XSocket::Close() {
+  FlushSendBatch();
   int ret = rex::net::socket_close(native_handle_);
   if (ret != 0) {
     return X_STATUS_UNSUCCESSFUL;
@@ -90,6 +120,18 @@ X_STATUS XSocket::SetOption(uint32_t level, uint32_t optname, void* optval_ptr,
     return X_STATUS_SUCCESS;
   }
 
+  // TCP_NODELAY doubles as the per-socket opt-out from datagram send
+  // batching - the closest thing the sockets API has to "disable Nagle".
+  if (level == 6 /* IPPROTO_TCP */ && optname == 0x0001 /* TCP_NODELAY */) {
+    send_batching_opt_out_ = true;
+    FlushSendBatch();
+    if (type_ != Type::SOCK_STREAM) {
+      // Meaningless to the host for datagram sockets; the opt-out is all the
+      // title is asking for.
+      return X_STATUS_SUCCESS;
+    }
+  }
+
   int ret = setsockopt(native_handle_, level, optname, (char*)optval_ptr, optlen);
   if (ret < 0) {
     // TODO: WSAGetLastError()
@@ -168,15 +210,21 @@ object_ref<XSocket> XSocket::Accept(N_XSOCKADDR* name, int* name_len) {
 }
 
 int XSocket::Shutdown(int how) {
+  FlushSendBatch();
   return shutdown(native_handle_, how);
 }
 
 int XSocket::Recv(uint8_t* buf, uint32_t buf_len, uint32_t flags) {
+  // A title waiting on a reply must have its queued requests on the wire.
+  FlushSendBatch();
   return recv(native_handle_, reinterpret_cast<char*>(buf), buf_len, flags);
 }
 
 int XSocket::RecvFrom(uint8_t* buf, uint32_t buf_len, uint32_t flags, N_XSOCKADDR_IN* from,
                       uint32_t* from_len) {
+  // A title waiting on a reply must have its queued requests on the wire.
+  FlushSendBatch();
+
   // Pop from secure packets first
   // TODO(DrChat): Enable when I commit XNet
   /*
@@ -219,6 +267,10 @@ int XSocket::RecvFrom(uint8_t* buf, uint32_t buf_len, uint32_t flags, N_XSOCKADD
 }
 
 int XSocket::Send(const uint8_t* buf, uint32_t buf_len, uint32_t flags) {
+  if (TryBatchSend(buf, buf_len, flags, nullptr, 0)) {
+    return int(buf_len);
+  }
+  FlushSendBatch();
   return send(native_handle_, reinterpret_cast<const char*>(buf), buf_len, flags);
 }
 
@@ -235,6 +287,10 @@ int XSocket::SendTo(uint8_t* buf, uint32_t buf_len, uint32_t flags, N_XSOCKADDR_
   }
   */
 
+  if (TryBatchSend(buf, buf_len, flags, to, to_len)) {
+    return int(buf_len);
+  }
+
   sockaddr_in nto;
   if (to) {
     nto.sin_addr.s_addr = to->sin_addr;
@@ -242,10 +298,206 @@ int XSocket::SendTo(uint8_t* buf, uint32_t buf_len, uint32_t flags, N_XSOCKADDR_
     nto.sin_port = to->sin_port;
   }
 
+  // Not batchable - push out anything pending first so ordering holds.
+  FlushSendBatch();
   return sendto(native_handle_, reinterpret_cast<char*>(buf), buf_len, flags,
                 to ? (sockaddr*)&nto : nullptr, to_len);
 }
 
+int XSocket::Send(const Buffer* buffers, uint32_t buffer_count, uint32_t flags) {
+  return SendTo(buffers, buffer_count, flags, nullptr, 0);
+}
+
+int XSocket::SendTo(const Buffer* buffers, uint32_t buffer_count, uint32_t flags,
+                    N_XSOCKADDR_IN* to, uint32_t to_len) {
+  // VDP sends arrive here as a [game data][voice data] pair; a small datagram
+  // is a small datagram either way, so coalesce the runs into the batch.
+  size_t total = 0;
+  for (uint32_t i = 0; i < buffer_count; i++) {
+    total += buffers[i].len;
+  }
+  if (total <= kMaxBatchedDatagramSize && ShouldBatchSends() && !flags) {
+    uint8_t joined[kMaxBatchedDatagramSize];
+    size_t offset = 0;
+    for (uint32_t i = 0; i < buffer_count; i++) {
+      std::memcpy(joined + offset, buffers[i].data, buffers[i].len);
+      offset += buffers[i].len;
+    }
+    if (TryBatchSend(joined, uint32_t(total), flags, to, to_len)) {
+      return int(total);
+    }
+  }
+  FlushSendBatch();
+
+  sockaddr_in nto;
+  if (to) {
+    nto.sin_addr.s_addr = to->sin_addr;
+    nto.sin_family = to->sin_family;
+    nto.sin_port = to->sin_port;
+  }
+
+#if REX_PLATFORM_WIN32
+  // Titles pass at most a few buffers (VDP uses two); keep the common case
+  // off the heap.
+  WSABUF stack_bufs[8];
+  std::vector<WSABUF> heap_bufs;
+  WSABUF* wsa_bufs = stack_bufs;
+  if (buffer_count > rex::countof(stack_bufs)) {
+    heap_bufs.resize(buffer_count);
+    wsa_bufs = heap_bufs.data();
+  }
+  for (uint32_t i = 0; i < buffer_count; i++) {
+    wsa_bufs[i].len = buffers[i].len;
+    wsa_bufs[i].buf = const_cast<CHAR*>(reinterpret_cast<const CHAR*>(buffers[i].data));
+  }
+
+  DWORD bytes_sent = 0;
+  int ret = WSASendTo(static_cast<SOCKET>(native_handle_), wsa_bufs, buffer_count, &bytes_sent,
+                      flags, to ? (sockaddr*)&nto : nullptr, to_len, nullptr, nullptr);
+  return ret == 0 ? static_cast<int>(bytes_sent) : -1;
+#else
+  iovec stack_iov[8];
+  std::vector<iovec> heap_iov;
+  iovec* iov = stack_iov;
+  if (buffer_count > rex::countof(stack_iov)) {
+    heap_iov.resize(buffer_count);
+    iov = heap_iov.data();
+  }
+  for (uint32_t i = 0; i < buffer_count; i++) {
+    iov[i].iov_base = const_cast<uint8_t*>(buffers[i].data);
+    iov[i].iov_len = buffers[i].len;
+  }
+
+  msghdr msg = {};
+  msg.msg_name = to ? &nto : nullptr;
+  msg.msg_namelen = to ? to_len : 0;
+  msg.msg_iov = iov;
+  msg.msg_iovlen = buffer_count;
+  return static_cast<int>(sendmsg(static_cast<int>(native_handle_), &msg, flags));
+#endif
+}
+
+bool XSocket::ShouldBatchSends() const {
+  return REXCVAR_GET(net_batch_datagram_sends) && type_ == Type::SOCK_DGRAM &&
+         !send_batching_opt_out_;
+}
+
+bool XSocket::TryBatchSend(const uint8_t* buf, uint32_t buf_len, uint32_t flags,
+                           N_XSOCKADDR_IN* to, uint32_t to_len) {
+  // Flags would have to be carried through sendmmsg per batch, and no title
+  // we care about sends datagrams with any set - send those immediately.
+  if (flags || buf_len > kMaxBatchedDatagramSize || !ShouldBatchSends()) {
+    return false;
+  }
+
+  bool flush = false;
+  bool arm_timer = false;
+  {
+    std::lock_guard<std::mutex> lock(send_batch_mutex_);
+    PendingDatagram& pending = send_batch_.emplace_back();
+    if (to) {
+      pending.to = *to;
+      pending.to_len = to_len;
+    } else {
+      pending.to_len = 0;
+    }
+    pending.flags = flags;
+    pending.data.assign(buf, buf + buf_len);
+
+    uint32_t limit = uint32_t(
+        std::clamp(REXCVAR_GET(net_send_batch_size), int32_t(1), int32_t(kMaxSendBatch)));
+    flush = send_batch_.size() >= limit;
+    if (!flush && !send_batch_timer_armed_) {
+      send_batch_timer_armed_ = true;
+      arm_timer = true;
+    }
+  }
+  if (flush) {
+    FlushSendBatch();
+  } else if (arm_timer) {
+    // Bound how long a deferred datagram can sit in the batch: a socket that
+    // sends slowly and never receives would otherwise defer forever. The
+    // retained reference keeps the socket alive until the callback has run,
+    // so no disarm-on-close handshake is needed; a late flush on a closed
+    // socket sees an empty batch and returns.
+    Retain();
+    auto due = rex::thread::TimerQueueWaitItem::clock::now() +
+               std::chrono::milliseconds(
+                   std::max(REXCVAR_GET(net_send_batch_flush_ms), int32_t(1)));
+    rex::thread::QueueTimerOnce(
+        [](void* userdata) {
+          auto socket = reinterpret_cast<XSocket*>(userdata);
+          {
+            std::lock_guard<std::mutex> lock(socket->send_batch_mutex_);
+            socket->send_batch_timer_armed_ = false;
+          }
+          socket->FlushSendBatch();
+          socket->Release();
+        },
+        this, due);
+  }
+  return true;
+}
+
+void XSocket::FlushSendBatch() {
+  std::vector<PendingDatagram> batch;
+  {
+    std::lock_guard<std::mutex> lock(send_batch_mutex_);
+    if (send_batch_.empty()) {
+      return;
+    }
+    batch.swap(send_batch_);
+  }
+
+#if REX_PLATFORM_WIN32
+  // Windows has no multi-datagram send syscall; flush one sendto per packet.
+  // The batching still coalesces guest-side bookkeeping and keeps the Linux
+  // sendmmsg path symmetric.
+  for (PendingDatagram& pending : batch) {
+    sockaddr_in nto;
+    if (pending.to_len) {
+      nto.sin_addr.s_addr = pending.to.sin_addr;
+      nto.sin_family = pending.to.sin_family;
+      nto.sin_port = pending.to.sin_port;
+    }
+    sendto(static_cast<SOCKET>(native_handle_),
+           reinterpret_cast<const char*>(pending.data.data()), int(pending.data.size()),
+           pending.flags, pending.to_len ? (sockaddr*)&nto : nullptr, pending.to_len);
+  }
+#else
+  mmsghdr msgs[kMaxSendBatch];
+  iovec iovs[kMaxSendBatch];
+  sockaddr_in addrs[kMaxSendBatch];
+  size_t done = 0;
+  while (done < batch.size()) {
+    uint32_t count = uint32_t(std::min(batch.size() - done, size_t(kMaxSendBatch)));
+    for (uint32_t i = 0; i < count; i++) {
+      PendingDatagram& pending = batch[done + i];
+      iovs[i].iov_base = pending.data.data();
+      iovs[i].iov_len = pending.data.size();
+      msgs[i] = {};
+      if (pending.to_len) {
+        addrs[i].sin_addr.s_addr = pending.to.sin_addr;
+        addrs[i].sin_family = pending.to.sin_family;
+        addrs[i].sin_port = pending.to.sin_port;
+        msgs[i].msg_hdr.msg_name = &addrs[i];
+        msgs[i].msg_hdr.msg_namelen = pending.to_len;
+      }
+      msgs[i].msg_hdr.msg_iov = &iovs[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    int ret = sendmmsg(static_cast<int>(native_handle_), msgs, count, 0);
+    if (ret <= 0) {
+      // Errors on a deferred datagram can't reach the sendto that queued it;
+      // logging is the best that can be done (same as a dropped UDP packet).
+      REXSYS_WARN("XSocket: sendmmsg flush of {} datagrams failed ({})", count, errno);
+      break;
+    }
+    done += size_t(ret);
+  }
+#endif
+}
+
 bool XSocket::QueuePacket(uint32_t src_ip, uint16_t src_port, const uint8_t* buf, size_t len) {
   packet* pkt = reinterpret_cast<packet*>(new uint8_t[sizeof(packet) + len]);
   pkt->src_ip = src_ip;
@@ -10,6 +10,8 @@
  */
 
 #include <cstring>
+#include <mutex>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -38,6 +40,13 @@ REXCVAR_DEFINE_BOOL(ignore_thread_priorities, true, "Kernel",
 REXCVAR_DEFINE_BOOL(ignore_thread_affinities, true, "Kernel",
                     "Ignores game-specified thread affinities");
 
+REXCVAR_DEFINE_INT32(low_priority_thread_cores, 0, "Kernel",
+                     "Number of host cores, taken from the top of the core range, that "
+                     "below-normal guest threads are confined to - keeps mostly-idle worker "
+                     "threads from stealing timeslices from the hot threads on low-core-count "
+                     "machines (0 to disable)")
+    .range(0, 63);
+
 namespace rex::system {
 
 const uint32_t XAPC::kSize;
@@ -48,6 +57,77 @@ using namespace rex::literals;
 
 uint32_t next_xthread_id_ = 0;
 
+namespace {
+
+// Recycles the guest-side allocations of exited threads: stack, TLS block,
+// PCR, and scratch. Titles that churn short-lived workers pay a stack
+// AllocRange with two guard-page Protect calls plus several system-heap
+// allocations per spawn; reusing a warm set makes most of ExCreateThread
+// allocation-free. Host threads themselves are not pooled: XThread::Exit()
+// genuinely ends the host thread, and rerouting that through a trampoline
+// is not worth the risk of breaking thread identity.
+struct GuestThreadResources {
+  uint32_t stack_alloc_base = 0;
+  uint32_t stack_alloc_size = 0;
+  uint32_t stack_base = 0;
+  uint32_t stack_limit = 0;
+  uint32_t stack_size = 0;  // Requested size this allocation satisfies
+  uint32_t tls_static_address = 0;
+  uint32_t tls_total_size = 0;
+  uint32_t pcr_address = 0;
+  uint32_t scratch_address = 0;
+};
+
+class GuestThreadResourcePool {
+ public:
+  static GuestThreadResourcePool& Get() {
+    static GuestThreadResourcePool pool;
+    return pool;
+  }
+
+  bool Acquire(uint32_t stack_size, uint32_t tls_total_size, GuestThreadResources* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+      if (it->stack_size == stack_size && it->tls_total_size == tls_total_size) {
+        *out = *it;
+        entries_.erase(it);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool Release(const GuestThreadResources& resources) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (entries_.size() >= kMaxEntries) {
+      return false;
+    }
+    entries_.push_back(resources);
+    return true;
+  }
+
+  void Clear(memory::Memory* memory) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto heap = memory->LookupHeap(XThread::kStackAddressRangeBegin);
+    for (const auto& entry : entries_) {
+      heap->Release(entry.stack_alloc_base);
+      memory->SystemHeapFree(entry.scratch_address);
+      memory->SystemHeapFree(entry.tls_static_address);
+      memory->SystemHeapFree(entry.pcr_address);
+    }
+    entries_.clear();
+  }
+
+ private:
+  // Enough to absorb a worker churn burst without sitting on guest memory.
+  static constexpr size_t kMaxEntries = 16;
+
+  std::mutex mutex_;
+  std::vector<GuestThreadResources> entries_;
+};
+
+}  // namespace
+
 XThread::XThread(KernelState* kernel_state)
     : XObject(kernel_state, kObjectType), guest_thread_(true) {}
 
@@ -87,10 +167,33 @@ XThread::~XThread() {
 
   thread_.reset();
 
-  kernel_state()->memory()->SystemHeapFree(scratch_address_);
-  kernel_state()->memory()->SystemHeapFree(tls_static_address_);
-  kernel_state()->memory()->SystemHeapFree(pcr_address_);
-  FreeStack();
+  // Offer the guest allocations to the pool for the next spawn; free them
+  // only if the pool is full or the set is incomplete.
+  GuestThreadResources resources;
+  resources.stack_alloc_base = stack_alloc_base_;
+  resources.stack_alloc_size = stack_alloc_size_;
+  resources.stack_base = stack_base_;
+  resources.stack_limit = stack_limit_;
+  resources.stack_size = creation_params_.stack_size;
+  resources.tls_static_address = tls_static_address_;
+  resources.tls_total_size = tls_total_size_;
+  resources.pcr_address = pcr_address_;
+  resources.scratch_address = scratch_address_;
+  if (stack_alloc_base_ && scratch_address_ && tls_static_address_ && pcr_address_ &&
+      GuestThreadResourcePool::Get().Release(resources)) {
+    scratch_address_ = 0;
+    tls_static_address_ = 0;
+    pcr_address_ = 0;
+    stack_alloc_base_ = 0;
+    stack_alloc_size_ = 0;
+    stack_base_ = 0;
+    stack_limit_ = 0;
+  } else {
+    kernel_state()->memory()->SystemHeapFree(scratch_address_);
+    kernel_state()->memory()->SystemHeapFree(tls_static_address_);
+    kernel_state()->memory()->SystemHeapFree(pcr_address_);
+    FreeStack();
+  }
 
   if (thread_) {
     // TODO(benvanik): platform kill
@@ -252,6 +355,10 @@ bool XThread::AllocateStack(uint32_t size) {
   return true;
 }
 
+void XThread::PurgeResourcePool(memory::Memory* memory) {
+  GuestThreadResourcePool::Get().Clear(memory);
+}
+
 void XThread::FreeStack() {
   if (stack_alloc_base_) {
     auto heap = memory()->LookupHeap(kStackAddressRangeBegin);
@@ -271,17 +378,7 @@ X_STATUS XThread::Create() {
     return X_STATUS_NO_MEMORY;
   }
 
-  // Allocate a stack.
-  if (!AllocateStack(creation_params_.stack_size)) {
-    return X_STATUS_NO_MEMORY;
-  }
-
-  // Allocate thread scratch.
-  // This is used by interrupts/APCs/etc so we can round-trip pointers through.
-  scratch_size_ = 4 * 16;
-  scratch_address_ = memory()->SystemHeapAlloc(scratch_size_);
-
-  // Allocate TLS block.
+  // Size the TLS block first so a pooled resource set can be matched.
   // Games will specify a certain number of 4b slots that each thread will get.
   xex2_opt_tls_info* tls_header = nullptr;
   auto module = kernel_state()->GetExecutableModule();
@@ -297,12 +394,44 @@ X_STATUS XThread::Create() {
     tls_extended_size = tls_header->data_size;
   }
 
-  // Allocate both the slots and the extended data.
+  // Both the slots and the extended data.
   // Some TLS is compiled with the binary (declspec(thread)) vars. The game
   // will directly access those through 0(r13).
   uint32_t tls_slot_size = tls_slots * 4;
   tls_total_size_ = tls_slot_size + tls_extended_size;
-  tls_static_address_ = memory()->SystemHeapAlloc(tls_total_size_);
+
+  // Reuse a warm resource set from an exited thread when one fits; otherwise
+  // allocate everything fresh.
+  GuestThreadResources pooled;
+  if (GuestThreadResourcePool::Get().Acquire(creation_params_.stack_size, tls_total_size_,
+                                             &pooled)) {
+    stack_alloc_base_ = pooled.stack_alloc_base;
+    stack_alloc_size_ = pooled.stack_alloc_size;
+    stack_base_ = pooled.stack_base;
+    stack_limit_ = pooled.stack_limit;
+    scratch_size_ = 4 * 16;
+    scratch_address_ = pooled.scratch_address;
+    tls_static_address_ = pooled.tls_static_address;
+    pcr_address_ = pooled.pcr_address;
+    // The stack keeps its junk from the previous thread; the blocks guest
+    // code reads as zero-initialized are wiped below.
+    memory()->Zero(scratch_address_, scratch_size_);
+    memory()->Zero(pcr_address_, 0x2D8);
+  } else {
+    // Allocate a stack.
+    if (!AllocateStack(creation_params_.stack_size)) {
+      return X_STATUS_NO_MEMORY;
+    }
+
+    // Allocate thread scratch.
+    // This is used by interrupts/APCs/etc so we can round-trip pointers through.
+    scratch_size_ = 4 * 16;
+    scratch_address_ = memory()->SystemHeapAlloc(scratch_size_);
+
+    // Allocate TLS block.
+    tls_static_address_ = memory()->SystemHeapAlloc(tls_total_size_);
+  }
+
   tls_dynamic_address_ = tls_static_address_ + tls_extended_size;
   if (!tls_static_address_) {
     REXSYS_WARN("Unable to allocate thread local storage block");
@@ -332,7 +461,9 @@ X_STATUS XThread::Create() {
   // 0x160: last error
   // So, at offset 0x100 we have a 4b pointer to offset 200, then have the
   // structure.
-  pcr_address_ = memory()->SystemHeapAlloc(0x2D8);
+  if (!pcr_address_) {
+    pcr_address_ = memory()->SystemHeapAlloc(0x2D8);
+  }
   if (!pcr_address_) {
     REXSYS_WARN("Unable to allocate thread state block");
     return X_STATUS_NO_MEMORY;
@@ -345,6 +476,10 @@ X_STATUS XThread::Create() {
   // Set kernel state in context for kernel callbacks
   thread_state_->context()->kernel_state = kernel_state_;
 
+  // Let guard-page faults be diagnosed as stack overflows for this thread.
+  thread_state_->RegisterGuestStack(stack_base_, stack_limit_,
+                                    memory()->LookupHeap(kStackAddressRangeBegin)->page_size());
+
   REXSYS_DEBUG("XThread{:08X} ({:X}) Stack: {:08X}-{:08X}", handle(), thread_id_, stack_limit_,
                stack_base_);
 
@@ -787,6 +922,25 @@ void XThread::SetPriority(int32_t increment) {
   if (!REXCVAR_GET(ignore_thread_priorities)) {
     thread_->set_priority(target_priority);
   }
+
+  // Optionally confine below-normal threads to a shared subset of host cores
+  // so the hot guest threads keep the rest to themselves. Skipped when
+  // per-CPU pinning is active - SetActiveCpu owns the affinity mask then.
+  int32_t low_priority_cores = REXCVAR_GET(low_priority_thread_cores);
+  if (low_priority_cores > 0) {
+    uint32_t cpu_count = rex::thread::logical_processor_count();
+    bool pinning_active = cpu_count >= 6 && !REXCVAR_GET(ignore_thread_affinities);
+    if (!pinning_active && uint32_t(low_priority_cores) < cpu_count && cpu_count < 64) {
+      uint64_t all_cores_mask = (uint64_t(1) << cpu_count) - 1;
+      if (target_priority < rex::thread::ThreadPriority::kNormal) {
+        uint64_t low_cores_mask = ((uint64_t(1) << low_priority_cores) - 1)
+                                  << (cpu_count - low_priority_cores);
+        thread_->set_affinity_mask(low_cores_mask);
+      } else {
+        thread_->set_affinity_mask(all_cores_mask);
+      }
+    }
+  }
 }
 
 void XThread::SetAffinity(uint32_t affinity) {
@@ -813,7 +967,9 @@ void XThread::SetActiveCpu(uint8_t cpu_index) {
 
   if (rex::thread::logical_processor_count() >= 6) {
     if (!REXCVAR_GET(ignore_thread_affinities)) {
-      thread_->set_affinity_mask(uint64_t(1) << cpu_index);
+      // With a NUMA placement policy configured this lands on the node the
+      // guest memory is bound to; otherwise it is the plain 1:1 mapping.
+      thread_->set_affinity_mask(rex::thread::guest_cpu_affinity_mask(cpu_index));
     }
   } else {
     REXSYS_WARN("Too few processor cores - scheduling will be wonky");
@@ -873,21 +1029,23 @@ X_STATUS XThread::Suspend(uint32_t* out_suspend_count) {
 
 X_STATUS XThread::Delay(uint32_t processor_mode, uint32_t alertable, uint64_t interval) {
   int64_t timeout_ticks = interval;
-  uint32_t timeout_ms;
+  uint64_t timeout_us;
   if (timeout_ticks > 0) {
     // Absolute time, based on January 1, 1601.
     // TODO(benvanik): convert time to relative time.
     assert_always();
-    timeout_ms = 0;
+    timeout_us = 0;
   } else if (timeout_ticks < 0) {
-    // Relative time.
-    timeout_ms = uint32_t(-timeout_ticks / 10000);  // Ticks -> MS
+    // Relative time. Keep microsecond precision - frame-pacing code sleeps
+    // 1-2 ms per frame, and rounding down to whole milliseconds makes the
+    // remainder get burned in the game loop instead.
+    timeout_us = uint64_t(-timeout_ticks) / 10;  // Ticks -> us
   } else {
-    timeout_ms = 0;
+    timeout_us = 0;
   }
-  timeout_ms = chrono::Clock::ScaleGuestDurationMillis(timeout_ms);
+  timeout_us = chrono::Clock::ScaleGuestDurationMicros(timeout_us);
   if (alertable) {
-    auto result = rex::thread::AlertableSleep(std::chrono::milliseconds(timeout_ms));
+    auto result = rex::thread::AlertableSleep(std::chrono::microseconds(timeout_us));
     switch (result) {
       default:
       case rex::thread::SleepResult::kSuccess:
@@ -896,7 +1054,7 @@ X_STATUS XThread::Delay(uint32_t processor_mode, uint32_t alertable, uint64_t in
         return X_STATUS_USER_APC;
     }
   } else {
-    rex::thread::Sleep(std::chrono::milliseconds(timeout_ms));
+    rex::thread::PreciseSleep(std::chrono::microseconds(timeout_us));
     return X_STATUS_SUCCESS;
   }
 }
@@ -1465,6 +1623,9 @@ object_ref<XThread> XThread::Restore(KernelState* kernel_state, stream::ByteStre
   // Create thread state
   thread->thread_state_ = std::make_unique<runtime::ThreadState>(
       thread->thread_id_, thread->stack_base_, thread->pcr_address_, kernel_state->memory());
+  thread->thread_state_->RegisterGuestStack(
+      thread->stack_base_, thread->stack_limit_,
+      kernel_state->memory()->LookupHeap(kStackAddressRangeBegin)->page_size());
 
   if (state.is_running) {
     auto context = thread->thread_state_->context();
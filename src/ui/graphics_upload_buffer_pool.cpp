@@ -39,6 +39,27 @@ void GraphicsUploadBufferPool::Reclaim(uint64_t completed_submission_index) {
   if (!submitted_first_) {
     submitted_last_ = nullptr;
   }
+  // Release writable pages beyond the one currently being filled that haven't
+  // been requested for kTrimIdleSubmissions completed submissions, returning
+  // to the steady-state working set after a spike.
+  if (writable_first_ && completed_submission_index >= kTrimIdleSubmissions) {
+    uint64_t trim_submission_index = completed_submission_index - kTrimIdleSubmissions;
+    Page* page_previous = writable_first_;
+    Page* page = writable_first_->next_;
+    while (page) {
+      Page* page_next = page->next_;
+      if (page->last_submission_index_ <= trim_submission_index) {
+        page_previous->next_ = page_next;
+        if (writable_last_ == page) {
+          writable_last_ = page_previous;
+        }
+        delete page;
+      } else {
+        page_previous = page;
+      }
+      page = page_next;
+    }
+  }
 }
 
 void GraphicsUploadBufferPool::ChangeSubmissionTimeline() {
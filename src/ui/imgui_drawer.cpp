@@ -16,6 +16,7 @@
 
 #include <rex/assert.h>
 #include <rex/chrono/clock.h>
+#include <rex/hash.h>
 #include <rex/logging.h>
 #include <rex/ui/imgui_dialog.h>
 #include <rex/ui/imgui_drawer.h>
@@ -34,6 +35,29 @@ const char kProggyTinyCompressedDataBase85[10950 + 1] =
 
 static_assert(sizeof(ImmediateVertex) == sizeof(ImDrawVert), "Vertex types must match");
 
+// Hashes everything that determines what the generated UI looks like on the
+// screen, to detect whether anything has actually changed between two frames.
+static uint64_t HashDrawData(const ImDrawData* data) {
+  XXH3_state_t hash_state;
+  XXH3_64bits_reset(&hash_state);
+  XXH3_64bits_update(&hash_state, &data->DisplaySize, sizeof(data->DisplaySize));
+  for (int i = 0; i < data->CmdListsCount; ++i) {
+    const ImDrawList* cmd_list = data->CmdLists[i];
+    XXH3_64bits_update(&hash_state, cmd_list->VtxBuffer.Data, cmd_list->VtxBuffer.size_in_bytes());
+    XXH3_64bits_update(&hash_state, cmd_list->IdxBuffer.Data, cmd_list->IdxBuffer.size_in_bytes());
+    for (int j = 0; j < cmd_list->CmdBuffer.size(); ++j) {
+      const ImDrawCmd& cmd = cmd_list->CmdBuffer[j];
+      XXH3_64bits_update(&hash_state, &cmd.ClipRect, sizeof(cmd.ClipRect));
+      ImTextureID texture_id = cmd.GetTexID();
+      XXH3_64bits_update(&hash_state, &texture_id, sizeof(texture_id));
+      XXH3_64bits_update(&hash_state, &cmd.VtxOffset, sizeof(cmd.VtxOffset));
+      XXH3_64bits_update(&hash_state, &cmd.IdxOffset, sizeof(cmd.IdxOffset));
+      XXH3_64bits_update(&hash_state, &cmd.ElemCount, sizeof(cmd.ElemCount));
+    }
+  }
+  return XXH3_64bits_digest(&hash_state);
+}
+
 ImGuiDrawer::ImGuiDrawer(rex::ui::Window* window, size_t z_order)
     : window_(window), z_order_(z_order) {
   Initialize();
@@ -304,9 +328,13 @@ void ImGuiDrawer::Draw(UIDrawContext& ui_draw_context) {
 
   ImGui::Render();
   ImDrawData* draw_data = ImGui::GetDrawData();
+  uint64_t draw_data_hash = 0;
   if (draw_data) {
     RenderDrawLists(draw_data, ui_draw_context);
+    draw_data_hash = HashDrawData(draw_data);
   }
+  bool draw_data_changed = draw_data_hash != last_draw_data_hash_;
+  last_draw_data_hash_ = draw_data_hash;
 
   if (reset_mouse_position_after_next_frame_) {
     reset_mouse_position_after_next_frame_ = false;
@@ -318,8 +346,15 @@ void ImGuiDrawer::Draw(UIDrawContext& ui_draw_context) {
   DetachIfLastDialogRemoved();
 
   if (!dialogs_.empty()) {
-    // Repaint (and handle input) continuously if still active.
-    presenter_->RequestUIPaintFromUIThread();
+    // Repaint (and handle input) continuously while the UI content is actually
+    // changing, or while an interaction that animates without generating events
+    // (text input caret blinking, held widgets) is in progress. For a static
+    // overlay, the loop pauses here and is restarted by the input handlers, so
+    // identical frames aren't rebuilt and re-uploaded over and over.
+    if (draw_data_changed || ImGui::IsAnyItemActive() || ImGui::IsAnyMouseDown() ||
+        io.WantTextInput) {
+      presenter_->RequestUIPaintFromUIThread();
+    }
   }
 }
 
@@ -365,6 +400,14 @@ ImGuiIO& ImGuiDrawer::GetIO() {
   return ImGui::GetIO();
 }
 
+void ImGuiDrawer::RequestUIPaintForInput() {
+  // The continuous repaint loop pauses at the end of Draw while the UI is
+  // static - restart it so the new input state is processed and drawn.
+  if (presenter_ && !dialogs_.empty()) {
+    presenter_->RequestUIPaintFromUIThread();
+  }
+}
+
 void ImGuiDrawer::OnKeyDown(KeyEvent& e) {
   OnKey(e, true);
 }
@@ -381,6 +424,7 @@ void ImGuiDrawer::OnKeyChar(KeyEvent& e) {
     io.AddInputCharacter(character);
     e.set_handled(true);
   }
+  RequestUIPaintForInput();
 }
 
 void ImGuiDrawer::OnMouseDown(MouseEvent& e) {
@@ -409,10 +453,12 @@ void ImGuiDrawer::OnMouseDown(MouseEvent& e) {
       io.MouseDown[button] = true;
     }
   }
+  RequestUIPaintForInput();
 }
 
 void ImGuiDrawer::OnMouseMove(MouseEvent& e) {
   SwitchToPhysicalMouseAndUpdateMousePosition(e);
+  RequestUIPaintForInput();
 }
 
 void ImGuiDrawer::OnMouseUp(MouseEvent& e) {
@@ -441,12 +487,14 @@ void ImGuiDrawer::OnMouseUp(MouseEvent& e) {
       }
     }
   }
+  RequestUIPaintForInput();
 }
 
 void ImGuiDrawer::OnMouseWheel(MouseEvent& e) {
   SwitchToPhysicalMouseAndUpdateMousePosition(e);
   auto& io = GetIO();
   io.MouseWheel += float(e.scroll_y()) / float(MouseEvent::kScrollPerDetent);
+  RequestUIPaintForInput();
 }
 
 void ImGuiDrawer::OnTouchEvent(TouchEvent& e) {
@@ -479,6 +527,7 @@ void ImGuiDrawer::OnTouchEvent(TouchEvent& e) {
     io.MouseDown[0] = true;
     reset_mouse_position_after_next_frame_ = false;
   }
+  RequestUIPaintForInput();
 }
 
 void ImGuiDrawer::ClearInput() {
@@ -516,6 +565,7 @@ void ImGuiDrawer::OnKey(KeyEvent& e, bool is_down) {
     default:
       break;
   }
+  RequestUIPaintForInput();
 }
 
 void ImGuiDrawer::UpdateMousePosition(float x, float y) {
@@ -12,11 +12,16 @@
 #include <rex/ui/overlay/debug_overlay.h>
 #include <rex/ui/keybinds.h>
 #include <imgui.h>
+#include <cfloat>
+#include <fstream>
 
 namespace rex::ui {
 
-DebugOverlayDialog::DebugOverlayDialog(ImGuiDrawer* imgui_drawer, FrameStatsProvider stats_provider)
-    : ImGuiDialog(imgui_drawer), stats_provider_(std::move(stats_provider)) {
+DebugOverlayDialog::DebugOverlayDialog(ImGuiDrawer* imgui_drawer, FrameStatsProvider stats_provider,
+                                       GpuPhaseStatsProvider gpu_stats_provider)
+    : ImGuiDialog(imgui_drawer),
+      stats_provider_(std::move(stats_provider)),
+      gpu_stats_provider_(std::move(gpu_stats_provider)) {
   RegisterBind("bind_debug_overlay", "F3", "Toggle debug overlay", [this] { ToggleVisible(); });
 }
 
@@ -29,7 +34,7 @@ void DebugOverlayDialog::OnDraw(ImGuiIO& io) {
     return;
 
   ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_FirstUseEver);
-  ImGui::SetNextWindowSize(ImVec2(220, 60), ImGuiCond_FirstUseEver);
+  ImGui::SetNextWindowSize(ImVec2(340, 160), ImGuiCond_FirstUseEver);
   ImGui::SetNextWindowBgAlpha(0.5f);
   if (ImGui::Begin("Debug##overlay", nullptr, ImGuiWindowFlags_NoCollapse)) {
     ImGui::Text("Host:  %.1f FPS (%.2f ms)", io.Framerate, 1000.0f / io.Framerate);
@@ -39,8 +44,44 @@ void DebugOverlayDialog::OnDraw(ImGuiIO& io) {
         ImGui::Text("Guest: %.1f FPS (%.2f ms)", stats.fps, stats.frame_time_ms);
       }
     }
+    if (gpu_stats_provider_) {
+      auto frames = gpu_stats_provider_();
+      if (!frames.empty()) {
+        ImGui::Separator();
+        const GpuPhaseFrame& latest = frames.back();
+        ImGui::Text("CP: draw %.2f  resolve %.2f  swap %.2f  other %.2f ms", latest.draw_ms,
+                    latest.resolve_ms, latest.swap_ms, latest.other_ms);
+        ImGui::PlotLines(
+            "##cp_frame_ms",
+            [](void* data, int index) {
+              const GpuPhaseFrame& frame = static_cast<const GpuPhaseFrame*>(data)[index];
+              return frame.draw_ms + frame.resolve_ms + frame.swap_ms + frame.other_ms;
+            },
+            frames.data(), int(frames.size()), 0, "CP frame ms", 0.0f, FLT_MAX,
+            ImVec2(ImGui::GetContentRegionAvail().x, 40));
+        if (ImGui::SmallButton("Export JSON")) {
+          ExportGpuPhaseStats(frames);
+        }
+      }
+    }
   }
   ImGui::End();
 }
 
+bool DebugOverlayDialog::ExportGpuPhaseStats(const std::vector<GpuPhaseFrame>& frames) {
+  std::ofstream file("gpu_frame_phases.json", std::ios::trunc);
+  if (!file.is_open()) {
+    return false;
+  }
+  file << "[\n";
+  for (size_t i = 0; i < frames.size(); ++i) {
+    const GpuPhaseFrame& frame = frames[i];
+    file << "  {\"draw_ms\": " << frame.draw_ms << ", \"resolve_ms\": " << frame.resolve_ms
+         << ", \"swap_ms\": " << frame.swap_ms << ", \"other_ms\": " << frame.other_ms << "}"
+         << (i + 1 < frames.size() ? ",\n" : "\n");
+  }
+  file << "]\n";
+  return file.good();
+}
+
 }  // namespace rex::ui
@@ -13,6 +13,7 @@
 #include <utility>
 
 #include <rex/assert.h>
+#include <rex/chrono/clock.h>
 #include <rex/cvar.h>
 #include <rex/logging.h>
 #include <rex/platform.h>
@@ -37,6 +38,10 @@ REXCVAR_DEFINE_INT32(present_safe_area_y, 90, "UI/Presenter",
                      "Vertical safe area percentage (0-100)")
     .range(0, 100);
 
+REXCVAR_DEFINE_BOOL(present_latency_stats, false, "UI/Presenter",
+                    "Log the average and maximum latency between the guest output refresh "
+                    "and its consumption for presentation every 120 presents");
+
 namespace rex {
 namespace ui {
 
@@ -169,6 +174,30 @@ void Presenter::OnSurfaceResizeFromUIThread() {
     SetPaintModeFromUIThread(PaintMode::kUIThreadOnRequest);
   }
 
+  // If currently paintable, don't reconnect (and possibly resize or recreate
+  // the swap chain in the implementation) here for every single event -
+  // interactive resizing produces storms of them, many per frame. Instead,
+  // mark the connection outdated and let the next paint, which is subject to
+  // the UI frame rate limiting, reconnect using the latest size - the same
+  // path that recovers from the implementation reporting an outdated
+  // connection after presentation. If the surface has become zero-area,
+  // however, disconnect immediately below, as no paint will be done while it
+  // stays zero-area.
+  if (surface_paint_connection_state_ == SurfacePaintConnectionState::kConnectedPaintable) {
+    uint32_t surface_width = 0, surface_height = 0;
+    if (surface_->GetSize(surface_width, surface_height)) {
+      if (surface_width == surface_width_in_paint_connection_ &&
+          surface_height == surface_height_in_paint_connection_) {
+        // The size hasn't actually changed - keep the connection and the
+        // currently presented image.
+        return;
+      }
+      surface_paint_connection_state_ = SurfacePaintConnectionState::kConnectedOutdated;
+      RequestPaintOrConnectionRecoveryViaWindow(true);
+      return;
+    }
+  }
+
   bool request_repaint;
   UpdateSurfacePaintConnectionFromUIThread(&request_repaint, true);
 
@@ -345,6 +374,12 @@ bool Presenter::RefreshGuestOutput(
   // after switching from UI thread painting to doing it in the guest output
   // thread, will immediately recover to having the latest frame always sent to
   // the host present call on the CPU and all frames reaching a present call).
+  // Timestamp the image before releasing it so consumers can measure the
+  // latency between the refresh and the host presentation consuming it
+  // (present_latency_stats).
+  guest_output_refresh_ticks_[guest_output_mailbox_writable_] =
+      rex::chrono::Clock::QueryHostTickCount();
+
   uint32_t last_acquired_and_ready =
       guest_output_mailbox_acquired_and_ready_.load(std::memory_order_relaxed);
   // Desired acquired = current acquired (changed only by the consumers).
@@ -586,6 +621,29 @@ std::unique_lock<std::mutex> Presenter::ConsumeGuestOutput(
   // Give the current acquired image to the caller, or UINT32_MAX if it's
   // inactive.
   const GuestOutputProperties& properties = guest_output_properties_[mailbox_index];
+  // The compare-exchange loop exits either with old == desired (the ready image
+  // had already been acquired, no new sample) or with a successful exchange
+  // that made a newly refreshed image acquired - gather a latency sample for
+  // the latter case only, so re-paints of the same image (window resizes, UI
+  // redraws) don't distort the statistics.
+  if (old_acquired_and_ready != desired_acquired_and_ready && properties.IsActive() &&
+      REXCVAR_GET(present_latency_stats)) {
+    uint64_t latency_ticks =
+        rex::chrono::Clock::QueryHostTickCount() - guest_output_refresh_ticks_[mailbox_index];
+    present_latency_total_ticks_ += latency_ticks;
+    present_latency_max_ticks_ = std::max(present_latency_max_ticks_, latency_ticks);
+    if (++present_latency_sample_count_ >= 120) {
+      double ms_per_tick = 1000.0 / double(rex::chrono::Clock::QueryHostTickFrequency());
+      REXLOG_INFO("Presenter: guest output latency over {} presents: avg {:.2f} ms, max {:.2f} ms",
+                  present_latency_sample_count_,
+                  double(present_latency_total_ticks_) / present_latency_sample_count_ *
+                      ms_per_tick,
+                  double(present_latency_max_ticks_) * ms_per_tick);
+      present_latency_total_ticks_ = 0;
+      present_latency_max_ticks_ = 0;
+      present_latency_sample_count_ = 0;
+    }
+  }
   mailbox_index_or_max_if_inactive_out = properties.IsActive() ? mailbox_index : UINT32_MAX;
   if (properties_out) {
     *properties_out = properties;
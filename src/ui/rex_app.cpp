@@ -18,6 +18,7 @@
 #include <rex/ui/overlay/console_overlay.h>
 #include <rex/ui/overlay/debug_overlay.h>
 #include <rex/ui/overlay/settings_overlay.h>
+#include <rex/graphics/command_processor.h>
 #include <rex/graphics/graphics_system.h>
 #if REX_HAS_VULKAN
 #include <rex/graphics/vulkan/graphics_system.h>
@@ -169,7 +170,21 @@ bool ReXApp::OnInitialize() {
         imgui_drawer_ = std::make_unique<rex::ui::ImGuiDrawer>(window_.get(), 64);
         imgui_drawer_->SetPresenterAndImmediateDrawer(presenter, immediate_drawer_.get());
         // Built-in overlays
-        debug_overlay_ = std::make_unique<ui::DebugOverlayDialog>(imgui_drawer_.get());
+        ui::DebugOverlayDialog::GpuPhaseStatsProvider gpu_phase_provider;
+        if (graphics_system->command_processor()) {
+          gpu_phase_provider = [graphics_system]() {
+            std::vector<ui::GpuPhaseFrame> frames;
+            auto timings = graphics_system->command_processor()->GetFramePhaseTimings();
+            frames.reserve(timings.size());
+            for (const auto& timing : timings) {
+              frames.push_back(
+                  {timing.draw_ms, timing.resolve_ms, timing.swap_ms, timing.other_ms});
+            }
+            return frames;
+          };
+        }
+        debug_overlay_ = std::make_unique<ui::DebugOverlayDialog>(imgui_drawer_.get(), nullptr,
+                                                                  std::move(gpu_phase_provider));
         console_overlay_ = std::make_unique<ui::ConsoleDialog>(imgui_drawer_.get(), log_sink_);
         settings_overlay_ = std::make_unique<ui::SettingsDialog>(
             imgui_drawer_.get(), exe_dir / (std::string(GetName()) + ".toml"));
@@ -174,6 +174,8 @@ std::unique_ptr<VulkanDevice> VulkanDevice::CreateIfSupported(
       XE_UI_VULKAN_LOCAL_PROMOTED_EXTENSION(KHR_shader_float_controls, 1, 2)
       // #252.
       XE_UI_VULKAN_LOCAL_EXTENSION(EXT_fragment_shader_interlock)
+      // #268.
+      XE_UI_VULKAN_STRUCT_PROMOTED_EXTENSION(EXT_extended_dynamic_state, 1, 3)
       // #277.
       XE_UI_VULKAN_LOCAL_PROMOTED_EXTENSION(EXT_shader_demote_to_helper_invocation, 1, 3)
       // #423.
@@ -260,6 +262,9 @@ std::unique_ptr<VulkanDevice> VulkanDevice::CreateIfSupported(
   VulkanFeatures<VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT,
                  VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_INTERLOCK_FEATURES_EXT>
       features_EXT_fragment_shader_interlock;
+  VulkanFeatures<VkPhysicalDeviceExtendedDynamicStateFeaturesEXT,
+                 VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT>
+      features_1_3_EXT_extended_dynamic_state;
   VulkanFeatures<VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT,
                  VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DEMOTE_TO_HELPER_INVOCATION_FEATURES_EXT>
       features_1_3_EXT_shader_demote_to_helper_invocation;
@@ -274,6 +279,9 @@ std::unique_ptr<VulkanDevice> VulkanDevice::CreateIfSupported(
     if (properties.apiVersion >= VK_MAKE_API_VERSION(0, 1, 3, 0)) {
       features_1_3.Link(supported_features_2, device_create_info);
     } else {
+      if (device->extensions_.ext_1_3_EXT_extended_dynamic_state) {
+        features_1_3_EXT_extended_dynamic_state.Link(supported_features_2, device_create_info);
+      }
       if (ext_1_3_EXT_shader_demote_to_helper_invocation) {
         features_1_3_EXT_shader_demote_to_helper_invocation.Link(supported_features_2,
                                                                  device_create_info);
@@ -576,9 +584,16 @@ std::unique_ptr<VulkanDevice> VulkanDevice::CreateIfSupported(
 
   if (properties.apiVersion >= VK_MAKE_API_VERSION(0, 1, 3, 0)) {
     if (with_gpu_emulation) {
+      // Core in Vulkan 1.3 without a feature bit.
+      XE_UI_VULKAN_FEATURE_IMPLIED(extendedDynamicState)
       XE_UI_VULKAN_FEATURE_2(features_1_3, shaderDemoteToHelperInvocation);
     }
   } else {
+    if (device->extensions_.ext_1_3_EXT_extended_dynamic_state) {
+      if (with_gpu_emulation) {
+        XE_UI_VULKAN_FEATURE_2(features_1_3_EXT_extended_dynamic_state, extendedDynamicState);
+      }
+    }
     if (ext_1_3_EXT_shader_demote_to_helper_invocation) {
       if (with_gpu_emulation) {
         XE_UI_VULKAN_FEATURE_2(features_1_3_EXT_shader_demote_to_helper_invocation,
@@ -672,6 +687,7 @@ std::unique_ptr<VulkanDevice> VulkanDevice::CreateIfSupported(
 #include <rex/ui/vulkan/functions/device_1_1_khr_get_memory_requirements2.inc>
   }
   if (properties.apiVersion >= VK_MAKE_API_VERSION(0, 1, 3, 0)) {
+#include <rex/ui/vulkan/functions/device_1_3_ext_extended_dynamic_state.inc>
 #include <rex/ui/vulkan/functions/device_1_3_khr_maintenance4.inc>
   }
 #undef XE_UI_VULKAN_FUNCTION_PROMOTED
@@ -690,6 +706,9 @@ std::unique_ptr<VulkanDevice> VulkanDevice::CreateIfSupported(
     }
   }
   if (properties.apiVersion < VK_MAKE_API_VERSION(0, 1, 3, 0)) {
+    if (device->extensions_.ext_1_3_EXT_extended_dynamic_state) {
+#include <rex/ui/vulkan/functions/device_1_3_ext_extended_dynamic_state.inc>
+    }
     if (device->extensions_.ext_1_3_KHR_maintenance4) {
 #include <rex/ui/vulkan/functions/device_1_3_khr_maintenance4.inc>
     }
@@ -850,6 +850,19 @@ bool Win32Window::HandleMouse(UINT message, WPARAM wParam, LPARAM lParam,
       return false;
   }
 
+  if (message == WM_MOUSEMOVE) {
+    // WM_MOUSEMOVE is also sent for reasons not involving actual mouse
+    // movement performed by the user (see the cursor auto-hiding logic above),
+    // and floods of moves arrive during window management - don't dispatch to
+    // all the input listeners when the position hasn't changed since the last
+    // dispatched move.
+    if (client_pos.x == mouse_move_last_client_pos_.x &&
+        client_pos.y == mouse_move_last_client_pos_.y) {
+      return false;
+    }
+    mouse_move_last_client_pos_ = client_pos;
+  }
+
   MouseEvent e(this, button, client_pos.x, client_pos.y, 0, scroll_y);
   switch (message) {
     case WM_LBUTTONDOWN:
@@ -0,0 +1,64 @@
+/**
+ * Microbenchmarks for ByteStream serialization.
+ *
+ * ByteStream backs save-state serialization of the object table, command
+ * processor, and heaps, so per-element overhead multiplies across every
+ * field of every saved object.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <rex/stream.h>
+
+using namespace rex::stream;
+
+namespace {
+constexpr size_t kBufferSize = 1 << 20;
+}  // namespace
+
+static void BM_ByteStreamWriteU32(benchmark::State& state) {
+  std::vector<uint8_t> buffer(kBufferSize);
+  const size_t count = buffer.size() / sizeof(uint32_t);
+  for (auto _ : state) {
+    ByteStream stream(buffer.data(), buffer.size());
+    for (size_t i = 0; i < count; ++i) {
+      stream.Write<uint32_t>(uint32_t(i));
+    }
+    benchmark::DoNotOptimize(buffer.data());
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(kBufferSize));
+}
+BENCHMARK(BM_ByteStreamWriteU32);
+
+static void BM_ByteStreamReadU32(benchmark::State& state) {
+  std::vector<uint8_t> buffer(kBufferSize);
+  const size_t count = buffer.size() / sizeof(uint32_t);
+  for (auto _ : state) {
+    ByteStream stream(buffer.data(), buffer.size());
+    uint64_t sum = 0;
+    for (size_t i = 0; i < count; ++i) {
+      sum += stream.Read<uint32_t>();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(kBufferSize));
+}
+BENCHMARK(BM_ByteStreamReadU32);
+
+static void BM_ByteStreamWriteBulk(benchmark::State& state) {
+  std::vector<uint8_t> buffer(kBufferSize);
+  std::vector<uint8_t> source(size_t(state.range(0)));
+  for (auto _ : state) {
+    ByteStream stream(buffer.data(), buffer.size());
+    const size_t count = buffer.size() / source.size();
+    for (size_t i = 0; i < count; ++i) {
+      stream.Write(source.data(), source.size());
+    }
+    benchmark::DoNotOptimize(buffer.data());
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(kBufferSize));
+}
+BENCHMARK(BM_ByteStreamWriteBulk)->Arg(64)->Arg(4096);
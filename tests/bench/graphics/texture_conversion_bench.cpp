@@ -0,0 +1,85 @@
+/**
+ * Microbenchmarks for texture conversion kernels.
+ *
+ * Untiling and endian conversion run once per uploaded texture mip, and a
+ * 720p frontbuffer-sized surface is a representative worst case.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <rex/graphics/pipeline/texture/conversion.h>
+#include <rex/graphics/pipeline/texture/info.h>
+#include <rex/graphics/xenos.h>
+
+using namespace rex::graphics;
+
+namespace {
+
+constexpr uint32_t kWidth = 1280;
+constexpr uint32_t kHeight = 720;
+// Tiled layouts address in 32-row macro tiles, so the input covers the
+// height rounded up to the next multiple of 32.
+constexpr uint32_t kTiledHeight = (kHeight + 31) & ~31u;
+
+}  // namespace
+
+static void BM_CopySwapBlock(benchmark::State& state) {
+  auto endian = xenos::Endian(state.range(0));
+  std::vector<uint8_t> input(kWidth * kHeight * 4);
+  std::vector<uint8_t> output(input.size());
+  for (auto _ : state) {
+    texture_conversion::CopySwapBlock(endian, output.data(), input.data(), input.size());
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(input.size()));
+}
+BENCHMARK(BM_CopySwapBlock)
+    ->Arg(int(xenos::Endian::kNone))
+    ->Arg(int(xenos::Endian::k8in16))
+    ->Arg(int(xenos::Endian::k8in32))
+    ->Arg(int(xenos::Endian::k16in32));
+
+static void BM_Untile8888(benchmark::State& state) {
+  const FormatInfo* format_info = FormatInfo::Get(xenos::TextureFormat::k_8_8_8_8);
+  std::vector<uint8_t> input(kWidth * kTiledHeight * 4);
+  std::vector<uint8_t> output(kWidth * kHeight * 4);
+
+  texture_conversion::UntileInfo untile_info = {};
+  untile_info.offset_x = 0;
+  untile_info.offset_y = 0;
+  untile_info.width = kWidth;
+  untile_info.height = kHeight;
+  untile_info.input_pitch = kWidth;
+  untile_info.output_pitch = kWidth;
+  untile_info.input_format_info = format_info;
+  untile_info.output_format_info = format_info;
+  untile_info.copy_callback =
+      texture_conversion::GetCopySwapBlockCallback(xenos::Endian::k8in32);
+
+  for (auto _ : state) {
+    texture_conversion::Untile(output.data(), input.data(), &untile_info);
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(output.size()));
+}
+BENCHMARK(BM_Untile8888);
+
+static void BM_ConvertTexelCTX1ToR8G8(benchmark::State& state) {
+  // CTX1: 4x4 blocks, 8 bytes per block in, expanded to 32 bytes of R8G8 out
+  // (the length argument is the output pitch in bytes, 8 for a lone block).
+  constexpr size_t kBlockCount = (kWidth / 4) * (kHeight / 4);
+  std::vector<uint8_t> input(kBlockCount * 8);
+  std::vector<uint8_t> output(kBlockCount * 32);
+  for (auto _ : state) {
+    for (size_t i = 0; i < kBlockCount; ++i) {
+      texture_conversion::ConvertTexelCTX1ToR8G8(xenos::Endian::k8in16, output.data() + i * 32,
+                                                 input.data() + i * 8, 8);
+    }
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(input.size()));
+}
+BENCHMARK(BM_ConvertTexelCTX1ToR8G8);
@@ -0,0 +1,74 @@
+/**
+ * Microbenchmarks for guest memory access primitives.
+ *
+ * These are the building blocks behind the PPC_LOAD/PPC_STORE macros in
+ * recompiled code: byteswapping loads/stores and be<> typed access. A cycle
+ * here is a cycle on every guest memory operation.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <rex/memory/utils.h>
+#include <rex/types.h>
+
+namespace {
+constexpr size_t kBufferSize = 1 << 20;
+}  // namespace
+
+static void BM_LoadAndSwapU32(benchmark::State& state) {
+  std::vector<uint8_t> buffer(kBufferSize);
+  const size_t count = buffer.size() / sizeof(uint32_t);
+  for (auto _ : state) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < count; ++i) {
+      sum += rex::memory::load_and_swap<uint32_t>(buffer.data() + i * sizeof(uint32_t));
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(kBufferSize));
+}
+BENCHMARK(BM_LoadAndSwapU32);
+
+static void BM_StoreAndSwapU32(benchmark::State& state) {
+  std::vector<uint8_t> buffer(kBufferSize);
+  const size_t count = buffer.size() / sizeof(uint32_t);
+  for (auto _ : state) {
+    for (size_t i = 0; i < count; ++i) {
+      rex::memory::store_and_swap<uint32_t>(buffer.data() + i * sizeof(uint32_t), uint32_t(i));
+    }
+    benchmark::DoNotOptimize(buffer.data());
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(kBufferSize));
+}
+BENCHMARK(BM_StoreAndSwapU32);
+
+static void BM_BigEndianTypedSum(benchmark::State& state) {
+  std::vector<rex::be_u32> values(kBufferSize / sizeof(rex::be_u32));
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = uint32_t(i);
+  }
+  for (auto _ : state) {
+    uint64_t sum = 0;
+    for (const auto& value : values) {
+      sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(kBufferSize));
+}
+BENCHMARK(BM_BigEndianTypedSum);
+
+static void BM_CopyAndSwap32Unaligned(benchmark::State& state) {
+  std::vector<uint8_t> input(kBufferSize);
+  std::vector<uint8_t> output(kBufferSize);
+  const size_t count = kBufferSize / sizeof(uint32_t);
+  for (auto _ : state) {
+    rex::memory::copy_and_swap_32_unaligned(output.data(), input.data(), count);
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(kBufferSize));
+}
+BENCHMARK(BM_CopyAndSwap32Unaligned);
@@ -0,0 +1,95 @@
+# Synthetic codegen benchmark corpus: function discovery.
+#
+# A deep call graph of small functions - leaves, call chains, conditional
+# cross-calls and a tail branch - so discovery has real convergence work to
+# do instead of the single-function bodies in asm/. Not a register I/O test;
+# assembled into the benchmark binary only (see README.md).
+
+bench_leaf_0:
+  mullw r3, r3, r4
+  addi r3, r3, 1
+  blr
+
+bench_leaf_1:
+  xor r3, r3, r4
+  rotlwi r3, r3, 7
+  blr
+
+bench_leaf_2:
+  subf r3, r4, r3
+  srawi r3, r3, 2
+  blr
+
+bench_leaf_3:
+  and r3, r3, r4
+  neg r3, r3
+  blr
+
+bench_chain_0:
+  mflr r0
+  stw r0, -8(r1)
+  stwu r1, -32(r1)
+  bl bench_leaf_0
+  bl bench_leaf_1
+  addi r1, r1, 32
+  lwz r0, -8(r1)
+  mtlr r0
+  blr
+
+bench_chain_1:
+  mflr r0
+  stw r0, -8(r1)
+  stwu r1, -32(r1)
+  bl bench_leaf_2
+  bl bench_chain_0
+  addi r1, r1, 32
+  lwz r0, -8(r1)
+  mtlr r0
+  blr
+
+bench_chain_2:
+  mflr r0
+  stw r0, -8(r1)
+  stwu r1, -32(r1)
+  bl bench_chain_1
+  bl bench_leaf_3
+  bl bench_chain_0
+  addi r1, r1, 32
+  lwz r0, -8(r1)
+  mtlr r0
+  blr
+
+# Conditional cross-calls: both sides must be followed.
+bench_branchy:
+  mflr r0
+  stw r0, -8(r1)
+  stwu r1, -32(r1)
+  cmpwi r3, 0
+  beq bench_branchy_zero
+  bl bench_chain_2
+  b bench_branchy_done
+bench_branchy_zero:
+  bl bench_chain_1
+bench_branchy_done:
+  addi r1, r1, 32
+  lwz r0, -8(r1)
+  mtlr r0
+  blr
+
+# Tail branch to another function: discovery must not fold the target in.
+bench_tail:
+  addi r3, r3, 4
+  b bench_leaf_1
+
+bench_root:
+  mflr r0
+  stw r0, -8(r1)
+  stwu r1, -32(r1)
+  li r4, 3
+  bl bench_branchy
+  bl bench_tail
+  bl bench_chain_2
+  addi r1, r1, 32
+  lwz r0, -8(r1)
+  mtlr r0
+  blr
@@ -0,0 +1,87 @@
+# Synthetic codegen benchmark corpus: jump tables.
+#
+# The standard compiler shape for a dense switch: bounds check, scaled load
+# from an absolute word table, mtctr/bctr. Exercises jump-table detection
+# and per-entry target resolution; sixteen cases keeps the table past the
+# computed-goto threshold without padding the file.
+
+bench_switch:
+  cmplwi r3, 15
+  bgt bench_switch_default
+  lis r12, bench_switch_table@ha
+  addi r12, r12, bench_switch_table@l
+  slwi r0, r3, 2
+  lwzx r0, r12, r0
+  mtctr r0
+  bctr
+
+bench_switch_case_0:
+  li r3, 100
+  blr
+bench_switch_case_1:
+  li r3, 101
+  blr
+bench_switch_case_2:
+  li r3, 102
+  blr
+bench_switch_case_3:
+  li r3, 103
+  blr
+bench_switch_case_4:
+  li r3, 104
+  blr
+bench_switch_case_5:
+  li r3, 105
+  blr
+bench_switch_case_6:
+  li r3, 106
+  blr
+bench_switch_case_7:
+  li r3, 107
+  blr
+bench_switch_case_8:
+  li r3, 108
+  blr
+bench_switch_case_9:
+  li r3, 109
+  blr
+bench_switch_case_10:
+  li r3, 110
+  blr
+bench_switch_case_11:
+  li r3, 111
+  blr
+bench_switch_case_12:
+  li r3, 112
+  blr
+bench_switch_case_13:
+  li r3, 113
+  blr
+bench_switch_case_14:
+  li r3, 114
+  blr
+bench_switch_case_15:
+  li r3, 115
+  blr
+bench_switch_default:
+  li r3, -1
+  blr
+
+  .balign 4
+bench_switch_table:
+  .long bench_switch_case_0
+  .long bench_switch_case_1
+  .long bench_switch_case_2
+  .long bench_switch_case_3
+  .long bench_switch_case_4
+  .long bench_switch_case_5
+  .long bench_switch_case_6
+  .long bench_switch_case_7
+  .long bench_switch_case_8
+  .long bench_switch_case_9
+  .long bench_switch_case_10
+  .long bench_switch_case_11
+  .long bench_switch_case_12
+  .long bench_switch_case_13
+  .long bench_switch_case_14
+  .long bench_switch_case_15
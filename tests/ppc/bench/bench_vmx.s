@@ -0,0 +1,49 @@
+# Synthetic codegen benchmark corpus: VMX-heavy code.
+#
+# A vectorized inner loop in the shape of a typical math kernel - streaming
+# loads, fused multiply-adds, permutes, compares - so recompilation spends
+# its time in the VMX builders rather than integer boilerplate.
+
+bench_vmx_kernel:
+  # r3 = dst, r4 = src a, r5 = src b, r6 = vector count
+  mtctr r6
+  li r7, 0
+  li r8, 16
+  vspltisw v13, 1
+  vxor v12, v12, v12
+bench_vmx_loop:
+  lvx v0, r7, r4
+  lvx v1, r8, r4
+  lvx v2, r7, r5
+  lvx v3, r8, r5
+  vmaddfp v4, v0, v2, v12
+  vmaddfp v5, v1, v3, v4
+  vaddfp v6, v4, v5
+  vsubfp v7, v4, v5
+  vmrghw v8, v6, v7
+  vmrglw v9, v6, v7
+  vperm v10, v8, v9, v13
+  vcmpgtfp v11, v10, v12
+  vand v10, v10, v11
+  stvx v10, r7, r3
+  addi r7, r7, 32
+  addi r8, r8, 32
+  bdnz bench_vmx_loop
+  blr
+
+bench_vmx_accumulate:
+  # Horizontal reduction feeding a scalar result through memory.
+  mtctr r5
+  li r7, 0
+  vxor v0, v0, v0
+bench_vmx_acc_loop:
+  lvx v1, r7, r4
+  vaddfp v0, v0, v1
+  addi r7, r7, 16
+  bdnz bench_vmx_acc_loop
+  vsldoi v2, v0, v0, 8
+  vaddfp v0, v0, v2
+  vsldoi v2, v0, v0, 4
+  vaddfp v0, v0, v2
+  stvx v0, 0, r3
+  blr
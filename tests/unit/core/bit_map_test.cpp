@@ -0,0 +1,144 @@
+/**
+ * Unit tests for BitMap (rex/bit.h)
+ *
+ * Covers acquire/release, summary-accelerated scans and the bulk range APIs.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <rex/bit.h>
+
+using rex::bit::BitMap;
+
+TEST_CASE("BitMap Acquire hands out every entry once", "[bit][bitmap]") {
+  BitMap map(128);
+
+  std::vector<bool> seen(128, false);
+  for (int i = 0; i < 128; i++) {
+    size_t index = map.Acquire();
+    REQUIRE(index != size_t(-1));
+    REQUIRE(index < 128);
+    CHECK_FALSE(seen[index]);
+    seen[index] = true;
+  }
+  CHECK(map.Acquire() == size_t(-1));
+}
+
+TEST_CASE("BitMap Release makes an entry acquirable again", "[bit][bitmap]") {
+  BitMap map(64);
+  while (map.Acquire() != size_t(-1)) {
+  }
+
+  map.Release(37);
+  CHECK(map.Acquire() == 37);
+  CHECK(map.Acquire() == size_t(-1));
+}
+
+TEST_CASE("BitMap FindFirstSet skips empty spans through the summary", "[bit][bitmap]") {
+  // Large enough that the scan crosses several summary words.
+  constexpr size_t kBits = 64 * 64 * 4;
+  BitMap map(kBits);
+  map.ClearRange(0, kBits);
+
+  CHECK(map.FindFirstSet() == size_t(-1));
+
+  map.SetRange(kBits - 70, 3);
+  CHECK(map.FindFirstSet() == kBits - 70);
+  CHECK(map.FindFirstSet(kBits - 69) == kBits - 69);
+  CHECK(map.FindFirstSet(kBits - 67) == size_t(-1));
+}
+
+TEST_CASE("BitMap NextSetRange enumerates runs", "[bit][bitmap]") {
+  constexpr size_t kBits = 64 * 64;
+  BitMap map(kBits);
+  map.ClearRange(0, kBits);
+
+  // Two runs, one crossing a word boundary.
+  map.SetRange(10, 5);
+  map.SetRange(60, 200);
+
+  auto range = map.NextSetRange(0);
+  CHECK(range.first == 10);
+  CHECK(range.second == 5);
+
+  range = map.NextSetRange(range.first + range.second);
+  CHECK(range.first == 60);
+  CHECK(range.second == 200);
+
+  range = map.NextSetRange(range.first + range.second);
+  CHECK(range.second == 0);
+}
+
+TEST_CASE("BitMap run at the very end of the map is closed correctly", "[bit][bitmap]") {
+  BitMap map(256);
+  map.ClearRange(0, 256);
+  map.SetRange(250, 6);
+
+  auto range = map.NextSetRange(0);
+  CHECK(range.first == 250);
+  CHECK(range.second == 6);
+}
+
+TEST_CASE("BitMap ClearRange then Acquire skips cleared entries", "[bit][bitmap]") {
+  BitMap map(128);
+  map.ClearRange(0, 64);
+
+  CHECK(map.Acquire() == 64);
+}
+
+TEST_CASE("BitMap SetRange and ClearRange match per-bit reference", "[bit][bitmap]") {
+  constexpr size_t kBits = 64 * 8;
+  BitMap map(kBits);
+  map.ClearRange(0, kBits);
+  std::vector<bool> reference(kBits, false);
+
+  struct Op {
+    bool set;
+    size_t first;
+    size_t length;
+  };
+  const Op ops[] = {
+      {true, 3, 61}, {true, 100, 130}, {false, 120, 20}, {true, 500, 12}, {false, 0, 64},
+  };
+  for (const Op& op : ops) {
+    if (op.set) {
+      map.SetRange(op.first, op.length);
+    } else {
+      map.ClearRange(op.first, op.length);
+    }
+    for (size_t i = 0; i < op.length; i++) {
+      reference[op.first + i] = op.set;
+    }
+  }
+
+  size_t position = 0;
+  while (true) {
+    auto range = map.NextSetRange(position);
+    if (!range.second) {
+      break;
+    }
+    for (size_t i = position; i < range.first; i++) {
+      CHECK_FALSE(reference[i]);
+    }
+    for (size_t i = range.first; i < range.first + range.second; i++) {
+      CHECK(reference[i]);
+    }
+    position = range.first + range.second;
+  }
+  for (size_t i = position; i < kBits; i++) {
+    CHECK_FALSE(reference[i]);
+  }
+}
+
+TEST_CASE("BitMap Resize preserves entries and frees new ones", "[bit][bitmap]") {
+  BitMap map(64);
+  while (map.Acquire() != size_t(-1)) {
+  }
+
+  map.Resize(192);
+  CHECK(map.Acquire() == 64);
+  CHECK(map.FindFirstSet(0) == 65);
+}
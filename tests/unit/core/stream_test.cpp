@@ -368,6 +368,51 @@ TEST_CASE("BitStream maximum bits (57)", "[stream][bitstream]") {
   CHECK(stream.Read(57) == expected);
 }
 
+TEST_CASE("BitStream ReadMany extracts fields in order", "[stream][bitstream]") {
+  // 0xAB 0xCD = 10101011 11001101
+  std::array<uint8_t, 16> buffer = {0xAB, 0xCD, 0xEF, 0x12, 0x34, 0x56, 0x78, 0x9A};
+  BitStream stream(buffer.data(), buffer.size() * 8);
+
+  const uint8_t widths[] = {4, 4, 8, 1};
+  uint64_t values[4] = {};
+  stream.ReadMany(widths, values, 4);
+
+  CHECK(values[0] == 0xA);
+  CHECK(values[1] == 0xB);
+  CHECK(values[2] == 0xCD);
+  CHECK(values[3] == 1);  // 0xEF starts with 1110...
+  CHECK(stream.offset_bits() == 17);
+}
+
+TEST_CASE("BitStream ReadMany wider than one window", "[stream][bitstream]") {
+  std::array<uint8_t, 16> buffer = {0xAB, 0xCD, 0xEF, 0x12, 0x34, 0x56, 0x78, 0x9A,
+                                    0xBC, 0xDE, 0xF0, 0x11, 0x22, 0x33, 0x44, 0x55};
+  BitStream stream(buffer.data(), buffer.size() * 8);
+
+  // 3 * 32 = 96 bits total forces the field-by-field fallback.
+  const uint8_t widths[] = {32, 32, 32};
+  uint64_t values[3] = {};
+  stream.ReadMany(widths, values, 3);
+
+  CHECK(values[0] == 0xABCDEF12);
+  CHECK(values[1] == 0x3456789A);
+  CHECK(values[2] == 0xBCDEF011);
+  CHECK(stream.offset_bits() == 96);
+}
+
+TEST_CASE("BitStream rewinding re-reads the same bits", "[stream][bitstream]") {
+  std::array<uint8_t, 16> buffer = {0xAB, 0xCD, 0xEF, 0x12, 0x34, 0x56, 0x78, 0x9A,
+                                    0xBC, 0xDE, 0xF0, 0x11, 0x22, 0x33, 0x44, 0x55};
+  BitStream stream(buffer.data(), buffer.size() * 8);
+
+  // Move far enough forward that the cached window no longer covers offset 0.
+  stream.SetOffset(80);
+  CHECK(stream.Read(8) == 0xF0);
+
+  stream.SetOffset(4);
+  CHECK(stream.Read(8) == 0xBC);  // Low nibble of 0xAB + high nibble of 0xCD.
+}
+
 TEST_CASE("BitStream BitsRemaining decreases", "[stream][bitstream]") {
   std::array<uint8_t, 16> buffer{};
   BitStream stream(buffer.data(), 64);  // 64 bits = 8 bytes